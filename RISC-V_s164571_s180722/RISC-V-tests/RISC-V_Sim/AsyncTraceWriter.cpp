@@ -0,0 +1,170 @@
+#include "AsyncTraceWriter.h"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <chrono>
+#include <atomic>
+
+//records the consumer hands to the sink before telling the
+//producer about the room it made
+static const uint64_t CONSUME_BATCH = 1024;
+//empty polls before the consumer starts sleeping between them
+static const uint32_t SPIN_POLLS = 64;
+static const auto IDLE_SLEEP = std::chrono::microseconds(200);
+
+const uint32_t AsyncTraceWriter::DEFAULT_CAPACITY;
+
+AsyncTraceWriter::AsyncTraceWriter(std::shared_ptr<TraceSink> sink, const uint32_t capacity, const TraceFullPolicy policy) :
+	sink(std::move(sink)),
+	policy(policy)
+{
+	if (!this->sink)
+	{
+		throw std::runtime_error("An asynchronous trace needs a sink to write to.");
+	}
+	uint64_t size = 2;
+	while (size < capacity)
+	{
+		size *= 2;
+	}
+	ring.resize(static_cast<size_t>(size));
+	mask = size - 1;
+	thread = std::thread(&AsyncTraceWriter::Consume, this);
+}
+
+AsyncTraceWriter::~AsyncTraceWriter()
+{
+	try
+	{
+		Close();
+	}
+	catch (const std::runtime_error&)
+	{
+	}
+}
+
+void AsyncTraceWriter::Write(const TraceRecord& record)
+{
+	const uint64_t position = tail.load(std::memory_order_relaxed);
+	if (position - knownHead > mask)
+	{
+		knownHead = head.load(std::memory_order_acquire);
+		while (position - knownHead > mask)
+		{
+			if (policy == TraceFullPolicy::Drop)
+			{
+				dropped.store(dropped.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+				return;
+			}
+			std::this_thread::yield();
+			knownHead = head.load(std::memory_order_acquire);
+		}
+	}
+	ring[position & mask] = record;
+	tail.store(position + 1, std::memory_order_release);
+}
+
+void AsyncTraceWriter::Consume()
+{
+	uint64_t position = head.load(std::memory_order_relaxed);
+	bool isFlushed = true;
+	uint32_t emptyPolls = 0;
+	while (true)
+	{
+		const uint64_t end = tail.load(std::memory_order_acquire);
+		if (position == end)
+		{
+			//the producer stops writing before it sets isStopping,
+			//so once it is set an empty ring stays empty
+			const bool isLast = isStopping.load(std::memory_order_acquire) && position == tail.load(std::memory_order_acquire);
+			if (!isFlushed || isLast)
+			{
+				isFlushed = true;
+				if (!hasFailed.load(std::memory_order_relaxed))
+				{
+					try
+					{
+						sink->Flush();
+					}
+					catch (const std::runtime_error& e)
+					{
+						failure = e.what();
+						hasFailed.store(true, std::memory_order_release);
+					}
+				}
+				flushed.store(position, std::memory_order_release);
+			}
+			if (isLast)
+			{
+				return;
+			}
+			if (++emptyPolls < SPIN_POLLS)
+			{
+				std::this_thread::yield();
+			}
+			else
+			{
+				std::this_thread::sleep_for(IDLE_SLEEP);
+			}
+			continue;
+		}
+
+		emptyPolls = 0;
+		isFlushed = false;
+		const uint64_t batchEnd = (end - position > CONSUME_BATCH) ? position + CONSUME_BATCH : end;
+		if (!hasFailed.load(std::memory_order_relaxed))
+		{
+			try
+			{
+				for (; position != batchEnd; position++)
+				{
+					sink->Write(ring[position & mask]);
+				}
+			}
+			catch (const std::runtime_error& e)
+			{
+				failure = e.what();
+				hasFailed.store(true, std::memory_order_release);
+			}
+		}
+		position = batchEnd;
+		head.store(position, std::memory_order_release);
+	}
+}
+
+void AsyncTraceWriter::Close()
+{
+	if (isClosed)
+	{
+		return;
+	}
+	isClosed = true;
+	isStopping.store(true, std::memory_order_release);
+	thread.join();
+	if (hasFailed.load(std::memory_order_acquire))
+	{
+		throw std::runtime_error("Writing the trace failed.\n" + failure);
+	}
+}
+
+void AsyncTraceWriter::Drain()
+{
+	//the consumer flushes once it has emptied the ring, which it does
+	//at the latest after its idle sleep
+	const uint64_t end = tail.load(std::memory_order_relaxed);
+	while (!isClosed && flushed.load(std::memory_order_acquire) < end)
+	{
+		std::this_thread::yield();
+	}
+}
+
+uint64_t AsyncTraceWriter::GetDroppedCount() const
+{
+	return dropped.load(std::memory_order_relaxed);
+}
+
+uint32_t AsyncTraceWriter::GetCapacity() const
+{
+	return static_cast<uint32_t>(mask + 1);
+}
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include "TraceSink.h"
+
+//what the processor does when the background thread has fallen so far
+//behind that the ring is full
+enum class TraceFullPolicy
+{
+	//wait for room, the trace is complete but the run slows down
+	Block,
+	//throw the record away and count it, the run never waits
+	Drop
+};
+
+//Moves the work of a trace off the thread running the processor. Write
+//only copies the record into a ring buffer, and a background thread takes
+//the records out in batches and hands them to sink, which does the
+//formatting, compressing and writing. There is one producer and one
+//consumer, so the ring only needs an atomic index for each of them and
+//neither thread ever takes a lock.
+//Dropped records leave a gap in the instruction numbers the sink sees.
+//The sink is flushed whenever the ring runs empty and when the writer
+//is closed, which the destructor does.
+class AsyncTraceWriter : public TraceSink
+{
+public:
+	const static uint32_t DEFAULT_CAPACITY = 1 << 16;
+
+private:
+	const static uint32_t CACHE_LINE_SIZE = 64;
+
+	std::shared_ptr<TraceSink> sink;
+	TraceFullPolicy policy;
+	std::vector<TraceRecord> ring;
+	uint64_t mask;
+	std::thread thread;
+	std::atomic<bool> isStopping{ false };
+	bool isClosed = false;
+	//set by the background thread when the sink threw, after
+	//which the records are thrown away so Write never blocks
+	std::atomic<bool> hasFailed{ false };
+	std::string failure;
+
+	//the producer and the consumer index are on their own cache lines
+	//so the two threads don't keep taking a line from each other
+	char producerPadding[CACHE_LINE_SIZE];
+	//the next slot to write, only changed by the producer
+	std::atomic<uint64_t> tail{ 0 };
+	//the last head the producer saw, so it only reads
+	//the consumer's line when the ring looks full
+	uint64_t knownHead = 0;
+	std::atomic<uint64_t> dropped{ 0 };
+	char consumerPadding[CACHE_LINE_SIZE];
+	//the next slot to read, only changed by the consumer
+	std::atomic<uint64_t> head{ 0 };
+	//every record before this has been handed to the sink and flushed
+	std::atomic<uint64_t> flushed{ 0 };
+	char endPadding[CACHE_LINE_SIZE];
+
+	void Consume();
+
+public:
+	//capacity is rounded up to a power of two
+	AsyncTraceWriter(std::shared_ptr<TraceSink> sink, const uint32_t capacity = DEFAULT_CAPACITY, const TraceFullPolicy policy = TraceFullPolicy::Block);
+	AsyncTraceWriter(const AsyncTraceWriter&) = delete;
+	AsyncTraceWriter& operator=(const AsyncTraceWriter&) = delete;
+	~AsyncTraceWriter();
+
+	void Write(const TraceRecord& record) override;
+	//waits for the background thread to hand every record to the sink,
+	//then flushes it. Throws if the sink failed
+	void Close();
+	//waits until every record written so far has been handed to the sink
+	//and flushed, so the producer can write to the same stream after them
+	void Drain();
+	uint64_t GetDroppedCount() const;
+	uint32_t GetCapacity() const;
+};
@@ -0,0 +1,269 @@
+#include "BatchRunner.h"
+#include <cstdint>
+#include <cctype>
+#include <stdexcept>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <memory>
+#include <sys/types.h>
+#include <sys/stat.h>
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+#include "WorkStealingPool.h"
+#include "ReadProgram.h"
+#include "RISCV_Program.h"
+
+static const std::string BIN_EXTENSION = ".bin";
+
+static bool EndsWith(const std::string& text, const std::string& ending)
+{
+	return text.size() >= ending.size() && text.compare(text.size() - ending.size(), ending.size(), ending) == 0;
+}
+
+static std::string RemoveBinExtension(const std::string& path)
+{
+	return EndsWith(path, BIN_EXTENSION) ? path.substr(0, path.size() - BIN_EXTENSION.size()) : path;
+}
+
+static bool IsDirectory(const std::string& path)
+{
+	struct stat info;
+	return stat(path.c_str(), &info) == 0 && (info.st_mode & S_IFDIR) != 0;
+}
+
+static std::vector<std::string> ListDirectory(const std::string& directory)
+{
+	std::vector<std::string> names;
+#ifdef _WIN32
+	WIN32_FIND_DATAA entry;
+	const HANDLE search = FindFirstFileA((directory + "\\*").c_str(), &entry);
+	if (search == INVALID_HANDLE_VALUE)
+	{
+		throw std::runtime_error("Failed to open directory: " + directory);
+	}
+	do
+	{
+		names.push_back(entry.cFileName);
+	} while (FindNextFileA(search, &entry));
+	FindClose(search);
+#else
+	DIR* const dir = opendir(directory.c_str());
+	if (dir == nullptr)
+	{
+		throw std::runtime_error("Failed to open directory: " + directory);
+	}
+	while (const dirent* entry = readdir(dir))
+	{
+		names.push_back(entry->d_name);
+	}
+	closedir(dir);
+#endif
+	return names;
+}
+
+static std::string DirectoryOf(const std::string& path)
+{
+	const size_t slash = path.find_last_of("/\\");
+	return (slash == std::string::npos) ? "" : path.substr(0, slash + 1);
+}
+
+static bool IsAbsolutePath(const std::string& path)
+{
+	return (!path.empty() && (path[0] == '/' || path[0] == '\\')) || (path.size() > 1 && path[1] == ':');
+}
+
+static std::vector<std::string> ReadManifest(const std::string& manifestPath)
+{
+	std::ifstream manifest(manifestPath);
+	if (!manifest)
+	{
+		throw std::runtime_error("Failed to open file: " + manifestPath);
+	}
+
+	//relative paths are relative to the manifest
+	//so it can be used from any directory
+	const std::string directory = DirectoryOf(manifestPath);
+	std::vector<std::string> programs;
+	std::string line;
+	while (std::getline(manifest, line))
+	{
+		line.erase(std::find_if(line.rbegin(), line.rend(), [](char c) { return !std::isspace(static_cast<unsigned char>(c)); }).base(), line.end());
+		if (line.empty() || line[0] == '#')
+		{
+			continue;
+		}
+		const std::string path = IsAbsolutePath(line) ? line : directory + line;
+		programs.push_back(RemoveBinExtension(path));
+	}
+	return programs;
+}
+
+std::vector<std::string> FindBatchPrograms(const std::string& source)
+{
+	if (!IsDirectory(source))
+	{
+		return ReadManifest(source);
+	}
+
+	const std::string directory = EndsWith(source, "/") || EndsWith(source, "\\") ? source : source + "/";
+	std::vector<std::string> programs;
+	for (const std::string& name : ListDirectory(source))
+	{
+		if (EndsWith(name, BIN_EXTENSION))
+		{
+			programs.push_back(directory + RemoveBinExtension(name));
+		}
+	}
+
+	//directory order depends on the file system
+	std::sort(programs.begin(), programs.end());
+	return programs;
+}
+
+static std::string FirstLine(const std::string& text)
+{
+	return text.substr(0, text.find('\n'));
+}
+
+BatchResult RunBatchProgram(const std::string& programPath, const RunLimits& limits)
+{
+	BatchResult result = { programPath, BatchStatus::Error, 0, 0.0, "" };
+	const auto start = std::chrono::steady_clock::now();
+	try
+	{
+		bool foundRegisterFile;
+		const std::unique_ptr<RISCV_Program> program = LoadProgram(programPath, &foundRegisterFile);
+		program->SetLimits(limits);
+		program->Run();
+		result.instructionsExecuted = program->GetInstructionsExecuted();
+
+		if (!foundRegisterFile)
+		{
+			result.status = BatchStatus::NoRegisterFile;
+		}
+		else if (program->CheckProgramResult())
+		{
+			result.status = BatchStatus::Passed;
+		}
+		else
+		{
+			result.status = BatchStatus::Failed;
+			result.message = "Incorrect program result";
+		}
+	}
+	catch (const std::exception& e)
+	{
+		result.status = BatchStatus::Error;
+		result.message = FirstLine(e.what());
+	}
+	result.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+	return result;
+}
+
+BatchSummary RunBatchPrograms(const std::vector<std::string>& programs, const uint32_t threadCount, const RunLimits& limits)
+{
+	BatchSummary summary;
+	summary.results.resize(programs.size());
+
+	const auto start = std::chrono::steady_clock::now();
+	{
+		WorkStealingPool pool(threadCount);
+		summary.threadCount = pool.GetThreadCount();
+		for (size_t i = 0; i < programs.size(); i++)
+		{
+			//every task writes its own slot so the
+			//results needs no lock and keep their order
+			BatchResult* const result = &summary.results[i];
+			const std::string* const program = &programs[i];
+			pool.Submit([result, program, &limits]() { *result = RunBatchProgram(*program, limits); });
+		}
+		pool.Wait();
+	}
+	summary.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	return summary;
+}
+
+std::string BatchStatusName(const BatchStatus status)
+{
+	switch (status)
+	{
+		case BatchStatus::Passed:
+			return "PASS";
+		case BatchStatus::Failed:
+			return "FAIL";
+		case BatchStatus::NoRegisterFile:
+			return "NO RES";
+		default:
+			return "ERROR";
+	}
+}
+
+static uint32_t CountStatus(const BatchSummary& summary, const BatchStatus status)
+{
+	return static_cast<uint32_t>(std::count_if(summary.results.begin(), summary.results.end(), [status](const BatchResult& result) { return result.status == status; }));
+}
+
+void PrintBatchSummary(const BatchSummary& summary, std::ostream& output)
+{
+	size_t nameWidth = std::string("Program").size();
+	uint64_t totalInstructions = 0;
+	for (const BatchResult& result : summary.results)
+	{
+		nameWidth = std::max(nameWidth, result.program.size());
+		totalInstructions += result.instructionsExecuted;
+	}
+
+	output << std::left << std::setw(nameWidth) << "Program" << "  " << std::setw(6) << "Result" << "  ";
+	output << std::right << std::setw(14) << "Instructions" << "  " << std::setw(12) << "Time (ms)" << "  Message" << std::endl;
+	for (const BatchResult& result : summary.results)
+	{
+		output << std::left << std::setw(nameWidth) << result.program << "  " << std::setw(6) << BatchStatusName(result.status) << "  ";
+		output << std::right << std::setw(14) << result.instructionsExecuted << "  ";
+		output << std::setw(12) << std::fixed << std::setprecision(3) << result.milliseconds << "  " << result.message << std::endl;
+	}
+
+	output << std::endl;
+	output << "Passed: " << CountStatus(summary, BatchStatus::Passed);
+	output << "  Failed: " << CountStatus(summary, BatchStatus::Failed);
+	output << "  Errors: " << CountStatus(summary, BatchStatus::Error);
+	output << "  No register file: " << CountStatus(summary, BatchStatus::NoRegisterFile);
+	output << "  Total: " << summary.results.size() << std::endl;
+	output << "Instructions executed: " << totalInstructions << std::endl;
+	output << "Wall time: " << std::fixed << std::setprecision(3) << summary.milliseconds << " ms  Threads: " << summary.threadCount << std::endl;
+}
+
+bool BatchPassed(const BatchSummary& summary)
+{
+	return CountStatus(summary, BatchStatus::Passed) == summary.results.size();
+}
+
+int RunBatch(const std::string& source, const std::string& summaryPath, const uint32_t threadCount, const RunLimits& limits)
+{
+	const std::vector<std::string> programs = FindBatchPrograms(source);
+	if (programs.empty())
+	{
+		throw std::runtime_error("No programs found in " + source);
+	}
+
+	const BatchSummary summary = RunBatchPrograms(programs, threadCount, limits);
+	PrintBatchSummary(summary, std::cout);
+
+	std::ofstream summaryFile(summaryPath);
+	if (!summaryFile)
+	{
+		throw std::runtime_error("Failed to create file: " + summaryPath);
+	}
+	PrintBatchSummary(summary, summaryFile);
+
+	return BatchPassed(summary) ? 0 : -1;
+}
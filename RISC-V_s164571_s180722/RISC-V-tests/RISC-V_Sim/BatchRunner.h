@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+#include "RISCV_Program.h"
+
+enum class BatchStatus
+{
+	Passed,
+	Failed,
+	Error,
+	NoRegisterFile
+};
+
+struct BatchResult
+{
+	std::string program;
+	BatchStatus status;
+	uint64_t instructionsExecuted;
+	double milliseconds;
+	//first line of why the program failed, empty when it passed
+	std::string message;
+};
+
+struct BatchSummary
+{
+	std::vector<BatchResult> results;
+	uint32_t threadCount;
+	double milliseconds;
+};
+
+//source is either a directory, where every .bin file is a program,
+//or a manifest with one program path per line. Paths are returned
+//without the .bin extension the same way LoadProgram takes them
+std::vector<std::string> FindBatchPrograms(const std::string& source);
+
+//loads and runs one program and checks it against its .res file,
+//an exception is turned into an error result
+BatchResult RunBatchProgram(const std::string& programPath, const RunLimits& limits);
+
+//runs every program on a work stealing pool and checks it against
+//its .res file. A failing program, or one going over the limits,
+//doesn't stop the rest of the batch.
+//Results are in the same order as the programs
+BatchSummary RunBatchPrograms(const std::vector<std::string>& programs, const uint32_t threadCount, const RunLimits& limits);
+
+//PASS, FAIL, ERROR or NO RES
+std::string BatchStatusName(const BatchStatus status);
+void PrintBatchSummary(const BatchSummary& summary, std::ostream& output);
+bool BatchPassed(const BatchSummary& summary);
+
+//the --batch command, writes the summary to stdout and summaryPath
+int RunBatch(const std::string& source, const std::string& summaryPath, const uint32_t threadCount, const RunLimits& limits);
@@ -0,0 +1,1049 @@
+#include "Benchmark.h"
+#include <cstdint>
+#include <stdexcept>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <memory>
+#include <thread>
+#include <functional>
+#include <sstream>
+#include <cstdio>
+#include <fstream>
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+#include "PhysicalMemory.h"
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "RISCV_Program.h"
+#include "UART.h"
+#include "Processor.h"
+#include "LockstepEngine.h"
+#include "SMPSystem.h"
+#include "CSR.h"
+#include "BatchRunner.h"
+#include "ForkServer.h"
+#include "ProgramImage.h"
+#include "InstructionDecode.h"
+#include "ReferenceDecode.h"
+#include "TSrandom.h"
+#include "ExecutionTrace.h"
+#include "AsyncTraceWriter.h"
+
+static const int32_t RAM_SIZE = 0x00'00'7f'ff;
+static const uint32_t ACCESS_COUNT = 1 << 16;
+static const uint32_t ROUNDS = 256;
+static const uint32_t REPEATS = 5;
+
+//the memory path the processor used before devices could be
+//mapped, a bounds check followed by plain byte accesses
+class FlatMemory
+{
+private:
+	std::vector<uint8_t> memory;
+
+	void VerifyMemorySpace(const int32_t index, const int32_t size)
+	{
+		if (index < 0 || index + size > RAM_SIZE)
+		{
+			throw std::runtime_error("Memory access out of range.\nTried to access memory address " + std::to_string(index));
+		}
+	}
+
+public:
+	FlatMemory() : memory(RAM_SIZE, 0) { }
+
+	uint32_t ReadWord(const int32_t index)
+	{
+		VerifyMemorySpace(index, 4);
+
+		const uint32_t t1 = static_cast<uint32_t>(memory[index + 0]);
+		const uint32_t t2 = static_cast<uint32_t>(memory[index + 1]);
+		const uint32_t t3 = static_cast<uint32_t>(memory[index + 2]);
+		const uint32_t t4 = static_cast<uint32_t>(memory[index + 3]);
+
+		return (t1 <<  0) |
+			   (t2 <<  8) |
+			   (t3 << 16) |
+			   (t4 << 24);
+	}
+
+	void WriteWord(const int32_t index, const uint32_t word)
+	{
+		VerifyMemorySpace(index, 4);
+
+		memory[index + 0] = static_cast<uint8_t>(word >>  0);
+		memory[index + 1] = static_cast<uint8_t>(word >>  8);
+		memory[index + 2] = static_cast<uint8_t>(word >> 16);
+		memory[index + 3] = static_cast<uint8_t>(word >> 24);
+	}
+};
+
+//loads and stores the same word aligned addresses through either
+//memory implementation and returns the fastest time per access
+template<typename Memory>
+static double TimeAccesses(Memory& memory, const std::vector<uint32_t>& addresses, uint32_t* checksum)
+{
+	double bestTime = 1e30;
+	for (uint32_t repeat = 0; repeat < REPEATS; repeat++)
+	{
+		uint32_t sum = 0;
+		const auto start = std::chrono::steady_clock::now();
+		for (uint32_t round = 0; round < ROUNDS; round++)
+		{
+			for (const uint32_t address : addresses)
+			{
+				const uint32_t value = memory.ReadWord(address);
+				memory.WriteWord(address, value + round);
+				sum += value;
+			}
+		}
+		const auto end = std::chrono::steady_clock::now();
+
+		bestTime = std::min(bestTime, std::chrono::duration<double, std::nano>(end - start).count());
+		*checksum += sum;
+	}
+
+	return bestTime / (static_cast<double>(ROUNDS) * addresses.size() * 2);
+}
+
+//runs a load/store loop in the guest and returns
+//millions of executed instructions per second
+static double TimeGuestLoop(const bool withDevices, const bool withWatchpoint)
+{
+	const uint32_t iterations = 1'000'000;
+	RISCV_Program program("BenchmarkMemory");
+	if (withDevices)
+	{
+		program.AttachDevice(UART::DEFAULT_BASE, UART::SIZE, std::make_shared<UART>(nullptr));
+	}
+	if (withWatchpoint)
+	{
+		//on another page than the one the loop uses, which
+		//leaves the loop below the longest run of unwatched pages
+		program.AddWatchpoint({ 0x3000, 4, WatchType::Write });
+	}
+
+	program.SetRegister(Regs::t0, iterations);
+	program.SetRegister(Regs::t1, 0x1000);
+	program.AddInstruction(Create_lw(Regs::t2, Regs::t1, 0));
+	program.AddInstruction(Create_addi(Regs::t2, Regs::t2, 1));
+	program.AddInstruction(Create_sw(Regs::t1, Regs::t2, 0));
+	program.AddInstruction(Create_lbu(Regs::t3, Regs::t1, 4));
+	program.AddInstruction(Create_sb(Regs::t1, Regs::t2, 4));
+	program.AddInstruction(Create_addi(Regs::t0, Regs::t0, -1));
+	program.AddInstruction(Create_bne(Regs::t0, Regs::x0, -24));
+	program.EndProgram();
+
+	const uint64_t executed = static_cast<uint64_t>(iterations) * 7 + program.GetInstructionCount() - 7;
+	double bestTime = 1e30;
+	for (uint32_t repeat = 0; repeat < REPEATS; repeat++)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		program.Run();
+		const auto end = std::chrono::steady_clock::now();
+		bestTime = std::min(bestTime, std::chrono::duration<double>(end - start).count());
+	}
+
+	return executed / bestTime / 1e6;
+}
+
+void BenchmarkMemory()
+{
+	//same pseudo random but deterministic address stream for both
+	std::vector<uint32_t> addresses(ACCESS_COUNT);
+	uint32_t state = 12345;
+	for (uint32_t& address : addresses)
+	{
+		state = state * 1664525 + 1013904223;
+		address = (state >> 8) % ((RAM_SIZE - 4) / 4) * 4;
+	}
+
+	uint32_t checksum = 0;
+	FlatMemory flat;
+	PhysicalMemory physical({ RAM_SIZE, false, false });
+	physical.MapDevice(UART::DEFAULT_BASE, UART::SIZE, std::make_shared<UART>(nullptr));
+
+	const double flatTime = TimeAccesses(flat, addresses, &checksum);
+	const double physicalTime = TimeAccesses(physical, addresses, &checksum);
+	const double guestMIPS = TimeGuestLoop(false, false);
+	const double guestDeviceMIPS = TimeGuestLoop(true, false);
+	const double guestWatchpointMIPS = TimeGuestLoop(false, true);
+
+	std::cout << std::fixed << std::setprecision(3);
+	std::cout << "Flat memory:             " << flatTime << " ns/access" << std::endl;
+	std::cout << "Physical memory (RAM):   " << physicalTime << " ns/access" << std::endl;
+	std::cout << "Relative cost:           " << std::setprecision(2) << (100.0 * physicalTime / flatTime) << "%" << std::endl;
+	std::cout << "Guest load/store loop:   " << guestMIPS << " MIPS" << std::endl;
+	std::cout << "Same with a UART mapped: " << guestDeviceMIPS << " MIPS" << std::endl;
+	std::cout << "Same with a watchpoint:  " << guestWatchpointMIPS << " MIPS" << std::endl;
+	//printed so the compiler can't remove the accesses
+	std::cout << "Checksum: " << checksum << std::endl;
+}
+
+//a hash loop where a quarter of the iterations
+//skip an add, which splits up the lanes
+static std::vector<uint32_t> LockstepKernel()
+{
+	return
+	{
+		Create_mul(Regs::t0, Regs::a1, Regs::a1),
+		Create_srli(Regs::t1, Regs::t0, 7),
+		Create_xor(Regs::a1, Regs::a1, Regs::t1),
+		Create_addi(Regs::a1, Regs::a1, 0x35),
+		Create_andi(Regs::t2, Regs::a1, 3),
+		Create_bne(Regs::t2, Regs::x0, 8),
+		Create_add(Regs::s0, Regs::s0, Regs::a1),
+		Create_add(Regs::s1, Regs::s1, Regs::t0),
+		Create_xor(Regs::s2, Regs::s2, Regs::s1),
+		Create_addi(Regs::a2, Regs::a2, static_cast<uint32_t>(-1)),
+		Create_bne(Regs::a2, Regs::x0, static_cast<uint32_t>(-40)),
+		Create_addi(Regs::a0, Regs::x0, 10),
+		Create_ecall()
+	};
+}
+
+static const uint32_t LOCKSTEP_ITERATIONS = 100'000;
+
+static uint32_t KernelSeed(const uint32_t lane)
+{
+	return 0x9e37'79b9u * (lane + 1);
+}
+
+//returns MIPS summed over every lane, the final s2 of every lane is put in results
+static double TimeProcessors(const std::vector<uint32_t>& program, const uint32_t laneCount, std::vector<uint32_t>* results)
+{
+	std::vector<std::unique_ptr<Processor>> processors;
+	for (uint32_t lane = 0; lane < laneCount; lane++)
+	{
+		processors.push_back(std::make_unique<Processor>());
+		processors.back()->SetUseConsole(false);
+	}
+
+	double bestTime = 1e30;
+	uint64_t executed = 0;
+	for (uint32_t repeat = 0; repeat < REPEATS; repeat++)
+	{
+		executed = 0;
+		const auto start = std::chrono::steady_clock::now();
+		for (uint32_t lane = 0; lane < laneCount; lane++)
+		{
+			Processor& processor = *processors[lane];
+			processor.Load(program.data(), program.size());
+			processor.SetRegister(static_cast<uint32_t>(Regs::a1), KernelSeed(lane));
+			processor.SetRegister(static_cast<uint32_t>(Regs::a2), LOCKSTEP_ITERATIONS);
+			processor.RunFor(UINT64_MAX);
+			executed += processor.GetInstructionsExecuted();
+		}
+		const auto end = std::chrono::steady_clock::now();
+		bestTime = std::min(bestTime, std::chrono::duration<double>(end - start).count());
+	}
+
+	results->clear();
+	for (const auto& processor : processors)
+	{
+		results->push_back(processor->GetRegister(static_cast<uint32_t>(Regs::s2)));
+	}
+	return executed / bestTime / 1e6;
+}
+
+static double TimeLockstep(const std::vector<uint32_t>& program, const uint32_t laneCount, const bool useAVX2,
+	std::vector<uint32_t>* results, double* utilization, uint64_t* divergences)
+{
+	LockstepEngine engine(laneCount, Processor::DefaultMemoryOptions().ramSize);
+	engine.SetUseAVX2(useAVX2);
+
+	double bestTime = 1e30;
+	for (uint32_t repeat = 0; repeat < REPEATS; repeat++)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		engine.Load(program.data(), program.size());
+		for (uint32_t lane = 0; lane < laneCount; lane++)
+		{
+			engine.SetRegister(lane, static_cast<uint32_t>(Regs::a1), KernelSeed(lane));
+			engine.SetRegister(lane, static_cast<uint32_t>(Regs::a2), LOCKSTEP_ITERATIONS);
+		}
+		engine.Run(UINT64_MAX);
+		const auto end = std::chrono::steady_clock::now();
+		bestTime = std::min(bestTime, std::chrono::duration<double>(end - start).count());
+	}
+
+	results->clear();
+	for (uint32_t lane = 0; lane < laneCount; lane++)
+	{
+		results->push_back(engine.GetRegister(lane, static_cast<uint32_t>(Regs::s2)));
+	}
+	*utilization = engine.GetLaneUtilization();
+	*divergences = engine.GetStatistics().divergences;
+	return engine.GetStatistics().laneInstructions / bestTime / 1e6;
+}
+
+void BenchmarkLockstep()
+{
+	const std::vector<uint32_t> program = LockstepKernel();
+	const bool hasAVX2 = LockstepEngine::IsAVX2Supported();
+
+	std::cout << std::fixed << std::setprecision(2);
+	for (const uint32_t laneCount : { 8u, 16u })
+	{
+		std::vector<uint32_t> expected;
+		std::vector<uint32_t> scalarResults;
+		std::vector<uint32_t> avx2Results;
+		double utilization;
+		uint64_t divergences;
+
+		const double processorMIPS = TimeProcessors(program, laneCount, &expected);
+		const double scalarMIPS = TimeLockstep(program, laneCount, false, &scalarResults, &utilization, &divergences);
+		const double avx2MIPS = hasAVX2 ? TimeLockstep(program, laneCount, true, &avx2Results, &utilization, &divergences) : 0.0;
+
+		if (scalarResults != expected || (hasAVX2 && avx2Results != expected))
+		{
+			throw std::runtime_error("Lockstep lanes didn't end like the processors.\nLanes: " + std::to_string(laneCount));
+		}
+
+		std::cout << laneCount << " lanes" << std::endl;
+		std::cout << "  Independent processors: " << processorMIPS << " MIPS" << std::endl;
+		std::cout << "  Lockstep without AVX2:  " << scalarMIPS << " MIPS" << std::endl;
+		if (hasAVX2)
+		{
+			std::cout << "  Lockstep with AVX2:     " << avx2MIPS << " MIPS" << std::endl;
+		}
+		std::cout << "  Lane utilization:       " << (100.0 * utilization) << "%" << std::endl;
+		std::cout << "  Divergent branches:     " << divergences << std::endl;
+	}
+}
+
+//every hart increments a counter in its own page of the shared memory
+static double TimeHarts(const uint32_t hartCount, const uint32_t iterations, std::function<void(SMPSystem&)> run)
+{
+	const uint32_t program[] =
+	{
+		Create_csrrs(Regs::t0, Regs::x0, static_cast<uint32_t>(CSR::mhartid)),
+		Create_addi(Regs::t1, Regs::t0, 1),
+		Create_slli(Regs::t1, Regs::t1, 12),
+		Create_lw(Regs::t2, Regs::t1, 0),
+		Create_addi(Regs::t2, Regs::t2, 1),
+		Create_sw(Regs::t1, Regs::t2, 0),
+		Create_xor(Regs::t3, Regs::t3, Regs::t2),
+		Create_addi(Regs::a2, Regs::a2, static_cast<uint32_t>(-1)),
+		Create_bne(Regs::a2, Regs::x0, static_cast<uint32_t>(-20)),
+		Create_addi(Regs::a0, Regs::x0, 10),
+		Create_ecall()
+	};
+
+	SMPSystem system(hartCount, { 1 << 20, false, false });
+	double bestTime = 1e30;
+	for (uint32_t repeat = 0; repeat < REPEATS; repeat++)
+	{
+		system.Load(program, sizeof(program) / sizeof(uint32_t));
+		for (uint32_t i = 0; i < hartCount; i++)
+		{
+			system.GetHart(i).SetRegister(static_cast<uint32_t>(Regs::a2), iterations);
+		}
+		const auto start = std::chrono::steady_clock::now();
+		run(system);
+		const auto end = std::chrono::steady_clock::now();
+		bestTime = std::min(bestTime, std::chrono::duration<double>(end - start).count());
+	}
+
+	return system.GetInstructionsExecuted() / bestTime / 1e6;
+}
+
+void BenchmarkSMP()
+{
+	const RunLimits limits = { UINT64_MAX, 0.0 };
+	const auto runOnThreads = [&](SMPSystem& system) { system.Run(limits); };
+	const uint32_t coreCount = std::max(1u, std::thread::hardware_concurrency());
+	std::vector<uint32_t> hartCounts;
+	for (uint32_t count = 1; count < coreCount; count *= 2)
+	{
+		hartCounts.push_back(count);
+	}
+	hartCounts.push_back(coreCount);
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << "Host cores: " << coreCount << std::endl;
+	double singleMIPS = 0.0;
+	for (const uint32_t hartCount : hartCounts)
+	{
+		const double mips = TimeHarts(hartCount, 2'000'000, runOnThreads);
+		if (hartCount == 1)
+		{
+			singleMIPS = mips;
+		}
+		std::cout << std::setw(4) << hartCount << " harts: " << std::setw(9) << mips << " MIPS, " <<
+			std::setw(6) << (100.0 * mips / (singleMIPS * hartCount)) << "% of linear scaling" << std::endl;
+	}
+
+	//taking turns on one thread only costs a call per quantum
+	for (const uint64_t quantum : { 10ull, 100ull, 1000ull, 100000ull })
+	{
+		const double mips = TimeHarts(4, 2'000'000, [&](SMPSystem& system) { system.RunRoundRobin(limits, quantum); });
+		std::cout << "4 harts, quantum " << std::setw(6) << quantum << ": " << std::setw(9) << mips << " MIPS on one thread" << std::endl;
+	}
+
+	//many more harts than cores, the same total work as above
+	const uint32_t manyHarts = 64;
+	const uint32_t manyIterations = 8'000'000 / manyHarts;
+	std::cout << std::setw(4) << manyHarts << " harts on their own threads: " << std::setw(9) <<
+		TimeHarts(manyHarts, manyIterations, runOnThreads) << " MIPS" << std::endl;
+	double singleWorkerMIPS = 0.0;
+	for (const uint32_t workerCount : hartCounts)
+	{
+		const double mips = TimeHarts(manyHarts, manyIterations, [&](SMPSystem& system) { system.RunOnWorkers(limits, workerCount); });
+		if (workerCount == 1)
+		{
+			singleWorkerMIPS = mips;
+		}
+		std::cout << std::setw(4) << manyHarts << " harts on " << std::setw(3) << workerCount << " workers: " << std::setw(9) << mips << " MIPS, " <<
+			std::setw(6) << (100.0 * mips / (singleWorkerMIPS * workerCount)) << "% of linear scaling" << std::endl;
+	}
+}
+
+#ifdef _WIN32
+
+void BenchmarkForkServer(const std::string& executable, const std::string& corpus)
+{
+	throw std::runtime_error("The fork server needs fork, which windows doesn't have.");
+}
+
+#else
+
+static const std::string FRESH_RESULT = "fork_benchmark_result";
+
+//what running a program costs without a fork server, a new
+//process doing exec, dynamic linking and static initialization
+static void RunFreshProcess(const std::string& executable, const std::string& program)
+{
+	const pid_t child = fork();
+	if (child < 0)
+	{
+		throw std::runtime_error("Failed to fork");
+	}
+	if (child == 0)
+	{
+		//--run prints the registers and waits for a key press
+		const int null = open("/dev/null", O_RDWR);
+		dup2(null, STDIN_FILENO);
+		dup2(null, STDOUT_FILENO);
+		execl(executable.c_str(), executable.c_str(), "--run", program.c_str(), "-o", FRESH_RESULT.c_str(), static_cast<char*>(nullptr));
+		_exit(127);
+	}
+	int status = 0;
+	waitpid(child, &status, 0);
+	if (!WIFEXITED(status) || WEXITSTATUS(status) != 0)
+	{
+		throw std::runtime_error("Running " + program + " in a new process failed");
+	}
+}
+
+void BenchmarkForkServer(const std::string& executable, const std::string& corpus)
+{
+	const std::vector<std::string> programs = FindBatchPrograms(corpus);
+	if (programs.empty())
+	{
+		throw std::runtime_error("No programs found in " + corpus);
+	}
+	std::string requests;
+	for (const std::string& program : programs)
+	{
+		requests += program + "\n";
+	}
+
+	double freshTime = 1e9;
+	double forkedTime = 1e9;
+	for (uint32_t repeat = 0; repeat < 3; repeat++)
+	{
+		auto start = std::chrono::steady_clock::now();
+		for (const std::string& program : programs)
+		{
+			RunFreshProcess(executable, program);
+		}
+		freshTime = std::min(freshTime, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+
+		std::istringstream requestStream(requests);
+		std::ostringstream responses;
+		start = std::chrono::steady_clock::now();
+		const uint32_t notPassed = ServePrograms(requestStream, responses, { UINT64_MAX, 0.0 }, DEFAULT_KILL_AFTER);
+		forkedTime = std::min(forkedTime, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+		if (notPassed != 0)
+		{
+			throw std::runtime_error(std::to_string(notPassed) + " programs didn't pass in the fork server:\n" + responses.str());
+		}
+	}
+	std::remove((FRESH_RESULT + ".res").c_str());
+
+	std::cout << std::fixed << std::setprecision(1);
+	std::cout << programs.size() << " programs from " << corpus << std::endl;
+	std::cout << "New process per program: " << std::setw(8) << (programs.size() / freshTime) << " programs/s" << std::endl;
+	std::cout << "Forked from a server:    " << std::setw(8) << (programs.size() / forkedTime) << " programs/s, " <<
+		std::setprecision(2) << (freshTime / forkedTime) << "x" << std::endl;
+}
+
+#endif
+
+static const std::string LOAD_BENCHMARK_FILE = "load_benchmark.bin";
+static const uint32_t LOAD_BENCHMARK_WORDS = 4 << 20;
+
+//the loader before program images, reading the file into one
+//buffer and putting the words together into another
+static std::vector<uint32_t> CopyInstructions(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary | std::ios::ate);
+	const uint64_t fileSize = file.tellg();
+	file.seekg(0, file.beg);
+	std::unique_ptr<char[]> content(new char[fileSize]);
+	file.read(content.get(), fileSize);
+
+	std::vector<uint32_t> words;
+	for (uint64_t i = 0; i < fileSize; i += 4)
+	{
+		words.push_back(static_cast<uint32_t>(static_cast<uint8_t>(content[i + 0])) << 0 |
+						static_cast<uint32_t>(static_cast<uint8_t>(content[i + 1])) << 8 |
+						static_cast<uint32_t>(static_cast<uint8_t>(content[i + 2])) << 16 |
+						static_cast<uint32_t>(static_cast<uint8_t>(content[i + 3])) << 24);
+	}
+	return words;
+}
+
+static uint32_t SumWords(const uint32_t* words, const size_t count)
+{
+	uint32_t sum = 0;
+	for (size_t i = 0; i < count; i++)
+	{
+		sum += words[i];
+	}
+	return sum;
+}
+
+//best time of loading the file and then either adding every word,
+//which touches every page of it, or decoding every instruction
+static double TimeLoad(const bool mapped, const bool decode, uint32_t* checksum)
+{
+	double bestTime = 1e9;
+	for (uint32_t repeat = 0; repeat < REPEATS; repeat++)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		std::vector<uint32_t> copied;
+		std::unique_ptr<ProgramImage> image;
+		const uint32_t* words;
+		if (mapped)
+		{
+			image = std::make_unique<ProgramImage>(LOAD_BENCHMARK_FILE);
+			words = image->GetInstructions().data;
+		}
+		else
+		{
+			copied = CopyInstructions(LOAD_BENCHMARK_FILE);
+			words = copied.data();
+		}
+		if (decode)
+		{
+			*checksum += static_cast<uint32_t>(DecodeInstructions(words, LOAD_BENCHMARK_WORDS, 0)->size());
+		}
+		else
+		{
+			*checksum += SumWords(words, LOAD_BENCHMARK_WORDS);
+		}
+		const auto end = std::chrono::steady_clock::now();
+		bestTime = std::min(bestTime, std::chrono::duration<double>(end - start).count());
+	}
+	return bestTime;
+}
+
+//a random mix of the instruction formats, so branches
+//on the format can't be predicted from the order
+static std::vector<uint32_t> CreateLargeProgram()
+{
+	const std::vector<uint32_t> pattern = {
+		Create_addi(Regs::a0, Regs::a0, 1),
+		Create_add(Regs::a1, Regs::a1, Regs::a0),
+		Create_lw(Regs::a2, Regs::sp, 8),
+		Create_sw(Regs::sp, Regs::a2, 12),
+		Create_lui(Regs::a3, 0x12345),
+		Create_beq(Regs::a0, Regs::a1, 16),
+		Create_jal(Regs::ra, 32),
+		Create_srai(Regs::a4, Regs::a1, 3)
+	};
+	FRandom::TCRandom random = FRandom::SeedTCRandom(43, 0);
+	std::vector<uint32_t> words(LOAD_BENCHMARK_WORDS);
+	for (uint32_t i = 0; i < LOAD_BENCHMARK_WORDS; i++)
+	{
+		words[i] = pattern[FRandom::RandomRange(random, 0, static_cast<int32_t>(pattern.size()) - 1)];
+	}
+	return words;
+}
+
+void BenchmarkLoad()
+{
+	{
+		const std::vector<uint32_t> words = CreateLargeProgram();
+		std::ofstream file(LOAD_BENCHMARK_FILE, std::ios::binary);
+		file.write(reinterpret_cast<const char*>(words.data()), words.size() * sizeof(uint32_t));
+		if (!file)
+		{
+			throw std::runtime_error("Failed to create file: " + LOAD_BENCHMARK_FILE);
+		}
+	}
+
+	uint32_t checksum = 0;
+	const double copiedTime = TimeLoad(false, false, &checksum);
+	const double mappedTime = TimeLoad(true, false, &checksum);
+	const double copiedDecodeTime = TimeLoad(false, true, &checksum);
+	const double mappedDecodeTime = TimeLoad(true, true, &checksum);
+	std::remove(LOAD_BENCHMARK_FILE.c_str());
+
+	const double megabytes = LOAD_BENCHMARK_WORDS * sizeof(uint32_t) / 1e6;
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << megabytes << " MB program" << std::endl;
+	std::cout << "Copied:              " << std::setw(8) << (copiedTime * 1e3) << " ms, " << (megabytes / copiedTime) << " MB/s" << std::endl;
+	std::cout << "Mapped:              " << std::setw(8) << (mappedTime * 1e3) << " ms, " << (megabytes / mappedTime) << " MB/s, " <<
+		(copiedTime / mappedTime) << "x" << std::endl;
+	std::cout << "Copied and decoded:  " << std::setw(8) << (copiedDecodeTime * 1e3) << " ms" << std::endl;
+	std::cout << "Mapped and decoded:  " << std::setw(8) << (mappedDecodeTime * 1e3) << " ms, " << (copiedDecodeTime / mappedDecodeTime) << "x" << std::endl;
+	//printed so the compiler can't remove the loads
+	std::cout << "Checksum: " << checksum << std::endl;
+}
+
+//best time of decoding the words one at a time, or with the bulk decoder
+//when decode is null, into an array that is already there so only the
+//decode is timed
+static double TimeDecode(const std::vector<uint32_t>& words, Instruction(*decode)(const uint32_t), const BulkDecodeOptions& options, uint32_t* checksum)
+{
+	std::vector<Instruction> decoded(words.size());
+	double bestTime = 1e9;
+	for (uint32_t repeat = 0; repeat < REPEATS; repeat++)
+	{
+		const auto start = std::chrono::steady_clock::now();
+		if (decode == nullptr)
+		{
+			DecodeBulk(words.data(), words.size(), decoded.data(), options);
+		}
+		else
+		{
+			for (size_t i = 0; i < words.size(); i++)
+			{
+				decoded[i] = decode(words[i]);
+			}
+		}
+		const auto end = std::chrono::steady_clock::now();
+		bestTime = std::min(bestTime, std::chrono::duration<double>(end - start).count());
+		*checksum += static_cast<uint32_t>(decoded.back().immediate);
+	}
+	return bestTime;
+}
+
+void BenchmarkDecode()
+{
+	const std::vector<uint32_t> words = CreateLargeProgram();
+	const uint32_t threadCount = std::max(1u, std::thread::hardware_concurrency());
+
+	uint32_t checksum = 0;
+	const double referenceTime = TimeDecode(words, ReferenceDecodeInstruction, { false, false, 1 }, &checksum);
+	const double scalarTime = TimeDecode(words, DecodeInstruction, { false, false, 1 }, &checksum);
+	const double tablesTime = TimeDecode(words, nullptr, { false, false, 1 }, &checksum);
+	const double avx2Time = TimeDecode(words, nullptr, { false, true, 1 }, &checksum);
+	const double threadsTime = TimeDecode(words, nullptr, { false, true, threadCount }, &checksum);
+
+	const double millions = words.size() / 1e6;
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << millions << " million instructions, AVX2 " << (IsDecodeAVX2Supported() ? "supported" : "not supported") << std::endl;
+	std::cout << "Reference decoder:   " << std::setw(8) << (referenceTime * 1e3) << " ms, " << (millions / referenceTime) << " M/s" << std::endl;
+	std::cout << "One at a time:       " << std::setw(8) << (scalarTime * 1e3) << " ms, " << (millions / scalarTime) << " M/s, " <<
+		(referenceTime / scalarTime) << "x" << std::endl;
+	std::cout << "Bulk:                " << std::setw(8) << (tablesTime * 1e3) << " ms, " << (millions / tablesTime) << " M/s, " <<
+		(referenceTime / tablesTime) << "x" << std::endl;
+	std::cout << "AVX2:                " << std::setw(8) << (avx2Time * 1e3) << " ms, " << (millions / avx2Time) << " M/s, " <<
+		(referenceTime / avx2Time) << "x" << std::endl;
+	std::cout << "AVX2, " << std::setw(3) << threadCount << " threads:   " << std::setw(8) << (threadsTime * 1e3) << " ms, " << (millions / threadsTime) << " M/s, " <<
+		(referenceTime / threadsTime) << "x" << std::endl;
+	//printed so the compiler can't remove the decode
+	std::cout << "Checksum: " << checksum << std::endl;
+}
+
+#ifdef __linux__
+
+//counts level 1 data cache reads and misses of this thread with a
+//perf event, which fails where perf events aren't allowed
+class L1Counters
+{
+private:
+	int accesses = -1;
+	int misses = -1;
+
+	static int Open(const uint64_t result, const int group)
+	{
+		perf_event_attr attributes = {};
+		attributes.type = PERF_TYPE_HW_CACHE;
+		attributes.size = sizeof(attributes);
+		attributes.config = PERF_COUNT_HW_CACHE_L1D | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (result << 16);
+		attributes.disabled = (group == -1) ? 1 : 0;
+		attributes.exclude_kernel = 1;
+		attributes.exclude_hv = 1;
+		return static_cast<int>(syscall(__NR_perf_event_open, &attributes, 0, -1, group, 0));
+	}
+
+public:
+	L1Counters()
+	{
+		accesses = Open(PERF_COUNT_HW_CACHE_RESULT_ACCESS, -1);
+		if (accesses != -1)
+		{
+			misses = Open(PERF_COUNT_HW_CACHE_RESULT_MISS, accesses);
+		}
+	}
+
+	~L1Counters()
+	{
+		if (misses != -1)
+		{
+			close(misses);
+		}
+		if (accesses != -1)
+		{
+			close(accesses);
+		}
+	}
+
+	bool IsAvailable() const
+	{
+		return accesses != -1 && misses != -1;
+	}
+
+	void Start()
+	{
+		ioctl(accesses, PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+		ioctl(accesses, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+	}
+
+	//the fraction of reads that missed since Start
+	double Stop()
+	{
+		ioctl(accesses, PERF_EVENT_IOC_DISABLE, PERF_IOC_FLAG_GROUP);
+		uint64_t accessCount = 0;
+		uint64_t missCount = 0;
+		if (read(accesses, &accessCount, sizeof(accessCount)) != sizeof(accessCount) ||
+			read(misses, &missCount, sizeof(missCount)) != sizeof(missCount) ||
+			accessCount == 0)
+		{
+			return 0;
+		}
+		return static_cast<double>(missCount) / accessCount;
+	}
+};
+
+#endif
+
+static const uint32_t LAYOUT_BODY_SIZE = 1 << 16;
+static const uint32_t LAYOUT_ITERATIONS = 64;
+
+//how a decoded instruction was laid out before the types were packed
+struct PaddedInstruction
+{
+	Instruction instruction;
+	uint32_t padding;
+};
+
+static_assert(sizeof(PaddedInstruction) == 12, "The padded layout has to be the old 12 bytes");
+
+static const Instruction& Unpad(const Instruction& instruction)
+{
+	return instruction;
+}
+
+static const Instruction& Unpad(const PaddedInstruction& instruction)
+{
+	return instruction.instruction;
+}
+
+//runs the layout program with a switch over just the instructions it
+//has, so two layouts only differ in how far apart the instructions are
+template<typename Layout>
+static uint32_t RunLayoutProgram(const std::vector<Layout>& instructions)
+{
+	int32_t x[32] = { 0 };
+	size_t index = 0;
+	while (index < instructions.size())
+	{
+		const Instruction& instruction = Unpad(instructions[index]);
+		switch (instruction.type)
+		{
+			case InstructionType::addi:
+				x[instruction.rd] = x[instruction.rs1] + instruction.immediate;
+				break;
+			case InstructionType::add:
+				x[instruction.rd] = x[instruction.rs1] + x[instruction.rs2];
+				break;
+			case InstructionType::sub:
+				x[instruction.rd] = x[instruction.rs1] - x[instruction.rs2];
+				break;
+			case InstructionType::xor_:
+				x[instruction.rd] = x[instruction.rs1] ^ x[instruction.rs2];
+				break;
+			case InstructionType::or_:
+				x[instruction.rd] = x[instruction.rs1] | x[instruction.rs2];
+				break;
+			case InstructionType::slli:
+				x[instruction.rd] = x[instruction.rs1] << instruction.immediate;
+				break;
+			case InstructionType::srai:
+				x[instruction.rd] = x[instruction.rs1] >> instruction.immediate;
+				break;
+			case InstructionType::lui:
+				x[instruction.rd] = instruction.immediate;
+				break;
+			case InstructionType::beq:
+				if (x[instruction.rs1] == x[instruction.rs2])
+				{
+					index += instruction.immediate / 4;
+					continue;
+				}
+				break;
+			case InstructionType::jal:
+				x[instruction.rd] = static_cast<int32_t>(index * 4 + 4);
+				index += instruction.immediate / 4;
+				x[0] = 0;
+				continue;
+			default:
+				//the ecall at the end
+				return static_cast<uint32_t>(x[static_cast<uint32_t>(Regs::a3)] ^ x[static_cast<uint32_t>(Regs::t3)]);
+		}
+		x[0] = 0;
+		index++;
+	}
+	throw std::runtime_error("The layout program ran past its end.");
+}
+
+//the best time of REPEATS runs and the L1 read miss rate of that run, 0 without perf events
+static double TimeLayout(const std::function<void()>& run, double* missRate)
+{
+	double bestTime = 1e30;
+	*missRate = 0;
+#ifdef __linux__
+	L1Counters counters;
+#endif
+	for (uint32_t repeat = 0; repeat < REPEATS; repeat++)
+	{
+#ifdef __linux__
+		if (counters.IsAvailable())
+		{
+			counters.Start();
+		}
+#endif
+		const auto start = std::chrono::steady_clock::now();
+		run();
+		const auto end = std::chrono::steady_clock::now();
+		const double time = std::chrono::duration<double>(end - start).count();
+#ifdef __linux__
+		const double rate = counters.IsAvailable() ? counters.Stop() : 0;
+		if (time < bestTime)
+		{
+			*missRate = rate;
+		}
+#endif
+		bestTime = std::min(bestTime, time);
+	}
+	return bestTime;
+}
+
+static bool HasL1Counters()
+{
+#ifdef __linux__
+	return L1Counters().IsAvailable();
+#else
+	return false;
+#endif
+}
+
+void BenchmarkLayout()
+{
+	//straight line code that doesn't touch memory, so the instruction
+	//reads are most of what goes through the data cache
+	RISCV_Program program("BenchmarkLayout");
+	const std::vector<uint32_t> body = {
+		Create_addi(Regs::a1, Regs::a1, 1),
+		Create_add(Regs::a2, Regs::a2, Regs::a1),
+		Create_xor(Regs::a3, Regs::a3, Regs::a2),
+		Create_slli(Regs::a4, Regs::a1, 3),
+		Create_sub(Regs::a5, Regs::a4, Regs::a3),
+		Create_lui(Regs::t1, 0x12345),
+		Create_or(Regs::t2, Regs::t1, Regs::a5),
+		Create_srai(Regs::t3, Regs::t2, 2)
+	};
+	program.SetRegister(Regs::t0, LAYOUT_ITERATIONS);
+	for (uint32_t i = 0; i < LAYOUT_BODY_SIZE; i++)
+	{
+		program.AddInstruction(body[i % body.size()]);
+	}
+	program.AddInstruction(Create_addi(Regs::t0, Regs::t0, -1));
+	program.AddInstruction(Create_beq(Regs::t0, Regs::x0, 8));
+	program.AddInstruction(Create_jal(Regs::x0, -static_cast<int32_t>(LAYOUT_BODY_SIZE + 2) * 4));
+	program.EndProgram();
+
+	//the same decoded program in both layouts for the switch
+	const InstructionView code = program.GetInstructions();
+	const std::vector<Instruction> packed = *DecodeInstructions(code.data, code.size);
+	std::vector<PaddedInstruction> padded(packed.size());
+	for (size_t i = 0; i < packed.size(); i++)
+	{
+		padded[i] = { packed[i], 0 };
+	}
+	if (RunLayoutProgram(packed) != RunLayoutProgram(padded))
+	{
+		throw std::runtime_error("The layouts ran the program differently.");
+	}
+
+	const uint64_t executed = static_cast<uint64_t>(LAYOUT_ITERATIONS) * (LAYOUT_BODY_SIZE + 3) + program.GetInstructionCount() - (LAYOUT_BODY_SIZE + 3);
+	uint32_t checksum = 0;
+	double processorMisses;
+	double packedMisses;
+	double paddedMisses;
+	const double processorTime = TimeLayout([&]() { program.Run(); }, &processorMisses);
+	const double packedTime = TimeLayout([&]() { checksum += RunLayoutProgram(packed); }, &packedMisses);
+	const double paddedTime = TimeLayout([&]() { checksum += RunLayoutProgram(padded); }, &paddedMisses);
+
+	const bool hasCounters = HasL1Counters();
+	auto printRow = [&](const std::string& name, const double time, const double missRate)
+	{
+		std::cout << std::left << std::setw(30) << name << std::right << std::setw(8) << (executed / time / 1e6);
+		if (hasCounters)
+		{
+			std::cout << std::setw(12) << (missRate * 100) << " %";
+		}
+		std::cout << std::endl;
+	};
+
+	std::cout << std::fixed << std::setprecision(2);
+	std::cout << program.GetInstructionCount() << " instructions, " <<
+		(packed.size() * sizeof(Instruction) / 1024) << " KiB decoded at " << sizeof(Instruction) << " bytes each, " <<
+		(padded.size() * sizeof(PaddedInstruction) / 1024) << " KiB at " << sizeof(PaddedInstruction) << std::endl;
+	std::cout << std::left << std::setw(30) << "" << std::right << std::setw(8) << "MIPS" <<
+		(hasCounters ? "  L1 data read misses" : "  (L1 data read misses not available)") << std::endl;
+	printRow("Processor", processorTime, processorMisses);
+	printRow("Switch, 8 byte instructions", packedTime, packedMisses);
+	printRow("Switch, 12 byte instructions", paddedTime, paddedMisses);
+	std::cout << "Checksum: " << checksum << std::endl;
+}
+
+static const std::string TRACE_BENCHMARK_FILE = "trace_benchmark";
+static const uint32_t TRACE_ITERATIONS = 200'000;
+
+//how executed instructions were printed before traces, formatted
+//and flushed line by line on the thread running the program
+class LinePrintingSink : public TraceSink
+{
+private:
+	std::ostream& stream;
+
+public:
+	explicit LinePrintingSink(std::ostream& stream) : stream(stream) { }
+
+	void Write(const TraceRecord& record) override
+	{
+		stream << std::to_string(record.pc / 4) << ": " << InstructionAsString(DecodeInstruction(record.rawInstruction)) << std::endl;
+	}
+};
+
+//what is left is the cost of getting the records to the background thread
+class DiscardingSink : public TraceSink
+{
+public:
+	void Write(const TraceRecord&) override { }
+};
+
+//a loop with a load, a store and a branch, so every kind of record is traced
+static std::vector<uint32_t> TraceBenchmarkProgram()
+{
+	RISCV_Program program("BenchmarkTrace");
+	program.SetRegister(Regs::t0, 0x100);
+	program.SetRegister(Regs::t1, TRACE_ITERATIONS);
+	program.AddInstruction(Create_sw(Regs::t0, Regs::t1, 0));
+	program.AddInstruction(Create_lw(Regs::t2, Regs::t0, 0));
+	program.AddInstruction(Create_add(Regs::a1, Regs::a1, Regs::t2));
+	program.AddInstruction(Create_addi(Regs::t1, Regs::t1, static_cast<uint32_t>(-1)));
+	program.AddInstruction(Create_bne(Regs::t1, Regs::x0, static_cast<uint32_t>(-16)));
+	program.EndProgram();
+	const InstructionView code = program.GetInstructions();
+	return std::vector<uint32_t>(code.begin(), code.end());
+}
+
+//from the start of the run until finish has written out the whole trace
+static double TimeTracedRun(const std::vector<uint32_t>& program, std::shared_ptr<TraceSink> sink, std::function<void()> finish, uint64_t* executed)
+{
+	Processor processor;
+	processor.SetUseConsole(false);
+	processor.Load(program.data(), program.size());
+	processor.SetTrace(sink, { program.data(), program.size() });
+	const auto start = std::chrono::steady_clock::now();
+	if (processor.RunFor(UINT64_MAX) != RunStatus::Exited)
+	{
+		throw std::runtime_error("Trace benchmark program didn't exit.");
+	}
+	if (finish)
+	{
+		finish();
+	}
+	const auto end = std::chrono::steady_clock::now();
+	*executed = processor.GetInstructionsExecuted();
+	return std::chrono::duration<double>(end - start).count();
+}
+
+void BenchmarkTrace()
+{
+	const std::vector<uint32_t> program = TraceBenchmarkProgram();
+	uint64_t executed = 0;
+	const auto printMIPS = [&](const std::string& name, const double time)
+	{
+		std::cout << name << std::setw(10) << (executed / time / 1e6) << " MIPS" << std::endl;
+	};
+	std::cout << std::fixed << std::setprecision(2);
+
+	printMIPS("Not traced:                     ", TimeTracedRun(program, nullptr, nullptr, &executed));
+	{
+		auto writer = std::make_shared<AsyncTraceWriter>(std::make_shared<DiscardingSink>());
+		printMIPS("Background thread, no output:   ", TimeTracedRun(program, writer, [&]() { writer->Close(); }, &executed));
+	}
+	{
+		std::ofstream file(TRACE_BENCHMARK_FILE);
+		printMIPS("Printed per line:               ", TimeTracedRun(program, std::make_shared<LinePrintingSink>(file), nullptr, &executed));
+	}
+	{
+		std::ofstream file(TRACE_BENCHMARK_FILE);
+		auto text = std::make_shared<TextTraceWriter>(file);
+		printMIPS("Text, same thread:              ", TimeTracedRun(program, text, [&]() { text->Flush(); }, &executed));
+	}
+	{
+		std::ofstream file(TRACE_BENCHMARK_FILE);
+		auto writer = std::make_shared<AsyncTraceWriter>(std::make_shared<TextTraceWriter>(file));
+		printMIPS("Text, background thread:        ", TimeTracedRun(program, writer, [&]() { writer->Close(); }, &executed));
+	}
+	{
+		std::ofstream file(TRACE_BENCHMARK_FILE);
+		auto writer = std::make_shared<AsyncTraceWriter>(std::make_shared<TextTraceWriter>(file), AsyncTraceWriter::DEFAULT_CAPACITY, TraceFullPolicy::Drop);
+		const double time = TimeTracedRun(program, writer, [&]() { writer->Close(); }, &executed);
+		printMIPS("Text, background thread, drops: ", time);
+		std::cout << "  " << writer->GetDroppedCount() << " of " << executed << " records dropped" << std::endl;
+	}
+	{
+		auto trace = std::make_shared<TraceFileWriter>(TRACE_BENCHMARK_FILE);
+		printMIPS("Binary, same thread:            ", TimeTracedRun(program, trace, [&]() { trace->Close(); }, &executed));
+	}
+	{
+		auto trace = std::make_shared<TraceFileWriter>(TRACE_BENCHMARK_FILE);
+		auto writer = std::make_shared<AsyncTraceWriter>(trace);
+		printMIPS("Binary, background thread:      ", TimeTracedRun(program, writer, [&]() { writer->Close(); trace->Close(); }, &executed));
+	}
+	std::remove(TRACE_BENCHMARK_FILE.c_str());
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+
+//Compares the cost of a ram access through the physical memory
+//map with the flat array the processor used before it
+void BenchmarkMemory();
+
+//Runs the same program for 8 and 16 lanes in the lockstep engine
+//and on that many processors one after the other
+void BenchmarkLockstep();
+
+//Aggregate MIPS of harts sharing memory, each on its own thread,
+//for hart counts up to the number of host cores, of harts taking
+//turns on one thread for a few quanta and of many more harts than
+//cores spread over an increasing number of workers
+void BenchmarkSMP();
+
+//Programs per second for every program in corpus run in a new
+//process of executable and in a child forked by the fork server
+void BenchmarkForkServer(const std::string& executable, const std::string& corpus);
+
+//Load time of a large synthetic program with the loader that copied
+//the file twice and with the mapped program image, with and without
+//decoding the instructions afterwards
+void BenchmarkLoad();
+
+
+//Instructions decoded per second from a large synthetic program by the
+//reference decoder, by the decode tables one at a time and by the bulk
+//decoder with and without AVX2 and with every core
+void BenchmarkDecode();
+
+//MIPS of a program whose decoded instructions are much larger than the
+//level 1 cache, and where perf events are allowed the fraction of level 1
+//data cache reads that miss while it runs
+void BenchmarkLayout();
+
+//MIPS of a loop run without a trace, printing every instruction
+//like before traces, with a text or binary trace written on the
+//same thread and with one written on a background thread, and with
+//records handed to a background thread that throws them away
+void BenchmarkTrace();
@@ -0,0 +1,45 @@
+#include "CLINT.h"
+#include <cstdint>
+#include <atomic>
+#include <mutex>
+
+CLINT::CLINT(const uint32_t hartCount, SoftwareInterruptHandler onSoftwareInterrupt) :
+	hartCount(hartCount),
+	msip(new std::atomic<uint32_t>[hartCount]),
+	onSoftwareInterrupt(onSoftwareInterrupt)
+{
+	Reset();
+}
+
+uint32_t CLINT::Read(const uint32_t offset, const uint32_t size)
+{
+	//only whole msip registers can be accessed, everything else reads 0
+	const uint32_t hartId = offset / 4;
+	if (size != 4 || (offset & 3) != 0 || hartId >= hartCount)
+	{
+		return 0;
+	}
+	return msip[hartId].load();
+}
+
+void CLINT::Write(const uint32_t offset, const uint32_t size, const uint32_t value)
+{
+	const uint32_t hartId = offset / 4;
+	if (size != 4 || (offset & 3) != 0 || hartId >= hartCount)
+	{
+		return;
+	}
+	//the other bits of msip are hardwired to 0
+	std::lock_guard<std::mutex> guard(writeLock);
+	msip[hartId].store(value & 1);
+	onSoftwareInterrupt(hartId, (value & 1) != 0);
+}
+
+void CLINT::Reset()
+{
+	std::lock_guard<std::mutex> guard(writeLock);
+	for (uint32_t i = 0; i < hartCount; i++)
+	{
+		msip[i].store(0);
+	}
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include "Device.h"
+
+//The software interrupt part of a core local interruptor. The word
+//at 4 * n is the msip register of hart n, writing 1 to it raises a
+//machine software interrupt in that hart and writing 0 clears it.
+//Harts use it to wake each other up from wfi.
+class CLINT : public Device
+{
+public:
+	//called with the hart and whether its interrupt is now pending
+	typedef std::function<void(const uint32_t hartId, const bool pending)> SoftwareInterruptHandler;
+
+private:
+	uint32_t hartCount;
+	std::unique_ptr<std::atomic<uint32_t>[]> msip;
+	//keeps msip and what the handler was last told the same
+	//when two harts write the same register at once
+	std::mutex writeLock;
+	SoftwareInterruptHandler onSoftwareInterrupt;
+
+public:
+	const static uint32_t DEFAULT_BASE = 0x02'00'00'00;
+	const static uint32_t SIZE = 0x1'00'00;
+
+	CLINT(const uint32_t hartCount, SoftwareInterruptHandler onSoftwareInterrupt);
+
+	uint32_t Read(const uint32_t offset, const uint32_t size) override;
+	void Write(const uint32_t offset, const uint32_t size, const uint32_t value) override;
+	//clears every msip without calling the handler
+	void Reset();
+};
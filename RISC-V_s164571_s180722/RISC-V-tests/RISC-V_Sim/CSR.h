@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+
+enum class CSR : uint32_t
+{
+	sstatus  = 0x100,
+	sie		 = 0x104,
+	stvec	 = 0x105,
+	sscratch = 0x140,
+	sepc	 = 0x141,
+	scause	 = 0x142,
+	stval	 = 0x143,
+	sip		 = 0x144,
+	satp	 = 0x180,
+
+	mstatus	 = 0x300,
+	misa	 = 0x301,
+	medeleg	 = 0x302,
+	mideleg	 = 0x303,
+	mie		 = 0x304,
+	mtvec	 = 0x305,
+	mscratch = 0x340,
+	mepc	 = 0x341,
+	mcause	 = 0x342,
+	mtval	 = 0x343,
+	mip		 = 0x344,
+	mhartid	 = 0xF14
+};
+
+namespace MStatus
+{
+	const uint32_t SIE  = 1 <<  1;
+	const uint32_t MIE  = 1 <<  3;
+	const uint32_t SPIE = 1 <<  5;
+	const uint32_t MPIE = 1 <<  7;
+	const uint32_t SPP  = 1 <<  8;
+	const uint32_t MPP  = 3 << 11;
+	const uint32_t SUM  = 1 << 18;
+	const uint32_t MXR  = 1 << 19;
+
+	//the bits of mstatus that are visible through sstatus
+	const uint32_t SSTATUS_MASK = SIE | SPIE | SPP | SUM | MXR;
+	const uint32_t MPP_SHIFT = 11;
+}
+
+//bits of mip and mie
+namespace Interrupt
+{
+	const uint32_t SSIP = 1 << 1;
+	const uint32_t MSIP = 1 << 3;
+	const uint32_t STIP = 1 << 5;
+	const uint32_t MTIP = 1 << 7;
+	const uint32_t SEIP = 1 << 9;
+	const uint32_t MEIP = 1 << 11;
+}
@@ -0,0 +1,166 @@
+#include "DecodeSweep.h"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <mutex>
+#include <algorithm>
+#include "Instruction.h"
+#include "InstructionDecode.h"
+#include "ReferenceDecode.h"
+
+static const uint64_t SWEEP_BLOCK_SIZE = 1 << 16;
+static const size_t MAX_EXAMPLES = 16;
+
+static bool IsSameInstruction(const Instruction& a, const Instruction& b)
+{
+	return a.immediate == b.immediate && a.type == b.type && a.rd == b.rd && a.rs1 == b.rs1 && a.rs2 == b.rs2;
+}
+
+static std::string DescribeMismatch(const std::string& decoder, const uint32_t word, const Instruction& expected, const Instruction& actual)
+{
+	const auto describe = [](const Instruction& instruction)
+	{
+		return "type " + std::to_string(static_cast<uint32_t>(instruction.type)) +
+			" rd " + std::to_string(instruction.rd) +
+			" rs1 " + std::to_string(instruction.rs1) +
+			" rs2 " + std::to_string(instruction.rs2) +
+			" immediate " + std::to_string(instruction.immediate);
+	};
+	return decoder + " word " + InstructionToBits(word) + "\n  expected " + describe(expected) + "\n  actual   " + describe(actual);
+}
+
+//the part of the sweep every thread adds to the result
+struct SweepCounts
+{
+	uint64_t valid = 0;
+	uint64_t illegal = 0;
+	uint64_t mismatches = 0;
+};
+
+DecodeSweepResult SweepDecoders(const uint64_t first, const uint64_t count, const uint32_t threadCount)
+{
+	if (first + count > ALL_WORDS)
+	{
+		throw std::runtime_error("Decode sweep goes past the last word.\nFirst: " + std::to_string(first) + "\nCount: " + std::to_string(count));
+	}
+
+	DecodeSweepResult result = { count, 0, 0, 0, {} };
+	std::mutex examplesLock;
+	const auto addMismatch = [&](const std::string& decoder, const uint32_t word, const Instruction& expected, const Instruction& actual)
+	{
+		std::lock_guard<std::mutex> lock(examplesLock);
+		if (result.examples.size() < MAX_EXAMPLES)
+		{
+			result.examples.push_back(DescribeMismatch(decoder, word, expected, actual));
+		}
+	};
+
+	//whether a word is illegal only depends on its opcode
+	for (uint32_t opcode = 0; opcode < 128; opcode++)
+	{
+		Instruction expected;
+		if (ReferenceTryDecodeInstruction(opcode, expected))
+		{
+			continue;
+		}
+		try
+		{
+			const Instruction actual = DecodeInstruction(opcode);
+			result.mismatches++;
+			addMismatch("DecodeInstruction didn't reject", opcode, Instruction{ 0 }, actual);
+		}
+		catch (const std::runtime_error&)
+		{
+		}
+	}
+
+	const uint64_t blockCount = (count + SWEEP_BLOCK_SIZE - 1) / SWEEP_BLOCK_SIZE;
+	std::atomic<uint64_t> nextBlock(0);
+	const uint32_t workerCount = static_cast<uint32_t>(std::min<uint64_t>(blockCount,
+		(threadCount == 0) ? std::max(1u, std::thread::hardware_concurrency()) : threadCount));
+	std::vector<SweepCounts> counts(workerCount);
+
+	const auto sweep = [&](const uint32_t worker)
+	{
+		SweepCounts& own = counts[worker];
+		std::vector<uint32_t> words(SWEEP_BLOCK_SIZE);
+		std::vector<Instruction> avx2(SWEEP_BLOCK_SIZE);
+		std::vector<Instruction> scalar(SWEEP_BLOCK_SIZE);
+		for (uint64_t block = nextBlock++; block < blockCount; block = nextBlock++)
+		{
+			const uint64_t begin = first + block * SWEEP_BLOCK_SIZE;
+			const size_t size = static_cast<size_t>(std::min(SWEEP_BLOCK_SIZE, first + count - begin));
+			for (size_t i = 0; i < size; i++)
+			{
+				words[i] = static_cast<uint32_t>(begin + i);
+			}
+			DecodeBulk(words.data(), size, avx2.data(), { true, true, 1 });
+			DecodeBulk(words.data(), size, scalar.data(), { true, false, 1 });
+
+			for (size_t i = 0; i < size; i++)
+			{
+				Instruction expected = { 0 };
+				const bool hasValidOpcode = ReferenceTryDecodeInstruction(words[i], expected);
+				//a known opcode with funct fields no instruction has decodes to 0 too
+				const bool isValid = hasValidOpcode && expected.type != InstructionType(0);
+				bool matches = IsSameInstruction(expected, scalar[i]);
+				if (!matches)
+				{
+					addMismatch("bulk", words[i], expected, scalar[i]);
+				}
+				if (!IsSameInstruction(expected, avx2[i]))
+				{
+					matches = false;
+					addMismatch("bulk AVX2", words[i], expected, avx2[i]);
+				}
+				if (isValid)
+				{
+					own.valid++;
+					const Instruction single = DecodeInstruction(words[i]);
+					if (!IsSameInstruction(expected, single))
+					{
+						matches = false;
+						addMismatch("DecodeInstruction", words[i], expected, single);
+					}
+				}
+				else
+				{
+					own.illegal++;
+					//DecodeInstruction only throws for an illegal opcode, checked above
+					const Instruction single = hasValidOpcode ? DecodeInstruction(words[i]) : Instruction{ 0 };
+					if (single.type != InstructionType(0))
+					{
+						matches = false;
+						addMismatch("DecodeInstruction of an illegal word", words[i], expected, single);
+					}
+				}
+				own.mismatches += matches ? 0 : 1;
+			}
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (uint32_t worker = 1; worker < workerCount; worker++)
+	{
+		threads.emplace_back(sweep, worker);
+	}
+	if (workerCount > 0)
+	{
+		sweep(0);
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (const SweepCounts& own : counts)
+	{
+		result.valid += own.valid;
+		result.illegal += own.illegal;
+		result.mismatches += own.mismatches;
+	}
+	return result;
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct DecodeSweepResult
+{
+	uint64_t words;
+	uint64_t valid;
+	uint64_t illegal;
+	uint64_t mismatches;
+	//a description of the first few words a decoder got wrong
+	std::vector<std::string> examples;
+};
+
+//every 32 bit word
+const uint64_t ALL_WORDS = 1ull << 32;
+
+//Decodes count words starting at first with every decoder and compares
+//them with the reference decoder. A word is illegal when the reference
+//rejects its opcode or decodes it to type 0 because no instruction has
+//its funct fields. Every word has to give the same instruction as the
+//reference in the bulk decoder with and without AVX2, so illegal words
+//are type 0 there, and in DecodeInstruction. DecodeInstruction throws for
+//an illegal opcode, which is checked once per opcode instead of for
+//every word with it.
+//The words are handed out to the threads in blocks, which the bulk decoders
+//decode in one go. 0 threads uses one per host core.
+DecodeSweepResult SweepDecoders(const uint64_t first, const uint64_t count, const uint32_t threadCount);
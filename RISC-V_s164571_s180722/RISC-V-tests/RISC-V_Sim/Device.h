@@ -0,0 +1,14 @@
+#pragma once
+
+#include <cstdint>
+
+//A memory mapped device. Offsets are relative to the address
+//the device was mapped at and size is 1, 2 or 4 bytes.
+class Device
+{
+public:
+	virtual uint32_t Read(const uint32_t offset, const uint32_t size) = 0;
+	virtual void Write(const uint32_t offset, const uint32_t size, const uint32_t value) = 0;
+
+	virtual ~Device() { }
+};
@@ -0,0 +1,410 @@
+#include "ElfImage.h"
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "InstructionDecode.h"
+#include "PhysicalMemory.h"
+
+static const uint32_t PAGE_SIZE = 4096;
+static const uint64_t HEADER_SIZE = 52;
+static const uint8_t CLASS_32 = 1;
+static const uint8_t LITTLE_ENDIAN_DATA = 1;
+static const uint16_t TYPE_EXECUTABLE = 2;
+static const uint16_t MACHINE_RISCV = 243;
+static const uint32_t SEGMENT_LOAD = 1;
+static const uint32_t FLAG_EXECUTE = 1;
+static const uint32_t FLAG_WRITE = 2;
+static const uint32_t SECTION_SYMBOL_TABLE = 2;
+static const uint8_t SYMBOL_FUNCTION = 2;
+static const uint8_t SYMBOL_SECTION = 3;
+static const uint8_t SYMBOL_FILE = 4;
+static const uint16_t UNDEFINED_SECTION = 0;
+
+//symbols the usual linker scripts put at the top of the stack and at gp
+static const char* const STACK_SYMBOLS[] = { "__stack_top", "_stack_top" };
+static const char* const GLOBAL_POINTER_SYMBOL = "__global_pointer$";
+
+//the file is little endian whatever the host is
+static uint16_t Read16(const uint8_t* bytes)
+{
+	return static_cast<uint16_t>(bytes[0] | (bytes[1] << 8));
+}
+
+static uint32_t Read32(const uint8_t* bytes)
+{
+	return (static_cast<uint32_t>(bytes[0]) <<  0) |
+		   (static_cast<uint32_t>(bytes[1]) <<  8) |
+		   (static_cast<uint32_t>(bytes[2]) << 16) |
+		   (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+static uint64_t RoundUpToPage(const uint64_t value)
+{
+	return (value + PAGE_SIZE - 1) & ~static_cast<uint64_t>(PAGE_SIZE - 1);
+}
+
+ElfImage::ElfImage(const std::string& path, const uint32_t decodeThreadCount)
+{
+	struct stat fileInfo;
+	if (stat(path.c_str(), &fileInfo) != 0)
+	{
+		throw std::runtime_error("Failed to open file: " + path);
+	}
+	size = static_cast<uint64_t>(fileInfo.st_size);
+	if (size < HEADER_SIZE)
+	{
+		throw std::runtime_error("Not an ELF file: " + path);
+	}
+
+#ifdef _WIN32
+	std::ifstream file(path, std::ios::binary);
+	content.resize(static_cast<size_t>(size));
+	file.read(reinterpret_cast<char*>(content.data()), static_cast<std::streamsize>(size));
+	if (!file)
+	{
+		throw std::runtime_error("Failed to read file: " + path);
+	}
+	data = content.data();
+#else
+	mapping = std::make_unique<MappedFile>(path, FileMapping::ReadOnly, 0);
+	data = mapping->GetData();
+#endif
+
+	if (std::memcmp(data, "\x7f" "ELF", 4) != 0)
+	{
+		throw std::runtime_error("Not an ELF file: " + path);
+	}
+	if (data[4] != CLASS_32 || data[5] != LITTLE_ENDIAN_DATA || Read16(data + 18) != MACHINE_RISCV)
+	{
+		throw std::runtime_error("Not a 32 bit little endian RISC-V ELF file: " + path);
+	}
+	if (Read16(data + 16) != TYPE_EXECUTABLE)
+	{
+		throw std::runtime_error("Only executable ELF files can be run: " + path);
+	}
+	entry = Read32(data + 24);
+
+	ReadSegments();
+	ReadSymbols();
+	ReadCode(decodeThreadCount);
+}
+
+void ElfImage::ReadSegments()
+{
+	const uint64_t headerOffset = Read32(data + 28);
+	const uint64_t headerSize = Read16(data + 42);
+	const uint64_t headerCount = Read16(data + 44);
+	if (headerSize < 32 || headerOffset + headerSize * headerCount > size)
+	{
+		throw std::runtime_error("The program headers of the ELF file are outside the file.");
+	}
+
+	for (uint64_t i = 0; i < headerCount; i++)
+	{
+		const uint8_t* header = data + headerOffset + i * headerSize;
+		if (Read32(header) != SEGMENT_LOAD)
+		{
+			continue;
+		}
+		const uint32_t flags = Read32(header + 24);
+		const ElfSegment segment = { Read32(header + 8), Read32(header + 4), Read32(header + 16), Read32(header + 20),
+			(flags & FLAG_WRITE) != 0, (flags & FLAG_EXECUTE) != 0 };
+		if (static_cast<uint64_t>(segment.offset) + segment.fileSize > size || segment.fileSize > segment.memorySize ||
+			static_cast<uint64_t>(segment.address) + segment.memorySize > 0x1'00'00'00'00)
+		{
+			throw std::runtime_error("ELF segment at address " + std::to_string(segment.address) + " is outside the file or memory.");
+		}
+		if (segment.memorySize != 0)
+		{
+			segments.push_back(segment);
+		}
+	}
+	if (segments.empty())
+	{
+		throw std::runtime_error("The ELF file has no segments to load.");
+	}
+}
+
+void ElfImage::ReadSymbols()
+{
+	const uint64_t sectionOffset = Read32(data + 32);
+	const uint64_t sectionSize = Read16(data + 46);
+	const uint64_t sectionCount = Read16(data + 48);
+	//the symbols are only nice to have, so a file without
+	//sections or with broken ones still runs
+	if (sectionOffset == 0 || sectionSize < 40 || sectionOffset + sectionSize * sectionCount > size)
+	{
+		return;
+	}
+
+	for (uint64_t i = 0; i < sectionCount; i++)
+	{
+		const uint8_t* section = data + sectionOffset + i * sectionSize;
+		const uint64_t link = Read32(section + 24);
+		if (Read32(section + 4) != SECTION_SYMBOL_TABLE || link >= sectionCount)
+		{
+			continue;
+		}
+		const uint64_t tableOffset = Read32(section + 16);
+		const uint64_t tableSize = Read32(section + 20);
+		const uint8_t* names = data + sectionOffset + link * sectionSize;
+		const uint64_t namesOffset = Read32(names + 16);
+		const uint64_t namesSize = Read32(names + 20);
+		if (tableOffset + tableSize > size || namesOffset + namesSize > size)
+		{
+			continue;
+		}
+
+		for (uint64_t offset = 0; offset + 16 <= tableSize; offset += 16)
+		{
+			const uint8_t* symbol = data + tableOffset + offset;
+			const uint32_t name = Read32(symbol);
+			const uint8_t type = symbol[12] & 0xf;
+			if (name == 0 || name >= namesSize || type == SYMBOL_SECTION || type == SYMBOL_FILE ||
+				Read16(symbol + 14) == UNDEFINED_SECTION)
+			{
+				continue;
+			}
+			const char* nameStart = reinterpret_cast<const char*>(data + namesOffset + name);
+			const size_t nameLength = strnlen(nameStart, static_cast<size_t>(namesSize - name));
+			symbols.push_back({ std::string(nameStart, nameLength), Read32(symbol + 4), Read32(symbol + 8), type == SYMBOL_FUNCTION });
+		}
+	}
+
+	std::stable_sort(symbols.begin(), symbols.end(), [](const ElfSymbol& a, const ElfSymbol& b)
+	{
+		return a.address < b.address;
+	});
+}
+
+void ElfImage::ReadCode(const uint32_t decodeThreadCount)
+{
+	uint64_t low = UINT64_MAX;
+	uint64_t high = 0;
+	std::vector<const ElfSegment*> executable;
+	for (const ElfSegment& segment : segments)
+	{
+		if (segment.executable)
+		{
+			executable.push_back(&segment);
+			low = std::min<uint64_t>(low, segment.address);
+			high = std::max<uint64_t>(high, static_cast<uint64_t>(segment.address) + segment.memorySize);
+		}
+	}
+	if (executable.empty())
+	{
+		throw std::runtime_error("The ELF file has no executable segment.");
+	}
+	if (low % 4 != 0)
+	{
+		throw std::runtime_error("The code of the ELF file isn't word aligned.");
+	}
+	if (entry < low || entry >= high || entry % 4 != 0)
+	{
+		throw std::runtime_error("The entry point " + std::to_string(entry) + " isn't an instruction in an executable segment.");
+	}
+	instructionBase = static_cast<uint32_t>(low);
+	const size_t wordCount = static_cast<size_t>((high - low + 3) / 4);
+
+	const ElfSegment& first = *executable.front();
+	if (executable.size() == 1 && !HOST_IS_BIG_ENDIAN && first.offset % 4 == 0 && first.fileSize == first.memorySize && first.fileSize % 4 == 0)
+	{
+		//the common case of one code segment is decoded right from the file
+		code = { reinterpret_cast<const uint32_t*>(data + first.offset), wordCount };
+	}
+	else
+	{
+		//the gaps between segments and the end of segments
+		//past their file size are zeros, which aren't instructions
+		words.assign(wordCount, 0);
+		for (const ElfSegment* segment : executable)
+		{
+			const uint8_t* bytes = data + segment->offset;
+			for (uint32_t i = 0; i < segment->fileSize; i++)
+			{
+				const uint64_t byteAddress = segment->address - low + i;
+				words[static_cast<size_t>(byteAddress / 4)] |= static_cast<uint32_t>(bytes[i]) << (8 * (byteAddress % 4));
+			}
+		}
+		code = { words.data(), words.size() };
+	}
+
+	decoded = DecodeCodeSegment(code.data, code.size, decodeThreadCount);
+}
+
+uint32_t ElfImage::GetEntry() const
+{
+	return entry;
+}
+
+uint32_t ElfImage::GetInstructionBase() const
+{
+	return instructionBase;
+}
+
+InstructionView ElfImage::GetInstructions() const
+{
+	return code;
+}
+
+std::shared_ptr<const std::vector<Instruction>> ElfImage::GetDecodedInstructions() const
+{
+	return decoded;
+}
+
+const std::vector<ElfSegment>& ElfImage::GetSegments() const
+{
+	return segments;
+}
+
+const std::vector<ElfSymbol>& ElfImage::GetSymbols() const
+{
+	return symbols;
+}
+
+const ElfSymbol* ElfImage::FindSymbol(const std::string& name) const
+{
+	for (const ElfSymbol& symbol : symbols)
+	{
+		if (symbol.name == name)
+		{
+			return &symbol;
+		}
+	}
+	return nullptr;
+}
+
+const ElfSymbol* ElfImage::FindFunction(const uint32_t address) const
+{
+	//the last function starting at or before the address,
+	//a function without a size reaches to the next symbol
+	auto after = std::upper_bound(symbols.begin(), symbols.end(), address, [](const uint32_t value, const ElfSymbol& symbol)
+	{
+		return value < symbol.address;
+	});
+	while (after != symbols.begin())
+	{
+		--after;
+		if (after->isFunction)
+		{
+			const bool inside = after->size == 0 || address - after->address < after->size;
+			return inside ? &*after : nullptr;
+		}
+	}
+	return nullptr;
+}
+
+bool ElfImage::CanMap(const ElfSegment& segment) const
+{
+	if (!mapping || segment.writable || segment.address % PAGE_SIZE != 0 || segment.offset % PAGE_SIZE != 0 ||
+		segment.fileSize != segment.memorySize)
+	{
+		return false;
+	}
+	//the whole pages of the mapping can't hold any other segment
+	const uint64_t end = RoundUpToPage(static_cast<uint64_t>(segment.address) + segment.memorySize);
+	for (const ElfSegment& other : segments)
+	{
+		if (&other != &segment && other.address < end && static_cast<uint64_t>(other.address) + other.memorySize > segment.address)
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+bool ElfImage::IsMapped(const ElfSegment& segment, const uint64_t ramSize) const
+{
+	return CanMap(segment) && segment.address >= RoundUpToPage(ramSize);
+}
+
+uint32_t ElfImage::GetRAMSize(const uint32_t minimumSize) const
+{
+	//putting a segment in ram can make ram reach
+	//another one, so go on until none is added
+	uint64_t ramSize = minimumSize;
+	uint64_t highestEnd = 0;
+	std::vector<bool> inRAM(segments.size(), false);
+	bool added = true;
+	while (added)
+	{
+		added = false;
+		for (size_t i = 0; i < segments.size(); i++)
+		{
+			const ElfSegment& segment = segments[i];
+			if (!inRAM[i] && !IsMapped(segment, ramSize))
+			{
+				inRAM[i] = true;
+				added = true;
+				highestEnd = std::max(highestEnd, static_cast<uint64_t>(segment.address) + segment.memorySize);
+				ramSize = std::max(ramSize, RoundUpToPage(highestEnd) + DEFAULT_STACK_SIZE);
+			}
+		}
+	}
+	if (ramSize > 0xff'ff'f0'00)
+	{
+		throw std::runtime_error("The segments and stack of the ELF file don't fit in memory.");
+	}
+	return static_cast<uint32_t>(ramSize);
+}
+
+void ElfImage::MapSegments(Processor& processor, const uint32_t ramSize) const
+{
+	for (const ElfSegment& segment : segments)
+	{
+		if (IsMapped(segment, ramSize))
+		{
+			//read only, so the file is never written
+			processor.MapHostMemory(segment.address, static_cast<uint32_t>(RoundUpToPage(segment.memorySize)),
+				const_cast<uint8_t*>(data + segment.offset), false);
+		}
+	}
+}
+
+void ElfImage::CopySegments(Processor& processor, const uint32_t ramSize) const
+{
+	for (const ElfSegment& segment : segments)
+	{
+		if (!IsMapped(segment, ramSize))
+		{
+			processor.WritePhysicalMemory(segment.address, data + segment.offset, segment.fileSize);
+		}
+	}
+}
+
+uint32_t ElfImage::GetStackPointer(const uint32_t ramSize, const ElfDefaults& defaults) const
+{
+	for (const char* name : STACK_SYMBOLS)
+	{
+		if (const ElfSymbol* symbol = FindSymbol(name))
+		{
+			return symbol->address;
+		}
+	}
+	if (defaults.stackPointer != 0)
+	{
+		return defaults.stackPointer;
+	}
+	//the calling convention keeps sp 16 byte aligned
+	return ramSize & ~static_cast<uint32_t>(15);
+}
+
+uint32_t ElfImage::GetGlobalPointer(const ElfDefaults& defaults) const
+{
+	const ElfSymbol* symbol = FindSymbol(GLOBAL_POINTER_SYMBOL);
+	return (symbol != nullptr) ? symbol->address : defaults.globalPointer;
+}
+
+bool IsElfFile(const std::string& path)
+{
+	std::ifstream file(path, std::ios::binary);
+	char magic[4] = { };
+	file.read(magic, sizeof(magic));
+	return file && std::memcmp(magic, "\x7f" "ELF", 4) == 0;
+}
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Instruction.h"
+#include "MappedFile.h"
+#include "ProgramImage.h"
+#include "Processor.h"
+
+//a PT_LOAD program header
+struct ElfSegment
+{
+	uint32_t address;
+	uint32_t offset;
+	uint32_t fileSize;
+	//the bytes past fileSize are zeros, which is where .bss is
+	uint32_t memorySize;
+	bool writable;
+	bool executable;
+};
+
+struct ElfSymbol
+{
+	std::string name;
+	uint32_t address;
+	uint32_t size;
+	bool isFunction;
+};
+
+//used when the elf file has no symbol for sp or gp,
+//0 leaves sp at the end of ram and gp at 0
+struct ElfDefaults
+{
+	uint32_t stackPointer;
+	uint32_t globalPointer;
+};
+
+//A 32 bit little endian RISC-V executable. The file is mapped where mmap
+//is available and read into one buffer anywhere else. The executable
+//segments are decoded once, from the lowest to the highest of them, and
+//every segment is placed in guest memory when a processor loads the
+//program. Ram always starts at address 0, so it grows to hold every
+//segment that is writable or can't be mapped, with a stack above the
+//highest one. A read only segment that is page aligned in both the file
+//and memory and lies above ram is mapped straight from the file instead.
+//The bytes between the file size and the memory size of a segment are
+//never written, as ram is cleared by handing it back to the os, so .bss
+//only costs the pages the program touches.
+//The symbol table is kept so addresses can be named, for example by a
+//profiler.
+class ElfImage
+{
+public:
+	//bytes of ram above the highest segment placed in ram
+	const static uint32_t DEFAULT_STACK_SIZE = 0x1'00'00;
+
+private:
+	std::unique_ptr<MappedFile> mapping;
+	std::vector<uint8_t> content;
+	const uint8_t* data;
+	uint64_t size;
+	uint32_t entry;
+	std::vector<ElfSegment> segments;
+	//sorted by address
+	std::vector<ElfSymbol> symbols;
+	uint32_t instructionBase;
+	//only used when the code can't be used straight from the file
+	std::vector<uint32_t> words;
+	InstructionView code;
+	std::shared_ptr<const std::vector<Instruction>> decoded;
+
+	void ReadSegments();
+	void ReadSymbols();
+	void ReadCode(const uint32_t decodeThreadCount);
+	bool CanMap(const ElfSegment& segment) const;
+	bool IsMapped(const ElfSegment& segment, const uint64_t ramSize) const;
+
+public:
+	//the code is decoded on decodeThreadCount threads, 0 for one per core
+	explicit ElfImage(const std::string& path, const uint32_t decodeThreadCount = 1);
+	ElfImage(const ElfImage&) = delete;
+	ElfImage& operator=(const ElfImage&) = delete;
+
+	uint32_t GetEntry() const;
+	uint32_t GetInstructionBase() const;
+	//the words of the executable segments, valid for as long as the image is
+	InstructionView GetInstructions() const;
+	std::shared_ptr<const std::vector<Instruction>> GetDecodedInstructions() const;
+	const std::vector<ElfSegment>& GetSegments() const;
+	const std::vector<ElfSymbol>& GetSymbols() const;
+	//null when there is no such symbol
+	const ElfSymbol* FindSymbol(const std::string& name) const;
+	//the function containing address, null when it isn't in one
+	const ElfSymbol* FindFunction(const uint32_t address) const;
+
+	//ram needed to hold the program, at least minimumSize
+	uint32_t GetRAMSize(const uint32_t minimumSize) const;
+	//maps the segments that can be mapped, done once per memory
+	void MapSegments(Processor& processor, const uint32_t ramSize) const;
+	//copies the other segments into ram, done after every load
+	//as loading a program clears ram
+	void CopySegments(Processor& processor, const uint32_t ramSize) const;
+	uint32_t GetStackPointer(const uint32_t ramSize, const ElfDefaults& defaults) const;
+	uint32_t GetGlobalPointer(const ElfDefaults& defaults) const;
+};
+
+//whether the file starts with the elf magic number
+bool IsElfFile(const std::string& path);
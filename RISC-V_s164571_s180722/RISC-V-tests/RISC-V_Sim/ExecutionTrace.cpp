@@ -0,0 +1,622 @@
+#include "ExecutionTrace.h"
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include "Instruction.h"
+#include "InstructionDecode.h"
+#include "Register.h"
+
+static const char TRACE_MAGIC[8] = { 'R', 'V', 'T', 'R', 'A', 'C', 'E', '1' };
+static const char INDEX_MAGIC[8] = { 'R', 'V', 'T', 'R', 'I', 'D', 'X', '1' };
+static const uint32_t TRACE_VERSION = 1;
+static const uint64_t HEADER_SIZE = 16;
+static const uint64_t BLOCK_HEADER_SIZE = 8;
+static const uint64_t INDEX_ENTRY_SIZE = 20;
+static const uint64_t TRAILER_SIZE = 32;
+
+//set in the stored flags when pc is right after the last pc,
+//which the flags of a TraceRecord never use
+static const uint8_t SEQUENTIAL_PC = 0x80;
+
+//LZ77 in the format of an LZ4 block: a sequence is a token with the
+//number of literals in the high nibble and the match length - 4 in the
+//low one, where 15 means more follows in bytes of up to 255, then the
+//literals, a 16 bit offset back to the match and the rest of its length.
+//The last sequence only has literals.
+static const uint32_t MIN_MATCH = 4;
+static const uint32_t MAX_OFFSET = 0xffff;
+static const uint32_t HASH_BITS = 12;
+static const uint32_t NO_POSITION = UINT32_MAX;
+
+static void Put32(std::vector<uint8_t>& bytes, const uint32_t value)
+{
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		bytes.push_back(static_cast<uint8_t>(value >> (8 * i)));
+	}
+}
+
+static void Put64(std::vector<uint8_t>& bytes, const uint64_t value)
+{
+	Put32(bytes, static_cast<uint32_t>(value));
+	Put32(bytes, static_cast<uint32_t>(value >> 32));
+}
+
+static uint32_t Get32(const uint8_t* bytes)
+{
+	return static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+		(static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+static uint64_t Get64(const uint8_t* bytes)
+{
+	return static_cast<uint64_t>(Get32(bytes)) | (static_cast<uint64_t>(Get32(bytes + 4)) << 32);
+}
+
+//small differences in either direction become small numbers
+static void PutDelta(std::vector<uint8_t>& bytes, const uint32_t value, const uint32_t last)
+{
+	const int32_t delta = static_cast<int32_t>(value - last);
+	uint32_t zigzag = (static_cast<uint32_t>(delta) << 1) ^ static_cast<uint32_t>(delta >> 31);
+	while (zigzag >= 0x80)
+	{
+		bytes.push_back(static_cast<uint8_t>(zigzag | 0x80));
+		zigzag >>= 7;
+	}
+	bytes.push_back(static_cast<uint8_t>(zigzag));
+}
+
+static std::runtime_error CorruptBlock()
+{
+	return std::runtime_error("The trace file has a corrupt block.");
+}
+
+static uint32_t GetDelta(const uint8_t*& bytes, const uint8_t* end, const uint32_t last)
+{
+	uint32_t zigzag = 0;
+	for (uint32_t shift = 0; shift < 35; shift += 7)
+	{
+		if (bytes == end)
+		{
+			throw CorruptBlock();
+		}
+		const uint8_t byte = *bytes++;
+		zigzag |= static_cast<uint32_t>(byte & 0x7f) << shift;
+		if ((byte & 0x80) == 0)
+		{
+			const uint32_t delta = (zigzag >> 1) ^ (0u - (zigzag & 1));
+			return last + delta;
+		}
+	}
+	throw CorruptBlock();
+}
+
+static void PutLength(std::vector<uint8_t>& bytes, uint32_t length)
+{
+	while (length >= 255)
+	{
+		bytes.push_back(255);
+		length -= 255;
+	}
+	bytes.push_back(static_cast<uint8_t>(length));
+}
+
+//a match length of 0 is the last sequence
+static void PutSequence(std::vector<uint8_t>& output, const uint8_t* literals, const uint32_t literalCount, const uint32_t offset, const uint32_t matchLength)
+{
+	const uint32_t extraLength = (matchLength == 0) ? 0 : matchLength - MIN_MATCH;
+	output.push_back(static_cast<uint8_t>((std::min(literalCount, 15u) << 4) | std::min(extraLength, 15u)));
+	if (literalCount >= 15)
+	{
+		PutLength(output, literalCount - 15);
+	}
+	output.insert(output.end(), literals, literals + literalCount);
+	if (matchLength == 0)
+	{
+		return;
+	}
+	output.push_back(static_cast<uint8_t>(offset));
+	output.push_back(static_cast<uint8_t>(offset >> 8));
+	if (extraLength >= 15)
+	{
+		PutLength(output, extraLength - 15);
+	}
+}
+
+static void Compress(const std::vector<uint8_t>& input, std::vector<uint8_t>& output)
+{
+	output.clear();
+	//the last position a hash of 4 bytes was seen at
+	std::vector<uint32_t> positions(1u << HASH_BITS, NO_POSITION);
+	const uint32_t size = static_cast<uint32_t>(input.size());
+	uint32_t literalStart = 0;
+	uint32_t i = 0;
+	while (i + MIN_MATCH <= size)
+	{
+		const uint32_t word = Get32(&input[i]);
+		const uint32_t hash = (word * 2654435761u) >> (32 - HASH_BITS);
+		const uint32_t candidate = positions[hash];
+		positions[hash] = i;
+		if (candidate == NO_POSITION || i - candidate > MAX_OFFSET || Get32(&input[candidate]) != word)
+		{
+			i++;
+			continue;
+		}
+
+		uint32_t length = MIN_MATCH;
+		while (i + length < size && input[candidate + length] == input[i + length])
+		{
+			length++;
+		}
+		PutSequence(output, input.data() + literalStart, i - literalStart, i - candidate, length);
+		i += length;
+		literalStart = i;
+	}
+	PutSequence(output, input.data() + literalStart, size - literalStart, 0, 0);
+}
+
+static uint32_t GetLength(const uint8_t*& bytes, const uint8_t* end, uint32_t length)
+{
+	if (length != 15)
+	{
+		return length;
+	}
+	while (true)
+	{
+		if (bytes == end)
+		{
+			throw CorruptBlock();
+		}
+		const uint8_t byte = *bytes++;
+		length += byte;
+		if (byte != 255)
+		{
+			return length;
+		}
+	}
+}
+
+static void Decompress(const std::vector<uint8_t>& input, std::vector<uint8_t>& output, const uint32_t size)
+{
+	output.clear();
+	output.reserve(size);
+	const uint8_t* bytes = input.data();
+	const uint8_t* end = bytes + input.size();
+	while (bytes != end)
+	{
+		const uint8_t token = *bytes++;
+		const uint32_t literalCount = GetLength(bytes, end, token >> 4);
+		if (literalCount > static_cast<uint64_t>(end - bytes) || output.size() + literalCount > size)
+		{
+			throw CorruptBlock();
+		}
+		output.insert(output.end(), bytes, bytes + literalCount);
+		bytes += literalCount;
+		if (bytes == end)
+		{
+			break;
+		}
+
+		if (end - bytes < 2)
+		{
+			throw CorruptBlock();
+		}
+		const uint32_t offset = bytes[0] | (static_cast<uint32_t>(bytes[1]) << 8);
+		bytes += 2;
+		const uint32_t length = GetLength(bytes, end, token & 15) + MIN_MATCH;
+		if (offset == 0 || offset > output.size() || output.size() + length > size)
+		{
+			throw CorruptBlock();
+		}
+		//the match may overlap what it copies, so one byte at a time
+		size_t from = output.size() - offset;
+		for (uint32_t i = 0; i < length; i++)
+		{
+			output.push_back(output[from++]);
+		}
+	}
+	if (output.size() != size)
+	{
+		throw CorruptBlock();
+	}
+}
+
+TraceFileWriter::TraceFileWriter(const std::string& path, const uint32_t interval) :
+	file(path, std::ios::binary | std::ios::trunc),
+	interval(interval),
+	offset(HEADER_SIZE)
+{
+	if (interval == 0)
+	{
+		throw std::runtime_error("The trace index interval has to be at least 1.");
+	}
+	if (!file)
+	{
+		throw std::runtime_error("Couldn't create the trace file " + path);
+	}
+	std::vector<uint8_t> header(TRACE_MAGIC, TRACE_MAGIC + sizeof(TRACE_MAGIC));
+	Put32(header, TRACE_VERSION);
+	Put32(header, interval);
+	file.write(reinterpret_cast<const char*>(header.data()), header.size());
+}
+
+TraceFileWriter::~TraceFileWriter()
+{
+	try
+	{
+		Close();
+	}
+	catch (const std::runtime_error&)
+	{
+	}
+}
+
+void TraceFileWriter::Write(const TraceRecord& record)
+{
+	if (isClosed)
+	{
+		throw std::runtime_error("The trace file has been closed.");
+	}
+	if (recordCount > 0 && record.instruction < blockFirst + blockRecords)
+	{
+		throw std::runtime_error("Trace records have to be written in the order the instructions retired.");
+	}
+	//a gap in the instructions starts a new block
+	if (blockRecords == interval || (blockRecords > 0 && record.instruction != blockFirst + blockRecords))
+	{
+		WriteBlock();
+	}
+	if (blockRecords == 0)
+	{
+		//every block can be decoded on its own
+		blockFirst = record.instruction;
+		lastPc = static_cast<uint32_t>(-4);
+		std::fill(std::begin(lastRegisters), std::end(lastRegisters), 0);
+		lastAddress = 0;
+		lastValue = 0;
+	}
+
+	const bool isSequential = record.pc == lastPc + 4;
+	block.push_back(static_cast<uint8_t>(record.flags | (isSequential ? SEQUENTIAL_PC : 0)));
+	if (!isSequential)
+	{
+		PutDelta(block, record.pc, lastPc + 4);
+	}
+	lastPc = record.pc;
+	Put32(block, record.rawInstruction);
+	if (record.flags & TRACE_WRITES_RD)
+	{
+		block.push_back(record.rd & 31);
+		PutDelta(block, record.rdValue, lastRegisters[record.rd & 31]);
+		lastRegisters[record.rd & 31] = record.rdValue;
+	}
+	if (record.flags & (TRACE_LOAD | TRACE_STORE))
+	{
+		PutDelta(block, record.memoryAddress, lastAddress);
+		PutDelta(block, record.memoryValue, lastValue);
+		lastAddress = record.memoryAddress;
+		lastValue = record.memoryValue;
+	}
+	blockRecords++;
+	recordCount++;
+}
+
+void TraceFileWriter::WriteBlock()
+{
+	Compress(block, compressed);
+	index.push_back({ blockFirst, blockRecords, offset });
+
+	std::vector<uint8_t> header;
+	Put32(header, static_cast<uint32_t>(block.size()));
+	Put32(header, static_cast<uint32_t>(compressed.size()));
+	file.write(reinterpret_cast<const char*>(header.data()), header.size());
+	file.write(reinterpret_cast<const char*>(compressed.data()), compressed.size());
+	offset += BLOCK_HEADER_SIZE + compressed.size();
+
+	//blockFirst is kept so the next record can be checked against it
+	blockFirst += blockRecords;
+	block.clear();
+	blockRecords = 0;
+}
+
+void TraceFileWriter::Close()
+{
+	if (isClosed)
+	{
+		return;
+	}
+	isClosed = true;
+	if (blockRecords > 0)
+	{
+		WriteBlock();
+	}
+
+	std::vector<uint8_t> end;
+	for (const TraceIndexEntry& entry : index)
+	{
+		Put64(end, entry.firstInstruction);
+		Put32(end, entry.recordCount);
+		Put64(end, entry.offset);
+	}
+	Put64(end, offset);
+	Put64(end, index.size());
+	Put64(end, recordCount);
+	end.insert(end.end(), INDEX_MAGIC, INDEX_MAGIC + sizeof(INDEX_MAGIC));
+	file.write(reinterpret_cast<const char*>(end.data()), end.size());
+	file.close();
+	if (!file)
+	{
+		throw std::runtime_error("Couldn't write the trace file.");
+	}
+}
+
+uint64_t TraceFileWriter::GetRecordCount() const
+{
+	return recordCount;
+}
+
+static void ReadBytes(std::ifstream& file, const uint64_t offset, std::vector<uint8_t>& bytes, const uint64_t size)
+{
+	bytes.resize(static_cast<size_t>(size));
+	file.clear();
+	file.seekg(static_cast<std::streamoff>(offset));
+	file.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(size));
+	if (!file)
+	{
+		throw std::runtime_error("The trace file ends too early.");
+	}
+}
+
+TraceFileReader::TraceFileReader(const std::string& path) :
+	file(path, std::ios::binary)
+{
+	if (!file)
+	{
+		throw std::runtime_error("Couldn't open the trace file " + path);
+	}
+	file.seekg(0, std::ios::end);
+	const uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+	if (fileSize < HEADER_SIZE + TRAILER_SIZE)
+	{
+		throw std::runtime_error("Not a trace file, or it wasn't closed: " + path);
+	}
+
+	std::vector<uint8_t> bytes;
+	ReadBytes(file, 0, bytes, HEADER_SIZE);
+	if (std::memcmp(bytes.data(), TRACE_MAGIC, sizeof(TRACE_MAGIC)) != 0 || Get32(&bytes[8]) != TRACE_VERSION)
+	{
+		throw std::runtime_error("Not a trace file: " + path);
+	}
+	interval = Get32(&bytes[12]);
+
+	ReadBytes(file, fileSize - TRAILER_SIZE, bytes, TRAILER_SIZE);
+	if (std::memcmp(&bytes[24], INDEX_MAGIC, sizeof(INDEX_MAGIC)) != 0)
+	{
+		throw std::runtime_error("The trace file wasn't closed: " + path);
+	}
+	const uint64_t indexOffset = Get64(&bytes[0]);
+	const uint64_t blockCount = Get64(&bytes[8]);
+	recordCount = Get64(&bytes[16]);
+	if (indexOffset > fileSize - TRAILER_SIZE || blockCount != (fileSize - TRAILER_SIZE - indexOffset) / INDEX_ENTRY_SIZE)
+	{
+		throw std::runtime_error("The trace file has a corrupt index: " + path);
+	}
+
+	ReadBytes(file, indexOffset, bytes, blockCount * INDEX_ENTRY_SIZE);
+	for (uint64_t i = 0; i < blockCount; i++)
+	{
+		const uint8_t* entry = &bytes[i * INDEX_ENTRY_SIZE];
+		index.push_back({ Get64(entry), Get32(entry + 8), Get64(entry + 12) });
+	}
+}
+
+uint32_t TraceFileReader::GetInterval() const
+{
+	return interval;
+}
+
+uint64_t TraceFileReader::GetRecordCount() const
+{
+	return recordCount;
+}
+
+const std::vector<TraceIndexEntry>& TraceFileReader::GetIndex() const
+{
+	return index;
+}
+
+std::vector<TraceRecord> TraceFileReader::ReadBlock(const TraceIndexEntry& entry)
+{
+	std::vector<uint8_t> header;
+	ReadBytes(file, entry.offset, header, BLOCK_HEADER_SIZE);
+	std::vector<uint8_t> compressed;
+	ReadBytes(file, entry.offset + BLOCK_HEADER_SIZE, compressed, Get32(&header[4]));
+	std::vector<uint8_t> block;
+	Decompress(compressed, block, Get32(&header[0]));
+
+	std::vector<TraceRecord> records;
+	records.reserve(entry.recordCount);
+	uint32_t lastPc = static_cast<uint32_t>(-4);
+	uint32_t lastRegisters[32] = { 0 };
+	uint32_t lastAddress = 0;
+	uint32_t lastValue = 0;
+	const uint8_t* bytes = block.data();
+	const uint8_t* end = bytes + block.size();
+	for (uint32_t i = 0; i < entry.recordCount; i++)
+	{
+		TraceRecord record = { entry.firstInstruction + i, 0, 0, 0, 0, 0, 0, 0 };
+		if (bytes == end)
+		{
+			throw CorruptBlock();
+		}
+		const uint8_t flags = *bytes++;
+		record.flags = flags & ~SEQUENTIAL_PC;
+		record.pc = (flags & SEQUENTIAL_PC) ? lastPc + 4 : GetDelta(bytes, end, lastPc + 4);
+		lastPc = record.pc;
+		if (end - bytes < 4)
+		{
+			throw CorruptBlock();
+		}
+		record.rawInstruction = Get32(bytes);
+		bytes += 4;
+		if (record.flags & TRACE_WRITES_RD)
+		{
+			if (bytes == end)
+			{
+				throw CorruptBlock();
+			}
+			record.rd = *bytes++ & 31;
+			record.rdValue = GetDelta(bytes, end, lastRegisters[record.rd]);
+			lastRegisters[record.rd] = record.rdValue;
+		}
+		if (record.flags & (TRACE_LOAD | TRACE_STORE))
+		{
+			record.memoryAddress = GetDelta(bytes, end, lastAddress);
+			record.memoryValue = GetDelta(bytes, end, lastValue);
+			lastAddress = record.memoryAddress;
+			lastValue = record.memoryValue;
+		}
+		records.push_back(record);
+	}
+	return records;
+}
+
+std::vector<TraceRecord> TraceFileReader::Read(const uint64_t first, const uint64_t count)
+{
+	std::vector<TraceRecord> records;
+	//the first block that has first or something after it
+	auto block = std::partition_point(index.begin(), index.end(), [first](const TraceIndexEntry& entry)
+	{
+		return entry.firstInstruction + entry.recordCount <= first;
+	});
+	for (; block != index.end() && records.size() < count; block++)
+	{
+		for (const TraceRecord& record : ReadBlock(*block))
+		{
+			if (record.instruction >= first && records.size() < count)
+			{
+				records.push_back(record);
+			}
+		}
+	}
+	return records;
+}
+
+static std::string Disassemble(const uint32_t rawInstruction)
+{
+	try
+	{
+		return InstructionAsString(DecodeInstruction(rawInstruction));
+	}
+	catch (const std::runtime_error&)
+	{
+		return "unknown";
+	}
+}
+
+static void AppendHex(std::string& text, const uint32_t value)
+{
+	static const char DIGITS[] = "0123456789abcdef";
+	char digits[8];
+	for (uint32_t i = 0; i < 8; i++)
+	{
+		digits[i] = DIGITS[(value >> (28 - 4 * i)) & 15];
+	}
+	text.append(digits, 8);
+}
+
+//the line of TraceRecordAsString, put together without
+//sprintf as a text trace does it for every record
+static void AppendTraceRecord(std::string& text, const TraceRecord& record, const std::string& disassembly)
+{
+	text += std::to_string(record.instruction);
+	text += ": ";
+	AppendHex(text, record.pc);
+	text += ' ';
+	AppendHex(text, record.rawInstruction);
+	text += ' ';
+	text += disassembly;
+	if (record.flags == 0)
+	{
+		return;
+	}
+	//the instructions are padded so what they did lines up
+	if (disassembly.size() < 24)
+	{
+		text.append(24 - disassembly.size(), ' ');
+	}
+	if (record.flags & TRACE_WRITES_RD)
+	{
+		text += ' ';
+		text += RegisterName(record.rd);
+		text += '=';
+		AppendHex(text, record.rdValue);
+	}
+	if (record.flags & (TRACE_LOAD | TRACE_STORE))
+	{
+		const char* access = ((record.flags & TRACE_LOAD) && (record.flags & TRACE_STORE)) ? " atomic [" : ((record.flags & TRACE_LOAD) ? " load [" : " store [");
+		text += access;
+		AppendHex(text, record.memoryAddress);
+		text += "]=";
+		AppendHex(text, record.memoryValue);
+	}
+}
+
+TextTraceWriter::TextTraceWriter(std::ostream& stream) :
+	stream(stream),
+	cachedWords(DISASSEMBLY_CACHE_SIZE),
+	isCached(DISASSEMBLY_CACHE_SIZE, false),
+	disassembly(DISASSEMBLY_CACHE_SIZE)
+{
+	buffer.reserve(BUFFER_SIZE);
+}
+
+TextTraceWriter::~TextTraceWriter()
+{
+	try
+	{
+		Flush();
+	}
+	catch (const std::runtime_error&)
+	{
+	}
+}
+
+void TextTraceWriter::Write(const TraceRecord& record)
+{
+	const uint32_t slot = (record.rawInstruction * 2654435761u) >> (32 - DISASSEMBLY_CACHE_BITS);
+	if (!isCached[slot] || cachedWords[slot] != record.rawInstruction)
+	{
+		cachedWords[slot] = record.rawInstruction;
+		isCached[slot] = true;
+		disassembly[slot] = Disassemble(record.rawInstruction);
+	}
+	AppendTraceRecord(buffer, record, disassembly[slot]);
+	buffer += '\n';
+	if (buffer.size() >= BUFFER_SIZE)
+	{
+		stream.write(buffer.data(), buffer.size());
+		buffer.clear();
+	}
+}
+
+void TextTraceWriter::Flush()
+{
+	stream.write(buffer.data(), buffer.size());
+	stream.flush();
+	buffer.clear();
+	if (!stream)
+	{
+		throw std::runtime_error("Couldn't write the text trace.");
+	}
+}
+
+std::string TraceRecordAsString(const TraceRecord& record)
+{
+	std::string text;
+	AppendTraceRecord(text, record, Disassemble(record.rawInstruction));
+	return text;
+}
@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+#include "TraceSink.h"
+
+//Where a block of records starts in a trace file. A block starts every
+//interval records, or where the instructions of a trace have a gap.
+struct TraceIndexEntry
+{
+	uint64_t firstInstruction;
+	uint32_t recordCount;
+	uint64_t offset;
+};
+
+//A binary trace file. Records are split in blocks of interval records,
+//and every field of a record is stored as the difference to what came
+//before it in the block: pc to the pc after the last instruction, rd to
+//the last value of that register and the memory address and value to
+//the last ones. Most of them then fit in a byte or two, and the block is
+//then compressed with LZ77, which removes most of what is left as a
+//loop gives the same bytes every iteration. The file ends with an index
+//of the blocks, so a reader only has to decode one block to find any
+//instruction.
+//The trace is complete once it is closed, which the destructor does.
+class TraceFileWriter : public TraceSink
+{
+public:
+	const static uint32_t DEFAULT_INTERVAL = 4096;
+
+private:
+	std::ofstream file;
+	uint32_t interval;
+	uint64_t offset;
+	std::vector<TraceIndexEntry> index;
+	std::vector<uint8_t> block;
+	std::vector<uint8_t> compressed;
+	uint64_t blockFirst = 0;
+	uint32_t blockRecords = 0;
+	uint64_t recordCount = 0;
+	uint32_t lastPc = 0;
+	uint32_t lastRegisters[32];
+	uint32_t lastAddress = 0;
+	uint32_t lastValue = 0;
+	bool isClosed = false;
+
+	void WriteBlock();
+
+public:
+	TraceFileWriter(const std::string& path, const uint32_t interval = DEFAULT_INTERVAL);
+	TraceFileWriter(const TraceFileWriter&) = delete;
+	TraceFileWriter& operator=(const TraceFileWriter&) = delete;
+	~TraceFileWriter();
+
+	void Write(const TraceRecord& record) override;
+	//writes the last block and the index
+	void Close();
+	uint64_t GetRecordCount() const;
+};
+
+class TraceFileReader
+{
+private:
+	std::ifstream file;
+	uint32_t interval;
+	uint64_t recordCount;
+	std::vector<TraceIndexEntry> index;
+
+	std::vector<TraceRecord> ReadBlock(const TraceIndexEntry& entry);
+
+public:
+	explicit TraceFileReader(const std::string& path);
+
+	uint32_t GetInterval() const;
+	uint64_t GetRecordCount() const;
+	const std::vector<TraceIndexEntry>& GetIndex() const;
+	//at most count records, starting with the first instruction
+	//numbered first or after it
+	std::vector<TraceRecord> Read(const uint64_t first, const uint64_t count);
+};
+
+//Writes a line of text for every record. The lines are collected in a
+//large buffer which is written to the stream in one go once it is full
+//and when the sink is flushed, instead of flushing the stream per line.
+//A program runs the same instructions over and over, so the text of the
+//last instruction words seen is kept instead of decoding them every time.
+class TextTraceWriter : public TraceSink
+{
+public:
+	const static size_t BUFFER_SIZE = 1 << 20;
+
+private:
+	const static uint32_t DISASSEMBLY_CACHE_BITS = 12;
+	const static uint32_t DISASSEMBLY_CACHE_SIZE = 1 << DISASSEMBLY_CACHE_BITS;
+
+	std::ostream& stream;
+	std::string buffer;
+	//indexed by a hash of the word
+	std::vector<uint32_t> cachedWords;
+	std::vector<bool> isCached;
+	std::vector<std::string> disassembly;
+
+public:
+	explicit TextTraceWriter(std::ostream& stream);
+	~TextTraceWriter();
+
+	void Write(const TraceRecord& record) override;
+	void Flush() override;
+};
+
+//one line, without a newline
+std::string TraceRecordAsString(const TraceRecord& record);
@@ -0,0 +1,196 @@
+#include "ForkServer.h"
+#include <cstdint>
+#include <cstring>
+#include <cctype>
+#include <cerrno>
+#include <stdexcept>
+#include <iostream>
+#include <iomanip>
+#include <string>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#ifndef _WIN32
+#include <csignal>
+#include <fcntl.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+BatchResult RunForked(const std::string& program, const std::function<BatchResult()>& run, const uint32_t killAfter)
+{
+	throw std::runtime_error("The fork server needs fork, which windows doesn't have.");
+}
+
+#else
+
+//what a child sends back through its pipe, followed by the message
+struct ChildResult
+{
+	int32_t status;
+	uint64_t instructionsExecuted;
+	uint32_t messageSize;
+};
+
+static void WriteAll(const int fd, const char* data, size_t size)
+{
+	while (size > 0)
+	{
+		const ssize_t written = write(fd, data, size);
+		if (written < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if (written <= 0)
+		{
+			return;
+		}
+		data += written;
+		size -= static_cast<size_t>(written);
+	}
+}
+
+static std::string ReadAll(const int fd)
+{
+	std::string data;
+	char buffer[4096];
+	while (true)
+	{
+		const ssize_t count = read(fd, buffer, sizeof(buffer));
+		if (count < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if (count <= 0)
+		{
+			return data;
+		}
+		data.append(buffer, static_cast<size_t>(count));
+	}
+}
+
+static void RunChild(const int resultFd, const std::function<BatchResult()>& run, const uint32_t killAfter)
+{
+	//the parent may be serving on stdout, nothing the program
+	//prints is allowed to end up between the responses
+	const int null = open("/dev/null", O_WRONLY);
+	if (null >= 0)
+	{
+		dup2(null, STDOUT_FILENO);
+		close(null);
+	}
+	signal(SIGALRM, SIG_DFL);
+	alarm(killAfter);
+
+	BatchResult result;
+	try
+	{
+		result = run();
+	}
+	catch (const std::exception& e)
+	{
+		result.status = BatchStatus::Error;
+		result.instructionsExecuted = 0;
+		result.message = e.what();
+	}
+
+	const ChildResult header = { static_cast<int32_t>(result.status), result.instructionsExecuted, static_cast<uint32_t>(result.message.size()) };
+	WriteAll(resultFd, reinterpret_cast<const char*>(&header), sizeof(header));
+	WriteAll(resultFd, result.message.data(), result.message.size());
+	close(resultFd);
+	//exit would flush the copies of the parent's streams
+	//and write what the parent had buffered a second time
+	_exit(0);
+}
+
+BatchResult RunForked(const std::string& program, const std::function<BatchResult()>& run, const uint32_t killAfter)
+{
+	BatchResult result = { program, BatchStatus::Error, 0, 0.0, "" };
+	const auto start = std::chrono::steady_clock::now();
+
+	int fds[2];
+	if (pipe(fds) != 0)
+	{
+		throw std::runtime_error("Failed to create a pipe: " + std::string(std::strerror(errno)));
+	}
+	std::cout.flush();
+	std::cerr.flush();
+	const pid_t child = fork();
+	if (child < 0)
+	{
+		close(fds[0]);
+		close(fds[1]);
+		throw std::runtime_error("Failed to fork: " + std::string(std::strerror(errno)));
+	}
+	if (child == 0)
+	{
+		close(fds[0]);
+		RunChild(fds[1], run, killAfter);
+	}
+
+	//the pipe only ends once the child has closed it or died
+	close(fds[1]);
+	const std::string data = ReadAll(fds[0]);
+	close(fds[0]);
+	int status = 0;
+	while (waitpid(child, &status, 0) < 0 && errno == EINTR)
+	{
+	}
+	result.milliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+	ChildResult header;
+	if (WIFEXITED(status) && data.size() >= sizeof(header))
+	{
+		std::memcpy(&header, data.data(), sizeof(header));
+		result.status = static_cast<BatchStatus>(header.status);
+		result.instructionsExecuted = header.instructionsExecuted;
+		result.message = data.substr(sizeof(header), header.messageSize);
+		result.message = result.message.substr(0, result.message.find('\n'));
+	}
+	else if (WIFSIGNALED(status) && WTERMSIG(status) == SIGALRM)
+	{
+		result.message = "Killed after " + std::to_string(killAfter) + " seconds";
+	}
+	else if (WIFSIGNALED(status))
+	{
+		result.message = "Killed by signal " + std::to_string(WTERMSIG(status)) + " (" + strsignal(WTERMSIG(status)) + ")";
+	}
+	else
+	{
+		result.message = "Exited with code " + std::to_string(WEXITSTATUS(status)) + " without a result";
+	}
+	return result;
+}
+
+#endif
+
+uint32_t ServePrograms(std::istream& requests, std::ostream& responses, const RunLimits& limits, const uint32_t killAfter)
+{
+	uint32_t notPassed = 0;
+	std::string line;
+	while (std::getline(requests, line))
+	{
+		line.erase(std::find_if(line.rbegin(), line.rend(), [](char c) { return !std::isspace(static_cast<unsigned char>(c)); }).base(), line.end());
+		if (line.empty() || line[0] == '#')
+		{
+			continue;
+		}
+
+		const BatchResult result = RunForked(line, [&line, &limits]() { return RunBatchProgram(line, limits); }, killAfter);
+		if (result.status != BatchStatus::Passed)
+		{
+			notPassed++;
+		}
+		responses << BatchStatusName(result.status) << '\t' << result.instructionsExecuted << '\t';
+		responses << std::fixed << std::setprecision(3) << result.milliseconds << '\t' << result.program << '\t' << result.message << std::endl;
+	}
+	return notPassed;
+}
+
+int RunForkServer(const RunLimits& limits, const uint32_t killAfter)
+{
+	return ServePrograms(std::cin, std::cout, limits, killAfter) == 0 ? 0 : -1;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include "BatchRunner.h"
+#include "RISCV_Program.h"
+
+//Runs programs in children forked from a simulator that has already
+//started up, so every program gets a process of its own without paying
+//for exec, dynamic linking and static initialization each time. A program
+//that crashes or hangs the simulator only takes its own child down.
+//Only available where there is fork, elsewhere these throw.
+
+//seconds a child may run before it is killed, unless told otherwise
+const uint32_t DEFAULT_KILL_AFTER = 60;
+
+//runs run in a forked child and returns its result with the time from the
+//fork until the child was reaped. A child that is killed by a signal, or by
+//an alarm after killAfter seconds, 0 for never, gets an error result
+BatchResult RunForked(const std::string& program, const std::function<BatchResult()>& run, const uint32_t killAfter);
+
+//reads one program path per line from requests until it ends, runs each
+//program in its own child and checks it against its .res file like --batch.
+//As soon as a child is done one line is written to responses with the
+//status, instructions executed, milliseconds, program and message separated
+//by tabs. Returns how many programs didn't pass
+uint32_t ServePrograms(std::istream& requests, std::ostream& responses, const RunLimits& limits, const uint32_t killAfter);
+
+//the --fork-server command, requests on stdin and responses on stdout
+int RunForkServer(const RunLimits& limits, const uint32_t killAfter);
@@ -0,0 +1,299 @@
+#include "HostMemory.h"
+#include <cstdint>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+#ifndef _WIN32
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+static const size_t PAGE_SIZE = 4096;
+static const size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+static size_t RoundUp(const size_t value, const size_t alignment)
+{
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+HostMemory::HostMemory(const size_t size, const MemoryOptions& options) : size(size)
+{
+	Allocate(options);
+	if (options.bindToNUMANode && backing != PageBacking::File)
+	{
+		BindToNUMANode();
+	}
+}
+
+#ifdef _WIN32
+
+void HostMemory::Allocate(const MemoryOptions& options)
+{
+	if (options.ramFileMapping != RAMFileMapping::None)
+	{
+		MapFile(options);
+		return;
+	}
+	//huge pages and NUMA binding are only done on linux
+	mappedSize = size;
+	data = new uint8_t[size];
+	Clear();
+}
+
+void HostMemory::MapFile(const MemoryOptions& options)
+{
+	throw std::runtime_error("File backed memory is only supported on linux.\nFile: " + options.ramFile);
+}
+
+void HostMemory::BindToNUMANode()
+{
+}
+
+void HostMemory::Clear()
+{
+	std::fill(data, data + size, 0);
+}
+
+MemoryBackingInfo HostMemory::GetBackingInfo() const
+{
+	return { backing, numaNode, 0 };
+}
+
+HostMemory::~HostMemory()
+{
+	delete[] data;
+}
+
+#else
+
+//from linux/mempolicy.h which isn't always installed
+static const int MPOL_BIND_POLICY = 2;
+
+void HostMemory::Allocate(const MemoryOptions& options)
+{
+	if (options.ramFileMapping != RAMFileMapping::None)
+	{
+		MapFile(options);
+		return;
+	}
+	if (options.useHugePages)
+	{
+		mappedSize = RoundUp(size, HUGE_PAGE_SIZE);
+		void* mapped = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+		if (mapped != MAP_FAILED)
+		{
+			data = static_cast<uint8_t*>(mapped);
+			backing = PageBacking::HugeTLBPages;
+			return;
+		}
+
+		//no hugetlb pages are reserved so fall back to transparent
+		//huge pages, which only works on 2 MiB aligned memory
+		const size_t reservedSize = mappedSize + HUGE_PAGE_SIZE;
+		mapped = mmap(nullptr, reservedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		if (mapped == MAP_FAILED)
+		{
+			throw std::runtime_error("Failed to allocate " + std::to_string(mappedSize) + " bytes of guest memory.");
+		}
+
+		uint8_t* const start = static_cast<uint8_t*>(mapped);
+		uint8_t* const aligned = reinterpret_cast<uint8_t*>(RoundUp(reinterpret_cast<uintptr_t>(start), HUGE_PAGE_SIZE));
+		if (aligned != start)
+		{
+			munmap(start, aligned - start);
+		}
+		if (aligned + mappedSize != start + reservedSize)
+		{
+			munmap(aligned + mappedSize, (start + reservedSize) - (aligned + mappedSize));
+		}
+
+		data = aligned;
+		if (madvise(data, mappedSize, MADV_HUGEPAGE) == 0)
+		{
+			backing = PageBacking::TransparentHugePages;
+		}
+		return;
+	}
+
+	mappedSize = RoundUp(size, PAGE_SIZE);
+	void* mapped = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	if (mapped == MAP_FAILED)
+	{
+		throw std::runtime_error("Failed to allocate " + std::to_string(mappedSize) + " bytes of guest memory.");
+	}
+	data = static_cast<uint8_t*>(mapped);
+}
+
+static std::runtime_error FileError(const std::string& what, const std::string& path)
+{
+	return std::runtime_error(what + " " + path + "\n" + std::strerror(errno));
+}
+
+void HostMemory::MapFile(const MemoryOptions& options)
+{
+	const std::string& path = options.ramFile;
+	const bool shared = options.ramFileMapping == RAMFileMapping::Shared;
+	const int file = shared ? open(path.c_str(), O_RDWR | O_CREAT, 0644) : open(path.c_str(), O_RDONLY);
+	if (file < 0)
+	{
+		throw FileError("Failed to open file:", path);
+	}
+
+	struct stat fileInfo;
+	if (fstat(file, &fileInfo) != 0)
+	{
+		close(file);
+		throw FileError("Failed to read size of file:", path);
+	}
+	const size_t fileSize = static_cast<size_t>(fileInfo.st_size);
+	mappedSize = RoundUp(size, PAGE_SIZE);
+	if (shared && fileSize < mappedSize && ftruncate(file, static_cast<off_t>(mappedSize)) != 0)
+	{
+		close(file);
+		throw FileError("Failed to extend file:", path);
+	}
+
+	void* mapped;
+	if (shared)
+	{
+		mapped = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_SHARED, file, 0);
+	}
+	else
+	{
+		//touching a page of the mapping past the end of the file would
+		//fault, so the file is only mapped over the start of zeroed memory
+		mapped = mmap(nullptr, mappedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+		const size_t fileBytes = std::min(RoundUp(fileSize, PAGE_SIZE), mappedSize);
+		if (mapped != MAP_FAILED && fileBytes > 0 &&
+			mmap(mapped, fileBytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_FIXED, file, 0) == MAP_FAILED)
+		{
+			munmap(mapped, mappedSize);
+			mapped = MAP_FAILED;
+		}
+	}
+	//the mapping keeps the file alive on its own
+	close(file);
+	if (mapped == MAP_FAILED)
+	{
+		throw FileError("Failed to map file:", path);
+	}
+	data = static_cast<uint8_t*>(mapped);
+	backing = PageBacking::File;
+}
+
+void HostMemory::BindToNUMANode()
+{
+	//nothing is touched yet so every page will be allocated on the node
+	unsigned int cpu;
+	unsigned int node;
+	if (syscall(SYS_getcpu, &cpu, &node, nullptr) != 0 || node >= sizeof(unsigned long) * 8)
+	{
+		return;
+	}
+
+	const unsigned long nodeMask = 1UL << node;
+	if (syscall(SYS_mbind, data, mappedSize, MPOL_BIND_POLICY, &nodeMask, sizeof(nodeMask) * 8 + 1, 0) == 0)
+	{
+		numaNode = static_cast<int32_t>(node);
+	}
+}
+
+void HostMemory::Clear()
+{
+	//a file backing the memory keeps its contents between runs
+	if (backing == PageBacking::File)
+	{
+		return;
+	}
+	//small memories are faster to just fill, large ones are given
+	//back to the os which hands out zeroed pages on the next touch.
+	//This keeps both the huge page advice and the NUMA policy
+	if (size < HUGE_PAGE_SIZE || madvise(data, mappedSize, MADV_DONTNEED) != 0)
+	{
+		std::fill(data, data + size, 0);
+	}
+}
+
+static bool IsMappingHeader(const std::string& line)
+{
+	const size_t space = line.find(' ');
+	if (space == std::string::npos || space == 0)
+	{
+		return false;
+	}
+	for (size_t i = 0; i < space; i++)
+	{
+		if (!std::isxdigit(static_cast<unsigned char>(line[i])) && line[i] != '-')
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+//the huge pages actually backing the memory can only be
+//seen in the mapping's entry in /proc/self/smaps
+static uint64_t ReadHugePageBytes(const uint8_t* data)
+{
+	std::ifstream smaps("/proc/self/smaps");
+	const uintptr_t address = reinterpret_cast<uintptr_t>(data);
+	const std::string field = "AnonHugePages:";
+	bool inMapping = false;
+	std::string line;
+	while (std::getline(smaps, line))
+	{
+		if (IsMappingHeader(line))
+		{
+			const size_t dash = line.find('-');
+			const uintptr_t start = std::stoull(line.substr(0, dash), nullptr, 16);
+			const uintptr_t end = std::stoull(line.substr(dash + 1), nullptr, 16);
+			inMapping = start <= address && address < end;
+		}
+		else if (inMapping && line.compare(0, field.size(), field) == 0)
+		{
+			return std::stoull(line.substr(field.size())) * 1024;
+		}
+	}
+	return 0;
+}
+
+MemoryBackingInfo HostMemory::GetBackingInfo() const
+{
+	const uint64_t hugePageBytes = (backing == PageBacking::HugeTLBPages) ? mappedSize : ReadHugePageBytes(data);
+	return { backing, numaNode, hugePageBytes };
+}
+
+HostMemory::~HostMemory()
+{
+	munmap(data, mappedSize);
+}
+
+#endif
+
+uint8_t* HostMemory::GetData() const
+{
+	return data;
+}
+
+std::string PageBackingName(const PageBacking backing)
+{
+	switch (backing)
+	{
+		case PageBacking::TransparentHugePages:
+			return "transparent huge pages";
+		case PageBacking::HugeTLBPages:
+			return "2 MiB hugetlb pages";
+		case PageBacking::File:
+			return "a mapped file";
+		default:
+			return "4 KiB pages";
+	}
+}
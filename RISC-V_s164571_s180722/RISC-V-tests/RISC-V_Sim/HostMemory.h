@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <string>
+
+enum class PageBacking : uint32_t
+{
+	NormalPages,
+	TransparentHugePages,
+	HugeTLBPages,
+	File
+};
+
+enum class RAMFileMapping : uint32_t
+{
+	//ram is anonymous memory that starts out as zeros
+	None,
+	//ram is the file, stores go straight to it and persist after the run
+	Shared,
+	//ram starts out as the file without copying it, stores only
+	//change the run's own copy of the pages they touch
+	Private
+};
+
+struct MemoryOptions
+{
+	uint32_t ramSize;
+	//try 2 MiB hugetlb pages first and transparent huge pages second
+	bool useHugePages;
+	//bind the memory to the NUMA node of the thread allocating it
+	bool bindToNUMANode;
+	//ram is mapped from ramFile instead, which leaves out huge pages and NUMA
+	RAMFileMapping ramFileMapping;
+	std::string ramFile;
+};
+
+//What the operating system actually gave, which can be
+//less than what was asked for in the options
+struct MemoryBackingInfo
+{
+	PageBacking backing;
+	//-1 when the memory isn't bound to a node
+	int32_t numaNode;
+	//bytes currently backed by huge pages
+	uint64_t hugePageBytes;
+};
+
+//Host memory used as guest RAM. Allocated with mmap so it can use huge
+//pages and a NUMA policy, the memory starts out as zeros and is only
+//backed by real pages once it is touched. Or mapped from a file, whose
+//contents clearing the memory leaves alone.
+class HostMemory
+{
+private:
+	uint8_t* data = nullptr;
+	size_t size = 0;
+	size_t mappedSize = 0;
+	PageBacking backing = PageBacking::NormalPages;
+	int32_t numaNode = -1;
+
+	void Allocate(const MemoryOptions& options);
+	void MapFile(const MemoryOptions& options);
+	void BindToNUMANode();
+
+public:
+	HostMemory(const size_t size, const MemoryOptions& options);
+	HostMemory(const HostMemory&) = delete;
+	HostMemory& operator=(const HostMemory&) = delete;
+
+	uint8_t* GetData() const;
+	void Clear();
+	MemoryBackingInfo GetBackingInfo() const;
+
+	~HostMemory();
+};
+
+std::string PageBackingName(const PageBacking backing);
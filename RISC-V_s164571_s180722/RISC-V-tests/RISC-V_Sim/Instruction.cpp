@@ -179,6 +179,14 @@ static std::string GetNameOfInstructionType(const InstructionType type)
 			return "csrrsi";
 		case InstructionType::csrrci:
 			return "csrrci";
+		case InstructionType::sret:
+			return "sret";
+		case InstructionType::mret:
+			return "mret";
+		case InstructionType::sfence_vma:
+			return "sfence_vma";
+		case InstructionType::wfi:
+			return "wfi";
 		case InstructionType::mul:
 			return "mul";
 		case InstructionType::mulh:
@@ -195,6 +203,28 @@ static std::string GetNameOfInstructionType(const InstructionType type)
 			return "rem";
 		case InstructionType::remu:
 			return "remu";
+		case InstructionType::lr_w:
+			return "lr_w";
+		case InstructionType::sc_w:
+			return "sc_w";
+		case InstructionType::amoswap_w:
+			return "amoswap_w";
+		case InstructionType::amoadd_w:
+			return "amoadd_w";
+		case InstructionType::amoxor_w:
+			return "amoxor_w";
+		case InstructionType::amoand_w:
+			return "amoand_w";
+		case InstructionType::amoor_w:
+			return "amoor_w";
+		case InstructionType::amomin_w:
+			return "amomin_w";
+		case InstructionType::amomax_w:
+			return "amomax_w";
+		case InstructionType::amominu_w:
+			return "amominu_w";
+		case InstructionType::amomaxu_w:
+			return "amomaxu_w";
 		default:
 			throw std::runtime_error("Invalid instruction type. Type: " + NumberToBits(static_cast<uint32_t>(type)));
 	}
@@ -219,7 +249,19 @@ std::string InstructionAsString(const Instruction& instruction)
 			sprintf(text, "%s %s %s %i", type.c_str(), rdText.c_str(), rs1Text.c_str(), instruction.immediate);
 			break;
 		case 0b0111'0011:
-			sprintf(text, "%s", type.c_str());
+			//csr instructions with an immediate has the immediate in the rs1 field
+			if (InstructionTypeFunct3(instruction.type) == 0 || instruction.type == InstructionType::wfi)
+			{
+				sprintf(text, "%s", type.c_str());
+			}
+			else if (InstructionTypeFunct3(instruction.type) & 0b100)
+			{
+				sprintf(text, "%s %s %i %i", type.c_str(), rdText.c_str(), instruction.immediate & 0xfff, instruction.rs1);
+			}
+			else
+			{
+				sprintf(text, "%s %s %i %s", type.c_str(), rdText.c_str(), instruction.immediate & 0xfff, rs1Text.c_str());
+			}
 			break;
 		case 0b0001'0111:
 		case 0b0011'0111:
@@ -237,6 +279,20 @@ std::string InstructionAsString(const Instruction& instruction)
 		case 0b0110'1111:
 			sprintf(text, "%s %s %i", type.c_str(), rdText.c_str(), instruction.immediate);
 			break;
+		//the immediate holds the aq and rl bits
+		case 0b0010'1111:
+		{
+			const char* const orderings[] = { "", ".rl", ".aq", ".aqrl" };
+			if (instruction.type == InstructionType::lr_w)
+			{
+				sprintf(text, "%s%s %s (%s)", type.c_str(), orderings[instruction.immediate & 0b11], rdText.c_str(), rs1Text.c_str());
+			}
+			else
+			{
+				sprintf(text, "%s%s %s %s (%s)", type.c_str(), orderings[instruction.immediate & 0b11], rdText.c_str(), rs2Text.c_str(), rs1Text.c_str());
+			}
+			break;
+		}
 		default:
 			throw std::runtime_error("Invalid opcode. opcode: " + std::to_string(InstructionTypeGetOpCode(instruction.type)));
 	}
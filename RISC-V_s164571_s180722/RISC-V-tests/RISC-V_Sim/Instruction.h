@@ -4,6 +4,7 @@
 #include <string>
 #include "InstructionType.h"
 
+//8 bytes, so a cache line holds 8 decoded instructions
 struct Instruction
 {
 	int32_t immediate;
@@ -13,6 +14,8 @@ struct Instruction
 	uint8_t rs2;
 };
 
+static_assert(sizeof(Instruction) == 8, "Decoded instructions have to stay 8 bytes");
+
 std::string NumberToBits(const uint32_t n);
 std::string InstructionToBits(const uint32_t n);
 std::string InstructionAsString(const Instruction& instruction);
\ No newline at end of file
@@ -3,127 +3,229 @@
 #include <stdexcept>
 #include <memory>
 #include <vector>
+#include <thread>
+#include <algorithm>
 #include "Instruction.h"
-#include "InstructionFormat.h"
-#include "ImmediateFormat.h"
 
-static uint32_t GetImmediateMask(uint16_t instructionIdentifier)
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define DECODE_HAS_AVX2
+#define AVX2_TARGET __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define DECODE_HAS_AVX2
+#define AVX2_TARGET
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+//where the fields and the immediate of an instruction are
+enum class DecodeFormat : uint8_t
+{
+	Invalid,
+	R,
+	Atomic,
+	I,
+	S,
+	SB,
+	UJ,
+	U
+};
+
+static constexpr uint32_t FORMAT_COUNT = 8;
+
+static constexpr DecodeFormat GetDecodeFormat(const uint32_t opcode)
 {
-	const uint32_t removefunct7    = 0b00000000'00000000'00000000'00011111;
-	const uint32_t wholeidentifier = 0b11111111'11111111'11111111'11111111;
-	switch (instructionIdentifier)
+	switch (opcode)
 	{
-		case 0b000000'001'0010011:
-		case 0b000000'101'0010011:
-			return removefunct7;
+		case 0b0000011:
+		case 0b0001111:
+		case 0b0010011:
+		case 0b1100111:
+		case 0b1110011:
+			return DecodeFormat::I;
+		case 0b0010111:
+		case 0b0110111:
+			return DecodeFormat::U;
+		case 0b0100011:
+			return DecodeFormat::S;
+		case 0b0110011:
+			return DecodeFormat::R;
+		case 0b0101111:
+			return DecodeFormat::Atomic;
+		case 0b1100011:
+			return DecodeFormat::SB;
+		case 0b1101111:
+			return DecodeFormat::UJ;
 		default:
-			return wholeidentifier;
+			return DecodeFormat::Invalid;
 	}
 }
 
-static uint16_t GetInstructionIdentifierMask(uint16_t instructionIdentifier)
+//whether funct7 is part of the instruction type, for the shift immediates
+//it's the upper bits of the immediate and for atomics it's funct5 and aq rl
+static constexpr bool UsesFunct7(const uint32_t opcode, const uint32_t funct3)
 {
-	const uint16_t onlyOpCodeAndFunct3 = 0b000000'111'1111111;
-	const uint16_t wholeidentifier     = 0b111111'111'1111111;
-	switch (instructionIdentifier & onlyOpCodeAndFunct3)
+	switch (GetDecodeFormat(opcode))
 	{
-		case 0b000000'001'0010011:
-		case 0b000000'101'0010011:
-		case 0b000000'000'0110011:
-		case 0b000000'001'0110011:
-		case 0b000000'010'0110011:
-		case 0b000000'011'0110011:
-		case 0b000000'100'0110011:
-		case 0b000000'101'0110011:
-		case 0b000000'110'0110011:
-		case 0b000000'111'0110011:
-		case 0b000000'000'1110011:
-			return wholeidentifier;
+		case DecodeFormat::R:
+			return true;
+		case DecodeFormat::I:
+			return (opcode == 0b0010011 && (funct3 == 0b001 || funct3 == 0b101)) || (opcode == 0b1110011 && funct3 == 0b000);
+		case DecodeFormat::Atomic:
+			return funct3 == 0b010;
 		default:
-			return onlyOpCodeAndFunct3;
+			return false;
 	}
 }
 
-static InstructionType GetInstructionType(const uint32_t opcode, const uint32_t funct3, const uint32_t funct7OrImmediate)
+//only the shift amount is kept of the immediate of slli, srli and srai
+static constexpr bool IsShiftImmediate(const uint32_t opcode, const uint32_t funct3)
 {
-	const uint16_t instructionIdentifier = static_cast<uint16_t>((opcode            <<  0) |
-																 (funct3            <<  7) |
-																 (funct7OrImmediate << 10));
-	const uint16_t mask = GetInstructionIdentifierMask(instructionIdentifier);
-
-	const uint16_t instructionType = instructionIdentifier & mask;
-	return static_cast<InstructionType>(instructionType);
+	return opcode == 0b0010011 && (funct3 == 0b001 || funct3 == 0b101);
 }
 
-static Instruction DecodeRType(const uint32_t rawInstruction)
-{
-	RType rType(rawInstruction);
-	Instruction decoded;
-	decoded.rd   = rType.rd.GetAsInt();
-	decoded.rs1  = rType.rs1.GetAsInt();
-	decoded.rs2  = rType.rs2.GetAsInt();
-	decoded.type = GetInstructionType(rType.opcode.GetAsInt(), rType.funct3.GetAsInt(), rType.funct7.GetAsInt());
+static constexpr uint32_t SRET_TYPE = static_cast<uint32_t>(InstructionType::sret);
+static constexpr uint32_t WFI_TYPE = static_cast<uint32_t>(InstructionType::wfi);
 
-	return decoded;
+static constexpr uint32_t CountFunct7Groups()
+{
+	uint32_t count = 0;
+	for (uint32_t key = 0; key < 1024; key++)
+	{
+		count += UsesFunct7(key & 127, key >> 7) ? 1 : 0;
+	}
+	return count;
 }
 
-static Instruction DecodeIType(const uint32_t rawInstruction)
+//a handler with this bit set is the group of the funct7 table to look in
+static constexpr uint32_t FUNCT7_GROUP = 0x80;
+static constexpr uint32_t FUNCT7_GROUP_COUNT = CountFunct7Groups();
+static_assert(INSTRUCTION_TYPE_COUNT <= FUNCT7_GROUP && FUNCT7_GROUP_COUNT <= FUNCT7_GROUP, "Instruction types and groups have to fit in 7 bits");
+
+//The byte tables have 3 bytes more than they need as AVX2 gathers 4 bytes
+//at a time. Keys are funct3 << 7 | opcode, or group << 7 | funct7.
+struct DecodeTables
 {
-	const IType iType(rawInstruction);
+	uint8_t formats[128 + 3];
+	//the instruction type, or FUNCT7_GROUP | group
+	uint8_t handlers[1024 + 3];
+	uint8_t funct7Handlers[FUNCT7_GROUP_COUNT * 128 + 3];
+	int32_t immediateMasks[1024];
+	//by format, all ones when the format has the field
+	int32_t rdMasks[FORMAT_COUNT];
+	int32_t rs1Masks[FORMAT_COUNT];
+	int32_t rs2Masks[FORMAT_COUNT];
+};
 
-	Instruction decoded = { 0 };
-	decoded.rd         = iType.rd.GetAsInt();
-	decoded.rs1        = iType.rs1.GetAsInt();
-	decoded.immediate  = SignExtend<12>(iType.immediate.GetAsInt());
-	decoded.type       = GetInstructionType(iType.opcode.GetAsInt(), iType.funct3.GetAsInt(), iType.immediate.GetAsInt() >> 5);
-	decoded.immediate &= GetImmediateMask((iType.funct3.GetAsInt() << 7) | iType.opcode.GetAsInt());
+//The tables are made by putting together the identifier of every key, with
+//the parts the format doesn't use left out, and finding the type that has it.
+static constexpr DecodeTables CreateDecodeTables()
+{
+	DecodeTables tables = {};
+	uint32_t groupCount = 0;
+	for (uint32_t key = 0; key < 1024; key++)
+	{
+		const uint32_t opcode = key & 127;
+		const uint32_t funct3 = key >> 7;
+		const DecodeFormat format = GetDecodeFormat(opcode);
+		tables.immediateMasks[key] = IsShiftImmediate(opcode, funct3) ? 0b11111 : -1;
+		if (format == DecodeFormat::Invalid)
+		{
+			continue;
+		}
+		const bool hasFunct3 = format != DecodeFormat::U && format != DecodeFormat::UJ;
+		const uint32_t identifier = opcode | ((hasFunct3 ? funct3 : 0) << 7);
+		if (!UsesFunct7(opcode, funct3))
+		{
+			tables.handlers[key] = static_cast<uint8_t>(InstructionTypeFromIdentifier(identifier));
+			continue;
+		}
 
-	return decoded;
+		tables.handlers[key] = static_cast<uint8_t>(FUNCT7_GROUP | groupCount);
+		for (uint32_t funct7 = 0; funct7 < 128; funct7++)
+		{
+			const uint32_t typeBits = (format == DecodeFormat::Atomic) ? (funct7 >> 2) : funct7;
+			tables.funct7Handlers[(groupCount << 7) | funct7] = static_cast<uint8_t>(InstructionTypeFromIdentifier((identifier | (typeBits << 10)) & 0xffff));
+		}
+		groupCount++;
+	}
+	for (uint32_t opcode = 0; opcode < 128; opcode++)
+	{
+		tables.formats[opcode] = static_cast<uint8_t>(GetDecodeFormat(opcode));
+	}
+	for (uint32_t format = 0; format < FORMAT_COUNT; format++)
+	{
+		const DecodeFormat f = static_cast<DecodeFormat>(format);
+		const bool twoSources = f == DecodeFormat::R || f == DecodeFormat::Atomic || f == DecodeFormat::S || f == DecodeFormat::SB;
+		tables.rdMasks[format] = (f == DecodeFormat::R || f == DecodeFormat::Atomic || f == DecodeFormat::I || f == DecodeFormat::UJ || f == DecodeFormat::U) ? -1 : 0;
+		tables.rs1Masks[format] = (twoSources || f == DecodeFormat::I) ? -1 : 0;
+		tables.rs2Masks[format] = twoSources ? -1 : 0;
+	}
+	return tables;
 }
 
-static Instruction DecodeSType(const uint32_t rawInstruction)
-{
-	const SType sType(rawInstruction);
-	Instruction decoded = { 0 };
-	decoded.rs1 = sType.rs1.GetAsInt();
-	decoded.rs2 = sType.rs2.GetAsInt();
-	decoded.immediate = sType.GetImmediate();
-	decoded.type = GetInstructionType(sType.opcode.GetAsInt(), sType.funct3.GetAsInt(), 0);
+static constexpr DecodeTables DECODE_TABLES = CreateDecodeTables();
 
-	return decoded;
+//the immediates of every format put together straight from the word
+static constexpr int32_t GetIImmediate(const uint32_t word)
+{
+	return static_cast<int32_t>(word) >> 20;
 }
 
-static Instruction DecodeSBType(const uint32_t rawInstruction)
+static constexpr int32_t GetSImmediate(const uint32_t word)
 {
-	const SBType sbType(rawInstruction);
-	Instruction decoded = { 0 };
-	decoded.rs1 = sbType.rs1.GetAsInt();
-	decoded.rs2 = sbType.rs2.GetAsInt();
-	decoded.immediate = sbType.GetImmediate();
-	decoded.type = GetInstructionType(sbType.opcode.GetAsInt(), sbType.funct3.GetAsInt(), 0);
+	return ((static_cast<int32_t>(word) >> 20) & ~0x1f) | ((word >> 7) & 0x1f);
+}
 
-	return decoded;
+static constexpr int32_t GetSBImmediate(const uint32_t word)
+{
+	return ((static_cast<int32_t>(word) >> 19) & ~0xfff) | ((word << 4) & 0x800) | ((word >> 20) & 0x7e0) | ((word >> 7) & 0x1e);
 }
 
-static Instruction DecodeUJType(const uint32_t rawInstruction)
+static constexpr int32_t GetUJImmediate(const uint32_t word)
 {
-	const UJType ujType(rawInstruction);
-	Instruction decoded = { 0 };
-	decoded.rd = ujType.rd.GetAsInt();
-	decoded.immediate = ujType.GetImmediate();
-	decoded.type = GetInstructionType(ujType.opcode.GetAsInt(), 0, 0);
+	return ((static_cast<int32_t>(word) >> 11) & ~0xfffff) | (word & 0xff000) | ((word >> 9) & 0x800) | ((word >> 20) & 0x7fe);
+}
 
-	return decoded;
+static constexpr int32_t GetUImmediate(const uint32_t word)
+{
+	return static_cast<int32_t>(word & 0xfffff000);
 }
 
-static Instruction DecodeUType(const uint32_t rawInstruction)
+//a word with an invalid opcode decodes to 0
+static Instruction DecodeWithTables(const uint32_t word)
 {
-	const UType uType(rawInstruction);
-	Instruction decoded = { 0 };
-	decoded.rd = uType.rd.GetAsInt();
-	decoded.immediate = uType.GetImmediate();
-	decoded.type = GetInstructionType(uType.opcode.GetAsInt(), 0, 0);
+	const uint32_t opcode = word & 127;
+	const uint32_t funct3 = (word >> 12) & 0b111;
+	const uint32_t funct7 = word >> 25;
+	const uint32_t rs2 = (word >> 20) & 0b11111;
+	const uint32_t format = DECODE_TABLES.formats[opcode];
+	const uint32_t key = (funct3 << 7) | opcode;
+
+	const uint32_t handler = DECODE_TABLES.handlers[key];
+	const bool isGroup = (handler & FUNCT7_GROUP) != 0;
+	uint32_t type = isGroup ? DECODE_TABLES.funct7Handlers[((handler & ~FUNCT7_GROUP) << 7) | funct7] : handler;
+	//sret and wfi only differ in what would be rs2 in an r type
+	type = (type == SRET_TYPE && rs2 == 0b00101) ? WFI_TYPE : type;
+
+	const int32_t immediates[FORMAT_COUNT] = {
+		0,
+		0,
+		//the aq and rl bits of an atomic
+		static_cast<int32_t>(funct7 & 0b11),
+		GetIImmediate(word) & DECODE_TABLES.immediateMasks[key],
+		GetSImmediate(word),
+		GetSBImmediate(word),
+		GetUJImmediate(word),
+		GetUImmediate(word)
+	};
 
+	Instruction decoded;
+	decoded.immediate = immediates[format];
+	decoded.type = static_cast<InstructionType>(type);
+	decoded.rd = static_cast<uint8_t>(((word >> 7) & 0b11111) & DECODE_TABLES.rdMasks[format]);
+	decoded.rs1 = static_cast<uint8_t>(((word >> 15) & 0b11111) & DECODE_TABLES.rs1Masks[format]);
+	decoded.rs2 = static_cast<uint8_t>(rs2 & DECODE_TABLES.rs2Masks[format]);
 	return decoded;
 }
 
@@ -131,42 +233,221 @@ Instruction DecodeInstruction(const uint32_t rawInstruction)
 {
 	//opcode is the first 7 bits
 	const uint32_t opcode = rawInstruction & 127;
+	if (DECODE_TABLES.formats[opcode] == static_cast<uint8_t>(DecodeFormat::Invalid))
+	{
+		throw std::runtime_error("Invalid opcode. opcode: " + std::to_string(opcode));
+	}
+	return DecodeWithTables(rawInstruction);
+}
 
-	switch (opcode)
+bool IsDecodeAVX2Supported()
+{
+#if defined(DECODE_HAS_AVX2) && defined(__GNUC__)
+	return __builtin_cpu_supports("avx2");
+#elif defined(DECODE_HAS_AVX2)
+	int info[4];
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	return false;
+#endif
+}
+
+#ifdef DECODE_HAS_AVX2
+
+//gathers the bytes of table at indices
+AVX2_TARGET static __m256i GatherBytes(const uint8_t* table, const __m256i indices)
+{
+	return _mm256_and_si256(_mm256_i32gather_epi32(reinterpret_cast<const int*>(table), indices, 1), _mm256_set1_epi32(0xff));
+}
+
+//Decodes 8 words at a time the same way as DecodeWithTables. Every field
+//and every immediate format is taken out of all 8 words with shifts and
+//masks, the handlers and masks are gathered from the tables and each lane
+//then keeps the immediate of its own format. AVX2 can't scatter, so the
+//lanes are written to the instructions one by one.
+//Returns the index of the first word that isn't an instruction when not
+//lenient, or end when every word was decoded.
+AVX2_TARGET static size_t DecodeRangeAVX2(const uint32_t* rawInstructions, Instruction* decoded, const size_t begin, const size_t end, const bool lenient)
+{
+	const __m256i fields5 = _mm256_set1_epi32(0b11111);
+
+	size_t i = begin;
+	for (; i + 8 <= end; i += 8)
 	{
-		case 0b0000011:
-		case 0b0001111:
-		case 0b0010011:
-		case 0b1100111:
-		case 0b1110011:
-			return DecodeIType(rawInstruction);
-		case 0b0010111:
-		case 0b0110111:
-			return DecodeUType(rawInstruction);
-		case 0b0100011:
-			return DecodeSType(rawInstruction);
-		case 0b0110011:
-			return DecodeRType(rawInstruction);
-		case 0b1100011:
-			return DecodeSBType(rawInstruction);
-		case 0b1101111:
-			return DecodeUJType(rawInstruction);
-		default:
-			throw std::runtime_error("Invalid opcode. opcode: " + std::to_string(opcode));
+		const __m256i word = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rawInstructions + i));
+		const __m256i opcode = _mm256_and_si256(word, _mm256_set1_epi32(0x7f));
+		const __m256i funct3 = _mm256_and_si256(_mm256_srli_epi32(word, 12), _mm256_set1_epi32(0b111));
+		const __m256i funct7 = _mm256_srli_epi32(word, 25);
+		const __m256i rd = _mm256_and_si256(_mm256_srli_epi32(word, 7), fields5);
+		const __m256i rs1 = _mm256_and_si256(_mm256_srli_epi32(word, 15), fields5);
+		const __m256i rs2 = _mm256_and_si256(_mm256_srli_epi32(word, 20), fields5);
+		const __m256i format = GatherBytes(DECODE_TABLES.formats, opcode);
+		const __m256i key = _mm256_or_si256(_mm256_slli_epi32(funct3, 7), opcode);
+
+		const __m256i isInvalid = _mm256_cmpeq_epi32(format, _mm256_set1_epi32(static_cast<int32_t>(DecodeFormat::Invalid)));
+		const int invalidLanes = _mm256_movemask_ps(_mm256_castsi256_ps(isInvalid));
+		if (invalidLanes != 0 && !lenient)
+		{
+			uint32_t lane = 0;
+			while ((invalidLanes & (1 << lane)) == 0)
+			{
+				lane++;
+			}
+			return i + lane;
+		}
+
+		const __m256i handler = GatherBytes(DECODE_TABLES.handlers, key);
+		const __m256i isGroup = _mm256_cmpgt_epi32(handler, _mm256_set1_epi32(FUNCT7_GROUP - 1));
+		//lanes without a group look at index 0 so they stay inside the table
+		const __m256i groupKey = _mm256_and_si256(isGroup,
+			_mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(handler, _mm256_set1_epi32(FUNCT7_GROUP - 1)), 7), funct7));
+		__m256i type = _mm256_blendv_epi8(handler, GatherBytes(DECODE_TABLES.funct7Handlers, groupKey), isGroup);
+		//sret and wfi only differ in what would be rs2 in an r type
+		const __m256i isWFI = _mm256_and_si256(_mm256_cmpeq_epi32(type, _mm256_set1_epi32(SRET_TYPE)), _mm256_cmpeq_epi32(rs2, _mm256_set1_epi32(0b00101)));
+		type = _mm256_blendv_epi8(type, _mm256_set1_epi32(WFI_TYPE), isWFI);
+
+		const __m256i signedWord20 = _mm256_srai_epi32(word, 20);
+		const __m256i immediateI = _mm256_and_si256(signedWord20, _mm256_i32gather_epi32(DECODE_TABLES.immediateMasks, key, 4));
+		const __m256i immediateS = _mm256_or_si256(_mm256_andnot_si256(fields5, signedWord20), rd);
+		const __m256i immediateSB = _mm256_or_si256(
+			_mm256_or_si256(_mm256_andnot_si256(_mm256_set1_epi32(0xfff), _mm256_srai_epi32(word, 19)), _mm256_and_si256(_mm256_slli_epi32(word, 4), _mm256_set1_epi32(0x800))),
+			_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(word, 20), _mm256_set1_epi32(0x7e0)), _mm256_and_si256(_mm256_srli_epi32(word, 7), _mm256_set1_epi32(0x1e))));
+		const __m256i immediateUJ = _mm256_or_si256(
+			_mm256_or_si256(_mm256_andnot_si256(_mm256_set1_epi32(0xfffff), _mm256_srai_epi32(word, 11)), _mm256_and_si256(word, _mm256_set1_epi32(0xff000))),
+			_mm256_or_si256(_mm256_and_si256(_mm256_srli_epi32(word, 9), _mm256_set1_epi32(0x800)), _mm256_and_si256(_mm256_srli_epi32(word, 20), _mm256_set1_epi32(0x7fe))));
+		const __m256i immediateU = _mm256_and_si256(word, _mm256_set1_epi32(static_cast<int32_t>(0xfffff000)));
+
+		const __m256i isAtomic = _mm256_cmpeq_epi32(format, _mm256_set1_epi32(static_cast<int32_t>(DecodeFormat::Atomic)));
+		__m256i immediate = _mm256_and_si256(isAtomic, _mm256_and_si256(funct7, _mm256_set1_epi32(0b11)));
+		immediate = _mm256_blendv_epi8(immediate, immediateI, _mm256_cmpeq_epi32(format, _mm256_set1_epi32(static_cast<int32_t>(DecodeFormat::I))));
+		immediate = _mm256_blendv_epi8(immediate, immediateS, _mm256_cmpeq_epi32(format, _mm256_set1_epi32(static_cast<int32_t>(DecodeFormat::S))));
+		immediate = _mm256_blendv_epi8(immediate, immediateSB, _mm256_cmpeq_epi32(format, _mm256_set1_epi32(static_cast<int32_t>(DecodeFormat::SB))));
+		immediate = _mm256_blendv_epi8(immediate, immediateUJ, _mm256_cmpeq_epi32(format, _mm256_set1_epi32(static_cast<int32_t>(DecodeFormat::UJ))));
+		immediate = _mm256_blendv_epi8(immediate, immediateU, _mm256_cmpeq_epi32(format, _mm256_set1_epi32(static_cast<int32_t>(DecodeFormat::U))));
+
+		alignas(32) int32_t immediates[8];
+		alignas(32) uint32_t types[8];
+		alignas(32) uint32_t rds[8];
+		alignas(32) uint32_t rs1s[8];
+		alignas(32) uint32_t rs2s[8];
+		_mm256_store_si256(reinterpret_cast<__m256i*>(immediates), immediate);
+		_mm256_store_si256(reinterpret_cast<__m256i*>(types), type);
+		_mm256_store_si256(reinterpret_cast<__m256i*>(rds), _mm256_and_si256(rd, _mm256_i32gather_epi32(DECODE_TABLES.rdMasks, format, 4)));
+		_mm256_store_si256(reinterpret_cast<__m256i*>(rs1s), _mm256_and_si256(rs1, _mm256_i32gather_epi32(DECODE_TABLES.rs1Masks, format, 4)));
+		_mm256_store_si256(reinterpret_cast<__m256i*>(rs2s), _mm256_and_si256(rs2, _mm256_i32gather_epi32(DECODE_TABLES.rs2Masks, format, 4)));
+		for (uint32_t lane = 0; lane < 8; lane++)
+		{
+			Instruction& instruction = decoded[i + lane];
+			instruction.immediate = immediates[lane];
+			instruction.type = static_cast<InstructionType>(types[lane]);
+			instruction.rd = static_cast<uint8_t>(rds[lane]);
+			instruction.rs1 = static_cast<uint8_t>(rs1s[lane]);
+			instruction.rs2 = static_cast<uint8_t>(rs2s[lane]);
+		}
+	}
+
+	for (; i < end; i++)
+	{
+		if (DECODE_TABLES.formats[rawInstructions[i] & 127] == static_cast<uint8_t>(DecodeFormat::Invalid) && !lenient)
+		{
+			return i;
+		}
+		decoded[i] = DecodeWithTables(rawInstructions[i]);
 	}
+	return end;
 }
 
-std::unique_ptr<std::vector<Instruction>> DecodeInstructions(const uint32_t* rawInstructions, const size_t instructionsCount)
+#endif
+
+static size_t DecodeRange(const uint32_t* rawInstructions, Instruction* decoded, const size_t begin, const size_t end, const bool lenient, const bool useAVX2)
 {
-	std::unique_ptr<std::vector<Instruction>> instructions = std::make_unique<std::vector<Instruction>>();
+#ifdef DECODE_HAS_AVX2
+	if (useAVX2)
+	{
+		return DecodeRangeAVX2(rawInstructions, decoded, begin, end, lenient);
+	}
+#endif
+	for (size_t i = begin; i < end; i++)
+	{
+		if (DECODE_TABLES.formats[rawInstructions[i] & 127] == static_cast<uint8_t>(DecodeFormat::Invalid) && !lenient)
+		{
+			return i;
+		}
+		decoded[i] = DecodeWithTables(rawInstructions[i]);
+	}
+	return end;
+}
 
-	for (size_t i = 0; i < instructionsCount; i++)
+BulkDecodeOptions GetDefaultDecodeOptions(const bool lenient)
+{
+	return { lenient, IsDecodeAVX2Supported(), 1 };
+}
+
+//fewer words than this per thread cost more to start than they save
+static const size_t MIN_WORDS_PER_THREAD = 1 << 18;
+
+void DecodeBulk(const uint32_t* rawInstructions, const size_t instructionsCount, Instruction* decoded, const BulkDecodeOptions& options)
+{
+	const bool useAVX2 = options.useAVX2 && IsDecodeAVX2Supported();
+	size_t threadCount = (options.threadCount == 0) ? std::max(1u, std::thread::hardware_concurrency()) : options.threadCount;
+	threadCount = std::min(threadCount, std::max<size_t>(1, instructionsCount / MIN_WORDS_PER_THREAD));
+
+	//every thread reports the first word it couldn't decode,
+	//so the error is about the same word as the scalar decoder's
+	std::vector<size_t> ends(threadCount);
+	std::vector<size_t> invalids(threadCount);
+	std::vector<std::thread> threads;
+	//chunks are a multiple of 8 words so only the last one has a tail
+	const size_t chunkSize = ((instructionsCount / threadCount) + 7) & ~static_cast<size_t>(7);
+	for (size_t t = 0; t < threadCount; t++)
+	{
+		const size_t begin = std::min(instructionsCount, t * chunkSize);
+		ends[t] = (t + 1 == threadCount) ? instructionsCount : std::min(instructionsCount, begin + chunkSize);
+		if (t + 1 == threadCount)
+		{
+			invalids[t] = DecodeRange(rawInstructions, decoded, begin, ends[t], options.lenient, useAVX2);
+		}
+		else
+		{
+			threads.emplace_back([&, t, begin]()
+			{
+				invalids[t] = DecodeRange(rawInstructions, decoded, begin, ends[t], options.lenient, useAVX2);
+			});
+		}
+	}
+	for (std::thread& thread : threads)
 	{
-		const uint32_t rawInstruction = rawInstructions[i];
-		const Instruction instruction = DecodeInstruction(rawInstruction);
-		instructions->push_back(instruction);
+		thread.join();
 	}
 
+	for (size_t t = 0; t < threadCount; t++)
+	{
+		if (invalids[t] != ends[t])
+		{
+			throw std::runtime_error("Invalid opcode. opcode: " + std::to_string(rawInstructions[invalids[t]] & 127));
+		}
+	}
+}
+
+std::unique_ptr<std::vector<Instruction>> DecodeInstructions(const uint32_t* rawInstructions, const size_t instructionsCount, const uint32_t threadCount)
+{
+	std::unique_ptr<std::vector<Instruction>> instructions = std::make_unique<std::vector<Instruction>>(instructionsCount);
+	BulkDecodeOptions options = GetDefaultDecodeOptions(false);
+	options.threadCount = threadCount;
+	DecodeBulk(rawInstructions, instructionsCount, instructions->data(), options);
+
+	return instructions;
+}
+
+std::unique_ptr<std::vector<Instruction>> DecodeCodeSegment(const uint32_t* rawInstructions, const size_t instructionsCount, const uint32_t threadCount)
+{
+	//no instruction type is 0, so running a word that isn't an instruction fails
+	std::unique_ptr<std::vector<Instruction>> instructions = std::make_unique<std::vector<Instruction>>(instructionsCount);
+	BulkDecodeOptions options = GetDefaultDecodeOptions(true);
+	options.threadCount = threadCount;
+	DecodeBulk(rawInstructions, instructionsCount, instructions->data(), options);
+
 	return instructions;
 }
 
@@ -180,4 +461,4 @@ std::string GetProgramAsString(const uint32_t* rawInstructions, const size_t ins
 	}
 
 	return program;
-}
\ No newline at end of file
+}
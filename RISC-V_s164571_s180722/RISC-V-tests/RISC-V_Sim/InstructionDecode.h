@@ -7,5 +7,30 @@
 #include "Instruction.h"
 
 Instruction DecodeInstruction(const uint32_t rawInstruction);
-std::unique_ptr<std::vector<Instruction>> DecodeInstructions(const uint32_t* rawInstructions, const size_t instructionsCount);
+
+struct BulkDecodeOptions
+{
+	//decode words that aren't instructions like DecodeCodeSegment does instead of failing
+	bool lenient;
+	bool useAVX2;
+	//0 uses a thread per host core
+	uint32_t threadCount;
+};
+//AVX2 when the host has it, on the calling thread
+BulkDecodeOptions GetDefaultDecodeOptions(const bool lenient);
+bool IsDecodeAVX2Supported();
+//Decodes instructionsCount words into decoded, which has room for all of them,
+//giving the same instructions as DecodeInstruction does one word at a time.
+//The fields of 8 words at a time are taken apart with AVX2 when it's used and
+//the instruction types are found through tables, and a large image is split
+//between threads with at least a quarter of a million words each.
+void DecodeBulk(const uint32_t* rawInstructions, const size_t instructionsCount, Instruction* decoded, const BulkDecodeOptions& options);
+//decodes on the calling thread unless threadCount says otherwise, 0 for
+//a thread per core, so a server or library decoding for many programs
+//at once doesn't start threads for each of them
+std::unique_ptr<std::vector<Instruction>> DecodeInstructions(const uint32_t* rawInstructions, const size_t instructionsCount, const uint32_t threadCount = 1);
+//like DecodeInstructions, but words that aren't instructions, like the headers
+//and constants an elf file keeps next to its code, are decoded to an instruction
+//that fails when it's run instead of failing the whole decode
+std::unique_ptr<std::vector<Instruction>> DecodeCodeSegment(const uint32_t* rawInstructions, const size_t instructionsCount, const uint32_t threadCount = 1);
 std::string GetProgramAsString(const uint32_t* rawInstructions, const size_t instructionCount);
\ No newline at end of file
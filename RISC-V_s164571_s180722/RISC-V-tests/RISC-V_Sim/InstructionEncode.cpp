@@ -21,6 +21,20 @@ static uint32_t EncodeRType(const InstructionType type, const Regs rd, const Reg
 	return rType.ToRawInstruction();
 }
 
+//funct7 is funct5 followed by the aq and rl bits
+static uint32_t EncodeAtomicType(const InstructionType type, const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering)
+{
+	RType rType;
+	rType.opcode.FromInt(InstructionTypeGetOpCode(type));
+	rType.rd    .FromInt(static_cast<uint32_t>(rd));
+	rType.funct3.FromInt(InstructionTypeFunct3(type));
+	rType.rs1   .FromInt(static_cast<uint32_t>(rs1));
+	rType.rs2   .FromInt(static_cast<uint32_t>(rs2));
+	rType.funct7.FromInt((InstructionTypeFunct7(type) << 2) | static_cast<uint32_t>(ordering));
+
+	return rType.ToRawInstruction();
+}
+
 static uint32_t EncodeIType(const InstructionType type, const Regs rd, const Regs rs1, const uint32_t immediate)
 {
 	IType iType;
@@ -115,13 +129,14 @@ uint32_t Create_lhu(const Regs rd, const Regs rs1, const uint32_t immediate)
 	VerifyRange(-2048, 4095, immediate);
 	return EncodeIType(InstructionType::lhu, rd, rs1, immediate);
 }
+//orders every kind of access before it with every kind after it
 uint32_t Create_fence()
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	return EncodeIType(InstructionType::fence, Regs::x0, Regs::x0, 0b0000'1111'1111);
 }
 uint32_t Create_fence_i()
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	return EncodeIType(InstructionType::fence_i, Regs::x0, Regs::x0, 0);
 }
 uint32_t Create_addi(const Regs rd, const Regs rs1, const uint32_t immediate)
 {
@@ -281,29 +296,56 @@ uint32_t Create_ebreak()
 {
 	return EncodeIType(InstructionType::ebreak, Regs::x0, Regs::x0, 0);
 }
-uint32_t Create_csrrw()
+uint32_t Create_csrrw(const Regs rd, const Regs rs1, const uint32_t csr)
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	VerifyRange(0, 4095, csr);
+	return EncodeIType(InstructionType::csrrw, rd, rs1, csr);
 }
-uint32_t Create_csrrs()
+uint32_t Create_csrrs(const Regs rd, const Regs rs1, const uint32_t csr)
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	VerifyRange(0, 4095, csr);
+	return EncodeIType(InstructionType::csrrs, rd, rs1, csr);
+}
+uint32_t Create_csrrc(const Regs rd, const Regs rs1, const uint32_t csr)
+{
+	VerifyRange(0, 4095, csr);
+	return EncodeIType(InstructionType::csrrc, rd, rs1, csr);
+}
+uint32_t Create_csrrwi(const Regs rd, const uint32_t immediate, const uint32_t csr)
+{
+	VerifyRange(0, 31, immediate);
+	VerifyRange(0, 4095, csr);
+	return EncodeIType(InstructionType::csrrwi, rd, static_cast<Regs>(immediate), csr);
+}
+uint32_t Create_csrrsi(const Regs rd, const uint32_t immediate, const uint32_t csr)
+{
+	VerifyRange(0, 31, immediate);
+	VerifyRange(0, 4095, csr);
+	return EncodeIType(InstructionType::csrrsi, rd, static_cast<Regs>(immediate), csr);
+}
+uint32_t Create_csrrci(const Regs rd, const uint32_t immediate, const uint32_t csr)
+{
+	VerifyRange(0, 31, immediate);
+	VerifyRange(0, 4095, csr);
+	return EncodeIType(InstructionType::csrrci, rd, static_cast<Regs>(immediate), csr);
 }
-uint32_t Create_csrrc()
+uint32_t Create_sret()
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	//the low bits of the immediate is the rs2 field which is 2 for xret
+	return EncodeIType(InstructionType::sret, Regs::x0, Regs::x0, 2);
 }
-uint32_t Create_csrrwi()
+uint32_t Create_mret()
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	return EncodeIType(InstructionType::mret, Regs::x0, Regs::x0, 2);
 }
-uint32_t Create_csrrsi()
+uint32_t Create_wfi()
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	//the wfi identifier isn't a real encoding, see InstructionType
+	return EncodeIType(InstructionType::sret, Regs::x0, Regs::x0, 5);
 }
-uint32_t Create_csrrci()
+uint32_t Create_sfence_vma(const Regs rs1, const Regs rs2)
 {
-	throw std::runtime_error("Instruction encoding not implemented for this instruction.");
+	return EncodeIType(InstructionType::sfence_vma, Regs::x0, rs1, static_cast<uint32_t>(rs2));
 }
 uint32_t Create_mul(const Regs rd, const Regs rs1, const Regs rs2)
 {
@@ -337,6 +379,50 @@ uint32_t Create_remu(const Regs rd, const Regs rs1, const Regs rs2)
 {
 	return EncodeRType(InstructionType::remu, rd, rs1, rs2);
 }
+uint32_t Create_lr_w(const Regs rd, const Regs rs1, const AtomicOrdering ordering)
+{
+	return EncodeAtomicType(InstructionType::lr_w, rd, rs1, Regs::x0, ordering);
+}
+uint32_t Create_sc_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering)
+{
+	return EncodeAtomicType(InstructionType::sc_w, rd, rs1, rs2, ordering);
+}
+uint32_t Create_amoswap_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering)
+{
+	return EncodeAtomicType(InstructionType::amoswap_w, rd, rs1, rs2, ordering);
+}
+uint32_t Create_amoadd_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering)
+{
+	return EncodeAtomicType(InstructionType::amoadd_w, rd, rs1, rs2, ordering);
+}
+uint32_t Create_amoxor_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering)
+{
+	return EncodeAtomicType(InstructionType::amoxor_w, rd, rs1, rs2, ordering);
+}
+uint32_t Create_amoand_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering)
+{
+	return EncodeAtomicType(InstructionType::amoand_w, rd, rs1, rs2, ordering);
+}
+uint32_t Create_amoor_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering)
+{
+	return EncodeAtomicType(InstructionType::amoor_w, rd, rs1, rs2, ordering);
+}
+uint32_t Create_amomin_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering)
+{
+	return EncodeAtomicType(InstructionType::amomin_w, rd, rs1, rs2, ordering);
+}
+uint32_t Create_amomax_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering)
+{
+	return EncodeAtomicType(InstructionType::amomax_w, rd, rs1, rs2, ordering);
+}
+uint32_t Create_amominu_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering)
+{
+	return EncodeAtomicType(InstructionType::amominu_w, rd, rs1, rs2, ordering);
+}
+uint32_t Create_amomaxu_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering)
+{
+	return EncodeAtomicType(InstructionType::amomaxu_w, rd, rs1, rs2, ordering);
+}
 
 MultiInstruction Create_li(const Regs rd, const uint32_t immediate)
 {
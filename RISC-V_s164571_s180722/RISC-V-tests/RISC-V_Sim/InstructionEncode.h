@@ -9,6 +9,15 @@ struct MultiInstruction
 	uint32_t instruction2;
 };
 
+//the aq and rl bits of atomic instructions
+enum class AtomicOrdering : uint32_t
+{
+	None           = 0b00,
+	Release        = 0b01,
+	Acquire        = 0b10,
+	AcquireRelease = 0b11
+};
+
 uint32_t Create_lb(const Regs rd, const Regs rs1, const uint32_t immediate);
 uint32_t Create_lh(const Regs rd, const Regs rs1, const uint32_t immediate);
 uint32_t Create_lw(const Regs rd, const Regs rs1, const uint32_t immediate);
@@ -50,12 +59,16 @@ uint32_t Create_jalr(const Regs rd, const Regs rs1, const uint32_t immediate);
 uint32_t Create_jal(const Regs rd, const uint32_t immediate);
 uint32_t Create_ecall();
 uint32_t Create_ebreak();
-uint32_t Create_csrrw();
-uint32_t Create_csrrs();
-uint32_t Create_csrrc();
-uint32_t Create_csrrwi();
-uint32_t Create_csrrsi();
-uint32_t Create_csrrci();
+uint32_t Create_csrrw(const Regs rd, const Regs rs1, const uint32_t csr);
+uint32_t Create_csrrs(const Regs rd, const Regs rs1, const uint32_t csr);
+uint32_t Create_csrrc(const Regs rd, const Regs rs1, const uint32_t csr);
+uint32_t Create_csrrwi(const Regs rd, const uint32_t immediate, const uint32_t csr);
+uint32_t Create_csrrsi(const Regs rd, const uint32_t immediate, const uint32_t csr);
+uint32_t Create_csrrci(const Regs rd, const uint32_t immediate, const uint32_t csr);
+uint32_t Create_sret();
+uint32_t Create_mret();
+uint32_t Create_wfi();
+uint32_t Create_sfence_vma(const Regs rs1, const Regs rs2);
 uint32_t Create_mul(const Regs rd, const Regs rs1, const Regs rs2);
 uint32_t Create_mulh(const Regs rd, const Regs rs1, const Regs rs2);
 uint32_t Create_mulhsu(const Regs rd, const Regs rs1, const Regs rs2);
@@ -64,4 +77,15 @@ uint32_t Create_div(const Regs rd, const Regs rs1, const Regs rs2);
 uint32_t Create_divu(const Regs rd, const Regs rs1, const Regs rs2);
 uint32_t Create_rem(const Regs rd, const Regs rs1, const Regs rs2);
 uint32_t Create_remu(const Regs rd, const Regs rs1, const Regs rs2);
+uint32_t Create_lr_w(const Regs rd, const Regs rs1, const AtomicOrdering ordering);
+uint32_t Create_sc_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering);
+uint32_t Create_amoswap_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering);
+uint32_t Create_amoadd_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering);
+uint32_t Create_amoxor_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering);
+uint32_t Create_amoand_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering);
+uint32_t Create_amoor_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering);
+uint32_t Create_amomin_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering);
+uint32_t Create_amomax_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering);
+uint32_t Create_amominu_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering);
+uint32_t Create_amomaxu_w(const Regs rd, const Regs rs1, const Regs rs2, const AtomicOrdering ordering);
 MultiInstruction Create_li(const Regs rd, const uint32_t immediate);
@@ -0,0 +1,9 @@
+addi s0 x0 100
+addi s1 x0 23
+addi a1 x0 200
+sw s0 0(a1)
+amoadd_w t0 s1 (a1)
+lw t1 0(a1)
+amoadd_w.aqrl t2 s1 (a1)
+addi a0 x0 10
+ecall
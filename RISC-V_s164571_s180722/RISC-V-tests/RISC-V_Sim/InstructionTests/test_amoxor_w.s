@@ -0,0 +1,9 @@
+addi s0 x0 12
+addi s1 x0 10
+addi a1 x0 200
+sw s0 0(a1)
+amoxor_w t0 s1 (a1)
+lw t1 0(a1)
+amoxor_w.aqrl t2 s1 (a1)
+addi a0 x0 10
+ecall
@@ -0,0 +1,7 @@
+addi a0 x0 255
+addi a1 x0 15
+csrrw x0 832 a0
+csrrc s0 832 a1
+csrrc s1 832 x0
+addi a0 x0 10
+ecall
@@ -0,0 +1,5 @@
+csrrwi x0 832 31
+csrrci s0 832 10
+csrrci s1 832 0
+addi a0 x0 10
+ecall
@@ -0,0 +1,9 @@
+addi a0 x0 10
+addi a1 x0 5
+csrrs x0 832 a0
+csrrs s0 832 a1
+csrrs s1 832 x0
+addi s2 x0 5
+csrrs s2 3860 x0
+addi a0 x0 10
+ecall
@@ -0,0 +1,5 @@
+csrrsi x0 832 17
+csrrsi s0 832 6
+csrrsi s1 832 0
+addi a0 x0 10
+ecall
@@ -0,0 +1,10 @@
+lui a0 74565
+addi a0 a0 1656
+csrrw x0 832 a0
+csrrw s0 832 x0
+csrrw s1 832 x0
+addi a1 x0 77
+csrrw x0 832 a1
+csrrw a1 832 a1
+addi a0 x0 10
+ecall
@@ -0,0 +1,5 @@
+csrrwi x0 832 27
+csrrwi s0 832 3
+csrrwi s1 832 0
+addi a0 x0 10
+ecall
@@ -0,0 +1,8 @@
+lui s0 74565
+addi s0 s0 1656
+addi a1 x0 200
+sw s0 0(a1)
+lr_w t0 (a1)
+lr_w.aq t1 (a1)
+addi a0 x0 10
+ecall
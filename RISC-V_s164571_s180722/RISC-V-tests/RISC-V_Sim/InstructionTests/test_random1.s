@@ -30,15 +30,15 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-xori tp t6 -900
-addi a4 t6 -962
-andi s7 a3 -51
-ori s3 s10 1351
-xor s1 t1 s10
-mulhsu t6 s5 s0
-sra tp s5 x0
-lui s7 132054
-divu t3 a0 t3
-sll s2 tp t1
+or t2 a6 s9
+lui a5 545944
+or s0 a4 t0
+div a2 a7 gp
+xor t2 x0 a2
+slli s1 x0 6
+mulhsu s5 a3 s5
+srl t0 s5 a5
+slli a2 s3 30
+srli s9 ra 3
 addi a0 x0 10
 ecall
@@ -30,10005 +30,10005 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-slli t6 s4 16
-add a1 s9 a7
-srai gp s0 21
-srai s6 t6 25
-mulhsu a0 ra x0
-srai s2 a2 10
-auipc a6 76504
-sltu s7 t1 a7
-srli t5 a2 14
-mul x0 s6 a2
-srai s2 t0 7
-srai s9 t1 6
-divu s9 a4 a0
-sltiu x0 ra -1948
-addi a6 a2 -1852
-mul s5 t5 ra
-mulhsu a4 a4 t4
-mul s2 t1 t4
-ori s11 s4 -1589
-rem t3 tp s8
-sra a1 s3 s5
-ori a7 a3 1780
-divu s5 a1 a2
-auipc tp 474436
-slli ra s1 11
-mulh s7 a3 t5
-div t0 gp a7
-auipc a6 895475
-rem a2 s7 s0
-or t2 t1 s2
-srai s6 s2 2
-sltiu s5 a0 528
-srai t4 a4 19
-sra t0 a4 t4
-andi a7 a7 -2031
-xori s7 s4 -1601
-sltu t1 s1 s7
-sltu s6 s10 s2
-mulhsu t6 s10 s11
-or t6 t1 s6
-auipc s11 648380
-xori a1 t6 -327
-slti s7 a6 -396
-auipc x0 653434
-srl s10 a0 s2
-slt s7 a2 a1
-lui t4 921652
-xor ra gp a5
-divu s10 gp t6
-div ra t3 t2
-rem a5 s0 s3
-xori a1 t6 156
-and t1 a5 s3
-slli a6 a7 13
-srli a4 x0 6
-sra t2 a1 s0
-sll tp a4 a6
-andi s8 s6 -1541
-sub ra t1 t1
-mulhsu a4 a1 t4
-slti t3 s6 -104
-sll s4 gp a0
-sra s11 s1 x0
-xori t1 s0 -862
-div a7 s4 t4
-slti s4 a2 240
-divu tp x0 t6
-ori s4 s9 -983
-mul a1 s6 s5
-sra t1 ra s3
-div s8 t3 a5
-xori a0 s6 -1177
-sub t3 a1 t6
-srli s3 t1 2
-slti x0 a7 202
-andi a6 x0 -242
-mul tp a1 t4
-sll a5 a7 tp
-sltu a0 t4 a5
-or s8 s11 t0
-add s8 gp s7
-mulh a2 t0 s8
-and t0 gp x0
-divu s2 a7 a3
-sub s10 s8 t0
-div s3 t2 a1
-slti s7 gp -1162
-divu tp gp x0
-mulh t6 s9 a4
-and s9 a0 s0
-slti t3 x0 -1182
-ori a3 s2 -494
-ori a1 a4 1682
-slt t0 s6 a5
-mulhu s1 a4 ra
-add s11 s9 s1
-slt a4 tp t3
-sltu s2 t1 t4
-sll x0 s0 s1
-sltu s6 gp ra
-rem s11 t0 t6
-or s0 gp s8
-lui s3 217754
-addi t1 s10 455
-mul x0 a5 a5
-mulhsu a7 s4 a2
-slti t6 ra -1210
-ori s3 t1 -888
-addi t2 a2 -1445
-and s5 s2 a5
-xor gp s3 a6
-mulhsu s10 s4 s11
-divu t5 t4 s3
-sub s2 x0 t0
-mulhsu s9 a3 tp
-xor a4 s5 a0
-sll s5 a3 t4
-mulh a2 s4 s10
-addi tp s4 -290
-div s2 t0 a0
-addi a6 s10 280
-slt t4 a2 a7
-slt s0 ra a4
-mulhu s7 t6 t4
-sub x0 s11 t6
-slti t4 s6 -2025
-srl s1 t3 t6
-sltu s2 s9 s6
-sub s11 t3 a0
-addi a4 t4 -1257
-rem a5 s6 s8
-and a0 s0 x0
-mulh t5 s5 s0
-or s8 gp s1
-slti x0 s8 -1459
-add s0 a1 s6
-xor t6 s6 s11
-ori a5 t4 -984
-div s1 a1 s2
-rem a6 x0 a5
-mulh a4 tp s9
-mulh t5 s1 t5
-divu s6 t4 s1
-sub x0 tp t4
-xor s5 t5 a7
-slt s9 t2 a6
-or s5 s10 s4
-auipc tp 850037
-divu s8 t4 a2
-slti s0 s7 -690
-div a5 s4 s0
-slli t0 s4 1
-or s4 a5 s1
-slli x0 a0 13
-slt a7 s5 t4
-and a5 t5 s9
-sra x0 s0 t6
-srl s7 a0 s6
-srli t3 a6 11
-slli a4 s7 28
-sltu s10 t5 s4
-or t6 s10 t4
-srli a5 ra 11
-srli x0 s9 22
-and s3 a1 s9
-mulhu a1 x0 t5
-slt s11 s11 t6
-lui a1 444174
-sltu t1 a0 s3
-lui s8 746859
-auipc t5 749454
-addi s8 s3 -1633
-div s1 a5 x0
-rem t3 a3 a2
-addi s11 s5 -368
-xori t3 s7 1154
-sltu a0 t6 t2
-sra t5 t3 gp
-rem a0 s0 a3
-srli tp t3 20
-sll gp s11 t5
-remu a0 s10 tp
-lui t4 141989
-or x0 ra s11
-add s0 s0 x0
-xori t4 tp 987
-mul x0 s0 s10
-andi ra a7 -1565
-auipc a5 381642
-andi s8 t5 -451
-sltiu a1 a1 -1700
-sltu t5 t4 t2
-mul t3 t6 x0
-auipc t0 293966
-slti a5 s2 -1843
-sll a5 s6 a4
-slti t2 t4 1892
-slti a1 t4 -1707
-mulh t2 s4 t0
-slli tp x0 3
-sra a6 s6 gp
-xori t1 s4 -1282
-lui t6 811646
-sra t5 t6 s3
-div t0 a4 s4
-divu s3 gp tp
-srli t4 s7 7
-mulh s7 ra tp
-srli t6 s11 12
-xori t6 tp 1998
-slt a6 s10 s10
-remu s0 t1 s5
-srai s8 s4 21
-sltu x0 s8 a0
-div x0 s5 s6
-mulhsu t4 a7 s7
-srli s10 tp 22
-remu s1 x0 a2
-mul s9 s2 a4
-sub a2 t4 t4
-add t3 t2 tp
-divu a5 tp t3
-remu t6 s0 a2
-remu a6 s10 s8
-divu s4 x0 x0
-sub s8 t1 t1
-div a0 x0 a1
-sltu a2 s10 a5
-andi a2 tp -566
-slti t6 s8 -633
-sub x0 x0 a6
-srai a2 t5 23
-and ra s10 s0
-srli t6 s8 6
-srai t5 a2 15
-srai t5 s2 15
-sltu a7 s4 s4
-slt a2 a3 a6
-mul s1 t0 t4
-sltu t6 s9 a3
-sltu gp tp s8
-auipc t2 526060
-add a5 a7 s4
-srl s8 s3 s6
-sltu t0 x0 s10
-and a0 s3 a2
-divu s3 a0 a2
-slt s10 a4 a1
-srai t4 s2 25
-or ra s9 t3
-mulhsu s3 t6 a6
-div s1 s2 s0
-mulhu t2 s7 t3
-mulh a5 t4 s4
-slli s4 a1 13
-slt s5 t3 s8
-mulhu s8 s11 s4
-andi t6 tp 1380
-sltu s7 a1 s2
-slli s10 ra 1
-mulhsu a7 s9 a3
-sub t1 s1 t3
-add a6 t6 a4
-or t4 a7 s4
-slt t3 s3 s5
-slti s1 gp 164
-sll a1 t6 ra
-sll a4 t3 tp
-xor s4 x0 a0
-ori t4 s3 88
-sra ra tp a1
-slti a2 t2 1296
-andi s10 t1 -495
-divu s8 a7 tp
-mulhsu s5 a6 a6
-mulh t5 s3 t0
-divu s3 a0 t4
-slti t4 t5 1249
-auipc s5 91826
-lui ra 498608
-mulh t0 s6 s4
-auipc t0 720934
-and s4 s8 a5
-srai tp t4 12
-auipc a5 665334
-slt a5 s6 gp
-srai a5 a1 19
-add a4 s10 s6
-and x0 x0 t3
-mulh a1 a2 a6
-slti s8 t4 -183
-mul s11 s8 s4
-mulh t5 s5 s9
-slti a3 t5 -1048
-xor a1 s1 t6
-slti a6 s0 -1922
-mulhsu a2 a4 x0
-andi s3 s3 602
-mulh a1 s10 x0
-rem s6 x0 x0
-auipc x0 608689
-sltiu s7 s10 1057
-mul s11 t3 s4
-mul s8 a0 a1
-slt s9 a1 ra
-srli s1 a5 19
-sltu t1 s10 a3
-sltu s10 s3 s3
-sltu s10 a1 s2
-sra tp a3 s2
-sub t4 t3 t3
-slt t0 t3 s5
-andi a3 s4 -1810
-and ra s8 gp
-srl s9 ra t5
-addi a0 t6 -1204
-slt s10 s0 s3
-xori x0 s1 -388
-slli s1 gp 25
-sltiu x0 a3 -168
-sub a4 s7 s2
-and ra a4 s4
-mulhsu gp a7 t2
-divu x0 t2 t4
-addi t4 ra -788
-mulhu s3 a6 t1
-mulh a1 x0 t0
-slti t3 s2 -1632
-mulhu s8 t6 gp
-mulhu x0 s11 s9
-sll tp x0 t1
-or a7 t0 t6
-srl a1 s2 t0
-xori s3 s11 1279
-remu s10 s8 x0
-add a1 s7 x0
-srli a1 x0 22
-and s3 a7 t4
-sub a5 t5 t1
-xori x0 s10 534
-sltiu a6 a4 -405
-mulhsu s8 a1 t0
-slli tp s3 24
-and t3 t2 a0
-div s11 t1 s5
-addi s2 a2 -1343
-slti a7 gp -291
-slt s10 gp a2
-ori t6 a2 -1064
-mulhsu a5 s8 t5
-xor s3 a7 t5
-srai t6 s8 26
-sra s0 t2 x0
-sra t6 gp x0
-andi x0 t5 1769
-and tp a5 s10
-xor tp a6 s2
-div a0 s9 t1
-slti s3 t3 1074
-mulhu a1 s8 t4
-sub a6 a3 t0
-mul x0 s10 x0
-div t2 s9 tp
-xor gp t0 s4
-mul ra s8 s8
-srl a5 gp t2
-divu t2 s1 x0
-mulhsu a3 a3 s9
-rem s11 tp s3
-div a3 s3 a2
-mul gp s5 t2
-srli s3 s10 6
-srai s10 s8 23
-srai gp s4 21
-ori s6 s10 1934
-sltiu a3 s5 -263
-div t3 s0 a6
-srl x0 s7 s0
-add a7 gp t0
-and s2 a5 gp
-divu a6 t0 x0
-slli a2 ra 2
-sltiu tp s3 287
-lui s1 11486
-mulhsu ra t5 ra
-mulhsu s1 t5 t5
-lui s7 580363
-div t0 t4 gp
-slt a1 a6 s3
-srl s4 t5 a0
-mul x0 a0 t1
-xori a2 a6 1348
-srl a1 s8 s2
-rem s6 s8 a0
-andi s11 s4 -1175
-slt s0 ra a3
-mul s7 s4 s4
-lui t3 4318
-or t1 a1 s2
-sra a3 a0 a4
-srai x0 x0 10
-remu s0 t2 ra
-sltiu tp a4 1391
-divu t4 s0 a0
-addi t1 s8 1813
-rem s5 a3 s9
-srl a7 x0 s7
-or x0 a7 a1
-add t6 s11 a2
-auipc s4 817987
-mulhu s2 tp t1
-mulhsu t4 a7 s11
-mulh s1 tp s1
-slli gp a5 6
-ori s8 t3 -597
-xor s6 s3 s6
-srli t6 s5 19
-sltu s10 ra a4
-sra gp s3 t5
-rem s10 a4 s6
-mulh s3 a6 a4
-slt a4 t3 a6
-auipc s0 60588
-sra t6 t6 a1
-div s11 x0 x0
-div gp x0 s4
-sra s6 t5 a4
-srli x0 s11 25
-rem t5 s5 t2
-div a4 t1 s5
-srli s6 t0 17
-mulh s11 ra x0
-mulhsu s9 t1 ra
-sub a3 x0 x0
-sltiu s5 s1 1048
-auipc s3 686448
-addi s1 s6 1969
-remu a2 s0 s9
-sltu t4 t6 t3
-lui s7 1009375
-mulh s5 s2 s4
-srai a3 t4 28
-sra t1 s0 a3
-srai a2 a3 23
-xori tp a7 1027
-remu s4 s11 s6
-mulh ra s10 ra
-xori s7 gp -638
-sltiu gp a5 1720
-xori s5 t2 371
-slti t4 a4 999
-auipc s9 582484
-srli a0 t5 1
-srai s7 s8 10
-slt a1 s0 t5
-slli s7 t2 23
-sltu t2 s8 s5
-sltiu a2 t3 295
-lui s0 141490
-xori s7 t1 328
-xori t4 a6 -98
-rem s8 t2 a3
-xor ra s7 s2
-or s7 s9 ra
-sltu a7 t1 s10
-xori a4 t5 -636
-remu a6 x0 s0
-addi t3 s8 -1309
-and s3 s10 a1
-add s4 s0 t6
-mulh s9 s9 s1
-mulh x0 a3 a0
-sll s8 a4 t6
-auipc a6 27111
-srli a3 s9 27
-sltiu gp gp -1118
-mulhu t3 a0 a2
-sltu a6 x0 s9
-remu a5 s8 a1
-addi s1 a7 1901
-ori s10 t5 -1274
-rem s10 a5 t6
-divu s10 t0 ra
-srai a6 s6 12
-auipc a0 344956
-sll x0 s11 s3
-slt s6 a4 a1
-remu s4 t3 a5
-xori s6 a4 1002
-slli gp tp 26
-mul a2 a5 a3
-srl s5 t6 s2
-addi s11 a0 260
-srai t4 t5 10
-xori t5 s3 -1258
-sra s9 a5 t0
-or a5 t3 s4
-sra t6 s0 x0
-slti t5 t4 -1706
-add a1 s11 s2
-xor s10 a1 t6
-rem a6 s9 a7
-xori t3 a5 -825
-srai t3 s7 18
-div s10 a0 s6
-div x0 s8 t5
-sltu t2 t2 s8
-sub t3 s5 tp
-xor s0 a5 s2
-andi s7 t0 -163
-rem tp t3 a7
-slti a1 a0 -78
-ori s9 t5 -861
-rem a6 t4 t4
-divu s7 a5 t0
-mulh a4 s5 a0
-andi t6 s2 -1832
-remu s1 x0 t6
-mulhu s8 x0 a7
-slt t1 gp a6
-srli s4 a2 25
-ori s5 a0 -743
-divu a7 s8 a5
-srli t3 a7 30
-sltiu tp s11 -1946
-srli x0 t4 31
-mulhu s4 s8 a3
-sll t6 s2 s2
-sltiu x0 s11 74
-remu s8 a7 a5
-rem s10 a4 x0
-sra gp s10 t2
-slti s10 x0 343
-mulh s3 a5 a0
-div a4 s4 t3
-addi t5 s6 -743
-mul a2 s5 x0
-mulhsu a2 s0 s5
-srli ra s11 24
-auipc s3 552060
-divu a0 tp a3
-mulhsu t4 s10 tp
-slti s1 s5 -748
-rem a2 t4 a6
-sra s4 s9 s10
-sltu a2 t2 a7
-sll t0 gp t5
-xor a2 t0 a3
-sltiu s0 a6 -639
-sltu a1 s7 t2
-srai a5 s0 29
-sra a1 s3 s10
-slli s11 tp 23
-slti a3 a2 -1061
-srai s1 s11 15
-add t0 a2 a2
-sub a1 s6 a0
-srai x0 s0 18
-mul s11 a1 s4
-mulh a1 s5 a3
-auipc t3 655904
-or t0 tp s11
-add x0 s0 s11
-slt a3 x0 t5
-srai x0 a7 7
-srai s7 s3 13
-mulhsu s5 a2 tp
-mulhsu t6 t0 x0
-xor t3 s5 a6
-or t4 s9 a7
-rem t0 t5 a7
-sll t2 gp s0
-div s4 s10 t3
-remu s7 s6 a7
-mulh s10 s10 s3
-slli t5 x0 25
-xor a3 x0 a6
-andi gp x0 -362
-sltu s1 tp s3
-slt t3 tp tp
-rem s4 gp s2
-rem a5 a5 s6
-add t0 t2 s8
-lui a3 610551
-mul a1 s4 s4
-sltiu s8 s6 -787
-xori a2 t6 -102
-ori x0 s9 293
-srl s9 s8 s4
-divu s0 s0 s11
-or t6 s5 ra
-slt s4 s7 t4
-slti a7 s1 -1775
-auipc s10 83672
-sltiu t6 s2 -1919
-addi x0 a4 159
-addi s0 t2 197
-sub a7 tp a5
-mulhu a6 s2 t1
-srl gp t6 s0
-mulhu a3 t0 s8
-sll a6 s2 s9
-remu a6 a5 t2
-slt t6 s7 t0
-srl x0 s9 s4
-div t6 s9 x0
-srai a0 s4 28
-add s5 s1 a0
-auipc s9 383845
-and a5 tp s4
-sub gp tp tp
-srai s8 t0 12
-mulh a3 t4 s0
-mulh s7 t0 t4
-remu s11 s7 t3
-mulhu t0 s7 t0
-slli t5 a0 10
-add s2 gp t6
-slti tp s3 1175
-srai t3 s9 29
-div t4 a3 a7
-addi s3 t6 -1489
-andi t5 a4 1075
-srli ra a1 27
-remu s4 s9 s2
-sub s8 t5 x0
-xori s8 t3 1759
-slt s7 a1 s9
-divu s5 t1 x0
-sltu s6 t5 a4
-add s10 s3 a4
-srl s6 t3 s11
-slti s7 s0 -1706
-slli a4 s0 6
-xor t1 a2 s1
-mul x0 a7 t1
-div t0 s1 t2
-slt s1 s1 s6
-lui s4 803390
-mulhsu t2 s2 s9
-mulh t1 a2 a1
-lui s4 800969
-xori s11 gp -331
-slt tp s5 s7
-mulh s2 a0 a7
-mulhsu t6 t2 t2
-xor s1 ra t5
-rem tp t1 s1
-sra s4 s2 s7
-xori s7 s0 -1144
-xori a0 s9 1245
-slli t4 x0 12
-slti x0 s3 -1258
-srli gp tp 31
-xor s6 a4 s2
-xor a5 a5 s9
-sltiu s8 a1 -1958
-lui t0 257815
-sltu t3 s9 s10
-sra t3 t6 gp
-slt tp s7 a3
-srai gp s8 13
-srai a4 s7 24
-addi t4 s11 -280
-slli t2 s2 0
-xori s8 t5 -1178
-srai s5 a4 9
-sll s3 s8 a3
-sltu s0 s3 t3
-xori ra t5 1362
-or t2 a5 t4
-mulh a0 s5 t6
-sll a1 a5 s10
-div s2 s2 s0
-div s3 s9 t2
-add t6 s5 s2
-addi t6 s5 -998
-mulhu a6 a3 a6
-sltiu s11 s1 145
-addi a5 t3 654
-add t0 s9 s6
-divu s1 a1 s0
-add s8 s9 t2
-div t0 a2 a7
-slt a4 s5 t5
-or gp t2 t2
-xori a7 a1 -1434
-mul s4 a0 s6
-andi a0 a2 -1470
-or t3 s3 t2
-rem s7 gp s9
-ori ra s6 -1700
-remu t0 x0 s11
-remu t5 a4 x0
-remu t2 gp s8
-sra a3 t1 a2
-and a4 s1 a1
-xori gp x0 1922
-srl a5 gp t3
-or s8 t3 a1
-sltu s1 t2 t2
-rem t4 a6 s10
-div a4 s1 t3
-sra s0 t4 t2
-mulh s10 t6 t3
-sll s3 t2 a7
-ori t0 s8 518
-srli s5 a3 20
-srai s6 x0 2
-divu a2 a2 a1
-mulh t1 t0 x0
-sra s3 t3 a5
-sll gp s1 s8
-slt tp t2 s10
-srl s6 a4 x0
-or t6 t2 s7
-sltu a7 s9 a7
-andi x0 a2 -2020
-srl s5 ra t5
-srai s10 t6 18
-sltiu t2 a4 1414
-mulhu a1 s10 t5
-sltiu a3 t3 484
-mulh s1 t1 ra
-sll a6 a1 s11
-andi tp a5 -1400
-div a1 t0 t1
-xori s9 s8 -1750
-div s0 a7 s1
-rem a5 a4 a0
-addi t5 s9 -1459
-divu t4 s2 s1
-srai s1 s2 0
-mulhsu t6 s5 a1
-auipc s6 47145
-srl s8 x0 s5
-xori t5 s0 915
-remu s7 t4 a7
-srl s3 x0 t6
-sra s8 s9 a3
-or a5 a6 s6
-slt s9 s9 x0
-lui s11 360021
-xori t6 s11 -1444
-mul s10 t5 x0
-slt x0 a6 a2
-srli s11 a7 5
-sra s7 s11 a7
-and a7 s5 t4
-srl tp tp a1
-remu s4 s11 s1
-remu s2 s3 x0
-and s1 t0 s9
-divu a0 s11 t0
-srli tp a5 7
-remu s2 t0 tp
-mulh s4 x0 a0
-auipc s8 422428
-sll s6 s8 t4
-sll s4 a3 t6
-mulhu s0 s1 t2
-srli s4 t4 16
-sra s11 t1 a3
-rem a7 s7 t2
-xori a1 tp -327
-mul s3 s3 t1
-add s3 a6 t2
-add s8 t2 a7
-mulhu s5 t4 s9
-or s1 a1 t0
-slti s7 t3 -1707
-sra x0 t5 s7
-ori t3 t1 616
-auipc t6 575292
-ori s6 a2 -1109
-and s1 t1 a5
-mulhu t3 a4 t4
-sltu t1 s2 a1
-and x0 t5 gp
-or t6 t4 a5
-xor a6 ra a5
-slt a1 a5 t4
-mulhsu s8 s2 a4
-addi t3 a6 797
-slt s10 a6 t6
-rem x0 t1 t2
-sra t6 s0 s5
-xor x0 s9 a7
-addi t6 s6 886
-rem t1 s0 s3
-mulhu a5 a7 s11
-mulh s4 s3 tp
-div a7 s0 t6
-rem t6 gp s10
-or a7 a6 s8
-add t5 s5 s5
-remu a5 s3 t5
-lui a6 231642
-or a0 s9 t0
-remu a6 a7 s4
-auipc ra 225363
-mulhsu s4 t0 s9
-slli t3 ra 16
-add a0 s3 t4
-divu s8 a2 t1
-slti s3 a4 1017
-srli x0 s0 28
-sll s3 s11 a0
-remu s6 t4 s9
-or s8 a5 tp
-srli s11 s5 4
-xori s2 a5 -1818
-remu a1 x0 a3
-srli ra s8 29
-slt tp t4 s0
-srai t6 s6 28
-andi t5 a3 1633
-mul s8 x0 x0
-sra a3 s0 gp
-xor a5 s5 t3
-add s2 s0 t2
-slli s5 s0 17
-sltu s9 gp tp
-xori s6 t4 -741
-div s4 a0 s5
-srl s9 t3 a1
-srl s9 s9 a7
-slt t0 s5 s8
-sub t1 t6 a4
-or s6 s0 s0
-sub x0 s2 s2
-divu s3 t5 a4
-xor s6 x0 s6
-add s5 ra s8
-sltiu s1 t3 -710
-div t5 x0 x0
-remu t4 a4 s7
-mulh a6 s0 a1
-lui x0 910100
-andi a2 x0 -1907
-mulhsu s10 a4 s2
-sll s10 s5 t6
-mul a2 a3 t4
-xori s2 t5 -1008
-mul t3 a3 tp
-auipc a7 43902
-add s11 t2 a2
-slli t6 s5 1
-andi a3 s8 -1698
-mulhsu s5 t6 t4
-xori s2 s8 -194
-auipc s10 349812
-andi gp t0 -1378
-sll x0 t1 s3
-mulhsu a0 s10 x0
-sub a0 s9 s2
-rem s11 s4 a4
-divu s11 a6 s7
-or a1 t0 a3
-or a2 t4 tp
-div s6 t5 s1
-mulhu a1 a5 a1
-slti a3 ra 614
-divu s4 s9 s7
-rem x0 gp tp
-mulhu t5 ra a0
-slti s10 tp -555
-sltu t2 s6 a6
-sll a5 a1 t2
-mul s7 s4 gp
-lui a2 307415
-srli ra t4 3
-srli t5 s2 15
-mulhu a5 s8 s5
-sltiu s6 a5 1029
-slli t6 s4 13
-and s1 t4 x0
-srl s5 t3 a4
-or t0 t3 a0
-andi a1 a3 1777
-add s7 t2 a1
-sltiu s9 a1 -1721
-rem a4 x0 s5
-sltiu s3 s11 -1445
-sltu t2 s1 t3
-auipc s2 436194
-srl ra a7 a2
-sltiu x0 s1 1071
-xor s1 a2 s1
-lui a0 559867
-lui ra 317523
-rem t5 s9 s2
-and ra gp a5
-sltiu s5 ra -1054
-mul a0 a2 s0
-divu s5 a2 a3
-srli a1 a6 0
-sub a4 a3 s5
-slti s6 t6 598
-div s2 x0 t6
-div s11 t3 x0
-sll s5 a6 a3
-and a5 s0 s2
-div x0 a5 s0
-slti s9 a6 -422
-div s1 a1 s4
-lui s10 32174
-or x0 s0 s7
-xor s7 s11 t3
-remu x0 s8 a6
-mulh s9 a3 s0
-slli ra a5 14
-add a6 s3 a1
-slti t4 t1 -1423
-auipc a5 473061
-auipc a7 877853
-sll s5 a2 t1
-ori a4 s1 127
-add s7 t4 s10
-lui s3 870056
-mul t6 t3 a2
-slli s7 s9 0
-remu a6 a0 s9
-div a5 a6 s5
-and s7 s8 s11
-sltu t5 ra a0
-srli s9 a7 24
-and s4 s10 t6
-andi t5 t4 -1041
-add ra gp a2
-remu tp a4 t2
-lui tp 817911
-mul a7 t0 t6
-xori s2 x0 -2003
-mulhsu a1 s5 a3
-xori s0 gp -341
-remu s11 gp a4
-mul t2 s1 t2
-sltu t0 t3 tp
-auipc t6 220243
-sra a5 s2 s6
-addi s4 t3 -766
-rem s8 s0 t5
-rem t4 a2 s11
-slt t3 a3 t4
-rem tp t4 s0
-srli s7 t6 28
-slli gp a3 31
-rem a1 a3 a6
-auipc a5 745961
-xori a2 s7 -1153
-addi x0 s4 1864
-lui x0 344283
-ori a4 ra -873
-add s4 s8 s4
-mulhu s5 t1 a4
-divu t5 tp a0
-ori tp x0 -54
-mul t0 t6 s4
-sub tp s7 t0
-sra a2 s1 s4
-add t4 s3 s7
-remu a2 s2 s11
-and tp a1 t1
-xor t6 tp ra
-divu ra a4 s4
-and a7 a1 s8
-rem s6 a0 t6
-and s9 s4 s0
-ori a1 t1 162
-add a3 t1 t6
-ori a2 tp -1300
-slti s5 s6 1709
-mulhu a7 s9 a5
-sll t5 t3 s0
-sub s4 s8 a6
-srli a6 t1 12
-remu s7 tp t5
-mulhu s7 s8 t4
-slti a0 x0 1686
-mulhu a5 a2 ra
-and s1 s0 x0
-andi s0 a0 -1764
-mulhu s11 s5 ra
-rem a6 s1 s11
-rem s5 s9 t2
-mulh s4 s7 t3
-sltiu s5 a7 -1412
-add tp a4 t6
-auipc s6 244990
-div t2 s10 t0
-rem gp a3 t3
-mulhsu s11 tp s6
-sll a6 gp a0
-rem a3 t5 s1
-mulhu a3 t3 s11
-add t2 a7 s6
-mulh a4 a3 a3
-ori t3 t1 -587
-addi t4 a7 -542
-sra s9 s6 a3
-slli s6 a2 28
-and s2 s11 tp
-mulh s10 tp t5
-sll a3 s10 t4
-lui t1 391431
-srli s6 ra 1
-mulh s6 a6 s0
-slt s9 a6 s3
-ori t3 t5 -294
-sltu a3 t1 t3
-mulh s1 s8 s4
-slli a0 ra 7
-srai a3 t3 2
-div a6 s8 s9
-and a1 s0 a0
-rem a4 x0 t4
-addi s2 a3 1601
-sltiu s3 gp -1996
-slt s11 a7 s8
-sltiu s5 t6 -1612
-sll s7 x0 a6
-sll s6 gp tp
-slt t5 a7 s3
-srli t1 a2 28
-sll a6 s3 s6
-sra s8 t3 s4
-and t5 a4 s3
-add t4 gp t4
-div a5 a4 a5
-mul a5 s3 t6
-remu s9 t6 t4
-ori s9 s3 -1026
-rem t2 t1 t5
-mulhsu a4 a6 a1
-slt s4 a3 x0
-addi t5 a6 -774
-srl s10 a2 a2
-xori t3 s3 1315
-lui s7 338512
-add s4 t1 s9
-div s2 tp t6
-remu a1 ra a4
-and s9 s8 t6
-srli s1 ra 30
-div s3 t6 t0
-div s6 t2 s0
-xori t4 s0 -620
-slli t3 a7 29
-lui s6 911034
-auipc s10 860034
-andi s2 a6 -1729
-ori tp ra -1825
-sltu a7 x0 s10
-add t5 a3 x0
-add tp a0 a2
-mulhu t5 s7 t1
-mulh s10 t1 t2
-sub t1 t5 x0
-mulh a5 a3 x0
-slli a5 a4 22
-andi s8 t3 -1548
-mulh s4 ra a2
-sltiu s11 a3 -208
-xor t6 a4 s2
-xori t0 s10 -347
-mulhu s0 s10 a0
-srli s5 t2 24
-mulh t4 gp s1
-mul s8 tp a0
-or a3 gp tp
-auipc s10 519166
-divu t1 x0 a6
-sltu s6 s0 t5
-lui s0 664374
-andi a1 t2 -2041
-srl a0 a1 ra
-xor x0 s8 x0
-auipc ra 176292
-srli s8 tp 14
-ori a4 a6 -1129
-xor s9 s0 a7
-sra tp a4 x0
-slt t0 a2 a6
-sltu s10 x0 a6
-slti s8 t1 -1840
-slli s2 s10 0
-mulh s1 s2 x0
-ori s9 a2 -355
-auipc s4 762051
-and s9 a6 s10
-or s10 t2 ra
-slti s1 s3 -1896
-srl t5 t6 s10
-srai a6 t4 17
-slti t1 x0 -42
-auipc s1 736329
-mulhsu s1 x0 s2
-srl x0 s4 x0
-remu s10 ra x0
-or x0 t5 t5
-andi a0 t2 1585
-or t2 s2 a2
-and s11 t2 a6
-slt x0 gp s11
-lui a2 932633
-addi t4 s8 -515
-srl s1 t5 s2
-sll a4 s0 t2
-mulhu s11 t3 a7
-sra s9 a7 s6
-xor s8 s1 s3
-mul s2 t3 a0
-slli x0 t1 4
-add ra a3 t4
-sltiu tp t0 1283
-rem ra t2 ra
-remu t6 x0 a2
-sll t2 a5 s10
-mul a3 a0 gp
-ori a7 t1 -330
-ori x0 tp -1571
-add s1 t6 s4
-sltu ra s3 a4
-div tp t4 s1
-mulhu ra s10 t2
-srli s7 t3 1
-lui tp 76093
-sra t1 s5 a6
-ori a5 s8 -1529
-rem t5 s0 t4
-sra s4 s3 a3
-rem s3 x0 s1
-mulhsu t2 s4 a5
-remu s3 t1 t5
-srli tp a2 27
-srl t2 s1 a2
-andi s4 a3 -67
-andi s10 a2 1287
-mulhsu a3 t5 t0
-div gp s4 t4
-xori s0 t2 64
-slli t6 s0 1
-or t2 t6 s3
-and a4 s7 s2
-sub a0 s4 a5
-sub t4 t3 a4
-or t5 a7 a0
-srai a7 s11 7
-xori s7 s3 1004
-andi s11 a0 -522
-mul s1 s9 a2
-mulhu s4 a0 a7
-slli gp a3 15
-mulh a0 a1 s1
-srai t2 a1 30
-add s6 s6 t1
-slli tp t5 8
-lui s6 424087
-remu t6 tp s0
+ori s2 s11 252
+lui s2 921547
+srai s9 s3 0
+slti a5 s5 -1434
+sub t1 a2 t2
+ori t4 t5 -1410
+lui t2 442189
+and t5 x0 s8
+sra t5 a3 s11
+xori s11 tp -1402
+slli t4 a1 16
+divu s10 tp x0
+remu s0 gp a6
+slt s9 t6 s6
+srai t0 ra 14
+mul s5 a4 a4
+rem t6 s0 a5
+and s10 s2 x0
+srli s3 t0 21
+sltu s3 s0 s2
+addi t2 t5 1535
+sub s0 s10 s9
+xor s8 gp ra
+auipc a4 785195
+and a5 s9 a7
+remu a0 t3 a4
+addi t5 s5 -1888
+slt s5 tp t0
+slti s3 s1 -1742
+slti a4 s5 -1304
+addi s0 s8 -745
+div t4 t5 t5
+srli t3 t1 26
+or s8 s11 s5
+slli a3 t2 0
+add ra a0 a2
+srai a5 a6 2
+and tp x0 ra
+sub s10 t1 s11
+remu t5 x0 s3
+srai t6 ra 9
+and t4 s0 a3
+slli a7 tp 7
+or a0 ra a4
+sra s1 s0 a3
+remu t0 a1 x0
+sra s10 a5 a5
+slti a1 s6 1847
+andi s6 a7 -1535
+div s7 s8 s10
+mulh s5 t0 s8
+and s7 s8 gp
+addi a7 t0 -271
+mulhu a5 a7 a4
+and t1 s9 ra
+divu a4 gp a5
+xor t1 gp t3
+remu t0 s4 s1
+xor a5 x0 s6
+mulhu s9 s0 s8
+ori t6 s0 1671
+slli s5 a2 6
+add t3 a3 a0
+srli t1 a3 30
+sll s3 a0 ra
+lui a0 500369
+slt t5 a1 a5
+lui s11 136535
+sra t6 tp t2
+addi gp s4 1394
+slti t1 t0 -1100
+mulhsu gp s3 s2
+sub x0 s2 s4
+divu s5 s3 a1
+or t2 s6 t0
+or s11 a7 s4
+sll a7 a2 s11
+slt a6 s6 s8
+andi s5 t4 -135
+divu t4 a2 s2
+lui a1 345528
+andi a7 a1 -1234
+lui s5 72586
+addi s0 t2 -246
+ori a1 s1 -753
+divu x0 t5 tp
+srai gp s7 2
+remu x0 s11 s2
+srai t4 s11 6
+mulhsu s3 a3 gp
+auipc a4 989558
+mulh s10 a2 a5
+addi a7 s9 -645
+mulhu s10 t2 t2
+lui a0 648146
+slti gp x0 158
+remu a0 s10 t3
+srli s10 t5 29
+add x0 a7 s4
+srai t4 ra 27
+and a0 t6 s8
+srli t0 t4 16
+sra tp s8 s3
+xori t1 a1 -130
+add a2 a4 a2
+mulhsu s1 a4 s6
+xor s11 t6 s10
+sltiu a5 s5 -620
+andi s4 t4 1492
+addi a2 a5 -377
+and t2 a2 a2
+divu t1 a4 t0
+srli s2 s8 16
+div tp a3 s9
+ori s9 t4 -1784
+srai s11 t5 7
+div a6 a6 ra
+ori t0 s9 -520
+divu a6 s0 s4
+and a6 s9 s1
+xori a2 s11 4
+xori s3 a2 -686
+xori a5 s0 449
+add s11 s3 a6
+mulhsu a6 ra s2
+auipc s7 668706
+srli x0 s2 14
+sll s8 s0 t1
+and t0 t3 x0
+slli s9 s4 27
+sra ra s5 t5
+div t1 t0 t5
+sltiu s5 s11 1525
+add a1 tp a3
+slti tp s2 -716
+mul s2 tp s2
+remu s10 s11 a4
+mulhu a4 a3 s6
+ori a5 s9 -680
+sltu s0 s7 s5
+xori a3 s7 -1576
+mulhsu t4 a3 t4
+divu t3 gp a0
+rem t0 s11 gp
+div a5 s8 t1
+remu a5 a4 a0
+or s3 a0 s1
+remu a5 s10 tp
+xor s7 x0 tp
+or s11 a4 s5
+mul s7 t5 t4
+or a4 a1 x0
+mulhu x0 gp a0
+sltu t1 s1 t2
+lui t6 346930
+mulhsu s10 t1 s1
+auipc s10 590383
+slti x0 x0 -366
+slti tp t1 -1536
+addi s0 s8 1943
+rem s5 s3 a1
+mulh x0 s5 tp
+srl s10 x0 a7
+or s11 a1 x0
+addi s6 s1 -880
+xor s2 tp s7
+rem t6 a1 a5
+add s4 a7 s7
+auipc ra 986347
+and s3 s6 a5
+ori a6 s9 -582
+slt t1 t1 s4
+and a5 t1 a1
+slti gp t4 -858
+slt ra t3 a6
+srai s9 s4 29
+sltiu tp a7 -1350
+sub t3 s2 s0
+rem a0 a5 t1
+sub t0 t1 s10
+addi s3 tp 1452
+xor a7 x0 gp
+mulh a5 s6 t4
+slli a0 s3 0
+srai s3 a0 24
+lui t3 827578
+lui s3 989606
+sltiu s8 s6 -642
+srl s8 a4 s5
+srai s5 s7 9
+lui s7 220182
+srli a3 s1 6
+mulhsu s7 s6 gp
+xor a4 t3 x0
+srai x0 s11 16
+ori a6 tp 658
+sltiu gp a2 -2013
+mulh ra s0 s9
+lui s0 272694
+ori t1 s7 -1207
+srl a2 s9 t1
+sltu a3 s10 s10
+or t1 s6 s6
+xori s5 a3 -639
+sltu a7 tp a1
+sltu s7 t6 tp
+or a6 gp t3
+div t2 s7 s4
+mul s11 a4 s6
+slli s2 a2 6
+srai s6 tp 3
+xor x0 t6 s2
+divu a2 t5 t2
+and s7 s11 s5
+divu ra ra a5
+auipc s9 239327
+sltu s3 s1 a7
+mulhu t4 a4 t2
+slti x0 s7 -856
+lui t1 696434
+srli a1 a0 13
+xor a5 a4 a3
+and t0 a4 s5
+sltiu s1 s2 1406
+and gp a1 t3
+slt t0 t3 t2
+mulhsu t1 s8 s5
+sltiu a6 a2 -2023
+or a4 s5 s9
+xori t6 a6 -1903
+auipc a1 358414
+and s9 t5 gp
+xor t4 s7 t0
+mulh s8 s3 t5
+mulhsu t0 a5 a1
+slti s11 t1 1192
+or s8 s3 a6
+sltiu s5 s9 304
+and a5 s8 t2
+rem x0 s11 a1
+sll s8 s4 s5
+sub t6 gp t2
+slt s10 t2 a4
+mulhsu s11 s2 ra
+srl t5 ra t2
+ori t0 s1 -881
+slt x0 t6 s7
+mul a4 s7 a1
+srai s4 t2 14
+or t2 s1 a3
+or s0 t3 t1
+sll a6 x0 s4
+ori s4 t3 -1375
+or a6 x0 t2
+lui x0 890603
+sra x0 a4 a1
+div x0 a1 a1
+sltiu gp gp -732
+sra t1 a4 s5
+srli t6 t5 16
+srai s2 t5 3
+srl t4 a4 t3
+mulhsu a4 ra s4
+xor t6 t6 a4
+div a1 t5 a6
+sub s3 a7 t1
+slli a7 x0 5
+mulhsu a2 t5 a3
+add a0 s9 t3
+remu a3 t5 a4
+sltiu t6 a6 -1902
+sra s7 s5 a0
+mul t3 s2 s10
+sra s1 s11 s8
+mulh s11 s1 s9
+xor a6 a6 s3
+srai a3 s7 12
+addi t4 t4 755
+auipc s0 243091
+mul t0 s7 a1
+remu a2 ra a4
+add s3 x0 a6
+and s1 s3 t2
+sub a0 x0 s1
+sltu s5 x0 s5
+xor t3 t2 a7
+mul s5 a6 s3
+slti a7 s5 -1650
+srli s7 t3 0
+remu s3 a5 t3
+remu x0 s4 s10
+auipc a5 309846
+addi a5 a7 -1682
+add a1 a1 x0
+divu x0 a4 t4
+mulhu gp a6 s4
+srli ra s11 9
+addi tp s0 -715
+sll a2 a7 s0
+div t6 s0 a2
+slli a7 x0 28
+slli s6 s3 3
+mul s6 s1 a0
+and s5 s3 t6
+slti s11 s6 1758
+add a1 s5 a6
+andi t3 a2 -582
+mulh a7 t4 a5
+mul ra t5 s8
+srli s3 s9 28
+sll a2 a4 t6
+auipc t0 467912
+xori t6 tp -1319
+mul t5 s5 s11
+slli s8 t2 18
+sltu t3 t1 a4
+divu a6 s0 x0
+xori ra t5 -734
+mulh a4 t5 gp
+slt gp a3 x0
+add a3 s3 a7
+and a6 a6 gp
+addi t6 s4 -908
+mul a0 a3 a3
+sub t4 s0 ra
+auipc x0 927576
+sra s4 t6 s4
+mulhu a4 a4 s2
+or a0 s10 t2
+add x0 x0 a5
+xor t1 a3 t3
+slli a3 s1 21
+xori s1 a3 -676
+andi s9 t2 414
+mul a2 t4 a1
+mulhu t3 s10 a7
+auipc a4 19768
+rem t1 t2 a4
+srl s3 tp ra
+sll s4 a3 t4
+sll t3 s0 s7
+divu a3 s7 s2
+ori t5 s6 2015
+sub s5 a3 a3
+xor t1 a0 s0
+srl a2 t3 t1
+sll t2 t2 t5
+andi s5 s8 1448
+and gp a7 a3
+divu t6 s10 t4
+mulhsu a2 s6 s4
+sra t6 a1 s5
+srli a7 a7 24
+xor a7 s5 a7
+srai t5 a1 18
+rem a0 s6 t6
+slli s7 s9 4
+add t5 s7 t4
+sub t1 a6 t0
+auipc a5 772260
+ori s0 ra 1701
+sltu s10 s7 tp
+slt s2 a7 x0
+sub t3 a2 a0
+srl s11 a4 t5
+slli x0 s1 9
+remu x0 s9 s5
+or s6 s11 x0
+lui ra 2471
+addi t5 s2 1575
+addi t0 a5 -1804
+mul s6 x0 a0
+sll t6 a1 a3
+auipc tp 407057
+mul s8 s3 gp
+add s0 a7 tp
+div t4 a7 ra
+and a4 t6 tp
+lui a4 82567
+sltu t2 s10 s9
+divu t3 s6 gp
+addi s5 s4 1826
+mulh t1 s7 s2
+and t4 a6 a6
+mulh s10 t3 s2
+slli s6 s1 5
+xori t6 a3 -298
+div t6 tp s5
+auipc s1 889382
+sra a6 a6 t0
+remu a0 a0 t1
+andi a2 a6 1250
+mul s7 gp a5
+divu s4 t2 s5
+auipc s8 427806
+srli s0 t2 6
+mulh x0 s4 t5
+mulh a7 s5 t3
+sltu s9 tp t2
+add s7 t0 x0
+sub s9 t0 s8
+slt a1 a6 a0
+ori s11 s5 434
+ori t0 t5 -1582
+sra t2 a5 tp
+lui a2 751806
+divu t1 a1 a4
+srl s5 a2 s9
+sub t5 t1 s0
+srai ra a4 8
+mul s11 s8 t1
+slti s1 s1 55
+mulh a1 s6 gp
+xor a6 a4 tp
+auipc a3 682168
+divu a3 a0 a5
+srl s8 a0 x0
+srl a7 s5 a0
+slti x0 s11 -2030
+srl s0 t1 x0
+xor x0 s2 s5
+sltiu s7 a3 -1833
+xor s4 s3 x0
+sub s8 s2 a0
+andi s9 ra 1147
+add a6 t2 t0
+add s10 s0 a2
+and x0 a2 s11
+slli a5 s9 1
+slli s10 a4 14
+rem a0 a7 t4
+sltiu t1 a1 -1362
+mulhsu a4 t6 x0
+or tp s2 s6
+sra t5 t1 s6
+xor s2 s7 s6
+sltiu a3 s10 150
+sub s9 t1 a0
+sra s0 tp t5
+xor a7 a6 s10
+slti a3 t5 -124
+mulhu s7 tp s5
+srl s3 a7 s5
+xor a0 gp s6
+sub t3 gp s0
+lui s11 266595
+srl s11 s11 s9
+srai t2 s5 11
+mulhsu t0 t3 s8
+lui a6 226152
+slti x0 t6 -1182
+remu s11 a0 t2
+xor s3 t1 t4
+srl t1 s2 s4
+sll s3 ra a6
+addi s3 t2 -862
+rem t4 s8 s9
+mul s6 ra s5
+mulhu s7 a7 a7
+and s6 a7 t3
+ori t2 a1 -526
+srli s11 s8 31
+slli a4 a5 6
+add ra t1 a5
+rem t3 a0 s9
+xori a7 s4 -662
+mulh s10 t6 a1
+srli s7 t3 24
+div s6 t3 s2
+sra s2 gp a5
+slti s1 s7 -772
+mulh s5 s4 t5
+lui a3 199749
+xor x0 a4 s4
+sltiu a2 gp 1750
+mul a5 s4 x0
+srl tp s6 t4
+xor ra a3 a2
+srai a6 a1 29
+mulhsu t5 tp a7
+sltu s9 s7 a7
+sltu s8 a2 a3
+mulh a1 s7 x0
+mul t5 s5 t4
+ori t2 tp -1112
+divu s3 t6 s5
+xori tp t2 1168
+sltiu a7 s9 -1234
+mulh a7 x0 t0
+and s6 x0 s2
+sltiu s3 s6 56
+or t1 t4 s9
+sra t0 s2 t2
+xor a4 a0 t6
+srl s6 a4 s6
+lui s5 207979
+andi s6 s7 -1405
+slti s2 s1 1655
+sltiu t2 tp -819
+slli a0 s9 21
+srli a5 s2 10
+sltiu t3 s1 -1560
+slt s9 a6 x0
+auipc s10 80566
+div s11 x0 s8
+sltu x0 t1 t4
+lui s2 775625
+andi a7 a5 -191
+addi a7 t3 -1462
+sll x0 a6 s7
+or a2 a1 t5
+mulhsu a3 tp s9
+ori t2 a6 -1197
+add t1 s0 a4
+ori t2 s6 -952
+auipc s3 67113
+addi s0 a6 448
+mulhu t3 a7 a5
+remu s4 s8 t2
+add a0 t3 s5
+sub t2 a0 t1
+srl s11 t5 s1
+sub t1 a6 t6
+xori t1 s0 -1328
+addi a5 s7 -387
+lui s2 943850
+and a6 s1 a2
+sltiu t3 a3 -1610
+ori s8 t2 886
+auipc ra 117443
+mulh t3 a6 t2
+divu s9 s3 s7
+mulhsu t1 s0 s2
+mul t6 s9 s5
+divu a5 t3 t6
+sll s0 t0 a3
+or a1 t3 t3
+slti tp s2 1240
+slti s0 a0 -295
+remu a0 s0 tp
+or s2 t5 t0
+xor s4 a1 s11
+xori t1 t2 1587
+sltu s5 s0 s1
+auipc s7 707624
+mulhsu t6 a2 x0
+mulhsu ra x0 x0
+srai a0 gp 3
+slti t1 x0 1207
+slli t1 t0 19
+mulh gp s7 s11
+and t3 s3 t0
+rem a2 a0 t2
+slti x0 x0 266
+sra a0 a3 t6
+slti s7 gp -1241
+mulhu s4 a7 a2
+srl ra s11 s8
+or a5 s8 a5
+slli a3 x0 7
+slt t6 x0 a0
+addi x0 a4 -348
+and x0 a7 s11
+add a7 t3 t3
+sltiu s2 s11 -719
+sll s3 tp tp
+divu s4 a2 a1
+or x0 s8 s6
+slti s6 s7 -590
+auipc a7 582336
+xori t4 t5 -1586
+rem t4 s5 a3
+sll t4 a0 s9
+sltu s9 s11 s11
+add t6 a4 a0
+sub s6 t6 a3
+lui s3 884101
+andi a6 x0 -870
+rem x0 a1 s5
+and t1 ra s8
+srl t2 a6 a2
+mulh a7 s4 x0
+add a4 a5 s2
+xor s0 s3 t0
+sll tp tp s7
+auipc t5 662419
+slti t4 s6 -660
+or a1 s4 gp
+add s6 s8 s3
+and t1 s4 t6
+mul s2 a6 t1
+mulh t6 s9 a0
+ori t0 s7 -547
+xor s7 t5 a6
+slli s5 a2 21
+slt t1 tp s9
+div a2 t4 s6
+sll s8 s4 a0
+lui a1 442141
+mulhu t2 s5 s1
+xori tp tp -115
+auipc tp 359575
+mulhsu s1 s11 a5
+sltu x0 a7 t5
+sltu s5 t0 s6
+sltiu a2 a7 1505
+div t3 a6 s6
+or t5 t3 tp
+slli s0 a5 15
+sll t6 s1 t0
+sltu s4 t4 t4
+andi a7 s11 -1824
+sltiu gp t5 1772
+divu s6 s6 s0
+andi gp s7 -170
+slti s2 t6 -1744
+remu a7 s7 a4
+xori gp s0 -620
+sll a5 gp a3
+auipc t6 797567
+remu a1 s6 s4
+mulh a0 t5 a3
+div s3 s1 s11
+rem s1 ra s9
+srli s11 t3 4
+mulhu s0 t5 t1
+mulhu t2 t3 s9
+sub s1 s10 t1
+slti a5 s5 -1802
+xori a3 a5 -1679
+slti s10 tp -93
+add s6 s3 tp
+mul s9 t0 a7
+mul x0 s3 ra
+mulh s10 x0 s4
+div s2 t5 a1
+lui s4 222406
+sub a3 tp a5
+remu s11 a5 s10
+srai t5 a4 11
+srai gp s0 27
+slt a6 x0 s6
+add ra s8 s7
+sltu s11 t1 s9
+divu s0 t1 x0
+sra t2 s2 a6
+srl a0 a0 a1
+sub s6 s9 t5
+addi s5 s1 1419
+sub s5 gp a0
+sltu a6 t3 t4
+divu t1 t6 t1
+remu s1 gp s3
+sra a0 s4 s3
+add x0 s7 t4
+sra s11 s0 x0
+auipc t0 336687
+sltiu s4 s1 1047
+divu x0 t1 gp
+mulhu s11 t1 s9
+mulhsu s5 t6 a5
+mulhu s7 gp t0
+and x0 s6 x0
+sltiu ra s7 -1006
+mulh a3 t1 s8
+auipc s0 438903
+xori t0 s0 -1131
+srai x0 s1 15
+mulhsu x0 s3 s6
+ori t1 s8 1341
+add a4 s6 s0
+slli s8 x0 19
+and s0 s9 a0
+auipc t6 378245
+rem s4 gp s3
+sll a5 x0 a0
+auipc a5 44157
+sra a6 t6 a7
+addi a0 tp 1281
+sll t1 a4 t3
+slli t2 a1 29
+andi s8 a6 641
+slt a6 s11 s5
+mul a3 t3 t4
+and t6 x0 t1
+mulhsu a0 x0 gp
+sll a6 t0 s10
+addi a5 t4 -130
+sra a4 t6 a2
+slt t0 s4 a0
+srli a2 a5 8
+divu a2 t3 gp
+divu a6 s1 s11
+divu t4 a4 s11
+slti x0 s8 1827
+addi a4 s11 -1804
+mulhu x0 t1 s1
+sltu s5 t2 s7
+mulhu ra a7 s11
+mul tp a0 gp
+slti t6 t1 1457
+sltiu s11 t6 -1790
+or a0 s7 s4
+andi s6 a3 1299
+slli t5 x0 3
+mulhsu tp t4 x0
+xor a3 t1 tp
+slli ra t4 30
+mulhu s1 t3 s0
+add gp a0 s2
+slli t3 a7 28
+sra t3 ra s8
+xor gp s8 s3
+slti s6 s3 -502
+lui t2 723730
+mulh a4 ra a2
+srai s6 tp 10
+lui t4 615655
+srl a5 s4 t4
+xori s7 a5 -931
+xor x0 s11 gp
+slli s0 t0 17
+slt s1 s0 t0
+or s4 tp t0
+xori x0 a0 -1526
+sub t4 s2 t2
+divu tp a1 ra
+and s3 a1 s6
+slli s6 a6 11
+divu s2 x0 t3
+or t4 s8 a5
+add x0 tp s0
+srli gp s2 18
+andi a3 t2 -370
+div a0 t0 a4
+xori a7 s9 291
+mulhsu x0 s2 tp
+remu t6 s3 tp
+xor a0 a4 s3
+andi t1 t0 -1559
+xori s1 s3 515
+auipc t0 368169
+mulhu gp t3 s9
+lui s11 549243
+or a6 x0 t3
+rem a5 t2 s4
+div a1 s3 s9
+lui s5 866118
 or x0 tp x0
-or s4 ra t1
-and a7 t4 s2
-slli s7 t3 2
-divu s6 t0 s11
-lui t4 169689
-xori s10 a2 -1071
-lui t6 169452
-sra s2 a0 a1
-srli s10 s8 4
-div s11 s4 tp
-mulhsu s3 s6 t3
-lui t6 762717
-srl x0 a3 s1
-sub x0 t0 a7
-sub a1 t4 a0
-sub t3 s4 t5
-rem t4 tp t2
-mulh t3 x0 x0
-sltiu t0 s10 -1717
-sll s11 t0 s9
-slti s7 s7 -902
-mulhsu a6 a1 a1
-slli s4 a5 13
-ori a0 gp -202
-mulhu t2 s9 a5
-slt t2 s0 a0
-sll x0 s8 s0
-slti s5 t3 1920
-xor x0 s7 x0
-divu t2 x0 a4
-remu s3 a4 s6
-addi a6 t3 527
-sub x0 t1 a5
-srai s10 t4 19
-sltu s9 s3 tp
-div tp a1 s3
-addi x0 a2 -2001
-srai s3 s7 15
-add a0 a3 s3
-add s4 s3 s5
-addi t6 a6 -1725
-slt a5 tp t0
-slli a0 a2 21
-sub gp s7 a1
-remu ra t6 gp
-add a7 t1 a6
-srli gp s4 13
-mulh s10 s9 s6
-sltu s0 s4 t4
-sra s2 s8 gp
-srl a0 a1 t5
-remu s5 ra gp
-sltu s10 s10 t6
-add t6 s0 s9
-and s7 a6 s8
-sub s3 s8 gp
-mulhu s0 a1 t2
-and a0 a3 s1
-div x0 t4 gp
-slli gp s9 18
-andi s11 s8 -865
-srli s2 t4 2
-rem x0 a6 t1
-ori s0 s9 628
-slti s0 x0 19
-slli s1 a1 27
-sll s4 a5 t4
-or t3 s10 s2
-slti t5 s9 -1418
-sltu a1 s2 t1
-sra ra s10 s8
-add a0 a4 s11
-mulh x0 s11 s11
-or x0 a1 tp
-xori s11 s10 -2040
-sra s3 t3 s3
-ori a0 s4 -660
-divu s4 s2 t2
-mulhu s7 s4 s4
-addi x0 a3 -161
-div s6 s2 x0
-srai a1 s4 17
-ori a2 s3 -152
-slli s1 t3 11
-add x0 a7 s1
-div s1 a5 s1
-rem s1 a3 t1
-sltiu s4 t0 -187
-mulhu a6 s2 a5
-div ra t2 s2
-xori t5 s10 -891
-ori x0 s2 -525
-srai s5 a1 19
-add s5 ra s3
-sll s11 x0 s0
-andi a5 s8 -1689
-srai x0 s3 12
-slli a6 s8 8
-and gp s1 t5
-xor x0 s4 s5
-slt s10 s11 s5
-xor a0 a2 s0
-sll t3 s6 a0
-sra s10 t0 a7
-mulh s10 tp gp
-sub t6 s9 t3
-remu s10 s6 gp
-slt a4 t2 s11
-andi s10 s4 -1846
-srli x0 s1 0
-remu s0 tp a3
-remu s9 s8 a5
-mulhu ra s5 s11
-andi x0 a6 -243
-divu s8 s9 a4
-srli t5 a0 2
-add s5 t2 a1
-srl s4 t6 a3
-rem a5 gp x0
-srli t1 s7 23
-divu s8 t4 tp
-mulhsu s6 x0 t4
-addi a0 a4 137
-and s8 s9 x0
-div t4 s3 gp
-div s6 ra s10
-mulh t5 a1 s11
-mulh gp a4 a0
-slti s2 a7 -1813
-sub s1 s0 a6
-srl s5 s3 gp
-srai tp s0 7
-srai s10 t0 24
-rem s5 t6 s11
-sub a3 t2 s4
-slti a4 s8 -1688
-div a1 t2 a7
-remu a4 t0 t1
-or s2 gp gp
-mulhu a2 t1 a0
-sub s7 ra a4
-xor a1 s11 t1
-mulhu x0 x0 s6
-sltiu s6 s2 -994
-andi s5 x0 1650
-andi s10 x0 -1935
-slt a2 ra tp
-srai s11 s7 9
-mulhsu a4 s0 a0
-andi x0 s1 -1262
-add a1 a3 t5
-sltu t3 a6 t4
-divu a0 a1 t3
-sltiu s2 a1 -2040
-div s0 t6 s3
-remu a7 s5 t0
-slti t0 s0 335
-sltu s9 a4 x0
-ori a2 gp -1005
-xor s4 t5 a6
-lui s6 494440
-div s7 s3 a1
-srai a3 a4 19
-addi s1 s5 434
-sltiu s9 gp -16
-srai s0 t0 13
-auipc s10 307550
-sltu t6 a0 t2
-mulhu a7 s0 s4
+divu t1 s8 x0
+sra t5 t2 ra
+mulh a3 s10 a6
+slli ra s0 27
+sltu s8 a0 t1
+and s1 s9 s4
+add a7 s10 a5
+srl t3 a7 s5
+srli s5 t5 31
+sltu x0 a0 t0
+and s0 a7 s0
+sra t1 tp t3
+mulhu s1 a6 x0
+div s5 t0 a1
+slt t5 t0 x0
+srl s1 s7 s4
+sltu s8 t6 s6
+add s4 t1 a5
+and s1 tp s2
+sll a5 x0 s0
+slt a3 t4 s8
+lui t6 63964
+mul a6 ra s2
+mul a4 t2 s11
+or a5 s4 s6
+divu t5 t3 t1
+divu s3 t3 s4
+lui s8 743888
+divu x0 s10 ra
+srl t3 s7 t4
+andi a0 a4 -1520
+slli s6 s8 1
+div t0 s10 s7
+addi a2 gp -1487
+slti a7 a7 -1408
+mul s10 a7 x0
+and s7 t2 s10
+sra tp s3 t4
+ori s9 a1 665
+and t5 tp a5
+ori a6 a0 -1682
+andi s3 s5 -855
+xori ra s1 -722
+andi t6 t3 -1825
+slt s0 t1 s11
+lui t0 503528
+rem a2 t5 a0
+sltiu x0 s4 1990
+mulhsu a1 t2 tp
+auipc t5 378741
+remu t1 a7 s1
+sra t3 a3 t1
+or t6 ra x0
+sra a1 s10 a4
+srli gp s0 15
+slti s6 x0 -1681
+sltiu tp tp 1627
+slti x0 s0 96
+auipc t3 632750
+add s5 a2 t3
+and tp tp tp
+andi a6 s10 183
+lui t2 319436
+andi a3 t6 1702
+sll s2 gp t5
+andi s8 a3 -1090
+addi a4 s10 -441
+andi t5 s0 -61
+or a2 s3 gp
+sltiu ra t2 533
+sltu t5 t1 s0
+xori s3 a4 -612
+slti s3 a1 1942
+remu a3 a5 s3
+and s4 t1 x0
+sra s10 s6 a0
+lui a3 448513
+xori t0 a3 -1594
+remu a3 a5 s1
+sra t3 s2 s9
+divu a4 s3 x0
+srai t4 a0 14
+sll a6 gp t0
+srl s2 t4 a0
+div t6 s9 s4
+andi t4 t3 1738
+sltu s1 x0 s7
+mulhu a7 t5 a3
+mulhsu ra a3 s4
+mulhsu t3 s0 t3
+auipc a7 421441
+srai x0 s7 10
+srli t3 s11 29
+mulhsu s9 x0 t6
+slt a0 s2 a3
+andi t2 t5 404
+srl t2 s1 s0
+add a5 a5 s9
+mulh t1 a0 t2
+mul a6 s7 t4
+sltu t4 a5 t4
+lui x0 7878
+andi t4 s4 -180
+sra s7 t6 s4
+add s1 a2 ra
+slli a4 a7 22
+mulhu gp s3 x0
+srli s6 s6 25
+remu a4 s7 ra
+sltiu s4 s6 -454
+addi a3 s6 1627
+andi t6 a0 -83
+mulh t4 a7 t2
+div t0 t0 s0
+srai t5 s1 3
+sll x0 a7 tp
+sltu a4 s6 s9
+or t1 s5 t5
+div a0 t2 tp
+srai a0 s5 15
+mul s9 t4 s4
+slt s5 t2 t5
+mulhu s1 s10 s8
+sltiu s3 a7 -161
+add a0 s7 s7
+sll t3 a0 a7
+div t1 s2 t3
+or s6 a3 s6
+srai s11 x0 5
+sltiu s5 s3 -1625
+sltu a7 s8 t4
+mul ra a2 a0
+addi tp s8 -665
+or gp ra x0
+xor t0 s2 s1
+add a4 a4 a7
+slt s2 a3 s1
+and a0 s3 t0
+srai x0 a7 4
+divu a5 a5 gp
+srai a2 s6 25
+slti s3 t2 -984
+sltu s8 t1 t2
+sll s3 a3 a7
+sltu t4 s8 s6
+sll s7 ra a2
+add t6 s5 a1
+srli x0 a1 31
+add t5 t1 ra
+sll s1 a0 x0
+divu ra s1 s9
+rem a2 a5 s11
+remu a3 t4 a1
+slt s9 a4 a7
+slti s4 s11 -2040
+mulhsu t0 s8 t5
+mulhsu t3 s7 t1
+xor gp a7 s3
+remu t3 ra s4
+sub gp s2 t2
+remu s6 a2 s9
+sll ra tp a5
+sra a2 s11 s0
+sltu s11 a7 tp
+mul s10 a0 s11
+sltu s10 s4 t3
+lui a0 1042321
+remu a5 t5 a7
+div t4 s2 s8
+div a4 a0 a0
+rem s1 a3 s10
+or a1 t0 s1
+addi t4 tp 678
+sub t5 t6 t3
+sub s5 t6 t6
+remu t6 t3 s5
+xor s6 a3 s8
+sltu t4 s7 t0
+xor t2 s2 t5
+add a2 s0 a5
+slli t0 s10 2
+sltu tp a4 s1
+sltiu a6 a5 -608
+sll s7 t6 ra
+xori a7 x0 767
+mulh t0 s6 s1
+xori t5 t3 697
+auipc t0 677350
+sll t4 t4 gp
+xori s10 s9 1584
+mulhsu t5 x0 tp
+and a0 a5 s7
+mul ra tp a3
+srai a6 a2 19
+divu s8 x0 s5
+srli t3 ra 7
+sltu s0 a4 t4
+andi s0 ra -529
+remu a7 ra x0
+srl t2 a5 a6
+and a5 t5 t1
+div t0 gp s2
+auipc s6 999550
+slt tp a0 a0
+div a2 ra s3
+sltiu a3 gp -104
+addi a5 s3 -134
+andi a5 t2 -1649
+slt a0 tp s5
+slti s8 a7 -554
+xor s10 ra t4
+xori a5 ra -14
+ori ra s0 -1446
+xori s7 t1 -1745
+slli a7 s4 20
+mulhsu ra t6 a5
+addi tp s10 1159
+xori a4 s9 289
+ori a3 a5 509
+andi s5 a6 -1042
+mulh t6 s8 s5
+srai ra ra 2
+rem t6 t4 t5
+addi ra s4 -249
+srli a5 a0 30
+mul a6 s6 a4
+rem a3 s9 t0
+slli gp tp 25
+srai a0 a0 24
+mulhu ra t6 x0
+xori s0 s8 444
+srl t4 t3 s1
+or a0 a1 t2
+xor s6 gp ra
+sll s1 tp t1
+addi a0 s10 -517
+and a0 a5 t2
+div s7 t2 t6
+rem s3 t1 s9
+srl ra a5 s3
+ori s0 s2 1486
+mul x0 s8 a7
+ori t3 s8 -287
+xori ra a2 -1227
+or a0 s9 s7
+mulhsu a0 s1 s8
+slli t4 s6 16
+srl s5 s10 s10
+slti ra s5 -727
+xori s2 s6 1884
+add s6 x0 a7
+mulhu a4 a7 ra
+div s4 t1 t0
+rem s0 t5 a5
+or t2 s1 s4
+srl a5 a5 t2
+sub t2 t1 a6
+xori t6 a3 -1709
+xor a0 gp s10
+divu tp t6 a6
+xor s3 s4 s0
+remu s1 t5 a4
+mulhsu gp t0 s1
+slt t2 t2 a1
+xori ra gp -1689
+andi gp a6 743
+mul s1 s10 s8
+lui a3 1031120
+remu x0 a7 s5
+slt x0 a1 s2
+slli t0 a6 31
 slli t5 t6 8
-sub x0 t5 t6
-divu t5 x0 t2
-sltu a0 a1 s7
-add s3 a3 a1
-andi s10 s11 -609
-lui s7 199952
-add s0 t6 t6
-slti t5 s2 -643
-addi t0 s9 -191
-srai gp t3 16
-mulhsu x0 a6 s5
-ori x0 s3 416
-mul gp a1 t3
-rem gp x0 t3
-or s7 a1 a0
-addi t4 s7 690
-mulh a3 s11 s5
-mulhu t3 x0 s5
-lui s3 951374
-ori t3 s0 -580
-slt s11 s7 a6
-mulhsu a1 x0 tp
-sub s10 a2 a2
-srai s9 t5 25
-mul t1 t0 s7
-div a7 s4 s11
-slti a3 t6 1842
-ori s6 s3 414
-mulhsu tp s5 a2
-mul t6 a5 s6
-addi a3 ra -832
-mulhsu a4 t0 s0
-andi s11 s7 -1212
-srl s9 s6 t0
-rem t2 t6 t1
-sll s8 s11 t6
-srai s10 x0 19
-divu s4 s10 a3
-ori tp tp -971
-divu ra s2 x0
-sltiu t5 s5 134
-andi s8 a6 -347
-xori x0 a4 1229
-and tp s10 x0
-sltu tp s6 a4
-srai s5 a7 4
-sra s6 s9 s0
-xor a2 a4 t4
-auipc a4 672868
-ori a5 x0 232
-xor s6 tp s10
-mulhu ra t2 x0
-ori ra s7 -616
-mulh s3 a3 s8
-mul gp s2 x0
-slli s7 a2 14
-xor t1 t5 s9
-slti a4 a6 533
-auipc t0 313105
+rem t3 a0 t5
+xori s11 a3 58
+sub gp s4 a5
+srl s4 t2 a7
+ori t5 gp -522
+auipc s11 363799
+slli x0 t6 5
+addi t6 a3 -669
+remu a4 s7 a7
+sra a4 a5 s9
+slli s10 s11 31
+add x0 t4 a1
+auipc t0 983673
+mul t0 s6 s11
 sra a7 a3 gp
-or t1 s2 a6
-lui t1 1000052
-xor a3 s3 t3
-addi s0 s1 643
-mul t4 s2 s2
-andi s5 t6 -894
-divu s8 a3 s8
-slt t4 s9 a0
-slti s3 t4 -666
-sra a4 a7 t4
-rem s0 s3 s6
-slti a4 s3 1956
-sub s10 s2 a4
-div a3 s10 a6
-div tp s7 a6
-mulhu s7 s0 t2
-sub gp ra t0
-remu s3 s3 t5
-mulh t2 s3 t2
-xori x0 a2 755
-srli a1 x0 18
-and s8 t0 s2
-auipc t1 838090
-ori s9 s4 791
-slt x0 s0 t2
-sltu gp s8 t6
-and t2 t4 t4
-mulh tp tp s8
-mul s7 ra s5
-sub t0 s6 a3
-addi a3 a3 278
-slti s0 s0 1720
-mulhu a1 s11 t5
-mulh gp s1 x0
-slt s8 s9 t5
-andi t0 a3 -97
-rem a2 t0 x0
-srli s3 a7 27
-div a4 a7 a6
-slt s0 gp s4
-xor a5 s5 s4
-sltiu s6 s2 837
-slti s5 gp -984
-sra a6 x0 s11
-slt t5 t4 s2
-sra t0 s11 t0
-lui a2 298021
-mul s8 s1 t3
-mulh a2 a1 a2
-addi a0 s9 479
-divu a0 t6 a7
-lui a2 762492
-ori a4 t2 1374
-srai s10 s4 6
-sll x0 t4 x0
-and s0 t2 s3
-sra s4 x0 ra
-slti a2 x0 1169
-sltiu x0 a5 1561
-andi a6 t4 -1271
-srl s4 t4 t5
-slt a4 s10 t3
-srai s7 ra 23
-or s4 tp s0
-slti tp x0 -683
-xor t6 t3 a4
-remu ra x0 s1
-mul s6 s5 a0
-sll gp a1 s1
-add s0 s9 t4
-slti s2 s3 829
-sltiu t0 t5 -1232
-srli t2 s3 4
-srai s10 t3 13
-sub a0 ra s4
-auipc a6 874650
-add t6 a7 a7
-and s7 s9 a2
-or a3 s7 t5
-remu s4 a6 s5
-div s5 s4 s4
-add x0 gp t1
-mulhu a7 a4 s11
-or s5 x0 s10
-andi s5 a6 1404
-and s10 gp a5
-mul s10 t2 a3
-mul s11 a7 s8
-divu t3 s7 s8
-xor a6 a7 s4
-sra s2 a5 s7
-and a0 s5 s6
-sub a1 a1 a1
-mulh a5 gp s0
-auipc a2 471591
-mulhu t4 t4 s1
-mulh tp t2 s0
-sub a0 t5 s6
-or tp s6 t6
-ori a2 s1 270
-div s8 s4 s5
-srl s1 t0 t2
-mulhsu s5 t2 s0
-slti a4 a7 -1663
-slti s3 s11 603
-ori s5 a1 -1709
-sra gp a2 s3
-srai a6 s5 3
-mulh s1 t3 a0
-sub tp tp a1
-mulhsu t3 ra x0
-remu ra a3 s5
-ori x0 s6 -1517
-ori t0 t3 -68
-slli t3 s4 7
-and t3 s11 s5
-lui ra 566189
-remu s6 s10 s4
-addi t2 a4 -13
-srl a6 tp s8
-srai a3 a5 14
-addi s4 t6 1997
-srai a0 s8 1
-srai s5 t1 19
-add s9 a5 s3
-srli s7 x0 11
-sub s6 ra t1
-mulh a3 s7 a1
-srl s10 a2 ra
-sra gp t6 a0
-ori t5 x0 219
-mul t0 a5 a4
-divu s6 s11 a2
-sra s10 t4 t3
-andi s8 s7 -885
-mul t0 a0 t6
-andi t6 s9 -113
-remu a5 s9 s0
-auipc a1 633292
-mulhsu s5 x0 a1
-xor s9 s0 tp
-sll t5 s9 a1
-mulh tp x0 x0
-slt a5 a1 s6
-mulhu t6 x0 t1
-mulhu s9 tp s0
-srl t2 a4 s9
-divu a0 s1 s3
-auipc t0 15474
-divu s6 tp t3
-sll a2 s2 s9
-addi a6 a0 -1752
-and t2 s6 a0
-mul t5 s5 s11
-sll x0 s1 a7
-xor x0 ra t0
-mul t2 tp a4
-slli t5 t3 14
-sra t4 tp s1
-sra a1 s11 a7
-mulh s0 a6 s10
-mulhu s1 gp s10
-sub s0 s7 a7
-remu a4 s11 a7
-mulhu s6 t2 gp
-addi s2 s7 -1882
-sltiu t0 s3 1303
-mulh a3 s8 t3
-remu a4 s0 s3
-sra s3 x0 a4
-slli x0 a4 2
-srl tp a7 s6
-xor s2 t0 s11
-divu a5 a2 t1
-mulhu ra s10 s1
-sll s10 a1 tp
-ori s5 x0 -1321
-divu a5 t4 a1
-sll gp s6 t2
-mulh t3 t5 s7
-mulh s10 s8 s4
-and a2 ra t3
-srl t5 a0 a3
-sub t0 s2 s2
-divu a5 t2 s11
-or t5 a2 a4
-xor s7 a5 s11
-srli t2 a3 9
-mulhu t4 s1 a3
-slt x0 t6 tp
-sra tp t2 s2
-ori t0 x0 -710
-srli t1 s2 15
-ori t3 t1 -428
-srl a2 s4 a4
-auipc a0 750885
-sra t5 t5 gp
-div t4 tp a3
-sltiu a2 x0 -766
-ori t6 t6 483
-andi t5 t0 791
-lui s9 111429
-slti s0 a3 100
-slti t4 s1 -833
-sll t6 s6 s9
-slli s10 t5 23
-sra s1 a5 s3
-or s2 t0 a0
-ori t2 a5 -1373
-andi a2 s8 -9
-sll s7 a7 s3
-srai s3 t4 2
-add s10 gp t1
-sll a5 a7 a4
-add a3 a7 t5
-mulhu s5 s5 s5
-slti s2 a5 471
-divu x0 s9 s6
-ori x0 t6 -1934
-add t6 s8 t0
-sub s4 t4 s1
-xor t6 ra t4
-divu a3 s0 tp
-srai s2 tp 2
-andi s11 x0 -1365
-slti a3 s3 -818
-rem s9 s8 a4
-mulhu gp s10 s1
-sltu x0 t0 a5
-addi s9 s6 640
-slti a1 x0 -1793
-slt s0 a6 t6
-mul s3 s2 s3
-ori s11 t0 -581
-andi s10 a6 1567
-srli a1 s3 18
-xori t5 s10 -203
-xor x0 t3 s1
-sra x0 a6 t5
-mulhsu s10 a5 t1
-lui s0 972507
-xori a3 tp -2012
-addi a5 t4 1272
-slt s8 a7 s10
-xori a4 s10 -795
-remu s11 a7 s6
-mulhsu tp x0 s3
-sra t3 s11 s9
-sltiu s8 t1 -960
-lui t5 548706
-lui a1 710335
-sltu a5 s7 t0
-xor a4 s4 s4
-andi t4 gp -908
-srai s11 x0 28
-sll s0 x0 s7
-or s8 x0 s6
-mulh t1 s10 a5
-xor a6 a0 a1
-slli a2 s9 6
-sub a6 t3 a2
-or gp ra s9
-slli t2 s9 30
-srli a5 a2 25
-sltu s1 a6 s4
-sra s0 gp t1
-xori s4 s5 1839
-sub s10 a0 t1
-slt t6 a3 a7
-or t6 a4 s11
-rem s11 a4 s9
-sub s0 x0 t6
-mulhsu s6 s7 gp
-xor a1 a0 s0
-sub s3 a1 t0
-slt s10 s9 t6
-remu t1 a1 s9
-add t4 a4 a1
-slt gp s5 a0
-srai t2 x0 23
-slli s7 s0 22
-xori s4 t4 -362
-addi s6 a3 -1539
-mul a5 t3 t6
-mulhsu s6 s1 s7
-mulhsu t2 tp x0
-slli s3 a0 4
-slt s9 tp t3
-xor tp t0 t6
-auipc s4 876400
-divu t6 a3 x0
-srl s6 t5 a0
-and s11 tp s4
-andi s4 s6 1864
-slt s1 s9 s9
-sra s9 x0 t0
-srl t4 a7 a4
-lui a5 932251
-or x0 s10 s2
-slli a7 s2 11
-mulhu a7 a5 a6
-mulh s0 s8 t4
-srl s0 t3 t3
-srl s10 s9 a4
-andi ra x0 -1100
-div a5 t6 s3
-xor t1 s0 x0
-mul s3 s5 a4
-srai s4 t5 11
-lui x0 1002461
-xori a0 x0 -1206
-slli t6 t0 11
-and t3 t5 s5
-mul s4 tp t3
-slti s3 gp -1991
-sll x0 t2 x0
-mul s5 s9 a5
-sltiu x0 t6 -139
-mul tp ra x0
-srli a6 a4 11
-and x0 s7 ra
-rem t1 t2 s0
-sltu s7 s2 s4
-rem s9 tp s10
-sll a5 s9 ra
-sra ra s1 s3
-mulh a5 s9 s3
-andi t0 a4 -1253
-rem t5 a0 s9
-divu x0 a3 s5
-sltiu s4 t1 -1820
-or a2 t4 x0
-slti a6 s4 -217
-mulh s0 s5 t5
-sltu s6 ra s3
-add s0 x0 tp
-remu s4 a5 t4
-sltiu s0 s0 -119
-mulhu s2 s3 x0
-rem s4 a6 t4
-add s8 t4 t6
-xor s2 a5 s3
-sll s3 a6 s6
-ori tp s3 -1933
-mulh s8 t4 gp
-div s1 a1 s10
-mulh s3 a3 t5
-auipc t6 506372
-rem t0 t6 ra
-slti t2 s11 -682
-divu t4 a4 s1
-and x0 s10 tp
-srl t3 a3 s7
-auipc tp 13210
-remu a4 a7 s0
-or a5 s5 s4
-mul tp gp s4
-div s6 s2 t2
-mul a6 t3 s2
-divu a4 x0 a3
-and t3 s2 t6
-xori s11 a4 390
-andi a6 ra 557
-remu s5 s8 s6
-mulhsu t2 s6 a4
-ori s5 s8 -1063
-mulhu t1 a0 t6
-addi a7 x0 -1383
-sra ra a1 a5
-lui a5 304734
-sub t4 s2 s2
-sll a2 x0 s2
-srl s8 ra x0
-srli s6 s7 15
-remu s9 s2 s3
-srl s2 t3 s6
-andi s11 s5 -547
-mul s7 s9 x0
-slti t3 s6 1114
-slt gp gp a7
-remu s10 t0 t6
-rem s11 s3 a0
-mul s5 a5 a2
-addi s1 s6 -1596
-mulh t1 x0 t0
-slti s0 s5 -21
-srli t5 s4 5
-mulh s1 t6 x0
-lui a2 983722
-ori t0 a0 -176
-mul tp a0 a7
-divu t5 a3 x0
-addi s1 a4 987
-sltu t3 s6 t1
-srl s0 a7 t4
-slt gp a7 t4
-xori a0 a4 1465
-slli s11 s7 29
-xor s3 a4 tp
-lui x0 57541
-auipc s5 682547
-mul s11 s9 tp
-div s6 a2 s0
-xori t0 s2 888
-sll a5 s10 t6
-slti t0 a3 -311
-divu a2 s4 t4
-sub a6 t2 tp
-div t6 a1 a4
-andi s2 a7 -780
-srl a1 t6 a2
-sltiu a5 gp -1123
-sltu tp t1 t5
-srli s8 s9 9
-srli t3 ra 21
-slt t0 t3 t0
-mulh a1 x0 s5
-mul t4 a3 t2
-and t3 s7 s10
-mulhsu s0 a1 s8
-or s8 s3 a4
-mulhu a2 s10 a6
-mulhsu x0 a0 s2
-mulhu s2 a7 t3
-slti s10 s10 -217
-xori t3 t6 -1104
-sra ra ra s2
-slt a2 a7 s10
-sltiu s5 a7 261
-lui t6 698445
-divu a5 t1 s3
-srl s11 s5 t6
-mulhsu s1 ra t0
-ori s3 a5 -1666
-and tp t1 x0
-sra a7 a4 s7
-srl s11 t6 t2
-rem t1 a4 s1
-mul t4 s10 x0
-mul s10 t4 ra
-mul t6 s4 t4
-andi t4 s6 666
-ori s9 a7 -975
-divu ra s5 a6
-mulhu s1 a6 s0
-sub x0 t0 a0
-srli t5 s4 19
-ori a5 a6 -202
-mul a5 s0 gp
-mulhsu a2 t6 s5
-xor a2 s3 a0
-div a1 s9 s3
-div t3 t0 gp
-remu gp ra s0
-slti t6 a3 -674
-mulhu x0 s10 s6
-auipc t0 480123
-slli t3 a7 3
-srli t1 gp 11
-mulhsu s1 t3 t4
-add s8 t6 s11
-srai a0 s11 4
-srl a6 s8 a0
-sltiu s1 t6 423
-srai s9 a3 4
-rem tp a0 s2
-or s3 t4 t5
-srl ra t2 a4
-srai s5 a3 22
-lui a4 432731
-slli t5 a1 11
-add t1 s2 a7
-ori t2 t6 -932
-andi t1 a1 -1581
-srli t3 s0 13
-mulhu s11 s8 a2
-ori t0 tp -694
-srai t0 t3 7
-auipc a4 621463
-mul s11 t4 a1
-ori t6 x0 -1758
-div a4 s5 t1
-add tp s11 s5
-auipc t3 446087
-lui a3 549074
-xori t4 a7 -919
-xor tp t5 t1
-sltiu s8 tp -863
-mulh x0 a3 s4
-andi s5 tp 1936
-div a2 t3 x0
-lui s7 114102
-sll a2 t2 a2
-rem a0 s5 a6
-srai gp a5 23
-mulhsu ra t5 s8
-auipc a5 63846
-div s3 a0 s9
-mulhu a2 t1 s4
-srai a6 t0 15
-lui s0 259988
-auipc t5 101909
-div a6 gp a5
-xori s5 s3 -347
-mulhu s9 s2 t1
-slti s10 t4 486
-addi a3 tp -1203
-lui s4 206728
-sra t1 t4 t0
-mul t1 a5 s10
-srli t4 gp 16
-auipc x0 555323
-div s0 t5 a2
-sra a3 s1 t1
-sra a3 a7 t0
-div s10 s5 s6
-sub t0 a6 s1
-auipc t1 635822
-addi t2 t1 -521
-slt s7 a0 s8
-lui s8 316181
-sll x0 a0 s3
-srli t4 gp 2
-divu s11 t1 t2
-or a2 a3 a3
-lui a3 223087
-sra gp s5 s1
-slli t2 a2 14
-andi s1 gp 457
-ori gp a1 -64
-andi s3 s1 1432
-srai t6 t5 1
-xor t0 ra s10
-xor x0 x0 s0
-slt t3 s9 a4
-remu s9 s9 s10
-mul s0 a5 x0
-xori x0 t4 793
-or a5 s8 s11
-xori gp s6 1985
-lui s4 958801
-addi t2 s3 -1448
-srl a2 s5 s1
-lui x0 757838
-slt ra x0 t3
-mulh s8 a1 gp
-sra s9 t4 s10
-srli tp s8 0
-divu s3 a7 x0
-sra gp gp t4
-mulh t3 a6 x0
-remu t6 s4 s10
-mul s11 t6 t3
-or a4 s2 s5
-slti s4 a0 -484
-srli gp a1 24
-sll s4 x0 s3
-srl t3 s9 a5
-slli gp t3 26
-auipc s6 211778
-and a5 t3 t0
-slti s4 s9 -1970
-lui a6 630127
-or a7 a1 a2
-sll t6 x0 a1
-xori a3 s6 -1816
-add s8 s1 a3
-srli t0 t3 12
-lui t2 122333
-mul s7 t6 t3
-xori t5 a6 -771
-mul s3 a2 a6
-mulhu a3 x0 gp
-mulh x0 s9 t4
-xor s0 s9 s9
-sltu t5 a5 s7
-divu x0 a7 a5
-sltu t4 a4 a3
-sll a0 s9 a4
-srl t5 s2 s3
-slt t4 s7 a2
-sltu a4 s7 ra
-srai t1 s2 21
-auipc a5 1004275
-slti s8 s5 -395
-xori t5 a0 1569
-slti s11 gp -1712
-slt t4 s2 t3
-mulh a7 a7 a5
-sra x0 t1 gp
-sra a7 a5 a4
-remu a7 ra a7
-addi a3 a6 1225
-lui s2 122231
-mulhsu t1 s1 t3
-srli s8 t2 8
-addi s2 t0 -1420
-srai a3 a4 19
-xori s10 s6 1442
-remu t0 s8 s4
-mulhsu a5 t3 t1
-add s10 t3 t5
-slti a2 t0 -1960
-xori s3 a7 -257
-divu t6 s10 s8
-div s0 s8 s3
-mulh s9 s1 s6
-mulhu s3 a5 a0
-mulh a3 tp s2
-slti s0 a3 -1310
-and s9 a5 t0
-srl t5 s11 s3
-ori t3 t6 -208
-sll a5 s1 t6
-remu a4 a4 s4
-mulhsu s1 s9 gp
-xori s10 a5 -1743
-lui s11 671483
-remu a7 s10 a2
-sll a3 t2 t0
-mulhu s2 s1 s9
-srli s9 t5 12
-slt ra s0 s4
-mulhsu a0 t0 s9
-slli s8 s3 12
-xor a0 a3 s0
-sub ra t0 s2
-mul s8 s3 a0
-andi gp s3 -1872
-srli tp s0 1
-srl a3 a6 x0
-andi s4 x0 -889
-and a5 a6 x0
-lui t5 20136
-sub a3 a7 x0
-mulhsu tp s10 a2
-srli s4 s6 7
-slti a0 t0 -348
-mulhu t0 s8 a6
-mulhsu s1 s10 t0
-srl tp ra s0
-sub t1 a2 a3
-andi s10 s1 -481
-xor a4 a2 s11
-sltiu t4 s9 -926
-sltu t5 x0 ra
-sltiu t5 tp -1189
-div s1 t0 s6
-srl x0 t5 s6
-mulhsu t4 s8 s11
-or s3 t5 s10
-sll tp s2 t5
-and s5 x0 s1
-xori t2 s4 1221
-remu gp s10 x0
-andi a4 s4 14
-addi x0 s0 -1277
-rem s0 a2 x0
-and s8 s1 ra
-sltu t3 s4 s8
-auipc s6 435117
-auipc s8 510651
-div a6 t4 a0
-srl s1 a4 a6
-ori ra a2 -1880
-or a4 gp a3
-slti s9 a5 995
-addi t4 s8 -59
-srl t1 s1 a6
-div s5 x0 a0
-or t6 a4 t4
-ori s10 a5 -1923
-srl x0 tp a6
-slti s1 t2 1869
-lui t6 547948
-mul a3 s10 a5
-mulh s4 s7 t2
-sra s3 x0 gp
-andi s0 s6 193
-sub tp gp t3
-sltiu s0 gp -744
-sltiu s7 s11 -105
-srl a4 s5 x0
-slli ra a3 20
-slt s6 t3 x0
-andi a3 t3 -896
-srl t0 s8 s10
-addi t3 t4 744
-and s11 s7 s5
-mulh s2 a3 s6
-srl t6 s3 s0
-slli t1 a3 6
-mul t6 s11 s11
-div s8 a2 s7
-mulhu a2 s4 t3
-rem s3 s4 a6
-xori t5 s8 -113
-sltiu a7 s4 -1195
-slli s10 a2 19
-div a5 a3 t0
-addi a3 s5 -370
-addi a2 s9 -1802
-xor a1 a3 a7
-slt s4 s4 s4
-ori a7 a3 279
-slti tp s9 -1000
-ori t2 ra -1225
-div t2 s10 s2
-slti s9 s7 1404
-ori s9 s5 -1825
-and ra t6 t6
-sra s4 t1 a7
-ori t5 s3 689
-lui a4 395349
-rem t5 s5 t3
-rem t0 s6 a5
-mulhu s0 a6 t0
-xor x0 s8 s2
-mul s2 a5 a3
-slt s6 s1 t6
-xori a4 tp 1003
-slti t2 t1 462
-and a6 s4 t3
-xori s10 s0 -1888
-ori s8 s11 -1238
-add t5 a7 s9
-mul t4 ra a0
-auipc s1 379338
-sub s3 s3 s3
-auipc s4 287830
-sll t1 a5 a2
-mulhsu s5 a2 a0
-xori s9 s5 324
-sra tp a6 ra
-slli a2 a1 16
-add t3 t4 a7
-mulhu t2 t4 t4
-addi s6 s2 -44
-slt t1 s9 s2
-xori a3 a1 -1855
-mulhu t0 a2 s7
-divu t4 a4 t6
-sltu s10 s10 t0
-andi s0 s7 126
-divu a5 s11 a4
-addi s1 s2 726
-and a1 a1 ra
-div s2 t6 t4
-mulh s0 a5 s0
-srl a4 s2 s0
-slt t5 ra s5
-slli a2 s10 17
-or s11 gp s0
-sub t2 t6 a0
-rem s11 ra t3
-addi x0 t4 -1893
-sra s9 gp x0
-div x0 a7 t2
-slt x0 a6 a7
-srai s10 a1 11
-xori tp t1 -1565
-srli a3 a1 23
-xori x0 s7 -232
-srl s7 t2 t1
-rem s1 s2 a1
-sll s0 s9 s9
-mulh gp s3 s3
-xori a4 a1 -1051
-xori ra a7 -1623
-xori gp a5 -236
-sltu t2 s9 t5
-addi t5 x0 -1970
-mul ra s1 t3
-ori s1 t5 1531
-lui t2 469838
-sub a3 s4 s0
-div a2 s1 x0
-slt s6 x0 s7
-xor a3 gp t6
-andi s9 a7 -1858
-mul a1 t4 s3
-and s0 s10 s9
-auipc t4 719211
-xor ra s4 t2
-sra a7 ra s6
-sltu a3 s5 s3
-srai tp s11 20
-lui t4 602710
-sll a6 x0 s3
-addi t6 s6 -865
-sll ra s4 a6
-mulhu s0 x0 a0
-slti a0 x0 -18
-srli s2 t4 19
-srai a6 t4 5
-sltu s0 s4 x0
-slt s0 t1 s5
-or s7 s8 s11
-lui s5 218963
-mulh s3 t1 x0
-xor x0 t4 a5
-andi s11 gp 1736
-xor a4 t5 x0
-mul a5 a5 t4
-or a5 s11 x0
-sltiu s9 t0 -1499
-auipc t3 323487
-slt a5 s11 s10
-mulhsu t4 a6 t2
-auipc s1 601940
-slti s5 t4 -382
-sub s0 tp s3
-xori a7 s11 -82
-slt t1 t4 s11
-sltiu s8 a2 -1411
-sll s7 a2 t0
-slt s3 s6 a5
-or a2 x0 s1
-slt s9 s8 s6
-srli a4 t6 3
-slli s10 x0 24
-sra a1 x0 t2
-srai a0 ra 31
-add s7 s0 a1
-slti s4 s7 687
-ori tp s4 -1868
-andi s6 a0 -1327
-sra a0 t2 a0
-slli t0 s9 29
-ori t0 a1 -1197
-ori x0 a6 -141
-lui t2 238731
-rem t6 t5 t2
-remu s11 t5 a6
-sra s8 t3 t3
-mulhu t3 a7 s2
-xori s0 s1 -1061
-add x0 s1 s10
-ori t5 s5 -1313
-ori s7 s5 -1693
-slli t1 a5 20
-or t5 t6 s2
-divu a0 s10 t4
-div ra s9 a0
-srli t3 a3 26
-divu t5 x0 a3
-and t1 a3 t1
-andi t0 s10 -1038
-divu s4 t5 s8
-mul a1 x0 t6
-sra t3 s0 t6
-or a3 a6 a4
-andi s9 t2 -154
-addi ra s2 -1827
-slli a7 t2 31
-rem a2 t5 s2
-lui s0 482443
-div ra a7 s7
-and s5 s6 a5
-addi ra a6 -1250
-or s8 a4 s2
-divu a3 s8 a5
-sra s9 a0 gp
-sltiu a5 s8 -1888
-slti a4 x0 -784
-remu s6 s6 a3
-sltiu a2 s1 1167
-lui s5 604089
-sltu s2 a1 s0
-sltiu a5 s6 -666
-add gp a6 t6
-or a2 t1 s11
-addi a0 a7 -1784
-xori x0 s1 -1916
-xori s7 s1 1381
-divu t5 s11 a3
-mul gp t1 t4
-slti t6 a4 999
-lui s9 236509
-ori t4 s8 -1172
-slli t0 s9 20
-xori x0 s11 -1769
-auipc s5 48898
-ori a3 s9 -1721
-or t1 a4 s10
-sltiu a2 t1 -138
-div s3 ra a1
-slli a5 s9 6
-mulh s1 s10 s7
-srai tp a6 31
-xor t1 a7 s2
-mulhu s0 tp s9
-auipc a7 510285
-srl ra gp s7
-sll s3 s8 a3
-or s9 a5 a4
-divu s1 a0 a3
-srli tp s3 0
-slli a5 s10 18
-sll ra s9 t3
-divu a4 s11 t5
-srai s6 a2 29
-sub s3 t4 gp
-remu x0 tp tp
-mulhu s1 a0 t6
-rem s8 s8 a1
-remu t3 s10 t4
-div s5 a3 s6
-lui a7 926023
-sltiu a4 a4 -641
-srai gp ra 12
-andi s9 s7 -362
-sub s5 t5 s1
-srl tp x0 s6
-sll a2 x0 a7
-srli ra a0 28
-and t4 t6 t6
-mul a4 t0 a0
-mul t6 s5 t4
-ori t6 t2 -1077
-sltu x0 a4 a0
-sub t3 s5 t0
-or a6 t4 a7
-sltu s5 t4 s0
-remu a1 t3 s8
-auipc s6 43047
-or ra a2 s11
-addi s9 t3 -1972
-add x0 s8 s6
-div s10 s3 s6
-andi s3 t6 -48
-xori t3 s1 -601
-mulhu t6 s0 a0
-remu t2 s3 s1
-divu s2 a4 s8
-auipc s4 275360
-auipc t2 993714
-and a2 s2 a1
-divu a4 gp t2
-xor s4 x0 s7
-sll x0 s1 s6
-sll t2 x0 a3
-slt t5 tp a4
-slt s7 x0 s11
-srai a1 s11 17
-slti s6 gp -1144
-add s6 x0 s11
-sra a4 t2 t3
-srai tp s10 26
-mulh s5 t5 a2
-srli t6 t2 17
-lui a3 628528
-divu t2 t3 s7
-divu t0 t4 a3
-sub s9 s8 s0
-ori t6 s5 1159
-srli a5 gp 30
-sll ra a4 ra
-sub s4 t1 t2
-divu gp ra s11
-rem t3 a5 a3
-slt s1 ra t2
-slli s0 a2 3
-slti s3 t5 -1983
-andi a3 t6 -2045
-remu s8 s11 x0
-sub s11 t3 a2
-addi s9 s7 776
-sltu a0 a1 t3
-srl a5 s3 a3
-add a4 a5 t0
-andi a3 t4 -595
-srli t4 tp 13
-slti a7 s3 -955
-srl s10 a3 s8
-sltu tp gp x0
-srai t5 t3 25
-sltu t3 x0 a0
-auipc s3 1045742
-mulh a4 ra a4
-and a5 s11 s4
-or tp t2 gp
-lui ra 754069
-andi a6 s9 -1126
-remu t0 s0 a0
-sll ra s1 a3
-andi t2 s1 -454
-rem s11 a5 s4
-ori t0 s5 1354
-mulh t6 gp s6
-sltiu s9 a4 1420
-divu t4 s9 tp
-divu s0 t1 tp
-slli s10 s11 13
-xor tp t1 t6
-xor t1 t1 x0
-divu a5 s3 t4
-or a4 x0 a7
-divu s1 s3 gp
-mulh x0 s4 s10
-and a2 s7 t3
-mulh s1 t3 a6
-srai a3 t5 6
-and a1 a2 x0
-mulhsu s2 t1 s0
-slli tp t5 17
-ori a3 s6 -308
-srli x0 a7 14
-divu a5 t3 a0
-srli tp ra 16
-sll s0 ra s8
+lui s4 18779
+srai s7 s6 27
+ori a7 s4 -1193
+sub a7 t0 a4
+sltu a4 t4 s10
+andi x0 a4 -133
+sub s8 ra ra
+slt gp s8 a1
+sub s8 tp a5
+sra s10 x0 a2
+ori s7 a1 -656
+mulh s4 t2 a1
+or a0 s7 s10
+remu a2 s9 s4
+sltu s5 t4 t4
+xori s2 a6 -1961
+or s4 s2 s3
+mulh a3 ra a2
+mulhu tp gp s2
+or x0 a0 s3
+xori s1 ra 1375
+addi t3 s9 -1139
+sub t4 a3 s5
+remu a0 tp t6
+mul a3 s1 ra
+mulh s10 t4 x0
+slti a4 tp 539
+auipc s0 16646
+mulhu a7 t4 s9
+rem s11 s4 s2
+add s6 s1 s7
+srai s9 s8 1
+srai t6 t0 17
+slt s7 a2 s9
+slli s9 s8 18
+mulhsu t0 ra a7
+sltiu s10 t3 -153
+or t0 s6 a4
+mulh t1 a6 a1
+sra tp s10 t3
+sll t5 s5 s10
+rem a3 s8 s8
+mulhu s11 t0 s6
+sub a5 s10 s3
+xor s3 x0 ra
+slti a6 s0 -714
+slt a0 a1 t6
+auipc s7 692164
+srli s11 s4 5
+remu a5 a6 s10
+and a2 s7 gp
+slti a1 a6 955
+sll a0 a5 tp
+srai s8 s10 15
+slti a0 t5 -1005
+and s1 s10 tp
+ori s0 t4 -203
+sra a5 ra s4
+remu x0 ra s2
+add a1 t2 tp
+srai a3 a2 23
+div gp t6 t0
+rem s1 t4 x0
+mul t4 s10 a1
+slli t2 x0 4
+remu a3 t6 s8
+add a1 s7 a3
+auipc ra 621965
+xor a0 s8 a6
+mulh a2 x0 t5
+and t5 s4 t0
+mulhu a2 tp a3
+add x0 t5 s0
+add s4 a6 t6
+xori s3 s9 -524
+ori s8 ra 855
+or gp a5 s5
+ori t4 t0 -328
+ori x0 t5 -318
+sub s8 s7 a3
+xor a3 a6 x0
+auipc t6 583326
+divu s10 s0 t2
+rem t6 t6 a1
+auipc t3 810149
+srai s9 a4 7
+remu ra t6 s10
+and x0 s10 s1
+mulhsu t5 t0 a1
+and s4 tp t0
+slt s10 s0 a3
+mul s4 x0 t2
+srli s2 a2 31
+lui s2 906418
+rem a5 s10 x0
+srai s5 a5 31
+sltu s7 s11 ra
+and a5 a2 s3
+sll a2 a4 tp
+srl s2 x0 s8
+slli x0 s7 1
+sub a4 a1 tp
+mulh x0 s9 s2
+sltu a0 gp s3
+mul s2 ra s11
+slli x0 t2 1
+slti a4 s5 1441
+lui t3 878177
+slti s5 a1 -1433
+mulh t5 s7 t3
+sltiu s11 s7 1120
+addi a7 s10 -1660
+addi s10 t2 1558
+andi s7 s10 -960
+xori s2 s6 -35
+auipc tp 497063
+sll t2 a6 s0
+slt s6 t3 s9
+mul s6 t3 s0
+slti t2 t1 -1586
+andi a5 s8 1040
+mul a2 t1 a6
+rem s8 s6 x0
+remu s7 s5 s6
+lui tp 231640
+or a7 a7 s11
+srl s4 s2 ra
+xor s3 s11 s5
+mulh t5 s3 s2
+divu s3 s3 a6
+lui t3 477421
+xori a2 a0 -550
+srai t6 t3 8
+mulh a5 a7 s7
+srl a4 s4 s3
+lui a6 119356
+auipc t4 179072
+slt a7 tp t5
+lui t1 113714
+mulhsu a5 tp s1
+sltiu a7 a5 1615
+sltiu a3 s5 5
+slli t3 t0 31
+and a6 a2 a1
+slti t1 x0 -1693
+sub s7 s10 x0
+xor tp a5 a2
+sra a5 s6 s11
+remu s6 t4 s10
+sll s4 t4 x0
+xor a7 s3 s5
+sll s11 s5 s11
+slt a7 ra s10
+or a6 t6 a5
+xori s6 t4 -1183
+sra gp a3 t2
+or s3 s4 t4
+srl s5 s9 tp
+lui t0 644780
+slli x0 s0 25
+xor s2 s2 t3
+sub a5 ra s8
+mul a1 s11 a2
+andi s10 s8 2008
+srl s11 a6 s4
+add t2 a2 a4
+div x0 x0 tp
+auipc t2 563432
+div t4 s2 a5
+srli a0 t0 3
+srl s9 a0 s3
+slli s3 a7 18
+auipc a0 1029167
+slti s9 a2 -500
+sub s11 s0 s11
+sll a3 a3 t6
+mulh s7 s7 s0
+sll a1 t2 s7
+sub t6 s5 a4
+slt s4 a4 a4
+addi s2 s8 875
+sub s6 gp s10
+srli a7 s0 22
+divu t1 s1 s10
+andi s9 a6 -1687
+slli t0 a4 29
+srl t1 t1 t2
+mulh a6 s5 s9
+rem ra s5 t6
+sltiu a1 a3 1169
+auipc a6 793633
+div x0 a0 s8
+andi t1 s4 -340
+and a3 t3 x0
+mulhsu t2 s4 x0
+ori s1 gp -1643
+slti a3 a5 1333
+lui a2 599222
+andi a6 a0 -1006
+mulh s3 a5 s4
+sltu a0 a6 x0
+remu s4 x0 t5
+sub s5 s3 s3
+ori t1 s2 -1667
+sltu t6 a1 t2
+ori s7 a6 21
+rem s7 s10 a6
+sub gp s0 a6
+srli a4 s5 25
+slti x0 x0 -693
+slt a0 t2 a4
+slli s1 s4 1
+remu s10 tp s6
+and a0 t3 ra
+divu a3 a6 t5
+slt t1 t3 t3
+and s1 t2 ra
+mulhsu s8 s4 a4
+slt a7 a0 t4
+or a0 tp a2
+addi a2 t3 -1007
+ori s3 gp -732
+xori a5 gp -1681
+divu s4 s8 t3
+mulh a5 t2 a4
+rem t2 t1 a3
+srli s0 s10 2
+remu s2 s4 s11
+sltu t2 x0 a4
+addi s6 t6 408
+sub s9 t1 a6
+slli s0 t5 3
+mulh ra s4 s3
+sll t6 ra a4
+slt s9 a3 a4
+divu t0 s10 s9
+sltu s11 s9 a1
+andi t4 t0 1297
+xor s5 s8 t5
+add s4 a4 a0
+slti s10 ra 283
+div x0 x0 x0
+srl a4 s4 a2
+xori gp a4 -809
+rem x0 s4 s9
+sll tp s2 a3
+srai a5 s9 20
+mulh s3 s5 gp
+xor a5 t4 s6
+sub t6 s11 a6
+sll s9 s10 gp
+add ra s9 t3
+rem x0 s6 s2
+mulhu s5 t1 s4
+auipc a4 474598
+or s2 a1 t4
+sltiu a1 t2 2033
+srai s1 t3 24
+slti t2 a2 -302
+divu a5 t6 s0
+ori s5 a4 -559
+mulhsu s3 x0 s11
+slt tp a2 s3
+lui x0 81964
+srl s3 s9 s10
+sra a7 s3 t5
+slti t4 t0 -1197
+xor s3 s8 s0
+mul s11 tp t1
+remu x0 t3 s7
+lui t4 748617
+srli a3 t6 9
+sltiu t0 s3 -1478
+addi a1 x0 -362
+mulh ra a4 a6
+slt t1 a5 s11
+srai a7 tp 3
+slli gp t6 11
+sltiu s6 a3 60
+sub s6 s11 s2
+mulh s11 a2 t4
+slt a4 a0 t1
+lui t1 274100
+sub s9 t2 s4
+div s3 a3 s11
+xor t2 s8 t0
+lui a5 75170
+add s2 t1 s5
+srli t6 s6 6
+mulhu a2 s9 t0
+sll a1 t0 t1
+divu ra s5 tp
+srli s5 s0 23
+slt tp s2 a3
+rem t5 s4 ra
+slt a2 x0 a7
+sltiu t6 s11 -1951
+andi x0 a4 704
+ori x0 a3 -810
+lui t4 815518
+sltu x0 s3 s2
+div s7 a5 s3
+slli x0 a5 6
+lui s0 779962
+lui s11 754970
+slti a7 a0 1012
+sll gp s7 s3
+srl s2 a0 s9
+divu x0 ra t1
+auipc a0 940686
+sltiu x0 s5 1658
+sra s3 x0 s7
+sra s9 x0 t4
+mulhsu s7 t1 t1
+mulhu x0 s6 a6
+xori s11 s10 -147
+and a5 a7 x0
+slli s1 x0 2
+addi a2 t1 -744
+sltu t2 s0 s6
+xori s8 t2 -70
+sll t2 t4 a2
+sra gp t3 t1
+lui s10 5972
+sra t3 s6 a3
+sll a6 t0 t1
+slli a3 x0 3
+xor s7 a1 gp
+or a5 s10 a6
+slt s4 s0 a5
+lui s11 942786
+div a7 s5 t0
+divu t0 s1 ra
+slt a0 s11 s6
+sra gp s0 tp
+sltiu a2 s1 -1824
+sra t0 t5 s2
+srl tp s3 a2
+lui a5 594597
+ori s2 gp -1938
+divu gp s10 x0
+lui a1 994097
+sll t3 s11 s8
+divu tp t1 s3
+srli t5 s0 23
+ori a7 s6 -953
+srl t2 ra t3
+srai x0 t4 14
+divu s4 x0 tp
+sltiu s2 a2 1929
+mul s3 gp tp
+slli t4 a2 26
+add a6 a0 x0
+remu a3 s8 s3
+srai t0 s2 19
+slli t3 s10 7
+addi t1 t3 -1834
+sltu t4 t4 t2
+addi a3 a6 1196
+xori t4 x0 -1131
+ori s3 s2 -10
+mulhu t4 s11 a0
+rem t2 s8 s3
+mulh t0 x0 a2
+auipc s5 147845
+div s7 s0 a6
+auipc a2 943217
+ori s1 s11 1251
+sltiu x0 s8 -635
+divu s5 ra s7
+sll s7 s9 s9
+lui a6 952392
+sra gp t1 a4
+sll t1 t3 s1
+auipc t3 406599
+rem s1 t5 s6
+sll s11 a6 x0
+mulhsu a6 x0 t1
+srai s5 t4 13
+srl s1 t5 x0
+ori a2 t3 -698
+mulhsu t2 a2 t2
+or s8 a7 s2
+slli s8 a7 31
+slt gp t5 x0
+srl t0 t1 gp
+remu a2 t6 a4
+srl tp s6 ra
+remu s0 gp t1
+mulh t0 tp s9
+sltu t2 a1 a5
+sltiu s2 x0 1000
+add t3 a2 s8
+and s1 s10 t3
+and s10 a3 s2
+or s6 s0 x0
+srai a7 a1 11
+andi s4 t5 1799
+lui a5 671166
+srli t5 x0 31
+srl t4 s11 s8
+rem a0 t1 a4
+srli a7 t2 4
+mulh s1 a5 s4
+divu s4 s9 s9
+sra a4 t5 s0
+xori s11 t6 231
+mulh gp x0 x0
+add s3 a3 s4
+slti a4 a5 -1186
+and s8 s0 ra
+and gp a5 a6
+lui x0 448225
+xor s4 s10 t3
+slti t1 a1 -1898
+srli x0 s5 8
+auipc a7 486508
+or s8 a2 s9
+srli s7 a5 8
+mulhu s7 a6 x0
+and ra tp s11
+mulhu a0 t6 t4
+sltiu x0 s6 -163
+slt ra s7 t1
+addi s5 s3 734
+xor s9 t2 s5
+or s11 s8 a6
+remu x0 t0 t4
+divu a3 s4 s5
+slti a1 a1 -1278
+slt s10 a2 s4
+ori s9 a7 1652
+sra a6 s6 x0
+rem x0 t3 s5
+slt x0 gp t1
+srl a2 a7 a6
+div a5 s2 t3
+sltiu s11 t6 -1271
+mulhsu t0 t4 x0
+div a5 a4 s6
+or tp a2 s1
+mulh s3 gp t0
+sltiu s8 s9 -834
+mul t0 s4 s8
+sra s1 s10 t5
+lui a7 970089
+mul a1 gp s5
+sltu t4 s1 a2
+andi s1 t1 2040
+or a0 t5 s4
+srl s3 s6 a7
+sltu t1 a7 gp
+sub a2 a5 a5
+srai t0 s8 17
+mulhu t1 t4 a2
+ori a2 t5 44
+rem s8 a1 t6
+slli a7 s5 26
+srl t4 ra ra
+addi s9 x0 -288
+sra ra t2 a4
+add a2 x0 s8
+slli t2 x0 12
+xor t5 s5 a5
+srai a5 t3 11
+or t0 a4 s4
+mulhu s4 a2 a1
+sra s9 a3 t5
+slt tp x0 x0
+ori s9 x0 -39
+sub t1 a3 s3
+sub s1 tp a6
+slli t5 a4 4
+srli t3 s2 3
+slti tp s9 -911
+mul a4 t0 s11
+addi t6 s0 -1638
+mulh a5 a2 t0
+mulhsu a3 t2 t0
+slti gp s7 -1799
+add gp a4 gp
+mul a1 a7 s6
+rem t5 a2 a2
+andi t5 tp -443
+srli t4 t4 21
+mul a3 x0 s9
+and a0 a3 a6
+mulh s1 t4 t5
+div s3 t3 s2
+mulhu t1 t1 s1
+addi s5 t3 754
+sltiu a7 s4 -1087
+lui a7 426532
+andi s3 a7 17
+slli t6 a0 25
+sra gp t1 a0
+or a6 s2 t4
+mulhu x0 ra a1
+xor t0 s0 t2
+xori s4 s8 -987
+sltiu t0 s11 -1005
+xori s10 a0 -1797
+lui s2 125461
+xori a6 s8 1779
+auipc t4 774280
+remu t3 a0 a1
+remu a5 s11 s2
+mul a4 tp a0
+mulh s7 t1 t5
+rem a7 a4 s0
+srli x0 a5 16
+auipc s7 326323
+divu s3 s9 t3
+add s10 a1 s11
+slli s10 a0 23
+sltu s3 s10 a5
+sub s2 s6 tp
+sub s8 s4 a7
+and a6 s4 a7
+srl s10 t1 s0
+lui s11 171296
+sll s11 s2 s7
+sra t2 t4 x0
+auipc s10 265692
+sltiu tp t3 328
+remu s3 x0 t1
+andi t0 a3 -900
+sll t6 s11 t3
+addi x0 a2 -44
+xor x0 s4 ra
+sub s3 x0 ra
+sltu a0 a7 x0
+srli s1 s10 22
+mulhsu s11 a0 s5
+add a1 t2 s6
+sub t4 tp a3
+and s7 ra ra
+sra a6 x0 s1
+slt gp s1 t0
+divu s4 s1 s2
+mulhu t5 s3 s9
+mulh a2 s8 s5
+slt s11 t4 s10
+andi t6 s8 567
+and a7 a3 s6
+rem s5 s4 t6
+sll a2 a5 t6
+sltu gp a5 s2
+mulh t5 x0 s4
+sll s7 a2 s5
+sub s0 s0 a0
+sll t2 t4 s3
+ori s11 t4 -1833
+rem tp a0 t1
+div s4 t2 a1
+srai a3 a7 26
+sltu ra s10 s7
+div s6 t0 x0
+and tp s6 t1
+sltu s8 s0 s4
+rem tp t5 a1
+sub s10 x0 s11
+srl a1 a5 ra
+ori s10 s10 1297
+sltu x0 a7 s7
+andi t3 a7 1797
+addi x0 a0 1499
+divu a2 x0 s3
+rem a4 a5 gp
+andi t3 a6 -1305
+remu s3 t2 x0
+mulhu a0 t5 t6
+or ra ra t1
+and s1 x0 s2
+ori s0 s4 -1142
+andi gp x0 -1196
+div s9 t4 gp
+rem t6 s1 x0
+rem tp a1 t5
+add s0 a5 s4
+sltu t5 t3 a5
+sll s5 gp a4
+divu t6 s10 s6
+lui s4 925989
+srli a1 t6 28
+sra a6 a4 s1
+add s3 t3 s4
+lui s1 879018
+divu s4 a0 s9
+auipc s7 975103
+slti a0 t4 -1901
+or t2 t6 s3
+ori tp s8 -194
+andi tp s0 909
+slli t0 s10 16
+mulhsu t2 t0 a4
+slti s7 gp -1958
+slti s6 a0 1540
+xor x0 s4 a2
+addi s1 t0 1643
+rem a5 a6 t3
+slti s4 s0 -1069
+divu a5 s9 s0
+rem a1 a7 s3
+sub s0 gp s9
+slti a2 s2 265
+xori x0 s3 -246
+or s2 s10 a2
+xori a0 s9 -1103
+mulhsu t0 s10 gp
+ori s10 t1 -1158
+andi s2 s6 -805
+srai t4 t1 30
+divu s9 gp s9
+lui t0 873836
+sltiu s10 t5 -439
+add t4 t6 x0
+rem t2 s5 s2
+andi s11 gp -790
+xori s11 tp -1173
+mulhsu t6 a2 t5
+xor ra a7 t2
+slli s11 a0 26
+addi s5 t3 -16
+sltu t4 a3 tp
+srl a3 a7 s5
+slti s11 gp -1210
+xori a2 s9 -1382
+ori t1 x0 867
+ori gp a6 228
+andi s8 t2 -523
+auipc s10 89096
+mulhsu s6 x0 t4
+sll s8 s6 t6
+or t0 a5 a1
+slt a2 ra s9
+lui s8 36572
+sra a1 tp a6
+addi gp gp 1809
+addi t4 ra -924
+divu t6 x0 a6
+add t3 s2 a4
+div s10 s0 s5
+xor t4 ra t1
+divu t2 s7 a5
+addi x0 s2 1875
+add s5 s3 s9
+auipc a7 96546
+srli s6 gp 19
+sltu s3 s8 x0
+srli a1 a1 4
+or t4 s10 t2
+mulh s7 a4 s4
+ori s1 t0 339
+and t4 s10 x0
+div gp a0 s0
+slti a7 s6 -1414
+slli a7 s6 25
+divu t2 ra s3
+sltu x0 tp t4
+mulhu a6 t0 s11
+andi a4 a3 1333
+srl s1 t2 s10
+ori s9 s9 472
+slli s6 a0 9
+andi s3 a7 -1009
+sra a0 tp t1
+slt s10 a2 a3
+andi t6 a4 -1888
+srai ra s11 2
+xori a6 tp -1448
+sll s1 s3 a2
+addi a5 t6 -981
+sltiu t2 s6 1489
+mulhu x0 a7 a5
+sra ra t3 x0
+div s0 s5 t2
+divu s1 s1 x0
+srai s10 s6 24
+remu a6 a7 s1
+add s10 s8 s4
+andi a4 x0 -1496
+and x0 gp gp
+andi a6 a5 -1900
+sra x0 a4 s7
+sra s2 a6 s8
+sub a1 s9 t5
+sra a0 a7 t0
+ori s7 a7 1285
+sltu tp t2 a3
+andi t5 s8 -338
+xor s4 s6 a6
+mulh s1 s7 s8
+sra s9 t3 tp
+srl tp tp ra
+rem a5 a0 s11
+divu t2 x0 t1
+add a1 s6 t6
+addi t2 s10 -1856
+ori s6 tp 1931
+div a6 x0 s9
+addi s2 s9 -1739
+slli s3 s6 31
+mul tp s6 a2
+remu a4 x0 t1
+slli t1 a6 8
+slt s6 s11 s3
+srai a0 tp 8
+ori s10 x0 -1018
+sll s11 t2 t3
+xor x0 s9 s7
+divu a4 a2 s5
+slti s2 t4 437
+div s3 tp s4
+andi t3 tp 1523
+xori tp t0 -1541
+or s1 t2 s11
+xor t2 t4 s9
+sltu t6 a4 ra
+srai s7 s10 12
+srli a5 s0 18
+mulhu a4 a3 a3
+sra t0 tp gp
+auipc a3 954003
+srli s1 s3 23
+slti a2 s10 -470
+mulhsu s3 t1 s8
+add t5 s0 a5
+sll a7 x0 t4
+ori s1 s11 -810
+sltu s1 a6 s8
+sra s11 ra s9
+andi x0 x0 -619
+auipc x0 934069
+remu t2 a0 s1
+div a0 t1 a5
+srl a1 s11 s8
+andi a0 gp -670
+auipc t5 696511
+mul a2 x0 s9
+slli a4 s1 31
+mulhu ra a4 t3
+srli t5 t1 14
+and a4 s1 s4
+sra t1 s4 a7
+rem s10 a7 t4
+sub s1 s2 s3
+add t0 s10 ra
+xori x0 gp -1108
+xori t0 gp -1557
+lui s3 545484
+or s11 s11 t0
+div a1 x0 tp
+srli t0 s10 21
+xori ra a0 -686
+sltiu gp s8 -1183
+divu a3 gp s1
+slti a5 s2 -1035
+sltu s9 a7 s3
+sltiu a0 t2 -1243
+slti t5 s11 1546
+rem s2 a5 t0
+rem s4 a7 t0
+mul a5 a2 t2
+mul a1 t0 s2
+sltu s9 s5 s4
+slt t6 a1 ra
+sltiu ra t0 -1348
+mul a6 t1 s4
+sub s3 a6 tp
+srai t3 s1 27
+xori t3 s6 -1883
+add s11 a3 a6
+lui s9 105498
+ori s5 s7 -922
+mul t5 a3 s9
+lui s6 863514
+sub a0 s8 gp
+mul t6 t6 s11
+rem s2 a1 s1
+sll a0 s5 x0
+mul s0 t5 a4
+remu a5 t6 a4
+andi s10 s9 663
+srli t0 a4 21
+srai a0 a5 23
+mulhsu tp tp s1
+sub s1 s4 t0
+srli s0 x0 22
+sltu t2 a0 s1
+lui s7 813978
+rem x0 s9 t3
+xor s1 a6 ra
+srai a5 a5 6
+sltu s5 a0 t6
+div t3 s4 ra
+mul t3 s0 a2
+sra s8 a3 a7
+xori t3 t6 503
+slt t1 a0 t1
+addi t4 t6 990
+xori t6 t3 -1093
+sltu s3 t3 s7
+remu t4 x0 t2
+sltu s2 a1 s7
+mulh a2 tp s1
+add s0 x0 t4
+addi a0 s2 889
+mulh t5 s5 t4
+sltiu tp ra -518
+sub a3 s0 s6
+add s2 a4 a7
+and s5 t3 t1
+slli t2 a5 28
+srli s10 s11 30
+sltiu a7 s0 -214
+add s4 s0 t5
+rem a7 t1 a3
+lui s11 835863
+sltiu ra a5 -1863
+mul x0 s1 s4
+addi a1 x0 1152
+or a3 a5 s0
+mulhsu a1 t1 s3
+mulhu s10 t3 a3
+divu s3 t2 s6
+slli t0 ra 10
+slti s3 s3 -290
+slt gp t4 t2
+sra a0 s5 a3
+andi s8 a2 -811
+mulhsu a0 s5 s4
+xor s7 a7 s5
+or t4 gp s0
+remu ra a1 a4
+sltiu a1 t2 283
+xor a3 a3 a5
+slt s2 a3 s5
+or x0 s9 t0
+rem t0 a0 s2
+auipc a3 373577
+sra s11 ra s0
+sltu a2 a7 t5
+srai s1 a4 12
+or s6 a1 s10
+xor s5 s4 t1
+lui s6 886499
+or s11 t0 a1
+mulhu a2 a3 a2
+addi x0 a6 279
+slt s0 s8 s9
+add s3 a0 a3
+srli t5 t0 27
+sltu s8 a7 tp
+auipc a1 898095
+lui x0 300311
+slti s1 a4 1980
+div x0 s6 a7
+srai s2 t3 5
+xori s11 t3 -2045
+remu t2 t5 t2
+srai s7 s5 7
+mulh s5 a5 s1
+srli t2 s4 10
+xori t0 a3 172
+slti s3 s10 1511
+mulhu s4 ra gp
+slli t6 s4 7
+divu a4 s8 s4
+sltiu ra s3 -509
+mulh t3 tp s6
+mul s3 a5 s5
+or s3 s11 a4
+sll t3 a6 s9
+ori s1 t1 781
+srl a3 ra s4
+divu t1 gp t3
+divu a6 a0 a0
+addi ra a4 1495
+auipc s7 32682
+srli x0 s11 17
+and gp t1 a6
+mulh s8 t2 gp
+sll t4 x0 a1
+srl s9 s8 t5
+xor a5 a1 a2
+auipc s1 739289
+slt x0 s2 s4
+ori t4 a5 -38
+sra ra s0 s7
+add a2 a2 s0
+sra a0 t6 t0
+srli t1 a6 17
+xori gp s3 -654
+or a0 a0 t6
+sra s5 ra a6
+div gp x0 a4
+addi t4 ra 1547
+and t1 x0 t1
+andi t2 a1 -1844
+xori a0 a2 -561
+sra s9 t5 s11
+slli ra a1 29
+srl s2 s2 a1
+slli s5 s7 30
+slli a3 t1 25
+add t3 s11 t4
+srli s11 s4 17
+sll s11 x0 a2
+slt t1 a3 t3
+srli t0 a7 14
+mulhu t5 a7 s4
+rem a4 t3 tp
+or a2 s10 a4
+mulhu t4 s11 t1
+slt s5 t4 t6
+auipc s10 804344
+xori gp s9 -374
+sltiu a7 a3 -875
+xori s1 t3 2001
+ori t1 a7 -924
+auipc ra 485553
+remu x0 x0 s9
+mulh a7 a1 a0
+srai a3 t6 11
+slli t6 a3 31
+srai t5 s8 5
+srli ra a3 7
+srai s4 s2 18
+mulhsu x0 t1 t3
+mul s9 s1 t5
+sub s11 gp tp
+div t6 t2 s6
+sra s1 t4 gp
+slt a3 s9 t6
+lui t5 732791
+mulh s10 a4 t4
+and s0 t5 a4
+sltiu s1 a0 -22
+srl t4 ra s6
+xori a3 s8 -882
+ori s9 s11 -383
+srai a4 a7 1
+sll ra a2 s11
+auipc t5 1045600
+lui tp 568601
+sll t6 s6 ra
+andi s9 gp 886
+and s4 a5 s9
+rem s1 ra a2
+rem t2 s7 s7
+andi a3 s9 -814
+add a7 s8 s2
+lui s5 817107
+mulh t0 s1 a1
+addi t3 t3 -1120
+mulhu a3 s7 t4
+sltu s3 s1 t6
+slti a5 s8 453
+mulhu s4 s8 s7
+and t0 t1 s7
+sra t5 ra a6
+mulh t1 x0 s8
+lui s9 334770
+auipc ra 81975
+rem s3 s10 a7
+sll a4 t4 a2
+sltu a3 s4 a2
+remu a7 t3 s1
+remu a0 s0 s1
+or t3 gp x0
+addi s1 t6 -876
+srli s5 t2 22
+srli s7 x0 16
+lui a2 199409
+rem t6 s5 a6
+remu t5 t6 ra
+mul gp s1 s9
+slt s10 s1 a5
+remu a1 s9 s11
+slt s5 t5 s11
+mulhsu s0 gp s8
+remu a4 s9 t3
+mulhu a1 t3 a7
+srl s10 x0 a5
+auipc tp 894444
+div t2 t6 t1
+sltu s4 s5 s10
+addi t3 a6 -1595
+remu s4 s2 s6
+addi x0 a2 -1018
+slli s4 t3 6
+xori a3 s0 1688
+sll x0 a4 s6
+sra s1 ra a5
+sll a2 a3 s3
+slli s2 ra 19
+div s0 s8 ra
+rem s3 s6 s11
+slti s9 t6 -1576
+sub s9 a2 ra
+auipc a7 125366
+sub t4 a3 t2
+auipc t3 557031
+lui s3 443022
+sra a5 s1 s10
+or t0 t6 s5
+mul t6 s0 s0
+lui t6 485496
+mul a6 a7 ra
+mul t5 a2 s10
+slt a2 ra s2
+mulhu a4 a5 a0
+mulhu s4 a1 s2
+mulhu s1 s7 a3
+addi a4 x0 -1517
+srl tp s3 ra
+rem a3 t5 x0
+lui t4 627697
+lui a5 202168
+lui x0 645464
+auipc a0 142495
+slt s4 t4 ra
+div s7 s5 t3
+srai ra ra 20
+sll t6 s4 a6
+sra tp s3 s4
+slt a1 a6 s11
+sub s5 s4 s5
+divu a7 t6 ra
+ori s10 tp 1123
+divu s4 t4 x0
+ori t0 ra -1574
+div t5 a7 t6
+sltu gp a7 a2
+mulhsu t1 s9 t6
+sra a0 s7 s9
+add a2 t6 s7
+remu s3 gp a1
+sub s3 gp s11
+ori ra t0 -1084
+add s4 t3 s11
+sll s1 t3 s5
+sra s4 s6 ra
+remu s2 s7 s3
+lui s8 489426
+mulhsu gp s4 ra
+xor t4 t5 a4
+sra t2 x0 s3
+sra s11 t5 a5
+srl t0 t1 a6
+slli ra a7 1
+and s6 t1 ra
+xor a2 s4 a5
+mul t4 t2 a7
+ori t2 s3 757
+andi s1 s0 40
+addi s2 x0 -1071
+remu t3 s1 ra
+remu t6 t0 s0
+lui s3 825114
+srli a6 a3 5
+lui s0 631772
+xor s11 t2 a4
+xori a7 s11 505
+sltiu s0 a7 -1095
+add s2 a5 s2
+auipc t4 541508
+add s3 a7 ra
+slli a1 s10 16
+sll s6 x0 s10
+sll a6 t1 t1
+addi s11 gp -277
+mulh a7 a5 a0
+andi a5 t3 -543
+slt t0 a2 s3
+slt a2 a6 t3
+lui gp 161541
+slti s8 a6 1938
+sltu x0 t4 t4
+mulhu ra s4 a2
+or s6 t2 s5
+mulhsu t5 s5 a1
+slli s6 s11 6
+slti a4 t5 -1200
+or s11 a6 a7
+andi s4 x0 1643
+lui s3 960539
+slt s10 a7 a4
+sltu s7 s4 s5
+mul a1 s2 a1
+divu s8 a3 s9
+remu a4 a7 s9
+mul s8 s11 s8
+lui s7 845375
+ori a1 a2 -1159
+or a6 s2 tp
+or s5 s6 s5
+div s2 x0 t0
+add tp s9 a2
+sltu s0 s5 a6
+srl t4 s10 a6
+slt a2 t4 t5
+auipc a3 274502
+div s7 t2 s11
+slti x0 t1 -1637
+mulh s4 s5 t0
+ori a3 a5 -1572
+ori a4 t4 1956
+slt a3 s7 ra
+lui t0 138551
+andi s1 ra -1267
+div t3 s1 s5
+add a1 x0 a4
+sll s6 ra s10
+andi s9 s0 -31
+slt t1 s10 s0
+addi a3 s5 -1870
+mul s3 ra s9
+slti s9 s10 -131
+mulhu t3 s7 s5
+slti s7 a1 -42
+remu a7 t0 s1
+sub a6 s3 a3
+mul s5 s11 s4
+or a7 a2 a0
+mulhsu s6 s9 s7
+srli s7 a7 1
+slli gp a0 15
+mulh t6 t6 a1
+and a7 x0 t4
+mul t2 a3 a6
+div s1 s6 a1
+srai a0 s3 22
+rem s3 a2 a3
+div gp a4 s6
+andi a7 s8 1717
+srli tp t4 31
+slti a2 a5 -1236
+divu t1 tp s6
+slli tp s7 4
+lui s4 376176
+add tp s7 t3
+slti t1 t1 324
+lui s0 998552
+slt a0 a3 s2
+sll x0 t5 s10
+srli t6 a1 13
+sra t2 s2 s3
+srai s0 s0 26
+srli s10 t4 20
+addi a1 s1 -942
+div a1 a1 t3
+remu t3 s2 s5
 divu t1 ra a1
-remu a3 a1 s9
-sltu s0 t4 t0
-srl a6 s10 s4
-slti x0 s5 -852
-xori s11 a6 -1523
-mulh a3 s7 a5
-divu s5 a7 x0
-slt s11 s1 s6
-lui ra 549891
-and a4 a2 s3
-mulhsu s10 s5 s2
-slti t5 gp 542
-auipc ra 906245
-slli a5 a2 17
-remu t6 ra x0
-ori s6 s2 -567
-slti s0 x0 581
-sltu s11 x0 s9
-mulh s4 gp t4
-mul t0 a7 s0
-andi a4 s0 395
-sltiu s4 a7 -1993
-lui s6 933807
-xori tp a6 -1880
-srli a1 s4 30
-sra a1 ra s8
-slli a1 s7 8
-sra s5 t1 a2
-or s11 t1 a6
+and s3 a6 a6
+add t4 t4 tp
+sub x0 s9 s0
+auipc s4 825897
+andi s1 t2 1545
+mulhu a2 a4 s8
+slt a1 x0 s4
+mulhu ra s2 s2
+xori x0 a1 -562
+sra s11 a2 a6
+auipc s3 881838
+sub t4 s4 a2
+divu x0 t6 s9
+andi s1 t6 -1360
+sltu a2 t3 s1
+sra a5 ra s0
+andi s3 t5 -654
+add t1 a0 s2
+and a5 s3 a4
+srli x0 t5 15
+andi s5 s11 -179
+mulhu x0 s1 t1
+sltu a5 s11 a7
+lui t3 82149
+srl a5 t1 s11
+divu s0 t2 a7
+divu a6 a7 a0
+or t4 s1 ra
+sra s11 s7 s7
+andi s8 t4 -1199
+sltu s8 x0 a2
+sra s2 a2 gp
+sra a1 a5 s3
+add s4 t0 a0
+addi a2 t1 49
+divu t2 s4 tp
+srl gp s0 x0
+add s9 t6 s5
+div s2 a1 ra
+slli s6 x0 27
+sll a1 a6 ra
+slti t5 s2 1678
+srai t2 t0 27
+slli s6 t0 4
+xori s5 a4 -348
+rem t5 x0 ra
+srai t6 a3 14
+div s11 t0 a4
+slt s11 s0 x0
+sub t2 x0 x0
+add t5 t4 s10
+addi a5 a6 -1333
+xori s5 a0 -71
+slli a6 t0 14
+andi t4 s5 -828
+sll tp tp t5
+sub t4 s4 a6
+xor a3 t2 a5
+srli s2 x0 15
+mul s5 t4 s7
+sub s1 t2 s1
+divu t3 t1 a2
+addi ra s5 -547
+sll x0 a7 s6
+lui s2 752391
+sltiu t4 s3 57
+ori s10 s11 -761
+or s5 s5 s0
+mulh s5 a2 t2
+div s2 a4 a1
+addi s5 a2 -458
+and s4 s3 s2
+auipc s8 861784
+xor t0 t5 t6
+mulhsu s6 t4 a0
+slt a7 s1 s8
+xor a7 t0 a7
+and t4 s8 s9
+srai s1 a5 18
+srai s4 a4 16
+srl s2 a7 s11
+remu t1 a2 s3
+mul s9 s7 a3
+ori s10 tp 93
+divu x0 s10 a7
+and s5 a3 a1
+srl a7 x0 a3
+and s7 t5 a7
+sub s0 a3 a3
+rem a0 a3 a0
+mulh s11 a2 gp
+and a4 s6 s5
+slt a5 s6 s0
+sltiu a0 t5 -416
+andi t6 s7 437
+sll a5 a1 t3
+sub t1 s8 t5
+rem a2 a1 a0
+or s7 a2 tp
+mulhsu t1 ra tp
+lui s10 392759
+rem s2 s3 s4
+xori tp a7 -2022
+srl a7 s0 a1
+lui s8 685642
+mulh t5 a0 t6
+remu a6 x0 x0
+divu x0 x0 s0
+sll ra s10 a0
+add tp s4 t1
+sll a1 t1 a5
+sltiu s2 a6 -1582
+xor t1 a0 x0
+mulh a5 s8 t2
+slli gp s6 25
+rem a1 t5 a3
+srai a6 s11 21
+mulhsu a5 a2 t4
+ori s2 a5 -39
+sltu t4 s1 x0
+slli gp a3 19
+mulhu t2 t0 t5
+xor t3 s3 gp
+sll tp gp a1
+xori a4 s8 -1221
+srli tp gp 20
+slt s10 t5 s2
+div s5 a4 s0
+addi a3 a7 -1212
+rem s1 t6 s3
+srli a4 a6 8
+slt s11 s5 a6
+lui s7 89410
+mulhsu s3 a7 s2
+andi a5 a0 -351
+sltiu s11 t4 -1515
+srl x0 a4 a0
+sltu s0 a7 a7
+ori t1 s3 497
+andi ra a2 -43
+add a3 t5 ra
+mulh t3 t5 a5
+mulh gp gp t3
+srli a3 tp 20
+rem s11 t6 gp
+or s1 a7 ra
+srai x0 s5 16
+ori t5 x0 -1813
+slt t2 t5 gp
+or a5 s9 s7
+or x0 t2 s2
+auipc s5 375145
+sltiu s5 ra -2042
+xor s4 s8 a0
+auipc a2 674470
+slti s7 a0 1540
+remu t5 s9 s9
+add a5 a3 x0
+auipc a3 304244
+xori s6 a1 -1718
+srai s7 s9 22
+slt s9 s5 tp
+auipc s3 617271
+xori a3 s11 2001
+srli t5 x0 6
+mulh t5 x0 t1
+srl a2 t1 a7
+remu a2 a5 s10
+srai a7 s4 2
+sub s2 x0 a1
+mulhu t2 x0 s1
+xor s0 t1 x0
+remu t2 s2 a0
+andi s4 a1 2011
+auipc a1 348276
+slli s9 x0 15
+sub s10 t1 s9
+lui gp 1043014
+or t6 t5 t1
+sltu a1 t3 s10
+remu s11 s8 t6
+sltiu t4 s4 1418
+andi s1 s1 319
+sub s4 a4 t1
+mulhsu s5 s8 t3
+ori s3 s11 321
+sltiu a3 s0 1123
+remu a3 a3 a4
+or s9 a2 t6
+add t3 t3 t4
+remu ra s7 s5
+slt s11 s6 a4
+mulhsu gp t2 s2
+div a6 t2 s9
+mulhsu s8 a5 t2
+xori s1 s2 -1300
+sub a1 s5 ra
+xor s11 s1 s2
+sub t5 ra s0
+srli a7 s10 10
+sra a3 ra x0
+mulhu t1 a0 a0
+srl t3 t3 x0
+remu tp tp x0
+sltiu t1 t1 1486
+slti s11 t3 -909
+slt s9 s0 s5
+xor x0 a6 s11
+auipc t4 474272
+sltiu s11 x0 -582
+xor x0 s10 s9
+sltiu s5 s0 446
+srli t2 s8 9
+sltu a5 a5 t0
+lui a2 211770
+sll s11 t4 a1
+and s6 a2 t1
+sll t3 t2 a0
+ori a6 a6 17
+xor s1 s5 ra
+ori t3 a4 -1862
+mulhu t2 t0 s11
+slti s1 s3 -1837
+mul s2 t1 t1
+lui s10 844054
+srli a0 a1 14
+mul a6 ra t6
+andi s3 s7 -520
+andi s7 s10 -656
+mul s10 s1 s1
+mulhu t4 t3 t0
+srl a5 t5 x0
+auipc s8 691221
+sub s6 a3 s9
+mulhsu s9 s8 s1
+slt s3 s9 a1
+remu x0 a2 s9
+auipc a4 582570
+sll tp s2 ra
+slt x0 a3 s10
+xor t5 t3 s5
+rem s7 s2 s8
+mulhsu s2 s10 tp
+ori a7 s5 -1289
+andi t4 a0 -170
+slti t5 a4 -371
+auipc ra 933654
+divu s8 a0 t2
+remu a7 t2 tp
+slti a5 a7 -643
+div s4 tp s10
+xor t1 a3 tp
+sltiu s0 s3 -1064
+sltu a1 tp t1
+slti a6 x0 -1259
+add s4 s11 t2
+sub s2 a1 s3
+addi s9 a2 406
+or t6 s0 x0
+srl a7 t6 s9
+mulhsu s1 s1 x0
+andi a2 ra -1022
+slt s5 s0 s10
+slti s7 gp 1018
+auipc s10 753462
+sltiu s2 a0 1825
+ori a5 tp -948
+mul s5 t5 gp
+srli s5 t1 25
+slt a3 a6 a6
+lui s6 923923
+mulhsu a3 a2 s1
+addi t3 t0 -1299
+mul a0 t1 s4
+slt x0 s6 t5
+srli t6 t5 2
+remu s3 s4 t6
+remu a4 t5 t2
+sltiu s6 t5 -1932
+slli a4 a4 22
+xor gp s3 a5
+slt a2 t1 a4
+srli a4 tp 11
+and s2 a2 t2
+divu t6 s7 gp
+mul a0 s7 s1
+srl s8 s1 ra
+or t6 t1 s2
+slti t6 s2 -134
+srli s7 ra 10
+div t5 a6 s6
+sltu tp s6 t1
+mulh s7 a4 ra
+xor gp t3 tp
+andi s3 x0 -690
+srai s3 a2 13
+sub s7 s0 s4
+slli t6 a0 30
+mul s2 s5 a1
+remu s11 x0 a5
+srai s6 t1 27
+xor s7 a1 a1
+sra t5 s6 x0
+sra s11 a0 a1
+xor t5 a0 s8
+mulhu s2 t0 s1
+mulh t0 a5 s8
+mul s4 x0 t6
+or s1 s10 t0
+and t1 s10 a0
+mulh x0 s8 t3
+sub t4 gp ra
+slt t1 s8 a4
+remu s5 t4 s1
+auipc t4 185852
+and t6 a6 gp
+remu a5 a7 a7
+addi t6 t6 -947
+rem a5 t5 s5
+addi a7 a6 -275
+lui t6 829885
+srai s0 t6 28
+mulh s7 a5 s6
+srl a3 a2 a7
+auipc s7 1040504
+sltiu t0 s5 -1613
+div s8 s10 s6
+slt t6 s3 a5
+addi t6 ra -1382
+sub s2 t5 t4
+srl s5 a0 s0
+mul a6 t3 s3
+divu s4 a1 a7
+add a4 s8 s9
+add a2 t0 t5
+div s6 s10 s8
+remu a6 x0 x0
+or a4 s4 s0
+srli s6 s2 29
+mulhsu s5 t3 t5
+divu t2 a7 a3
+slti a0 t5 -1892
+sra s1 s8 t1
+divu s3 a0 tp
+xori s3 a0 954
+sltu t4 s4 s10
+addi a6 s4 -1997
+slli s5 s5 9
+sra t6 t6 a6
+andi a0 tp -967
+sra t1 a5 a0
+div gp s1 a6
+slti s9 s9 359
+remu t4 ra s2
+remu s5 s1 s7
+div t3 t6 ra
+slti a5 t6 1711
+slt t0 s6 s11
+div t0 t1 t3
+sltu t3 a4 s4
+mulhsu s10 t2 a4
+lui s3 857420
+sub s8 a2 a1
+sra x0 t5 a3
+sltu s11 a3 s7
+slt t6 t2 x0
+mulh gp x0 gp
+srai a3 s0 0
+auipc tp 324521
+or a5 s8 a7
+sll s2 s1 x0
+srai t0 a1 8
+xor s7 x0 s0
+mul gp s2 t1
+andi x0 t0 -414
+auipc t1 754669
+andi x0 t3 -512
+lui x0 829887
 mul s0 a5 t2
-sltu s5 s1 t1
-srl t3 x0 s8
-srai t4 s7 4
-mul s7 x0 s7
-rem x0 s5 a1
-divu t5 t1 s3
-div a5 a6 s7
-mulhu s10 a3 x0
-srli s3 a7 23
-ori s8 s4 1884
-mulhu t0 t6 tp
-xor a7 a2 ra
-sltu t6 a5 s8
-slt tp x0 s1
-slli a6 gp 1
-sra x0 s1 a6
-addi s4 t0 -351
-sltu s4 s11 s2
-remu tp a3 s0
-slli t0 t1 15
-slt s6 s2 a7
-mulhsu t3 a7 x0
-xori a4 x0 1192
-ori t4 s4 1946
-mul s4 t6 a6
-or tp s2 s6
-srl a5 x0 s2
-slli x0 a0 27
-sltu s10 a2 a0
-and tp t5 s2
-or a7 a6 a1
-addi s5 t0 1678
-remu s11 t2 a3
-lui t4 78774
-sra s11 a4 x0
-sra s3 a5 t3
-slti a1 t5 -1154
-sll t4 a1 a6
-xori a4 s2 780
-sra tp t1 gp
-slti s2 t6 -1251
-mulhsu x0 s0 x0
-srl s7 a6 t2
-or s6 s11 s10
-xori s3 s0 -763
-and t6 s10 a3
-lui a1 525242
-srl a6 ra a7
-slli s10 a4 15
-srai a5 t6 10
-sub s2 t6 gp
-sra gp a3 s8
-mulh s10 s4 t3
-srai x0 a3 13
-mulhu a0 x0 a5
-sltiu gp ra 1388
-sra t1 s7 t1
-srl s0 t3 s3
-mul t1 ra s1
-mulh t4 a6 t1
-sltu s4 t5 a6
-addi s10 tp -1455
-srli a7 x0 15
-lui t6 16552
-xori t6 s4 -1108
-srli x0 ra 1
-slli a5 ra 17
-slt t1 t4 t0
-sltiu t2 a6 1238
-auipc a1 458460
-divu t3 s11 t6
-sltu s2 a2 s10
-mulhsu a0 gp gp
-div t6 t4 t5
-auipc s6 674469
-slti t5 s10 -1562
-divu t2 x0 t5
-lui a3 169539
-srli x0 a7 8
-or a4 s8 a0
-remu s0 t0 a1
-divu a2 s7 s1
-auipc t0 503071
-auipc s9 421315
-remu s1 t6 a4
-auipc t0 290721
-slti a4 t3 -217
-or a3 a6 a1
-sltiu x0 tp 1372
-sltu a5 t0 s7
-sltiu s7 a0 -1513
-xori s6 a1 510
-rem s11 s5 a6
-remu ra t3 s1
-auipc t5 907887
-slt a7 x0 s5
-slli s10 a0 26
-mul s11 a2 t2
-srai s6 x0 30
-remu a2 s3 t1
-mulh t0 s0 a5
-srai a2 x0 20
-rem ra s9 s7
-xori t3 gp -1496
-srli s6 a7 12
-slt x0 s0 a4
-rem s7 t0 x0
-andi t1 s1 564
-mulhu x0 t0 a1
-slt x0 s7 s3
-srl s7 t0 s5
-mul s8 t5 gp
-and s6 ra a7
-div s9 a0 s5
-mulh t6 s0 s3
-mul t1 s10 t4
-divu a7 s4 s8
-ori t6 t1 640
-sll s6 s8 t6
-ori t2 s8 -1750
-xori a3 a7 898
-lui s11 763569
-sll gp x0 s4
-rem s11 t6 s3
-divu a3 gp s6
-rem s11 s2 a1
-sltu a3 s8 t0
-sub s11 s11 s3
-xori a1 s3 -423
-sll t6 a4 a1
-add a7 gp s9
-add a3 a2 a5
-mulh s3 t2 s8
-lui s10 513294
-remu t6 a6 t2
-slt s8 t2 a7
-srl a4 x0 s5
-sltiu s11 s2 -1156
-remu t6 tp t0
-or a2 s3 a0
-andi s11 s2 -1919
-remu x0 a5 s3
-sltiu s5 s9 1807
-add t2 a4 t4
-and t3 s6 t4
-sll a6 a7 t0
-div a0 a6 s3
-slt s6 s9 s8
-lui s9 853913
-div a2 t4 a4
-srli s4 s4 6
-auipc s9 472111
-add t5 tp s2
-add s0 t4 x0
-and a3 s3 x0
-addi s0 t3 -1037
-remu s11 gp s9
-remu a3 t5 s7
-sub t0 t6 s8
-and s3 ra s2
-and a4 t2 a1
-mulhu a5 a5 a5
-add x0 s3 s2
-mul t2 s4 a3
-and t6 s6 s7
-mulhu a4 s2 s6
-ori a4 a1 814
-div gp s2 a7
-slti t6 x0 -669
-addi gp t2 -1669
-xori x0 a4 -391
-srai a0 t2 12
-andi x0 t1 -1385
-add s10 ra t2
-and tp a7 s10
-slli t6 t2 7
-mulhu a6 s0 s7
-slt s7 s10 a5
-mul t3 x0 s8
-and a0 s6 s2
-sra a0 a2 s7
-mulh s5 t4 t2
-srli x0 s5 27
-slti s9 a7 -551
-or s9 s5 s4
-slti s6 a6 -1545
-slt x0 ra t1
-divu x0 s8 s5
-add gp a5 a7
-rem ra s8 s3
-sub t0 x0 t0
-slti x0 s10 -503
-add t0 t0 s11
-sltu s8 s10 s6
-sub a5 ra a4
-sltiu a2 gp -382
-andi t1 t2 -68
-auipc x0 574225
-xori t0 t0 -1537
-slli s7 s0 0
-slt a3 s3 t2
-sltu gp x0 s3
-sltu a0 s4 t2
-rem s9 a3 s2
-lui a0 375851
-div a0 t3 x0
-ori t6 s3 -337
-addi tp a4 273
-srl s8 x0 a7
-and a1 t5 s0
-or a2 t3 t2
-remu gp t1 gp
-lui s3 286652
-addi s4 a4 -217
-mul t4 a3 a7
-ori a6 t5 1385
-or a4 t2 x0
-mulhsu t6 s0 a1
-addi s10 x0 -508
-sub t1 x0 x0
-sra t0 t2 a7
-sltiu x0 a5 -1310
-rem s8 t3 a4
-srl s6 s1 tp
-auipc ra 11519
-div s3 s6 t6
-and a2 t4 t1
-sltiu a0 s1 1160
-xor t5 s5 s9
-ori s6 s8 -882
-sub a6 t1 s10
-xori s3 s8 -440
-divu s0 s2 s10
-srli t3 t3 17
-mulh s4 s9 ra
-sltu gp s2 a6
-div a7 a3 s11
-lui t3 267004
-xori ra s0 1887
-add s0 s11 x0
-ori t2 s3 -630
-slli a4 t5 18
-slti a7 s10 1028
-sltu gp a5 t4
-slli s9 s3 13
-or a0 x0 a2
-auipc x0 720559
-mulhsu t3 s9 x0
-sll s5 a4 t3
-addi s2 a6 -1011
-mul t5 s11 s3
-xori t3 a7 1041
-slt s11 gp s2
-xori s0 s1 -807
-xori a6 s6 -688
-div a1 s9 s2
-addi s4 ra -1632
-slti s6 a6 -1515
-srli t1 a7 21
-addi s7 s5 1784
-rem s4 a0 s5
-andi s5 gp -1531
-auipc a1 368634
-slt a5 a0 t3
-divu a4 a3 gp
-slli a6 s5 10
-slti s3 s11 -85
-auipc a5 431542
-sub x0 ra s11
-sub t1 t4 a6
-add x0 s2 a7
-srl tp s9 s1
-xori a2 ra 230
-sltiu t3 a1 1825
-sltiu a1 s11 1885
-slt a5 s1 t4
-mulh s9 t1 x0
-or s4 a1 x0
-slt tp a3 s11
-sll a0 a5 t0
-remu t5 s6 s4
-divu t4 tp s1
-add t0 t1 a6
-sltu a4 gp ra
-srai s1 t1 11
-sltu s11 s2 ra
-ori tp s9 -1832
-andi s5 x0 229
-sll s7 s4 a6
-rem a7 s6 a3
-divu s7 t5 t1
-mulh t3 s6 a3
-divu t5 a2 a2
-div s9 t6 a6
-slli t0 s11 28
-lui ra 791385
-slli s1 t0 18
-sltiu t0 t4 766
-rem a3 s10 t6
-lui s5 80973
-srl s3 t2 s7
-div t0 tp s1
-or s4 s11 tp
-lui t4 832718
-addi t0 a0 -1080
-slli s11 a2 29
-slt t0 s6 a7
-or s0 gp tp
-mulhu t4 s7 ra
-andi tp s1 -553
-slt s2 ra s10
-sll s7 a2 gp
-slti x0 t6 1315
-rem a2 ra gp
-rem s2 s5 a3
-xori s8 a3 -568
-srl t5 s1 a0
-sll a5 t2 tp
-divu x0 t4 a1
-andi a4 s1 -1316
-remu s4 a4 tp
-sltu tp t0 t3
-or x0 s11 t1
-lui s8 792861
-mulhsu s8 a2 s4
-divu s10 s0 t1
-xori s7 a7 805
-rem s3 tp s3
-mulhu t0 a5 s9
-andi tp a0 -947
-rem s4 s6 s4
-add t2 ra x0
-slli gp a5 18
-sra s2 gp a1
-sltu t3 s7 s6
-sub a1 a5 gp
-mulh t3 s8 s6
-slt a5 t5 s0
-mul a2 a6 t6
-mulhsu x0 t0 t2
-slli s1 s5 7
-addi x0 s6 -310
-slli t4 s8 28
-divu s5 t5 a3
-mulh s1 ra gp
-div ra a4 x0
-sll s11 tp a5
-rem t3 t2 ra
-mulh s6 a7 t4
-rem a4 t6 s5
-andi s2 a3 -1600
-srai a0 a1 20
-sra a3 a3 t3
-slli s6 t1 2
-sll t2 a7 ra
-slt s5 s4 s11
-srl tp s11 t4
-add s11 s9 s4
-slt s0 s11 t6
-ori t0 x0 878
-xor s4 t0 t6
-srai t4 t3 2
-remu s10 x0 s11
-mul ra t1 gp
-sub t5 s4 t4
-xor gp t0 s1
-slli a6 s10 18
-div s11 gp s6
-slli s1 s10 20
-sltu s6 a4 t5
-or a1 a7 a7
-lui s11 130909
-mulhu s8 s7 a2
-xor a6 s2 t4
-sub a7 t5 s6
-sub s3 s9 gp
-mulhsu s9 x0 s11
-mulhsu s7 tp s7
-slti a1 s1 -79
-lui s0 350067
-lui t3 699805
-xor t6 t5 t5
-slti x0 t1 -428
-auipc a1 56338
-sltiu s8 s10 1291
-srai x0 s7 27
-mulhu t6 a2 a3
-sltu x0 s11 x0
-andi tp a3 1843
-mulhsu s10 s10 s11
-or s7 tp a3
-slt a0 s5 a2
-sub t5 s1 a5
-rem s3 a7 ra
-sll a6 a0 s9
-sltu a3 t6 t6
-ori a3 a5 -561
-mul s3 a7 a4
-sltiu t2 s2 1447
-auipc a0 288231
-srai s4 t5 31
-ori a6 s6 -1148
-mulhsu a0 x0 a5
-auipc ra 52822
-mulhsu a0 t3 ra
-divu t2 a4 s8
-mul s2 s2 t1
-and t1 s10 x0
-mulh a4 t5 s11
-andi a3 a1 1680
-or t3 gp t2
-div a4 s9 t5
-slti x0 a1 -1609
-slti s10 s6 -1552
-slt s8 t2 s8
-addi s11 t5 1131
-add s5 t2 t1
-sra s4 a3 x0
-rem t3 t5 s6
-remu s9 s9 t0
-and s5 s10 s5
-remu a4 s3 s7
-rem a0 t5 s6
-mul a7 s6 s7
-addi a4 t5 -282
-lui s10 173871
-sltu t3 t5 tp
-xori s5 t2 -940
-srli tp t0 30
-divu x0 a6 t4
-rem a3 a6 t5
-sra x0 t5 a2
-andi a0 s7 -1970
-sub s5 tp a1
-mul t1 t3 t3
-addi tp a6 -1589
-or a7 tp s9
-srli s8 s1 6
-mulhu tp t0 s10
-sub a7 t6 a2
-and a3 s9 s11
-mulh a2 a3 gp
-srli x0 a1 4
-slti t2 s11 -717
-or gp s8 s10
-lui t1 251174
-slti x0 a4 747
-xori s1 s4 552
-srai gp a3 25
-addi s0 a1 -1438
-srl t3 x0 t3
-mulh s4 s3 t6
-lui a1 756568
-mulhu t1 tp x0
-mulhsu s7 s9 s3
-addi s11 t0 -233
-sra x0 t5 tp
-slti a2 s6 -1742
-andi a7 a1 -2031
-rem t1 t3 a1
-mulhsu x0 s4 s9
-div t0 a1 a5
-addi t4 s6 1513
-addi t3 x0 -1474
-xor s5 s1 a0
-lui a1 264111
-slli t3 s1 1
-srli a5 a5 7
-xor s10 a0 s4
-div s1 s6 ra
-xori t0 tp -1068
-xori t1 a1 1097
-srai x0 a7 19
-slli s4 ra 18
-addi s3 s1 -203
-slli x0 x0 10
-and tp s1 s0
-rem ra t2 s4
-srl a5 s11 s3
-div a3 a2 s3
-divu s3 tp tp
-auipc s1 235853
-ori a6 t4 1328
-sub s5 s2 a6
-srli s3 a1 5
-mul t3 s3 ra
-mulhu s5 s5 a2
-lui t5 323896
-srli a3 t4 31
-rem a0 a5 s4
-sra s7 a2 t2
-remu a0 s4 x0
-sltu s0 a1 s9
-srli t0 a1 30
-sub s5 s9 t0
-slli t0 a3 4
-xori a6 t6 -1729
-mulhsu s3 s6 a5
-ori s4 s4 -1657
-sltiu a0 a4 1234
-lui s11 1035766
-srai t0 s9 26
-srl ra a0 t1
-sub s1 t3 a5
-ori s5 x0 1958
-add s4 a5 s11
-slti s2 t2 -1656
-remu s4 s9 s5
-srli t3 s2 17
-mulhu a2 s9 s4
-rem x0 a6 gp
-xor a3 s7 x0
-rem a6 s4 t3
-and a5 a6 s5
-slli a5 a1 29
-xori gp s5 -2007
-slli x0 s9 6
-or s11 t3 s3
-slt s11 s5 ra
-ori t5 s7 -1236
-srli s4 s4 24
-slli s9 x0 28
-xori t5 gp 244
-sll a3 s11 t1
-div s6 a5 ra
-divu t1 x0 s1
-and s4 s9 s0
-rem a6 t5 t1
-rem s0 a0 s5
-slt a7 s2 s1
-addi tp s2 33
-add t0 a5 a0
-sra s6 s2 gp
-slti t2 s5 1838
-mulhu t6 s10 a1
-slli s11 t3 8
-slli tp t2 1
-or a1 a3 x0
-and gp s2 a3
-sltu s9 a0 gp
-remu s5 s8 x0
-andi x0 t0 1550
-xori s2 s11 424
-slli s3 tp 23
-sltu x0 t6 s4
-ori s0 a4 -1661
-auipc a4 33099
-div s5 a3 s5
-lui s6 477257
-slt s8 a1 s1
-xori s1 t2 -1237
-or t3 a1 a3
-divu s4 a3 a4
-sra s0 s8 t0
-lui t2 914056
-mulhsu x0 s0 s5
-mulhsu a3 gp a5
-xor s9 s9 x0
-or s3 x0 a5
-and s8 gp s7
-mulhu s11 s1 a7
-srli s0 x0 17
-addi a6 s10 -1679
-auipc s1 663956
-xor gp a7 a0
-sll a4 s1 a7
-sra ra t3 t4
-or gp t2 a5
-mulh s6 s5 s3
-srl a2 a2 s5
-div s8 s7 s7
-sltu x0 x0 a1
-mul s7 s2 t4
-sll a3 ra t5
-remu a5 a5 s3
-div s5 s3 a1
-slli s7 t1 23
-divu ra t0 s9
-rem x0 t2 a7
-slli a4 t0 26
-add gp t6 t6
-slti gp s9 1897
-srai s10 s5 30
-mulhu t6 s8 a1
-mulhu t6 t2 s10
-add a1 gp a2
-sltu s9 a0 t0
-mulhu t4 s11 t1
-slt s1 s11 s8
-ori s1 s11 1219
-mulh a4 gp t2
-sub t1 tp s10
-andi t6 a3 -475
-sub t0 s9 t4
-slti ra t4 504
-sra s4 s0 t6
-add x0 s9 s0
-sub x0 t5 s7
-srl x0 t0 x0
-slli a0 a5 1
-mul a4 t1 t0
-xori ra x0 148
-xor t1 a5 x0
-sltu s1 a0 t1
-mul s3 s1 ra
-xori t0 t3 460
-remu t1 s9 gp
-or t5 t0 a5
-slt s1 t6 s11
-sltu s4 s3 tp
-div ra s3 a2
-addi s9 t6 -522
-xori gp a4 -918
-andi a5 a5 -1500
-add s8 a5 s0
-add s7 t1 s6
-sll s5 s1 s7
-srl t6 t0 s0
-remu t5 x0 a1
-slt s2 s2 t3
-srai a3 t1 24
-xor s3 ra a3
-ori t5 a4 -1194
-remu ra x0 t1
-srl a7 a3 s6
-and t6 t4 t5
-ori s11 s3 -1712
-slt a5 s7 a2
-ori x0 gp -862
-or s9 s7 t6
-srai s4 s5 1
-mul a6 a1 x0
-srl ra s6 s4
-ori t6 s5 739
-remu a1 s9 s3
-srl a4 t3 a5
-sltu a2 s10 s7
-remu a1 x0 s2
-sub t0 t1 gp
-andi s10 s10 2032
-sltiu a0 a5 -216
-slti a2 a6 -1348
-rem s6 t4 a7
-and t6 s10 s0
-and s3 a4 s10
-or tp s5 s8
-mulhu s10 a0 s8
-xor s11 t3 t3
-sltu a3 s9 s10
-srai t5 x0 29
-mulhsu ra s5 t3
-srl x0 a6 t3
-srli t4 a3 23
-add a6 a2 a3
-sll s11 t2 x0
-ori s8 s0 -1240
-remu t4 s6 s1
-div s3 s8 s10
-div x0 s1 s6
-xor s5 t2 a1
-add s2 t5 s4
-srl s3 s5 s4
-xori s7 s4 -953
-slt s3 ra t3
-lui s4 207567
-sltu s6 a2 t6
-add t0 s11 x0
-xor t0 s6 a7
-divu t4 ra s5
-ori t3 a4 -428
-slt a3 a7 s3
-xori s3 t1 330
-slli s6 a6 23
-auipc s11 661278
-rem x0 a4 tp
-sll a5 t6 s8
-and s8 a0 s0
-srl a2 a6 a0
-sltiu s6 a2 -1184
-andi ra a5 990
-divu a1 a3 s2
-slli a6 s3 1
-mul a0 s10 s6
-slt s4 t3 s7
-div a2 s0 t5
-xori s11 s11 601
-sra t1 s10 s5
-lui s1 827868
-andi s9 s10 836
-mulh ra s10 t1
-auipc gp 1033867
-slli x0 a3 12
-xori t4 a7 179
-mul s7 t5 gp
-rem a5 t2 a7
-rem x0 t3 s9
-xor a6 s1 gp
-div t4 s4 s4
-remu s11 s1 s8
-sra s6 s2 a5
-xor s0 s8 t6
-add s3 t3 s1
-sub x0 s10 t0
-mul gp s10 s2
-slli a3 s5 13
-srl a0 ra a2
-mulhu t5 gp s1
-sub t1 s10 tp
-sltu t3 a7 s6
-remu gp s4 t2
-andi s8 t0 -244
-remu a0 t5 t6
-ori s6 a6 -89
-or s9 s6 s4
-sll s6 a7 tp
-srai a6 a5 17
-sltiu a0 x0 1263
-sltiu s6 t1 -508
-divu s10 s1 s1
-lui ra 889214
-sll t0 a7 t1
-slti gp s3 -499
-and s7 s5 a6
-sll a6 t0 s4
-mulh a7 t4 s0
-sra t6 s5 a3
-srli s10 s1 11
-lui a7 560662
-sub gp s6 t2
-mulhu s10 a5 s10
-addi t4 s7 -1545
-mulhu x0 a1 s3
-andi s3 gp -1343
-mulhsu a0 a1 s6
-mulh s4 a1 s1
-slt s0 t5 a2
-slt a1 t5 x0
-auipc gp 569554
-ori gp s3 1507
-mulhu ra s7 a7
-remu tp x0 s5
-rem s11 a6 t4
-slli s5 t0 4
-slli a2 a4 28
-mul a4 a7 tp
-xori s4 t2 374
-mulhu t0 t4 s6
-srl t1 a3 s1
-rem s5 x0 s9
-xori a6 s1 -1253
-slti t5 s6 1923
-sra s1 s11 a5
-sub s1 s0 s6
-slt a3 t4 gp
-mul s3 tp a5
-mulhsu tp s5 ra
-add a2 a4 x0
-rem a0 s11 s7
-or a5 t3 s7
-srai s11 a1 31
-sra s2 a7 s3
-xor s11 s10 t0
-xor a3 gp s3
-slt s10 s11 ra
-divu s11 a6 s8
-srl s11 t1 a2
-andi s6 t5 -736
-rem s9 s11 a7
-slli t6 gp 12
-and a1 t2 s7
-sra a4 s7 a3
-div t1 s9 s7
-slli s8 t3 10
-srl a7 s11 s5
-andi a2 s6 505
-addi s0 t0 1549
-rem s10 a7 s2
-srai t0 t0 18
-ori s5 s8 -1447
-auipc s7 357262
-sra s10 s1 a1
-lui a4 399021
-mulh a4 s5 a5
-slt s7 a5 ra
-divu s10 ra a0
-srli t2 a4 4
-sub s10 a7 a7
-sra a2 t0 t3
-mulhu s5 gp s9
-div a0 a2 a3
-sll s6 t2 a2
-lui s5 205574
-remu s8 tp a3
-mulhsu s11 a2 a7
-andi x0 t1 -1847
-sltu tp t0 s9
-slt s1 s7 s1
-srli a7 ra 3
-sub s0 s0 t1
-mulhu ra a4 s8
-rem s11 s6 a1
-srl a1 a6 s1
-divu a5 gp a4
-div ra s2 s5
-xori t3 s11 360
-div x0 s3 t4
-slti s5 s2 -1256
-srli a6 a5 15
-sltu a6 a2 s7
-sra x0 s9 gp
-or a0 s8 t2
-auipc a7 261265
-andi s8 s4 -1686
-add x0 t1 ra
-slli a5 a4 23
-addi s2 s5 -1264
-or a7 s4 s2
-srl t2 a4 a3
-xori a1 t1 -254
-mul t6 tp a5
-sltu t6 x0 a3
-sll t3 t5 a6
-slli x0 a4 7
-auipc s6 168517
-sra s1 a6 s10
-slli s2 s2 9
-slli t1 a6 27
-xor s3 s1 x0
-lui s5 999661
-and a1 ra t2
-slli s7 a6 22
-srl a3 tp s2
-slti t1 x0 -802
-and x0 a6 s1
-rem x0 gp a7
-ori a1 x0 -84
-srli s8 ra 1
-and s5 s9 s6
-srai s11 x0 2
-sub s8 t1 t3
-srl a2 x0 a5
-mulhsu t3 s8 a0
-xori t4 t4 1417
-auipc a5 763308
-sltiu ra a1 -1488
-auipc s4 374035
-xori s5 x0 -295
-andi a7 s8 875
-sll s3 s7 s9
-addi t1 s0 -526
-srai s0 s1 20
-slti s3 a4 -657
-sra t6 s2 a3
-rem x0 gp s3
-slt a4 t3 s6
-mul s9 t6 a4
-or a6 s7 s10
-sra a0 s9 s1
-or x0 t6 t1
-sltiu t1 a6 468
-slli s6 ra 18
-and a6 a2 s11
-sll s6 t2 tp
-addi s10 a4 896
-xor s6 s11 s1
-slti a2 s6 -514
-srl a3 ra t4
-ori t3 gp -89
-srl a3 s11 t5
-sltiu s10 s8 -898
-mulhsu s10 a3 a0
-mulh s11 s6 x0
-sltiu t3 s6 230
-lui a1 493185
-sltiu s6 a0 1721
-rem s7 s6 ra
-divu a7 ra s5
-remu t3 t0 s4
-remu a4 gp a2
-xori a6 a5 2009
-andi s4 gp -1135
-andi t3 gp -854
-mulhsu a4 a3 t6
-srai t5 tp 20
-sub t5 a2 s8
-sltiu a1 s2 -248
-slli s9 gp 4
-sltu a2 a7 t4
-xor a5 a7 a7
-srai t0 t1 7
-divu gp t6 a2
-sll tp tp a1
-div a0 t0 a3
-srai s1 tp 19
-mulh a2 t0 s3
-slti ra x0 113
-slli s8 s4 2
-srli s2 t2 0
-remu a4 s7 t3
-mulh s3 s5 x0
-sub a7 t0 a6
-mulhsu t6 a7 s5
-auipc s0 1005646
-sltu s2 a4 s1
-slli s2 ra 11
-srli s5 x0 1
-sll a5 gp s2
-sltu tp s1 t5
-srli t4 s10 0
-addi ra s4 -779
-srai a5 s2 22
-div gp a1 a1
-addi a0 s10 -1846
-sltiu s11 a2 -1671
-mulhu s4 s9 tp
-sra a3 s11 a4
-slti s0 s1 -176
-add a2 s4 x0
-xori t0 a5 -702
-auipc s9 673613
-andi s3 s5 -1253
-andi s1 t2 -1722
-or a5 ra s2
-div a1 a1 a2
-rem ra s10 s1
-mulhsu t4 t2 a4
-srai x0 a2 12
-divu t4 a0 t4
-srli s7 t1 28
-add x0 a1 s2
-addi s7 x0 98
-mulh t4 s11 s10
-slt s6 s9 s1
-sll x0 a5 gp
-or s8 s0 a5
-lui t4 149888
-sltu t2 tp t6
-xori a1 a7 -909
-addi t0 s6 618
-slli a5 x0 23
-add s6 a4 t0
-rem t5 t4 x0
-mulhu a6 s5 a1
-or s10 s6 a0
-slt s4 s6 x0
-div gp t2 t1
-lui t2 865559
-slti s9 s11 -427
-srl x0 a3 a4
-xor s11 s8 x0
-and s9 s1 x0
-xori s4 a0 -476
-mul a7 s7 a1
-auipc a4 1037619
-and t2 x0 s9
-and s10 tp a0
-slt a0 t0 s9
-andi t2 a6 -1602
-mulhsu s4 a4 a5
-add t2 t5 s2
-and a7 tp s10
-sll a5 t4 a5
-rem t0 s10 a0
-sltiu a1 t4 559
-srli s9 a7 19
-mul s6 s4 s2
-add s11 s4 x0
-addi a0 a2 662
-xor t1 a1 x0
-sltiu s0 s4 190
-slli s1 a5 31
-lui s1 268566
-mulhu s4 s9 s8
-divu t1 t4 t1
-sltiu s1 s9 -1535
-mul tp a3 a3
-rem t5 x0 t0
-xor s2 x0 s10
-slt t3 t1 s6
-remu a6 s11 t2
-auipc t1 390499
-sll s0 s8 t6
-srl s7 a1 x0
-mul x0 ra s10
-andi tp a7 -720
-mulhsu a2 a3 s8
-mulhsu t3 a7 t2
-div t4 a4 a2
-slli t4 a0 26
-lui s7 307475
-div x0 a5 t6
-slti s5 t2 1144
-slti s1 s9 1242
-or t6 a1 t5
-lui a4 926299
-mul s3 s0 s7
-slli a3 a6 15
-div gp gp a3
-sltiu a1 a7 -1152
-mul s7 a2 s8
-mul s5 ra t5
-andi s6 t4 1086
-slti s11 a2 1735
-xor t6 s0 a1
-sltu x0 s1 s4
-div a2 gp t3
-sll s6 s0 s7
-srl t1 a5 s11
-sltu a0 ra a2
-sub s9 tp t5
-slt s7 a2 s6
-xori t2 t4 -1870
-slt t2 s3 t6
-addi s0 s2 -918
-srl a7 s2 t0
-sltu t6 t6 s0
-srai t1 s7 5
-slli s8 s9 16
-srli a6 s8 5
-srli t2 t4 3
-mulh s8 a2 x0
-sub x0 s10 a7
-slli s6 t2 20
-sll a0 s11 s9
-div s1 t6 s0
-sll ra s2 ra
-mul s1 s0 a6
-divu a5 t5 a3
-slli s6 tp 22
-andi s1 s1 -1212
-xor a1 x0 a3
-slt s11 s1 gp
-sll a1 x0 a6
-srl x0 s2 a7
-slt gp a1 s1
-add s6 a5 a1
-sll t5 s9 a6
-mulhsu s3 s8 s2
-sub s7 a2 s5
-auipc tp 653855
-xori t3 s2 -1947
-mulh t1 a2 a5
-ori s8 gp 72
-addi s6 t0 1674
-srli t0 s9 30
-mulhsu t2 s5 a6
-xor s11 s8 t4
-mulh x0 s9 gp
-divu s10 t3 gp
-srli s11 ra 4
-xori t6 a5 -1115
-lui a0 792087
-divu a3 a6 a5
-and t4 s1 s1
-rem s4 a2 s4
-slli t5 t4 29
-divu s9 a6 s2
-auipc t1 318560
-add a1 a2 a2
-lui s4 39246
-sll a7 s0 a4
-add s6 ra tp
-sltu s1 a6 s0
-sltu t5 t3 s6
-lui s1 394356
-mulhsu t3 t3 t6
-remu s11 s11 t5
-sra a4 s1 a2
-mul gp ra x0
-and gp s2 a0
-sra s5 s0 s1
-remu a0 s5 a0
-andi t3 s8 -1150
-and s1 t4 s9
-auipc a6 948271
-divu a5 a3 s2
+xor a4 a1 a2
+sll s9 ra s9
+slti x0 s9 410
+and t6 t6 ra
+mulhu x0 t4 s6
+auipc a4 560937
+ori t4 s8 1545
+remu s4 s5 ra
+sra a6 tp t2
+xor t2 a6 a5
+divu s10 s8 s7
+xori s2 x0 -1104
+remu x0 ra a2
+auipc a5 454549
+or s1 t2 x0
+sra t4 t0 a2
+slti a5 s7 -176
+sltu s5 a1 s6
+mulhu t2 t5 a0
+slti a3 s8 -858
+sra a5 a2 s9
+mulhsu s3 s8 s1
+sltiu tp s0 -552
+and s9 gp a7
+div gp s5 t3
+ori gp t0 -1130
+srli t1 a5 26
+mul a0 t5 s11
+auipc a6 341930
+or s4 s5 tp
+add t4 a4 s2
+mulhsu t4 s11 s0
+sltiu t4 a6 206
+slti s8 t3 68
+div a1 s9 t4
+slt t2 s6 t5
+sltiu a6 x0 523
+or t1 s7 a6
+div x0 t3 gp
+mulh t5 t3 a7
+srl s5 a6 gp
+srli t6 x0 13
+and s11 s11 t5
+xori s10 t6 -1476
+auipc t5 529473
+mulhu s11 s10 a6
+addi t2 ra 465
+slli ra s5 22
+srli t5 a1 18
+sltu a7 a1 ra
+xori a6 x0 -595
+ori t1 s3 -338
+and a6 s10 a0
+addi ra s0 -789
+xori a5 t5 -675
+or s1 x0 a1
+auipc t6 228577
+div s1 s11 a4
+addi a2 s5 272
+auipc x0 713441
+sltu s1 t4 a1
+auipc ra 468963
+remu s5 s3 t2
+divu t3 a2 ra
+and t5 a4 tp
+srl s5 a5 a3
+slli tp s11 4
+xor gp s1 t4
+ori a7 t6 -678
+xor a0 s3 a1
+srai s2 s3 16
+sll t3 t4 s5
+rem ra a7 t6
+mulhsu s9 a3 t5
+add s1 t1 s11
+sltu a4 t5 t2
+slti a6 s0 -592
+ori a4 t1 -807
+divu gp a5 s1
+sltu t6 gp a7
+addi ra s4 -1669
+srl a5 s6 a0
+lui a2 861466
+mulhsu s2 s10 s4
+sub t2 s10 a2
+srli s0 s7 10
+add a4 t4 s1
+sll t5 x0 s3
+remu s10 s1 s2
+divu t1 a1 t2
+srli t3 a0 29
+xori s5 t6 -1355
+or a0 t0 s0
+andi a5 a6 -539
+mul s10 tp s2
+remu t2 s4 a2
+xor s1 s7 t5
+srl x0 s9 gp
 sra a4 s9 x0
-xori t1 t4 -830
-addi a4 s1 -244
-sub s1 t1 t4
-slt s11 s6 a3
-slt s8 s1 s8
-mulhsu s9 a5 s4
-lui s1 254933
-ori s3 s2 -729
-divu s6 t1 t3
-and t1 s5 s5
-srai gp s11 5
-slti t0 t5 -14
-divu a4 s3 t4
-sltu s3 s3 t6
-mulh t6 s9 t6
-lui a7 193857
-andi s1 a0 -26
-or a3 t2 a1
-srai a2 a3 29
-sra t6 t1 a7
-rem a4 t2 t3
-mulh s0 a5 s2
-or a7 t1 a0
-xori s11 t0 -1097
-mul t1 ra x0
-addi t4 a2 326
-mulh a5 a4 s6
-xor a6 s11 ra
-ori t3 x0 618
-addi t5 s9 -181
-sll s7 a5 t1
-slti s5 x0 -1758
-addi s4 ra 914
-and s2 t2 a0
-sltu t5 a5 t6
-auipc tp 698686
-auipc a3 319128
-mulh t6 s8 s7
-srai s8 a3 16
-srl s0 s5 t6
-sltiu t2 a7 -394
-slti t6 a3 -48
-andi s5 s6 743
-and a1 t6 s2
-slt s8 tp t3
-srai s2 t2 0
-xori a6 a6 -821
-andi x0 s3 1199
-srai gp t2 2
-xor t5 gp a1
-ori a7 a5 -425
-div t0 a1 a7
-xori a7 s8 -1914
-slt t6 t6 t2
-mulh a1 s8 a1
-remu t2 a1 s4
-slli tp s3 1
-srl s1 s11 x0
-div a7 a2 a2
-add t2 s5 s9
-lui s5 413380
-addi t6 s3 1934
-div s5 a0 x0
-remu s3 t5 t5
-sltu t0 s9 s9
-div a1 s1 s9
-div x0 s8 a2
-or a4 a1 s4
-or tp a5 s4
-mulhsu s1 a2 s6
-remu a1 s5 a2
-sltiu t4 a5 -166
-sltu s11 t2 ra
-mulhu a7 s0 s7
-sltu x0 x0 ra
-mulh a5 gp t6
-srli s1 s3 16
-andi s0 s5 -1257
-sub a2 s0 t4
-sll s1 a2 a3
-ori x0 a0 -1770
-slt a6 x0 ra
-sub t3 s10 a7
-sll a0 x0 s10
-xori a5 tp -453
-andi s3 gp -1039
-sltu s1 x0 x0
-sra s3 s7 tp
-srli s3 a7 24
-addi s2 t4 1580
-add tp x0 x0
-addi t5 s9 -1497
-mul t6 t2 s0
-or a4 s4 a2
-sltiu s1 x0 302
-slli s6 x0 1
-slt t6 a6 s2
-add a7 a1 a3
-slt t2 a6 s8
-xori s5 s4 -648
-srai a7 s0 11
-mulhu s7 a3 t4
-or a0 a0 ra
-and t0 s1 x0
-mulhsu a2 t2 s6
-srai tp s5 14
-sll gp ra t4
-xor a4 a6 t0
-sltu s0 t2 s11
-mul s7 a6 t2
-remu x0 a7 t0
-sltiu x0 s10 -1809
-srai a7 gp 23
-and t0 s10 t6
-slti s2 a3 -682
-mul x0 s9 a0
-remu a4 s6 s7
-sltiu s0 s7 -868
-rem t3 a4 a3
-slti a4 s8 -1296
-sra a5 a0 t3
-sltiu t2 a3 220
-srl a5 s11 s3
-and x0 s5 t4
-sltu t6 s2 s3
-divu s7 gp a1
-xori a7 t3 -963
-sltiu s3 t0 -2008
-mulh a5 t5 t3
-divu s8 t1 a7
-srl s3 t4 s3
-sra t5 t1 tp
-rem s6 t0 s5
-srl a2 a2 s5
-ori a1 s10 -1185
-or s1 s7 ra
-mulhu x0 a5 a5
-div t2 s1 gp
-and x0 s1 t3
-mulhu s11 s5 a7
-ori s3 a2 -1260
-srai s8 t0 3
-remu a7 a6 s6
-rem gp a0 s11
-add s11 s0 s4
-ori s2 a4 407
-xori t6 s9 -822
-mulhsu gp s9 t3
-mulhu t4 a6 t2
-slli a4 s2 5
-add t4 a2 s8
-slti t2 tp -1076
-andi t2 t5 -346
-xor x0 s11 t4
-add s2 t3 t4
-xori a0 s5 -1174
-sltu s3 tp ra
-add x0 s3 a3
-slti s11 t4 925
-srli a7 x0 2
-xori s3 a0 -1900
-lui a4 707924
-srai t0 x0 10
-mulhu a1 x0 s6
-srl gp gp t1
-addi gp a4 -967
-remu ra t5 t2
-slti s4 t3 -425
-srli s6 x0 26
-slli s0 t4 16
-srai a3 t5 10
-mul a4 s2 t6
-rem a5 t0 a5
-auipc a4 518960
-mulhsu s2 a5 s0
-slt s11 t0 s1
-xor s9 t5 a1
-slti s1 t0 1050
-xor tp s3 t0
-srai s9 a7 22
-mul a3 a5 ra
-ori s4 s3 -266
-ori s9 t4 -39
-xori s0 a3 -769
-divu t0 ra a3
-xori s3 s9 -1120
-mulhu s2 s9 a5
-xor t0 gp tp
-sub x0 t3 s2
-xori t5 t2 1277
-or t4 s4 s10
-mulh a4 ra t6
-slt t6 s5 s9
-mulh a2 t0 s9
-divu s2 x0 t1
-mul s7 s10 a3
-slti ra tp -907
-ori a2 ra 219
-sll tp s1 a7
-sub x0 t2 s8
-sra x0 t0 s9
-srai s5 s2 21
-auipc t4 14516
-xor a3 t2 a7
-mulhsu t5 x0 a2
-div ra t6 s7
-mulhu a6 x0 t1
-slt t3 s10 s11
-sltu s2 s2 s8
-mulhu s10 s0 s6
-mulh s3 x0 t2
-sll a2 x0 t0
-ori a1 t5 -1108
-xor a2 x0 t0
-auipc a5 1034059
-srl gp a0 a5
-lui t4 846742
-sltu a7 s8 s10
-sra t4 s5 s9
-divu s6 s2 gp
-div a2 t1 s1
-div ra gp t4
-andi t1 gp -1799
-mulh x0 s1 s9
-sll s6 t5 ra
-rem t5 t6 a1
-ori s2 a6 1830
-mulhu t0 x0 ra
-slt tp a0 t6
-slt t5 a3 s3
-srl a7 gp tp
-srli s10 gp 3
-sub a0 s10 ra
-slt tp a6 s5
-srai s6 x0 29
-sub s5 a7 s10
-srai s9 a2 29
-xori tp t2 -831
-divu s3 s7 s6
-and s11 x0 a2
-auipc a5 722665
-sll a1 s8 a1
-addi s5 a6 -1413
-sll a7 s0 a0
-mulhsu a4 x0 a1
-slli s11 a1 6
-srli tp a6 16
-remu t4 s8 s5
-or s4 a3 a0
-mul s3 a1 s3
-addi t0 s6 1140
-mul a4 t0 s3
-mulh a1 t2 s2
-slt s7 t6 s8
-mulhsu s9 a3 s5
-remu t1 a4 t6
-sltu t4 tp a2
-sub ra a1 s10
-remu x0 t5 x0
-mulhsu a6 s9 s5
-sra s5 x0 s4
-lui s1 439247
-mul x0 a1 a5
-mul t4 a2 a3
-sll t5 s4 t3
-srai t6 a3 19
-xor a7 t1 s2
-sra a0 s11 a1
-rem t4 t5 a6
-sll s11 a4 a0
-rem x0 s1 t5
-divu s5 s8 t3
-auipc s5 537065
-sltiu s1 a3 -971
-sll t1 s6 t4
-auipc a4 617483
-srli a4 t1 24
-xor s1 t5 s4
-mulhu ra t1 s3
-srl s0 x0 tp
-add s4 x0 gp
-or t5 t3 s5
-srl s4 s9 a0
-xori s7 s5 917
-xor a3 s9 s10
-xori gp gp -1923
-slti s5 s7 -358
-rem s6 t5 t4
-div t5 gp gp
-remu x0 t4 s1
-div t5 a2 s0
-lui a2 190190
-srli s6 a7 29
-rem x0 s2 t2
-srl s6 ra a1
-lui s6 876556
-mulh s1 t6 s10
-mul ra t3 s9
-slli s7 t4 20
-mulhu a0 s5 gp
-slti t5 t5 217
-srai a3 s0 2
-sltu t4 a2 a1
-mulhu a1 x0 t1
-srli s3 s4 7
-xori s0 a7 40
-xor s1 a5 t2
-slli tp s7 11
-slt s0 s9 x0
-add a2 s3 t6
-xori s10 s6 -1453
-addi s8 x0 -1369
-srl a5 s6 t1
-ori a4 s10 -562
-srai t3 s8 22
-mulhsu s8 t3 a4
-sra t4 a1 s10
-auipc t6 521779
-lui ra 893710
-mulhsu a4 s0 x0
-and a7 s1 ra
-divu s10 s2 s5
-xor a6 t6 s0
-mul s3 s0 t5
-sltiu a4 a4 -1129
-sub s9 a4 a0
-rem s0 s0 t3
-addi s3 a1 218
-addi a1 t1 2015
-sltu s5 a7 s2
-ori s9 t5 -735
-sra s3 t6 s8
-sra t4 s8 a7
-lui a2 144117
-sll gp a5 t5
-sub a7 x0 s8
-xori a0 t3 1470
-srli s9 s6 9
-auipc s9 284723
-rem a4 s11 s6
-srl t0 a7 a7
-remu s3 x0 s11
-slt x0 t1 a2
-sltiu s9 s4 2033
-srl s3 s5 a7
-slti x0 s11 -1052
-srli s5 gp 4
-addi a3 a4 539
-and x0 a1 t0
-mulhsu s9 a5 s8
-mulh t1 x0 s7
-sll gp s0 x0
-sltiu s10 t2 -1368
-addi s2 a7 -1614
-srli a0 a2 15
-divu x0 s3 a6
-sltu s1 a4 t1
-and t4 ra tp
-divu a4 a0 s4
-slli s2 gp 12
-rem a2 t4 t6
-lui a0 597473
-add a6 s5 t5
-andi t5 t1 -1295
-auipc ra 43924
-sub a7 t0 a7
-lui a2 141442
-slli a2 x0 29
-srai t2 t1 1
-mulh s2 t1 s10
-div s4 t5 a0
-remu t4 s0 a4
-xor s9 t0 a5
-mul s9 s6 tp
-addi t4 x0 -1580
-slli s2 a5 15
-lui t0 526280
-add s9 a0 t0
-remu x0 a2 s4
-slti s4 t0 -2009
-div s0 s6 a6
-mulhu s10 t2 a3
-andi s5 t1 1836
-slti s11 t5 -891
-srai s2 s1 13
-mulhu t0 tp a2
-auipc gp 304392
-auipc s6 804157
-rem x0 s5 t5
-andi s0 s2 -672
-div t5 t0 t3
-sltu s5 s0 x0
-mulhsu a3 t5 ra
-mulh t6 s7 t3
-xori t6 x0 -514
-or s10 t1 s7
-sltiu a5 t5 -1074
-lui a3 459832
-sub x0 t6 a1
-sll a6 s5 s7
-slti a5 x0 -1341
-slt s4 a4 gp
-mulhsu a1 t6 tp
-divu s3 a1 s9
-sltiu gp s9 -264
-srai tp t4 4
-mul a3 s1 s8
-slli ra t5 21
-sll s11 a5 tp
-srli s0 ra 4
-lui tp 17473
-xori x0 t4 1425
-sltu tp a6 a0
-srl a1 a1 ra
-rem s3 a1 x0
-sll a7 s7 gp
-sra x0 a3 s6
-srai s7 t4 22
-sltu a0 a7 a3
-xor s4 a3 t2
-xor t0 a3 ra
-mul s4 s2 s4
-or x0 s0 t4
-auipc t5 297357
-mulh s6 s8 s0
-srli s11 s4 27
-sltu s9 x0 s4
-srli s8 t2 2
-div a6 a5 a0
-sra t4 a6 s8
-xor s7 s10 x0
-divu t6 t4 s0
-srai t0 a0 10
-mulh a4 s10 x0
-slli s5 s9 5
-sltiu s1 s7 758
-div a1 t5 s11
-andi s3 gp 776
-ori s6 tp -182
-and t0 a5 a5
-srl s4 t3 a4
-lui x0 695275
-mulhsu t3 t3 ra
-slli t5 s10 17
-addi t3 a1 733
-add x0 t1 x0
-or a7 t3 t4
-slt t2 tp s5
-remu t0 a0 ra
-or tp a7 t3
-slt a6 t6 gp
-xori t4 x0 -977
-sub a7 s1 a5
-rem a1 x0 ra
-rem t6 tp s0
-ori x0 x0 -252
-srai t4 s4 21
-mulhsu x0 a6 t5
-srli s0 a0 12
-ori a3 s8 849
-mulhsu t3 a4 t2
-sltu s0 t4 t1
-auipc t6 497653
-addi tp a5 -434
-sra s1 a5 a6
-andi s4 t4 -1182
-auipc t1 891034
-and t0 t2 t6
-ori s0 gp -138
-add x0 s10 s5
-remu t5 a5 x0
-add a6 s6 a5
-and x0 ra x0
-xor s8 s3 a6
-slli s3 s1 15
-slti a0 x0 -1176
-mulhsu s2 a3 s9
-sub t2 t1 x0
-and t3 a7 a4
-andi t3 a4 -198
-sltu s8 a3 gp
-or s8 tp a6
-mulhu s5 t1 s8
-srai t5 s9 14
-srai t3 s10 19
-auipc s3 855416
-remu s1 a4 s10
-mulhsu s6 s3 s8
-sltiu s9 t2 482
-slt t2 s9 s3
-andi a2 s7 -1045
-sub x0 t6 s9
-srai a1 a4 19
-addi a1 x0 -504
-ori t5 t3 -296
-sltiu a6 t6 497
-auipc a2 513867
-addi s3 t6 1985
-div s8 t3 s2
-or t6 a1 s1
-divu s9 s2 a6
-mul s8 t6 a4
-sra t1 a1 a7
-sltiu t3 s5 -384
-mul a2 a5 t3
-remu t1 s4 a4
-sltu t6 ra ra
-andi t5 a7 -353
-div s3 s8 t6
-sub a5 tp x0
-lui s0 358415
-add a6 s9 a3
-remu t1 t1 ra
-sll gp t3 t6
-srl s11 s9 s7
-srli a6 t4 14
-addi a3 s3 1223
-xori s6 t0 175
-srl s9 t6 s10
-xor x0 ra t0
-rem s0 t1 ra
-lui x0 388120
-remu s9 t3 s2
-addi x0 t3 -5
-mulh t2 x0 t1
-sltiu x0 x0 -1232
-sra gp a3 a7
-srl ra t2 tp
-ori tp a6 -937
-add a7 s7 t4
-srai t1 t1 10
-auipc t0 650997
-div s10 t0 s8
-slli t1 a7 31
-ori s5 t6 -1382
-srai s7 s4 29
-sltu t6 tp t5
-divu t4 gp gp
-sltiu t6 t4 1817
-and a6 gp a1
-divu a3 s8 t4
-rem gp ra a4
-sltiu a7 a5 -990
-srai a7 t3 9
-lui a2 90213
-add x0 t1 tp
-div t6 s3 s0
-srli gp t6 27
-andi t4 a3 -1155
-srai t0 s0 20
-srli s2 s2 6
-xor x0 a2 x0
-div s2 a3 s5
-lui gp 656258
-xori s6 s4 -1549
-div s10 t3 a0
-add a1 x0 tp
-srli s6 s2 24
-srai a7 s7 6
-srli ra a4 28
-xor s3 s9 a2
-or a0 s5 s5
-sll a6 s5 a0
-and t2 s3 s8
-div s5 s10 a4
-slti t4 x0 1676
-slli t0 t6 21
-sll s5 ra s9
-slti a5 s2 1145
-mulh a5 a7 a0
-mulh tp t3 s1
-sub s8 a4 t3
-srl t2 s9 t6
-xor ra a0 t2
-sub t1 a2 t3
-auipc s4 650462
-add a4 t6 a3
-lui s11 16372
-rem t1 tp t2
-slt t1 ra a4
-rem s10 x0 t4
-div s3 gp s5
-divu s8 a6 a3
-srai a0 s5 24
-add t2 t4 t6
-slli s11 s10 16
-slti t4 s3 -240
-srl a6 t3 x0
-xor s10 a2 s9
-xori a5 s11 -1807
-add s11 s5 t5
-slt a7 x0 s2
-mulh tp gp s1
-mulhu a0 s4 t3
-xori t5 s2 -569
-remu s11 ra s2
-remu t6 x0 s2
-slt t4 x0 s0
-and s5 s11 tp
-addi s3 t1 -1059
-xor s2 a0 s9
-auipc t3 668912
-srli t6 s2 20
-divu t0 s9 s7
-xor s9 a6 s1
-addi s10 a7 -171
-sra s4 s10 t3
-addi s1 t3 1354
-divu x0 s9 ra
-xor x0 ra t3
-rem a1 s9 s10
-sub t4 tp s8
-slti tp t3 -315
-sltu s4 x0 s10
-xori ra t0 -319
-div s10 a3 s7
-mul a7 t2 x0
-mulhu s3 s0 s3
-xor s5 s2 s4
-srai s7 x0 4
-auipc t2 974291
-auipc t3 407749
-sltu t5 s5 s4
-srai ra a6 12
-div gp s4 s2
-add tp tp a3
-addi s2 s10 -830
-addi t5 a6 -1710
-mulhsu t3 s10 a2
-ori t1 t1 -1796
-divu s3 a7 a7
-mulh s8 t0 s9
-xori t5 a7 1482
-sll s9 s4 ra
-mulh a7 t6 s5
-ori a6 s7 -1181
-mulhu s10 s11 t6
-sra s4 a1 t3
-srli s7 a5 10
-rem s11 a0 s8
-sll s8 s4 gp
-sub s5 a6 s1
-mul t6 a0 x0
-mulhu x0 s6 t2
-add s10 s4 t0
-sub x0 gp a6
-xori t2 s11 1522
-sltiu a4 t3 1872
-or s2 a1 t0
-addi s11 a0 -47
-slti t1 s9 -927
-auipc s2 570091
-remu t0 s0 s8
-or s8 t2 a5
-addi s7 s1 1439
-and a2 t6 a4
-slli a7 s10 20
-xori t0 a5 -680
-mulhu s7 t4 a0
-auipc t6 137359
-and t2 s2 s7
-slli a3 a0 0
-ori s2 x0 -1778
-srl s2 gp a7
-mulhu a7 s3 t5
-sub t6 s3 t4
-srli a4 s3 18
-sll gp s8 a0
-sub s8 t2 s0
-xor t0 s11 ra
-sltu t3 tp s10
-auipc s7 442
-remu a0 s11 a2
-mulhu a1 t1 a2
-ori a3 s1 1616
-slti s0 s6 -1633
-xori gp a1 -1119
-sub s6 s10 s1
-sra t3 t1 s11
-sltu s3 s5 t0
-and s0 a6 a3
-divu t0 a7 s6
-slli s2 x0 22
-remu s2 s2 t6
-xori t3 t3 -1440
-ori t0 s7 -1705
-mulhsu gp a7 s2
-mulhsu s0 t6 s7
-srli s3 x0 23
-sltu t0 s3 t6
-mulhu t5 t2 s3
-srai t5 s11 11
-srai s2 tp 23
-and a7 a1 t4
-sltiu x0 s0 -1100
-slti t0 t5 136
-divu s9 a0 tp
-sltiu ra t3 -529
-sltu t5 t5 x0
-sltiu a1 a6 -1943
-slli a0 t4 11
-andi t0 a4 1608
-andi a4 t6 1715
-div s11 a6 s8
-slti a6 t3 1427
-slli a7 a6 16
-srl s5 x0 s11
-sltiu s4 s2 -1909
-srl x0 a1 a4
-sra s10 a1 a2
-mul t4 a2 s1
-srli t1 t6 15
-sltu s0 s5 s7
-lui x0 159930
-slt x0 s1 x0
-rem s7 s9 s10
-lui a0 197225
-and s10 t2 s2
-divu t3 a1 x0
-remu t5 t3 s8
-slt a6 a2 s2
-sra s6 s9 t6
-srl t1 s3 s8
-sltiu s10 tp 906
-divu a5 a2 a0
-or t3 s8 a5
-or ra s8 t0
-add s7 a1 a0
-or t2 ra a6
-ori s5 a1 -1581
-sltu s11 a1 s10
-srli a4 ra 29
-divu s0 a0 s5
-srl t1 a6 t3
-divu a7 tp a0
-auipc s4 955419
-or a3 a5 gp
-sub gp t2 gp
-sub t2 s10 t3
-and t1 s10 s1
-addi a7 x0 887
-xori a6 a1 1373
-add s11 a6 a3
-sra s11 a1 a7
-slli s11 gp 1
-srai s7 s4 25
-add x0 s1 a1
-and t3 s6 s7
-mul a7 ra s7
-or a2 tp gp
-xori gp a4 1532
-sub t1 s9 gp
-andi t6 s2 827
-divu a1 t5 t1
-auipc s11 323954
-slli t1 t1 25
-remu s6 s0 x0
-xori t3 a0 -1542
-addi a0 t6 -1164
-slt s8 t4 a3
-auipc t5 876466
-rem x0 s10 a3
-xor gp s3 a0
-andi s7 s1 699
-mulhu t4 a5 x0
-srli a6 t1 7
-sub s2 s9 s7
-add s10 s7 s3
-addi a6 tp -1687
-addi t5 s8 -303
-auipc t4 664554
-mulh t1 s0 s6
-ori s10 t2 1311
-xor t6 t4 t6
-lui s0 353235
-addi a4 s10 -1302
-and a6 s5 t4
-xori s10 x0 -876
-mulhsu tp s9 a3
-sra s2 t5 s2
-ori s2 gp -1316
-ori t2 t2 -229
-mulh t2 t1 a7
-or t5 t4 a0
-slt t4 s9 t4
-mul s6 t0 t2
-srai s9 t6 18
-andi s5 s7 -1061
-rem a1 s5 s3
-srli a3 a0 25
-sltu s0 s5 s7
-sltiu t5 a6 -1951
-srli t6 s7 2
-remu s5 s3 s5
-sra t4 s10 a3
-srl a1 t5 x0
-slti s2 s4 1953
-slli s5 s11 18
-addi a7 s1 1799
-slti s7 a5 -243
-srl t2 gp gp
-and a4 t0 t5
-slti s4 a5 1395
-mulh s5 s8 s7
-slti ra s9 -972
-srl s6 tp ra
-sltu a7 a6 a6
-xor t5 s11 s5
-lui a1 808369
-mulhu x0 s6 s0
-ori a2 s11 -658
-addi s7 s8 -159
-mulh a2 a2 a4
-auipc s3 224477
-slt a5 x0 a2
-sltu s10 a3 a5
-mul a7 t3 ra
-add t4 s10 x0
-div a3 a3 x0
-or a3 a0 s10
-xori a7 s7 -1140
-mulhsu a1 t6 a2
-auipc t1 771465
-xor s8 x0 a2
-mul t0 t6 s8
-divu tp t1 t3
-lui a7 695189
-or s11 s9 t4
-sub a1 t2 ra
-rem x0 s2 s11
-slt s3 s8 a3
-sltu a7 x0 s2
-xor s1 s6 a5
-remu s2 s5 a6
-andi a5 x0 -1341
-sltu t1 t0 t0
-mul a6 t3 s6
-sltiu s0 s7 -1424
-and s11 a2 t4
-ori tp t0 -1247
-div t5 s9 s5
-sltu t2 t4 s5
-mulh a5 s11 s9
-mulhsu a3 t3 tp
-mulh ra ra gp
-rem a7 a2 t5
-add a0 a1 a3
-lui a0 402157
-lui t6 457249
-sltu t6 ra s3
-sltu t5 x0 t0
-add a4 a0 x0
-sll x0 t5 s10
-sub tp s5 s11
-auipc a0 107636
-xori s9 t6 576
-mulh a1 a3 t2
-andi t1 a7 -1976
-andi x0 s2 -1810
-auipc gp 642671
-rem a7 t4 a7
-srli a4 s10 22
-add t3 s1 t3
-mulhu t1 x0 x0
-and a2 a0 t3
-divu s11 s5 t3
-rem a0 tp s5
-divu t2 s1 a6
-slti a5 a0 -894
-mul a6 s0 ra
-remu gp s5 t4
-mul t5 s3 s1
-andi a6 s7 -1940
-auipc s1 634366
-ori t0 tp 1923
-mulh a7 t4 a5
-div t2 s6 t0
-srl s10 x0 t5
-remu s3 s9 s0
-addi s1 x0 -92
-sra s9 gp s5
-xori t3 t4 -1953
-srli tp s4 29
-sll s7 a0 tp
-divu a5 a7 t4
-slti a5 a2 634
-sra a7 a7 s2
-slti s7 a0 -1070
-xor a4 gp a7
-slt s3 s8 s9
-div s6 ra t5
-rem s9 s5 s4
-div s2 t1 ra
-sra s4 s11 s10
-mulhsu t5 a4 t0
-sltu a3 a0 t5
-sltiu a1 a7 1806
-rem a3 t0 s2
-xor s8 t4 s8
-xor s5 a1 a5
-srli s10 s4 4
-addi a3 ra -1427
-slt t4 t1 x0
-mulhsu a7 a5 gp
-srl gp t6 t2
-xor gp t2 a3
-div s3 t1 t6
-srai x0 t4 9
-srli s0 x0 7
-sltiu t6 s1 -344
-slti s5 a2 -837
-srli s4 tp 13
-andi a5 s11 1934
-srli a6 a6 11
-divu s4 x0 s0
-ori gp t3 1592
-sltiu a3 s2 -414
-sra t5 a4 x0
-remu s0 t6 gp
-xor s11 s6 t5
-rem s2 x0 a0
-slli t5 t3 23
-srai a1 s0 11
-xor x0 a5 x0
-sra t4 x0 s5
-remu s5 s11 t6
-addi s10 s0 953
-sltiu t0 s11 -2015
-srli t4 x0 15
-mul s0 t3 s10
-sra a4 s1 s6
-mulhu gp s1 t1
-srai a0 a2 3
-sltiu s0 a4 -1120
-xor s5 t1 a2
-mulhu s5 s9 s8
-sra ra a7 gp
-srai gp s5 14
-srl s11 t3 a5
-div ra s0 a6
-slli t1 ra 19
-sltu t2 t6 s2
-xori s0 s5 -1440
-div s5 t4 s2
-auipc t6 300920
-sll t4 tp s8
-auipc s11 766941
-mul s7 s11 t4
-sltiu s5 s3 -140
-xori s10 a6 -1802
-srli tp s10 23
-slli s7 s0 3
-sltiu x0 a1 475
-slli s4 x0 20
-andi s6 t0 -1271
-srl s4 a6 t2
-mulh s6 s10 s9
-srli s2 t5 28
-auipc a0 501838
-rem x0 s9 a3
-sub s7 s0 a6
-sltiu a1 tp -1182
-sltu a0 s6 s11
-sltu s5 a5 s5
-xor s2 ra s3
-div s1 a0 s1
-mulhsu s3 s6 a6
-and a4 t3 a7
-srl a2 x0 s9
-mul s6 s3 s1
-mulh s6 s2 t4
-mul a1 x0 ra
-auipc a3 118798
-and x0 a5 x0
-or a0 s9 s7
-addi a0 a5 -59
-sub x0 s0 s7
-slti s10 s0 492
-lui s7 526633
-auipc t0 898323
-addi s1 t0 -134
-andi a5 s6 1073
-addi a4 s6 -1806
-sltiu s6 s3 -1671
-sll a4 s7 s3
-divu t3 a4 t1
-xori t4 a4 -1624
-remu t3 x0 a5
-xor t6 s7 a2
-sltiu gp s2 1209
-srai s11 a7 30
-xor t5 a7 a4
-and a2 tp gp
-remu t5 tp s7
-addi s0 t2 -1793
-add s7 s10 ra
-mulhu t3 t2 s4
-mulhu ra a7 s1
-sub a5 t1 s2
-slt t3 a5 gp
-sra s8 s7 a0
-divu t6 a6 s1
-sll s9 a2 a5
-srai a5 gp 8
-divu s7 a7 a5
-addi a0 a2 -554
-sra gp a5 s4
-and a4 a4 a4
-ori a1 s10 -788
-slli t1 s10 27
-sub s2 s5 s5
-sub a3 s10 t1
-mulhu s2 s11 t5
-ori s9 t5 -119
-srai t4 s5 15
-xori x0 x0 -1304
-mulh s10 x0 a7
-mulh a2 a1 a3
-mulh tp s7 s9
-sra a7 x0 s7
-slt s4 s11 t6
-sltu s8 s10 s7
-sub s5 x0 s8
-slli s7 s8 6
-remu a2 a2 a2
-xori x0 s9 1379
-xor a6 t2 s11
-lui t3 400167
-addi s11 x0 -463
-add a2 a3 x0
-mulh a5 t0 x0
-andi a1 a2 1695
-divu t0 t0 a1
-sub gp s5 a3
-mulhu a4 ra a1
-srai s7 s11 24
-andi s10 s6 -388
-auipc s8 993731
-and s0 a4 s4
-srl t5 t2 s10
-andi a6 t3 -1385
-and s0 a2 t4
-xor t0 s2 s8
-and gp t5 s0
-mulhu x0 s6 s4
-divu a3 gp t2
-mulhu s5 s0 x0
-sub s2 s1 a6
-auipc a6 868177
-mul a3 s4 t4
-slli s11 a0 2
-srai ra a5 21
-slti s8 a7 -1865
-sll t1 s0 a4
-sub a2 a6 s1
-xor tp a6 gp
-mulhsu s2 s11 s0
-lui t6 14854
-divu gp s8 s8
-slt s8 t4 t2
-divu t6 a2 t1
-addi s6 t4 -71
-srli a5 s10 30
-divu a6 s3 a2
-rem s9 a5 a7
-rem s1 a7 a5
-mulh s6 t5 s8
-remu x0 t5 a2
-mulhsu t0 s8 a6
-remu s1 t2 a3
-remu s8 x0 s7
-mul a7 a6 s11
-srai a3 x0 8
-mulhu s10 ra x0
-srl t1 t6 t1
-auipc a4 314912
-sub s7 t0 s3
-xori tp ra -1419
-mulhu ra t3 x0
-divu ra s7 a4
-lui t2 242064
-slli s5 a6 28
-srli a3 s3 23
-slt x0 a5 t2
-or a1 a0 s2
-rem a6 s7 a1
-auipc s2 571350
-divu t5 s1 s0
-sra s8 a3 s0
-slli gp s4 6
-slli s6 s0 1
-slti tp a0 -1519
-divu a3 s10 a3
-addi s7 s11 2038
-slt a4 a3 s3
-slli s3 s10 29
-addi t5 a4 -250
-add a1 t5 a2
-andi t1 t4 -29
-xori x0 a7 -155
-div gp a7 ra
-add a5 a6 t1
-divu x0 a1 t4
-auipc tp 187345
-or s9 t4 a7
-slt a4 s8 s9
-slli s6 x0 10
-andi a0 s7 -120
-or a2 a7 s11
-srai s10 s9 22
-rem s6 s10 a7
-andi t5 s9 -1176
-andi s0 t6 -356
-slli t5 ra 18
-divu a3 a6 a7
-auipc s6 652577
-srai t1 s1 0
-sra s0 a3 s7
-sltu t3 x0 s5
-mulhu gp a7 x0
-srli a2 t1 7
-and a0 t1 ra
-mulhsu x0 s2 a6
-remu a3 s10 s11
-sll a5 a2 t0
-or s3 a3 s8
-srli s4 t0 17
-mulhu t5 t4 s6
-ori s4 a0 2046
-slti x0 s10 74
-auipc a6 156693
-sltu t1 s9 x0
-remu s8 s6 gp
-lui a3 52225
-auipc a5 1024521
-ori s3 s3 -1779
-xor a4 a5 s0
-ori s10 s10 -20
-and a2 a2 t4
-slli s3 a5 22
-auipc s10 789898
-sra t5 t3 x0
-xor a4 a3 t2
-xor t3 t0 ra
-xor t6 s8 s6
-mulh s8 t3 t1
-srai s9 s1 2
-remu a5 gp gp
-srl t6 t6 s6
-sra s8 a2 a0
-add a4 s9 t0
-add a6 x0 ra
-sltu s10 ra s10
-div s6 s3 s9
-srai ra s9 30
-sltiu gp a3 1202
-slti s6 gp 1115
-rem a4 s1 a5
-mulhu gp t4 s10
-mulh a5 t6 s11
-ori a1 x0 -2008
-sltiu t3 s2 192
-sltu s8 t3 s8
-remu t4 ra s11
-srai s4 s10 2
-lui t0 374462
-sll s5 t4 s10
-xori t5 a3 1599
-slt a7 s4 s10
-addi t2 s3 -153
-divu t6 x0 s2
-srl tp t5 a6
-slli a2 s1 29
-add t3 a2 a5
-sltu t2 x0 t1
-srl t5 t5 a3
-srl a2 s7 t2
-lui s11 137653
-sll t4 t0 t3
-sll t6 t1 s3
-srli t6 a5 21
-sra ra a0 s11
-sltiu a7 x0 1495
-xor t1 s10 t2
-mulh a2 s6 t0
-srl a2 a5 a7
-add s11 s11 s2
-xori a3 s1 -1034
-mulhsu t5 a2 ra
-srai a0 a0 24
-sra tp a3 a1
-slti s3 s1 -939
-slti s1 t4 -699
-mulhu x0 s1 a7
-sub s10 s11 s4
-lui gp 821177
-sll s9 x0 t2
-and t6 t6 a1
-div s0 t1 x0
-and s5 t1 t0
-and t4 x0 a3
-slli s3 s8 29
-ori x0 s5 -1496
-srl t5 gp a1
-ori t1 a4 -744
-sltu ra a5 s2
-sra s6 s2 s1
-lui s5 803007
-xori a6 gp -1802
-div a4 gp t5
-srai t3 a0 19
-sltu ra s9 gp
-mulhsu x0 t1 t4
-sll s0 s9 s1
-slt s8 s3 a2
-xori s6 t6 -1597
-mulhu t5 s8 s8
+srl x0 a2 s8
+ori a0 t3 390
+mulhsu a7 a7 a3
+mulhu s6 gp s1
+add x0 t4 t3
+auipc ra 189872
+srai a0 a5 17
+mulhu gp a6 a7
+sra t0 a2 s7
+slti t2 ra -1875
+or ra a5 a1
+sltiu t0 s2 -358
+slli s2 t6 17
+srai t4 a3 5
+srli s6 s9 26
+rem a2 t5 s0
+and s10 s4 s5
+rem ra s4 s2
+mulh t1 a1 s3
+addi x0 a3 -878
+ori x0 a6 -495
+sltiu s8 t6 -1209
+ori tp t0 -108
+sltu s3 s10 t3
+slt s5 s8 s10
+sra s7 a7 s9
+or a3 a0 t3
+mulh s1 a4 a5
+srai t1 s6 21
+auipc s8 467891
+div a4 a7 s6
+mulh s5 a2 a5
+sub t1 t1 s2
+srli a4 s7 13
+sll t3 s9 t0
+mulh a4 s8 t4
+xori tp s1 -14
+mul s4 t3 t4
+sltiu s1 s8 -1951
+mul t1 s10 s3
+add t0 s11 s8
+srai s1 a5 20
+xor t6 ra x0
+andi t1 a1 -2020
+lui s9 467988
+mulhsu t0 s1 t6
+divu s1 a5 t6
+add a5 t1 t1
+srai s11 s2 22
+divu s3 a4 a4
+sltiu t3 x0 -1162
+srl tp s0 a5
+mul t5 s2 s7
+sub s2 s2 ra
+andi a0 s5 -424
+andi t1 s0 360
+divu a4 a2 s1
+div t0 a1 s8
+or t3 s6 s8
+lui x0 922644
+xor s10 t1 t5
+div s0 x0 s6
+auipc t0 899369
+srli x0 s1 26
+add s1 t0 a5
+remu a7 a4 ra
+add s11 gp t5
+andi t5 s4 -649
+sltiu a2 s4 -181
+div s0 s9 a3
+add s9 tp gp
+srli s8 a0 2
+sll s9 t6 t4
+auipc t6 4203
+andi a0 a7 205
+add gp a6 s5
+andi s11 s4 1701
+addi s2 t1 -1603
+add t3 t0 s0
+srli ra a0 5
+slli a6 a0 7
+remu a4 s7 a5
+lui t1 137894
+slt t1 a4 a1
+div t3 t4 a3
+sra s9 t4 s10
+slt a1 s4 a5
+andi t6 a2 16
+auipc x0 55009
+or s4 s1 a5
+slti t2 a1 -1588
+srli t0 s0 19
+srai s2 tp 22
+xor a6 s8 t0
+mulh s0 a1 ra
+srai a1 x0 4
+ori s3 a6 -1299
+divu s5 s11 s4
+xor a2 t2 a0
 sra s1 t0 s7
-auipc t3 437238
-and t4 a6 a4
-and a3 s2 a6
-slli s0 t5 10
-sll a0 s7 gp
-add a4 s9 s9
-slti a5 a4 -733
-xor tp ra t6
-remu s5 t5 s0
-addi s3 x0 -1450
-srli s10 a2 16
-divu t4 t5 s5
-xori t2 a2 -1788
-add s8 s2 s5
-ori a4 t4 -1910
-div a1 x0 s8
-divu a6 s9 tp
-xori x0 x0 1827
-sll s10 s9 a3
-mulhu a7 t6 s4
-xori a2 a3 -93
-sub t4 a6 t6
-ori x0 x0 -1635
-lui t3 476226
-srli s7 t2 23
-sra s4 x0 a6
-slt a3 t2 t5
-slti a5 a2 -740
-mulh x0 tp t6
+and a4 s6 a1
+and a4 x0 t6
+slti a5 a2 -1589
+srl s3 ra s11
+slt t2 s4 a0
+mulh x0 s6 s7
+auipc a2 968659
+srai x0 s1 16
+srl s11 a7 s11
+auipc a7 999366
+add t5 t5 t2
+mul t4 t0 s1
+lui s7 998031
+sltu a2 s8 s6
+ori ra t5 -753
+mulhsu s2 s9 a5
+mulhsu t4 a6 gp
+auipc s4 23828
+sll t6 s4 a3
+slt a2 a5 tp
+slti s0 a6 -838
+srl a4 t0 x0
+slli a7 a4 26
+slt gp s6 s8
+xori a4 t3 2004
+sll a5 a4 a6
+mul a6 t4 x0
+sll s6 t3 a3
+and s10 s10 s5
+sltiu s11 s9 -780
+mul t4 gp s9
+sltiu a3 a2 -1282
+srli t3 a1 4
+mul a4 a0 t1
+andi a1 a5 -1496
+mul x0 s2 s5
+mul a6 s2 a2
+slti a5 s6 1198
+sub a4 x0 t5
+slti s0 s1 826
+sltu x0 a4 a0
+srli s1 s3 6
+sltu t3 t0 ra
+ori s3 s7 -804
+divu t4 t2 s10
+srl a0 t0 a3
+and s0 s0 a3
+sltu t2 a1 s4
+div s10 s2 t5
+rem a0 a6 s2
+divu s11 s8 s5
+mulh a5 s9 s7
+auipc s6 114155
+rem t5 s7 s8
+xori s0 s5 -1283
+ori s6 s6 1790
+srl a3 a0 t2
+and s8 s9 a2
+ori s5 t2 -875
+ori a4 s9 644
+slt s2 s0 s4
+andi a7 s0 -1475
+slti ra t3 -908
+sll a2 s6 s9
+addi s3 s6 -1281
+auipc s6 522074
+andi t3 x0 524
+div s5 s8 s4
+sub s4 a3 gp
+add s9 a2 ra
+xor a1 t0 t3
+sll x0 x0 s0
+or s1 a2 t1
+andi s9 gp -300
+slt a3 s11 s7
+sltiu a4 a0 1528
+rem a0 a1 s9
+sltu gp a2 gp
+and a3 a5 s10
+slt a6 t3 s2
+xor t6 s2 s3
+sltiu s1 s11 168
+remu a0 t6 a2
+sub x0 t5 t6
+lui a2 431801
+srai a2 t1 13
+divu a7 a6 t3
+lui ra 821792
+srai a7 t2 2
+remu s6 s9 t1
+mulhu s2 t4 a6
+sll s10 a3 s3
+mulh a0 s3 t5
+mulh t1 t6 a3
+xor s7 s10 s1
+ori a6 tp -333
+sltu t0 t2 a5
+slt a5 t5 a7
+xor tp s10 a0
+lui t3 87456
+auipc s11 1017781
+mul s0 s9 a4
+slt a1 s4 s1
+slti t6 a6 -201
+lui x0 771025
+sltiu tp a7 -1397
+srl s11 a3 s0
+srl gp t1 t4
+mulhu x0 t1 t1
+srli a0 s9 10
+slli t0 gp 26
+sll a7 s3 a6
+slti t0 s5 2006
+rem t2 t2 s10
+sltiu t0 gp -1229
+xori a3 s2 -184
+sll s9 a6 s6
+divu x0 a6 t3
+add a5 s1 s1
+slt x0 t2 t2
+slti s2 tp -574
+rem s3 a6 t4
+remu t3 s3 t2
+slt s1 s1 gp
+mulh a3 t1 a6
+xor a7 a1 t1
+xor x0 gp a5
+xori s0 t6 -998
+div t6 t6 s5
+xori a0 s7 -1127
+rem s3 s5 t6
+add a3 s5 s0
+add s8 t0 x0
+srli t2 s4 2
+mulhsu ra s6 a5
+sll s8 t1 s7
+lui t3 614310
+mulh s2 t4 s10
+add s6 s0 s11
+mulhu s0 gp t4
+addi x0 s4 -717
+xor t5 s2 s10
+rem x0 t0 t5
+xor s2 a1 s0
+sltu a5 s3 s3
+srl a0 s0 gp
+remu x0 ra t6
+auipc s5 696408
+lui x0 243878
+mul s11 t0 t4
+add s3 tp t4
+slt ra a1 t0
+srl a5 s1 t4
+addi a3 a2 91
+div a2 t6 s4
+sra s2 gp t3
+sll s2 s11 s1
+sltiu a4 tp -1017
+div t2 t4 t6
+auipc s1 457322
+add x0 t0 s11
+andi a1 s9 1091
+xori s0 a4 -314
+div tp ra a5
+srli s10 gp 29
+mulhsu a4 s7 t4
+srli s8 t3 18
+sll s6 s6 s6
+remu x0 a0 a0
+lui a4 346734
+or a3 t4 ra
+mulhsu tp tp s4
+sub t2 tp a7
+sltiu s7 s4 -471
+mulhsu t0 s9 t0
+auipc t4 1018892
+div s10 t3 s2
+mulhsu s9 t6 a4
+srli gp t4 21
+srai t1 s3 15
+rem t0 gp t6
+div s2 a7 s6
+divu s3 t6 x0
+auipc a7 142767
+ori tp s4 -1775
+sltiu t1 t6 1566
+srl s0 s8 s10
+andi a0 t5 -1374
+rem s0 a4 a3
+add s8 s7 s0
+and s9 a1 x0
+mulhu t2 s7 t5
+mulh t5 s1 a7
+rem tp ra s11
+xor s7 ra t2
+mulhu t6 gp s5
+ori s8 t1 -892
+mulhsu s0 s1 s7
+sltiu s4 t6 887
+srai a6 s5 20
+slt t0 s4 s0
+sltiu a3 t6 -483
+sltiu t0 x0 -1087
+sub s5 t1 s3
+lui a5 963982
+divu t6 s0 s3
+slti a2 s7 -2015
+ori t5 a6 -387
+xor s8 a2 s4
+sltu s9 a0 a2
+add s11 a4 x0
+slt s8 t4 a4
+rem t5 s5 gp
+srli s11 s1 19
+sra t1 ra s2
+mulhsu x0 s8 s5
+mulhsu t6 a0 s6
+slt s5 a0 gp
+slti t2 tp 35
+remu s0 a1 tp
+div a5 s10 s1
+xori a7 s4 -66
+mulhu s10 t6 s5
+ori s4 a5 -762
+mulhu t4 s0 s8
+sub s4 a0 s9
+lui t2 20516
+remu a2 a6 t6
+rem a2 gp ra
+div a1 s3 s2
+sra a2 s10 s8
+and t5 s6 x0
+sll a4 s11 s3
+srai a4 tp 7
+srli s8 s9 8
+slti s3 s1 1889
+slt s5 s4 t4
+auipc s3 904965
+remu t5 s9 t3
+mulh s9 t1 s6
+sltiu t3 a1 -776
+lui t4 751218
+slti t0 s5 87
+rem s2 s9 s3
+or t2 tp s11
+addi ra s2 -1381
+xori tp x0 1956
+sra t2 x0 a7
+slti t6 t6 1570
+xor t1 s0 t0
+slt s3 s10 gp
+andi s1 s9 -706
+addi s8 s9 -1703
+and gp t6 s0
+add gp a2 s11
+sll a3 s10 a1
+sra a4 s9 a4
+lui t1 490105
+srli s10 a3 18
+lui s4 509997
+srli a0 a3 14
+lui s5 996181
+sltiu a1 t3 -458
+slti a2 s6 -813
+lui a3 825712
+sltu s2 a7 x0
+divu a7 gp a1
+divu a7 a1 ra
+auipc s4 159234
+remu s1 s7 a1
+slt t6 t2 t2
+remu s6 t6 x0
+add a0 s5 s3
+and s1 a0 s7
+sltu s3 t1 s5
+or s11 t5 a2
+slli a4 s1 4
+xor s4 t5 t3
+mul t0 a7 t6
+mulhsu a2 t1 t6
+xori a6 a1 -124
+srl tp x0 s9
+ori s7 tp -1768
+remu s10 a7 a7
+slti s9 a3 -1059
+slli a6 s7 20
+srli s10 s10 4
+add s2 s2 a1
+mulh t3 t1 a7
+xor s5 a1 s2
+auipc a4 275852
+div s6 s9 s7
+remu gp a7 t4
+addi t6 t5 -1524
+srai t1 t3 30
+div t2 a0 t1
+add t2 x0 s2
+addi t1 ra -1753
+ori t4 a1 -2008
+srai x0 a5 31
+sra a6 s2 a4
+srai a5 t4 2
+srl t2 s1 x0
+auipc t5 309744
+sltu s2 s1 a1
+mulhu s2 a4 a4
+remu x0 a2 s7
+slt s1 s7 x0
+xori tp ra -1920
+remu s1 s8 x0
+srl a0 a2 a6
+divu t1 tp a6
+sll t5 t0 t1
+mulhu a7 t2 s8
+add s10 x0 s2
+ori s11 t6 1079
+slti s3 a3 -377
+srl t3 t6 s6
+andi a3 t1 -1570
+andi a6 a3 1898
+div s7 a2 s6
+slt s6 a1 x0
+srai s5 s9 30
+srai a6 s1 1
+remu t6 t5 a5
+xori t5 t2 -682
+mulhu x0 tp gp
+mulhsu s2 s5 a2
+remu t6 s6 s3
+slti s0 x0 -1592
+add x0 s3 t4
+add t0 s10 a4
+sll ra a0 a5
+div t2 a2 t6
+mul a2 gp a2
+divu s6 s7 s4
+andi t0 t0 -680
+ori t6 a2 -1994
+xor x0 a0 s8
+div s11 s4 t1
+sll a0 s4 a4
+mulhu a0 x0 s4
+sub x0 a0 a3
+sra t1 a1 s11
+mulh a0 t5 s2
+srli t2 a4 10
+addi gp a7 -1998
+mulhsu a3 tp s5
+andi s2 x0 -747
+rem a4 t4 s2
+mulhsu s2 x0 a4
+xori s6 s3 -77
+sltiu a0 s8 1266
+and s2 s2 a7
+andi s6 s1 -159
+auipc s5 7122
+mul s9 t0 t6
+rem t5 s11 gp
+andi t5 t3 -1815
+add a7 a1 s5
+andi s11 gp -798
+andi s0 ra -1925
+addi s0 s7 -1221
+xor a1 x0 s9
+div a6 s4 a2
+slt gp tp t3
+sub s2 s0 t0
+remu a2 a1 s1
+rem a6 t1 s4
+sub a2 a5 s4
+slti a2 s1 1727
+ori gp s2 1039
+sll ra s0 t6
+slti s2 a1 1906
+sltiu a2 t2 1096
+add a1 s6 s2
+slli a0 s10 1
+slti s2 s4 433
+sra a4 a5 x0
+lui t3 310308
+sra s6 gp a7
+sltiu ra x0 1110
+mulh t6 ra x0
+sub a1 a4 s7
+remu t3 gp t0
+ori t3 t5 -1162
+mulh s2 x0 a4
+divu s4 s11 x0
+mulhsu a3 a1 gp
+andi a6 s8 1834
+srai t6 s3 4
+slli tp s9 21
+mulhsu a5 gp t5
+addi tp a3 -1900
+sra a5 s3 a4
+slti s10 a7 -894
+ori a3 t4 -996
+auipc a3 310782
+xori a2 s7 -1123
+or t6 tp s8
+and a0 t2 a0
+and s6 a4 s3
+add a4 t5 a3
+add t4 s6 s10
+sll a7 a0 s3
+xori s7 t0 -1302
+and s8 s4 a4
+srai a0 a5 19
+srli s11 x0 6
+slli a0 s5 30
+slti t6 a1 -1036
+slli s11 s1 4
+auipc x0 199638
+add a2 ra s7
+mul s3 t1 t6
+add s2 s1 s1
+divu s0 a2 a7
+slti s6 a7 -185
+srai x0 t4 26
+auipc t5 924451
+slti gp s5 1114
+slt a5 s1 a2
+auipc s6 1021697
+mul s4 s10 a0
+add s10 s4 a0
+srli t1 a7 2
+xor s5 gp a2
+remu a0 a6 tp
+sub t2 gp a2
+sra s7 a1 s0
+srai t2 s1 30
+xor s4 x0 a7
+mulhu s10 s11 s2
+slli gp a6 13
+sll s3 a6 a2
+or x0 a2 a3
+mulhu a1 a2 a4
+lui s9 888611
+xor s2 gp s1
+and ra s10 x0
+mulhsu t0 s1 s1
+slli t4 ra 8
+sub s6 t1 s10
+mulhsu x0 ra ra
+sltiu a5 s5 -434
+mulh s0 s7 s5
+sub s4 s9 t1
+xori s0 a1 -1514
+mulhsu s4 s9 s7
+mulhu s0 s6 a5
+auipc a4 635044
+sltiu t5 s3 735
+mulhu a6 a5 s4
+or gp t6 s5
+slt t2 t4 s7
+andi x0 a7 -1379
+mulhsu s2 s8 s8
+divu a6 t3 s8
+mulhsu s4 t5 t2
+sltiu s7 t0 -1579
+mulhsu t0 x0 t4
+andi t0 s3 -888
+ori t6 s2 1472
+xori ra a6 -777
+auipc x0 147315
+mul ra s10 a0
+addi s6 s4 -635
+remu a5 x0 t1
+slti t6 t4 -1659
+slt s9 t1 s3
+slli s1 a1 13
+sltu gp a4 ra
+mul s4 a5 s8
+rem gp s4 a7
+and t1 a7 a0
+remu s8 a4 t0
+divu t6 s7 a4
+lui a4 767528
+auipc t4 917693
+srl a5 s6 t1
+sltiu s6 t1 1551
+sub s5 s9 ra
+remu s4 s5 t2
+ori a2 t5 -756
+sra x0 s1 a7
+rem s5 s2 s0
+slt t2 s0 a5
+slt t1 gp s3
+lui t0 878676
+and t2 s3 s0
+lui a0 703286
+mulhsu s10 s5 s7
+sra s3 s0 s0
+srli s3 s8 19
+sub t4 s6 s9
+sll x0 x0 a0
+srl s3 s6 ra
+srl s6 s9 s3
+div t6 t6 s9
+andi s4 s1 248
+mul s11 s8 ra
+mul a0 gp tp
+rem a5 t1 t4
+and a4 s1 ra
+andi t1 t1 1293
+mulhu t3 a7 tp
+remu a3 x0 tp
+rem t5 s0 a3
+slli ra a4 14
+add s6 a6 a2
+div x0 a0 ra
+srl a5 a5 s11
+mul x0 t0 a1
+add a4 t1 s2
+mulhsu s8 a3 gp
+srli s2 s2 22
+sltiu t6 a1 -837
+sltu t1 tp s4
+sltiu s4 s5 -352
+slt s4 s2 s9
+sub a0 s11 x0
+mulh a4 t6 a2
+srl a2 s2 s10
+div gp x0 t5
+sub t2 s6 s1
+and a6 t2 a4
+srli a5 t4 8
+addi t6 a4 -579
+mulhsu t5 s11 tp
+lui s7 407073
+ori s3 s11 1931
+sll a1 x0 s8
+xori t1 t2 -957
+auipc a4 148764
+div a2 a3 s8
+slt a3 a1 a3
+sltiu s10 t2 -21
+slti s10 s11 728
+and x0 s2 a4
+mulh a0 s7 t5
+srl t3 s6 ra
+divu s3 s1 s1
+or s7 s3 t6
+auipc s6 163340
+slt t6 a7 t3
+or t6 s8 s7
+sll s6 s8 t2
+sra x0 s3 a2
+slti t6 s3 -450
+srai a3 a2 1
+auipc s1 189542
+and a7 s9 t0
+sra t5 s11 s11
+srl a0 s0 t3
+slti t4 s6 -208
+mulh t4 s1 t1
+srai a3 s7 6
+sltiu s0 x0 -1795
+add a3 t5 s8
+mul s9 s10 a3
+div a6 a4 a0
+srai gp a1 17
+divu t5 t4 a0
+divu t0 s11 s2
+ori s7 x0 -1745
+mulhu a5 a5 s6
+add a4 a6 t1
+slt a0 t2 x0
+or gp s2 tp
+sra s1 x0 x0
+mulhu s10 a5 a4
+and t0 ra gp
+remu s8 a2 a3
+rem a4 a7 s8
+xor a2 x0 x0
+slti a3 s2 -927
+srai a6 t5 2
+divu tp t3 t6
+and s8 s9 s3
+mul s1 x0 a6
+sra t2 s5 gp
+xor t1 s4 s1
+srli s11 x0 6
+sltiu a6 t1 1835
+andi s11 s7 -454
+sll t6 x0 s9
+xor s7 gp s4
+addi s6 t3 -121
+divu a7 x0 t1
+mul t1 s0 a6
+mulh s11 t5 s8
+slli a1 s5 18
+mulhsu s1 t5 s1
+and s7 a0 x0
+remu s6 a5 t3
+rem a4 x0 gp
+mulhu a5 s2 t3
+and x0 ra s5
+add s9 t2 s2
+mulh t6 s11 tp
+xori s0 a5 821
+mulh s7 s10 s1
+lui t1 893925
+srli a3 t2 23
+add s5 a2 s0
+xori a2 a6 -161
+mulhsu a7 s10 s10
+add a1 s1 s7
+slli t4 a7 22
+srl t3 t1 a5
+sra s9 s10 t5
+srai s8 s9 22
+srli ra s5 11
+sltiu t1 a5 558
+sub s10 a6 s7
+slli s6 t0 31
+or t5 t0 a4
+ori t4 t6 -178
+slti s9 t2 85
+srl a1 t3 t2
+addi a4 a6 -972
+sub x0 a2 s11
+slli a4 s9 22
+slt a5 s6 s10
+xori a6 t2 60
+divu s4 s3 s8
+sltu a3 tp s4
+sub a7 a1 a5
+sltu x0 tp s9
+slli a7 a0 27
+lui gp 171819
+remu s1 a4 s9
+remu t6 s9 gp
+mulhsu s5 a6 t0
+auipc ra 408276
+xor a3 t6 s1
+rem t6 t6 x0
+mulhu s8 t5 x0
+xori s0 s8 -1596
+ori a2 s10 52
+div s2 a1 a5
+slli s9 s4 10
+rem x0 s5 a2
+sltu a0 gp s9
+slt t6 a7 t0
+srli s3 a6 21
+sltu s11 t3 t2
+srl t2 s11 a1
+slti s6 tp 302
+sltiu tp s11 -58
+sub a4 s3 t1
+mul a6 t5 s6
+add s4 gp s11
+srai t5 ra 11
+srai s3 a2 22
+srli s1 s11 24
+and s1 s1 s8
+srai a0 x0 1
+mulhsu s0 t6 s9
+andi tp s3 -886
+slti s6 t2 -426
+sra ra a3 t5
+divu t1 t5 s1
+mulh t2 a6 x0
+add t3 t2 tp
+sll a6 s9 s11
+sub x0 a5 t1
+mul gp gp a3
+mul s4 s3 t0
+mulh s2 t4 t1
+remu ra s2 s8
+andi s1 a5 -1878
+srli t2 s7 12
+or a5 tp a7
+add s0 x0 ra
+mulhsu a1 gp s11
+add s1 x0 gp
+sll a3 t3 s1
+sltiu t6 a6 -1385
+xor s0 x0 x0
+slt s11 s2 s0
+add t2 s4 s4
+rem t1 a3 s1
+div s6 a3 gp
+xori s10 a7 -253
+srl a1 a0 a1
+andi a4 s6 -1018
+sltiu s1 t3 -714
+div t0 s0 s6
+xori gp s4 -1912
+andi t2 t0 -1367
+xor x0 t5 a6
+lui s5 44079
+add t0 s10 s10
+xori t6 s3 -319
+div s11 gp s11
+rem a5 s8 t4
+ori s5 a7 1975
+div s4 a7 t2
+div a1 a6 a7
+slti t5 ra -1683
+auipc t6 797836
+xor a5 s10 tp
+mulhu x0 t3 s10
+slli s11 ra 14
+mulh ra s9 t0
+addi tp a4 -265
+srli s4 s5 22
+slli t3 a4 26
+srl x0 x0 s10
+lui a7 519979
+auipc a0 219494
+srli s3 s2 6
+sll s3 a4 s5
+mulhsu t0 t4 s6
+mulhu s8 gp a6
+mulh a0 tp s4
+mulhsu tp a0 t1
+sub a1 t6 s2
+srli a7 a1 14
+addi a4 a2 1052
+mulhu a2 ra gp
+mulhu s0 s10 s6
+auipc s8 267547
+slli a0 s8 25
+remu ra x0 s7
+srli s2 a7 19
+xor t6 t4 s10
+srl s5 t6 a5
+sub s7 t2 s6
+slt s6 ra s2
+sra a3 t6 t4
+mulhu t2 a6 a4
+srl a1 a4 t5
+sra gp t3 a7
+xor tp t3 t3
+xor s5 a2 s10
+srai s7 a1 27
+mul gp s10 s8
+sltu tp gp s4
+mulh a3 s2 a0
+sub s1 s2 s8
+andi s0 gp 1367
+remu t3 a3 a6
+ori a1 t3 1719
+add a4 s6 gp
+div s2 tp s7
+ori t1 x0 -565
+andi s2 x0 -1809
+xori a4 s11 690
+andi a2 s4 -1471
+sra s7 tp a6
+xor a4 s5 t3
+mul t1 s11 a2
+and t2 t2 a6
+sra t3 s6 tp
+srl s0 s11 s8
+sll s11 t2 x0
+mulhu s5 a1 tp
+divu a6 a6 s6
+sltu s9 a1 t0
+auipc a6 192681
+remu x0 t6 s0
+slt s0 s10 s5
+sll ra a0 s10
+sll s10 t4 s4
+mulh x0 s5 a5
+andi s11 t1 -1629
+mul s9 a4 s10
+andi a7 a3 -1753
+sltiu a6 s9 -1046
+ori ra t0 -995
+sll tp a7 x0
+and ra t2 t3
+mulh t5 s4 s11
+rem s4 s4 tp
+sra a1 gp t3
+and s4 t1 ra
+ori t4 a2 -1202
+divu s6 t4 s1
+sll a6 a1 s2
+mulhu s0 a0 s2
+sltiu s2 a1 -1564
+mulh s5 a5 s7
+or tp t5 s2
+lui s5 530333
+addi gp a6 -78
+sll gp a1 t5
+srl s11 s8 s10
+slli t4 s10 19
+sltiu s4 t2 -153
+auipc s10 249449
+srli s10 x0 26
+rem t3 x0 x0
+srai a4 t6 31
+andi s0 s2 705
+sltu s0 s11 s6
+or s8 s6 t5
+or s6 tp a7
+sltiu a0 s6 -560
+addi s4 t3 1786
+addi s11 a0 -1344
+auipc s5 359840
+and t6 t3 s10
+slti s11 a6 -731
+div a3 s7 t5
+srl a4 s8 s3
+divu s5 a0 t0
+andi a1 s0 2028
+xor a2 tp t2
+mul t2 s6 t0
+auipc a6 468166
+mulhu s3 s2 s0
+mulhu t4 a7 gp
+xori s9 s10 315
+mulhu s2 t6 s2
+srai s7 a0 28
+andi t3 s3 -544
+add tp a5 s9
+addi s10 s3 -1182
+auipc x0 439278
+mulh gp a7 a3
+slti ra a5 53
+divu gp t4 a3
+slt t5 t6 tp
+xori a2 t5 -170
+xor a4 s2 tp
+mulhu s10 s10 s1
+sltiu t4 tp 1523
+srl a6 a7 s1
+sll t3 s3 s0
+andi s9 s7 1031
+sltu t4 ra s5
+sra s8 a5 a0
+mul t1 s9 s11
+sll s6 a6 t0
+srl t2 s4 ra
+divu t5 t0 x0
+lui tp 484791
+slti t1 s5 -1234
+remu s4 t3 s7
+slli t4 s4 15
+addi x0 t1 777
+ori a4 t2 -992
+remu t0 t6 s4
+srl s8 ra s9
+or gp s5 a0
+andi a3 t0 -1344
+srli s6 s5 12
+divu s8 t4 tp
+sltu a6 s5 t1
+xor a3 a1 t1
+sub s5 a3 x0
+sltiu a6 a3 -1313
+srl a7 s0 t1
+remu x0 t0 s8
+mul a3 s9 s1
+slli t1 a6 22
+remu s7 a4 s11
+ori a5 gp -1482
+srli t5 a6 15
+ori ra t6 511
+rem s8 a6 a3
+xor s9 x0 a3
+div x0 a7 gp
+andi s0 s8 -92
+sub gp x0 t4
+sll s7 a0 a3
+or s8 ra t3
+divu s6 t0 s10
+remu ra a6 s2
+srai a7 a5 20
+andi s9 s8 1438
+divu s10 t3 t1
+add x0 s8 a5
+mulh x0 t6 a4
+sltu s5 a0 a0
+and s5 a7 t1
+mulhsu s3 s4 s11
 divu s7 s2 a0
-auipc x0 760754
-andi s8 t0 1443
-sra a3 t3 s7
-sltiu a3 a7 -1707
-srai s6 t0 7
-auipc gp 611416
-div t1 s6 a1
-or s10 s3 t3
-remu a0 t3 a3
-mulhu t3 t2 s10
-or a5 s5 x0
-sltu t6 t5 s3
-and t1 gp t2
-ori s6 tp -1694
-slti x0 s4 -299
-sub x0 a7 a1
-sub a2 s5 s11
-auipc gp 490845
-addi s0 s0 -643
-sra tp t0 s5
-and s9 x0 s0
-sltu a4 tp t4
-andi a4 a5 -1611
-andi t2 s1 805
-mulhsu x0 x0 x0
-sltu s5 a0 a1
-andi s4 a2 -474
-srai a5 a5 17
-add t6 t1 s3
-auipc x0 51769
-mulhsu t6 a4 s5
-and s3 a3 s1
-and s11 ra s8
-slt a2 s1 a2
-srli t3 tp 7
-remu t1 a5 s4
-addi tp gp -1141
-remu a1 a5 t2
-srai a6 gp 28
-rem s8 a4 t6
-mul s7 s9 t5
-xori s7 a3 -1574
-divu a1 t5 tp
-div a1 a7 t5
-sll s0 a2 s2
-sra s5 t2 a1
-remu t5 s0 a4
-srl a1 ra x0
-mulhsu t0 t4 s4
-slti t1 a0 -767
-and gp s1 t6
-mulh a0 a2 t6
-srli s6 s10 6
-auipc t1 913083
-rem t6 a4 t4
-lui a7 602246
-mulhu s9 s2 t4
-sll a3 s1 a3
-slt s0 tp t5
-xor a6 t0 x0
-remu tp s9 t2
-andi x0 a0 -611
-xori s3 a7 -1459
-divu a3 ra s5
-sub s6 s11 a5
-sll s8 t3 s7
-mulhsu s6 s7 tp
-mulhsu a2 t1 a1
-rem s8 ra s7
-andi s11 t2 668
-sra t0 t6 t5
-andi a0 s0 -931
-sltiu s3 t0 -698
-auipc a5 174585
-slli s7 tp 5
-divu a5 a1 s8
-lui t5 844495
-sub s3 a6 s8
-add t1 x0 t5
-sll a1 gp s9
-srl ra t4 t0
-srli a3 a4 7
-sltiu x0 s5 1637
-sltiu s5 s7 909
-xori a0 s5 487
-xori s6 t5 -571
-sra s3 s0 a1
-slt t0 t1 x0
-xor x0 s0 s2
-slt t2 s5 a1
-remu a1 t5 t3
-sltiu s2 a1 -447
-sltu x0 a1 t0
-srli gp a2 7
-and t1 t6 s5
-add a3 a4 t0
-or s6 s5 s2
-mul t0 ra t2
-sltiu s8 s0 -1029
-srai s3 s6 15
-divu t4 s10 t4
-sltiu ra t4 1661
-sra a5 s8 s9
-srl a6 gp t3
-xor t5 s1 s4
-lui x0 924791
-addi x0 ra -1824
-srl t0 tp s5
-remu t0 s3 s9
-srli s3 x0 24
-divu a7 a3 t3
-sra t6 s4 t1
-rem s3 a6 x0
-srai s5 t5 9
-xor s7 s11 s9
-slli a6 a3 6
-addi t1 a0 -1901
-slli tp a4 9
-srai a2 s4 24
-auipc t0 275415
-sltu t6 s9 t6
-slt a1 s10 x0
-slti t4 s5 -1567
-xori a0 s5 461
-mulh a6 s5 t2
-sll a2 t3 s11
-rem t2 s1 a5
-add a6 t2 s7
-sltiu a6 s5 -1602
-ori s11 t2 -1993
-and s6 s1 s3
-mulh a7 t3 t3
-sltu s0 s0 s9
-ori t6 a1 -1333
-lui t1 515758
-remu s5 t0 t3
-xori x0 s0 -1783
-divu t5 s10 s0
-remu gp s7 a1
-div s9 s7 a6
-rem ra t5 s5
-slt a5 t3 t5
-rem s1 s4 a1
-auipc t2 309911
-xori a3 a5 623
-mulhsu s4 t4 s9
-andi gp a5 -669
-mulhu s5 s1 s0
-rem s4 s8 a4
-add a4 a0 t1
-add s8 ra a3
-remu t4 a1 s11
-xor t1 s5 t1
-ori s4 ra -991
-srai s10 a2 11
-div t3 t1 a2
-slli t0 s3 6
-mulhu s8 a7 s5
-sltu t5 s8 tp
-srl s2 s9 s1
-slli s10 x0 18
-slli t4 a2 7
-xor tp gp a2
-div t0 a3 s2
-xor t3 a3 s2
-andi a1 a5 -359
-lui t6 592841
-slti s11 t4 223
-srai a6 ra 7
-sra s4 a6 gp
-srli t5 s1 12
+mulhsu t6 t3 a4
+lui t4 599772
+sra t1 s11 a7
+remu s6 s7 s9
+mulh a5 s8 a1
+sll t5 t4 a4
+div s5 t0 a5
+sll a6 x0 t1
+auipc s2 51215
+xori t1 t5 -1334
+divu t4 a5 t1
+rem a5 t2 x0
+srai s9 s7 2
+sltiu s3 s11 -126
+slt s3 t2 s3
+mul t5 a3 tp
+mulhu s10 x0 t4
+div a4 s10 s0
+remu t6 s1 x0
+xor ra t2 s1
+remu x0 s3 a7
+lui a4 789219
+srai x0 s1 9
+mulhu a0 tp a2
+mulh a5 s0 a1
+mulhsu s2 a7 t3
+divu a3 s5 s3
+or s8 t2 a1
+sll s1 a3 t2
+mul s10 s11 s8
+mul a3 ra s2
+auipc a7 175770
+or t2 t4 t6
+add t0 s2 a6
+slli s5 t2 0
+ori a7 s5 -901
+ori tp t5 1596
+srli a4 t6 0
+slli t5 s8 7
+ori s9 t0 -578
+srli a1 s3 3
+ori a7 s7 544
+mulhu s11 s0 s6
+lui s3 675316
+slt ra s6 tp
+xor t1 s7 s9
+sub s3 tp s3
+auipc a3 978512
+andi t6 s5 1997
+slt a5 s11 a0
+mulhu x0 gp a1
+mul a5 s7 s11
+srli s5 a3 17
+mul gp a3 s2
+sll a4 s4 t1
+srl a5 a4 s2
+and tp gp s1
+srli t5 s6 15
+div s8 a4 t5
+ori s3 gp 1196
+add x0 s3 t1
+andi t4 a1 217
+or a6 ra s9
+lui t1 568758
+andi s5 t4 -1185
+slt tp s0 ra
+sub s6 ra a0
+slli t2 x0 3
+add t5 s5 a3
+addi t3 s2 1438
+slli a0 a3 25
+rem tp x0 s8
+lui a6 307940
+add a3 t2 s5
+srli x0 s6 18
+slt t6 s4 s7
+slti a0 a0 974
+sltiu t2 s5 -770
+sll t2 s1 t5
+mulh s1 s7 x0
+add a2 t2 a4
+add ra t2 gp
+sltu a2 s7 t3
+sltiu s10 t6 1583
+sll x0 a7 s3
+sub s9 t6 a4
+sub a1 s1 t2
+auipc t1 690542
+slti s1 a6 -2034
+mulhu a4 t3 a0
+divu a5 s1 ra
+sll t0 s6 a5
+addi t3 t3 1755
+mulh ra t2 a3
+srai s11 ra 16
+lui tp 481680
+mulhsu s2 gp t6
+mul tp a3 tp
+addi gp ra -1522
+or a0 tp s8
+ori x0 a5 405
+slli s3 x0 12
+sltiu t1 s6 671
+rem t1 s3 t1
+sll t2 s10 s7
+sub s0 a0 t6
+auipc s11 160320
+xor s1 t6 x0
+divu s10 s11 s5
+addi t1 s0 -1735
+slli t0 a4 16
+sub x0 s8 s2
+mulhu a0 tp a2
+slli a4 t5 31
+lui a5 448283
+div s5 s7 t4
+xor s9 s4 t6
+xor t6 t2 s2
+sltu s11 s6 gp
+andi t4 a6 -1236
+sltu s9 s2 a4
+slt s10 s9 s5
+xor s9 s11 t1
+rem a7 s8 t3
+auipc s11 883757
+slt s5 s3 s10
+or ra tp a3
+addi a1 t4 1074
+add a1 s10 gp
+ori t5 a4 -1307
+mulhu a1 s10 s9
+auipc t6 367404
+rem a4 s6 s1
+sll s4 a7 ra
+divu s4 t1 ra
+lui s1 106829
+srai s7 t6 9
+remu s8 a6 s0
+srl a5 s6 ra
+div s5 t2 s7
+xor s8 t3 s8
+addi s4 s8 938
+andi s11 t6 -237
+auipc a4 492010
+srai t0 a1 26
+xori x0 s4 2023
+mul t0 s10 t2
+andi t3 s4 -1400
+srl a4 s8 x0
+mulhu s6 s7 a3
+divu gp a4 s9
+andi s6 ra -1511
+rem gp s1 t6
+add t5 s11 t5
+lui gp 211633
+or a0 s6 a3
+mulh a7 x0 s6
+mulhsu t5 s3 a3
+slli a7 s0 28
+andi a6 s8 574
+remu s9 s4 gp
+addi s0 x0 -1671
+mulhsu s8 t0 a7
+rem a0 a4 s5
+mulh s5 s11 a1
+andi s0 x0 -79
+auipc a0 171103
+and x0 gp s6
+xor s0 s7 t6
+sltu s2 a5 t2
+slti s2 t6 20
+mulhsu a7 s8 t0
+ori a5 s10 -1475
+mulhu s11 t3 a7
+mul s1 s5 s7
+mul s7 tp a7
+andi t6 a1 -849
+srl a1 t6 s9
+mulhsu gp a6 a2
+srli a4 s7 1
+slt s4 t3 a3
+lui x0 531399
+mul s10 tp s4
+lui s1 539918
+div t5 s9 s8
+remu s11 s2 t6
+mulhu x0 a4 s0
+remu tp a6 t5
+sltiu t5 x0 -1677
+or ra a7 t4
+slli t0 s5 1
+rem a7 t0 ra
+srl a0 a5 s10
+slt a4 t6 x0
+sra t3 s0 a7
+remu s6 s9 a2
+xor t3 a6 a4
+srl s7 a1 a1
+xori s10 s7 482
+mulh s11 t0 s6
+andi a4 x0 -448
+or tp t5 t4
+remu s5 x0 s2
+xor s9 t2 s2
+mulhsu t1 a0 s6
+auipc s11 330879
+lui s7 148292
+mulhsu t6 t0 s9
+andi s0 a7 -1532
+srli a5 gp 31
+add a1 a3 t0
+ori x0 a6 -222
+sub t3 ra a3
+addi s3 t3 1312
+rem t6 t3 t1
+srai s3 t3 28
+and gp t3 s4
+mulh a2 s7 s10
+remu a2 gp s3
+sub x0 s1 gp
+addi s9 s7 -1467
+andi s3 a7 -1596
+lui s4 528328
+addi s7 s6 -1776
+sltu t5 s2 t5
+remu a1 x0 t5
+mul s5 x0 tp
+sra t3 s5 s3
+ori s6 t3 -2018
+srli t4 x0 2
+sltiu s2 a1 -1375
+addi a1 s4 1995
+auipc s4 364321
+srai a4 a6 2
+srl t0 a0 t5
+remu s3 s10 t4
+xori s4 s3 34
+sub t0 s2 s11
+slti s9 a4 -874
+div a4 s7 gp
+xori tp s5 -1168
+slt t5 s3 a3
+xori tp s4 -1652
+and s4 a0 s6
+slti s10 a4 -1334
+srai s9 s7 27
+sra t5 s7 gp
+mulh t3 s3 a6
+srl t3 s3 a6
+or t1 a0 t4
+srl s10 s1 s8
+remu t4 s2 t4
+sltiu a7 a3 -1325
+sltiu s5 gp -1050
+sub t2 t4 s4
+auipc a6 364171
+ori s5 a4 -239
+rem s0 ra a7
+sltiu t1 gp 358
+sra a4 x0 s8
+srli s6 s9 10
+sltiu s8 ra -1466
+sub tp t2 a5
+srli t4 t0 24
+sltu gp s3 a1
+xori a7 s3 1297
+add ra s6 ra
+xori a2 t2 981
+rem s9 s11 a2
+sltu tp a2 s9
+mulh t0 s5 t0
+or ra a7 ra
+xor s7 a5 s11
+mulh a2 x0 s1
+add s10 t2 s11
+remu a6 s10 t3
+xor a7 a2 t6
+add a4 s3 ra
+mulhsu s9 gp s3
+slli t2 a1 16
+slli x0 t1 20
+mulhsu t1 a1 s0
+mul s0 a5 a1
+auipc s9 855528
+divu s4 tp s5
+xori s2 s0 -43
+srl s5 a5 s1
+addi a6 t3 -583
+srl t1 s0 a3
+sub t1 a5 t5
+lui t4 742294
+auipc t6 711864
+add t0 s6 a3
+add x0 s10 t1
+mulhu s6 a5 s4
+sub x0 x0 a5
+lui s4 651931
+auipc s3 776012
+sra s11 s2 a6
+or s2 t1 a1
+xori t0 a2 -197
+xori t3 t2 -1812
+slli s4 tp 2
+sll s4 t6 ra
+slti a3 a5 -921
+divu x0 s10 s9
+auipc s1 253726
+div t6 ra a7
+slt t2 s5 s5
+xor t3 s6 t4
+slti a2 t6 -1694
+slti x0 a3 704
+srl s0 t2 a3
+sltiu a6 s0 -954
+srai t1 a2 11
+and a2 a4 t0
+srli a1 s8 9
+srli s9 s2 24
+slli a7 a3 26
+slti s2 a5 -936
+slt s1 s8 s8
+mulh s8 gp a7
+slli t5 t0 20
+mulhsu t5 t2 a4
+sll s4 s0 tp
+mul tp s6 a7
+mul s4 s0 t1
+or a1 a7 a3
+srai t4 a2 30
+mulh a2 ra s7
+slt a0 t1 s4
+sub t1 s8 s9
+mul a4 a7 a2
+slli s11 t1 31
+srli t1 s0 31
+addi x0 t6 -360
+rem s1 s4 s3
+divu a6 tp s4
+srli a1 tp 27
+or t6 a3 t1
+rem x0 a4 ra
+remu t5 a4 s4
+sub s2 s1 s3
+srl x0 s11 t5
+remu t6 a5 s4
+sub t5 a7 t6
+srai a1 s8 11
+sub x0 t3 t3
+lui a6 290696
+srl s5 a1 a0
+add t0 a5 a1
+slli t5 a2 1
+xor s7 a1 t3
+mul t2 tp t0
+div s0 tp s9
+andi gp a3 -1319
+sra x0 x0 a1
+srai s10 t5 0
+or s9 a1 t2
+sra a1 s2 a7
+mulh a4 a3 t0
+sub t2 s6 s11
+remu a1 t4 s1
+andi s5 a6 394
+mulhsu gp t5 t4
+slli x0 t0 11
+sub x0 t5 s5
+andi t5 x0 1174
+srai t5 t2 20
+remu x0 s5 s10
+mulhsu a0 s0 a6
+andi s6 gp -1116
+addi s11 t3 1158
+add t6 s1 s5
+divu s7 a3 s6
+auipc t2 626362
+sll t6 a6 s5
+andi s1 t4 -241
+srai a7 tp 18
+add a4 s1 a1
+rem s11 s10 a6
+sra t5 s9 t4
+srli s2 tp 18
+and t3 a4 s9
+and a0 s1 s2
+srai t5 a2 17
+ori t2 a4 -799
+slt a2 a7 a4
+div a2 a5 a6
+slt gp s2 a7
+div a7 x0 x0
+lui gp 425653
+add a2 a1 a0
+srai s7 a0 21
+remu tp t6 s11
+lui s6 308779
+sub a3 a2 s6
+ori s3 a7 138
+srli a6 a7 18
+sra a2 a4 s9
+lui t2 313856
+mulh x0 t2 gp
+mulhu a7 s3 t5
+slt s6 s7 s5
+auipc t4 901661
+srl a6 s7 gp
+or s2 x0 a3
+ori t3 s5 -866
+mulhsu t4 s10 a4
+and a5 a0 gp
+addi t3 s4 -756
+divu a1 t4 s0
+slli s8 a6 13
+sub a2 s1 s4
+sub t4 ra s9
+auipc t1 193672
+sub s0 s5 s5
+div t1 s1 s9
+add s4 s5 t1
+sra x0 a3 a3
+slt s10 s11 x0
+xori s2 s4 -1896
+slt a5 a6 x0
+divu a7 a6 a5
+sltiu tp a0 1875
+sub s5 s10 a2
+mulhu t5 s11 s0
+xori s1 t0 -340
+slli s11 a3 14
+xori s10 s11 767
+sltu a5 s5 s6
+sltu x0 s7 t1
+mulhu a1 t3 x0
+mulhu t2 gp x0
+auipc s3 705219
+addi s9 t3 -66
+slli s8 a0 12
+sltiu s0 s0 1234
+xori t4 s9 -1038
+sltu a4 x0 t0
+sltiu t3 s9 -1720
+remu t3 s3 gp
+xori s9 s3 -963
+addi a7 a4 450
+rem t1 t6 a0
+div a7 s7 x0
+slt a6 x0 t4
+sll s3 s0 a6
+mul t4 s6 t3
+add s1 t0 t4
+mulhu s7 a1 s1
+div s0 s2 s5
+add s2 a1 a3
+sltu ra s9 a7
+rem a3 t1 t0
+mulh a7 a1 x0
+srli t0 a7 18
+mulhu t6 t0 t1
+srli s9 s8 25
+remu s3 a6 s6
+sra t5 s6 tp
+or s10 a3 a3
+sra x0 s4 s4
+slt t5 a0 t3
+xor t0 a4 t0
+mulh a3 gp tp
+and a6 s1 t2
+srai a3 a6 0
+sub s3 s0 s11
+srai s2 s4 0
+div t3 s3 s8
+add t5 t1 t6
+sra s6 a1 s4
+divu a6 t6 t4
+rem s3 a3 a2
+div s6 t3 t3
+remu s0 s6 s1
+ori s0 s6 -1316
+srl s3 s9 tp
+sub a6 a7 a6
+xori s9 t2 -473
+andi s1 t6 787
+addi t5 ra -1601
+mulh a0 tp a3
+slli s10 s0 24
+auipc t3 920393
+slti a6 s11 -1912
+div t4 s6 a7
+sra t6 s6 a1
+sub a6 s9 s9
+sub s2 s10 t3
+mulhu s4 s0 a7
+mul s1 t2 s2
+add x0 a2 a7
+sltiu x0 s0 -119
+sub s3 s8 s2
+divu s1 s8 x0
+slti t2 t1 -1575
+xor t5 s0 gp
+ori t2 a4 -87
+sll x0 a1 s2
+and s9 s6 x0
+sltu x0 s0 s11
+mul s4 t4 s6
+slli s10 t5 0
+sltiu s4 s6 718
+andi a3 s5 -636
+rem x0 x0 t4
+sll s1 gp a3
+xor t3 gp t2
+sltiu s6 s8 1119
+mulh s0 s6 s7
+andi a5 s0 -1998
+mul s9 s0 s1
+lui s5 933328
+or ra ra t3
+andi s10 t4 -1294
+mulh t2 a3 s6
+mul a2 t1 s11
+lui s8 302098
+auipc a7 99850
+xori t2 a1 790
+or gp t3 s6
+xor t5 t4 t2
+slti a7 s3 -1484
+mulhu t4 t5 s8
+sltiu a2 s5 1617
+sll s6 s8 s5
+xori a4 s2 -1693
+xori s2 a7 -1152
+mul s9 t2 x0
+andi ra gp 288
+remu t5 s4 t2
+sltiu s8 x0 -1298
+and s0 tp t1
+andi a0 t4 590
+remu t5 a3 s0
+remu a7 t1 x0
+srli ra a0 8
+mul s0 t6 ra
+addi t2 ra -644
+add a6 s6 tp
+srai s11 t0 5
+andi s4 s5 -2
+slli s1 s3 11
+mulh t5 a7 t2
+sub t0 t6 s3
+sltu a3 s7 t6
+add s0 gp t1
+lui a7 74407
+ori s7 ra -1727
+and s9 t3 s4
+and x0 s2 s5
+auipc s1 57079
+lui s3 884500
+srli x0 s10 28
+ori t4 tp 1169
+add ra a1 t0
+rem a2 a5 s1
+sll a6 s4 s0
+mulhu t0 s8 a7
+slti x0 s5 -1817
+xor a1 s6 t2
+ori t6 x0 -1263
+auipc t3 357292
+slti t6 t5 -1841
+srl s1 x0 t5
+rem t6 s1 a6
+slli s11 t2 26
+add t1 ra ra
+xori t6 t3 -983
+srl s2 s5 ra
+sub s2 s7 t2
+ori s7 x0 1638
+add s9 gp s6
+rem s6 a1 s3
+lui s6 615376
+slt t3 t0 x0
+xor t0 s9 t2
+remu s1 s6 s3
+auipc gp 971107
+auipc s3 42069
+slti tp a4 -913
+sll s11 s5 t1
+auipc a1 869773
+addi x0 a2 227
+xori s11 t4 -813
+sub a0 t1 x0
+slt t2 a3 a2
+lui t6 380638
+mulhu gp a1 a1
+sra s1 a0 t3
+and a6 a6 s2
+srli s2 s6 27
+ori a6 t3 -2034
+divu a5 s9 s2
+sra s2 s8 t1
+mulhu t4 ra t2
+ori s6 t6 -689
+slti a7 t0 -329
+sll t5 s9 s7
+xor s8 a5 a4
+or tp s4 t6
+sub x0 t3 x0
+divu a4 s11 a6
+srai s0 a2 5
+and x0 ra s3
+mul s2 t3 t5
+ori gp x0 -993
+auipc s2 345635
+xor a2 t0 a2
+div a1 s1 s8
+and s3 s10 tp
+sltu x0 s7 s3
+mulh s9 s6 s4
+addi gp a3 1112
+xori s2 ra -272
+srl a0 s6 s3
+mulh s7 a6 x0
+or ra a3 x0
+divu t1 t1 t3
+remu a6 a5 s6
+mulh a7 a2 t5
+slli s8 s9 7
+div s0 s4 a0
+div s8 a1 a7
+rem s3 gp t1
+mulh s2 a3 a2
+slt a3 ra a3
+srl t5 a6 x0
+slli t2 s1 21
+slti s6 t3 -552
+xori t4 a2 -44
+mulhu t2 s4 t0
+sltiu t3 ra -1606
+slti s1 s0 -1930
+mulh a5 a7 a0
+mulh s1 a0 s8
+remu s3 a4 tp
+remu s1 ra s10
+xori x0 s0 -639
+addi t3 a2 -493
+mulhsu s4 a5 s10
+slt t5 s1 a1
+mul ra s8 s3
+slli a3 t6 28
+xor t5 s5 ra
+mulh s6 s3 ra
+and t6 t5 s7
+lui ra 284347
+sltiu s2 t2 733
+sltiu t2 a7 -1740
+mul s8 t2 s4
+addi s2 s5 550
+xori s0 s8 -373
+ori s11 a6 -350
+mul a5 t4 a4
+divu s2 s7 s10
+slti s8 t5 -1420
+sltu a7 s5 a2
+remu s0 a3 tp
+slt s9 s6 a5
+srli s8 t3 7
+addi a6 t1 -372
+remu s8 s6 s6
+mulhsu s2 s6 s0
+mulhsu tp s10 x0
+auipc a6 374028
+mulhu s11 s0 ra
+slli a4 tp 21
+srai a7 t0 11
+add s0 t5 a1
+div s3 s3 s1
+divu a2 x0 s8
+sltu gp t5 t5
+sltu s8 s9 a7
+sll s10 s1 a5
+or a7 t0 a2
+srli t5 s9 15
+addi s1 a4 179
+sra t3 s8 s7
+slli a1 s11 19
+srli ra s1 13
+sltu s1 t3 s9
+rem s1 s8 x0
+or s10 t3 s9
+divu s0 a2 ra
+srli t4 a2 22
+srai s10 gp 28
+or s4 a0 s8
+div s0 ra a7
+mulhsu s11 s1 a5
+sltu s11 s2 s0
+mulh tp tp t4
+xor a6 tp s10
+mulhsu t5 t2 ra
+addi x0 s4 -244
+srl x0 s7 s9
+sltiu s7 a2 -1389
+mul a4 s4 s6
+mulhsu s11 s7 a0
+auipc s2 287312
+addi s7 t1 -636
+sub tp a4 t3
+mulhu t0 s8 a0
+slt s7 ra t2
+slti a2 s4 -1271
+sra s0 a0 gp
+xor t4 s10 a7
+divu gp a2 a0
+sra a5 x0 s0
+addi ra t1 -739
+remu a7 s8 s2
+slli s3 gp 25
+mulhsu a5 a0 tp
+slli s10 s2 0
+srl s5 a0 a6
+or a7 s9 s0
+mulhsu t0 s10 s6
+lui s1 632273
+ori s11 s6 -361
+slt a5 tp gp
+mulhu t0 s1 ra
+srl a2 x0 s5
+xori a5 a0 -152
+mul s10 a0 a4
+slt a0 t0 s2
+auipc s10 75097
+mulhu s7 t6 s0
+or a2 x0 t6
+srl t5 s10 s10
+divu s4 t3 t1
+slt ra s0 a3
+or x0 a6 t3
+srai s10 a1 31
+xori s10 s8 -582
+sub ra gp a6
+srli x0 s8 29
+xori s5 a2 667
+xori a2 s2 -763
+slt gp s7 a5
+andi a0 a4 -128
+xori x0 t1 -291
+andi a4 gp 391
+mulhsu x0 t3 s6
+xor t1 s2 a3
+mul s2 s11 s1
+sra ra s9 x0
+xori t1 ra -1542
+rem t3 t6 s7
+lui s10 1032344
+lui s8 699276
+srai x0 gp 14
+mulh t2 a0 a0
+srli a0 a2 21
+sra s4 s8 t4
+lui s10 576211
+mul s3 s0 s3
+sll a2 s0 a7
+remu a0 a7 ra
+srai s6 a7 23
+andi t4 x0 -660
+or x0 t5 s6
+sltiu a4 x0 -361
+sll s8 t3 s9
+srl t2 s1 s5
+mul s7 a7 t5
+div s5 x0 s11
+srai a4 a3 27
+div s6 a5 gp
+lui x0 163960
+div t6 s10 gp
+div x0 s5 t5
+sra a6 x0 s10
+or t6 t5 t2
+mulhsu ra s10 t3
+andi s10 t6 -511
+slti a5 a6 738
+mulhu a4 tp s3
+rem a5 s6 s3
+mulhu t0 s10 a5
+remu gp x0 t5
+addi t4 t3 1281
+divu s9 s5 x0
+auipc s11 835046
+remu a1 ra t5
+divu a4 s5 a3
+xor a6 gp x0
+srai t3 t5 5
+sub s11 x0 s10
+sltiu a3 s1 -212
+remu a7 t3 a6
+slli a4 s4 21
+srli s9 s0 9
+slli a5 x0 18
+xor s0 a1 a7
+lui a2 245862
+lui a0 339019
+slt a6 x0 x0
+mulh s10 a5 t5
+sll s11 s9 t6
+mulhu t6 a6 a6
+or s5 s7 a7
+sltu gp t5 s8
+ori s9 x0 -197
+sltiu a1 t2 -1943
+auipc t6 519850
+remu x0 a5 gp
+srai s2 s6 15
+slli s4 a2 6
+srai t5 t4 27
+srl a1 s2 t3
+sra a2 ra s7
+sll x0 t5 a3
+xor t1 t3 gp
+slli a0 s11 8
+auipc t5 306985
+or s6 a0 s6
+srai s8 t1 22
+xori x0 a3 -27
+srl a5 s8 s11
+mulhu t2 s7 s4
+slti t6 a0 -560
+mulh s2 s10 ra
+or s1 x0 x0
+lui x0 37888
+slt tp s9 s9
+sltu s6 s7 x0
+sltiu gp a5 -1111
+mulhu s8 a3 a6
+lui s5 39515
+mulh a1 ra s8
+remu s0 a6 t1
+and t3 x0 gp
+rem t3 s8 s9
+slt x0 s4 x0
+mul t0 a3 s9
+slti a0 a5 448
+sltiu s3 s7 -1846
+srli a5 a2 22
+andi s0 s8 -1756
+remu s8 a6 s3
+sltu s4 gp t1
+xor s0 a3 x0
+lui s5 261911
+div a1 s9 a5
+sub t6 s2 t5
+mulh s1 a4 a6
+div x0 s9 a1
+srl t0 s10 s6
+sltu s7 t5 t6
+slt tp t6 a3
+srl t4 s11 tp
+slti t4 a4 -1875
+sra a6 s11 s3
+xori s10 s5 -1592
+srl a1 a6 t4
+div t3 s9 s2
+and t6 s1 t2
+or a0 a3 x0
+or x0 gp t1
+srai a0 s9 20
+xori x0 s3 301
+divu s8 s8 s2
+lui gp 768862
+sll ra a1 a1
+sll a3 t3 t5
+slti s3 t1 -1712
+mulhu s6 x0 a7
+remu a5 s11 a5
+andi ra s1 1210
+and tp s3 a0
+xor a2 s3 s1
+xori s5 a3 -1981
+slt t4 t4 tp
+xori s8 ra -97
+mulhsu x0 t3 ra
+rem s1 tp tp
+xori s6 s5 -1889
+and t1 a0 a3
+slti a7 s0 -134
+sra t1 t5 a5
+div a4 s6 gp
+mulhu s2 a7 a0
+remu s7 s10 x0
+ori s1 x0 -801
+and t1 t0 a5
+ori t5 t5 701
+srli s8 x0 24
+remu gp t3 a6
+sltiu s10 s10 -313
+slti s7 a0 785
+auipc s10 569001
+slli s4 tp 23
+slti s8 a6 -439
+srli a5 a2 25
+ori a2 s6 -1889
+xor tp s10 tp
+srl a5 a4 x0
+divu ra s8 s4
+sltiu a4 s8 1481
+sll s10 a5 x0
+addi s9 s9 678
+or a6 a7 t5
+srai t2 s11 29
+remu s1 t5 t4
+ori s1 ra -1046
+mulhsu s11 s2 a6
+sltu a6 s9 t5
+and t6 s3 tp
+divu s4 s7 t2
+mulh s9 a3 s7
+srl s3 s4 x0
+slti s11 ra -1929
+auipc s9 990383
+lui s7 723090
+mulhsu gp s10 ra
+xor t6 s4 s9
+divu t3 a6 s1
+sub s4 ra t4
+andi s0 a0 1634
+xor t4 s5 s11
+addi a3 gp -2011
+ori s4 s2 -122
+rem a3 s0 t2
+srl a5 t3 t4
+srl x0 x0 s0
+divu t4 a7 s6
+or a5 x0 a5
+sra a0 x0 a5
+andi a6 s2 -642
+lui s6 692582
+mulhsu a5 a3 tp
+add s8 x0 a2
+divu t3 gp t0
+srli s0 t3 17
+sltu s8 s1 t6
+remu s8 s7 s0
+sll tp tp a2
+xori s11 a6 194
+ori s1 s9 193
+auipc s9 597969
+sltu t6 s3 tp
+mul a6 t2 t6
+andi s2 a6 -313
+add t1 gp t1
+or s8 t4 a7
+sub a6 gp tp
+mul a3 a4 a4
+divu tp a0 a2
+sra s6 a6 a6
+srl s6 a5 t1
+sltu s0 t0 a0
+srl t2 a1 a2
+slli s11 s2 17
+srai a0 a6 22
+xor s2 a4 t3
+srl t4 a7 s0
+or t5 a5 a6
+mulhsu s1 s10 a6
+ori a6 t2 -420
+sll t4 a6 a6
+xori s8 a2 164
+rem a6 s4 ra
+slt ra s11 a2
+sltu s11 a6 a6
+divu a4 s5 s0
+divu s9 t1 a2
+mulh t0 gp s9
+xori t4 s1 -3
+mul s10 s3 s7
+srai s4 t4 9
+sltu s1 t0 a1
+sra s1 t0 t3
+remu s4 s6 s0
+andi x0 s5 -971
+div s11 t6 s10
+slli x0 s6 9
+div ra a7 s6
+xori t6 s3 -1017
+mul t4 x0 x0
+andi a1 a7 -111
+or s1 t6 s10
+and t0 t6 s3
+mulhsu x0 s0 t4
+xor a0 s2 s6
+addi a2 ra -497
+srai a7 s5 14
+slli s1 s11 31
+mul s11 s5 s1
+rem s10 a0 s9
+sltiu t4 s5 -1641
+slt t3 s5 a4
+addi s0 s7 713
+sub a7 a3 s7
+add s4 s4 s11
+sltiu s9 tp 1293
+mul s5 t6 tp
+srl t2 s4 a4
+or s6 t3 s5
+slt t4 a4 t3
+mulh x0 tp s3
+mulh s6 s1 ra
+srl x0 a2 s11
+or s2 gp s11
+xor s10 s11 t4
+sltu a0 t2 s4
+ori a6 s11 677
+remu t2 s3 ra
+mulh t0 t5 gp
+divu t5 s10 s5
+and t6 x0 a0
+slti s9 a0 -607
+srli s5 t3 10
+srli x0 a3 20
+sub s8 gp s5
+slti t4 s8 1735
+sltu t6 s2 s2
+add a5 s11 a5
+or s3 t3 t2
+and x0 a0 ra
+div s7 t1 s6
+mulhsu ra t6 t6
+xori tp s0 -1811
+xor ra s3 a4
+srli ra s1 30
+slli t0 s10 0
+add s5 a2 s8
+slt s9 t5 s9
+and s4 tp ra
+mul s5 t6 s11
+mul t0 s0 a0
+ori a5 s3 723
+sra tp a4 ra
+slt a6 a6 s11
+slti a7 a0 1164
+srl a5 s2 s11
+divu t5 s6 gp
+divu s6 x0 tp
+ori s4 x0 1951
+mulh a6 a4 gp
+srai t6 s11 15
+add t0 s3 s5
+sub gp s1 s9
+srai s9 a7 26
+sll x0 t6 a0
+mulhu s4 a7 s1
+srai x0 a6 18
+xori s10 a2 -1523
+mul a6 s11 s9
+mulhsu a6 x0 s1
+add a7 s5 a5
+div s5 t1 ra
+sltiu a0 s4 -1169
+rem s10 a6 a5
+mul a2 t2 a2
+mulhu gp t5 a1
+add t6 t3 s10
+xor s0 t0 t5
+rem s11 a2 a0
+div s0 t2 tp
+mul t2 x0 t2
+ori s11 t1 -1119
+addi s7 s6 -637
+xor s7 a6 s3
+sltu a0 a3 a4
+slt s2 a1 t6
+sltiu s7 s5 -910
+sra a1 s11 t1
+srl gp ra x0
+mul gp a5 x0
+sub a4 t3 a2
+and t6 s3 s0
+mul tp a2 t5
+or s10 ra gp
 div t0 s10 x0
-add t1 t1 a1
-addi t1 a7 -230
-ori gp t5 1191
-remu a3 s9 s5
-mulhu s3 s8 s7
-xor a0 s5 t1
-slli t0 a7 22
-and s9 t3 a2
-xor t6 a4 s0
-add gp s5 a3
-xori t1 s6 -1599
-or s1 a2 t2
-sra s6 t4 s11
-mulhsu x0 a5 s9
-mulh s3 gp ra
-xor a5 a3 a0
-srai a7 a5 8
-xori a4 a7 -1701
-srl x0 a2 t0
-div s5 gp t2
-srai s9 a5 17
-and a6 s4 t4
-div s4 t2 s0
-sltiu tp s2 28
-srli a0 gp 9
-rem a1 t2 a2
-sra a4 s1 t2
-srl t0 x0 t0
-xori s11 t0 -1815
-sub ra t4 a1
-sra a2 x0 s1
-auipc s5 353880
-mulhu a0 a1 s8
-xor ra a3 t1
-remu a5 ra s9
-slti s2 s1 -407
-slti s7 s6 -559
-remu a3 ra s10
-ori s6 t5 -633
-andi t4 t1 1354
-or x0 a6 a4
-xor s3 s9 s10
-addi a5 s6 323
-sll s1 t4 s6
-remu a2 s9 s3
-auipc t2 479839
-srli a6 x0 11
-srai a7 t4 28
-sll a0 s7 a5
-xori a7 t4 -967
-lui t4 986817
-slli s4 a7 12
-mulh a3 a3 x0
-mulhsu a4 s6 a5
-mulhsu a3 s3 a1
-or x0 ra s11
-divu a2 s11 x0
-andi a7 x0 1214
-xori s4 a0 -211
-sltu a1 a1 s6
-or t3 t1 s3
-xor t5 s1 a1
-ori t2 s7 449
-mul s3 a0 tp
-srli s8 a3 0
-addi s4 s2 1439
-mulh s11 a5 tp
-sltu x0 t1 a4
-sra a4 a3 s4
-or a0 s6 s8
-mulhu a4 t3 a1
-addi s10 gp -1765
-remu t4 t4 a7
-mulhsu s0 gp a4
-sltu a1 a7 t2
-remu s5 a5 x0
-sra s8 s8 tp
-and t2 s0 s4
-div s1 a1 s9
-srai t1 t5 8
-sra t2 a0 t5
-srl s8 a1 s3
-add gp tp ra
-sub ra t2 t2
-add ra t5 t0
-mulhu t3 a7 t5
-addi s2 t1 1461
-rem a6 s4 s5
-andi ra gp -1563
-srl s10 x0 x0
-mul a3 s0 t2
-mulh t5 ra t4
-andi a6 t4 -1939
-div a2 s3 s3
-sll a1 a3 t5
-xor gp s11 gp
-mulhsu s11 a0 s11
-xori a2 s4 -1675
-auipc t0 101297
-srli s3 s3 18
-auipc a2 883478
-andi s1 s9 441
-rem t1 s3 s7
-slli t5 a0 26
-xori s11 t1 -1348
-xori gp a6 1737
-or gp t3 ra
-sltu s1 a1 s9
-mulhsu s2 a6 a3
-mulh tp a0 t5
-srli s11 t4 16
-andi s5 a4 -1388
-rem s11 a5 a2
-srli x0 a4 9
-addi a1 a7 -579
-lui t3 708990
-srai gp t0 6
-slli t4 s1 16
-mulh s6 x0 s2
-mulhu s7 t1 x0
-sltu t2 s0 s8
-lui s0 715032
-mulhu s3 a2 s4
-sub s1 s1 s6
-addi s9 x0 -1591
-mulhsu s7 a2 t6
-divu s9 s5 s5
-slt s0 s4 t6
-div s5 a2 a1
-add s10 x0 tp
-srl s8 a5 a7
-xor t0 a3 a7
-auipc s0 319007
-div t0 s9 s2
-mulhsu s10 t3 a6
-divu s4 x0 s0
-divu s5 a3 a3
-srai x0 gp 23
-sra a4 s3 s1
-auipc x0 601068
-and ra s0 a4
-remu s9 tp s5
-mulhu s0 x0 s5
-sra a1 t0 t2
-addi t5 s4 1934
-xor s2 a0 t4
-mulhsu a1 x0 s4
-divu a3 s9 s1
-sltu t2 t4 s10
-sra s5 s4 s9
-mul ra ra t5
-srli t1 a6 28
-lui ra 857679
-lui a4 153195
-sltu s6 x0 s4
-sll a5 s7 a0
-mulhu t2 s5 s4
-srai t0 a7 3
-slti t0 t6 -817
-xor tp ra s6
-sll t3 t2 x0
-and a3 s9 s10
-andi t6 s5 -114
-xori s5 s0 -211
-or s0 a6 a7
-slt a0 t2 a6
-sll t5 t3 a1
-rem a6 t5 a4
-sub a5 s2 s2
-mul t1 x0 a7
-slt a6 tp s7
-sll t0 t5 x0
-xor ra t1 s9
-mulhu t5 s10 t5
-slli a5 a0 0
-slli s10 a0 23
-srl a7 t1 s10
-slt t1 a6 s7
-auipc t2 208115
-ori ra t2 -1640
-mulhsu t3 gp s9
-slli t5 a5 31
-xor s1 s0 s9
-mulh s10 s9 t1
-xor s8 a4 t1
-divu a4 a6 t4
-slli gp gp 15
-slt gp t0 a4
-slt gp a2 t4
-add a7 s8 a4
-mul a1 t2 a6
-divu t3 a3 tp
-srai s2 s11 11
-xor t5 s1 a0
-divu t0 t4 a4
-divu a2 s1 s11
-add s5 a3 s1
-ori x0 s5 -1346
-addi t0 t2 1594
-xor x0 a7 gp
-andi t0 a1 -287
-sltiu t6 a4 1433
-slt s8 a0 s5
-sub t2 s1 s1
-lui s7 552198
-or t4 a2 s8
-sub gp s7 x0
-rem t6 s3 t1
-rem s1 a6 s5
-mulh t6 t2 s11
-sltu gp x0 s4
-ori a1 s7 -378
-mulhu a6 a6 x0
-rem s1 s7 gp
-mul s5 a4 a1
-lui s4 338870
-mulh s9 s0 tp
-mulhu s7 a0 t2
-mulh s0 a3 t1
-ori t2 s0 104
-sub s2 t6 a0
-srli x0 s7 8
-and t2 s4 a7
-slli t1 t6 11
-mulhu t3 s9 s7
-slt a2 s6 s11
-rem s4 s9 s1
-srl a6 s2 tp
-or a5 t0 s2
-mulhu gp s5 s7
-srl t0 ra a1
-and s0 t2 a1
-xori t3 s0 -1082
-slli t4 a7 29
-div s4 s3 s4
-srl gp a0 a5
-mul a1 s4 s9
-addi x0 t2 1682
-addi x0 s0 1678
-slt a0 s9 a3
-auipc t1 738628
-slt a4 a0 a2
-rem a4 s4 gp
-andi t0 s8 -247
-ori a3 a2 1092
-add s3 t1 s9
-or t5 x0 a2
-slt s3 s1 s3
-add t3 a4 ra
-srai a4 s11 27
-add s8 s2 s3
-divu t2 t6 x0
-sra s0 t1 s3
-rem a7 s3 s8
-sub s9 a0 ra
-mulh a5 a5 a4
-slli s5 s2 8
-sub s6 t1 s8
-mul a4 s3 s8
-addi a4 a4 997
-sll a2 a4 a0
-srai ra x0 3
-slli a3 a2 0
-sltu t4 t3 a7
-sra t6 t6 x0
-ori s2 a5 -2039
-slli a5 t2 25
-slti s5 s4 53
-sltu s1 t2 a3
-or s7 a1 s3
-slli t4 s7 13
-mulh s3 t0 a5
-sll a7 t3 gp
-remu gp t6 s7
-auipc t3 1026586
-mul s9 s2 tp
-addi a2 s3 -1316
-div t4 a4 s3
-slli s3 s3 7
-sll ra ra t2
-sub x0 t1 t2
-srai t2 x0 4
-or t4 t3 s3
-xori s8 s2 -547
-slti s4 s7 -894
-addi s9 ra -467
-ori s0 a6 -1049
-srl s1 s2 s11
-srli s11 tp 14
-and t0 x0 t5
-auipc t2 527648
-mulhsu t6 x0 s7
-lui s4 995483
-srli s5 s5 3
-rem a5 t4 tp
-rem a6 a5 s3
-mulhsu s7 t6 t5
-xor s7 s1 a3
-divu t5 s6 s9
-div t5 s7 s6
-slt s1 a4 s5
-ori x0 t4 -254
-srli t3 t1 9
-sub tp a3 s1
-sra t2 t2 a7
-xor a3 s9 s10
-sltiu a7 s1 -1232
-xori a0 a0 -728
-sltiu s1 t5 -1002
-lui t1 492374
-rem a1 t5 s5
-slli s9 tp 14
-srl t4 gp s4
-divu a7 s11 a0
-add a2 s3 ra
-sll a1 s4 a4
-ori s6 t2 -1224
-slt s5 ra t2
-slt s4 t1 t6
-lui ra 754664
-srl t5 s7 a1
-and t5 s10 a3
-srai a6 t1 9
-sra a6 a7 a6
-slli t3 x0 0
-srli tp t5 6
-sub t4 t4 gp
-rem s7 s5 s0
-sltu a1 a1 a4
-or a1 a1 s9
-xori s3 gp -700
-sltiu a6 a5 -165
-add s1 a0 ra
-mulh s6 s2 t3
-ori t1 s3 -1484
-and ra s4 s9
-sub t5 a0 t5
-sltu a1 s0 s4
-mulhu gp t4 a3
-ori a0 t3 -1877
-ori s11 s6 1204
-div a3 a0 s8
-and s1 gp t5
-andi a7 a5 -339
-ori a5 t6 -1703
-mul t6 s8 t2
-addi ra s1 776
-auipc t3 815345
-sltu t5 s11 a2
-slti t2 tp 599
-divu t3 a4 a1
-mul gp t4 a7
-auipc s11 994356
-srli t2 s6 20
-divu tp a2 s3
-auipc s9 909269
-addi s9 s7 -545
-rem s7 tp s7
-sra a5 s2 t0
-lui s8 6677
-div t0 t5 tp
-mulh t0 t3 s1
-srai s3 s9 25
-sll s0 a4 s1
-slt gp s11 tp
-sra s4 s6 tp
-mulhu s11 a4 s11
-xori tp t6 -591
-andi t5 s9 -727
-auipc t5 661750
-auipc t4 483128
-sltiu t1 t3 1495
-sll s11 a3 s6
-div a0 s2 a7
-srli s11 s6 25
-slti s6 s4 -1656
-rem s3 x0 a4
-sltiu a7 s4 1369
-add t6 t6 x0
-slli s2 a1 30
-sll t5 s6 a4
-or s7 a5 a2
-auipc s0 695442
-slt s3 s2 s2
-mulh gp s9 s3
-lui tp 175561
-ori gp s6 -1944
-sra x0 a4 s8
-and s11 a5 t6
-srl s4 s0 t1
-sub a4 s8 s0
-slt t5 x0 s1
-slti a5 t0 178
-slt s0 s4 a5
-remu tp a7 a7
-srli s7 a0 16
-ori s11 t3 -148
-xori t6 a7 -52
-andi s0 x0 2039
-slti t6 s8 -219
-add s6 s5 ra
-xori t1 a3 -502
-sra s10 s4 s7
-lui a1 870446
-and s8 t4 s5
-addi tp a3 99
-xor t2 tp s9
-auipc s8 865776
-mulhsu s4 s6 s1
-sltiu t1 a6 646
-rem s3 t6 s10
-mulhsu a7 a2 t5
-auipc t5 351099
-andi tp s8 391
-rem x0 a0 tp
-slt s8 s4 a1
-ori a6 s5 -1153
-xor s0 s0 t4
-sll ra t5 x0
-sltiu ra t1 -1982
-rem t1 a0 a6
-div s9 s9 a0
-srl t1 a5 t5
-lui t0 989465
-srli a7 s3 11
-slti s10 a6 82
-slti s4 gp -632
-slti t3 s11 -1826
-mulhsu s8 t3 tp
-sltu a7 t1 s11
-divu s4 a4 t6
-auipc s8 520242
-add s5 a1 t0
-divu a4 t3 s8
-mul a2 s7 x0
-sll s3 s8 s7
-slt t1 a1 s11
-div s2 s6 a0
-remu a4 a7 t1
-srli x0 s2 20
-srli s6 s1 13
-mulhsu x0 s9 a0
-andi s11 s5 -80
-sltu s6 s2 t1
-auipc t2 490973
-addi s10 s2 -283
-add a4 s10 t2
-xori t2 s11 -1532
-srai a4 s0 1
-xori t1 s1 824
-auipc a0 603150
-mulh ra s4 gp
-sll a3 ra s4
-mulh t4 s1 s8
-auipc s9 67964
-sra a6 a5 a4
-divu s1 t2 s4
-sltu a1 a2 t5
-add s10 a3 a3
-mulhu a2 a7 ra
-and t5 s5 a7
-or a4 s0 a0
-remu t5 a0 s11
-xor a2 a1 s10
-slt a2 a2 t2
-auipc t0 102879
-mulh t4 s7 a3
-sra t5 s3 a3
-srai a2 s0 21
-divu s7 t4 s6
-add s5 s4 s4
-andi t1 s2 -1314
-sltiu t5 s7 -1663
-sll a7 s7 a6
-lui s9 504339
-divu s6 x0 s6
-auipc tp 133100
-sub s10 s3 s5
-lui s0 651164
-rem a7 t0 a4
-mulh gp s11 s5
-mulhu t3 s6 t4
-ori s8 t2 -82
-slt t1 x0 x0
-sll s0 s1 tp
-mulhsu a4 s6 s9
-slti s0 s4 241
-srai t1 a1 9
-sub t2 s9 t4
-auipc t5 221976
-xor s3 s9 s8
-ori s9 t4 1759
-and a7 s1 a2
-addi a7 t6 -885
-add s11 a4 gp
-srai t0 x0 24
-srl s3 x0 s2
-slli a7 s11 26
-mulhsu s3 s6 s5
-mulhu a2 t5 tp
-mulhsu t0 a3 s3
-xor gp s9 a5
-slti t6 s2 -1231
-lui a7 119212
-addi s6 tp -1827
-sub s7 x0 t5
-or a3 a6 s0
-mulh s5 a3 s6
-sub s2 s1 a1
-slti a4 s4 1183
-auipc a3 893986
-xori s9 x0 -376
-ori t5 s4 1734
-rem a7 s3 s5
-sltiu a0 a4 476
-sltiu a7 s9 -1862
-addi gp a7 -960
-remu t0 gp a5
-srl t5 t3 x0
-srli a1 a2 18
-addi s8 x0 456
-sll s9 a7 s1
-remu a3 s4 gp
-mul t6 t6 a7
-div x0 ra t2
-and t6 s7 t5
-divu s5 t1 gp
-srl a7 x0 a4
-addi t3 s8 -1039
-mulhu t0 s5 a7
-sll t0 ra s4
-rem s0 a5 s1
-remu a5 s8 s9
-slli a4 s1 26
-srai t4 a1 22
-add a6 s7 t5
-mul t4 t0 a0
-srai s10 s10 8
-mulhu t4 s9 s5
-sltu t0 x0 ra
-div ra a1 a5
-addi s5 a7 -567
-mulh t5 s3 s7
-slt a0 s10 x0
-slt x0 ra t3
-srl s4 a6 ra
-addi t3 a1 -1794
-mul ra s1 t0
-lui t1 177048
-slti x0 t2 -196
-srli x0 tp 18
-auipc tp 310511
-mulh a6 s2 s0
-div t0 s1 s5
-sltu t0 gp x0
-remu ra t4 a2
-srli t2 a7 27
-auipc t0 95000
-srai t6 a5 0
-mulh s6 x0 s7
-xor s6 s7 x0
-andi x0 t0 202
-remu gp s3 s10
-add ra s11 s2
-sltiu t3 a2 -1536
-xor s1 s9 s6
-mulhu s1 x0 a6
-lui x0 757179
-addi a4 a6 -1284
-andi tp t6 -193
-or a7 t2 s6
-sll s7 t5 x0
-divu s9 a2 t4
-srl t4 a7 a0
-slt a2 t2 ra
-sll s6 t0 s0
-sltiu t1 s9 1896
-and s5 t5 t6
-xor s11 s4 gp
-mulhsu s10 a4 a1
-slt s9 a1 gp
-ori s8 s1 -1156
-addi s2 t5 -241
-lui s6 686092
-or s5 t1 x0
-slli tp t3 8
-lui a6 418789
-and a6 t3 a2
-sltiu s5 a1 860
-auipc s0 344738
-srl gp s5 a1
-srl a6 t0 tp
-lui t1 945952
-slli a2 tp 20
-slt t1 a4 a1
-srl a7 t2 ra
-srai s6 x0 13
-sltu x0 gp s5
-auipc s0 907460
-addi tp s9 -887
-slt t2 x0 a3
-and s4 ra a6
-mulhsu x0 s10 a4
-add s9 a1 s2
-sra x0 a6 a0
-sltu s2 s3 s6
-sltu t1 x0 s4
-xor t1 s11 s2
-ori a0 s9 -523
-mulh s8 s11 a7
-auipc s5 903637
-srl t0 a6 t5
-mul a6 a6 s6
-srai a2 s11 26
-mulhu s0 s11 s5
-srli s6 t0 7
-auipc t2 407497
-addi s5 gp -149
-mul s8 s9 ra
-xori t5 s11 -394
-slti s3 t2 415
-xori s4 t1 -234
-srli tp s5 11
-slti t4 s9 -1300
-slti a2 s4 50
-rem x0 s10 t4
-mulhu x0 s11 t4
-srai t3 x0 1
-mul a0 a3 s0
-xori t5 x0 -925
-slt x0 a5 a5
-ori s3 a5 1682
-remu s0 a4 a6
-and t2 a0 t6
-xori t1 s5 -1040
-and a5 x0 x0
-slli s9 a6 20
-addi a3 t2 1530
-sra t2 s11 s1
-sub a7 s3 s10
-or t4 s5 a7
-div t2 s10 t2
-srli a3 a3 3
-or a0 s1 a1
-xor x0 x0 a3
-andi t3 a0 791
-addi s0 ra 1773
-div s1 s3 s6
-sll s1 gp s11
-srli x0 a0 5
-sll t2 s1 s10
-lui t0 800354
-auipc t2 227850
-mulhu t5 t0 s3
-sra s11 a7 s6
-slt s4 s4 a0
-srl s5 s5 s9
-rem s5 a4 t3
-sra s7 s10 s10
-divu a0 t0 t2
-sltu a0 t3 s4
-add s1 s5 t4
-add a3 s1 gp
-slli s11 t1 5
-auipc s9 244771
-ori s9 s10 -1256
-div s3 a4 tp
-rem t6 s7 gp
-slli s8 s8 30
-lui a4 179316
-xori s3 a6 -1570
-srai s6 s1 19
-rem s3 s3 s5
-add a3 a7 s5
-slti ra s6 -1282
-ori s5 t2 492
-ori a1 t2 -533
-xor s11 t2 ra
-lui ra 869518
-ori a4 s4 1942
-sra s4 s7 a4
-xori s10 a4 880
-xor a2 s11 x0
-xor s3 a0 a5
-ori s5 tp -526
-andi tp x0 -1784
-addi s4 s9 -1621
-addi ra x0 -263
-addi a0 a4 -202
-rem x0 a1 t1
-mulhu s7 s10 t1
-sltu a1 ra s7
-xori t5 a1 -44
-sltu s3 s3 s5
-xori a7 t0 -1807
-ori gp a1 -1670
-mulhsu s4 a7 t1
-xor x0 s4 t2
-andi s6 a1 1112
-mulhsu t3 s1 a2
-or a2 s11 x0
-sll a0 s5 s2
-mulh a7 t5 a0
-sltiu s11 t0 -131
-mulh s1 s7 s5
-auipc s0 619854
-remu x0 s2 a6
-slli t0 s6 12
-and t1 a0 s11
-div s3 s7 t1
-ori t5 t3 -1870
-auipc a0 878946
-add t1 a4 a0
-sll a2 s5 s6
-and s2 s2 s10
-sub s9 s8 a0
-div s11 t0 a7
-sll s8 gp a6
-div s0 a6 a7
-auipc a2 340676
-addi t4 t1 1805
-sra s9 s11 t3
-sub a6 t1 s2
-xori s7 s2 -1130
-divu s4 t4 x0
-lui s9 542666
-sltiu s9 t0 1016
-mulhsu s11 a3 s9
-or s3 t6 x0
-ori ra gp -1899
-or a1 x0 s10
-or x0 a1 s10
-auipc t4 550761
-div s8 tp s7
-rem a1 ra t2
-srl t6 a5 a5
-div s5 s11 a2
-mulh s8 t4 s7
-xor x0 x0 s1
-mulhsu t6 t5 t2
-div a1 a0 ra
-sltiu a5 gp -109
-addi t5 s11 370
-divu tp tp t6
-mulhu tp s11 s1
-mulh t2 s2 a2
-sra t3 t3 a2
-mulhu x0 s6 ra
-and t1 gp t1
-auipc a7 751227
-mulh s6 a2 x0
-sltu a6 t4 s1
-slli s0 s8 31
-sra ra s2 a7
-addi s11 s10 1150
-div s4 s3 s5
-slti t0 a1 -1290
-mulh t2 x0 s0
-slt s9 s10 tp
-slti s3 t4 -788
-srai s4 s11 16
-sub s6 t5 x0
-slti s0 a1 -1194
-srai s5 a5 12
-sll x0 s10 t3
-mulhsu a0 t3 t5
-sra tp a6 x0
-mulh t2 a0 a7
-rem a1 s1 x0
-mulhu a2 gp a3
-auipc t2 658295
-divu s3 a4 t6
-slti s2 a6 1664
-xor s11 ra x0
-or s0 tp gp
-sltu ra s2 s3
-xor s4 ra s1
-mulhsu a6 s4 tp
-srai ra gp 24
-lui a1 770152
-slli s4 a6 27
-sltiu s10 x0 -1653
-and a1 s1 a4
-sll gp s11 x0
-mulhsu a4 a1 s8
-auipc s0 279744
-rem s4 t0 t2
-addi a3 t2 1653
-auipc a7 264725
-remu a6 t4 s0
-slti a2 s1 1847
-mulh s4 a1 t5
-rem t5 t6 t2
-sll a2 s3 x0
-mulhsu s0 s7 x0
-lui a7 941095
-auipc t5 459928
-slt s6 s5 x0
-divu a6 s6 s9
-add t5 a5 s0
-add a4 a1 gp
-slti s0 t4 -537
-divu x0 gp a4
-and a3 a6 s10
-and a7 ra tp
-srli x0 a4 2
-slli t4 tp 19
-srl t6 a4 x0
-slti tp gp -80
-sra a5 t0 s7
-mulh t0 a2 s10
-sub t6 s8 a0
-srai ra t1 11
-srai s8 s5 11
-srli gp a5 21
-slti s0 s11 -349
-ori t4 t6 679
-srai a5 t1 16
-addi s5 ra -1036
-mulh a0 a1 s1
-mulhu a1 s6 a3
-mulhsu x0 tp t6
-sltiu s5 s0 -588
-mulh s4 t5 x0
-add a1 t4 s11
-or s5 s7 s10
-andi s3 s8 -704
-ori s11 a7 1667
-mulh a7 t2 t1
-slti a3 t1 -870
-srl s7 tp tp
-rem t6 t3 s9
-lui a1 518439
-lui s2 1029808
-sub t5 s7 t6
-mulhu s2 s4 s4
-lui s9 336942
-slti x0 t2 -134
-slti t6 t2 -278
-sub s0 x0 s4
-slli t6 t4 9
-andi s4 t5 -151
-ori t0 s5 -181
-sra t2 s5 ra
-xori s6 t4 -1427
-sub ra s1 a5
-sll a1 a3 tp
-sltu x0 a5 s11
-xor t0 s4 ra
-lui s7 402691
-addi gp a5 -905
-andi s1 s5 -1621
-xori t4 s0 -818
-divu ra t4 gp
-ori ra t3 -1521
-mulhsu t6 a7 a4
-auipc t1 875970
-mulhu a3 s8 s5
-and t0 s7 a7
-srli s5 t6 27
-addi s0 x0 -1688
-mul a2 t0 t1
-ori x0 a6 -1247
-mul a0 x0 t3
-sltu s2 s4 s10
-mulhu s0 a4 s2
-addi t6 t6 -1967
-slli t5 t5 29
-divu s0 s11 t6
-ori a5 a7 -1311
-add s11 a3 s3
-andi a7 s11 -1114
-sltiu a1 s1 1445
-xor s4 t4 t2
-and s1 s2 a2
-divu s7 t2 s11
-srai s6 s3 11
-add s2 s2 s3
-addi s11 t2 926
-and a7 t4 s5
-mul s8 a3 t0
-ori ra a4 33
-srli s7 s11 7
-divu gp t4 gp
-xor s1 t5 a4
-ori s11 s11 -226
-slt a1 a1 a4
-slt t4 t4 t4
-and t6 t1 gp
-remu a6 tp gp
-sra t0 t2 gp
-mulhsu tp s11 s11
-and a3 tp x0
-or t4 tp s4
-sltu ra s1 a2
-mulh a2 s2 s8
-divu t0 t6 s10
-srli t2 a4 23
-auipc a1 1040196
-srli a3 s0 16
-and a5 t5 x0
-auipc s1 106456
-slt a2 a2 s7
-and t5 s7 s3
-add t4 ra s8
-xori s6 a2 -926
-slli a6 s9 15
-andi t4 t0 1456
-slli a2 x0 4
-srli s10 t1 26
-mul t0 a0 s11
-sltiu a1 x0 -928
-addi a7 s2 -691
-andi t0 t4 1439
-mulhsu s4 a7 t6
-slli t5 t0 31
-sltiu s9 s4 -881
-srai s7 a1 7
-divu s8 t1 t5
-rem s2 s9 a6
-remu s10 s7 s9
-ori t6 s6 1828
-add t0 t3 s1
-sub a5 s6 s2
-or t6 ra tp
-slli a2 gp 31
-ori s0 a2 1837
-xor t3 a6 t0
-mulh tp gp t0
-or s6 s9 a6
-sub t6 s0 s7
-sltiu s8 s9 1346
-slti t6 a5 551
-auipc a4 801881
-or t1 gp t4
-div s11 ra x0
-srli s6 s0 10
-srai s7 s4 11
-slt ra ra t0
-mulhsu x0 a2 a2
-sub s4 s2 s10
-lui t1 318042
-sll s2 x0 s8
-mulhu t0 s5 s6
-slli s11 a3 11
-divu a1 a6 x0
-mulhu x0 a6 x0
-or s4 ra t0
-sll a5 x0 t6
-xori s7 ra 1017
-remu t0 a0 a7
-rem s11 s5 t1
-addi t3 s3 -1758
-auipc a3 1028833
-mulhu t4 t4 a7
-div s0 ra t5
-srli s9 s1 21
-div a3 t0 x0
-lui s10 471839
-remu t6 s6 ra
-mulhu t2 x0 a7
-mul a1 a0 a1
-addi a7 a4 -1742
-mulh a2 tp s5
-andi t6 a0 -838
-sra x0 t2 a6
-divu s7 s11 a4
-slli a5 a0 11
-andi a6 s10 -206
-and tp s1 tp
-srl t5 a7 a2
-ori x0 s4 72
-srai t6 t3 31
-rem x0 t5 s5
-div a4 s5 a3
-srai a0 a5 15
-div s7 gp a4
-divu t2 s6 s10
-mulhu s7 tp a0
-rem s0 t1 a4
-slli s3 s6 4
-rem s4 x0 t2
-mulhu t5 a3 gp
-lui t1 860220
-auipc t1 289433
-remu a6 a3 s6
-sll s6 s0 s2
-auipc s4 783402
-add s8 s3 s6
-auipc t2 330485
-mulhsu s1 t3 s9
-and a1 a3 t1
-addi a2 t3 -904
-srli s11 x0 10
-mul s10 t5 s11
-lui gp 537727
-div t1 t4 t2
-and x0 a6 a2
-and s7 x0 ra
-addi t2 t4 1830
-sltiu a3 s1 -1805
-sltiu s8 s5 -1503
-mulhu s6 a6 t3
-or t0 t0 s7
-slti a2 a1 -1172
-srli t1 s2 31
-mulh a1 s4 s11
-mulh a4 a5 s11
-div a3 x0 s10
-addi s3 t6 -1845
-sra x0 a2 t3
-rem t4 x0 gp
-ori s0 x0 -1265
-and s8 a0 s6
-mulhsu ra t0 s3
-sub a7 s9 s3
-xori x0 a4 -1362
-mulhsu s7 s1 a5
-add tp a7 a1
-xori t0 s2 -78
-sltu s2 x0 a7
-divu tp s6 s1
-srl s4 s0 t5
-xor tp t2 tp
-srl s10 s2 a2
-auipc x0 997958
-mulhu tp t0 s6
-auipc s4 561633
-xori a3 s2 -48
-mulh s3 s4 s10
-or gp t4 a0
-divu tp a0 a6
-andi s1 x0 -1154
-or ra s4 t0
-sll s8 s2 gp
-mulhu s9 s10 t0
-xori ra a0 -1501
-rem s1 s1 tp
-auipc t1 795277
-addi s5 t2 331
-sra s0 a4 a5
-srli s9 a0 2
-add a6 t6 s8
-addi gp t4 -660
-srli t3 a2 18
-and s3 s6 a3
-mulh s3 t3 s10
-slti s11 a6 -406
-mulh a3 s10 tp
-mulh s3 s6 t1
-ori s3 s8 -11
-ori gp t1 2026
-auipc x0 239634
-or s4 a3 a2
-sltiu t0 s7 596
-divu t6 s0 t6
-sltiu s2 t0 -1590
-and t2 t4 s4
-addi t1 s11 816
-sll s5 a3 t6
-mulh gp s11 s7
-mulh s2 t3 s11
-divu ra s2 a1
-mulhu a3 t5 t5
-srl x0 x0 s11
-slt s1 s3 s7
-mulhu t1 t5 a2
-remu gp s7 t1
-xor s10 t6 t6
-slti s2 a7 -1046
-sltiu a6 t6 -824
-xor x0 gp gp
-sra s4 s2 t0
-slt x0 s10 s8
-xori a4 x0 -633
-srai t4 a4 2
-div a2 t5 a7
-add a5 s11 a1
-mulh s2 s7 t2
-sra a1 s1 t0
-sub a5 x0 t3
-lui t0 654845
-rem x0 t2 s10
-xor x0 s2 s7
-remu t4 s8 s1
-lui t2 246206
-addi gp a6 1350
-sub t6 a3 t2
-slt t2 ra s9
-mulh tp s10 gp
-sltiu s10 a4 1740
-sltiu t3 s9 900
-sltiu a3 t2 713
-divu t6 a6 s7
-auipc a1 62986
-mul a3 a6 t3
-rem s7 a2 t1
-sltiu a5 a7 -1274
-ori a2 s4 -1445
-mulh t1 a3 t6
-sub t5 t6 tp
-mulh x0 a5 t2
-mulhu a7 s0 a0
-slt s4 a6 s7
-andi a2 tp -1211
-mulhu t4 t3 t2
-srl s11 t4 t0
-div tp s3 t4
-xor t2 a4 a2
-sltu x0 ra a2
-srli t0 a5 9
-sra gp a7 a7
-rem s10 t2 a5
-sll s10 s2 ra
-xori gp a1 -1410
-sltiu a0 a6 851
-rem s3 a0 x0
-xori s6 a0 1308
-sltu a0 s9 x0
-mulh s5 gp s6
-slt a7 s9 s1
-lui t5 813558
-xori s7 tp 1526
-lui gp 452739
-sltiu a1 t2 -658
-auipc t0 93110
-remu t5 a3 a4
-xori tp a5 -1803
-sltu tp a7 a2
-sll s8 a4 t1
-sll a1 a2 s10
-mul s8 x0 a7
-remu a0 x0 s8
-mulh s6 s3 a5
-add x0 s10 s0
-sltiu s7 s5 964
-sll s7 s11 t4
-xor a3 a1 s4
-remu s6 gp a1
-sltiu t3 s6 -1867
-sra t0 s4 t2
-auipc ra 49583
-remu ra s1 s2
-or t6 t1 s8
-div ra a4 s3
-xori t5 s1 -241
-mulh a3 a2 a5
-slli ra t2 16
-sll s3 s1 s10
-addi a6 x0 1903
-xor s3 a4 t2
-sra gp a6 a2
-mulh t6 s1 a5
-xori t2 s4 -981
-sra a3 t5 a2
-mulh s8 s9 a2
-sltiu s0 a5 921
-sra a2 s9 t4
-andi a2 s2 1693
-or ra gp a0
-div a6 a6 s4
-ori t2 s7 -1427
-mulh t0 a5 ra
-xori t5 s7 823
-sub s3 a4 a7
-addi t2 s7 -14
-srl s4 s10 s5
-srai a7 a7 26
-slt s5 t5 s8
-srl gp a2 s7
-and a0 s5 a6
-remu s11 ra s7
-remu a4 a3 ra
-ori t1 s2 -1994
-sra t6 t3 s9
-or a6 s8 s4
-mulhu s6 t4 s5
-andi t5 x0 -589
-sra t1 t0 t3
-and t3 t6 ra
-auipc t0 182483
-andi s1 s7 -998
-sltu x0 a6 t0
-slti s9 a0 -1919
-sll a3 s9 a2
-slt tp s2 x0
-div a6 a3 s0
-addi t6 x0 682
-mulh s0 s10 a0
-xor x0 x0 a1
-xori s1 s8 -768
-auipc a2 43735
-srl t6 s10 tp
-ori s5 s4 -213
-sra a5 ra t2
-mul s5 s0 t5
-srl t6 a0 a3
-mulhsu s9 s4 t3
-sltu x0 t1 t6
-div a4 a5 a0
-mul s6 s0 s8
-addi x0 a0 1684
-sra t1 s7 t6
-mulhsu ra t1 s3
-srli a1 t5 17
-slt s4 a3 x0
-xor s3 t3 a0
-lui a4 299838
-lui s3 166275
-or a4 a4 s6
-sltu s5 a2 gp
-remu t1 a6 tp
-divu t3 s5 t2
-div gp s9 t2
-slli tp s10 8
-mul x0 t2 a1
-mulhu a3 s0 x0
-auipc s7 957030
-sltu a7 a4 t0
-and tp s0 s0
-mulh t3 t5 s0
-mulhsu a2 a0 t0
-addi s3 a6 -269
-srai tp s8 3
-div t5 s6 t6
-srai gp s7 27
-slti x0 ra -1546
-addi s8 s11 232
-or t3 t3 t5
-andi a7 gp -1642
-sra ra s9 s1
-addi a1 a0 -1923
-ori gp s11 -243
-srli x0 s9 10
-mulhu a7 s9 a4
-mulhsu s9 s5 s4
-sub s3 x0 a0
-slli a2 a1 30
-rem a2 s10 t1
-div t1 s3 a2
-xori x0 x0 103
-slt a5 t2 x0
-div s4 t2 s0
-sub t1 a7 x0
-auipc t2 69299
-and s2 a2 gp
-add tp a4 a7
-srl t2 s10 a0
-and s8 t0 s4
-slti x0 ra -1382
-mul a7 s9 s2
-mulhu s2 s0 gp
-srli x0 a6 26
-addi a2 s6 894
-mulhu s3 t4 a2
-rem s7 s1 ra
-rem t5 s11 a7
-sra s6 t1 t3
-xor a4 a6 t0
-xori t5 t0 721
-mulhsu a3 a4 a3
-add a1 a0 tp
-mul s2 x0 a0
-srl s9 a4 t1
-slti t3 s7 194
-rem s8 t4 tp
-xori s2 t5 907
-mulhu a3 a5 a4
-auipc t5 743031
-sll s9 t2 a5
-div s10 a4 ra
-sra t5 a6 s3
-sll t1 a6 s9
-sltu t4 a1 t4
-sll gp a5 s2
-sub t5 a3 t1
-div t0 gp s9
-and s5 a6 s11
-remu s1 s3 x0
-andi x0 t4 -251
-slli ra s7 10
-mulh t3 t2 s3
-xori t5 t2 -911
-mulh t2 t4 t5
-rem a1 a4 s1
-lui a5 629996
-ori s5 s4 1245
-slti s1 s3 -1697
-sra s5 t0 a5
-andi gp s0 747
-srl s4 s0 a3
-sra a7 s3 ra
-divu s2 t2 s7
-and s6 s3 a4
-and t1 a2 t0
-slt t6 s2 a2
-divu t4 ra s0
-srli s2 s8 8
-slti ra s8 1975
-lui s5 389273
-remu s4 a1 a7
-lui s9 953203
-auipc a1 390925
-lui t3 478721
-remu s1 s11 t1
-addi t0 gp -1800
-andi x0 s8 1098
-and t5 t6 s7
-srai x0 s4 31
-addi t6 a1 226
-or s0 a2 a3
-rem a5 s4 s2
-remu t2 s6 t4
-mulhsu t5 ra t5
-sra x0 s3 t0
-slti a5 s2 -946
-mulhu s11 s7 a0
-divu a1 x0 s3
-mulh s4 a1 t5
-lui a3 459536
-div s8 s10 t6
-mulhu s1 a4 s2
-auipc a4 952012
-addi t4 t1 -1939
-ori s4 a5 -1170
-ori x0 a0 -1438
-sll t5 t0 s5
-sltiu a3 t4 -1602
-xori s6 a0 450
-div a7 s2 s8
-remu ra s8 a3
-div t0 t5 s3
-remu s0 a3 s7
-xor s2 s8 ra
-lui gp 309684
-mulhu a5 s5 a2
-sra s10 t0 a2
-lui t0 517933
-sltiu s0 ra -1799
-or a3 t4 t0
-mulhu t1 s4 t4
-srai a3 t5 28
-slt x0 t5 s4
-mulhu t5 s6 s3
-ori tp tp -1997
-slt s7 x0 s7
-xor t3 s11 a1
-srli t3 gp 30
-lui a6 964147
-mulh a4 t2 s11
-ori s8 a6 -1680
-div s0 t1 s8
-xor s11 a2 gp
-mulhu t1 s5 s0
-andi s2 a6 -277
-sltiu a7 a2 673
-xor t1 ra t0
-add a3 s5 s4
-mulh a4 t1 s11
-sltiu t1 s4 -1546
-sltiu s4 s6 -2006
-sltiu a0 a1 1534
-divu a0 a1 s7
-addi s11 t4 -867
-xori tp x0 1383
-addi a7 a3 -112
-xori t6 t2 -225
-sltu s4 a1 a2
-and a0 a7 s8
-sll a6 t2 a2
-divu x0 s3 a2
-ori t1 s11 -1550
-srli tp s2 17
-divu a7 s9 a2
-ori gp s11 -1724
-xor tp t2 s11
-sltiu t1 t0 1579
-slli a0 t0 4
-and a0 ra a6
-mulhsu a0 a1 t1
-div s11 s3 t1
-add a1 t5 t1
-mulhu s4 s4 gp
-lui s4 1003309
-andi t6 s2 1570
-mul a4 gp a2
-srli t1 s8 0
-mulhsu t3 s7 t1
-addi s9 a5 -333
-slli t1 s10 0
-xori tp t2 -545
-srl s11 t6 s1
-lui ra 552567
-srli t0 x0 25
-sltu a2 t1 s3
-div s6 x0 s4
-srl t4 a2 a7
-andi a7 tp 758
-xori t6 s11 -1952
-mulh x0 t6 s8
-lui s1 879461
-sra t6 ra s5
-add a2 t1 s4
-div a4 gp t2
-lui s0 853196
-ori s2 a0 1288
-srl a0 s4 a6
-srli s5 a0 13
-mulhu x0 s5 s11
-auipc s3 294689
-mulhu a6 a4 gp
-mulhsu a7 s2 a5
-srli t5 gp 31
-mul s6 x0 s7
-mul t6 t4 a4
-srli s5 s11 17
-srl x0 tp s8
-sra t1 a7 s6
-and t6 t6 s10
-ori t1 t3 -634
-srli t4 tp 30
-sltiu tp s0 692
-rem t2 a0 s4
-slti t6 s9 2047
-divu a6 t2 a0
-xori x0 a7 93
-srl a5 t3 tp
-sub s10 t4 a2
-or s6 a5 t0
-lui t1 600516
-sltiu tp s9 -2040
-and a6 ra t6
-srai a1 a0 14
-ori t5 a0 -659
-slli a5 t6 2
-mulhsu a7 t5 a4
-sll s7 a6 s1
-srai x0 t0 19
-mulhsu a0 s10 x0
-slli a3 a4 4
-slti s9 ra -1411
-mulhsu t4 a4 a7
-sltu s10 s0 a3
-slti s10 s5 1796
-auipc s9 959195
-sltiu t0 x0 -12
-srl s6 s2 ra
-div a1 a2 a1
-rem x0 a3 x0
-add s2 s3 s3
-andi a0 s3 -895
-slli t6 t4 26
-sltiu s7 tp 1939
-sltiu a2 s8 -700
-srl t1 gp x0
-slt s6 s5 s2
-sub s0 t2 s5
-mulhsu s11 x0 s6
-srai t5 s2 22
-sra tp t1 s9
-srl a5 x0 a4
-andi s10 t6 -672
-div s10 t2 a5
-addi s3 a4 1331
-slt a6 s6 a1
-mulhu a7 ra s2
-slli a7 t4 13
-slti ra s1 1680
-div t2 s5 a4
-add tp a0 x0
-srli a4 a1 23
-add s1 s7 a5
-remu a1 a0 s7
-and a5 t6 tp
-lui gp 186497
-divu s10 s10 a3
-and s3 s7 tp
-auipc s8 340004
-or t5 a3 a2
-mulhu x0 a0 t3
-mul a2 ra a7
-and s0 t6 t5
-srl t1 s3 t1
-xori s1 t0 -1920
-sltiu s10 a6 -1462
-divu s9 tp t3
-ori s10 a4 -915
-divu s8 s11 t5
-or s9 a0 t5
-or s0 a2 x0
-sub s5 t4 s9
-srai s2 a3 11
-sub s11 s1 t0
-div a7 a3 s6
-auipc s1 841848
-slti t6 t3 -434
-divu t2 t2 tp
-slli s2 t5 31
-slli a5 t6 4
-srl a1 a7 a0
-addi x0 tp -1392
-divu t6 t5 s7
-andi a6 s1 -1567
-and s2 a4 a0
-mulh a1 t6 s0
-sltiu a0 a3 176
-addi t6 s7 823
-xori a0 s10 -842
-mulhsu s2 s3 tp
-xori s5 tp -1080
-andi a7 s0 -983
-remu tp gp t5
-mulhsu ra a7 a2
-lui s0 450747
-mulhsu s11 t4 t0
-sltu a0 s8 x0
-sltu tp s7 t3
-div x0 t4 a6
-xor s1 x0 s11
-mulhu tp s10 a7
-srl s9 t2 t0
-remu a4 a6 s4
-sra ra s5 t3
-addi a6 x0 -182
-mulhsu s10 s11 a6
-sll s1 s1 s0
-srai a7 s7 6
-and gp s3 x0
-mul x0 s11 a3
-sltiu s8 s11 -605
-xori t3 a4 -429
-srai s1 a6 27
-divu a1 tp s5
-sltiu t5 a6 -160
-slti s3 a7 1385
-mul x0 s11 s11
-sltiu s5 a4 -595
-addi s6 s8 -1827
-slli t0 s9 4
-srl a1 s0 s11
-or s10 s7 tp
-mulh a4 gp s10
-andi s8 s5 937
-srl ra gp t6
-lui s0 585013
-slt t3 t2 s5
-sltiu s7 t4 1623
-divu ra t1 s9
-or x0 x0 s8
-auipc s11 853076
-auipc a2 123506
-srai t5 a5 30
-sra tp s2 a3
-srli a2 ra 29
-slti s5 t5 -1147
-srl x0 t1 a1
-add s6 t0 t2
-mulhsu x0 ra s1
-sub a0 ra s11
-addi a6 a7 -424
-div a4 tp tp
-xori gp t5 -870
-rem x0 gp a1
-srai t0 s0 22
-ori s1 a3 -335
-mulhu s0 a1 s2
-add tp s8 s5
-remu a3 a4 s8
-lui ra 874701
-or ra s0 s0
-xori a6 a6 -1620
-and s6 s11 t0
-rem s1 s11 s2
-or tp a1 s6
-xor a3 t2 s5
-sll s5 a4 s10
-sub t1 t3 s10
-xor a7 t0 a6
-and a0 t3 tp
-sll tp tp ra
-mul t5 s10 s7
-divu a3 s2 s10
-addi x0 t1 -631
-addi t2 s3 -1719
-slt t3 s9 t6
-sub t0 a5 t6
-slti s2 s4 1137
-or t1 s9 t5
-xor gp s2 s0
-mulhu t4 gp t1
-auipc tp 1046778
-div t5 s1 t4
-div a3 ra a4
-sltiu t4 t1 655
-or s7 a4 ra
-sub t2 gp t5
-mulhu a6 s1 ra
-mulh s1 gp gp
-xori a4 t6 -1748
-sub t5 t2 a3
-sll gp t6 a6
-sll x0 a0 s6
-srai a6 t4 5
-or x0 s8 a0
-addi t1 s11 -215
-xori s5 a2 1442
-sltu t1 t3 t3
-add s7 s10 t6
-addi s7 a0 -543
-sll a4 gp a4
-srai s1 a2 2
-and t5 gp t0
-or a4 t2 x0
-slti tp x0 38
-mulhu t5 a4 t4
-slli a2 x0 25
-slli t3 s0 11
-sll a2 t5 tp
-slti t3 s10 -910
-mulhsu s5 s9 gp
-mul t6 ra a3
-sll t4 t3 a5
-sltu a1 t3 s6
-or a7 s9 a4
-sub t1 s9 s8
-sra a5 a5 t2
-sltu t6 s9 s6
-auipc a7 430982
-xor a3 s0 s8
-sltu a3 gp a2
-sll tp s6 a2
-sltu s10 t4 x0
-sub a7 a2 t6
-addi t4 t3 -2019
-slli a7 s3 13
-remu a1 t3 ra
-sub t4 tp s6
-slt t3 t2 a0
-mul s11 t6 x0
-lui x0 3794
-add t5 a1 s9
-auipc ra 931499
-sub ra s5 t3
-andi s2 ra -1817
-slli t2 s4 8
-div tp s3 t4
-srai ra t3 26
-srli ra s10 29
-mul ra s4 ra
-add s5 s0 s2
-srai gp t4 2
-srli x0 s11 4
-auipc a7 517449
-sll a3 ra s5
-srli t2 s9 25
-div t3 gp gp
-mulhsu a6 t1 s5
-div t0 s8 a1
-divu s11 s5 s11
-auipc s1 826248
-srl s4 x0 ra
-andi ra s11 1247
-sltu t6 t1 a7
-mulh t3 s6 t6
-srl s1 s3 s10
-xor t4 s2 a4
-addi t3 a5 -139
-ori gp s0 -1638
-srli s2 s8 9
-lui t6 476
-rem ra s9 t0
-slti a4 t1 -1807
-or t4 t5 gp
-slti s9 t4 -50
-xori tp s0 1813
-and t2 a2 s11
-ori s2 x0 -182
-lui tp 110137
-slti a3 a1 -1912
-srl t3 a7 s5
-sltiu s3 a6 -99
-lui t0 932302
-mulh t3 t1 s0
-slti s7 s10 -95
-mulhu tp a4 s6
-remu a2 a2 a0
-div s7 tp s10
-slt t2 t4 s8
-div tp x0 tp
-addi a6 ra -1627
-divu t6 s6 a0
-sra a5 s0 t0
-or t3 gp s1
-mul x0 s6 s7
-mulh s2 t0 s8
-ori t1 x0 173
-xor a7 s1 a6
-srl s3 a2 s4
-remu t5 s6 s2
-srai s4 ra 17
-srli a1 s4 26
-ori gp s0 -1920
-mul s4 t6 t3
-mul x0 x0 a3
-slt t4 s6 t2
-sltiu s3 t4 813
-slli a0 a7 12
-sra s2 a3 s10
-remu s5 t1 s6
-mul s5 t4 x0
-add x0 s2 t4
-sub a7 t0 x0
-mul t5 s11 a6
-sll s4 a0 s5
-sll t3 t6 t4
-lui a3 875856
-mulhsu s3 a4 t1
-sll s1 s11 a2
-srl s10 t5 t5
-sltiu s7 t3 167
-srl t2 tp s10
-mulhu s10 t2 a6
-addi a0 s6 808
-srli a3 s0 18
-mulhu a2 s6 ra
-ori t5 tp -1399
-xor t0 s3 s10
-mulh a7 s5 s7
-lui tp 145907
-mulh a4 a2 s6
-srli s7 t3 19
-ori tp s2 -1963
-sub s2 s3 t0
-slti x0 s10 -1079
-or s10 t2 s7
-rem s5 a7 a0
-add t1 t3 a3
-sll a2 s10 tp
-remu a1 t4 t4
-sltu x0 t3 t1
-divu a1 ra t5
-mulh s1 t2 ra
-mulhsu gp a6 tp
-sra s6 tp s0
-lui s9 535187
-slti s4 s6 -635
-slti s7 a4 -1355
-srai s9 a7 8
-slt s1 s5 s6
-remu t3 s7 a6
-auipc a5 352181
-slti ra a7 -77
-slti s1 a0 -396
-remu a1 s11 t3
-mul s10 ra x0
-mulh t6 s8 s1
-srl a1 s3 a2
-xor a7 a1 gp
-sltu s6 a5 s5
-divu s1 t1 s3
-auipc s3 135300
-xori s9 a1 694
-mulhsu tp a5 ra
-srl gp a5 a3
-and s0 a6 tp
-div s1 x0 s0
-auipc x0 408745
-addi a6 ra 1512
-or s0 t5 a2
-srli x0 a0 22
-slli t0 s1 5
-divu t1 a5 t5
-sub gp t1 s2
-sltu s9 a5 a5
-slli t3 a0 6
-xori t0 s7 -1972
-or a4 x0 s3
-lui x0 608953
-srai a2 s7 16
-mul t6 a2 x0
-xor s2 s8 t6
-rem s4 a3 t3
-auipc a1 545775
-div a4 t6 s0
-sub s9 s11 a1
-mul t1 s0 s9
-sltiu a0 s9 1650
-sub s6 s2 a0
-sra s9 ra x0
-xor s10 s0 t0
-rem t0 s4 a6
-mulh gp tp a3
-andi a7 a7 -488
-rem a7 a1 s9
+mul gp s1 t1
+or s7 s2 s7
+srli s11 s9 0
+andi a2 gp -265
+rem s5 s4 x0
+slt t3 a3 s11
+rem s9 a3 a6
+mulhu s6 s3 t6
+and s11 ra a7
+lui a1 808993
+xori s2 s3 -175
+srl tp a3 s11
+mul tp a6 t1
+sltu t5 s11 s2
+xori a2 a6 122
+addi a6 s10 1544
+slt a7 tp a2
+slti a0 s6 -1138
+div x0 s3 s7
+mulhu tp s7 s11
+div t5 ra s2
+slt t2 a2 t1
+ori t5 s0 -689
+mulh s3 s3 s10
+mulhsu t0 a6 s5
+slt a3 a5 tp
+lui a5 887243
+addi s5 a1 913
+rem gp s0 s2
+slli s2 s2 8
+addi t5 x0 -8
+sltiu gp s1 -127
+lui s8 66412
+mulh s4 s0 t6
+mulhu t6 t4 s9
+mulhsu a0 a0 s9
+sltiu s1 t3 164
+mulh a3 t4 a2
+lui x0 540849
+ori ra a0 -161
+div x0 tp s7
+or ra a3 s1
+auipc a5 43483
+div s10 t3 s2
+and t3 t2 a7
+sltu gp s0 t6
+div s10 a7 t6
+div t5 a7 t6
+rem a7 s8 tp
+sll t5 s8 x0
+srli a4 s4 2
+sltu s2 a3 a6
+slli s1 x0 6
+sltu a2 t6 s3
+sltiu a5 s9 -948
+mulhsu a7 s7 s11
+andi t3 s6 653
+sltu t6 s3 s5
+mulh a1 s10 t4
+xori s7 s11 -525
+mulhsu s1 s1 t3
+mulh tp t1 a5
+mulh t0 s5 s10
+srli s0 s9 0
+mul s8 s6 t3
+add a2 s4 a1
+mulhu x0 t2 a0
+rem a2 s6 t0
+sltu t5 a4 t3
+remu a6 t2 a2
+div a1 t0 a3
+addi s0 s0 117
+xor s1 s9 t0
+sltiu s9 a3 2027
+addi t3 a0 -1301
+sltu s4 s1 s1
+add a0 s6 t2
+slli a1 t5 4
+slti t6 a0 524
+and s7 s1 a2
+mul s7 gp a1
+sltiu a5 s2 896
+rem s9 s9 s4
+sltu a0 s11 s6
+xori a0 s2 -137
+slt t1 s6 a0
+auipc a0 378158
+ori t3 t4 -1662
+sra t1 a2 a1
 sra s4 a0 s9
-sub x0 t2 gp
-add s2 s3 t3
-or a2 t3 s0
-and a6 a6 a3
-divu t2 t1 t0
-lui a7 102393
-slli s10 s5 2
-div a0 s11 s7
-xor s5 s1 ra
-and a7 s7 s1
-div s8 s10 a2
-mul a6 s10 tp
-sub a2 t5 t6
-srli t2 t6 21
-auipc gp 135605
-srl t6 t0 t6
-divu a0 a0 t2
-sltu t1 t5 s5
-srai s3 t6 31
-rem s0 t1 a3
-lui t6 831674
-lui s7 1024303
-slt t3 s3 t5
-sub ra s1 t5
-auipc s10 1031106
-lui s8 775847
-rem t3 a3 a0
-lui a2 536670
-auipc s9 15987
-sltu a7 s7 a4
-ori x0 a2 300
-srai a5 s8 21
-lui t1 685295
-mulhu a1 x0 s2
-mulhsu a5 s5 t4
-addi a2 s11 -1431
-div t0 a7 a4
-or a2 s9 s1
-ori s5 s7 -600
-slti a5 a4 636
-addi t2 a7 1320
-xori s7 a7 -1921
-div s4 x0 t3
-slt s10 t3 t5
-mul a1 x0 x0
-ori t6 s5 -1228
-ori t3 t2 -349
-lui s11 159989
-sltiu tp t0 2036
-srl x0 t3 a6
-and a3 a7 tp
-xori t3 s7 -713
-addi x0 x0 -1105
-div s1 a5 ra
-rem s7 t6 a7
-mulhsu a4 x0 a6
-mul x0 t2 a0
-slti s9 a1 -937
-div x0 s1 a5
-srli s6 s5 9
-mulhsu a3 a6 a7
-or s1 s2 t6
-xor t5 a7 a0
-mulhsu a0 t4 x0
-xor s10 s1 tp
-div s6 gp s4
-andi s0 a5 -889
-mulh ra a3 a7
-remu a3 a2 s6
-andi s5 x0 -696
-andi t0 s11 -1409
-and s7 a1 t4
-add s10 gp t1
-slti x0 s8 -1671
-mulhsu t4 gp s3
-ori x0 a1 514
-add t3 a5 s11
-rem s2 t6 a4
-div t5 s9 a2
-slti a2 t5 1551
-srl t6 t6 t1
-xori s5 a2 1647
-andi a0 s8 1947
-and s9 t6 a5
-rem s8 s10 a0
-sltiu a5 s2 498
-sltu a3 t4 s10
-sltu s10 ra t5
-mul a7 x0 t3
-srl s11 a0 a0
-sll ra s5 s8
-mulhu s9 t6 t3
-ori s3 s9 -512
-slli gp a4 2
-divu s1 t1 a3
-mulhu a7 t6 tp
-sub s7 t0 x0
-and tp ra t3
-sub s7 s0 s1
-addi t0 a3 -1756
-sub t5 s7 a5
-or a7 t0 s4
-div s3 a7 t1
-srl s11 x0 tp
-xori s4 t0 -41
-rem t5 s10 x0
-or a2 s2 s4
-xori a6 a1 -717
-slti s9 t3 -530
-div t2 a6 t2
-srl s9 s4 t1
-sltiu s0 a5 -1649
-srai s10 a5 9
-mul a1 s3 a2
-sub s9 a5 x0
-remu gp tp s11
-and a0 t4 t3
-mul s5 ra a3
-add s9 s8 t5
-slli t4 t6 30
-xor t2 t2 a7
-or x0 gp s10
-xor a6 s1 a6
-sltu s11 a3 t5
-or t0 t0 a2
-sltiu s10 t5 -951
-auipc a5 174487
-add a0 s10 a6
-andi s3 a2 -1623
-andi a7 a2 -1167
-div t4 s0 a2
-sltu s9 s8 tp
-addi t0 s9 -1783
-srl tp s10 a0
-divu a5 s10 s10
-or x0 t1 t2
-sltiu s5 t5 -142
-srai a3 s1 7
-sll s5 a3 t4
-mul s3 t2 a1
-sltiu a1 t0 -438
-mul s4 x0 x0
-slti x0 s9 1784
-srl a4 s10 s3
-auipc x0 588314
-divu s6 a3 a4
-sltu t3 s10 a1
-mul t1 t1 s0
-add t0 s1 a5
-sltu a4 s11 x0
-divu s4 t4 s10
-auipc t2 840587
-slli a6 s0 4
-slti a4 t3 902
-slti s6 t3 807
-add a3 s11 t5
-rem s3 s4 s10
-add tp a0 s10
-slt s1 x0 t5
-divu a1 a1 ra
-andi tp a0 -1261
-srai a4 a4 10
-sub a5 s10 s3
-xor t4 s10 s3
-divu s8 s2 a4
-mulhsu t0 a7 s7
-sub s2 s7 t1
-and x0 s9 a0
-srl a6 s1 x0
-mulhu a5 t4 x0
-sra s10 a5 a0
-sra s3 tp t1
-mul t2 x0 s8
-mul s1 a2 a3
-remu s1 t6 t2
-slti a1 a2 -1143
-sra a7 t1 ra
-lui tp 452202
-slti t3 s10 -299
-divu s6 s11 a5
-xor x0 tp ra
-divu a3 s11 gp
-mulh a0 a0 t0
-srli s5 a6 22
-xor x0 s0 s10
-remu s8 s2 t2
-srai s10 s9 31
-sltu t2 x0 s7
-sub s6 s11 s8
-mulhu x0 s7 s9
-div a1 x0 a5
-slti s10 t6 -86
-mulhu s10 s0 t2
-divu a4 a3 s2
-sltu s10 s8 a6
-xor t4 x0 a3
-sltu a1 a3 x0
-sltu t5 x0 s0
-mulhsu a7 a4 a1
-srli a0 t0 29
-add a3 tp a3
-sra a2 s7 s10
-addi s6 s8 -1196
-xori a0 s1 -1094
-sltu s8 t3 t3
-slli a6 s3 19
-sra s2 a4 s0
-slti a2 s3 -79
-sltu s0 t3 s0
-addi t1 t6 -153
-slti s11 s5 186
-slli a1 s1 8
-mulhsu a7 tp s0
-andi a1 a0 1653
-slli t2 t3 26
-mulh s8 gp t1
-xori t5 a6 -1436
-divu s4 s7 ra
-slti x0 t4 -1560
-addi ra t3 -881
-srai x0 s11 10
-andi s8 x0 1941
-srl a3 s3 s4
-auipc a3 486110
-auipc tp 475391
-sltu a6 t0 s5
-slli t0 a1 0
-slt s1 t6 s11
-xor a3 a7 t4
-srai s11 x0 30
-divu tp s10 a0
-xori t6 a3 -917
-andi s11 a6 -1265
-sltiu t2 s0 -1303
-addi s11 a7 -483
-sltiu a5 t3 -2044
-ori tp a4 -876
-rem s3 t3 a2
-slt a4 s2 a4
-srai s7 s8 30
-auipc s6 470741
-sltiu s1 t2 -613
-xor s5 t3 x0
-sub t2 t0 s5
-sra s9 s6 x0
-xori a7 s1 1408
-or t2 s1 a1
-div x0 gp s0
-addi a7 t1 180
-xori a7 x0 604
-mulhu s0 gp tp
-srli s7 t1 9
-lui s7 508122
-andi a1 s10 -1783
-lui gp 975345
-ori s3 ra -885
-div s7 s10 a6
-mulhsu a4 s3 a2
-add a1 s6 x0
-slt t5 s4 s9
-auipc s5 289216
-slt a3 a3 s9
-addi t3 s0 -1312
-rem t2 s3 x0
-xori s4 t5 -44
-mulh a7 s9 a0
-div ra t2 a5
-srl a7 s9 a5
-mulh s4 t3 s11
-sub x0 s11 s6
-div s0 a2 s0
-mulh s0 t5 a0
-sltu t3 s6 a5
-sub t5 a2 a0
-sltu s8 s7 t0
-remu ra a5 a1
-addi a7 s10 -45
-srli t6 t1 29
-mulhsu s9 s4 t6
-sll gp a3 a1
-sub s5 a7 ra
-slli t1 t1 17
-slti a7 s10 1728
-mul s9 ra gp
-div t3 a7 a3
-or a2 s2 s0
-srl a1 t0 a2
-addi t1 s4 -866
-ori s4 s6 -1730
-add gp s7 s7
-addi s9 t6 -1267
-auipc a3 460463
-xor t4 t4 a5
-ori s2 x0 -807
-auipc a1 891168
-ori a2 s10 -1662
-sltiu s9 a4 1886
-auipc tp 623641
-srai s3 s10 0
-srli x0 s8 8
-slt t1 tp s10
-add s8 a6 s5
-sra a4 t5 a1
-andi s4 a2 1349
-addi s6 s1 -218
-div a6 x0 s6
-remu gp s2 x0
-add x0 t2 s3
-or ra tp gp
-sltu s0 a7 t3
-addi s0 ra -432
-rem a0 t1 a1
-divu s2 s6 a3
-remu s7 tp a2
-divu s2 s6 t6
-slli ra x0 26
-srl a3 a5 gp
-xori t5 a1 -1644
-srai tp t5 30
-srai t3 a6 22
-andi s11 t5 1434
-slli t2 s8 0
-xor tp t2 tp
-and a2 x0 s11
-mulhsu s2 s0 s1
-div t2 t4 s0
-remu t1 s4 ra
-slt a4 t6 t2
-sltu x0 s9 t3
-mulhsu t0 s10 s11
-sltiu s1 s1 871
-sll t4 s3 a0
-slli a2 a4 17
-auipc a6 65629
-div a0 a2 x0
-srl a3 a4 s0
-srai a2 t5 3
-slt s6 a4 t2
-slti s2 a0 -1114
-slli s5 s11 25
-slti s5 gp -1066
-sra a6 s9 t2
-slt s10 gp s2
-slli t4 s5 6
-addi t4 t0 -1097
-divu a3 gp s9
-ori s4 s2 -644
-xor t6 a2 a2
-sll s0 x0 t5
-addi s7 a4 -1885
-srai x0 a4 0
-auipc ra 733607
-div s10 t6 a6
-and ra a2 a6
-div s2 gp s10
-mulhsu s8 s11 s6
-sra s11 s9 tp
-mulhu s9 s7 a6
-mulh s4 s7 s0
-sra tp s3 s4
-mulh s7 s10 a4
-srai t6 t6 24
-add a0 a6 x0
-div s7 t0 t4
-srli x0 a6 15
-srli s5 s5 15
-sltiu x0 s1 675
-sltu s0 a2 s4
-sra a1 a4 a2
-xori x0 x0 -420
-mulh s7 s6 a3
-slti s7 t4 -2005
-sub a1 s9 tp
-srl t1 ra s4
-slli a2 t4 14
-lui t6 677228
-sub t2 s2 s11
-add tp a4 x0
-slt s0 a7 t4
-srli ra x0 26
-xori t3 x0 -2036
-slti s2 a7 -641
-slt s8 a1 s4
-srai t0 ra 10
-div s9 t3 a6
-addi s6 s7 -1450
-lui a6 1018880
-xor tp a3 a2
-mulhsu t4 s4 t5
-or t2 a0 s1
-sub a2 t6 a0
-sltu s4 t0 s3
-or s2 s7 s8
-div x0 a3 s5
-mulhsu t5 a7 a1
-slli s2 a6 31
-lui a3 448785
-xori t2 s4 -1937
-div t3 a1 s11
-sltu a6 s1 s4
-sra x0 tp s5
-sll tp t6 a7
-add s0 ra s7
-addi t1 s5 -1414
-remu gp s10 s7
-sltu a3 t5 s10
-xori a7 a7 500
-xor t2 x0 s5
-mulh s10 s5 s10
-srl t0 gp s10
-sltu s11 t0 t1
-srai s7 t5 8
-lui tp 296892
-srl a2 t4 a4
-srai t3 ra 30
-slli t6 t3 11
-mulh s5 x0 t3
-sltiu s11 t4 -174
-lui a0 310523
-xor ra s6 x0
-and s1 t1 s8
-ori s6 gp -201
-sll s4 a0 tp
-rem x0 s9 s4
-and ra a2 t0
-rem gp s10 s10
-mulhsu t1 s7 x0
-sll s8 s10 a1
-sra a0 s7 s9
-ori t1 x0 306
-sra a1 x0 x0
-mulhu s2 a1 s10
-addi t1 a4 -1787
-div a5 ra s5
-remu s5 s1 tp
-div a0 s5 a1
-rem a7 t3 s6
-sub t1 x0 s6
-sub t5 x0 s11
-mulhsu s2 s4 s2
-rem a0 a0 a0
-srl t0 a0 s1
-addi s1 gp -145
-lui a1 648806
-remu t2 t3 s6
-sub s10 a2 s9
-sll t4 t1 t4
-sra ra s1 s4
-or t1 s10 t5
-mulh s2 s10 s5
-or t5 s9 s3
-remu gp a4 s5
-ori s11 s8 -415
-slt ra s1 s10
-sltu ra a5 s3
-mul gp t3 s7
-slt tp a6 gp
-slt s1 s6 a6
-lui s7 504257
-mulhu a3 s5 a4
-srl s10 s11 a4
-mulhu t0 a1 s11
-mulh x0 t5 a6
-srl a0 s11 gp
-sll s1 t6 s9
-add a0 s0 t3
-srai s1 s2 31
-mulhu s10 a6 tp
-auipc a7 806976
-sra s0 a3 t1
-slti s9 tp -928
-mul t4 s4 tp
-lui s7 423478
-div t0 a7 s8
-sub s1 gp t2
-mulhu s4 x0 a5
-add s7 a0 s7
-mulhu a4 ra s6
-srai s7 a7 12
-mulhsu t1 s4 a6
-remu s11 s5 gp
-slli s0 x0 21
-mulhsu x0 s10 x0
-slti tp a3 683
-sra a0 s4 s5
-add a5 t3 a6
-mul x0 t3 a7
-mulh a5 a5 s1
-xori a5 a0 -1828
-mulhsu t3 a5 ra
-sub s5 s3 s9
-srai a6 s2 26
-add t5 a4 s3
-andi a6 s6 -710
-andi s3 s1 1776
-remu gp t5 t3
-and s9 s9 t2
-ori s2 x0 -1562
-mulhu t3 a4 t3
-add s7 s5 x0
-remu s10 s7 s6
-div t6 ra a3
-rem s4 t3 a6
-sra a7 x0 tp
-slt a2 s7 s4
-mul gp a5 ra
-sltu t3 x0 s1
-xori s5 s3 1486
-srai s0 tp 13
-remu x0 x0 s6
-andi x0 s1 1156
-xor s8 t3 t5
-or gp s3 t2
-srai s0 a4 12
-xori t0 a1 -1561
-sub s6 s11 ra
-srli a7 x0 10
-addi s8 a3 -1773
-rem a2 a5 a6
-lui s6 84324
-mul t2 t5 s0
-ori a1 t2 525
-sll s4 s11 s7
-mulh t3 s4 s8
-or x0 tp s3
-remu t2 s7 a4
-mulh s11 t4 t3
-slti s2 s11 -1208
-rem t1 t0 a3
-srai s8 s0 6
-srli t2 s11 14
-remu x0 a4 a0
-sra s7 t1 t1
-mulh s3 ra t0
-slli s9 t4 17
-slt s11 t6 s8
-or s10 t3 t5
-lui x0 800276
-divu s8 t5 a0
-slti t2 s1 -1286
-srai t6 s10 25
-mulhu s3 s9 s2
-sll tp s5 a6
-mulh t6 a2 t3
-slli s1 t1 2
-srl t3 a7 t4
-remu t6 a4 s1
-or t4 a7 t3
-sll a5 t5 t1
-sltu s1 s6 t1
-slli t0 s6 27
-ori a2 s11 -919
-sll s2 s6 s1
-divu t5 t2 a0
-auipc gp 62921
-sltiu t3 s8 -1901
-xori a3 x0 -1896
-mulhsu a7 t5 a7
-lui s1 713245
-sub a3 s8 a1
-remu a1 a2 s2
-slt s7 t5 s8
-srli gp s6 31
-xori t6 t2 -937
-sll s0 tp s4
-mulh a7 a1 tp
-rem x0 x0 a0
-xori s3 s1 -794
-divu t5 s9 t6
-sltiu a3 a0 -541
-divu s1 s7 s10
-sra t4 t2 t3
-mulhsu gp s1 s5
-rem s4 s2 a1
-sra s5 gp a7
-sra s11 a5 t0
-and a4 a5 t5
-auipc a6 676743
-sltu s6 a6 a5
-add x0 x0 x0
-rem t6 s9 a0
-sub s0 a6 s7
-sll t2 a0 s11
-slli a6 s6 25
-slti t2 t4 -1040
-rem s6 t6 s0
-mulh s10 a7 x0
-srai a2 s9 5
-sub s5 s10 t3
-div s8 s10 t2
-rem a4 t5 tp
-addi x0 s11 -575
-sll a3 a6 s4
-slli s11 a0 21
-auipc s6 470689
-slti t3 s0 -1674
-srai t5 t0 20
-mul a3 t3 a4
-slli x0 s3 6
-divu s0 x0 a0
-ori a2 a0 -913
-divu s0 t2 s11
-ori t4 s10 905
-lui tp 659173
-mulhsu s8 a6 t2
-srli s3 s9 13
-sub s0 s0 t3
-rem a2 x0 a6
-mulhu a0 gp t5
-andi s2 t5 -767
-sub s10 s3 a6
-andi a0 s11 -919
-sra t5 s9 s8
-add t6 s7 a7
-addi s11 t3 -633
-sltu x0 a1 t6
-xor s8 t5 s2
-or a3 a2 s5
-sub s9 x0 s4
-srli s11 a5 0
-slti s6 gp -1684
-sll s11 x0 t0
-srai s11 t0 9
-mulhu s0 s5 ra
-sub s10 t4 s5
-srl a6 x0 t3
-mulhu s8 a3 a3
-auipc s10 567278
-xori a3 s0 1314
-andi a0 t0 -1794
-remu t5 tp s5
-auipc a1 1002372
-srli t0 t5 17
-mulhu t0 t6 s6
-rem t6 t1 x0
-srai x0 s7 9
-addi t3 t2 -379
-slli t3 s4 21
-lui a4 654069
-remu s6 a1 tp
-mulh a3 ra s3
-sub x0 s10 s3
-and a5 t2 s8
-sltiu t2 t1 -308
-slli t2 t2 11
-lui t4 432428
-mul x0 a7 t6
-mulhsu x0 t5 a2
-srli s9 s9 23
-ori tp tp -1591
-rem s6 tp a4
-add s11 a2 a6
-and ra t6 a0
-mulh s4 t3 x0
-andi s9 gp -667
-sra x0 x0 s11
-slti a5 s6 -1968
-ori t2 gp -11
-lui s6 61197
-srl s5 s4 a2
-addi a0 t1 1017
-srai t1 s6 5
-sra a4 a2 a5
-sub a6 a6 x0
-xori s7 s7 -744
-mulhu s4 a1 t2
-mul s1 a1 s7
-slt ra s5 x0
-and s6 t1 t3
-mul a3 s10 s0
-add a5 t0 t1
-srl s7 t0 t2
-auipc a2 643858
-mulhsu s0 ra t6
-rem t6 a7 a1
-srai t4 a0 15
-remu s9 s3 s7
-mul a3 s3 s4
-srai s0 a4 7
-lui t6 944255
-slti s0 a6 2036
-add s6 t2 s7
-add t2 s10 x0
-slli s7 s6 10
-sra x0 x0 a3
-sltu t6 x0 s4
-and s11 x0 s5
-slti x0 s4 29
-mulhsu a2 t6 t3
-mul s6 t5 tp
-slt s9 s3 a3
-srl t3 s1 s6
-srl x0 s8 x0
-sltiu s8 s10 -1044
-andi s9 t2 -1984
-sltiu t0 t4 -298
-xor a0 s4 tp
-rem s1 a6 a4
-sltiu s8 s2 2045
-and gp s1 a5
-xori s2 t6 -1878
-or a7 s2 t4
-ori s11 a3 -1149
-srli a7 a2 20
-sll gp t3 a3
-xori t5 s0 -1921
-rem a6 a0 t4
-xori s6 a5 1798
-addi t4 s4 -638
-slti s5 tp -484
-slti t6 t2 60
-div tp x0 s1
-mul s6 s10 s4
-sll x0 t2 t6
-mulh t4 s11 s10
-slt t0 a0 s2
-rem s9 a5 s10
-xori a0 t4 -1408
-or a2 a5 s7
-mulh s2 s7 x0
-sra s6 tp t1
-slli t4 x0 9
-sra s5 x0 s4
-slti x0 a0 -939
-sltu t0 t3 x0
-mulhu x0 t4 tp
-sra t3 s4 s6
-mulh t0 s3 a0
-divu tp t0 t2
-addi s10 t5 996
-auipc a4 799226
-srl s1 gp s5
-divu t5 a5 a5
-mul s1 a1 t5
-sub s4 t2 gp
-and a6 gp a5
-sltu t1 t0 a7
-remu s5 a1 a7
-div s8 s7 ra
-and a6 a2 s5
-srl s6 s5 s0
-lui a0 228810
-mulhsu gp s10 s2
-addi a5 s11 -1224
-srli s8 t6 21
-auipc s7 826558
-auipc t4 274832
-lui tp 207490
-xor a4 x0 t6
-rem t2 s0 a4
-ori a7 gp 509
-remu t5 a2 s0
-srli a1 s0 21
-remu x0 s6 s9
-xor s4 s2 a4
-mulhsu a3 a5 t2
-mulhu t1 x0 s2
-mul s10 s2 a6
-slt s7 a0 s7
-srl x0 a0 t3
-slti s2 s1 1014
-ori s6 s9 385
-andi x0 a4 -1879
-mulhu t5 s10 ra
-srli t0 t1 8
-xor a4 t3 s6
-mulhsu s6 a1 tp
-addi s8 a5 -1634
-mulhu t6 t3 s7
-divu t5 t4 x0
-srl s6 a6 s10
-xori s4 ra -953
-andi t0 a4 1117
-mulhsu s9 s1 s2
-srl ra t0 ra
-sltu s4 t1 a1
-andi s3 s1 736
-addi a7 t0 -1644
-auipc a0 1002032
-sltu gp ra t5
-srl t1 x0 s8
-addi a4 s11 -1930
-andi s11 s2 -110
-mulhu s4 t6 t2
-mulh gp s1 t5
-slli a0 t3 24
-mulhsu a7 s4 s11
-sltu s7 a2 s2
-sub s2 s7 t2
-mulhsu t2 a6 s1
-mulhu t4 a4 a2
-xor s5 t5 t4
-mulhsu s9 t6 a4
-slt a3 a2 s3
-rem s6 t3 x0
-xori t2 t3 -1905
-lui t5 225114
-xor s1 x0 a3
-srai s8 ra 3
-or s10 gp a1
-mulhsu gp s2 s5
-slli t0 a4 25
-slli tp a7 8
-slli s7 s4 30
-and a4 s10 t6
-mulhsu s1 t6 a6
-slt ra gp s5
-sub a5 a3 s7
-sra t5 s6 s8
-slti a5 s1 -1519
-srai t6 s9 7
-and s4 gp a6
-mulhsu x0 a5 a5
-xor s10 t5 a3
-mulh s7 t4 a2
-xor t4 tp s10
-xori s5 a7 -815
-xori tp x0 -169
-slti t3 t0 -1913
-addi s8 t1 -624
-add s6 ra a3
-add a5 s6 tp
-slli t0 s7 14
-lui ra 363443
-add a2 s5 s9
-sub t2 s7 t3
-mulh s5 s11 t6
-addi t0 s9 -1166
-sltu t5 t1 s5
-remu t1 t5 s0
-ori t3 ra 1529
-auipc a6 838415
-addi tp s10 -343
-xori a7 a4 348
-slli a1 tp 17
-mulhsu t4 t5 t2
-andi s0 s11 1949
-xori t3 s2 417
-rem s6 a7 ra
-auipc s11 669490
-mulhu a6 a7 s2
-sra t5 t1 s4
-divu s1 s10 s6
-remu s1 s6 s10
-addi a0 a7 -1842
-sltiu x0 x0 2032
-slti a4 a5 -1014
-and gp t0 a5
-rem gp ra s4
-sltu gp a6 a5
-divu a4 a0 a3
-and t1 a0 t5
-sub s8 t3 t3
-addi t6 s5 1555
-lui a6 430605
-lui t5 309041
-sltu t6 s2 a1
-xori tp s11 -1493
-auipc a2 501540
-mul s1 ra a3
-slti t1 s0 982
-sltiu t2 s6 -907
-sltiu s3 s10 57
-sltiu a2 x0 -1222
-lui a7 773380
-lui s6 127437
-xori s9 t3 -1886
-mulh t0 t3 a7
-and t4 s9 ra
-xor gp t1 s7
-mulh s10 t6 s4
-sub s6 s9 a7
-srl ra a3 x0
-sll s1 a3 a2
-and a4 s5 t5
-div s11 a0 s5
-srli a4 ra 17
-mulh s8 a2 t5
-mulhu t6 gp s0
-divu ra ra s4
-addi s10 t2 -75
-sub t5 s0 a4
-mulhu a1 s6 gp
-div s11 s4 t5
-sltiu t6 a5 293
-sll a5 x0 a7
-rem tp s4 gp
-slt s7 a4 x0
-auipc s10 694384
-div a0 s2 a5
-divu x0 a1 s7
-mul s10 t4 t6
-slt x0 s5 s5
-sra a5 t2 a4
-srli gp t1 10
-remu x0 tp tp
-and a1 a4 t1
-xori ra s7 -1773
-and s0 x0 s9
-remu t4 s9 gp
-sub t3 s3 s7
-xori s11 a3 822
-addi a2 a2 1146
-xori t6 tp 220
-lui s8 951596
-xori a6 a5 -1767
-srl s4 s7 a3
-or x0 t1 t6
-mul s11 s6 a7
-slt s2 ra x0
-srli a7 s8 29
-divu x0 s4 gp
-slt t6 a5 s0
-ori t4 s4 533
-xor a6 s5 s8
-divu s4 t4 t2
-sll t3 s3 t4
-slt t3 t2 x0
-andi gp t5 -1003
-sub s5 a5 s9
-rem s2 s4 s3
-slti t0 s9 -670
-sra s0 a4 a2
-slt s5 s7 s0
-rem t0 t4 a0
-add s11 t5 gp
-mulhsu s11 a5 s1
-xori a4 t6 -1104
-mulhsu s11 t5 t0
-ori t4 a6 -216
-sub t1 t2 a5
-ori s6 a6 -170
-slt s3 t6 a3
-mul a6 a6 tp
-div s2 s10 x0
-ori a1 ra 689
-or gp a1 s11
-sll a6 t1 a2
-srai s11 t2 17
-div s9 s6 s11
-sub s5 gp s2
-srl ra a3 t4
-slli a2 s6 0
-mulhsu gp s6 t5
-srl s11 gp a2
-mul t0 x0 a3
-mulh x0 t3 x0
-or s4 tp s9
-lui s11 323774
-slt s3 tp t3
-lui s7 323719
-or s1 s10 s6
-mul a2 a4 s7
-addi t2 ra 237
-mulh s6 s1 s3
-divu gp a1 s10
-mulhsu t3 s4 x0
-srl t2 a1 x0
-mulh s2 a5 s11
-sltiu s11 s9 -1851
-sra s8 t3 t3
-slli s0 t6 25
-addi s9 gp -1991
-srai tp t4 31
-mulhsu s0 s1 t6
-ori s2 s1 -1888
-xor x0 a0 tp
-xori t4 t0 -1842
-rem t2 s4 a5
-sll s2 s3 x0
-andi tp a6 -1218
-slti x0 t5 -1210
-mulh a1 s11 s5
-ori s6 s2 -759
-xori s5 a2 -322
-mulhu t5 a3 a6
-sltiu a4 s3 1362
-sltu s5 s3 gp
-sltu s8 t0 t0
-divu s8 a6 tp
-rem s0 t0 tp
-andi a5 tp -120
-xori a5 a2 -1958
-or s1 s9 a2
-rem s7 tp a4
-sll a6 s2 t0
-ori t5 t1 -1677
-srai a2 tp 5
-add a2 s11 t4
-lui s8 650793
-sltiu s5 a4 1973
-srl ra s0 s0
-srli a4 gp 11
-and a5 gp s7
-slt t3 gp s9
-and s3 s4 s4
-sltiu x0 s3 -951
-sltiu gp ra -511
-sub s9 ra x0
-xor a2 a3 a5
-or a3 s0 a0
-xor t4 a6 s5
-srai s6 tp 30
-lui x0 461878
-sub t5 s1 s7
-add s5 x0 tp
-add s0 s11 x0
-lui gp 637263
-divu s7 a0 a0
-srl a2 s4 gp
-sltu s9 a2 t5
-sll t1 x0 a5
-xor a5 s4 t2
-or s1 s8 x0
-xori ra s6 -455
-srai s3 s2 8
-mulhsu a3 t5 s0
-addi t0 s0 -208
-srl a6 s3 s3
-srl a4 s11 gp
-sra a1 s6 t6
-remu s1 t5 s11
-divu t5 s3 a5
-mul s4 a5 s7
-auipc t3 860779
-mulhu s11 tp s11
-sltiu s0 a6 -1858
-slli s11 a2 17
-remu a2 a5 a6
-sltiu t1 t4 427
-srai x0 x0 9
-rem s0 t2 gp
-slt ra s11 gp
-slt s5 t6 a0
-mulhsu a3 a4 a4
-mulhu a0 s6 t5
-or t3 t5 a1
-xori s1 s3 -1014
-srli a5 s0 7
-slti s2 t5 -214
-slt a4 t2 tp
-sltiu a2 t0 660
-andi a5 a7 -121
-andi s0 s8 -1622
-sltiu t3 s5 -720
-ori t1 a2 335
-ori t1 a3 -1791
-addi t5 gp -1888
-mul t3 s7 t3
-auipc tp 288210
-xori s8 s5 550
-sub a7 s7 a2
-sub s7 s3 a1
-xori a6 ra 1503
-andi s11 tp -1858
-sub s8 s10 x0
-xori s11 s0 795
-ori tp t6 -659
-sltiu t1 t6 -1469
-divu a4 s7 s0
-auipc s2 544336
-rem tp a1 ra
-mul a7 ra a2
-sltu s5 t4 t4
-and t2 s9 a3
-mulh a0 s3 t4
-sltiu a4 s11 -1118
-sub s2 x0 s10
-remu s1 s11 a6
-slli t1 a4 25
-sltiu s11 a2 576
-divu a4 s0 t3
-slt s0 tp x0
-sltiu t1 t0 -395
-or s0 s7 x0
-ori t5 t4 -1719
-divu x0 gp s0
-add s11 t6 a0
-srli t3 s5 28
-addi s6 s1 -898
-srai s1 s0 26
-add a4 s10 s2
-mulhu s11 t5 s3
-ori a5 t1 -1965
-and s8 tp s8
-add s2 x0 s6
-or t4 s7 s1
-or s1 a2 t3
-sub a7 s7 s2
-div t1 tp x0
-addi s6 t2 -1138
-srli s9 t3 24
-auipc s9 501952
-xori t3 t1 1362
-rem s10 t5 t5
-divu x0 s6 s4
-ori a2 s3 -315
-slli a0 s11 17
-slti t6 a2 1233
-srai t2 t2 24
-xor s10 s2 s0
-and a0 a5 t6
-rem a7 ra a4
-sll s9 a1 s9
-auipc s0 405538
-rem x0 t2 a7
-mulhsu t2 s6 a7
-xori a2 s4 1192
-mulhu t0 s4 s10
-sltiu s10 a1 -1174
-srai t2 a6 20
-divu s10 t0 s6
-mulhsu tp a4 ra
-slt t4 s8 x0
-rem ra t3 t4
-xor x0 x0 t1
-and t2 s1 s3
-auipc tp 797564
-xori s11 s0 793
-mulhu s0 s10 a0
-rem a6 a5 s11
-mulhsu s5 s11 s6
-div s10 a5 a0
-div t3 tp s11
-sltiu tp s7 -1955
-sub s7 t3 ra
-sra s6 a4 s7
-divu s5 t4 a0
-srai x0 a3 30
-addi s1 s11 -1567
-lui s5 297014
-sltu s7 s5 t6
-mulh s6 t2 t0
-sra s5 t4 a0
-slti s6 a0 -1577
-sll s2 t1 a0
-slli t4 s6 30
-sltu a5 a2 t4
-slti s1 a0 -108
-srl s5 a1 a3
-mulhu s11 s0 s9
-slli ra t2 12
-remu s4 s11 a5
-sll x0 a5 s9
-add s3 s8 s2
-srai s7 t3 16
-mulh s8 t5 s5
-sub t5 s11 t5
-mulhu x0 s4 s1
-sll s2 s7 s10
-sltiu x0 s7 896
-slt s11 s11 s6
-or a2 x0 s10
-andi s5 s10 -1053
-srl t6 t0 gp
-andi a0 t1 -525
-sll s0 s5 s1
-addi x0 ra -1255
-mulhsu a0 s1 a7
-slli tp ra 8
-mul t1 s9 s5
-srli a2 s1 10
-mul a1 s11 s7
-rem a6 s10 a4
-andi a5 ra -451
-slli t1 s2 7
-sltiu s1 s9 -877
-remu s9 ra s10
-slt s6 t3 a1
-xori ra x0 -328
-mulh s8 s1 s7
-slt s1 s10 s11
-and a6 s7 t4
-slli s0 a4 7
-xori a5 t0 -111
-sra ra t2 t6
-mulh s5 x0 s3
-ori a5 a4 -1641
-or s6 t0 s4
-sltiu ra s5 2023
-slti a1 a5 -1052
-div t3 t0 x0
-auipc s5 44031
-sltiu s4 a6 -1263
-auipc a7 750425
-slt a2 s3 a0
-and a0 t3 s4
-mulhsu a0 t1 a3
-slt a2 a4 s5
-mulh s10 s9 s2
-sub s0 s9 a4
-srl s0 s1 a5
-mul a5 s3 a1
-srai t5 s1 15
-sra s10 t3 a5
-srli a5 x0 8
-sltiu s10 t6 -894
-sra s3 a3 s2
-lui t4 601617
-mul t5 t1 a5
-slli a4 gp 30
-xori a6 tp -513
-sltiu s6 tp -631
-sub t2 t5 t4
-add a6 a2 ra
-sltiu s11 a0 -1027
-srli s4 s5 6
-andi a5 s1 -646
-rem s7 s8 s0
-mulh a0 a5 s2
-div t2 t6 s10
-divu a3 s9 s5
-and s10 s0 s3
-sltiu s8 s2 -958
-andi t1 a5 -1612
-srai s0 t3 25
-divu s3 a7 s3
-slti s4 t3 -462
-xor t2 t4 x0
-sltu t5 a6 s5
-rem gp t0 t0
-mulh s3 s3 s9
-ori x0 s1 -1144
-xori t4 t6 -1628
-mul tp s3 tp
-xor s9 a0 t1
-ori a5 s4 -380
-slt a2 s11 a0
-slli x0 s5 23
-andi a3 t4 -2025
-or a0 s9 t5
-auipc s0 175255
-divu a0 gp s7
-srai s3 t4 12
-and t4 s7 s8
-and s3 s6 tp
-xori t3 s6 730
-mul tp s1 s10
-srli tp ra 30
-auipc a4 852887
-lui a2 311256
-add t3 s4 a5
-ori a7 t6 -292
-andi a2 x0 1356
-and t2 x0 s7
-xor s7 s4 s8
-srli s8 x0 9
-srli s8 s7 29
-sra s0 t1 s3
-lui gp 985868
-srai s6 gp 28
-add s0 s3 s5
-sub t3 a0 x0
-rem t2 s0 s8
-remu a4 t5 a0
-mulhsu s1 gp tp
-slli s9 s10 14
-sub tp a7 s2
-rem s4 t5 x0
-remu t3 s0 t2
-ori ra t6 -1387
-mulhu x0 a6 a1
-sltu s8 s11 t2
-remu s11 s2 a6
-srl s9 gp a4
-mulhsu s8 t3 s11
-addi s7 a6 -1120
-or s9 s0 s11
-div t5 t6 t4
-auipc a2 220798
-slli s10 t1 31
-andi s7 t5 -405
-addi tp s5 1597
-sra x0 s8 a5
-srl s1 s8 a6
-and t6 t0 a1
-add a4 x0 s10
-srl a4 s6 s11
-divu a7 a4 a5
-xori a5 s11 1732
-divu gp s6 t0
-srai a0 t2 20
-xor t1 t2 tp
-sub a5 a1 t1
-sltu s0 s3 a1
-addi ra s8 -1420
-or s2 t3 s1
-div s2 a2 s5
-andi s4 t6 1405
-mul a1 gp a0
-mulhsu s10 t3 t4
-addi a2 a7 -1354
-mulhsu a6 s7 x0
-andi x0 a5 -966
-sltiu t2 s8 448
-mul s8 s10 tp
-and s4 t2 a2
-remu s7 s8 t0
-and s8 s0 t1
-slti s0 a4 -2006
-srl s8 s9 s3
-or s7 ra s5
-lui a2 301422
-xor s6 t0 s2
-mul s1 gp t1
-mulh t3 s6 t1
-or a0 s7 x0
-srl s1 ra ra
-xori gp s1 526
-srli ra t1 0
-srl x0 s10 t5
-mulh gp a2 s0
-remu a1 t2 a1
-sltiu t4 s10 440
-addi s1 t0 -1542
-lui s6 230486
-sra t0 t3 a6
-slli t3 a7 4
-remu s5 x0 s7
-ori a3 ra 917
-rem t5 t3 t0
-sub t5 s3 s8
-auipc a7 869162
-slti t3 a2 1386
-andi s10 s7 -737
-slti ra s6 -1925
-srai t4 a1 18
-addi t0 x0 -1989
-andi s2 t6 -322
-mulhsu gp s1 s10
-and a0 s7 a6
-xori s1 t2 -18
-remu t6 t1 s1
-andi s6 s8 -346
-sub t6 t4 s0
-mul s5 s10 x0
-ori t2 t6 -636
-andi a4 a4 -873
-slli a3 s11 7
-rem a2 a7 tp
-ori x0 t2 -1295
-addi t1 s4 6
-or a5 s9 s2
-xor s1 x0 x0
-srai s7 ra 3
-mul s5 x0 s2
-remu s4 gp x0
-sll a5 s2 t4
-mulhsu a6 a2 s6
-lui s10 590534
-slti gp a3 -1589
-addi s3 t3 1916
-add t1 a0 x0
-lui s2 722889
-div t2 t1 s2
-slt a0 ra s1
-srli a0 x0 14
-srl a1 s0 s0
-srl t5 a7 s11
-xor t2 a4 a5
-sub t1 s5 x0
-rem a2 s7 a6
-sll a2 a2 s11
-andi t0 a2 -1154
-and s2 t3 a0
-sll t0 s0 gp
-mul s7 x0 s11
-remu s5 s9 t6
-sra t2 tp a7
-slti a6 a7 -335
-auipc s10 1000039
-xor x0 x0 s1
-andi a4 a6 2029
-ori s2 s5 1254
-sll x0 s1 s5
-mulhu s1 s7 s10
-sub s0 s4 gp
-rem s1 s0 a2
-sltu s9 a0 tp
-auipc t3 135066
-mul s5 gp t5
-div t0 t1 a3
-sub t1 s1 t4
-and a2 t6 s0
-or gp x0 a1
-div t0 s11 x0
-lui s9 285361
-andi a4 t4 -1290
-ori a2 s11 1692
-slti s9 x0 428
-sltu s8 s6 s11
-sra t2 ra t4
-mulhsu t0 s2 s9
-xori s3 a3 -173
-sltiu s3 t2 -1277
-slli s9 t2 17
-sltu tp s1 a2
-add a0 a7 s6
-and x0 s0 tp
-remu a1 x0 x0
-remu ra gp gp
-xori s11 s0 -1722
-addi s6 x0 -802
-sll s2 s9 s7
-ori a4 a2 -67
-auipc x0 301004
-divu x0 x0 s8
-and a1 t0 t6
-srl t6 s10 s9
-slli s7 s9 4
-add a0 ra t5
-rem a7 a3 t6
-andi t3 s5 -186
-slt s7 s8 a6
-sub a2 s3 s9
-andi s4 a2 -991
-sltu tp s5 x0
-andi s7 t6 -359
-srl a7 a0 t6
-slli x0 x0 13
-mulh s6 s4 t2
-sltiu s10 a0 -2031
-slli ra t0 0
-xor tp x0 a1
-andi a4 t1 -884
-mulhsu s1 t1 s6
-and a6 t6 t1
-mulhu a3 s1 t4
-ori ra a4 66
-sra tp a5 s6
-and ra a4 a5
-mulhu t6 s2 a1
-and x0 a0 a6
-lui a4 43337
-div a0 a4 t1
-mulhsu t6 s10 a6
-sll tp ra s4
-mulhsu s1 a3 a2
-xori a2 s4 1457
-sltiu tp s11 171
-sub t0 x0 t0
-rem a5 a1 s2
-mulh s11 t1 s4
-slli a2 x0 14
-remu t6 a5 s8
-remu a3 x0 a6
-mulhu tp a1 s9
-auipc s6 195164
-mulhsu a6 a6 t5
-mulhsu t3 a3 s0
-mul s7 t1 t4
-slt s2 s5 s9
-mulhsu s4 t0 a7
-rem s0 a6 a0
-sra tp s3 s11
-rem s9 t2 t2
-addi t6 s1 -1144
-mulhu gp a6 s7
-sll a1 t6 s5
-srli a4 x0 31
-srl t5 s8 a3
-add a0 s6 tp
-or x0 s8 t5
-slli gp s5 17
-mulhu s5 a6 t4
-mulhsu s9 s9 s9
-mulhu s1 s0 s7
-xori a2 a5 -985
-sltu t2 tp t4
-srai s9 tp 11
-mul a4 s8 s6
-slli x0 s11 17
-auipc a0 148691
-and s3 t1 x0
-add t1 s6 s8
-slli gp s6 31
-sltiu s7 s4 1069
-mulhu s7 t4 s8
-slti a4 t0 -550
-xori t4 s0 -765
-and s11 a2 a3
-divu t6 a0 a2
-addi a1 s2 -840
-mulhu s5 t4 s8
-sra s9 ra s11
-div a5 s4 a1
-slli s6 t0 28
-sltiu s0 s4 -347
-srai a7 s0 20
-mulh x0 a4 x0
-xor a6 a1 s3
-mulhu s8 s5 s2
-sltu x0 x0 s10
-slti gp x0 463
-ori t0 s4 791
-srl a6 s4 s5
-and x0 a4 s9
-sltiu s10 s1 -570
-sub s2 ra tp
-divu s8 s7 x0
-lui s3 200458
-srli s4 s5 27
-andi s2 s0 -1183
-lui s11 171962
-divu t0 a5 gp
-sra gp a7 t0
-xor s3 t5 a5
-xori t5 x0 -1104
-mulh a3 gp t6
-srai s6 a2 2
-mulhu t1 a6 t1
-lui a6 918624
-add a7 gp gp
-xor s9 s5 a1
-mulhsu a4 s7 tp
-sltu s11 s10 t5
-slli a3 s2 26
-srai s10 s6 4
-mulhu a0 s0 t4
-xori tp s6 -661
-div s3 a2 t2
-srl t3 a2 s6
-div a3 gp t1
-srai a2 s0 11
-sltu s6 s1 tp
-srai a7 x0 3
-ori x0 a3 -1763
-auipc s4 493517
-sra x0 s2 a7
-sltiu t6 s0 56
-mulhsu a4 tp a4
-andi a1 s9 -198
-and t6 tp a2
-srli s6 t2 7
-rem a2 a1 s9
-auipc s5 153819
-andi ra gp -497
-addi s3 a2 -602
-remu a0 s0 t1
-sltiu s8 tp 718
-and s3 t3 s10
-sltiu s3 ra -611
-rem s10 t5 s0
-slli s10 s10 28
-sll s8 t0 t1
-srli s8 a1 12
-rem s1 s6 a4
-srl a0 a7 a4
-or a1 a3 a6
-add tp a7 t4
-sltu a0 s11 t5
-sll a1 s6 s2
-sll a6 t4 a7
-mulhu t1 s7 s9
-lui ra 881056
-or t1 s2 s5
-mulhu t0 a0 s11
-slli a5 t3 29
-ori a2 a2 -568
-xori s1 a5 -487
-mul t0 s5 s0
-or s9 s0 s9
-xor ra gp s1
-srai s8 x0 30
-ori t3 ra 1813
-sltu a7 t3 s2
-lui a5 696160
-srai a3 t0 18
-slti a3 a1 1469
-addi gp t6 -2016
-ori t4 a7 -134
-divu s5 t0 t2
-auipc t0 961895
-mulhsu s1 a7 tp
-sll s4 s4 s2
-slli a3 t1 26
-mulhsu s7 s7 s0
-sll t0 a0 t2
-srli s2 gp 23
-srai a5 a4 17
-sltu s7 t6 t2
-slti s4 gp -343
-srl x0 t0 s4
-div s1 s9 a0
-sra gp a1 s9
-sltu t3 s7 a5
-xori s6 s4 728
-rem s11 s0 a1
-mulh t6 t3 tp
-sub gp t0 a6
-rem s5 s1 t0
-remu a3 a4 a2
-xor a2 s6 t6
-remu t6 a0 ra
-mul t0 t5 a2
-sltu s5 s10 t5
-add s0 s3 t0
-mulh s0 x0 t0
-sll a2 a7 t2
-slti a2 t6 -136
-sltiu s2 tp -1477
-andi s11 s4 -967
-srl a3 s3 x0
-sub t5 s0 s1
-sra ra s8 s5
-auipc t4 536357
-or s8 a4 s7
-mulh a5 ra a1
-sra s10 s6 a7
-add a0 x0 s6
-lui t3 713961
-rem a0 s9 s5
-slti x0 s11 -629
-remu a3 t2 s10
-mulhu s0 s6 s8
-remu a2 t2 a7
-add s3 x0 s1
-slti a0 t3 673
-mulhu s10 gp a6
-sra x0 a7 a5
-rem t1 a1 tp
-ori a5 t0 -1116
-mul s6 t2 tp
-mulhsu s6 t3 s5
-or t0 a6 ra
-div x0 a2 t5
-auipc s4 814121
-mulhu s8 t5 a7
-andi x0 a1 -1037
-remu s7 t1 ra
-sub a5 a6 t3
-div s10 a6 gp
-sra s0 tp s10
-srli a3 s5 26
-sub a3 t2 s11
-andi t0 t0 -982
-remu t2 s11 x0
-mulhu a1 t2 t1
-mulhu a4 s1 s2
-slli x0 a6 20
-addi s2 s0 1439
-addi tp ra -814
-slt s10 ra gp
-auipc x0 877401
-div t3 s2 s0
-srai a2 s10 19
-xor a5 s10 t4
-slli t5 s7 31
-ori s0 a6 -704
-slli x0 tp 5
-divu s8 s11 s2
-add s10 t2 ra
-andi s0 gp -90
-mulh a2 gp s2
-mulhu t3 t3 x0
-sltiu tp a7 -1656
-sltiu t1 x0 639
-xor s10 a1 a5
-ori t1 a1 -1914
-ori t5 x0 -455
-divu t3 tp s3
-add t6 a6 a1
-and s7 a5 t1
-rem t1 a5 t5
-lui a1 88299
-remu t5 a0 t6
-srai s2 t6 29
-srl s6 x0 s3
-lui t2 50667
-srai s2 x0 8
-sub s7 t2 s11
-lui a1 946554
-mul x0 a1 a7
-sra a0 ra t2
-addi x0 s0 -1459
-xor tp a4 s0
-srl a5 t1 s8
-sub t2 s7 tp
-srai tp s10 11
-sltiu s5 s9 460
-sltiu a3 t0 334
-or tp s10 gp
-remu s7 s10 ra
-slti ra s4 -1569
-xori s4 s9 -161
-and s2 s5 a5
-mulh t6 gp t1
-andi t1 a6 862
-andi s11 t6 341
-xori a2 s10 -1414
-sltiu t1 s8 -650
-add a6 t1 s7
-addi tp s10 524
-sltiu x0 t3 271
-sra a3 s10 s8
-div ra s7 x0
-slti s4 ra -1842
-divu a5 t6 t5
-mul s6 s1 t1
-ori s0 s10 398
-add ra t1 s2
-addi s5 s1 -855
-xori t2 a2 -1352
-xor s7 t2 s7
-sub a2 s4 a1
-srl t1 s11 a0
-andi ra s5 -290
-div s9 s2 t5
-xor x0 a1 s10
-divu s1 a1 t2
-slli x0 ra 0
-xor t3 s10 s4
-div a3 s7 s8
-div t6 s3 t4
-sll t0 tp a6
-xor a1 s1 s9
-div t3 s10 gp
+divu s9 a0 ra
+slt t5 t6 s11
+sub a6 t2 a3
+sra x0 s10 t2
+sltiu t0 s0 -97
+sra a3 s5 a6
+remu t0 s3 s1
+mulhu gp t1 t2
+sltiu a5 s5 298
+mulhu a0 x0 s5
+srai t4 a3 14
+sll s8 s1 t4
+mulhsu t5 s9 s4
+ori a2 s5 -1339
+sltu a3 a3 a3
+ori a7 s6 431
+srai t6 s11 4
+mulhu s1 s9 gp
+and tp s3 t2
+mulhsu s3 s3 a2
+divu t3 a1 x0
+mul s5 t3 a4
+addi t5 t4 -1688
+auipc s7 767866
+xori s7 a4 508
+srli s1 s6 14
+slli s5 s4 8
+srl a1 t0 s8
+sltu a1 x0 x0
+xor a0 s5 s8
+rem s1 s5 t5
+sltu s6 s4 s9
+add tp t4 tp
+mul x0 a2 a0
+mulh ra x0 t3
+ori a4 a2 -1742
+xori s4 s6 -1920
+mul s3 t0 gp
+add s3 s0 tp
+mulhsu a2 a6 a6
+remu a1 s1 t2
+sltu a7 s11 gp
+mulhu a7 x0 a6
+remu s5 a1 ra
+auipc a4 87506
+auipc a3 939230
+add a5 t0 s2
+slli a1 s1 14
+mul a4 t4 a3
+sra s10 t0 s0
+or t0 a1 s6
+auipc a7 428575
+auipc s8 533771
+remu t2 t6 t2
+or t6 a2 s6
+ori t4 gp -559
+ori s5 x0 1444
+div s5 a5 s11
+lui s1 617426
+srai a1 t5 27
+sub a4 s7 x0
+sltu s11 a0 s7
+mulhsu s8 s2 s9
+ori t4 t2 -1109
+ori x0 a5 -618
+divu t2 s9 t5
+sub a7 tp a5
+xori s4 a5 -380
+mulhsu s4 tp s3
+sltiu t2 t3 -1534
+mulhsu t2 t1 s6
+sltiu x0 t3 -1575
+srai a1 s3 5
+slt t0 s2 ra
+xor s9 s6 x0
+srai s0 tp 4
+auipc s10 907008
+xori ra t4 731
+srli t1 a4 27
+sltiu t6 a1 -1804
+sra t0 a4 s7
+sll s0 a2 t3
+sll s1 s5 s8
+auipc s2 876322
+slt a7 s11 a7
+remu s10 t5 s8
+mulh a4 t0 t0
+sub t1 x0 s8
+xori a7 a0 -961
+lui s10 579151
+slti x0 a5 -1797
+mulhsu a0 a0 t1
+add t6 x0 s3
+addi s7 gp -800
+lui a5 566146
+addi a3 s5 -1609
+srli s11 s11 17
+or s10 a0 s1
+sltu t1 s1 a7
+lui a5 124297
+or x0 s11 s3
+sltu t1 t3 a2
+addi t0 a5 -795
+sra gp a1 t1
+mulhsu a4 s4 gp
+mul a3 a5 s1
+add s9 t5 s4
+auipc t1 547073
+div s9 a3 t2
+mulh s9 s8 s3
+addi s0 s11 620
+ori s3 s3 -1061
+or a4 s8 s0
+sltu t5 s7 a5
+auipc s9 238129
+ori x0 s5 -1601
+divu t2 t5 tp
+mul s5 s5 t6
+rem a7 s11 s0
+srli s1 s4 16
+lui a5 130482
+mulhsu t1 ra a0
+sltiu a4 s3 -1355
+slli t3 t6 19
+add a0 t5 s0
+mul ra gp a6
+mul s5 s7 s10
+rem x0 a1 a2
+srai s4 t4 12
+sub a2 s3 a1
+ori a7 t4 1807
+xor a2 t2 x0
+sltiu x0 a6 1985
+ori a5 t2 -1159
+sltiu t1 s6 -225
+lui s2 351053
+mul t5 s8 s4
+div s9 t0 s3
+sub a0 tp x0
+xor s2 t0 a3
+remu s3 t1 a0
+sub s3 s6 t0
+slti s0 s2 -1567
+mulhsu s9 s5 a6
+remu a0 s5 tp
+slti a6 ra -68
+slti s7 a4 1645
+lui gp 233177
+and s3 t2 s3
+auipc s2 188663
+or s5 a3 s8
+div tp t6 s4
+sra t5 t4 s0
+sltu s9 a7 t1
+xor t1 a7 a6
+srl a4 t4 s9
+mulh t4 a6 s8
+slt s2 s0 a3
+ori gp a2 1868
+mulh x0 t4 a7
+div x0 s8 s9
+addi s5 s1 1015
+addi s11 s11 -738
+sltu t4 s8 a1
+andi s1 s0 -1127
+or s3 s8 s4
+andi s9 s10 -1210
+slti t1 a2 -1581
+sra t4 gp a1
+add a2 gp a5
+lui a1 672554
+sltu s11 a7 t6
+srl s8 a0 x0
+mulhsu s6 s11 t5
+or a2 a2 s3
+slli gp t3 10
+xori x0 s5 -1207
+andi t6 ra -76
+or s10 s1 t3
+sll s10 a0 s11
+addi t0 ra -619
+mul a5 x0 a0
+remu a1 s8 a6
+remu t6 s0 s11
+ori s6 tp -993
+slli s10 s8 11
+sll a3 a1 a2
+sub s0 s4 a3
+remu x0 x0 t6
+sltiu tp ra -1951
+sltiu tp t1 -1923
+srl a2 t5 s0
+xori a0 x0 -762
+mulhsu s8 a3 x0
+lui a0 98184
+auipc a6 859215
+slti a2 s1 -503
+divu a0 t1 t4
+xor a6 s0 a5
+div t1 s8 s6
+slti t0 x0 -621
+mul s8 s11 s3
+lui s6 66801
+lui a6 8090
+sub s8 t5 t0
+slt s4 x0 t4
+srli a2 a1 16
+sltiu s1 t5 -1269
+slt t0 t1 t3
+slt gp x0 t4
+auipc s1 406380
+srai a3 a2 7
+slli a2 s0 8
+auipc s5 777260
+sub a4 t4 ra
+div t5 t1 a2
+mul t6 s9 s2
+xor a3 t6 a6
+andi t1 s8 -1754
+andi a7 t3 -269
+slti s8 s11 -543
+sll a4 x0 t1
+mulhsu s8 a4 s9
+slt s0 t5 t1
+or a4 s0 x0
+mulhu s10 a3 t2
+div t2 a1 t2
+and s7 x0 s9
+sll a2 a5 a0
+add gp x0 s6
+mulh a4 s8 gp
+and t5 s10 s2
+sra s3 t4 x0
+mul t2 s11 t0
+add t5 t0 gp
+slli a0 x0 12
+div t4 s3 x0
+divu a5 ra s7
+and s9 t5 a0
+srai a7 s6 24
+slli a6 s10 28
+mulhu s8 x0 a7
+sltu t1 a5 a4
+lui t5 214362
+xori t6 a0 -551
+sra a7 a3 s6
+ori s1 t5 1782
+sll s0 x0 x0
+andi t2 t3 -1850
+addi t2 s11 1043
+addi s0 t0 549
+ori s3 x0 -728
+divu a7 s4 s2
+auipc a6 334949
+and s8 t2 a0
+sltu s6 s10 t5
+slt s8 s8 s1
+srl s3 t0 s0
+add a1 t6 a1
+div a4 s0 a5
+addi tp a2 707
+andi a7 a7 -813
+srli a4 s7 5
+srai ra s5 12
+xor t0 t0 t6
+xor t0 t4 a0
+mul s7 s1 t6
+slti s1 a2 -1681
+rem s6 a6 a4
+auipc a7 911750
+auipc a3 885175
+mulhsu a2 a2 s1
+addi gp a4 577
+rem s9 a3 s3
+remu s8 x0 a4
+andi a4 x0 -1878
+divu ra a1 gp
+xori a4 s6 -1535
+srli a1 s6 1
+sub gp a6 s9
+srl t2 tp a6
+andi gp s3 1548
+sub s4 s10 t1
+auipc x0 229607
+slti s11 gp -216
+sltu a1 s2 s1
+xori gp s6 1985
+ori x0 t2 -1588
+div gp s1 s6
+sub s6 s7 s1
+sll a7 s1 s5
+slt t3 a6 x0
+srli t2 s6 2
+srai x0 a4 6
+srl t0 s8 gp
+mul s7 tp s3
+slt tp s9 x0
+sltu a2 s7 x0
 slt a4 a0 s4
-xor t4 t2 s4
-slt tp s6 ra
-slt t2 a2 s4
-sltu t3 t1 a6
-xori tp s0 168
-srl s5 t1 t3
-andi s4 s7 -1801
-slli t4 s8 27
-srl s3 s7 s8
-divu t3 a3 t0
-div a3 t4 a3
-xor x0 s5 tp
-and t6 s10 t3
-slti s1 a1 -143
-slli t2 a1 22
-remu ra t2 a1
-srli s6 a5 9
-mul s4 a6 s9
-mulh s10 gp a0
-sll s2 t1 s0
-xor s8 s8 a0
-slt s10 t0 s0
-sltiu s9 s5 -911
-sub t6 a4 s0
-mulhsu s1 s6 s0
-add tp a7 a4
-sub t6 s4 t0
-andi s10 s3 1318
-and t3 s9 t5
-sub s7 gp s1
-auipc s7 696648
-divu t5 s5 ra
-auipc gp 840734
-or a3 ra t1
-slt tp s1 t6
-mulh ra t2 t0
-srli x0 a3 3
-or s4 s5 s9
-div t3 tp s9
-sub a1 gp s3
-mulh a7 x0 s11
-add s3 a0 s0
-slli a5 s7 25
-remu x0 s2 a4
-ori t3 t0 1020
-auipc gp 453028
-xor s5 a2 s0
-add s0 x0 s0
-mulhu t3 a2 s7
-mulhsu s10 a6 t4
-addi s4 t5 155
-mulhsu s4 t3 s5
-div a7 t6 ra
-slti t3 a5 -285
-slli s0 s9 13
-sub s9 t1 a0
-slti a5 t3 -896
-andi a0 t3 -343
-ori gp a3 -841
-div s2 x0 s8
-sra a0 gp a4
-or s6 s0 s9
-mulh a7 s5 x0
-slli s2 t6 18
-mul x0 a0 s2
-lui x0 496830
-andi s3 t1 1689
-mulhsu s3 x0 ra
-rem gp a7 s1
-mulh t6 tp s4
-mul t5 s0 a3
-srl s3 x0 a4
-andi a0 s6 1163
-sltiu tp a3 1477
-mul s2 s2 a7
-or s11 x0 a7
-slli s4 s8 4
-mulhu a6 s3 a4
-andi t4 a2 -650
-auipc s8 555970
-slli ra t4 2
-lui s10 617818
-xori a4 x0 -700
-sra t2 t1 s0
-div t1 a6 tp
-sra s2 a5 s10
-lui x0 27488
-andi s9 a1 -1168
-slli s11 t5 24
-add a5 t6 a4
-add a0 a7 s6
-xor s3 s7 t1
-divu t3 t2 a1
-or t5 t2 ra
-srai s9 x0 2
-remu s0 a6 s11
-andi s10 s4 230
-sra t5 a0 a6
-divu t4 gp x0
-mul a7 s6 t1
-sltu t5 s6 s2
-remu s2 t2 a4
-sltiu a6 s2 265
-sra s10 a5 s4
-and s7 s7 a7
-remu a6 x0 x0
-srai t4 s5 30
-slli a7 t0 16
-add a4 t5 a3
-div s8 gp s4
-sltu x0 gp s8
-xori gp a2 -1496
-sltu s8 s6 t5
-div s7 s2 a7
-mulhu x0 ra s5
-sra ra t2 s3
-srai a3 s10 24
-auipc a7 26460
-sltu t0 s9 t3
-add x0 x0 s4
-divu x0 s2 s3
-remu t1 s0 a4
-mulhsu gp s6 s9
-srai x0 x0 14
-sll t6 t6 a6
-sltu a7 a0 a0
-remu s11 t5 s0
-sra s4 s2 tp
-srl a3 t5 s5
-ori s8 a3 252
-or tp gp s6
-xor t3 t4 a0
-slti s4 t3 -644
-slt a0 a3 x0
-slli a3 s6 18
-lui t6 109259
-slt a3 a2 t4
-remu ra s3 s0
-srai t2 t3 27
-mulhu t4 t0 t0
-ori a4 t6 -1747
-sra gp x0 t5
-sltiu s4 gp -2040
-or t2 s2 s0
-xor x0 t4 tp
-or a2 s11 s1
-xori s0 x0 953
-slt a7 s1 s11
-div a2 t3 a0
-srai a6 s7 3
-slli gp a3 16
-ori a0 s0 -2022
-mulhu x0 gp a6
-addi x0 a2 134
-lui t2 432472
-xori s10 t2 953
-mul a0 t6 a4
-remu s5 t5 s8
-xor t0 t4 s11
-mulh s3 s0 a2
-addi a3 s1 -1830
-xori t4 a6 -1644
-and t0 s4 t6
-mul s1 t0 x0
-slti s2 gp 261
-ori t6 s1 -144
-mulhu s8 s9 a3
-rem s11 s1 tp
-srli a1 a5 8
-slti s2 s8 2003
-slt t3 a4 t0
-addi s0 s5 -1678
-mul a3 t5 s3
-addi t4 s5 -1184
-srli s10 x0 27
-rem s6 s5 t5
-mulhu s6 a7 a3
-xori s1 s11 30
-srai s11 t1 29
-mulh t3 s9 a5
-sub t0 s2 x0
-ori a6 s0 -682
-divu s11 x0 x0
-slt s3 a1 s9
-xor t4 t2 s6
-xori s7 s3 -883
-addi a4 s9 -256
-auipc s6 373632
-sltu a6 s0 s8
-mulhu a3 s4 t6
-divu s10 a1 a1
-divu a4 a6 s5
-sltiu t6 s7 -1254
-auipc s2 328711
-slli s8 a3 28
-sltiu t3 s4 -862
-mulh t3 s10 s0
-sub s11 s0 a5
-div s0 s10 gp
-xor s0 t1 a7
-slli a2 t1 5
-sub s2 s6 t2
-sra t0 t3 ra
-andi s5 s8 -1931
-srl s10 t1 tp
-sra s5 s8 a6
-sub a0 t0 x0
-and a1 a1 s9
-slti t3 a6 -1265
-slli s0 s11 18
-srai t6 a7 24
-slli s4 s6 15
-ori a6 a7 -2007
-remu ra s1 s9
-add t6 t4 t4
-add tp t5 t0
-and t6 tp ra
-andi x0 a5 -32
-addi a7 t0 -689
-andi t4 a7 -1456
-sra s3 a2 t2
-xor t0 gp a0
-mulhsu a0 t4 s0
-addi x0 a6 -1928
-mulh s7 t2 s11
-mul s6 x0 a7
-rem s6 s0 t0
-andi t6 t5 -1098
-sltiu ra a4 -1951
-sra a5 t1 a6
-ori t3 t5 790
-xori t0 s7 1173
-div s11 s1 s7
-xor tp t4 s1
-div s10 t0 s11
-srai s3 s11 21
-auipc x0 868212
-sltiu a4 s11 -780
-srai tp t3 30
-mulhsu t2 t3 t5
-srai s11 a3 0
-srl a3 t2 a3
-lui a4 562395
-ori s0 a6 446
-sltu ra s1 a5
-lui s6 799189
-add s10 s10 s10
-lui gp 547445
-sltu s0 s10 s3
-andi a7 s1 1631
-xor t0 gp a2
-slt a0 t3 x0
-sltiu s7 t5 95
-divu x0 s9 t5
-slti t2 s5 -155
-auipc a5 587356
-sltiu t6 t2 -1558
-xori a2 a7 -1797
-lui tp 987484
-and t6 s8 a4
-slt ra a6 s3
-rem t3 x0 a4
-xor s2 x0 x0
-sltu t5 a4 t4
-mul t4 t0 s6
-srli t4 s11 2
-xor s11 a6 a0
-mulhu s2 t4 tp
-remu t3 s4 s8
-xori s1 t4 -1552
-ori t3 s11 -694
-mulh s0 a5 s0
-srai a3 a4 17
-remu s7 ra x0
-sll s7 x0 tp
-div gp t2 s8
-mul s11 t3 a2
-remu s6 t0 a7
-slli t1 s0 8
-rem s0 t2 t0
-ori s10 s7 -108
-slli s9 s3 8
-addi a5 s5 -256
-andi a6 s2 -1017
-srai a1 s1 16
-srl t5 x0 a4
-lui a3 241716
-xori gp s10 -1886
-and s11 s0 t1
-div t4 s5 t3
-mulhu s0 x0 a7
-slt t4 gp gp
-slti s0 s9 1708
-slt s0 t0 s5
-mulh a1 s5 s10
-and t5 t6 a2
-slli s7 a4 23
-mulhsu s6 s2 a7
-add a1 a6 ra
-mulhsu s3 s1 s7
-slli s0 a0 24
-or t1 a5 s8
-rem a7 s8 s3
-srai x0 t3 0
-lui a5 654450
-or x0 t0 s10
-add ra a5 a7
-remu t3 tp t3
-rem a4 s5 s11
-sll s7 gp s1
-remu s1 s6 s11
-auipc s0 222455
-div t4 s4 a5
-sltu s4 a1 gp
-sll a0 s1 t4
-addi a0 t5 -1675
-rem gp s4 a6
-slti a4 ra 2032
-sltiu s2 s10 -1705
-sra a7 a3 a4
-slli a3 ra 18
-mulhu a4 s10 s4
-or t2 s10 s1
-addi s5 s11 -1991
-slti t4 s5 1847
-divu a1 a4 s4
-xori s9 t4 -376
-srli t2 t5 30
-or s6 s8 s9
-andi a3 t4 -359
-mulhu s3 s10 a5
-mulh a7 t6 a6
-slli t0 ra 17
-add a4 ra a7
-ori t2 a5 1129
-and t4 a4 s9
-div gp s7 s4
-and s11 s9 a3
-divu s10 x0 a2
-sltu a3 t1 s4
-remu ra tp s5
-rem s4 s9 s8
-ori t1 s10 -1436
-mulh s5 ra t4
-xori t5 a1 55
-mulhu gp t3 a7
-addi a4 t0 895
-slti a1 t5 1820
-addi x0 tp -1566
-lui s1 637298
-sub s3 ra a2
-sltu s9 ra s0
-add s9 a5 t3
-mulhu t5 t4 t1
-srai s10 s1 29
-mul t4 t4 gp
-remu s1 a4 s8
-and s1 a0 t2
-xori s6 a3 -595
-sltiu s7 a0 919
-lui s4 562953
-mulhsu s6 s8 s8
-div a1 t6 s4
-mulh a6 t4 s3
-sll x0 s3 s0
-sub gp a0 t6
-divu a6 ra a1
-lui a2 804793
-remu s10 a3 a0
-mulhsu s9 s6 t0
-slli s3 ra 9
-add t2 s0 tp
-mulhsu t0 a2 a0
-remu s10 s8 s4
-mulhu ra s2 a5
-ori s2 t1 -576
-mulhu s3 a4 x0
-auipc s11 1020158
-xor t2 t6 s6
-mulh x0 ra t5
-srl a1 a1 a7
-srli t2 a7 12
-mulhu s8 s5 s5
-sltiu a1 x0 -1463
-srl x0 t3 a7
-and s7 t5 a0
-auipc t1 617428
-lui a5 420571
-addi s5 s8 -1482
-ori s0 t2 -883
-auipc s9 294132
-divu s0 s8 ra
-div s3 t5 s10
-sra tp a2 tp
-slli s3 a1 29
-and s5 t1 s0
-xori s11 s7 -1799
-addi a3 s9 -806
-auipc s6 884179
-srl x0 a2 t3
-srai gp t0 6
-andi t2 s11 -6
-srai t0 s0 25
-sub t4 s8 ra
-mulhu s6 t6 a7
-slt a4 s7 t3
-mulhsu t4 s10 s3
-sra s4 t4 t1
-sll t5 s9 a6
-xori a7 s7 742
-divu s0 a5 s3
-remu s6 s10 s9
-sll s3 ra a0
-divu s4 a6 s8
-xor x0 x0 t5
-srai s5 s2 11
-slti a6 x0 -1660
-mulhu gp gp a3
-lui t0 913776
-remu s5 t1 s4
-mulhsu t2 s4 s5
-xori s11 s10 -1960
-slt s4 tp t2
-mulhu s1 a6 a7
-mulhu a1 a4 t5
-div s8 s11 a5
-sltiu a7 a3 993
-xori t0 tp -1871
-sll t3 a2 s3
-auipc s6 199642
-rem t2 a1 a0
-sll t4 t0 s2
-mul s9 a4 a1
-lui tp 91013
-srl t0 a2 a2
-srli x0 x0 27
-sra x0 s8 s3
-sub t6 s3 a7
-divu x0 tp s8
-srl s0 a6 t4
-mul t3 s8 s9
-sltiu a2 s0 -1706
-sltu x0 s7 t2
-mulhu s7 a6 a3
-xor s9 ra s8
-sra tp s8 s2
-auipc gp 805383
-mulh s6 s10 a4
-sra a1 t6 a2
-xori a3 s6 -1584
-mul s4 s0 a7
-slli a1 a3 24
-mulh a2 x0 s0
-xori s7 a6 -154
-auipc s11 869976
-andi s9 a2 126
-sltu s8 t1 s7
-add s3 x0 x0
-mulhsu t2 s8 s8
-divu x0 a5 x0
-sltiu t3 s6 1616
-mul a2 a3 s11
-sll s1 s0 s6
-xori t2 a6 -657
-lui t0 1008003
-remu s2 a3 ra
-srl t5 t0 s5
-mulhu a2 t1 t3
-and s5 x0 s11
-xor t4 s1 a3
-andi s10 a0 -976
-srli a7 a4 27
-add t1 s7 a5
-xori t2 t0 632
-or a4 x0 s11
-rem t6 x0 tp
-or s8 s7 a2
-slt a7 x0 s3
-remu s8 t2 s5
-sltu s5 s7 s10
-slt s11 s4 t6
-ori s10 x0 1756
-rem s6 x0 gp
-mul t5 a7 s1
-sll s8 a6 s0
-sltu a5 s1 t4
-sll t4 tp gp
-xori t3 s0 -1777
-ori t2 s8 -1259
-sll a2 s3 t2
-mul t5 gp s1
-and s11 s3 t4
-xor s11 t5 t4
-add a7 s2 t2
-divu s11 ra a6
-mulhsu s2 a6 s4
-sll s3 t2 s9
-xor gp ra a7
-sll a5 x0 s4
-ori a5 t0 133
-sltiu t2 s11 -921
-xori tp s5 -1542
-remu a5 a7 t3
-sub t4 a5 a6
-srl a5 a3 s0
-sra a4 t5 t2
-sltu s0 t0 s3
-sltiu s5 s4 1408
-slli t4 s3 23
+and t6 s4 s10
+sra t2 s10 s5
+slli a6 t5 30
+rem s11 gp tp
+lui a6 769233
+sll a1 s3 t2
+srai x0 a4 6
+mulhsu s6 t0 a7
+add t1 x0 s0
+and s0 t6 s5
+slti a1 a2 850
+auipc s6 923994
+srl t6 s2 a0
+rem s0 t0 a3
+ori s4 a3 -1573
+mulh t6 s3 tp
+ori t4 a0 1058
+andi s11 x0 -225
+or s5 a0 s5
+add s10 a2 s3
+srl tp t6 a5
+add s1 s5 a0
+lui s1 1019761
+slti t3 t0 -876
+add s1 t0 s10
+remu s7 t1 a5
+sub a6 s4 t5
+sra s6 a1 s2
+srl t0 a0 t1
+srli gp a4 0
+mulh a1 s10 s11
+andi t0 x0 -330
+divu a5 s5 t6
+div s4 a6 s6
+sra ra a6 a5
+andi a7 tp -1089
+ori s3 s5 -1675
+xori a6 t3 -549
+divu a6 t2 s1
+mul a3 t4 s7
+sub s10 s9 a5
+lui s2 989813
+slt a6 a2 x0
+xor s2 tp t3
+sll a6 ra x0
+slli s11 a4 19
+andi s4 x0 -1903
+andi a4 s9 -337
+addi ra a0 1334
+divu s4 t3 s2
+addi t0 x0 46
+remu s2 s2 s7
+lui t4 451005
+remu s3 t5 s0
+mul s5 a7 s9
+auipc s3 678887
+sltiu s4 a6 1233
+auipc x0 218267
+mulhsu t1 t0 a7
+sra ra t1 s5
+sra t0 x0 t1
+sra s5 t4 s3
+div s10 s3 a3
+sll a4 s10 tp
+remu a5 t0 s8
+xori x0 s6 991
+srl s4 t3 ra
+remu a1 a1 a4
+mul t1 ra s0
+and s9 ra s4
+xor t6 s7 a4
+xor t5 s2 a5
+divu s2 a5 t1
+remu a2 ra t3
+div a1 x0 a2
+remu t6 ra t0
+sltu gp ra t2
+mulh s5 a3 a3
+mulh t1 s0 s3
+sltiu s4 a2 451
+slt gp a0 s5
+lui s6 900156
+srai s5 s8 3
+lui a6 585052
+rem gp s8 s7
+xori a6 t0 -489
+slli t3 s3 21
+sll gp t6 a5
+slti t1 s6 -1155
+divu s2 s2 a1
+addi a7 a6 -603
+remu t4 a7 t3
+andi a7 s3 1335
+srli s9 s2 3
+lui t6 58746
+srai gp a0 19
+srai gp a1 31
+or tp s5 t5
+remu a2 t1 s7
+slli s8 s7 15
+mulh s7 s1 a2
+lui a5 250270
+add t6 s3 s7
+slti t4 x0 -443
+xor s2 tp s9
+ori s8 t2 -1218
+and s1 s5 a0
+remu s11 a4 s7
+sll s9 s8 a6
+sub t1 tp s6
+slli s7 t2 25
+xori t0 t6 -1216
+slt s0 t4 ra
+ori t2 s3 -826
+div t4 s7 a0
+divu s5 t0 s2
+rem s4 s10 t1
+sll s6 t2 t2
+div s1 gp x0
+divu x0 s6 a2
+srl s6 a6 t0
+or a1 t0 t2
+or x0 t1 x0
+remu s7 a7 t0
+lui s8 13486
+slli t1 a2 11
+sra s8 x0 ra
+or t5 s10 t4
+remu x0 a0 s3
+srai t5 t0 15
+mulhsu x0 x0 gp
+srai s4 s11 3
+div s11 s9 s9
+slt a6 a1 a2
+sub a1 s5 s1
+mulh s10 tp gp
+addi tp s7 955
+slti s1 s3 -789
+sll t4 s8 t4
+addi a1 t5 -1842
+mulh a1 s3 a7
+sra s4 s1 s3
+srl a7 s2 a6
+slt t3 t2 t4
+slt tp s8 t3
+andi t4 t3 634
+srai gp s6 22
+auipc s2 422439
+andi a5 a5 851
+sub a7 a1 t6
+and a5 s8 a1
+sll s4 s2 t3
+add s6 s3 s0
+mulhsu s3 t5 t4
+addi x0 s8 -1638
+xori t0 t0 717
+divu ra t2 a5
+srl t3 a7 a1
+remu t3 a1 a2
+or s0 t3 t6
+lui x0 118135
+mulhu s8 x0 s2
+slt s0 s0 t2
+rem t3 tp t4
+sra s2 t0 t4
+srai s8 s9 6
+mulhu t4 t5 x0
+div a5 s7 a2
+srl s8 t0 t4
+srl t1 a6 t4
+and a0 gp s7
+mulhsu t1 s1 s9
+sub s3 s7 s9
+sltiu gp s9 1435
+lui t6 992936
+mul t2 t5 s3
+sltu s1 x0 t4
+sltu t0 a6 s1
+mulh a4 s1 s5
+xori s9 s4 -336
+andi ra s6 -778
+slt t6 a3 s9
+mulhu t6 t4 s3
+mulhu s2 s8 t3
+slti t4 a6 1426
+xori a7 a1 -224
+srai x0 s7 17
+addi a7 a5 795
+sra s8 a1 gp
+sub t1 s9 a7
+sltiu x0 a0 -942
+lui s8 759597
+srai s8 a6 0
+srai a5 s8 5
+srl s11 s8 t0
+divu t0 s0 s3
+mulh a0 t5 a2
+sub t5 a6 s11
+srl gp a1 s2
+sltu t0 a2 a1
+remu a5 s3 s6
+mulhu t2 s11 t3
+sub a4 gp s3
+and t2 s3 tp
+srai t2 t0 20
+ori a6 s11 1388
+xori x0 t6 -1767
+sltu t0 tp a3
+remu a6 s6 t5
+mulh t6 s7 tp
+mulhsu t6 a4 a6
+rem t3 a2 t5
+srai s0 t3 8
+lui x0 586958
+mulh a2 s9 s3
+mul t6 t0 x0
+addi x0 s10 -578
+rem a5 t4 s9
+lui t1 171963
+rem s4 s1 ra
+and s3 a3 gp
+slli s7 t6 25
+auipc t2 952304
+divu tp t5 x0
+div s9 a0 t1
+div x0 s2 a1
+mulhu s6 a2 s3
+sra gp a6 s2
+lui ra 889595
+sll x0 s1 a1
+divu a6 a7 t0
+slt s8 s8 a6
+add t4 t1 s6
+slli gp a1 8
+srai a7 a4 17
+mulhu s10 s11 a4
+addi t6 s7 1014
+sub a1 a6 a0
+xor t4 gp s6
+srli s7 s10 3
+sltu t0 a6 t5
+andi a7 x0 -76
+slli a7 a5 23
+remu s6 t4 a7
+srli t3 a0 19
+srai s2 s5 4
+divu a2 s1 ra
+add x0 t3 a0
+srai s9 s9 8
+remu s11 s8 t4
+xor a3 x0 s6
+srai s7 t1 0
+sltiu a1 s9 -118
+slli a3 s4 31
+srl t2 t5 s4
+and s11 s2 t5
+mulh s7 a1 t4
+auipc s0 743777
+remu t6 tp a3
+divu gp s7 s1
+remu s3 t5 t0
+divu s5 a0 t6
+ori s1 tp -1656
+mulhsu s1 a3 a3
+or a0 a2 t3
+slti a4 a5 1611
+sub t0 s3 a5
+slt a4 s2 s10
+div a2 s6 a1
+sra a7 a6 s11
+slt a2 a4 a3
+lui s4 658242
+srl s10 s4 ra
+srai s7 s8 26
+remu s2 a5 s4
+divu a3 ra t4
+auipc a2 718788
+sltu tp ra s11
+sll a7 t1 gp
+sltu t0 t5 t0
+mulh x0 a3 s11
+srai s7 s4 23
+and s6 t2 t0
+div a7 s5 s5
+mulhu gp a3 a7
+add t6 t6 s3
+slli t6 s9 24
+xori a5 ra 903
+srli x0 a1 8
+auipc ra 660681
+xori a6 s11 -566
+add t0 a7 t2
+auipc t4 486925
+andi t2 t5 -1581
+rem t3 tp t3
+rem a0 t5 a6
+div x0 s3 s6
+sll s11 x0 a1
+lui s6 411423
+andi t0 t6 800
+slt a4 t4 a4
+rem a0 gp a3
+mulhsu s3 tp a7
+remu x0 s5 t1
+srl a5 gp gp
+xori a6 a6 -1532
+mulhsu gp a5 x0
+xor t1 a2 a4
+mulhu s10 t3 a6
+sltu a5 t3 x0
+slt gp s9 s4
+addi a7 a4 122
+xori t3 a1 -199
+xori s4 a3 -937
+slt s5 t1 ra
+srl a5 s4 s0
+rem s8 tp s6
+xori a2 s6 764
+srai s3 s1 26
+srli a0 a2 19
+slt a3 a5 s10
+lui a4 641955
+div s11 x0 t3
+or a0 s1 s8
+divu s7 tp s11
+mulh a2 t4 s5
+xori s8 a3 -921
+and s9 x0 a6
+xori x0 s11 29
+div s2 a7 s1
+and a7 ra s5
+mulhu a0 s3 t4
+srl a5 s7 s9
+slti t2 ra -676
+auipc s10 686257
+srli a2 s2 29
+andi t3 s2 1136
+sll ra s1 s3
+srl t6 t4 x0
+sra s2 s1 a2
+ori x0 t6 1907
+xor s6 s0 s9
+divu a1 s5 x0
+srl gp t4 s8
+sltu a1 x0 s9
+srai t4 t1 2
+and tp t2 a0
+lui a7 749258
+sub s8 s2 t4
+sub s11 s0 s7
+add s4 t0 t5
+sltiu t5 x0 -1101
+xori t2 x0 -503
+addi a7 s8 -52
+remu s5 s10 a0
+xori s8 a2 -1799
+addi s10 s10 1282
+mulhsu t6 s0 s6
+slti s3 t4 -1245
+sltiu a3 s7 -350
+andi a5 t2 -1813
+xori a1 s10 -1756
+xori a6 t6 -79
+srl tp t2 t2
+remu s9 a5 a6
+srai x0 t3 6
+lui s2 200371
+lui ra 35852
+divu s3 a3 a5
+srl gp s5 s0
+sra gp s3 t4
+slt a1 s10 t0
+sll t5 s10 ra
+sra t4 tp t5
+div tp a2 a5
+remu s1 s11 t6
+add t0 a0 gp
+sltu s0 s11 a7
+or tp tp t1
+div a6 x0 s10
+sll s0 ra gp
+sra x0 gp t4
+mulh s10 s9 s1
+slli a4 ra 4
+sra a5 s8 t3
+srai ra a5 6
+mulhu t4 a6 a1
+xor s11 s5 a4
+remu t5 t2 t0
+and s0 s4 s11
+div t4 s3 t3
+mulhsu s6 t2 t4
+auipc s2 760488
+sltiu t0 x0 1707
+rem a7 s4 x0
+and a0 a1 s0
+slt a0 x0 x0
+addi a0 a4 -1016
+addi t4 a6 -612
+sub t6 s10 s4
+mulhu s11 a2 s5
+remu a5 a7 s0
+auipc t5 288450
+sub s4 ra s6
+and tp t5 x0
+slti ra s10 127
+sll s9 t4 s5
+addi ra t0 1095
+rem s9 a4 s7
+srai a0 a5 19
+ori a2 a3 477
+or s8 t3 a5
+sll s11 s11 s9
+mulhu s9 t6 tp
+xori a6 t4 -457
+srl a6 s11 ra
+sltiu a6 t3 -696
+addi a1 ra -1582
+remu a6 s10 t2
+sra t5 a4 s5
+andi t3 s6 -399
+andi a7 t3 1127
+xor a2 t1 s4
+slli s3 s3 21
+slt t6 t6 t0
+slt x0 t4 a2
+sll x0 gp s7
+mul s1 t3 a4
+slti t3 s4 403
+mulh gp s7 s8
+mulh s2 s6 a0
+sub s9 a4 s0
+mulh a5 s8 a1
+mulhu s6 t5 a5
+xor a4 a5 t6
+mulhsu a1 tp a2
+srai x0 s2 14
+andi x0 t5 -911
+sub a5 a6 x0
+mulh a1 tp s0
+auipc a0 911725
+ori a5 s3 274
+addi s2 t5 -430
+auipc t5 221303
+sll s1 s9 gp
+srai s2 s7 19
+sra s8 a6 s8
+mulhu s6 t5 t2
+andi x0 gp -1112
+div tp s1 s5
+slti a4 t5 987
+sltiu a2 ra -1457
+mulhu ra a2 a3
+remu a7 ra s6
+xor s10 tp gp
+srai x0 a5 3
+srl tp a5 ra
+andi t3 s7 -1247
+div gp s1 a3
+sra x0 s3 x0
+lui a5 866219
+div s3 t2 a7
+andi s10 s3 -1254
+mul s5 tp x0
+sltiu t3 a7 -890
+addi x0 ra -758
+xor s10 s1 t3
+divu t0 a1 s7
+lui gp 944256
+rem s2 t6 s1
+sra t3 t6 s11
+slli s2 s9 12
+div t1 gp a1
+remu s2 t2 s0
+divu t6 t2 t2
+remu s2 s6 s1
+sll t5 a5 x0
+andi a2 x0 2032
+sra gp t5 s5
+remu t4 s8 s0
+rem t1 t2 s1
+sra s2 t6 s6
+slli t1 a6 19
+slti s10 t4 -1347
+sub s8 t6 a4
+xori s0 s2 954
+slli gp a1 19
+xori s1 t4 -1531
+andi s2 ra -518
+mulhu a5 t1 s8
+xori gp a2 551
+slli t1 a2 17
+srli s0 t5 21
+srai s1 a6 16
+lui s9 646162
+or a0 s9 s7
+srai a5 s2 20
+xor x0 ra a3
+auipc t3 196196
+slti s8 a0 -1245
+and t5 a6 s6
+remu gp t2 s2
+srai s6 a5 17
+or s10 a0 s2
+sra t4 s10 t4
+divu s11 s11 a4
+mulhu a2 t1 tp
+mulhu s11 ra s11
+slli s11 t3 31
+mulhu t6 s9 x0
+remu a1 t6 s10
+sub a4 tp s0
+xor s7 s2 ra
+xor t3 a7 s6
+auipc t3 581998
+rem s5 x0 s7
+mulhsu x0 gp s11
+mulhsu s2 t5 s1
+slt t3 t4 s7
+sra t6 a2 t6
+slti gp a3 -1922
+lui x0 624326
+rem t2 a1 s5
+xori a6 gp 1846
+sltu s3 s9 a5
+xor s5 s1 a0
+sra x0 x0 a2
+and a6 a1 t5
+or ra s10 s0
+srli t4 t0 3
+srai a6 s5 8
+sra t5 s7 x0
+or ra a3 a3
+sltiu a1 s4 1097
+rem s7 t1 s6
+add s9 t3 gp
+div s7 s10 t3
+rem s0 s10 s0
+div s7 s6 a1
+mulhu s5 x0 a7
+add t5 s2 s7
+sltiu a3 t5 -1042
+slli tp x0 4
+remu s7 ra s11
+mulhu s2 t5 s9
+andi a1 a2 -1231
+slt ra t2 s1
+slt s5 t5 s5
+slli t5 s3 16
+sltu s11 a2 s10
+add ra s0 s5
+ori t4 s0 1505
+sra s2 s5 a1
+mulh ra s2 t3
+srli a7 gp 15
+and s7 a5 t3
+auipc t4 609551
+sub s9 a7 x0
+mul t1 x0 s3
+slt t3 s8 a5
+srl a2 t2 s3
+rem s8 a7 s6
+add s4 s11 t3
+mulhsu s9 s10 a6
+sltiu t1 x0 -189
+lui s2 623146
+div x0 s11 s6
+add s11 a0 gp
+rem s9 s7 a0
+slli s6 a2 10
+mul a6 s3 t0
+divu s3 t3 a3
+or s2 s7 a7
+srl s5 gp t5
+mulhu ra s6 t4
+sltu s8 x0 s2
+add s8 s2 s1
+auipc s7 753379
+addi s11 s5 -1478
+lui x0 886712
+lui a3 672469
+sltiu s7 a1 -965
+or s6 a3 a6
+ori ra t5 -1437
+mulhu x0 s1 t4
+mul x0 t6 a2
+addi t1 t2 1388
+slli s10 s9 19
+sub t1 t1 t5
+srai s10 t1 20
+lui s1 235167
+srai t3 a2 0
+rem s9 t5 a3
+add s1 a5 a0
+div t6 t6 s8
+div a7 tp s11
+addi t2 a4 1671
+srli t2 x0 22
+mulhu s6 s11 t1
+mul t4 t2 t6
+slti t3 s5 -999
+andi t6 s10 -1443
+ori s3 ra -694
+xor x0 a7 s7
+remu t5 a0 gp
+slti a2 s2 -1742
+srai a6 a2 11
+ori a1 s7 1998
+sltiu t6 tp -1526
+sll s1 t4 ra
+xor t2 a1 t6
+or a4 s4 t5
+sltiu t2 s11 -1160
+mul ra a1 t2
+remu s5 a2 s1
+auipc t5 417593
+sltu s1 t5 s10
+lui t5 954819
+and s7 s8 s5
+addi a7 gp 1697
+andi s4 s4 -1257
+srl s8 gp t1
+mulh a7 a1 s1
+sub t5 s2 ra
+mulhsu s8 s9 t3
+andi s6 t2 -1413
+rem t5 a1 x0
+rem s11 s6 gp
+xori a6 t5 1998
+slli x0 x0 7
+lui x0 1032850
+rem s0 t6 s9
+andi s4 ra -2005
+sll tp s10 a2
+mulhsu tp t2 s1
+or s11 s1 a0
+auipc ra 322987
+lui x0 916803
+slt ra s7 t1
+slt s10 s0 s2
+sra x0 ra t3
+div a3 s11 ra
+mulhsu x0 s11 tp
+srai a5 t6 17
+sltiu a6 s11 1773
+mulhu a5 gp a1
+mulhu gp s5 s10
+lui s4 927508
+sll t5 t4 s11
+ori a3 s4 -163
+mul a5 a1 a5
+divu s4 s7 a3
+auipc t2 1007986
+mul s7 s3 s7
+mulh a0 t5 s10
+remu a4 s11 tp
+remu a3 s10 a5
+srai s0 t3 12
+mul s7 ra s11
+sltu t0 t1 s11
+andi a2 s2 99
+divu t6 s9 t5
+xori x0 ra -1049
+mul a3 t2 s11
+rem t2 s3 a0
+sltu s3 s7 t3
+div a7 s0 a4
+remu a4 a3 a2
+or s1 x0 x0
+auipc t4 586478
+div x0 s7 s2
+and t0 s5 a4
+mulhsu a5 t5 a7
+xori gp a6 -450
+slli t5 s9 0
+slt s11 s5 s5
+srl s5 t2 a2
+addi s1 s0 -1033
+sll s3 a6 s5
+addi a1 tp 1135
+mulhsu t4 s6 s10
+mulhu s1 s3 ra
+srl t3 a6 a2
+sra s2 a1 tp
+mulhu x0 a6 s1
+srli s6 a2 4
+sltiu tp s9 -1387
+lui t2 633600
+remu s9 a3 a1
+slli a1 a6 25
+mulhsu tp t1 a4
+sltu a7 s1 a5
+div s0 a1 s11
+srl a0 s3 t0
+and s3 x0 s9
+addi a5 s3 -1482
+remu a2 x0 a6
+sltu x0 s8 a5
+andi t2 s9 261
+mul a5 s6 ra
+and a3 ra tp
+slti s11 s0 1417
+sltu t3 t2 a6
+mulhu t2 s1 t3
+div t4 s10 x0
+sll tp s2 s9
+remu a3 a1 s6
+auipc tp 741357
+mulhu t0 s8 s6
+sll a5 t6 a3
+add a1 a0 s5
+xori t2 t2 -30
+srl t6 x0 x0
+sra s8 a3 t5
+mulhsu a1 a7 t6
+addi t3 a7 -793
+auipc t6 283945
+mul x0 x0 t0
+sra a1 s9 a0
+slt s11 s4 s7
+mulhsu s10 a2 gp
+div t6 x0 s8
+div t6 s1 s1
+mulh a4 x0 t5
+and t2 s3 s1
+xori s9 a1 -957
+sll t0 s5 s3
+mulhsu a5 a1 s5
+ori s10 s3 1555
+slt t6 t1 s6
+divu a7 t4 a7
+div a3 s11 gp
+mulh t4 t6 tp
+mul s2 x0 s9
+and s8 s9 t5
+rem gp s6 a2
+lui a7 581697
+slti a6 t0 1656
+xori t1 s11 -986
+mulhsu t4 t3 s7
+sra s10 s6 a6
+mulh s2 t1 t2
+srli s2 s10 8
+rem t6 gp t1
+divu a7 s7 gp
+mulhu t2 s3 t2
+rem s6 a2 s1
+sltu ra a2 s10
+sll gp a2 tp
+lui t2 655413
+xori s9 a4 -1196
+lui a0 365426
+slli t3 tp 9
+slli ra s3 25
+mul a3 s10 s10
+addi s3 a1 -592
+rem t4 a7 t2
+remu s8 s7 x0
+remu t0 a3 ra
+and t2 s8 a0
+srl a3 s7 a4
+or t6 t0 t4
+srai a0 s8 9
+rem t1 gp a3
+div s11 ra a5
+xor a6 a2 s7
+sltu s11 x0 a3
+divu t6 t3 a3
+div s4 a5 s4
+srl a4 s6 x0
+sra t3 a7 s11
+ori a3 s11 -881
+mulhu s4 s3 a6
+and s1 s11 t0
+auipc s1 863394
+rem a7 s1 t1
+mul s4 tp a5
+mul s0 gp a6
+div a5 s5 s2
+sra s4 s8 s11
+xori a4 s3 -133
+add a2 s3 s2
+mul t6 a1 t6
+ori t3 x0 -1245
+andi t1 x0 -1897
+xori a3 tp -1661
+andi a5 t2 -1491
+rem a2 s7 x0
+srl a7 s8 gp
+addi x0 t5 -1637
+and s1 t4 a7
+xor t4 s11 a5
+add s5 s8 a6
+sltiu s9 a5 1398
+andi t4 s8 -31
+srai t5 t1 0
+and t0 t6 gp
+slti a7 s7 -346
+slt a4 s3 s6
+divu a6 a3 a3
+slt a5 s0 gp
+sra t0 a3 a5
+xori a0 a1 -1489
+slt a4 a6 t5
+and t0 t4 a2
+slti s4 s11 980
+and s5 gp s4
+srl s2 x0 a5
+rem s4 t4 a1
+sra t2 a6 s3
+auipc s7 768758
+slt s3 s6 t2
+xor s3 s4 s0
+lui t6 554938
+mulhsu a6 s3 s10
+srli a3 s10 26
+andi a0 a4 1494
+sll a0 s1 s0
+srli t2 t3 2
+div t5 t0 s8
+andi t1 a7 -289
+addi gp a6 -779
+andi a6 s11 1148
+lui a0 349289
+or t3 a1 a7
+divu a7 s10 gp
+add s9 s11 x0
+ori a2 t1 -1197
+slt s0 s8 s0
+andi x0 t6 -1093
+slt x0 s4 t0
+sra s1 t3 s10
+sll a2 s7 a2
+remu t3 s2 s6
+sltiu s9 s5 1639
+mul s8 x0 gp
+mulh s3 t4 s7
+addi s5 s7 -796
+divu a4 s0 s10
+mul s7 s4 s3
+srai a0 x0 20
+add a2 t2 s11
+sltiu s6 t4 1983
+add s6 s10 s10
+divu s4 a4 s5
+sra s8 a1 s11
+xor x0 a2 s1
+mulhsu s6 a7 s0
+sll a6 ra s2
+div t3 t6 a1
+or s4 t3 t5
+andi gp s9 -2032
+auipc a0 878379
+srai a4 s1 20
+addi a7 a2 1992
+mulhu s5 x0 s5
+div s0 s7 ra
+addi a3 a7 571
+and gp s10 a5
+xori s4 a6 -1150
+div tp a2 t5
+ori x0 t3 -1873
+sra t0 t1 a5
+sll s3 s9 a2
+andi gp s4 1632
+sltu t4 s6 tp
+mulhu gp s8 s0
+mul s4 x0 t2
+sltiu t3 s9 1639
+and s2 s4 a2
+sltu a6 t3 gp
+sra a3 s8 a6
+srl a6 s9 gp
+lui ra 440213
+slti s6 t3 -1223
+mulhsu s11 t4 s1
+addi a6 s0 1381
+srl a7 s4 s0
+xor s3 s7 s11
+remu a4 s4 gp
+sll t1 s2 s8
+sll s7 t6 x0
+slli t0 s10 29
+srli s6 s7 11
+add s2 a7 a6
+add t1 a3 s1
+auipc gp 1022585
+srl s4 a0 s3
+mulhu a2 a7 s2
+auipc ra 259186
+divu ra t3 a3
+sltiu s2 t2 1242
+xori s0 s11 -307
+addi s2 s2 -396
+mul a3 a1 t2
+rem a4 s5 s3
+or a3 s0 x0
+andi x0 a4 -399
+addi s5 s1 -1736
+sll a7 a3 a6
+auipc t5 562775
+addi t2 a7 -1016
+xor s8 s1 t4
+xor s7 t2 gp
+sltiu s3 gp 1257
+srli a7 gp 26
+lui s0 202339
+xori a1 s2 -1882
+slli s8 s10 30
+xori t5 s2 -1828
+sub ra s11 t0
+rem s7 gp s8
+rem a3 s7 s0
+mulhu s4 t0 s5
+or a2 x0 s2
+add s2 t0 s2
+xor t1 a1 s10
+sra a0 t5 s4
+mulh s9 ra t5
+slti t5 s2 -1793
+add s10 t5 x0
+lui a7 764108
+and a7 x0 s7
+sub s4 a6 s1
+sltiu s6 a5 -1162
+slt s8 s5 s7
+sub a6 s8 s4
+addi s10 t0 -1764
+divu gp a5 a4
+lui x0 460067
+lui s2 207520
+or s11 s8 t0
+or t1 x0 t4
+div a6 t3 s7
+sltiu a2 a0 2005
+rem t0 t4 t0
+srl a6 s10 t2
+sra t6 s8 t6
+mul t5 a2 s4
+srli s11 ra 1
+add s10 t5 a1
+div s6 t0 t6
+slli s0 s6 8
+mulhu x0 t3 a1
+ori s4 gp 1748
+sub a4 a5 a7
+mulhu t5 a6 s0
+srl s3 a0 gp
+lui a6 248901
+ori s10 a5 -1380
+slli s5 a3 28
+mulhsu t0 t4 s1
+slti x0 gp 842
+mulhu s7 a4 ra
+andi t2 s11 -2038
+mul t6 s3 s0
+sra s10 a1 s10
+sll s6 s10 t0
+mul s2 s3 s2
+mulhu s4 s10 a7
+sra a3 s7 s5
+mulhu s1 t6 t0
+addi t1 tp -1827
+mul gp s6 gp
+sltu s1 s10 s9
+slt s9 s8 t6
+add x0 s8 s8
+ori a3 s6 1803
+addi a5 s0 97
+ori s11 a3 -836
+mul s7 t2 s6
+sltiu s6 a5 -1326
+sra a1 s9 t3
+slt s11 tp s4
+srai s1 s3 3
+srl tp t4 t5
+addi s8 x0 1886
+sltu s6 s6 s3
+mulhsu t5 a5 a0
+slt a1 s11 s1
+xori a7 s10 793
+xor t6 t3 x0
+mulhu t1 gp s2
+rem t1 a7 tp
+sltiu s11 a2 -202
+mul s9 s9 t3
+srai s7 t0 29
+srl a0 t4 a1
+rem s3 a1 t3
+xor a6 gp a4
+xori x0 s3 -1119
+mulh t5 a1 s1
+mulhu s11 s6 gp
+mulh s10 s5 s6
+mulhsu a1 s5 a1
+sltiu s6 tp 1039
+remu s8 s2 t6
+divu s8 gp t5
+add s0 s0 x0
+and s9 a2 t3
+addi t6 s7 93
+andi s6 gp 1908
+div t2 t1 s9
+rem a0 ra a0
+add tp s5 a6
+auipc x0 246606
+sub ra a2 a7
+and s6 s6 a6
+add t2 t3 t6
+addi x0 s0 -1537
+srli s10 t1 12
+remu a2 t0 s3
+sltu s6 gp s4
+lui a5 571444
+xori t3 s11 172
+mulh ra t5 a7
+addi t5 s8 1279
+xori s1 s4 342
+rem t3 a1 a3
+mulh a7 s6 a5
+sltiu x0 s6 -1530
+mulhu t5 a5 a2
+and s8 ra t6
+sltiu a2 t5 -1263
+and s2 s2 gp
+div s1 a2 t0
+xor s8 a0 gp
+andi s2 t5 -1936
+add s9 a5 a5
+and ra a2 s1
+xori t1 t6 594
+and s7 a4 s2
+add a1 s6 x0
+xori t4 a7 -1450
+mulhu tp s6 tp
+sub t1 ra t2
+or gp s0 s1
+divu s11 a7 a6
+mulhu gp x0 t4
+xori a2 a6 163
+ori a0 s8 -173
+sub x0 s11 t4
+addi ra a2 -287
+xori s0 t2 -323
+sltu a6 s6 s5
+rem t4 x0 s9
+slt a1 s4 tp
+slt a3 t6 tp
+srli t1 a1 9
+and x0 x0 a1
+srai a1 s6 15
+ori s0 a3 -1937
+and s7 t1 gp
+andi s2 t4 58
+xor gp s9 s11
+auipc x0 21783
+mulh s0 x0 a5
+add s7 s8 s8
+lui x0 275325
+add s2 s11 tp
+mulhu s3 t1 a7
+remu t4 s10 s10
+sltu a0 a3 a0
+mulhsu s6 a7 s9
+sltu t1 a0 a7
+ori t6 s0 -1049
+andi tp x0 -393
+rem tp s7 a4
+sub s4 a5 x0
+mul s0 s8 a2
+andi t5 t2 -1852
+sltiu s8 a1 -909
+xori a1 a3 1975
+div s5 s6 t5
+srli s10 a4 9
+sra s0 s4 s3
+mulh t4 s10 t6
+add x0 t5 a4
+divu t0 s1 a5
+xor t4 x0 a7
+auipc s7 209240
+or a0 a7 s4
+srli s10 a4 13
+xor a7 s4 a2
+slti t6 s8 -1225
+sub a7 t5 s9
+add s3 s0 s4
+ori t1 a4 -798
+div x0 t0 s8
+auipc s9 127460
+slt s4 t3 t4
+andi s0 t5 1378
+srl a3 s1 s0
+slti a5 x0 -1987
+div t4 a0 s0
+slti a3 a4 -236
+remu t3 a0 t4
+mulh s8 tp s2
+sub s7 s2 a0
+sra s9 t0 ra
+slt a7 s7 s7
+add a7 a0 s11
+slt x0 t2 t6
+div s0 x0 ra
+and s6 t0 s1
+andi s1 s11 -1172
+srl t3 s3 s5
+remu s0 gp a3
+srl a5 s11 s11
+auipc gp 969948
+addi t1 s11 1278
+div s3 gp a7
+slli s1 t6 10
+sra t2 ra t5
+sra t3 s4 x0
+sll s10 s2 s4
+add t6 a6 s3
+slt a1 x0 s4
+sltu t0 s8 t4
+and t6 t0 t3
+or t2 ra tp
+and x0 a3 a6
+srl a1 gp t1
+add s7 a5 t6
+or a2 a6 t2
+sub s7 t3 a7
+andi ra s7 -1936
+xor a7 t4 x0
+slli a5 s3 2
+srl a5 x0 a5
+slli gp s1 19
+sra s2 t1 a6
+slt a5 a1 x0
+sltu x0 x0 t5
+mul t1 t1 t1
+slt s0 s7 s0
+slt t1 s6 s4
+slt a5 a4 t4
+and s3 t2 tp
+sub tp t4 a3
+div s9 ra a1
+sltu s6 t1 s4
+div s5 s7 t4
+or s5 s2 a2
+ori gp a3 -183
+rem a0 s3 s10
+slti s6 s2 -1883
+lui t4 339335
+sltu gp s2 a0
+auipc t1 286558
+xori t4 a6 -1872
+divu ra a3 s11
+xori a1 s1 339
+sll t0 a7 s5
+sra t5 a3 x0
+div a2 s11 t2
+srli x0 s4 3
+divu x0 s1 a3
+slt t2 s10 s1
+ori tp t1 -1178
+srai gp t5 6
+and s8 s10 a2
+div x0 t1 a0
+ori t0 a4 40
+sltiu a2 s5 1983
+sltu a1 s9 a5
+sltiu gp a3 -450
+ori a0 a1 -369
+srli a5 t0 24
+slli a5 s2 14
+mul s0 a1 a1
+andi ra s9 758
+mulh a7 t1 s10
+mulh s0 tp s0
+remu ra a0 s10
+sltu gp a3 a0
+srai a3 t4 14
+addi a2 a2 -1138
+slt x0 s8 t5
+auipc a7 755490
+srli t1 s3 29
+mulh a7 gp t2
+sltu a1 x0 t4
+andi s10 a3 -1204
+xor a6 s8 t1
+sltiu a2 t1 -2003
+sra s2 a6 gp
+srai s11 gp 27
+srl t5 a5 t0
+slti s1 a4 -723
+remu s11 a2 a2
+addi s9 s3 -1542
+slti a7 t2 1456
+slli s9 a5 23
+sltiu a7 s6 -1938
+or t2 t6 s5
+andi a4 a0 -1837
+rem s0 a2 a2
+sub s7 s1 s2
+mulh t1 s1 s4
+lui s0 587509
+auipc s9 216447
+srai s11 s6 29
+div t5 t1 s8
+srli s7 x0 20
+slt s8 t4 s11
+srai s2 t6 5
+srl t6 tp a6
+slti s10 a2 -1792
+add x0 s7 s4
+lui s1 86754
+sltu s6 s5 a1
+sltu t3 x0 a1
+sub s9 a0 s6
+and a0 s4 t5
+sub t1 t6 t0
+sltu s4 t6 s4
+div s3 s0 s10
+addi s3 x0 -369
+mulh s1 x0 ra
+slt tp s2 s8
+mulhsu tp s11 s5
+mulh a0 t0 gp
+remu t1 a7 s8
+andi x0 s9 235
+slt s5 t4 a5
+xori t2 a7 -1260
+mulhu t4 s4 t3
+slti s8 t3 -1756
+ori s11 s11 1754
+remu ra a0 x0
+rem s6 s7 s6
+sltu a6 a5 t4
+mulhu s10 t5 t4
+xor x0 a3 s9
+sltiu s8 s11 -1536
+or s7 t2 a7
+slt t0 t1 s7
+slti s5 s4 1038
+and s7 s3 s11
+mul t3 a2 x0
+sll a1 a7 a4
+srli s2 t1 8
+andi tp s6 -1269
+slti s10 x0 1075
+mulhsu t1 s1 s3
+remu s1 a2 a5
+srai tp s0 0
+divu t5 a1 s8
+slli a6 t1 29
+or gp s3 t4
+xori a3 tp -1737
+sra s10 t0 s3
+mul s8 s4 s2
+mulhsu s1 t1 a0
+addi s3 x0 1378
+add s1 t2 a0
+mulhu tp t5 gp
+addi s1 t5 -1884
+sltiu s7 s8 -1795
+sltu a2 s8 a2
+mulhsu ra gp s11
+sub a2 t0 a4
+sltiu a2 a7 -115
+div s5 x0 s6
+sltiu s7 s3 -1365
+mulhu t6 tp s4
+remu s8 s11 s1
+auipc s9 864809
+srli s3 t3 10
+mulhsu s2 s6 a6
+add tp x0 a4
+mulhu a1 s1 s10
+divu t6 x0 x0
+sltiu s9 t5 -1528
+sll t1 t2 t2
+mulhu gp t5 s5
+sub s7 ra x0
+srli a4 a4 13
+div t3 x0 t2
+slli a2 s0 23
+div s7 t4 t0
+remu s4 s0 a2
+or s11 a2 a5
+srl t1 s2 s9
+sltu a3 x0 s10
+div s2 t1 s2
+slli a7 s9 31
+slli s6 a0 31
+mulh a6 s0 a6
+ori a7 t6 -1106
+lui ra 3972
+mulh a4 a5 x0
+sub a6 a6 s8
+andi a5 x0 -1313
+auipc ra 734749
+sll ra x0 s11
+remu s4 t2 a4
+or t6 a4 a2
+remu t1 t0 s5
+divu a4 s7 s9
+lui a5 627014
+and tp t0 s5
+and gp ra s6
+auipc a6 303278
+sub s3 s4 t4
+add t2 t2 s6
+andi x0 s4 -537
+slti a3 a0 -714
+sub t3 a3 ra
+slli ra a4 24
+auipc x0 748570
+mulhu s6 s2 a3
+srai a1 a5 7
+ori a1 a3 -383
+mulhsu a6 t3 t1
+slti s2 a5 -1503
+mul s7 a4 t0
+lui t0 463694
+divu a2 s11 ra
+mul a1 a3 s7
+addi t5 a4 -1084
+add gp t5 a4
+lui t0 585949
+mulh s4 s0 a2
+sltiu s10 s7 -1685
+mulh t2 t6 s3
+rem s10 a7 a5
+and s10 a3 s9
+mulhu s10 t0 t1
+sltiu s0 t4 -1030
+auipc s11 988409
+or s10 t1 s3
+slti x0 t3 -1059
+addi t5 a4 1809
+or a4 t0 ra
+srl a1 t2 s10
+auipc gp 98103
+xor s4 t2 s2
+slli a2 s8 12
+andi ra gp 704
+lui t3 965297
+and x0 t1 a4
+mulhu t6 t0 s8
+addi s6 a1 -1018
+slli a0 x0 24
+rem t2 s4 a7
+add s7 t1 t3
+remu s11 a4 t0
+sra a6 a5 t3
+remu t6 s2 s9
+slti a5 t2 329
+srli t0 a5 22
+lui a3 913035
+divu a1 tp t3
+and s11 t4 a2
+lui t3 612696
+xor a3 a0 s9
+mulhsu a3 a2 s7
+or s11 ra s2
+mulhu s1 s0 a1
+div a0 t6 s1
+addi t3 t3 -873
+divu a6 s9 s6
+mulh s6 t4 a4
+div a3 s0 a1
+srl a7 t6 a4
+sltiu s9 s11 1739
+sltiu s8 a0 -865
+and s3 a1 a4
+srai t6 a2 19
+sll gp s1 a1
+sra a7 gp t0
+slt x0 a4 x0
+sltu gp x0 t1
+sll a2 a1 t2
+mul t3 a0 a0
+sltu t4 ra a6
+srai a0 ra 21
+sra t3 a7 s2
+slt s1 s2 t5
+sltiu a5 s9 -221
+xori a4 ra -609
+or t3 a6 t4
+remu s8 gp t0
+addi x0 a4 -531
+addi s7 gp 1336
+ori a5 a6 -543
+srli a4 s5 15
+mulhsu a6 s11 s5
+sll gp a0 t3
+div t3 t2 ra
+mulhsu a7 a6 s2
+remu s7 s10 a7
+srai s9 s3 22
+rem t2 tp t0
+andi a1 a1 -237
+auipc s5 675235
+div t4 ra t5
+andi s9 a3 -1613
+xori t1 s9 -488
+sll s8 s4 t6
+slt s11 a6 a0
+or a3 a4 tp
+slt t3 s7 ra
+sltu a7 x0 s11
+xor t4 a2 t6
+andi ra a6 -1006
+or a1 t0 s9
+sltiu a7 a5 -243
+ori t6 a7 -1518
+and t4 s11 s7
+srai a1 a1 13
+andi s6 s1 -1644
+srl t1 s9 s7
+sltu a3 s1 a4
+srli ra t1 31
+addi s0 a6 -799
+divu t2 s10 t1
+slti a0 ra -2035
+auipc s8 204729
+srli s9 s4 18
+rem t1 a4 tp
+slt t0 x0 t2
+xori s7 a4 732
+div s4 t0 s0
+sll t4 s0 s4
+sltu s5 s3 a7
+slt t5 t4 s5
+ori ra s6 1048
+remu s0 s7 a1
+ori a0 t5 1867
+sll a2 gp s10
+slt s6 s10 ra
+mul s10 s3 s9
+xori s5 s8 383
+mulhsu t5 ra x0
+sltiu s0 s2 -282
+mulh s11 t1 tp
+mulhu a4 ra s8
+auipc a5 280235
+sltiu ra ra -848
+andi s7 s11 178
+lui s11 751796
 srli a6 t5 12
-slti t6 t4 -1496
-sltu t3 t6 gp
-remu a6 a7 t4
-mulhsu s10 a0 ra
-remu s11 a6 tp
-auipc t3 434496
-sra tp a7 a3
-ori s0 t1 -1054
-add a6 s6 s4
-lui t5 440098
-slt a1 t3 a4
-srl t1 s11 tp
-slli s7 t0 2
-sltiu s4 t0 -1166
-slt s3 s2 s0
-divu s8 s6 s9
-slli s4 t5 17
-or s7 t3 s9
-remu t6 t5 s4
-div a5 s8 t6
-lui s0 800006
-mul x0 s1 s11
-rem s10 a2 x0
-sltiu s9 s9 -1690
-add t6 s7 t3
-addi s3 x0 1397
-slli t1 t0 18
-sub s10 a3 x0
-srl t2 ra t4
-andi t5 s1 1801
-rem s3 a2 t1
-sltu a5 s9 a1
-mulhsu s11 s2 t4
-rem t5 a0 s11
-and a3 s2 s6
-xor s7 s10 ra
-or t2 a6 s2
-slli a7 t0 6
-lui s9 775318
-srli s2 ra 25
-sub s3 t0 a4
-mulhu s4 t1 a7
-addi t0 s6 -19
-sltiu t4 t0 -1321
-or t1 s0 a1
-div x0 x0 t0
-slli a1 s0 26
-lui s10 275441
-sltiu t6 t4 -222
-mul s8 s3 s2
-slli s11 t2 16
-slti x0 s9 1893
-sub x0 a0 a7
-lui t1 150315
-srl t2 t0 t2
-sltiu t0 s4 -752
-mul t4 t2 s0
-remu t1 t2 a4
-xor t2 t5 gp
-lui s11 1043780
-sltiu a6 t4 -80
-add a7 a5 s8
-slti a3 a7 -1493
-slli s0 s8 7
-slt a5 a0 t1
-xori s7 ra 1729
-slti s5 gp -1894
-xor s2 tp s2
-xor a7 a5 ra
-xor a3 a7 s0
-slt t3 t6 a7
-srl s9 s0 s6
-srl gp x0 s4
-ori gp s6 1868
-and ra a6 s7
-remu s10 a1 s4
-sltiu t2 t0 -202
-slt t4 s10 a3
-slli a6 s7 18
-lui t3 955889
-xor gp s7 t3
-slli a7 s9 7
-sra s1 s1 tp
-auipc s2 193018
-xori x0 ra 237
-srli s10 a5 3
-and t1 a2 t1
-rem s8 t4 s10
-divu t4 x0 t3
-ori s6 gp -1720
-ori s5 a5 1182
-or a7 tp t3
-sub ra a5 s8
-ori x0 ra 589
-sra x0 x0 s10
-srai s6 a6 6
-slti s11 a6 1730
-auipc t3 837882
-srli s1 t2 29
-andi a4 t0 -414
-add a5 s1 s7
-auipc ra 658076
-lui s1 315874
-mulhsu a6 s11 a0
-slti s1 s6 291
-mul s9 a0 s4
-slt a5 a2 s8
-auipc s1 69113
-sltu ra s4 a7
-sltu s9 a1 t4
-div t2 ra s7
-auipc s4 575294
-srli t3 t1 0
-remu s9 t6 t0
-xori s1 s7 -317
-div s7 a0 t2
-sltu s2 s1 a1
-slti s9 t3 -711
-mulhsu a7 s1 ra
-slt a1 s4 a4
-srli t2 ra 16
-slt a5 a5 x0
-xori s10 a4 402
-sltiu x0 s2 -462
-mulh a4 s2 a7
-sub s9 a0 a5
-divu s9 x0 x0
-andi a3 x0 554
-slt s2 a5 a2
-rem a0 x0 a7
-slt t0 t2 t0
-remu s0 gp t2
-mulh t5 t4 s0
-sll a4 s6 tp
-remu s4 x0 s2
-ori gp s0 1315
-slli t3 a5 20
-slt s7 t6 gp
-div a4 s11 t3
-xor s4 s0 tp
-ori a2 s11 -1790
-divu t6 a7 a2
-sltiu x0 tp 2026
-auipc gp 1003837
-mulhu s5 x0 t5
-and a0 s6 a2
-rem t2 gp a1
-srl a4 t1 a5
-mulhu gp ra t0
-sll ra t1 t0
-srai s8 a7 1
-addi t1 a0 -112
-rem s3 s6 s5
-addi s6 s11 -1513
-divu t6 t3 s10
-srli a2 a4 30
-lui s1 524769
-div x0 a7 s6
-mulh s11 a5 x0
-rem x0 s8 a7
-mulh gp s3 a0
-and a0 t2 s0
-ori a5 x0 -992
-sltu a4 s8 s10
-slti a4 s9 -861
-div s10 x0 s11
-sll a1 a5 tp
-sub s0 t0 a2
-andi t0 gp -806
-andi a1 s0 -671
-mulhu t0 t6 t4
-auipc a1 201194
-lui a5 1047315
-sltu gp ra s0
-srl s0 s6 a0
-add a6 t5 t5
-ori s11 a1 184
-xor s3 s4 t1
-sltu s3 a0 s6
-sltu a3 a3 a1
-div a4 t5 a4
-auipc ra 220672
-srai a0 a2 12
-div s1 s8 ra
-auipc s6 59930
-srai a4 gp 27
-mulh x0 s0 t4
-mul x0 s10 s5
-xor x0 a2 a3
-mulhu a6 s4 s4
-slti s5 t2 -649
-ori a1 a6 -1098
-slt ra tp a6
-slt x0 gp a3
-addi a0 t3 -1205
-and a3 t4 s11
-slli t1 s8 18
-srai s4 gp 13
-mulhu t4 a2 t3
-addi tp s4 -459
-lui a3 503484
-sub ra a1 tp
-andi a3 s2 -216
-remu a5 ra a4
-div x0 s8 a6
-ori s11 a3 -45
-div a0 s4 t3
-mul s7 ra t4
-sll t1 t6 t0
-mulh s11 t1 s9
-or a2 t3 t3
-andi s8 a0 -1129
-sll s10 tp t4
-addi s8 s0 1352
-slli t1 s1 8
-slli t5 s10 27
-slli a4 t6 2
-sltiu a7 a1 -1788
-ori t5 ra 673
-add t6 t0 a4
-srai a7 t1 29
-add a3 s11 a7
-add a5 s4 a5
-slli t3 s4 19
-slt a5 a4 a7
-slli s6 s8 14
-slli a1 s11 12
-or t0 gp s4
-or s5 s3 s2
-xori s10 s2 2045
-sll x0 a3 a7
-sll s9 s10 t0
-add gp a7 x0
-andi s3 x0 1907
-mulhu x0 x0 ra
-xori t6 t2 -964
-srl a6 a5 a1
-sra a7 ra s0
-addi t5 t5 -1967
-and s1 x0 s0
-andi t3 t1 -1085
-mul t2 a3 t4
-lui s5 426398
-slti gp t1 -1730
-mulh t5 a3 s3
-addi s5 x0 119
-auipc s6 760651
-and x0 t0 a7
-andi a3 t0 1385
-rem a1 t6 s10
-srai t1 gp 1
-div t6 s10 s7
-rem s10 t4 s1
-xori s11 a7 1264
-srl s2 s3 tp
-add t2 s10 a0
-srl x0 a5 a7
-mul t5 a0 a1
-sltiu t1 t3 -473
-mulhsu s3 t3 t5
-sltiu t2 s0 517
-or x0 s3 s0
-sll s4 gp t2
-rem a4 s4 a0
-lui a6 215369
-slt t3 s10 a0
-xor x0 a6 gp
-addi t2 s1 382
-sltiu s3 s9 -526
-sltiu s1 a1 -1680
-xor a5 a3 a0
-remu a3 t2 s3
-sll s4 a4 s0
-mulhu a3 a1 gp
-sub gp a0 gp
-lui t4 366186
-divu a4 tp t0
-mulh tp s6 ra
-slli x0 t4 8
-srl a5 tp s9
-or t6 s0 t3
-slli s11 a0 11
-sltiu t6 a1 1702
-xori s6 a4 -1950
-mulhsu gp gp a2
-or a4 s4 s0
-or t5 a2 s9
-mulhu t4 tp t6
-and a0 a0 a7
-mulh x0 a6 a3
-srl a0 a1 a0
-srl t5 a4 a6
-slli t3 gp 30
-srai t1 a4 1
-div s7 a2 s7
-slti t1 s11 -1756
-mul t5 a2 t4
-slli a5 s5 4
-srli gp a2 28
-mulh s0 x0 s7
-srli ra t0 0
-mulhsu s4 x0 a7
-add a4 t1 x0
-sll s1 x0 s5
-ori t5 s0 -514
-sltu s11 t0 s10
-srai s2 t4 30
-rem ra s11 ra
-srl s5 a6 s4
-srai t2 s7 9
-or s7 gp t2
-sltiu t6 a3 -1973
-sub ra gp t6
-xori t2 t1 -1373
-sltiu a7 x0 -363
-rem s3 t0 ra
-addi s1 t3 -570
-ori s8 s2 1739
-andi s5 s6 -642
-sra t0 t6 t0
-or a2 a7 s4
-remu s1 s6 s4
-sltiu s11 s5 -1593
-sll x0 t0 s8
-srli s3 s1 7
-addi x0 a3 -48
-auipc t4 923651
-xori t5 a1 -578
-mulh s2 a0 a0
-slti s8 s1 1329
-sub tp a7 s2
-div s3 a1 a0
-sltu x0 a0 t2
-or s10 a1 s1
-sll t6 s8 s1
-sltiu t0 s7 -1520
-lui a2 974470
-xori a7 t6 -1887
-lui t1 949708
-xor a1 tp a6
-addi a3 x0 1072
-sll a4 s0 t1
-auipc s6 611209
-sub s9 t6 ra
-mulhsu s10 a1 a3
-ori s6 s1 -786
-mul s0 s1 s2
-auipc a4 795541
-mul s3 t3 t5
-xori s6 t4 -1553
-or a4 s10 s5
-mulhu ra t2 x0
-and s0 s6 s6
-div s0 s1 a1
-divu gp a7 t6
-ori t6 t0 -400
-ori x0 x0 -1277
-remu a5 t2 t1
-and x0 t4 ra
-sra s2 t2 a5
-rem x0 s4 t4
-div t6 t5 t3
-div s1 a7 s6
-xori x0 a7 -1328
-srai a7 gp 0
-srl t6 t4 tp
-xor a0 s7 s4
-sltiu s6 t1 695
-xor s8 s2 t1
-lui s2 598340
+srl s9 t4 s2
+slt s9 ra gp
+slti a0 t1 -1762
+divu s5 t3 s2
+and a2 s10 ra
+srl t0 s0 s3
+add t1 a0 t6
+andi a5 ra 197
+sub s9 a7 a4
+xori t4 x0 -93
+srl gp s1 t2
+sltiu t1 a7 -380
+slli t5 s7 9
+remu t4 s3 s7
+sltu x0 s6 s1
+slti x0 t0 -453
+sltu x0 gp s0
+srli t0 a3 26
+rem a6 a3 t3
+mul a5 a4 s10
+remu t4 s3 a0
+remu a2 a2 s9
+mul s3 s5 t5
+srli x0 tp 7
+xor ra s1 s2
+add s4 s5 a3
+and a7 t2 s6
+sub s11 a6 t1
+slti s1 s7 -769
+or s7 a6 t2
+remu s1 x0 x0
+rem t4 a2 a0
+sltiu x0 s10 -1206
+sra a2 t3 x0
+mul a1 t6 a5
+sltiu t1 a0 -344
+ori s1 s10 -1985
+xori s0 a6 -284
+sltiu a1 ra -882
+sub t2 s4 a2
+auipc x0 546342
+sltiu a2 s11 -1766
+div a3 s5 t6
+slt gp t2 t6
+sll s3 a6 gp
+srl s3 s8 a5
+mulh t3 s4 s1
+div a4 s3 a6
+divu a7 gp t0
+divu s3 a0 t4
+div a2 s3 t2
+and s10 tp t4
+srai s0 gp 14
+sltu s10 s9 a2
+ori tp x0 -430
+sltu s5 a4 s3
+div a1 s2 a3
+div s4 t1 a7
+sltu s1 s6 t5
+sll gp t0 t4
+ori s0 s3 -1017
+mulhsu s0 s3 s7
+sll s3 s10 x0
+slt tp t2 a7
+or a7 t0 t4
+slt s10 s1 a6
+and a7 s1 gp
+remu gp a7 gp
+mulhsu s1 t0 a4
+or s4 s11 s7
+slt t1 a2 s11
+mulh t4 s11 a2
+remu s3 t6 s9
+lui s11 864690
+and a5 s8 t5
+andi tp s2 1370
+remu s9 s7 s3
+slli x0 gp 18
+rem t1 t0 t6
+sltiu s1 s4 1217
+remu s10 tp s3
+or s7 s8 s1
+slli s10 t5 9
+mulhu s10 a2 s9
+addi s2 s0 -298
+andi gp gp -893
+xor s10 s2 a5
+auipc s1 221204
+slt s0 s7 s9
+slli s4 a0 24
+add s2 ra t1
+lui a7 478996
+slti a7 a6 -1752
+addi s10 a6 -161
+sll t6 s1 t2
+sll s2 s11 tp
+lui x0 123010
+mul s7 s4 a0
+srl s3 s6 s3
+mulh tp s6 s5
+srai t6 t4 8
+ori s1 s6 -207
+remu s4 s1 s5
+slti s6 t6 -964
+srl a3 t5 s10
+addi s0 a3 -181
+rem s4 s4 t6
+rem t4 s1 a6
+remu a1 s11 s9
+or s1 t6 a6
+auipc ra 605408
+sll a3 s5 gp
+sltiu a1 a4 -1502
+mul a4 s0 a6
+sltiu s0 a3 -600
+sltu s5 s4 tp
+mulhsu ra t6 t2
+sltiu s6 t0 -1413
+rem t1 s7 s4
+sltu s5 a4 t0
+add t6 s4 t4
+lui x0 119199
+mulhu a6 s0 s2
+sra a3 s7 s9
+andi s6 x0 -1519
+mulh t3 t0 s11
+add a2 a5 s7
+xori t4 s8 -376
+div t1 t5 s0
+xori s6 s8 -1617
+slti s7 s9 2006
+divu t6 tp s9
+mulh t3 a3 a2
+mul s3 t6 t2
+addi t1 s9 -1523
+srai t5 s5 15
+div a7 t1 s8
+sra a7 gp s7
+andi s6 s1 -84
+ori a5 a3 -1202
+add gp s4 t4
+add gp s2 s3
+divu s4 a4 ra
+xori t5 x0 -1096
+sra s4 s11 x0
+mulhu s7 x0 a2
+mulhsu s10 s1 t6
+xor ra s3 t6
+slti t6 s11 -504
+sub s5 s2 t3
+xor t3 s7 a7
+mul a1 a6 a3
+mulhu t6 s7 s4
+andi s2 tp -83
+sltu s0 s1 t6
+rem t6 s10 s6
+mulh a7 t1 x0
+slli s3 t6 3
+addi a3 a6 1159
+remu a6 x0 s0
+and s6 a2 s4
+sltu a3 s3 s0
+xor t0 s9 x0
+xor t6 a4 s5
+auipc s2 994467
+andi a2 s6 -1183
+sub a0 x0 ra
+or s2 x0 a7
+srli s2 s3 8
+auipc a3 787314
+sll t4 t3 a4
+mul a4 s2 t5
+div t3 s8 t0
+addi s4 s2 1653
+slti t4 a5 -1245
+rem t2 s1 s6
+remu t5 s6 s10
+sll s0 t3 gp
+divu s9 t1 x0
+div t3 a6 gp
+addi a6 s0 -334
+addi t5 s10 -845
+divu s6 t1 a3
+sltiu a2 a5 502
+addi a6 t5 -929
+slti s6 tp 779
+xori ra t3 1303
+divu s1 t6 s8
+slti a7 a5 416
+mul gp s9 s9
+sltiu s8 s2 1595
+rem s8 s10 a4
+mulhsu ra t0 tp
+sltiu t0 s4 -203
+srl a4 a6 s3
+rem t5 s8 tp
+sltu s3 a2 s6
+div x0 a7 t1
+srl t2 a0 s1
+add x0 x0 t5
+sltiu a4 a6 -1343
+ori t2 t3 -427
+div t1 a6 t6
+srai a5 t5 29
+srli s7 s1 23
+slli s5 s3 7
+divu a5 a4 t5
+srl a1 t5 a5
+srli gp s4 1
+sll a0 a6 s8
+slt s1 s9 s9
+srl s7 s4 a3
+rem a5 s6 a7
+slt t4 ra a6
+mulh s7 s8 a3
+srl a6 a6 a4
+xori s0 t2 -1725
+rem t4 tp a5
+mul a5 a4 a5
+srli a7 s10 17
+srli s0 a6 2
+and x0 t6 s3
+sll s4 tp a3
+xori t6 a5 -524
+add t5 s1 a2
+srli t4 s4 13
+and a3 t3 t5
+slti t5 t6 -330
+srl a6 s10 a4
+mulhu s10 x0 t4
+sra t4 s6 s10
+auipc s4 691638
+or s7 x0 s4
+ori s2 a3 -1727
+slt s8 t3 a2
+divu s2 t4 a2
+srl a4 s6 s2
+mulh t4 t0 a1
+auipc a1 192463
+sll t5 x0 a3
+srl s11 t1 s7
+sltiu a4 s5 -1036
+slli a2 a2 18
+remu tp s6 s6
+and a6 s2 s10
+div tp s8 a4
+auipc a7 584129
+div ra t3 s3
+mul s6 x0 s9
+xori a4 t6 -641
+add s2 s4 t5
+ori a1 a7 1675
+div t5 s7 s3
+remu tp a7 s2
+add gp s9 t3
+mulhu gp s10 t2
+srl t5 a2 a6
+add x0 ra s1
+mulh s7 x0 s1
+div ra a5 a4
+mulhu x0 ra s6
+mulh s7 s3 t1
+sltiu s1 a1 989
+srl t6 s6 s10
+mul t4 s10 a4
+sra s7 t4 t2
+mulhu a5 t6 a1
+mul s9 a3 a1
+sra x0 a3 s7
+sltu a2 s6 s9
+divu tp s1 t1
+or t5 x0 t4
+srli t2 a4 26
+srl t3 t6 a4
+mulh t4 s5 t4
+sltiu t1 s2 -1296
+and x0 t6 s5
+mulh t6 t4 t3
+andi s5 s2 -1016
+srl t3 s10 tp
+rem t5 t1 s7
+sra t3 s4 a3
+mulhu a1 s0 t2
+add s10 s3 s10
+divu t3 s7 t3
+mulh s4 s10 gp
+add tp s1 t4
+and a1 x0 ra
+lui a4 936121
+slt a3 t6 a1
+slt ra a1 s8
+slli s2 t1 27
+xori a1 gp -192
+xor s8 s8 t1
+remu a3 s2 t2
+slti s8 s1 -1587
+sltu a4 s5 a3
+slti ra s8 724
+slti t5 gp -8
+and x0 a3 t3
+add a4 tp x0
+srai tp s7 25
+srai x0 a6 31
+ori a2 s11 -505
+sltu s1 t3 a5
+sltiu s8 s8 172
+slt s5 s5 s4
+or t5 tp t2
+rem s11 s7 ra
+slli a1 x0 29
+ori t2 t1 -507
+lui a2 565747
+sltu t1 s9 s4
+andi a0 s9 544
+srl t4 s2 a4
+div s5 s11 s4
+slt s3 ra t6
+mul t6 s6 s10
+sra t1 s6 a7
+sltiu t1 s7 -10
+divu t6 t5 s3
+sll t4 gp s10
+add s7 s11 a0
+ori a3 t0 1563
+srai s1 x0 15
+mul t2 s10 x0
+slt s7 t5 a3
+slti t0 a3 -1742
+and gp a2 s2
+slt s5 a3 s4
+and s4 a4 a5
+xor t1 ra x0
+srli a2 t3 16
+srl s10 a7 t0
+slt s10 t2 s11
+ori s9 s4 -1029
+mulhu s9 s2 t0
+rem a2 ra tp
+srai s6 a3 3
+slli tp s9 19
+addi x0 t0 -170
+or a7 t5 a4
+sub t2 a4 x0
+remu a5 a6 ra
+sra x0 tp x0
+and t0 s4 s3
+slti t0 a1 -1988
+rem s11 s5 gp
+srli t4 a7 26
+addi s9 a5 -306
+andi a3 s3 -869
+slti t4 s8 -888
+remu t2 t0 ra
+sub gp x0 s7
+lui t1 646712
+sub s2 s4 ra
+auipc s3 451174
+div t4 t3 t5
+xori x0 s5 -59
+sll s3 s6 a7
+xori t3 a4 1147
+andi t0 s11 -1064
+sll ra a6 a5
+sltu t3 s0 t3
+mulhsu a4 t2 s7
+andi a5 s3 1050
+mulh t1 t5 a2
+lui s5 208305
+auipc s2 45150
+addi s7 s4 770
+add t2 x0 a1
+sltu tp t2 a6
+add a4 s6 s3
+srli a4 s1 16
+sltu s0 x0 s4
+lui t4 26845
+rem ra s5 s11
+add s3 a2 t6
+and t5 a7 tp
+sltu a0 s11 a0
+lui s3 624472
+slt a0 a6 gp
+mulhsu x0 s4 s5
+mulhsu s10 t3 a2
+sub a5 s2 a1
+sll s10 t1 a4
+ori t2 t6 -1796
+mulhsu s1 t3 a6
+srai a3 x0 16
+srai s3 a6 1
+div t6 t2 s5
+mulhu t4 t6 s4
+sub t2 a2 a3
+add a4 tp t3
+remu x0 gp t0
+and s5 s3 s1
+remu x0 ra a6
+sltu a2 s1 s3
+sltiu a5 t3 -1185
+slti s9 s9 -620
+sltiu s11 gp -1013
+sltu t1 s1 a1
+sltu t3 s10 s1
+slti s0 s11 -486
+rem s2 s6 a4
+srl s7 s11 t5
+slli s9 t3 19
+auipc s4 993176
+sll a2 s9 s11
+add s10 s11 s5
+addi s11 s8 -535
+and t1 s8 s5
+or s10 t2 s11
+div s4 s1 t2
+xori t1 a7 -1407
+add x0 x0 a7
+or a2 s8 ra
+addi s4 t0 153
+mul s6 s11 a2
+srl s7 x0 a4
+mulhu t3 a4 ra
+mulhsu t5 a5 s6
+andi t3 a3 -852
+div s6 a2 t4
+mulh a0 s5 s9
+sll a2 t1 t4
+div a7 a6 a4
+sll t6 t6 t0
+srli t4 s3 23
+sra ra a2 t2
+xor s4 s3 s9
+xori t3 s9 -378
+auipc t6 542246
+add t5 s5 a1
+mulh a5 gp s6
+lui s8 51214
+andi s7 t6 -483
+sll s7 t0 s7
+or t4 a4 a0
+srl a2 s8 s9
+xori a1 a1 -1147
+divu s2 s0 t1
+lui a7 821955
+sra t4 t4 s0
+addi s10 s0 -544
+add t2 s0 s6
+mulhu a5 s10 t0
+sltiu a0 s8 13
+andi a4 s11 -605
+or s6 s9 s5
+div t5 t2 a1
+auipc a1 217130
+addi a2 s2 -1424
+div a0 t4 a0
+mulhu ra a1 a2
+or a6 a5 a7
+addi s11 s4 -634
+xor a4 a1 t3
+div s6 a4 a0
+auipc s5 652241
+xori s5 s2 1942
+slt tp x0 x0
+sra s8 a5 t4
+and s3 s0 ra
+div s7 s7 t1
+slli x0 a2 8
+lui t1 385162
+sltiu x0 s3 -1759
+slti s9 s9 -1910
+srli x0 t6 15
+divu t0 x0 s3
+divu gp a3 a0
+sll s0 s11 s4
+xor x0 s5 a3
+add ra s4 a4
+andi t5 a4 -478
+slt s6 a1 tp
+srai a1 t6 24
+srli a1 t2 29
+andi gp t5 -1945
+sltiu a0 gp 1292
+xori ra s9 -298
+sltiu s3 s11 418
+lui s2 442541
+sub a4 s1 s0
+sltiu s6 t2 1101
+mulhsu a3 s9 t4
+mulh a4 s8 s8
+div x0 x0 s11
+sra t4 t1 t5
+slt a7 a5 s4
+slti a2 a3 -421
+div t5 a4 s9
+sub s2 a3 a3
+srli t0 s4 30
+slli s7 t6 9
+div tp x0 t0
+sub tp s9 s0
+srli t2 a1 7
+andi s9 s10 -244
+sra s3 s7 t6
+lui s9 776530
+mul a5 x0 t6
+slli s3 t4 10
+addi t0 t1 -234
+mulh s1 a5 t2
+mulhsu a4 s8 t5
+mulh t4 t3 a4
+addi t3 a0 -1889
+mulh s9 a0 t6
+andi t4 t4 -837
+remu t2 s11 a2
+mulhu t5 t1 s3
+slti s4 a2 251
+slti s9 a2 -1245
+addi s2 x0 1917
+sltiu gp t5 -467
+mulh a3 s6 s0
+slli t4 tp 6
+lui t4 579605
+remu t3 a0 s10
+xor t2 s11 x0
+srai x0 gp 9
+srl a1 x0 x0
+ori t0 a4 -806
+andi t4 s8 -1575
+sltu t6 a5 ra
+slt t5 a2 t4
+sll tp a2 a7
+sltu s11 a5 gp
+remu s11 t6 s1
+mulhu gp x0 t1
+sll a3 a3 t4
+and a5 tp t1
+andi s8 s8 1546
+xor s11 s1 a7
+mul a5 t2 a2
+rem s2 s9 s1
+slt t5 x0 s1
+xori s9 tp 360
+ori x0 t2 1256
+slli a7 s5 2
+div a3 t4 x0
+remu a7 a6 x0
+slti a2 ra 277
+divu s4 x0 a2
+sub s4 t2 s6
+auipc s8 806905
+lui t6 362466
+slti gp s7 -817
+srl t3 s3 x0
+andi a2 t6 600
+sltu a2 x0 t5
+sub t3 gp s8
+and t5 a0 s10
+sra a5 s2 a2
+srl t5 t5 s8
+rem x0 t4 t5
+auipc s5 465890
+sll x0 x0 a6
+rem s4 tp s3
+ori t2 a5 -1790
+sub a0 gp gp
+mulhu a5 t4 t2
+srai s5 s3 13
+srl a7 tp s10
+rem a1 s8 gp
+auipc ra 890967
+divu t6 x0 t4
+slt s7 a3 a2
+mulhsu a5 s5 a2
+mulh t4 s5 a7
+mulhsu a7 t3 s11
+mul s7 t5 t0
+sub t6 t6 t1
+or s3 x0 x0
+mulhsu s11 s1 s0
+addi s2 t0 938
+add a4 s4 s9
+sra t1 a3 s6
+sltu s2 s5 s0
+or t6 s10 x0
+sub s7 t3 x0
+remu a5 x0 x0
+xor s11 x0 tp
+sll s8 a3 s5
+ori t6 t2 -1245
+sltu a5 a1 x0
+and s9 t5 s6
+xori a0 s9 1756
+mulhu gp t1 t6
+sltu a7 s6 s3
+xori s4 x0 -830
+mul x0 tp tp
+rem a0 t4 a4
+ori a4 t1 -1367
+or t5 t5 s7
+sltu s3 t3 s5
+lui t0 458295
+sub t6 a7 t1
+sub s9 t1 s8
+div s6 x0 t0
+xor s3 a5 a1
+auipc s5 982864
+add a3 t1 t0
+mulh s2 tp t0
+xor s2 s2 a5
+sub t3 t1 t3
+divu t4 s8 s7
+and a6 a5 s6
+slli a0 a7 10
+add a3 t3 s6
+mulhsu a4 t5 a4
+and ra s5 a3
+srli a1 a3 9
+srai s6 a0 5
+srai a5 s9 29
+div t3 a1 s9
+sra s4 tp s11
+slti s0 s10 1285
+mulh t6 t3 t2
+lui s4 839746
+srli s3 s4 8
+addi a7 s10 -536
+srai s10 s3 20
+and a2 tp tp
+srl t1 t0 a0
+mulh x0 s2 t3
+divu tp gp s1
+slti t1 x0 469
+srai s0 a7 17
+mulh gp a4 t2
+divu gp s6 s5
+srai ra a0 15
+sltiu s6 s6 1831
+sub a0 s5 a3
+srai s5 s6 21
+sltu x0 s1 a0
+divu t2 t0 s9
+slli a1 a2 22
+slt s0 s5 s8
+sub t0 s11 t3
+srai a3 t2 2
+divu s8 s4 t1
+lui s9 491517
+xori s2 a1 -165
+lui a2 88568
+mulh t4 a1 s7
+mulhu t0 s7 x0
+xori a7 s7 1942
+sll s4 a4 s3
+lui t6 153492
+mulhsu ra t4 s10
+sltiu s8 s11 -1692
+sll ra s9 s3
+slti t1 t5 1255
+ori a5 s10 460
+srl a4 s5 a4
+auipc ra 357105
+remu a5 a7 a4
+rem a5 s10 gp
+remu a1 a5 a7
+sll a0 t5 gp
+divu t6 s3 gp
+mulh a7 a1 t0
+xori s4 a6 -1278
+mulhsu gp s8 x0
+divu s1 t4 t5
+slti t1 gp 569
+sub t1 a3 t3
+andi t3 a1 -15
+xori s6 t1 -765
+xori s1 t2 -90
+slt gp s2 a1
+srai s2 s9 21
+ori ra ra -242
+rem a3 tp s6
+ori t5 s8 -903
+andi s5 t2 -491
+div tp tp tp
+mulhu tp t6 x0
+lui a7 4673
+or s5 t5 x0
+add t3 s3 s4
+sltiu a0 x0 -1848
+sra a4 t3 a2
+remu s8 s0 x0
+srli t6 s11 21
+mulhu s6 s5 t4
+srli x0 s6 21
+sll s5 t2 s8
+div t5 t0 s5
+divu t0 s9 s4
+and t5 s1 s3
+rem t4 s4 a3
+sltiu a0 x0 -1855
+xor t2 a5 x0
+srai x0 a1 10
+lui t0 158386
+sltu a3 s8 s5
+and s9 a6 s2
+or x0 a1 x0
+or t5 t1 t3
+sra t3 x0 a7
+andi s2 s6 -1174
+sra t4 a1 tp
 srli t4 a7 30
-xor t6 s5 ra
-lui tp 480740
-rem a7 t4 a4
-mulhu t6 s8 a3
-sltu s8 s7 a3
-div s3 s1 a1
-slli t1 gp 13
-sll t3 gp ra
-slti s8 s4 -286
-mulhu tp t4 s7
-lui t6 105288
-div t3 t4 t1
-mulhsu s1 a5 s10
-remu a6 t2 s2
-sltiu a6 x0 -1001
-sltu s4 x0 t4
-sra t2 s1 s1
-sll a4 t1 t4
-xori ra a3 856
-sra a3 s0 s3
-xori a0 s0 -1336
-or a1 a7 a6
-div s6 x0 a5
-sll s3 t1 s9
-lui s11 388731
-remu ra s4 s11
-div t0 s5 a7
-xori s10 a2 -1279
-srli s5 t5 22
-mulh s11 s2 a3
-srl gp a6 a3
-or ra t2 x0
-and s10 s0 t3
-div s4 s8 a6
-add s10 s5 a3
-remu t6 s6 s11
-and s3 s7 a1
-ori s3 a6 -1165
-slti ra a4 -1450
-addi s7 gp 1840
-xor ra s5 t4
-slti x0 s11 -290
-and s2 ra t4
-sltu s0 a5 s11
-xori a3 a7 -26
-remu a7 t1 t4
-mulh s7 ra tp
-sltu a5 a5 s11
-slt a0 t3 a7
-div s6 s1 a1
-auipc a4 476957
-or a7 s7 s9
-div tp a1 s0
-sltu s4 t0 t3
-mulh a3 s10 s7
-srai s8 t5 18
-xor t5 s0 a7
-and tp s4 s9
-sub t0 a0 a2
-divu t5 t1 a7
-sltiu a4 t6 -1742
-rem gp s7 x0
-mulhu s8 a7 s7
-srl s6 s1 t2
-xor a3 s2 x0
-and t5 t4 t2
-ori x0 a3 -1224
-srl a0 a2 x0
-mulh a6 t2 t1
-sltu a1 s10 a2
-rem s0 t0 a1
-addi s5 s3 -816
-xori gp t6 -1914
-add t6 s5 a4
-xor s4 t3 s11
-srl t3 a4 s5
-slt x0 tp s1
-rem t6 x0 t1
-sra x0 s1 a4
-slti s11 s10 658
-rem a1 a4 a4
-mulhu s7 s8 t6
-srli x0 s6 28
-srl a0 a1 t2
-ori s11 s10 -146
-or ra s10 a3
-ori s8 a0 583
-add a3 s6 t0
-sll x0 a5 a2
-mul a3 a2 a7
-xori s4 s7 -814
-andi t0 s6 -1867
-srai s5 s10 2
-and ra s4 ra
-ori a5 t3 -51
-slli t6 s8 22
-slti t4 s1 -238
-mulhsu a3 t5 a2
-sltu s6 s10 a5
-slti s4 s0 1878
-ori t0 a3 -1121
-divu s0 s3 s8
-srli ra tp 25
-sll s7 a5 s10
-slti x0 a0 -391
-andi tp t6 -975
-mulh s2 a5 a6
-sub s2 s7 t2
-srl ra s5 t4
-sub t4 x0 s10
-sub t0 s9 a7
-addi s7 t0 -980
-addi s3 gp 785
-addi a3 a3 1538
-mulhu t5 gp ra
-remu s10 t6 a6
-divu a5 t1 s3
-addi a5 a0 -1045
-xor t2 tp a7
-mulhsu s9 a3 t5
-andi a7 t6 637
-mulh t4 s10 x0
-sra a1 tp s7
-sra t6 t4 ra
-mulh t6 a0 s10
-sltiu a3 s2 1018
-srai a2 a4 5
-sub ra s7 gp
-mulh s6 s4 a2
-remu a3 t6 s7
-div t3 t4 gp
-div s1 t1 s1
-xori a0 gp -565
-srli s10 s2 1
-mulhsu gp s9 s6
-xori x0 s2 -1107
-auipc s5 1020408
-slli tp t6 24
-srli a2 a2 26
-and s6 ra t1
-lui a6 533937
-srl t4 tp s5
-mul t4 x0 s6
-rem s8 t3 a0
-remu a3 ra tp
-sltu a5 t2 gp
-and t0 s5 s4
-slli t3 s10 19
-srli s8 gp 16
-mul gp ra t0
-div ra tp s6
-mulhsu s10 a7 s0
-sra ra s7 x0
-sll gp s0 ra
-remu s0 a3 a4
-mulhu s4 s2 x0
-srl s8 s4 s3
-ori x0 a4 -328
-slti t4 t1 -1498
-remu t0 s8 s5
-sub s4 t2 a6
-sra s3 a0 t2
-rem a4 a2 t6
-mulhu s11 ra t2
-mulhu s2 a4 ra
-xori t6 t6 401
-sltu x0 t1 t4
-auipc a4 748525
-srai s8 s9 31
-slli s4 gp 16
-srai s6 s9 27
-mul a2 s5 a0
-auipc s10 327611
-sra a5 ra x0
-slti ra s4 112
-xori t5 x0 269
-or t1 s11 ra
-and x0 t3 ra
-divu a4 s7 t6
-srli t4 x0 19
-slt s5 a0 tp
-xori t1 t4 1681
-addi a1 s2 -269
-div s6 a4 a1
-auipc s4 749133
-sltu s11 t2 s10
-and s9 s7 s8
-andi a7 t4 1990
-divu s2 s11 s5
-xori t2 s9 -1490
-divu a5 s11 x0
-add t6 a2 s5
-slt t0 s0 a6
-sra t5 x0 s10
-and s5 t5 a0
-slti t4 s3 -1349
-addi x0 t4 -1142
-andi t0 s8 1330
-rem a5 s9 s5
-divu s10 t0 gp
-mulhu s4 gp s10
-mulhu t3 s1 a5
-srl s5 a0 a3
-sll t3 s1 a2
-mulh a4 a3 t6
-srai s0 gp 2
-sub a5 s10 s10
-srl a7 t0 a0
-xor a1 a5 s8
-addi x0 a3 1566
-xori tp x0 -1404
-and t0 s3 s7
-srli s2 gp 5
-xor a4 a1 a5
-ori tp t0 -596
-rem x0 x0 a2
-auipc a3 913374
-srl s9 t2 t0
-andi s11 s0 -657
-add s4 s2 s5
-remu t3 s3 s4
-sra s3 a3 s7
-ori a0 s3 -1749
-sub x0 tp s5
-slt ra t6 s11
-slti s1 gp 1578
-andi s6 a7 -1206
-mulhu t6 a5 gp
-sltiu t4 a1 -864
-xori t5 x0 -1650
-rem t6 s10 s10
-sll gp t3 t0
-sltu a6 t1 s1
-mul s1 s6 a5
-sltiu a2 t4 -61
-sub t3 tp t4
-srl t2 a0 a6
-div s6 a7 s5
-auipc a7 868350
-divu x0 a0 a6
-remu t6 a2 s9
-mulhsu s6 s7 a2
-srl s5 s5 a6
-xor t2 tp s1
-div gp s3 s5
-srl s6 a5 t2
-addi s1 tp -19
-add t6 t0 t0
-andi t0 s8 795
-sltu a4 x0 a3
-rem t2 s7 a0
-div a1 s7 s6
-mulhsu t2 s3 t0
-xor a1 a4 x0
-slti t4 x0 446
-and a0 s3 gp
-slli t6 t2 29
-mulh t0 t6 s8
-slti s11 ra -1030
-slt a5 a6 ra
-slti s5 a1 -1384
-mul t3 a5 s1
-mulhsu s1 t3 t2
-and t4 t1 s5
-slt s3 tp s9
-srai s8 x0 11
-slli s6 s6 2
-addi t6 a7 -628
-sltu a0 t6 a1
-andi a0 s10 -1799
-slti s0 x0 -1671
-andi t6 x0 -901
-or t2 a4 t1
-slt gp s3 a3
-xori s0 x0 -519
-mul t5 a0 a3
-xor s7 t0 s6
-rem s4 s11 s2
-slt s5 s7 x0
-slti s2 x0 790
-sltiu s6 s5 -1777
-divu s1 s11 a1
-add t6 t3 tp
-mul t5 x0 s5
-auipc gp 284247
-xor s0 a6 a0
-sll s1 s7 t3
-lui s11 804850
-add a7 s4 t0
-and x0 s8 a1
-srl t5 t1 t0
-mul s10 t5 s4
-add tp x0 x0
-div a1 a3 a7
-slli tp ra 12
-auipc t6 124500
-or s2 t6 t2
-sub s0 s2 s9
-remu a1 t2 x0
-xor t0 x0 t1
-mul s2 s4 a2
-slti s5 a3 835
-mul gp s1 x0
-slti gp t1 1093
-sltiu s1 s7 -683
-mul s6 t0 a0
-auipc a1 65011
-divu t2 t1 s9
-slli s8 a2 5
-srl s1 s2 gp
-div s7 a5 s2
-lui s0 409557
-slti s5 s5 -755
-ori a2 s2 485
-or a3 ra s6
-srai s9 s11 1
-mul a1 s2 gp
-sll a3 x0 t4
-div x0 a0 a7
-rem x0 tp t1
-ori t3 t2 -1926
-sltu s10 s5 t4
-remu s5 t3 s0
-slt s11 s8 x0
-xor s9 a3 a4
+slti s7 s2 1738
+add t5 a1 gp
+xori a1 t5 -1325
+sra t6 a2 tp
+slti gp x0 1439
+sub s11 s3 s7
+mulhsu s8 s5 t4
+srli s4 s0 17
+mulh gp a0 a7
+addi s6 s1 -1684
+slt ra x0 a7
+and a7 t2 gp
+ori a5 t2 -1801
+mulhsu gp gp s7
+andi gp a6 573
+ori a4 a7 -301
+slti a7 a1 -1605
+divu a2 s4 t2
+slt t6 a3 s2
+auipc t4 786427
+slt a0 a3 a0
+xor x0 t2 a3
+or t3 x0 s6
+rem s11 x0 ra
+rem s11 t4 s4
+mulhu gp x0 a3
+sll x0 a7 s0
+div s8 t3 s5
+srli a0 s0 0
+xori s9 s5 51
+addi t0 tp -438
+mulhu t5 t3 tp
+auipc s7 425051
+mulhsu s5 s7 x0
+mulhu s7 a6 t4
+srl s5 s0 s10
+mulh x0 a0 a3
+ori t2 x0 -335
+srl tp ra a6
+sltu s2 t4 s10
+and x0 s3 gp
+and s3 t6 s5
+andi ra t5 -1838
+xor a2 a0 x0
+remu t0 t1 tp
+add s2 t3 t1
+slti s1 t3 1254
+srl a5 a7 a7
+mulhu s9 s11 t1
+div s10 t0 s10
+srl t5 a0 s6
+xori x0 s10 1961
+addi a5 a3 -626
+srl a7 t2 t5
+lui ra 974483
+auipc a4 385597
+slli t2 a0 13
+mulhu a0 a4 s2
+lui t0 269826
+rem tp s7 t5
+mulhu s9 s4 ra
+and a4 s9 s0
+lui s7 786764
+sltiu t3 t1 1014
+mulh x0 s7 t6
+sltu s6 s0 t6
+mulhu t2 s4 t2
+mulh x0 s6 t3
+auipc t5 586732
+or s3 gp ra
+sll tp a2 a4
+or a6 x0 s1
+remu s7 s3 a1
+sll a6 s1 s0
+mulhu s11 a7 s1
+addi a7 s5 1813
+lui t6 697941
+div a0 s1 a6
+mulhu s10 tp t6
+slti s0 a5 -577
+add s9 t1 s7
+mul s6 s11 s2
+slti s11 gp -1359
+remu s1 s0 s6
+xori gp t5 -601
+srai s8 s9 14
+mulhsu t6 s4 a4
+sra t1 a5 a1
+slt s5 t5 a7
+rem a6 s2 gp
+ori s10 t0 -986
+lui s11 382034
+mulh s9 s6 a6
+addi tp s9 -1442
+rem a5 s9 t4
+rem ra t4 s4
+xori a0 a3 -555
+srai gp gp 2
+sll s7 s2 s6
+xor a0 a4 a6
+xori t6 a4 1224
+or a5 t0 s8
+add t1 s3 s9
+auipc x0 662495
+srli s4 a3 23
+mul s7 a7 s9
+add x0 t2 t2
+remu s4 x0 a6
+add a3 a4 t2
+mulh a2 t2 t6
+srai a7 s5 10
+srl s11 a1 t4
+mul a5 t0 a0
+srli s0 s8 11
+srai a3 a5 18
+rem t4 s1 t0
+addi t6 s8 -693
+xor a7 s10 t6
+rem a4 s4 t5
+mulh s2 s9 a3
+mulh ra s9 t1
+rem s5 s3 t3
+rem a2 a7 a4
+add x0 tp a1
+remu s2 t1 a4
+and t6 a4 s2
+slli a7 ra 14
+addi s4 s11 -6
+slli a0 a6 14
+srli a2 a2 9
+slli t3 t3 0
+mulhu a4 t4 a4
+sltiu a1 s6 209
+remu s10 a6 t6
+auipc s7 371341
+add t1 s3 t0
+xori s8 s4 -1762
+sltiu s7 t3 1088
+sra a4 s5 t2
+andi a5 ra 1379
+divu s10 a6 t5
+remu s4 t3 ra
+andi a0 a6 -709
+andi s7 tp 879
+remu a4 s11 s11
+lui gp 817463
+srl s10 a1 t5
+srai s6 t0 6
+sra t5 s4 a3
+xor x0 gp s2
+sltu t1 s8 t5
+sll s8 a1 a7
+slti a0 s4 -1070
+andi s2 t1 -1640
+slt t1 a2 s8
+div t4 s2 s1
+ori t6 a1 -39
+and s0 t0 s10
+xor t5 x0 t6
+srai s1 t4 18
+rem s9 s8 s5
+sub tp gp s7
+ori s7 a5 1446
+srl t1 s5 a2
+remu a3 s4 s9
+and t6 t5 t2
+srl a0 a4 t5
+mul a5 s7 x0
+mul x0 t5 a5
+or s8 t1 x0
+lui s3 882255
+or a0 s0 t0
+div t2 a0 s8
+addi t3 s6 937
+mulh x0 a1 s4
+addi a7 t4 -1534
+mul a3 s5 a3
+or tp a7 gp
+lui a6 680481
+remu s11 s2 s11
+xor a2 s9 t4
+sltu s3 t4 s2
+xor t2 s3 t3
+mulh t6 t3 t5
+xori tp x0 671
+or t5 s3 s1
+div t1 gp x0
+add s0 s5 t4
+mulh x0 s0 s7
+sub t1 s10 s1
+sub s7 s1 s7
+andi a4 a2 -786
+sltu t0 t3 a3
+srl s8 t1 a7
+mul s11 s11 s8
+slti a5 a7 -1099
+ori x0 x0 527
+mul s8 s2 t0
+or s10 t5 s3
+srai s3 a1 28
+sra t1 t6 a2
+div a0 tp t6
+mulhu tp s7 a0
+srl a6 s2 a4
+mul s8 s4 a2
+auipc a4 517232
+mulhu s0 ra s0
+mulh gp a0 t2
+sltiu t6 s6 -1315
+sra t1 s1 s5
+srli gp a6 31
+xori a2 a7 1763
+remu a7 s8 s6
+slt a2 a0 a7
+mulhsu t6 t3 a5
+sra t4 s11 a0
+ori t4 s4 -386
+slt t3 a6 s5
+slt s10 gp t0
+remu s10 s10 gp
+or a5 a5 tp
+add a5 t6 s10
+mulhsu t2 a5 t6
+auipc a0 619811
+andi a6 tp -748
+srai s7 x0 9
+sra s8 a1 a1
+xor a5 s9 a0
+or s11 ra s3
+srai a0 s8 23
+mulhu x0 t2 s1
+sra gp t4 a3
+srli t0 a6 29
+remu t3 s0 s5
+sll s11 s11 a4
+sltiu x0 s0 -769
+remu s6 tp gp
+divu t4 a5 t5
+slli t3 a2 24
+lui a0 996340
+sltu a1 s7 a7
+xor s9 s0 s0
+mul ra t0 a5
+andi x0 t4 1461
+lui t6 728075
+mulhu s1 a0 s3
+srl a3 s1 t0
+xor s0 a3 t1
+mulhsu s10 s3 s4
+slti a6 tp -1341
+lui s0 811474
+srli a2 t3 22
+lui s1 791245
+slti a7 s3 -1045
+add s4 a4 s2
+xor a3 a1 gp
+divu s7 s1 s3
+mulh s9 s6 s0
+mul t1 s11 s6
+or s11 x0 t6
+slti a6 x0 -295
+srli s10 s11 18
+sra t5 t5 s10
+sltiu gp a0 -582
+mulh a0 t6 t4
+sltiu a5 s4 -231
+add t6 s1 s8
+mulhu s0 s6 a2
+rem s11 s9 a7
+srai t5 x0 13
+slti a7 s2 -624
+xor t1 t0 t2
+auipc t1 108155
+slt s8 s7 ra
+slti s4 s11 -1392
+xori gp s9 1259
+addi ra a3 -1127
+slt s10 s0 s3
+add t4 gp t6
+slli tp a5 13
+add t4 s7 s8
+add a2 s1 s5
+srai t5 a1 0
+addi s5 s8 1635
+slti a2 s9 634
+xor gp s3 a0
+addi t1 s8 -2047
+sub t1 x0 s3
+sra t1 s8 a6
+mulhu a1 gp x0
+lui a7 760762
+xori s9 t4 -1112
+lui t6 189400
+ori x0 t6 -1726
+sltiu a7 x0 517
+ori s2 s3 -1375
+auipc s5 475981
+sub t0 t2 a3
+xori tp a0 -290
+slt t2 t2 s7
+mul t1 s0 s4
+lui t3 328538
+sra s10 s11 a1
+andi a3 s6 -847
+sra t0 t3 a2
+or gp s2 s1
+slt s3 a7 a0
+srl t6 t4 t1
+srli s6 a2 1
+mulhsu ra s3 t2
+mulhu a1 s5 a5
+srai t5 t1 10
+add t1 x0 s10
+slti s8 tp 1439
+andi s0 s11 -1107
+auipc s11 528601
+xor s9 s9 t0
+div t5 a1 t4
+mulhsu tp t0 t6
+and tp t2 s7
+auipc s2 436311
+xor a2 a1 t2
+sltiu s11 a6 -1272
+slli s0 s11 19
+srl s2 a3 a6
+slt s10 s11 s8
+add a7 s3 s0
+sltu a0 x0 s4
+divu a4 ra a5
+div s8 t4 s0
+mul s2 s6 s2
+xor t3 t1 t1
+addi t4 s10 -1332
+ori a0 s10 -1870
+add s1 s4 gp
+srli s0 a7 27
+andi s3 tp -1659
+srai t4 s8 3
+srl a1 x0 s7
+slt t4 s6 a4
+mulhsu a2 a4 t6
+divu t1 a6 a3
+sra a6 x0 s11
+div x0 s6 a0
+xori ra s5 1295
+sltu t4 s1 s11
+andi a5 a3 -479
+srli s6 t3 8
+slli gp t1 10
+srl s2 a6 s0
+andi s9 x0 600
+slli t3 a2 13
+slli s4 t6 29
+andi x0 tp -2007
+divu a1 tp s5
+srl gp t3 gp
+or t3 s2 s0
+mulh s0 a5 t2
+sub s4 s0 s6
+xor ra s8 s9
+sll s8 t5 t0
+mulhsu a4 s0 s9
+ori a7 a7 -1960
+addi a4 t3 340
+slli t3 x0 25
+and s0 a2 s3
+rem s7 s3 x0
+mul s7 s0 s2
+divu a2 a5 s8
+and s2 x0 x0
+srai a1 ra 31
+or t0 s4 s1
+div t1 x0 t1
+addi s10 x0 67
+sll x0 t0 a5
+mulhsu s11 a4 a5
+or a4 s3 t3
+xor a7 s1 s2
+sra s7 t0 gp
+slt t4 s10 a1
+ori x0 a0 1113
+auipc ra 730450
+mul s5 x0 s2
+add t2 s2 x0
+add s2 t4 x0
+mul a5 a4 a0
+andi t2 a0 1841
+andi a4 x0 -102
+ori x0 a0 -1200
+ori a1 a3 -415
+mulh s3 t0 t0
+mulh s6 t3 s2
+remu tp t3 a5
+addi s7 s6 350
+slt s8 t3 s10
+sub s2 s3 t4
+srai ra t4 17
+sll tp a6 s0
+slli s9 s4 25
+divu t3 a6 s6
+andi a2 t0 49
+rem a6 x0 gp
+or t0 a7 gp
+srai a0 t6 23
+ori s10 a0 -1027
+sll s1 s8 a5
+srl t6 a2 s6
+sll s6 gp s5
+add a1 s5 a4
+div tp t1 a6
+srli t3 s7 18
+sub s8 a7 t3
+slt s9 t5 a4
+srli s11 s2 0
+sra s7 a5 ra
+or a0 s9 s0
+srli s3 a0 5
+mul ra a1 a0
+xor ra t5 s3
+lui t4 657637
+srli a7 a0 4
+sll s11 t4 s7
+slti a7 t1 -211
+and t0 gp s10
+slli ra s1 30
+mul t6 a6 s4
+mulhsu s1 ra s1
+or s4 a6 s1
+mul gp s4 a3
+slt a4 a4 s10
+xor s3 t2 gp
+addi s4 s11 -277
+sltu a6 s4 t3
+xor a7 s2 s2
+sra t1 t0 a7
+mulhsu s5 s10 a2
+xori t3 t3 -1502
+divu s0 s11 a2
+mulhu a4 tp t0
+and a7 t2 s3
+andi s3 s9 -1651
+andi a5 x0 1421
+lui a5 453372
+mul a3 s9 gp
+div ra t6 a0
+and gp t6 s10
+mul a2 a3 t3
+remu t6 a6 t3
+add t3 s8 s5
+andi s10 s3 901
+srai s0 ra 9
+mul a1 a5 t6
+sll t1 a1 s0
+xori s9 s4 952
 srli a5 gp 11
-mulh s9 a7 s8
-mulh gp s9 s9
-auipc t5 299615
-srai t4 a7 4
-andi a4 tp -1669
-slt tp s8 t1
-sub a6 s3 t6
-xori x0 s5 -1252
-slt a7 ra a0
-ori a7 s10 -83
-srli x0 s2 18
-sll a7 s4 a4
-mulh gp x0 s9
-slt gp t6 t6
-sltiu t0 s9 -1856
-xor a0 a3 t0
-sub tp s6 t4
-mul s8 gp s10
-div ra s4 x0
-mulh ra s7 a6
-sub a7 a6 t1
-mulh a7 s11 a5
-and s5 a5 s11
-ori s8 s9 1348
-div t2 t0 s3
-or s8 x0 a7
-srli a3 t3 13
-sra t4 a3 a7
-slt s3 a1 a2
-mulh a7 a2 a4
-mulh a0 x0 a2
-lui a6 287844
-sub t6 t1 s0
-sltiu t1 t4 1601
-srl a4 a2 a7
-or s7 t2 a5
-mul a3 s3 a2
-ori a1 s2 -1540
-and s1 ra s1
-slti tp s8 -57
-mul a1 s8 a7
-slt tp t2 t6
-addi a3 s5 -1121
-mulhu gp a1 t5
-srli a1 a6 5
-addi t4 s7 1639
-divu a5 a7 a1
-ori a1 s5 2028
-ori s5 s2 -1902
-auipc s10 435670
-or x0 s8 s1
-slti a3 s5 -1468
-slti s9 s10 -392
-srai t2 t2 18
-rem x0 s1 s2
-mulhu s7 s5 a2
-sltu tp ra s1
-and t6 s4 t0
-andi t1 a1 -1497
-mul s6 t2 s5
-ori s7 x0 -1112
-add ra ra s4
-lui s3 528291
-mulhsu x0 s2 t6
-mulhsu x0 s7 ra
-sltiu a6 a3 1222
-xori s4 a1 -1891
-mulhu s10 a1 s3
-sra a5 t1 a5
-sltiu s2 s9 -837
-remu t1 a5 t1
-ori t0 a1 -1431
-div t6 s8 s9
-add t3 a3 s4
-sra t1 a4 a3
-srli t1 s0 19
-mulhu s11 s3 t1
-addi s9 x0 602
-srl a4 t3 t3
-srai s8 x0 10
-srl a1 s8 t4
-add s7 t0 s9
-or x0 s2 a0
-auipc t1 651860
-slti s5 s9 -2003
-remu a3 a7 x0
-srli s5 a4 12
-sra t2 x0 t5
-addi s0 t1 -288
-lui s3 903273
-srl s9 t3 s6
-slt s10 a1 t5
-mulh t6 a4 s6
-and t1 s8 s3
-add gp s0 s6
-mulhsu t2 ra s3
-and t3 s3 a3
-lui s1 1023719
-sll a6 a6 ra
-andi t5 t3 437
-mulhsu s11 t0 s6
-lui s11 830038
-slt x0 t4 a1
-add t1 a0 s2
-auipc s5 873225
-auipc s5 274534
-mul t4 t6 tp
-add s1 a4 s0
-addi s2 a7 -1906
-sltu s8 a2 s11
-slti a4 x0 -1523
-sltiu a1 s6 -438
-mulh x0 t0 x0
-sra a6 s8 x0
-and a0 a7 a5
-div s6 s1 s4
-xor a5 a5 x0
-lui x0 742468
-divu tp t6 s2
-xori s10 ra -290
-sll s2 s11 a6
-sra x0 a7 gp
-sub ra a1 t0
-srli s11 gp 17
-sub x0 t2 x0
-andi s1 t1 -1500
-auipc s4 840800
-and s1 t5 a4
-sltiu a0 a7 -92
-mulh ra x0 s3
-sll s6 s3 a1
-srli a5 t2 23
-xori a5 s10 -109
-sll s10 s3 a3
-srai a1 s4 18
-sub s5 a3 s6
-andi t5 t2 -1512
-sub gp tp a4
-remu s7 a5 t1
-srl a6 a2 t2
-andi t4 a2 1947
-and t0 ra t5
-sltu t6 a0 s1
-srai a0 x0 7
-sltu t1 s7 t4
-sltiu s5 t0 -1113
-or tp s2 tp
-mulhu t3 s3 s0
-srli t5 x0 8
-sltiu t4 s9 355
-or s10 s9 t4
-sltu a3 s0 a6
-mul t4 s7 a0
-mul s1 s10 s6
-andi s8 t6 -1445
-or a6 t5 t3
-sltiu s6 s4 -1131
-srli s3 a5 26
-sll t0 t2 s11
-srai s1 a1 29
-addi t4 t1 513
-and s2 gp x0
-slti s5 x0 -908
-mulh a2 s8 s6
-sub s2 s8 s1
-andi s7 s4 -449
-xori t4 a4 -441
-lui t6 1048065
-sltu tp s2 s7
-auipc a5 364133
-and s10 a0 a6
-sltu t3 t2 s8
-divu t6 t1 s8
-lui ra 240005
-sltiu a6 s2 -423
-and a2 s1 s9
-slti t1 a0 -1725
-sll a1 x0 s1
-slti s1 s4 -333
-xori a7 s9 -1982
-addi s9 t2 -682
-mulhu a6 a3 s8
-ori tp a1 989
-xori a0 t3 1220
-sltiu t0 ra -91
-sltiu s9 s11 -134
-lui t4 74040
-add s6 tp t6
-srai ra t0 26
-mulhu t3 s10 x0
-srai t1 s8 14
-div s4 s1 t5
-srli s3 s11 11
-mul tp a4 t0
-remu s3 s6 s3
-ori a5 gp -91
-mulh s5 gp s6
-add t4 s2 s6
-or s3 t4 s8
-sub t3 t5 a5
-sll s10 s5 a4
-and t5 s0 s2
-sll a7 s4 t6
-srai x0 a5 29
-slt s2 a0 s10
-lui s8 107968
-andi x0 x0 1888
-divu s7 s10 a7
-sll x0 t3 s5
-sub a6 a2 s10
-xor a5 t4 x0
-and s10 s10 t5
-slti s8 s7 928
-mulh a6 a5 s8
-sra tp a1 a0
-mulh s11 s1 s9
-sub a0 s1 ra
-slti s0 s0 1327
-sra s5 t0 t6
-mulh t4 t0 s10
-rem t1 t4 a4
-sra s9 s0 x0
-slt s9 t2 s5
-or t5 ra s1
-mul gp s4 a5
-xori t1 t1 780
-andi t1 s2 742
-ori t6 s3 716
-sra t4 a5 t4
-slti s5 t0 -1465
-div s2 s5 a4
-auipc s9 293273
-mulhu a2 gp a4
-rem a3 s7 s2
-slli s3 gp 21
-andi s0 t3 -131
-srli t0 s8 19
-div ra s3 s9
-mulh s1 s2 x0
-andi tp a1 -1382
-xor s2 s1 s5
-add s2 s2 a3
-mulh a2 a6 t4
-div a7 a2 a1
-rem s7 s7 t3
-mulhu a4 t3 t0
-and ra a5 x0
-remu t4 x0 a0
-slli s5 x0 3
-add t4 t3 t0
-sll a3 a2 t6
-mulhsu s8 s7 a5
-srl t1 t1 s5
-or t6 tp t6
-divu t1 t3 s3
-auipc s8 310981
-and s7 t2 t5
-sltu a4 a6 s11
-sra t0 gp s4
-auipc s2 655462
-sltu ra t5 t5
-div x0 s11 s7
-xor a0 s5 a5
-and s4 a7 a3
-sltu s1 s8 a0
-div a6 s0 a2
-sll ra tp x0
-mul s10 a6 a5
-slt t5 s9 s4
-sra x0 a3 x0
-sra s4 s1 s2
-sra gp x0 s7
-mulhu a3 s3 gp
-srli x0 s0 8
-add a7 a0 a4
-andi t4 t3 1123
-remu t1 s0 x0
-slli a0 s8 10
-srli s2 a4 15
-andi a1 a6 1755
-sll t4 s8 s8
-xor a3 s5 a1
-xor x0 t0 s1
-sltiu t1 s2 -725
-mulh a7 ra t0
-and a3 tp s0
-or a1 t1 a7
-slt a2 a0 t5
-or s2 a0 s6
-ori s7 tp 1032
-mulh s7 a7 t2
-sltiu s8 t6 629
-sltiu t3 t0 1818
-add s4 s3 a4
-div s3 s11 a2
-xori t3 a5 -1765
-sltiu x0 t3 -1607
-ori t1 s7 -1366
-mulhu a1 tp gp
-sltu s11 t1 x0
-andi a5 s7 -1534
-or s5 s1 s8
-slli a0 a2 30
-sll s5 x0 t6
-xori a5 s2 -904
-remu t1 x0 s4
-xor x0 s8 s10
-addi s0 t2 -138
-xori s10 a0 -1970
-srli a0 a3 16
-mul s4 s6 x0
-remu s10 t1 s11
-ori t5 s6 282
-sra s7 s0 a5
-mul x0 a1 t2
-srl a4 s7 a5
-andi a7 s1 567
-andi t6 t4 1681
-lui t1 119910
-srli a4 a7 14
-mulh tp a1 x0
-sra t0 t6 s3
-srl gp s5 s0
-slti t2 s6 858
-sub s0 t0 a2
-mulhsu s6 s6 s11
-mul gp a5 t4
-slli s8 t5 22
-sll s6 ra t6
-or s6 s10 gp
-mul s0 a3 t2
-slli t3 s11 24
-divu s10 s3 a1
-sltiu x0 x0 1767
-mulh ra t6 a2
-xor a5 s0 a0
-xori t2 a5 -1035
-and ra a4 s4
-rem a4 a2 t0
-mul s8 s0 s2
-srl t6 a1 gp
-mulh s4 x0 x0
-slt ra a2 a7
-ori s11 tp -863
-mul s6 s8 s6
-mulhu a2 ra s5
-srai gp s4 13
-xor x0 t3 x0
-and s8 tp t3
-or s3 t3 gp
+slli t4 a1 24
+addi a5 t3 1654
+srl t1 s0 x0
+andi s7 t6 -1390
+sll a3 s7 s1
+add t5 a3 s4
+srl a4 gp x0
+and t4 t3 s6
+addi tp x0 1494
+or x0 a6 s7
+srl t5 ra a4
+srai a0 s3 24
+sltiu ra tp -1460
+sltu ra a0 s6
+xor a7 t1 s3
+divu s4 s7 a7
+add t3 tp s10
+mulhsu t6 s7 s2
+mulh s1 s10 tp
+slt gp s4 gp
+divu ra a0 s8
+mulh t2 a3 a2
+add s10 t5 a6
+addi a2 s9 -281
+and a7 s0 t4
+sub t1 t5 a1
+andi s3 s1 -759
+divu s0 a7 s11
+divu s5 s9 a7
+sll s7 t6 s2
+add x0 s1 s6
+rem x0 t0 a0
+slti a5 s0 34
+sltu a3 a1 a7
+sltu s1 s9 a1
+or a0 t4 t2
+mulhu a7 gp tp
+slt a4 t5 s8
+xor s4 t1 s9
+slti s10 a2 1439
+mul s9 s2 t1
+sub ra t1 s1
+xor s8 t3 s2
+sltu s5 a7 s10
+mulh s11 s7 s4
+sltiu s5 s6 508
+srl a7 a7 tp
+ori a1 s8 -814
+slti a7 a1 1676
+remu gp s10 x0
+mul s2 t6 t4
+slt t1 tp a6
+xor s3 a7 a4
+remu s1 s1 s10
+ori s5 a2 1760
+sll x0 t6 s10
+slli s11 t2 30
+or t5 a2 s8
+remu s6 t0 gp
+srai s7 s1 11
+slli a4 t2 12
+srai s5 x0 30
+lui s8 819590
+slti s11 tp -1470
+slt t3 s1 a5
+srai s2 t2 17
+sltu t1 a6 x0
+ori s4 t5 -1315
+sltu t4 t5 x0
+xori ra t1 1823
+mulh s2 s7 a2
+xor s4 a7 a6
+mulhu gp a0 s9
+or a5 s11 a6
+sra t0 x0 t0
+sll t1 s7 a3
+or a7 t2 t4
+sra a3 t3 t2
+auipc t1 135672
+sltiu s2 s10 -1532
+srli s2 t6 27
+sll t1 a0 s9
+sll s0 s9 t3
+slli s7 ra 31
+xor s3 s4 t2
+remu s3 s10 s8
+sltiu s2 s6 -1629
+srai s11 ra 25
+mulhsu x0 gp s4
+div s0 a7 t6
+mulhsu s11 tp a3
+auipc s6 272662
+andi s10 s5 -1025
+or t0 s3 t2
+auipc x0 344059
+srli s0 s11 28
+rem s10 s6 s0
+slti a0 s6 1149
+slt a3 a3 a0
+or s11 s0 s9
+xor s9 ra a5
+mul s1 s0 s8
+srli s6 ra 10
+mulhu t4 s2 t5
+div a2 gp t1
+sltiu ra t6 1639
+lui t1 466155
+srl gp a1 s11
+sltu t0 a0 a3
+div a2 a6 s9
+srai a2 a0 22
+or s2 a6 gp
+or a5 a1 a0
+srli x0 s10 6
+slti t0 t0 -1055
+sll x0 s8 tp
+xori t6 s8 -863
+div s8 s10 s3
+ori t0 s8 1172
+add a2 s1 t2
+srl t3 x0 t4
+srl t6 s6 t0
+xor a5 s2 s9
+auipc a6 1015645
+xor s7 s3 ra
+and t3 a6 gp
+mulhsu s4 a6 t3
+sra t2 x0 s6
+add t4 a5 a4
+or s10 s5 s6
+add s8 gp a0
+mulhsu a4 t0 s5
+andi s11 x0 -1303
+sra ra t6 t1
+or s4 s6 x0
+srai tp tp 8
+ori s9 s10 -1593
+addi t4 s11 -912
+sltiu s6 gp 1748
+slt t5 ra a2
+lui ra 170664
+div a0 t3 a1
+mulhu t4 a5 s0
+sub gp a0 a1
+srl s9 a2 t4
+ori t2 t3 1407
+divu s10 tp a6
+sll t2 ra t2
+and s7 s1 a2
+divu gp t4 t0
+divu t1 s5 a7
+sltu x0 t6 s2
+lui a4 1024400
+auipc a0 815732
+andi s2 s0 -1317
+andi a6 a3 -1580
+slli t2 s11 0
+sub a1 s6 s2
+sltu s2 x0 s4
+xori s3 t6 -1411
+remu x0 s10 a5
+mul gp t0 a7
+auipc t6 906183
+mulh s11 a1 a7
+remu s9 t0 t2
+mul x0 a1 a4
+addi a1 x0 1804
+lui t4 106308
+mulh a5 t6 tp
+srli a6 s4 18
+mulhsu s8 x0 s8
+srl s0 s1 s11
+sll t4 s11 s11
+sub s1 a6 t4
+slt s5 s1 s10
+andi a0 tp 2009
+lui x0 191469
+xori a7 t0 -1750
+slti tp t5 1416
+sra x0 t6 s8
+divu a5 s2 s2
+slt s6 t3 s9
+ori x0 a3 -883
+and a5 s7 s4
+addi a2 s10 -1486
+ori a4 t0 1884
+srl a0 a0 s9
+rem s3 t6 s9
+lui s0 971524
+sll a5 tp ra
+sltiu a4 s4 -555
+slti s5 s1 -1762
+remu t2 s1 a5
+mul a7 t0 ra
+sll t2 x0 t2
+andi t1 a6 -1582
+add s2 a2 s8
+addi s7 s9 632
+slt t4 s2 t3
+slli gp x0 9
+mulh a4 a7 s9
+and a6 s11 a2
+divu ra x0 t2
+mulhu s2 a2 s5
+remu t4 s5 s6
+add s7 t3 s8
+andi t0 a5 597
+divu s1 tp t5
+sltiu s1 t0 -1279
+lui x0 485353
+slt t4 s5 a0
+div s5 t1 s10
+slli t3 gp 16
+lui s4 625406
+sltiu a0 t1 1282
+xori s2 a2 -659
+sltiu s0 t2 -1844
+sub a2 s2 a0
+mulh s8 x0 s11
+addi t2 t0 -832
+xor a7 s9 s1
+srl t2 s11 ra
+slt s10 x0 s4
+and ra s3 s3
+xori gp t0 -296
+sra s4 s4 t1
+lui a0 957888
+ori a6 s5 -1748
+auipc s8 420676
+xori s7 a1 2043
+or t5 s0 t5
+lui a3 410075
+divu tp a6 t6
+mulhu t3 gp t3
+sra s5 a5 t6
+add s11 s1 s4
+mulhsu a7 s11 gp
+add a6 a7 s11
+mul a7 s1 t5
+srli t5 s10 10
+sub s9 a7 s2
+divu s10 a1 s10
+xori s4 a7 678
+and s11 gp t0
+mul s4 ra s7
+slt a3 s10 t0
+mulhsu tp a0 t4
+auipc x0 308281
+mulhu s8 x0 a6
+srl ra x0 s5
+xor a2 s0 s7
+div s10 t5 a3
+rem t1 gp s0
+mulhu s2 t4 x0
+lui t0 903984
+srai t5 a0 10
+mulhu a3 ra a1
+mulhsu t0 x0 a3
+mulhsu a7 tp a5
+slli t6 gp 5
+rem t3 s5 a5
+divu s4 a2 t1
+mulhsu s6 a5 x0
+addi s4 s4 1255
+or a3 t3 s2
+rem s0 s2 t1
+ori t5 a6 -32
+srl t4 s1 a0
+ori s5 s4 -1925
+slt s11 t6 t1
+sll t1 s6 x0
+srli a7 a3 20
+srl s7 t6 s0
+ori s5 s3 -1484
+mulh s10 s3 s7
+rem t0 s4 s5
+ori ra a3 -1584
+mulhu s2 s1 s4
+mulhu gp a5 s0
+addi a4 t5 53
+div a1 a0 s4
+srai s6 s2 25
+andi s9 a4 -162
+sub ra s6 t4
+sll a3 a5 s3
+srli a6 s0 27
+andi a0 tp 1342
+xor t0 t4 t2
+or s4 x0 s7
+lui s6 959551
+sltiu a1 s8 881
+sltiu t5 s9 -1558
+xor s8 s8 x0
+rem s11 t1 a6
+srli s10 s6 20
+auipc a3 883117
+auipc s8 808118
+slti t3 t3 -1381
+slti a0 a6 -899
+sub ra t1 s5
+andi a3 s10 -1414
+srai ra s0 29
+mul s8 gp a4
+xor t3 t1 a5
+divu a5 a3 a2
+div t3 s3 a3
+sltu s9 x0 a4
+divu a7 x0 s10
+mulh a2 tp a2
+mul a6 s2 t1
+mulhu a0 s7 s7
+srai s4 t5 11
+andi x0 t6 -176
+addi t3 x0 325
+mulhsu s3 t1 x0
+remu s9 s7 a4
+sra t2 t1 t1
+xori s11 s4 -238
+xori t0 s8 -367
+xor a5 s7 s4
+mul s5 s7 s11
+sltiu a2 s8 -1870
+mulhu s0 s5 s6
+slti a3 t5 -278
+remu s4 ra s3
+ori s0 s10 1500
+rem s9 ra t5
+lui ra 17846
+srli s11 ra 0
+ori gp a4 1117
+remu gp a7 t4
+srli s0 t4 7
+sltiu t2 a4 -778
+xor x0 s10 s11
+add t4 s4 s5
+srl t4 t1 ra
+slt t4 a2 tp
+slli a7 s2 14
+sll tp t5 t2
+remu tp s5 s10
+sltiu t5 a1 -1003
+addi t3 x0 -1505
+auipc s7 636043
+slti s7 t6 -319
+or a7 x0 t2
+auipc a3 767934
+mulh s10 s10 s0
+rem s2 s8 t4
+srl gp a5 t1
+slli x0 ra 28
+auipc a0 842529
+srli t4 t4 29
+lui s5 466190
+and a3 s4 s3
+srli a4 s4 22
+sra x0 s10 s4
+slli t3 a4 1
+remu a0 a6 t0
+addi t1 a1 -1260
+sll a0 s3 a0
+ori a7 t6 -1703
+slli s11 t6 15
+srl s8 a1 t2
+mul s6 t2 t6
+and tp t3 a2
+srl t3 s8 s1
+ori gp gp -1842
+auipc s2 74061
+or x0 t5 t3
+sltiu s4 s8 1866
+divu s5 x0 gp
+and s3 s6 s4
+or s4 x0 s5
+ori s10 s0 -476
+srli a7 a0 19
+slt t4 s9 a2
+addi t3 a7 22
+andi s9 s9 -342
+sll t3 s8 a0
+mulh a3 s6 tp
+rem t4 s2 a5
+mulhsu x0 a7 s11
+mulhu s5 t5 s6
+sll ra x0 a6
+auipc t0 408648
+lui t2 262084
+lui s3 633352
+rem s11 s7 t3
+sll s1 tp t5
+slt x0 s11 a4
+slt s6 gp s8
+and s7 s10 s2
+rem s0 a3 x0
+addi a4 a4 -1434
+xori t2 s8 -527
+mulhu x0 a2 t0
+slli s3 s9 25
+divu s1 s4 s5
+andi gp t6 -1646
+or a2 s6 s10
+sll t3 gp t6
+ori s3 tp -1409
+slli s0 a5 20
+slti t6 s0 -1266
+remu s11 a6 a3
+slli gp a6 5
+xori s2 s7 -1966
+mulhsu t4 a1 a0
+slt a7 t5 s0
+mul a7 s4 s7
+rem t5 ra s3
+mul s6 t5 t5
+addi s6 s10 -1176
+slti s2 s9 -1886
+sltu t3 a1 a6
+add s9 a5 x0
+sub s10 s11 s11
+divu t0 s1 s0
+and t4 a3 s0
+remu a4 a0 x0
+divu s10 tp x0
+slti t2 s5 -1744
+add s6 s1 s0
+sra s10 s10 t3
+div s7 a2 tp
+xor s10 a7 a0
+andi s8 a3 -216
+sll t2 s10 s10
+lui t4 485990
+xori a6 gp 497
+xor s6 tp a5
+sltiu s6 t1 -882
+sub a1 a7 t3
+sltiu a6 t3 998
+andi a2 a2 1425
+xor x0 t1 s0
+sub x0 t6 ra
+and s5 gp s9
+sub tp a1 a3
+mulhsu s6 x0 t4
+mulhu s3 ra x0
+or tp s8 s1
+div t3 s3 s0
+xori a7 t0 -1796
+ori t2 t2 -327
+lui t2 94832
+auipc a6 31318
+sra tp tp a5
+mul a6 s4 tp
+mul s5 s2 s5
+slt s6 s1 a5
+andi s2 s2 -923
+mulhsu ra x0 s10
+srli x0 s10 31
+add s7 a4 s1
+add t5 x0 a6
+sra s3 a6 s11
+divu s2 t3 a0
+srl x0 ra t2
+slti s7 s4 -719
+srl t1 a5 tp
+sltiu t0 t2 -1311
+auipc s0 345534
+mulh x0 s10 a3
+ori s6 s8 1584
+rem a5 a2 a6
+sra a7 s8 a2
+sltu x0 a6 a0
+sltiu s11 s9 1804
+sra t2 t6 s4
+slti a3 s3 -1999
+srai t0 s5 27
+mulhsu s9 gp s1
+lui t3 455684
+mulhu t1 tp s11
+ori s8 t1 1427
+remu t4 s10 a4
+srli t5 s4 31
+srli s6 s5 22
+sltiu a1 a1 -404
+or a4 ra t1
+sra x0 a4 t3
+slli s4 s11 24
+lui s10 273613
+andi a0 t4 -723
+srli x0 a6 25
+add a0 a7 s3
+srl tp a1 gp
+mul x0 s4 gp
+sll a6 s1 x0
+remu t3 a4 a3
+divu t1 t1 a3
+srl tp s8 s11
+slti gp x0 -1223
+slt tp s5 ra
+sltu t3 s3 tp
+add s0 ra a6
+xori a2 a6 -1265
+slt t6 gp s11
+xori s5 a4 -1083
+srai s10 s10 13
+slt t0 s1 a5
+addi ra a6 1556
+slt t2 a4 t1
+andi x0 s2 1893
+and a4 s4 a4
+xor s6 a2 a1
+sltiu a6 a7 1086
+auipc x0 203237
+addi s3 s3 -1635
+slli x0 a1 26
+mul tp s1 t4
+sub a0 a5 s11
+sltu s1 a4 s11
+auipc a7 43006
+srl t1 s8 s4
+div s3 x0 x0
+slti s7 s10 -62
+mul gp tp s0
+mulhsu t0 a3 a1
+srli s0 s8 10
+sltiu s4 s6 -1349
+mulh t6 s1 tp
+srai gp s6 24
+mulhu x0 s11 a3
+xori a3 s6 -877
+add s11 s6 a5
+sltu t1 a7 s8
+add a4 t0 s8
+add s4 a6 s0
+mul s1 s10 a0
+sra t4 s1 t1
+addi a3 a3 427
+mulhsu t6 t1 a5
+slli gp s7 24
+rem s6 gp a3
+addi s4 s0 -604
+divu tp s11 a7
+rem s3 a5 s9
+slt a4 s3 s10
+addi a6 s2 -546
+lui a6 812576
+sub s9 t4 a0
+slt s8 a7 a7
+srl a5 s4 ra
+slt t3 s4 t5
+srl ra s8 tp
+mulhu x0 t6 s3
+addi a1 s1 -14
+and s8 t3 s6
+sra a3 x0 t5
+srai x0 s10 23
+slt a6 tp t5
+sltiu a4 s2 212
+srli s2 s0 6
+addi t0 a6 -2031
+divu s1 s11 t6
+mulhu s7 t3 s7
+sra gp s9 s8
+andi a3 t5 -1804
+and a2 s10 t3
+sra s6 a2 s1
+mulhsu a6 tp s7
+sll x0 a6 s11
+ori s10 a1 -1273
+mulhsu s3 a2 t2
+remu s1 a1 s9
+lui s4 768503
+srai t6 a2 19
+slt a3 s2 s0
+or a2 x0 a0
+xori s8 s10 -355
+sltu a3 a6 ra
+rem a3 t3 tp
+addi s5 s1 -1278
+slti gp t3 -779
+ori s6 s2 823
+sub s1 s2 s10
+and s3 s2 s1
+mul s2 s9 s3
+mul s7 a5 s5
+mulhu a7 t4 s0
+mulh a6 a7 t1
+lui x0 297781
+ori s1 s7 690
+ori a1 a1 -1556
+or s8 t5 s11
+slti t6 t0 -979
+or s6 t0 t0
+rem s7 s4 a6
+slli t0 s11 15
+andi s7 x0 285
+xori a1 a0 -1549
+addi a4 tp 1496
+rem a3 a4 s4
+and t4 t3 t0
+div t1 s4 s6
+mul s6 s8 a6
+slli s5 x0 16
+auipc s5 174548
+xor a3 s8 x0
+slt x0 t5 ra
+srl s8 t3 s1
+mulhu s1 s11 s2
+add gp a2 s2
+srli t2 t1 22
+andi gp s2 -1927
+remu s5 s3 t4
+slt s7 ra t4
+addi tp a7 -1082
+mul s7 a0 s6
+mulh s11 s2 t4
+sra t2 s1 s6
+srai s3 a0 25
+slli s2 a4 15
+xori tp gp -1690
+mulhsu s4 t6 gp
+remu a0 s0 s6
+sltiu t3 a0 1606
+or t0 gp t2
+srl t1 s11 s2
+andi x0 s7 -37
+mul x0 t2 s10
+sra tp t3 s7
+add s4 t0 a5
+rem a3 s3 a7
+srai ra x0 8
+and x0 gp s8
+sub a7 s10 s1
+sub t6 tp gp
+slt t2 t6 t6
+mul s3 s8 s5
+sltiu t0 s5 580
+divu s7 t5 s4
+sltiu a7 a2 -137
+ori s10 s4 -605
+lui a6 5588
+mul a0 s10 a6
+sll a1 gp x0
+sltiu t0 s11 132
+srl s9 s3 t0
+or s0 a2 s7
+auipc s10 544059
+add a3 a0 a2
+sll s7 x0 s4
+sub a2 t4 a3
+or ra t1 a7
+or x0 x0 gp
+addi x0 t2 -1226
+rem s5 a7 s3
+xori s3 t1 -872
+xori s0 t5 -81
+slt a5 gp gp
+mul s5 s10 a0
+sub s4 s11 t0
+sltiu a2 a2 347
+mulh t4 a4 s2
+remu t3 t6 s7
+xori a2 a6 10
+and a6 x0 a7
+rem a0 a1 t4
+auipc t0 882559
+mulhsu a4 a2 s10
+mul t4 a1 s2
+slt t3 a1 t5
+slti a2 s3 -210
+or t0 a2 gp
+sltiu s9 s4 771
+sltiu s3 t1 116
+divu tp s10 a4
+andi x0 a6 -970
+slt t6 s11 t3
+remu s4 s11 x0
+add s9 a7 s7
+xor a0 ra a7
+sra t6 s4 s8
+div s8 s5 a7
+mulh a4 s10 s11
+auipc t4 882974
+remu t0 s8 t3
+xori t1 a2 150
+slti t4 s3 32
+sltu a4 s9 a3
+andi s6 a1 -1964
+srli t5 s5 22
+slti a7 s0 -952
+mulhsu t0 t3 t2
+lui s2 940654
+srl s3 t5 s11
+srai t2 t5 22
+srl ra tp t2
+add a7 a6 s1
+srli t0 s9 1
+ori a6 tp 1366
+div a4 a5 ra
+div t5 a7 s10
+and s5 tp tp
+srli t6 t0 5
+slli s11 ra 22
+auipc s9 1001037
+sltiu x0 t4 -393
+slti tp t2 -264
+slt ra s4 s9
+lui t2 918357
+mulhsu gp s1 a6
+ori s9 t1 -344
+and a4 s8 a6
+srai t2 s2 20
+srl t6 s0 t4
+sltu s1 s5 s4
+sub a2 s2 tp
+slli s9 a0 0
+slt t5 tp gp
+remu t5 a0 t5
+srai x0 t4 25
+slt s3 s10 s11
+srli s2 s3 11
+div s9 tp a2
+lui gp 909123
+sltu a2 s4 x0
+srl t5 s11 t6
+sra a5 t0 a4
+lui s9 795016
+auipc a6 1035132
+slti s4 a7 -358
+srl a6 s9 s6
+sll t1 s9 s1
+auipc tp 744271
+slli s3 t2 9
+sll a7 t2 a0
+xor a1 a6 t4
+mulhu t0 a6 a7
+mul t1 t1 t3
+sll x0 s2 s1
+xori s11 a7 -1062
+ori a7 s10 -1193
+addi t6 a0 -902
+addi s4 t0 -2020
+sltu a5 t6 s8
+rem gp t6 a4
+mulh a4 s3 x0
+add s10 s11 a7
+lui s9 692061
+rem a4 s7 tp
+remu s5 a0 a4
+mul s4 a0 a1
+srl t1 a0 a0
+remu s11 s2 gp
+sll s6 s6 t1
+div s9 s1 a6
+rem s8 s1 a6
+or s8 s0 s2
+sub s1 s11 t2
+mulhu s7 t3 t5
+mulhsu s3 t0 a0
+rem tp a3 a4
+sll s1 s3 t2
+slti s10 s11 -1760
+or s11 s11 a1
+auipc a4 876038
+mulhsu a3 a4 a1
+sltiu a1 a5 -1127
+sltu a6 s11 t1
+mulh s2 tp s11
+srli s11 s10 11
+and a7 t4 s10
+srai tp t2 8
+srai t4 s11 5
+div a5 ra ra
+lui t6 71394
+sltu t6 a5 s9
+sltiu a3 s4 1727
+or s1 s9 s0
+add t0 s6 a3
+sltiu x0 s0 176
+div s4 s8 s6
+sll s8 s8 s8
+slti tp x0 -2048
+div x0 t3 s3
+mulhu s3 s9 a2
+auipc s2 197821
+rem t0 s2 tp
+mulhsu a1 t3 s4
+srai t2 x0 21
+mulhu t5 s1 gp
+srai s7 t2 12
+mulh a5 a2 a4
+mulh tp a3 t6
+mulhsu s6 x0 s11
+mul s11 s5 a2
+andi a3 s11 -1481
+sltiu s0 a1 -1853
+sltu t3 a2 s5
+divu ra a0 s0
+sub a5 a7 a1
+addi tp s3 -2011
+add s8 s2 a7
+sltiu s0 s7 390
+slli s9 a7 27
+mul t0 a4 a6
+srl s0 t1 s9
+divu gp t5 s6
+add a4 t0 s9
+slt s7 a4 a2
+sll s9 s9 t1
+sltiu s11 t1 -246
+auipc s4 367576
+auipc s0 121340
+rem s9 t3 s3
+add a3 s9 s0
+slt t2 t1 t2
+xori s7 t1 -484
+remu s3 s1 s2
+lui s7 933938
+srai t5 t4 11
+srli t0 a6 13
+slti s10 s1 -1016
+xor a7 s2 s6
+xori x0 a2 2026
+auipc a5 318144
+sub t5 s10 a3
+mulh t5 t5 t1
+mulh tp s6 gp
+and t4 s4 s3
+slt a7 a1 s0
+srl s9 x0 t0
+and s3 s2 t4
+srli a1 t1 3
+slt s3 s0 t1
+divu x0 s9 t4
+srai a3 a6 28
+divu ra t1 s4
+div a1 gp s1
+divu t1 s6 t1
+divu tp s10 t2
+xor s4 t5 s2
+mulhu a6 s3 a3
+andi s11 s0 1761
+rem a0 a5 s10
+or s7 t3 s0
+or s0 t3 t0
+sub s7 a7 a2
+slli tp ra 26
+mul s5 t4 s6
+slli x0 tp 17
+rem a2 s10 t4
+srl t2 t3 t2
+add x0 t6 a4
+ori a5 gp -1243
+remu a7 s4 s0
+lui s1 139954
+ori s4 a4 -876
+sltiu s5 a1 -1516
+sra t2 ra x0
+addi s2 s10 289
+or s0 a1 s5
+slli x0 t2 11
+sub a7 a6 a2
+add t3 a7 s11
+mulhu t0 s11 a5
+slt gp s11 s6
+rem t4 s6 s3
+mulhu s11 a7 s9
+srl a5 s6 t2
+sltu t5 x0 s10
+addi t5 s0 902
+divu s11 gp s6
+lui s1 113746
+slli tp s3 17
+slt ra s5 x0
+sll s4 s2 s10
+sub a1 s3 t5
+auipc t5 694125
+sltu t1 s3 t1
+sra s11 gp s0
+and s1 a1 x0
+srai t3 t5 6
+slli a1 tp 11
+srli a6 t2 4
+slli t2 s7 9
+sra t5 a1 s4
+or t2 ra a1
+slli s0 ra 21
+andi a7 a0 -1127
+sltu s9 s5 s4
+and a6 s3 s8
+rem t5 tp s6
+slt x0 s9 t2
+or s6 t5 tp
+slli tp t6 27
+xori s3 s3 -820
+ori s4 a3 -521
+remu a3 a3 s11
+srli t0 t0 22
+and s8 s6 t3
+mul s3 s3 t5
+srai s1 t6 8
+slli t2 a0 27
+mulhu t0 s7 ra
+divu gp s9 ra
+ori s11 ra -710
+slli a7 x0 17
+sltiu s0 a5 -1485
+xori a4 x0 1118
+sra s9 s7 s7
+and s4 a4 a0
+and t5 tp s11
+sltiu t4 t4 1055
+slti s1 t5 -1644
+divu a3 x0 s5
+remu s10 s2 s8
+and s9 s6 a0
+or a0 t5 a3
+sll t4 s11 t4
+slli x0 s9 22
+srli gp a4 10
+remu s6 a4 s9
+add s6 s5 s0
+andi s9 s5 -1170
+ori t1 t3 -14
+lui s2 487949
+srl s10 t4 s5
+slt tp s2 s9
+remu a3 t1 s4
+remu s2 x0 a7
+add s8 t1 a1
+sub t2 a0 t6
+div s1 s3 a0
+mulh s4 t5 s1
+srli s6 ra 16
+srli s2 tp 25
+sll t5 s5 a3
+divu s3 s3 a6
+div s9 a2 s9
+addi s11 t1 1349
+div a5 a2 s11
+mulhu s8 t6 a2
+sltiu s1 s9 -1634
+xori x0 t5 -888
+srli x0 t6 14
+xor s6 s0 s3
+xori s9 s10 -1649
+remu ra s9 tp
+mulhsu s7 s2 s2
+srai s6 x0 2
+rem s7 t5 s1
+divu tp s2 x0
+auipc x0 472049
+mulh s9 t3 a5
+remu gp t2 s7
+srli t3 x0 14
+addi t1 t2 -1987
+lui t3 776866
+slli t2 s3 5
+slti s8 a2 -602
+sltu t2 t6 t6
+divu a3 s3 s7
+addi s0 s0 -1805
+mulhsu gp s8 x0
+and s3 ra tp
+sltiu a4 a7 549
+add s0 x0 s6
+andi s2 t1 -1953
+sll t1 a3 s3
+srli s1 s2 21
+slti a6 s8 -1981
+ori t3 tp -548
+xori s6 a7 -122
+mulh s8 a6 s1
+auipc t4 4492
+divu a3 a2 t3
+slt t1 s7 s8
+div t1 t3 s1
+srli t4 a5 22
+addi a1 a5 -1460
+slli gp s9 10
+add t1 s1 s2
+sub t3 a0 t6
+ori a4 s4 1484
+mulhsu t4 t6 a0
+slt s5 s6 s3
+sltu ra a3 a6
+ori a7 a1 -664
+srai gp s2 24
+srli a0 a7 9
+sra x0 t5 t2
+srli tp t6 12
+sub x0 t3 s0
+sltu s4 x0 s1
+sub a6 t3 a1
+sltu a3 s6 s3
+srai t1 s8 23
+remu s0 t4 a3
+ori ra a3 -1906
+sra s1 s5 s1
+div t2 ra a1
+sltu a0 a1 t1
+divu tp x0 s10
+srli a1 tp 31
+andi x0 x0 -727
+sra a4 a3 a4
+slti s1 a7 -473
+srai s2 a5 20
+srli a0 a6 1
+divu s6 s0 t1
+ori gp a3 -1854
+rem t2 s7 a3
+mul s11 s4 a5
+srli t2 t4 16
+div a5 s5 t1
+slti a6 t6 -1120
+mulh s10 s0 t5
+divu t1 s3 a3
+sltiu x0 a2 -395
+add s5 x0 s10
+add t4 gp a6
+mulhsu ra t1 tp
+slt a4 s1 a7
+mulhsu s9 s6 s2
+add s0 gp a5
+sltiu s0 gp 1024
+xor t5 t0 a5
+sltiu s7 s6 1096
+remu s5 s7 s4
+sltu a4 a6 a4
+sltu a3 a5 a6
+srai s1 gp 10
+and s8 s0 x0
+sll a5 s5 x0
+div a5 a7 t1
+slli s8 s11 31
+slti ra t6 -1224
+sra gp t2 s4
+remu s3 s8 a3
+add a4 t3 t2
+mulhsu t6 a4 gp
+sra s8 s6 t4
+auipc a2 166317
+or s10 x0 a0
+div s7 s4 s2
+srli a2 t4 4
+xori s11 a4 -1174
+srai t2 s1 24
+andi t3 t4 1039
+srl s10 s7 x0
+lui a1 519176
+andi a1 t4 -1094
+mulhu x0 t3 s1
+sll s3 s9 a2
+divu s6 a2 s10
+srl a0 s11 x0
+ori s8 ra -967
+slt s3 s8 s7
+slti t0 s6 -1938
+or x0 a5 s6
+mulhsu t4 a2 a3
+andi t5 t2 -330
+srai t3 a3 19
+mulhsu a3 ra gp
+sll s0 t4 s7
+mulh s9 s5 s8
+slt s11 s5 t0
+slti t6 t3 1489
+sub gp a2 t3
+mulhsu s11 s5 t1
+auipc s5 602258
+srai a4 s11 10
+srl t0 s1 a6
+ori s11 a6 2015
+sub t0 s3 t1
+sra s0 a7 a7
+divu t4 a3 a6
+xor t0 s11 ra
+add s8 t3 t3
+mul a5 t4 s0
+or a0 s5 s0
+addi s10 ra -1813
+mul a4 t4 a7
+add s5 t0 t5
+or a1 s10 t3
+ori t2 s9 684
+and a1 t5 a7
+div ra a3 s4
+andi s4 a3 -1365
+auipc gp 871526
+and x0 s1 s6
+and a6 a0 s8
+mul a5 tp s3
+and t3 s6 s2
+srai s8 s0 6
+sra tp t3 a2
+add t4 x0 t2
+sub s0 s1 a6
+add a2 s3 s1
+div a2 s10 s3
+sub x0 x0 s6
+sltu s8 s8 t6
+div t3 s0 s2
+slli t5 s7 29
+lui t2 746533
+srl s1 s7 s3
+slli t5 gp 25
+xor a2 s5 s2
+sll s7 s9 x0
+mul a4 s8 a2
+addi tp a2 -309
+and gp s6 s6
+lui s3 283854
+divu s1 t0 a3
+sub a5 s9 a0
+div s4 a3 t4
+auipc s0 814755
+slti gp s10 1882
+sra a7 ra s11
+lui t5 316279
+and s6 s10 a2
+divu t6 a5 s1
+mul t6 t0 t5
+rem x0 x0 s0
+ori s0 a5 -495
+ori s5 t4 1286
+xori t0 s3 -1243
+sltiu s4 a7 -1967
+mulhu s3 s2 t3
+sltiu a6 t6 -810
+slli s9 s1 29
+xori a0 ra 320
+sub t1 s5 t3
+srli s0 t1 21
+sltiu tp a7 -1565
+slti a4 a2 605
+ori t3 t6 -1698
+mul a1 a5 s0
+mulhu s2 s1 t5
+sra a6 s8 s8
+mulhsu t6 tp x0
+srl s1 gp x0
+mulh a0 x0 s6
+slt x0 s5 a3
+slti t6 a7 -691
+andi t5 t3 -167
+rem s8 t1 t1
+lui t1 694875
+remu s3 s4 a4
+xor s11 a1 t4
+sub x0 t5 gp
+rem a4 t3 a6
+addi t6 s2 -181
+add a1 a2 s0
+srli s0 t2 0
+sra t2 s10 s4
+andi s8 x0 292
+or s10 t3 s6
+slti a7 t1 -1588
+sra s6 tp a5
+xor x0 s0 t2
+add a6 s4 a5
+sll a0 s9 s6
+rem a6 s5 s4
+divu s5 t5 a0
+slli t5 ra 11
+sra a2 t4 a5
+srai s1 t5 8
+srai a1 a2 11
+xor a2 s4 a0
+add x0 s7 s2
+sltiu tp a7 1585
+ori s0 s1 -184
+sltiu t1 s7 -1842
+mulh s6 t5 s4
+sra a5 t5 ra
+addi x0 t2 1533
+mulh s8 a1 s8
+lui s5 289265
+sltu t4 a1 s2
+slti s9 s11 -1739
+mul t1 t3 t6
+slti s11 s7 1197
+mulh t0 s4 s8
+srli a0 t2 9
+divu s5 s9 a4
+mulh t2 t2 t2
+and t6 a2 a6
+lui s10 65003
+div x0 t4 s3
+mulhu tp a2 s1
+mulh s7 a0 t5
+auipc a3 484020
+div a3 t0 s2
+divu s10 tp x0
+auipc t2 60586
+remu x0 t5 t1
+auipc a5 659700
+rem s4 t4 a5
+rem a3 a6 s10
+sll a2 a3 s1
+sub s5 gp x0
+sub s10 s4 s7
+addi s6 s8 -1503
+srai a5 s6 20
+srl t2 t3 gp
+srai s4 s11 3
+div s9 a0 ra
+ori s0 a4 851
+mulh s1 a0 a5
+or gp ra a4
+mul a5 s10 t3
+xor s4 s6 s2
+sra t1 t1 s4
+slt t4 x0 t6
+mulhu t3 s8 s8
+mulhu x0 a5 t5
+srl s3 s2 s4
+divu t2 gp t2
+sra a3 s10 s8
+slli t3 t6 22
+div s8 x0 s10
+mulh s6 a6 s10
+mulhu x0 a1 a3
+srai s6 s7 29
+remu t6 s8 a6
+lui a7 421857
+mulhsu a6 s5 t6
+mulhu a3 t6 s5
+srl a2 a5 s6
+srli a3 s8 1
+sltu a0 a7 s1
+and a7 s7 t2
+srai s8 a7 9
+or a1 s2 s10
+slli s2 a3 17
+and tp a7 t0
+mulh s8 s6 s3
+mulhsu a4 a2 a6
+srli t3 a2 20
+andi t6 a4 971
+and a6 t4 a5
+addi s7 ra 970
+add t2 s1 s11
+andi tp a7 35
+slti x0 s0 1266
+sub x0 s3 t4
+ori a5 a5 2044
+addi t3 t4 -1761
+xori s7 a6 2027
+sltiu a0 s4 -762
+lui t3 906192
+ori s2 x0 471
+div s9 s10 t4
+and x0 a1 s6
+slli x0 s8 12
+rem a1 s5 a7
+and s11 x0 t2
+andi a6 s8 -1424
+slt s6 x0 s6
+divu s3 s4 t4
+auipc s11 276546
+andi t2 s11 -1014
+and s3 t1 ra
+add s11 t2 s6
+ori s11 x0 917
+slti t0 t1 -198
+sltu s8 a0 s11
+auipc t3 69140
+xori a0 s2 -1853
+addi t6 a6 -348
+slti tp t6 -1327
+slti s2 s11 1402
+divu s7 t5 x0
+andi t6 a0 783
+ori a6 t5 -762
+add s8 s11 s9
+xori s6 a1 -1681
+slti t0 s7 -2045
+add s4 t3 x0
+and s6 s8 s2
+or s4 a0 a0
+xor s10 x0 a4
+xori a3 gp -528
+remu s6 a4 s0
+slti a6 t0 1896
+ori x0 s7 -908
+slt a2 t6 s9
+remu a0 a2 s9
+mulhu a7 ra s8
+rem t6 s6 a0
+srai gp a4 20
+remu s2 s10 s4
+lui t0 341741
+xor t0 a1 s8
+mul s8 tp t5
+ori s10 s2 -188
+andi a0 t3 -269
+srli ra x0 21
+sub s2 s3 s1
+mulhu x0 a1 ra
+xor s10 ra s3
+add x0 s8 t2
+sub s11 t2 s7
+srli ra tp 8
+lui tp 200081
+rem t1 s5 a0
+auipc t4 954459
+srl s5 t5 s3
+ori t2 s8 1684
+srai t5 a3 28
+lui s0 1009225
+sra x0 x0 x0
+divu gp a4 x0
+xori s1 a4 -1143
+sltiu tp s3 -590
+add a1 s10 gp
+srai ra s8 1
+divu x0 a0 s2
+slti t0 s7 429
+addi ra s7 1126
+mulhu tp s2 a1
+lui s6 848929
+or s3 a5 t5
+ori a5 a3 -1002
+mulh s5 a7 a4
+or a7 a7 a2
+div s10 gp t1
+srli s8 s9 17
+auipc t5 518306
+sub s10 t1 a7
+addi s4 s3 1819
+slti s1 s5 -1217
+slli s8 s6 18
+or s1 s0 a6
+and s0 x0 tp
+and gp ra s8
+addi t2 x0 -806
+slti x0 s0 -901
+slli a6 s11 13
+add a2 a3 a5
+rem s7 s11 tp
+sltu a3 a7 s4
+sub a2 tp t3
+add t2 t5 a3
+sll s9 a3 s5
+xori t0 x0 -1380
+xori s9 s4 -1253
+add s8 a6 s7
+sll t2 x0 t5
+mul x0 gp a1
+rem s1 s4 s6
+or s2 s6 t6
+divu a7 a4 t2
+div a0 s10 s0
+auipc a5 1034061
+add s2 t2 s4
+sltiu x0 a2 -1685
+auipc s3 398119
+divu s4 s5 a4
+sltiu x0 s5 1770
+slt s4 t5 gp
+slli gp a3 23
+xori a1 a3 1719
+add tp s4 s5
+remu x0 s11 s7
+slli a2 a3 16
+mulh x0 tp ra
+sltu a0 s11 t1
+sltiu s11 a6 1560
+srai s0 tp 11
+mul a5 s11 x0
+mulh ra t5 s1
+xor t5 s3 ra
+sra a1 s9 s3
+xori a0 s11 -361
+lui s11 221145
+addi t5 s2 1437
+sll s6 s5 a4
+add s4 s5 a1
+rem s4 a6 s9
+sltu t3 a5 x0
+auipc s10 138953
+or ra s7 s7
+remu x0 t6 a1
+slti a6 t1 -42
+srl t6 s11 s3
+divu a0 a3 s2
+xori s10 s2 -1592
+slti a0 a1 -1656
+mul s4 a1 x0
+addi a2 s6 -159
+xori s1 t6 1259
+sltiu a3 ra -109
+xor s4 s9 s9
+xor t5 t4 a4
+slti t6 s7 -110
+andi t2 s7 -97
+remu s5 s6 t3
+and t6 ra ra
+andi a4 s8 -101
+mulhsu s8 t5 s3
+mulhu tp s8 a6
+add a6 s1 a6
+srl a5 s4 a0
+lui t2 585829
+srai a5 s4 26
+sub t1 s3 s11
+addi s6 t6 1504
+add s8 s0 a6
+or a2 s1 s1
+divu t0 s0 t1
+ori t5 x0 -1595
+mulhsu s3 s9 t6
+xori x0 x0 -1127
+andi ra s3 493
+srli x0 a2 31
+sll a5 gp x0
+sltiu s0 s10 -1697
+srl x0 s6 s1
+ori s3 t5 -1008
+sltu x0 s7 s0
+xori x0 s5 -207
+sll a1 s8 t6
+div s10 a5 t2
+remu a6 gp s11
+sltiu t1 a3 -256
+lui x0 751940
+sltiu s7 a3 -414
+sltu a1 t4 a2
+addi a1 x0 -1538
+div a0 ra t2
+srl a5 a2 a1
+sub t0 s3 a6
+mulh s4 t6 tp
+srli ra s10 0
+slti s2 a0 -1123
+xori t1 a6 -549
+sll s10 x0 s9
+sub a4 t2 x0
+slti a3 a2 -1010
+xori t2 s3 -1389
+mulh t0 s4 gp
+mul ra s11 t2
+sll s8 x0 a4
+add x0 t5 s9
+div s10 s1 t3
+or x0 t2 t2
+and a0 x0 s6
+mulhsu x0 a7 s10
+srli x0 ra 8
+slli s1 a5 11
+or s9 s4 s10
+mulhsu tp s6 t6
+sltiu a2 t0 -537
+srai a7 x0 2
+slli s3 t2 23
+xor s1 s4 s9
+mulhu s2 s1 s7
+lui a6 261602
+lui t2 822863
+or t4 a7 t3
+or t0 x0 gp
+and a6 t1 s4
+sub t1 gp ra
+srli a6 t2 14
+sll a7 s6 s1
+add t3 a4 s11
+sltu gp tp t1
+slli a2 t4 28
+sub s0 s1 t4
+srli a1 ra 3
+lui s6 285763
+slli t5 x0 14
+ori s9 a6 -2021
+ori t3 t2 -1442
+addi t0 s3 1271
+mulh x0 gp t2
+div t5 t4 t0
+mulh ra s11 s3
+slt tp s5 s4
+xor s10 a0 a3
+sub a7 t6 tp
+mul a4 a5 tp
+or x0 a3 a7
+xori s2 gp -1775
+or ra t4 s11
+mulh s4 a2 t0
+andi t0 gp 1629
+mulh s0 t1 a1
+remu a5 s0 s0
+rem a2 s6 s10
+div a6 t6 s0
+mul s7 a2 s2
+mulhsu s3 t1 t1
+srli a2 t1 26
+rem x0 t4 s4
+lui a2 922892
+lui x0 183161
+mulhu t4 ra s0
+sub a3 t5 gp
+remu a1 s5 s10
+slt s6 s10 t6
+ori t3 gp 882
+mulh s9 s2 s4
+mul s1 s2 s7
+remu x0 a2 s9
+xor s0 t6 a1
+auipc t1 945840
+xor a0 s5 s2
+remu a2 a0 t4
+mulhsu a2 s1 s10
+mul t3 ra t1
+srl s11 a4 t2
+srli s8 s5 15
+srai a0 a7 2
+sll s2 a1 x0
+or t0 s7 s11
+xor t3 a3 x0
+srli a5 t5 8
+mulhsu s2 s11 a5
+remu t1 t6 a5
+lui a4 743659
+srli s5 a5 22
+rem x0 s2 x0
+lui ra 535934
+sll a4 t1 x0
+sub s8 x0 t0
+auipc gp 242729
+and x0 s3 t2
+sltu t5 a7 t5
+ori a2 s3 -1577
+or a5 s3 a0
+lui t1 936171
+lui s7 2070
+remu t1 t2 t5
+srl s3 s2 s1
+auipc a5 244237
+and s7 x0 a0
+and a2 s0 a2
+slt s10 s6 s7
+mulhsu t4 ra a2
+add s11 a1 a6
+rem x0 t6 a6
+or s10 a2 a7
+sra s6 s6 s6
+sltu s3 a6 x0
+mulh s4 s5 s2
+mul s8 s10 a3
+slti s1 a2 -976
+or t5 s3 s10
+ori a6 a4 610
+ori tp s3 1586
+auipc a1 293406
+mulh tp x0 a7
+slli a6 t1 8
+xori a4 s3 -1822
+xor s4 x0 t0
+auipc s5 356363
+slli s11 a5 17
+add s0 a4 t4
+auipc s0 92822
+div s2 t3 ra
+or s8 s10 ra
+ori tp t3 -243
+xor a1 s6 x0
+slt a1 ra ra
+div t0 t5 gp
+slli s5 t1 6
+srai s2 a5 1
+auipc a0 360474
+sltiu s5 s0 -117
+or t3 a5 gp
+mul s1 s7 t2
+sub a6 s2 s6
+xor x0 t6 s6
+srai t0 s6 14
+xori s6 s4 822
+xor s6 t0 t6
+mul t6 a5 a3
+sltiu a1 t3 1959
+srli x0 s6 27
+andi s2 t1 29
+sltiu s11 x0 944
+divu s6 t4 s9
+sub t4 s9 ra
+slli t0 a1 26
+sra s10 s4 s10
+mulh gp a6 s4
+rem s8 s1 s11
+divu s7 gp t0
+sub tp s1 s9
+addi s3 t2 -994
+andi s1 s5 879
+srl a1 a7 a0
+sra s8 s8 t1
+andi s1 s7 -1470
+and t2 a3 a0
+or s2 t5 s3
+auipc t4 232321
+srai s5 t4 23
+auipc x0 417551
+sra tp s11 t0
+mul t4 s11 a3
+srl x0 a7 a5
+xori s1 t6 -1963
+remu a5 a5 s3
+srl x0 tp a6
+srl a5 t0 s6
+sll s5 t0 s2
+auipc t1 343851
+mulh ra a7 t1
+rem ra t2 s11
+sltu a0 t3 t4
+mulh ra a6 s8
+mul a4 s5 a6
+and t5 s3 x0
+divu t0 x0 s10
+and s11 s10 a6
+ori s5 s8 -60
+auipc s0 481987
+sltiu s9 s3 -1175
+sll s3 a3 t1
+div s1 s5 s6
+sltu a2 t4 a6
+auipc t2 810071
+mulhu a1 t2 a1
+and s3 s1 t3
+mulhu s4 a7 t6
+auipc a3 632637
+srl t2 tp a3
+and a0 s10 ra
+srai s3 s7 18
+sub a5 a6 s0
+slli ra s0 26
+addi s10 s5 -690
+mulhsu a4 s7 s7
+sub s9 x0 x0
+sltiu a4 x0 -936
+remu s5 a0 s10
+srli a2 a3 2
+sltiu t1 a0 -886
+slt tp t4 t6
+xori t4 x0 1445
+ori a4 t5 -1277
+auipc x0 606050
+sltu s8 x0 s0
+add s1 a1 x0
+slli t1 s9 2
+sra a7 gp t4
+sll s10 x0 t0
+div a0 s9 x0
+slti s9 s11 -1901
+div s10 a1 s11
+sll t4 t1 tp
+mul s6 x0 a0
+sltu s4 x0 x0
+mulhu a7 t3 gp
+or s4 a1 a0
+sltu s9 s11 x0
+mulh ra a4 t4
+div s7 a3 a0
+mulhu a2 a5 tp
+mulh s6 s0 a1
+addi t6 s10 1745
+auipc a1 476611
+sub s5 a0 s9
+mulhu a1 t6 s3
+slli s11 s1 23
+and s10 a6 a1
+rem t3 s6 t2
+mulhu s2 s7 t2
+andi t5 s0 -1884
+sub t1 a4 t1
+sra a0 s6 ra
+srl x0 s9 t6
+sltiu a7 a2 -2011
+remu t4 s3 a7
+mulh a6 a3 x0
+mulhu s4 tp t4
+mulhsu a3 a5 t1
+remu gp s11 s9
+xor tp s8 s2
+srl gp gp x0
+sra ra a1 s2
+srl s10 a5 t1
+add s8 s7 t2
+mulhu t1 s8 s7
+slli a1 t6 2
+mulh t1 a5 x0
+rem ra s0 t6
+srl a1 t5 t4
+divu ra x0 t1
+sltiu s1 tp -1728
+div a1 a6 x0
+xor t3 a0 t6
+and t2 t4 s9
+slt s6 s0 s1
+addi s0 a2 1354
+andi x0 s4 1112
+auipc t1 489
+or a5 gp s0
+sltiu a5 a4 -1358
+andi t1 t4 -1694
+mulhu x0 x0 s1
+sltiu t4 s8 -599
+sltiu s5 s9 1530
+sll s10 s11 gp
+xori t2 t1 -415
+srai a5 t1 2
+sub s10 s1 s10
+sltu ra s11 s7
+ori t6 a3 -1451
+sub t0 a2 s1
+slli a6 s6 10
+mulhsu s10 a7 s1
+andi t2 t1 -1441
+sub s3 s4 t4
+ori s2 a6 1581
+ori s0 a4 -1608
+and a0 a4 x0
+srl a6 a7 s0
+mul t6 t1 ra
+ori s4 t6 -622
+andi t6 ra 1191
+addi a7 s11 1741
+add s1 x0 s6
+sub a0 tp t6
+xori t2 s0 -1509
+xor s6 a2 s7
+sll t5 gp s4
+mulh t2 t0 s1
+srl x0 a0 s6
+mul s7 s2 a2
+sltiu x0 t3 -310
+andi a7 s11 1449
+sra s8 t5 tp
+slli t2 s11 26
+srli t2 s7 12
+srl a0 s2 a2
+slt a3 s8 a7
+sub s9 t5 x0
+mulh s9 a3 s9
+mulhu a1 t4 a2
+mul tp t1 s1
+mulh x0 t0 t0
+mulh t0 s0 a3
+ori s10 s8 -1033
+srai a1 s3 25
+andi a2 s10 1390
+srai s0 t4 21
+divu a5 s3 s4
+xor a3 a4 s1
+or s5 t6 a3
+mulhu s2 t3 a7
+lui s8 813412
+or a0 s3 x0
+xor s4 a1 s10
+rem a2 s0 s11
+mulhsu a3 a6 s4
+sltiu a4 s6 -857
+add a4 t4 s1
+sltiu s10 s2 -554
+mulh s5 s10 t4
+and a3 a0 s1
+mulh a5 s9 x0
+xor t1 t3 s11
+sll t2 t0 t6
+mulhsu s7 s10 x0
+ori s3 a1 196
+sltu gp t1 a7
+rem x0 a6 a4
+mulh s4 a6 tp
+auipc s10 390124
+slt s11 s5 gp
+sltiu s5 a7 -1073
+xori a1 gp -136
+slli t1 t3 5
+remu x0 s5 s8
+xori s11 s3 -1669
+and s9 t3 s10
+mulh s7 t5 s5
+remu s5 t4 a3
+slt a7 t5 s8
+remu a6 t6 t2
+mulh x0 a7 s1
+or a2 x0 s5
+slti t1 t5 -729
+srli a6 t3 16
+slti s8 t0 -954
+rem t4 a4 a6
+slt s11 s10 ra
+mul t5 s4 gp
+srli a6 s11 14
+sub a5 s9 t1
+mulhsu s5 s7 s3
+div s0 t0 s9
+mulh s0 ra a5
+slli t5 s9 18
+xor s6 gp t0
+sltu s6 gp s3
+mulhsu t2 s6 a5
+div s3 a3 a5
+slt a4 s6 t2
+slti a2 tp -175
+srli gp t0 5
+mulhsu t6 s7 a6
+srl t5 s2 s6
+add s1 a7 ra
+and x0 a1 s2
+remu s8 a2 a4
+mul x0 t0 t0
+srli t1 a2 28
+mulhsu t3 s0 a5
+sra a2 t3 t2
+srli a2 s10 14
+lui a1 119951
+div s9 a1 s5
+ori x0 t2 -516
+slt a4 s6 s3
+mulh t1 t2 s9
+auipc t1 308225
+srl x0 tp s2
+mulh s10 a4 t2
+div a3 a7 s1
+slti s2 tp -1150
+auipc s3 290209
+xor s8 s1 s3
+add a3 s0 t5
+auipc t2 195910
+remu a6 s1 a2
+sra tp s1 s0
+lui t3 265979
+addi t5 s8 1622
+sra s2 x0 s8
+add t4 ra a3
+andi tp s2 -1548
+xori a2 a6 -576
+andi t5 s5 2009
+ori s7 s10 -1096
+mulhu s0 s9 t5
+add t3 a6 x0
+or a7 a4 gp
+sltiu t2 x0 -895
+lui s2 535869
+sub x0 ra s4
+sub s8 t2 s4
+andi s4 s4 87
+sll a0 a4 t3
+xori x0 tp 2008
+rem ra s8 s4
+andi a7 s5 -1969
+slt gp s3 t1
+andi t2 s5 -1073
+sltu s1 tp tp
+srli a0 t5 29
+rem s0 s3 a7
+srl s11 x0 a7
+auipc t1 139396
+mulhsu s11 gp tp
+srli s0 s2 23
+addi s11 t6 -907
+add t1 s9 a3
+mul s2 s11 s6
+remu gp s6 s2
+xor s6 a4 a4
+divu a4 a7 s2
+auipc a4 767509
+sll s1 t0 a6
+sltiu s6 a1 -626
+srl t0 a5 s1
+srai s1 s3 29
+andi t4 s3 -1666
+or a6 s10 s9
+slti ra a2 -1071
+mulhu t5 a1 a1
+andi s3 s3 -990
+sll a6 a4 ra
+div t1 gp a5
+srli s8 s9 10
+slti x0 s5 -2029
+sltiu t2 a6 -327
+div gp a4 t1
+and s3 x0 a5
+mulhu t5 s10 a1
+sltu t2 a3 s3
+div x0 s1 ra
+div s10 t5 s8
+sltiu a0 gp 1004
+div s2 s0 s11
+sll t1 s6 a2
+sra s6 a4 t3
+slli s0 a3 28
+slti s4 s9 -378
+sra t1 t3 a0
+add s5 t6 t5
+add t6 ra a1
+div s3 t2 t1
+addi x0 x0 -682
+sub s5 t0 s0
+mulhsu s10 a5 a5
+mul s10 s8 s11
+mulhu a5 s10 t1
+divu t1 tp tp
+srl s4 ra t3
+div gp t0 s4
+srai t3 s6 1
+and t0 a6 gp
+mulh a1 t6 a4
+slti a7 x0 809
+sra s2 s7 s4
+srai t2 t4 5
+andi a4 a1 -1473
+xor gp t4 t1
+sltiu s4 x0 724
+xor gp s6 s3
+auipc a6 319755
+xori t2 t2 1990
+rem s11 s3 t3
+ori a1 a4 -595
+rem t6 a7 s0
+xori x0 s2 -241
+sra t6 t6 s6
+slti t0 s4 -801
+remu s8 s11 gp
+and a5 t2 s2
+xor t2 t6 s7
+remu s11 s9 gp
+xor s2 s10 s1
+lui s5 341361
+mul t3 s7 s6
+remu x0 t5 s5
+sra a3 s8 s7
+addi t2 t6 1167
+xor a2 a6 t1
+slli s10 t5 18
+sra a0 s9 t1
+srl s5 t2 a2
+srai a1 a7 2
+slli s8 s2 4
+remu s5 s9 x0
+slli s3 t0 7
+srl t5 s11 s9
+andi t0 a0 -1880
+sltu s8 t0 s9
+lui a0 1045519
+sltiu s7 t3 963
+mulhsu ra s7 x0
+xor a3 a0 t4
+auipc s10 983593
+add a0 a3 s5
+and s0 a5 s7
+xor t6 t1 a0
+mulhsu a4 tp s4
+srai s8 s10 3
+add s8 s8 t1
+andi t2 a0 883
+addi s2 x0 -1332
+xori a1 x0 725
+sub s0 s4 t6
+lui a2 782320
+slt s4 s2 a4
+div x0 s4 x0
+ori t1 s0 -549
+xori a2 t0 -1416
+mul s3 s2 gp
+slti t2 t5 90
+mulh a6 a5 t0
+srl a1 a2 a5
+rem s7 a0 s11
+srl s7 x0 t3
+andi s7 t4 -1369
+slt s5 a7 a7
+srai s10 t1 18
+sltu gp s6 t1
+addi t5 gp -1870
+lui s1 584226
+mulhu a3 s6 s9
+slli gp t6 3
+slli t2 s11 17
+auipc t0 130198
+xori a4 s10 -615
+xori s10 tp 937
+srl s0 s3 s8
+rem s7 a4 t4
+slli t2 t6 19
+srai x0 a2 27
+or s5 tp s5
+slti s4 s7 -22
+andi t3 a5 -1011
+mulh a1 s2 t6
+sub t0 a4 a2
+srl s1 x0 t4
+ori s11 s10 -995
+mulhsu a3 t2 a6
+ori x0 t0 732
+mulh t2 s1 t1
+slt a1 s8 t2
+slt t5 a5 a3
+mulhu t3 t1 t4
+slt t1 a2 s7
+divu x0 t0 s6
+srai s10 a4 15
+or s11 s0 a6
+div t4 s11 t4
+ori a0 s1 -950
+addi a1 t0 1428
+mulhu s7 a2 t2
+mulhsu a3 a4 s2
+srli tp t3 4
+sra t3 t0 s0
+sltu a2 t1 gp
+srli s0 s7 3
+sltiu s1 t4 781
+sra s10 t5 ra
+andi t4 gp -249
+srl a6 t4 s5
+add s1 gp a2
+andi s2 t1 1705
+slt s0 s10 a0
+mulh s3 s2 a6
+xori s6 a7 828
+auipc a1 63435
+and t0 s11 a4
+xori t4 a5 -1068
+srli a1 t3 28
+xor gp ra a6
+and s2 a2 x0
+srli t4 a6 7
+slli a5 t2 3
+srl s6 t5 a0
+divu tp t6 s6
+auipc t5 220438
+mulh s9 s10 a6
+andi t2 a5 -1890
+mulh s5 s11 x0
+srl a4 x0 s9
+rem s0 t1 a1
+mulhu s10 t6 s11
+xor t3 a6 t2
+sltu s6 x0 a6
+andi s0 t1 -1286
+srli tp gp 3
+rem s1 s4 a5
+srai a6 s1 25
+slli ra a4 4
+srai t3 a3 16
+sra s10 s7 x0
+sll s7 t2 tp
+sltiu s6 a7 1718
+slt s10 a7 s9
+slti t5 a3 -1037
+sub s7 s10 s11
+divu s10 s11 a2
+add x0 s10 a5
+mulhu s8 t6 t1
+srli x0 s2 2
+or t6 a0 s7
+sltu t6 t1 s7
+srai s10 x0 24
+auipc s9 788384
+rem s1 s6 t2
+srl s7 s2 s0
+mulhu s2 s10 a2
+andi a4 ra -377
+sll t1 t5 a6
+mulh t2 s2 s1
+or s1 t1 t1
+xor t0 ra t0
+xor t1 s3 tp
+mulhu s4 a2 t5
+remu s2 s11 s5
+sltu x0 s3 t1
+mul x0 t0 s11
+slli t2 s0 3
+srai a4 s2 4
+ori t4 a3 1536
+rem s10 s11 s4
+sll a5 tp a0
+addi t4 t1 1118
+sltiu t6 a2 676
+div s0 s8 tp
+rem s8 s0 a6
+auipc a3 751047
+divu gp s1 a6
+sra a2 ra a4
+mul t5 s0 x0
+srl t2 a2 t3
+rem t5 s8 tp
+sll ra t3 t0
+slt s2 t0 s9
+and a1 a6 s6
+xor s4 x0 a7
+xor s3 t3 s7
+remu s3 tp s0
+mulhu x0 t3 ra
+remu s5 s0 a5
+div a7 a4 s5
+xor t4 t2 t5
+mulh a7 tp s8
+ori x0 a7 1023
+sra s3 gp s10
+remu t6 t5 s5
+slti s7 t4 1844
+srl s8 s9 t3
+mulhsu t4 s11 s6
+addi a4 s10 1904
+sll s0 s7 s6
+slti s10 a2 -427
+remu s7 s9 s10
+div tp s9 gp
+lui s7 718579
+rem a4 s8 t5
+xor s4 s9 t2
+sll t4 s6 t0
+add ra a6 a3
+xor gp a6 s11
+add t3 s3 tp
+remu s2 s6 a4
+sub x0 ra s5
+mulh a6 a5 s9
+ori a3 ra 1825
+addi s0 s2 -1157
+lui ra 331454
+sra a7 gp x0
+remu s6 s11 a0
+lui t4 926647
+sltu t5 s2 t2
+and t1 a0 s9
+srai s1 a1 19
+add s6 s9 t4
+xori a3 a2 -1586
+add a6 s1 s1
+rem s0 t1 a2
+srai s7 a4 6
+srl x0 x0 s8
+ori s6 s1 1970
+divu s11 s6 gp
+xor s0 s8 t5
+slt a5 a5 a4
+slt t1 t3 tp
+divu t6 a7 a0
+andi s3 a6 -1524
+auipc s6 392232
+or a2 a6 t1
+slti a7 a5 -102
+mulhu a2 s10 ra
+mul tp s10 a5
+srli s4 gp 23
+andi s6 t0 1737
+xori t6 t2 -215
+lui s5 428059
+sltiu s6 s0 -797
+add a7 gp s7
+xori s10 a3 -724
+auipc t4 911797
+sltiu s3 a4 -531
+slli t2 a5 26
+div a3 a2 s9
+addi s10 s2 -131
+srai a5 s2 27
+mulhu s1 a6 a5
+lui s10 1003627
+add s3 a7 s2
+rem x0 t1 s7
+sra s4 s9 ra
+lui s3 806058
+slt t3 s4 a5
+lui s10 762676
+slt gp a6 a4
+mul x0 a5 tp
+divu tp t5 t6
+sltu x0 a2 a2
+sltiu t0 gp -925
+lui s9 161273
+slti s10 a1 -184
+rem t3 t3 s8
+sub s9 a0 t4
+addi s10 a0 -462
+divu s1 t1 s6
+mul t4 s8 x0
+mul s2 x0 s9
+divu s3 t2 a6
+xor s11 t4 a3
+xor s7 a4 s6
+slli s1 a2 15
+xor s5 s3 s1
+andi s8 gp -1093
+sra s1 a5 s3
+mulhu s4 s8 a7
+andi s7 a7 -1210
+add t2 s6 t5
+or t6 t5 s1
+andi a7 a7 -1090
+divu s5 s2 t5
+mulh s9 t5 s8
+rem s7 s1 t5
+div a2 ra a2
+andi a5 a6 254
+addi ra gp -696
+div s3 x0 t0
+xori x0 ra -1003
+mul t2 s4 a7
+sll t6 a1 a0
+slti x0 s5 -412
+slti gp s10 -1943
+sra t3 s3 s4
+mulh tp t5 x0
+auipc x0 863220
+andi s7 a4 -70
+mul t1 s10 a7
+mulhu x0 s3 s5
+remu s10 s4 s3
+rem x0 s8 x0
+remu s0 s0 s2
+xori t2 t3 635
+mulhu s0 t6 t3
+sll s6 x0 s2
+sub a0 t1 t5
+mulhu t6 x0 t5
+auipc a7 671934
+xori gp t0 -743
+slli s3 x0 29
+div s0 t2 a2
+sltiu t4 tp -1387
+mulhu a2 t1 s7
+rem a3 t3 s11
+and t4 gp a6
+srai tp ra 10
+srli t3 a5 22
+remu s5 s11 x0
+addi a1 t2 -999
+xor s9 a6 gp
+srli x0 gp 14
+mulh ra s7 t6
+addi t4 t3 -193
+remu a6 tp s3
+remu t1 s1 t6
+sra s8 a6 s1
+slt a4 s0 s3
+auipc s4 289084
+divu t4 s10 a6
+sra t0 tp a7
+andi a7 t6 -300
+sra a6 s10 gp
+addi a3 a2 -16
+addi a5 a1 1160
+sltu s3 s2 ra
+remu a5 s2 s2
+srli t1 x0 1
+lui s4 231207
+mulhsu s11 a5 t4
+sltiu a2 s0 -145
+and x0 s0 ra
+mulh x0 s7 gp
+sltiu x0 a4 -769
+srli t5 a3 12
+srai t6 s4 15
+and t3 gp gp
+sltu s9 s6 t3
+mulhu s1 a1 a6
+sltu t4 a4 tp
+add t1 s2 s5
+mulhu a6 s1 s2
+addi ra s4 947
+srli t2 tp 28
+addi s0 gp 955
+auipc s4 279837
+slli a7 s6 22
+xor s3 s1 s9
+sub t0 t5 s3
+div s11 tp s2
+and a5 a6 t0
+and s7 t0 a4
+slt s5 s5 t6
+xori s3 s1 -169
+sltu t1 a5 a2
+mulhsu s8 t5 t0
+xori s0 tp -1173
+lui s4 538751
+add a3 t4 s9
+xor s7 a7 s2
+addi a0 x0 47
+mulhu x0 t6 s0
 addi a0 x0 10
 ecall
@@ -30,15 +30,15 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-sll t0 a1 a1
-mulh a0 s4 tp
-sltu s4 a1 x0
-add x0 s9 t1
-srl s7 s8 s9
-sll s8 t5 s0
-ori s11 s6 -180
-mulh a5 a6 s5
-mulh a0 s6 ra
-auipc s0 673652
+slt s8 s9 gp
+slti gp t2 -769
+slli t0 s3 18
+remu tp a0 t6
+rem s5 s7 a6
+srli s6 s7 2
+rem s11 a6 t3
+slli tp t2 8
+auipc s7 17834
+auipc a6 410112
 addi a0 x0 10
 ecall
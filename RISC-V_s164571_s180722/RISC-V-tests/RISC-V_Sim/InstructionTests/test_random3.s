@@ -30,15 +30,15 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-or a2 s10 ra
-srli s0 s5 1
-mul t2 s0 s5
-lui s4 1013743
-sra a6 x0 a2
-and t4 a7 s5
-remu a2 t5 t3
-mul a7 a6 s3
-mulhu a1 tp x0
-srli t6 t3 19
+rem x0 s0 t5
+sll ra tp t6
+srl a5 a5 t0
+mulhu a3 s9 a3
+addi gp a2 -577
+sub s6 s3 a2
+srai a0 t0 10
+add a7 a1 t4
+sub s0 t0 a6
+mulhu a5 s5 s2
 addi a0 x0 10
 ecall
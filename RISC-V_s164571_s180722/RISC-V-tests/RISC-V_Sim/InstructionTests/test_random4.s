@@ -30,15 +30,15 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-mulhsu a3 t0 x0
-addi t3 a1 -463
-andi s10 a3 1791
-mulhu a0 s1 s10
-add s10 a0 a5
-rem t0 a0 t5
-divu s6 a4 s11
-sub t6 s4 x0
-xor t2 x0 x0
-sra a1 a1 a3
+ori s8 s5 1947
+mulhu t4 t2 a2
+sll a3 s5 s5
+div s8 s3 s9
+sltu a5 t4 t4
+mulh t2 ra x0
+add a2 a2 t3
+and x0 s0 s8
+rem t3 a0 a6
+slli x0 a4 25
 addi a0 x0 10
 ecall
@@ -30,15 +30,15 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-divu s3 s4 s5
-ori a7 a1 -1319
-add s9 s2 s10
-slti t3 s4 122
-sub a4 s8 x0
-addi ra s4 -747
-slti a6 s6 -538
-srl s7 x0 s7
-slti t0 a1 -1721
-add gp gp s9
+sltiu t6 x0 -627
+and t1 t4 t6
+slt a6 gp s11
+slli s9 t1 18
+xor t5 t0 t2
+mulhsu a6 t6 t1
+sll s3 t2 a2
+auipc x0 317843
+or a2 t3 tp
+divu t3 x0 a6
 addi a0 x0 10
 ecall
@@ -30,105 +30,105 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-srli s4 t2 15
-divu a3 a0 s1
-add ra s2 t5
-ori x0 x0 -528
-srli t4 x0 24
-lui t5 498456
-divu t5 t4 s5
-mulh s6 s0 x0
-addi t6 gp 133
-sltu t0 a3 a2
-slli t0 s5 2
-xori t1 a5 1543
-sra s9 s7 gp
-divu a4 a4 t6
-rem s0 t2 s8
-divu t3 s7 x0
-auipc ra 82509
-ori s6 s8 -138
-sltu a6 s10 s7
-mulhsu s1 s4 s4
-mulh s7 a4 s2
-sll a4 s4 s10
-slli s6 s2 25
-or s1 t6 tp
-andi a3 t3 -85
-mul s1 ra a3
-xor s1 a7 t1
-or s0 s4 tp
-srai s1 s3 13
-or s4 s3 s1
-div s1 s0 a4
-slti s10 t2 -1832
-divu s9 x0 a1
-addi t2 s2 916
-remu s6 a6 a5
-mulh gp t2 t3
-xor x0 a1 gp
-srai x0 s10 10
-addi a6 s9 1961
-sub s1 s10 s5
-sltiu s0 s0 1705
-slti a2 s8 -2028
-add t1 s10 s3
-andi t6 s10 -250
-slt a3 a0 a1
-auipc t3 150406
-srli s6 x0 19
-slti a3 a6 -1724
-srli a5 s5 26
-add s10 s5 a5
-srli x0 s7 0
-sub a7 t4 a2
-addi a4 gp -358
-mul s5 t4 a0
-slt t4 s6 s8
-addi s2 t6 -149
-rem a7 s11 a1
-lui t3 353944
-or s2 s3 a7
-srai gp x0 29
-and s3 s4 s9
-remu a6 s4 s2
-sub t3 a6 t6
-slti a6 x0 -1806
-divu s11 t1 a0
-auipc t1 53330
-sltiu t1 t4 -904
-slti a5 a7 -1168
-rem a6 gp t1
-lui a5 390744
-and s6 a2 ra
-xor t4 s10 t2
-xori s7 ra 159
-remu t5 t5 a0
-divu s6 t3 s1
-rem t4 s11 s4
-sltu s1 a5 t6
-mulhsu a2 s7 x0
-or s10 gp x0
-ori s3 t4 -1969
-auipc s6 984249
-or s10 x0 a7
-srai t1 ra 9
-lui x0 990548
-xori s0 s5 -1485
-srli s9 gp 24
-sub a5 a6 a6
-mul a7 a3 ra
-div s6 s11 s5
-sltu s5 a4 a1
-andi a2 t4 -875
-or t2 s0 a6
-sltiu a5 t1 699
-slti a5 s0 -1647
-sll a0 s9 t0
-ori a2 x0 -877
-sub ra s10 s5
-rem s7 t1 ra
-srai a4 s8 4
-xor s7 a4 a0
+sub s8 s3 s5
+slt s8 s8 s9
+sltiu gp s10 -1105
+sra t4 s6 s0
+mulhu a7 s1 s2
+xori t1 t4 -194
+slt x0 s4 a5
+slti t6 a5 41
+addi s7 t4 -1921
+divu a6 s4 t3
+sll s10 t6 a6
+sltu s9 s2 a2
+andi s2 s8 1257
+sltiu s2 t2 -1345
+mulhsu s6 a3 s4
+sltu a4 x0 a4
+xori s2 s11 -1990
+sub s7 ra t2
+sub s9 t0 x0
+auipc x0 647879
+xor x0 t1 t0
+and a4 a2 t4
+slt x0 s0 tp
+mul a5 a4 t2
+addi a4 s9 -812
+sltu a7 s5 t6
+lui s11 622387
+divu t6 s9 a4
+remu a4 a0 t2
+mul s7 s10 ra
+sub a3 t6 x0
+ori t6 t6 2021
+ori s5 s10 -1661
+div s9 s6 x0
+mulhsu tp s4 ra
+ori ra ra -1324
+srli s8 s11 21
+mulh s11 t3 tp
+mulh s9 x0 a5
+mulh a3 s3 t3
+sra gp t4 a4
+lui a3 194314
+slti a6 a1 1498
+sra s3 s6 x0
+rem x0 t2 t2
+and t1 x0 t3
+sra s10 s0 s9
+divu a5 t6 s3
+addi s5 tp -974
+auipc s2 212475
+auipc a5 1027615
+ori a0 s0 -124
+remu s7 s2 s9
+rem gp t4 ra
+rem a0 x0 s11
+sub s9 tp t3
+auipc x0 548997
+srai a2 ra 31
+srl t3 s2 t1
+auipc t0 977474
+rem t5 x0 s10
+mulh a4 x0 x0
+slli gp s2 10
+srli t3 a7 18
+xori s0 x0 -1204
+add a3 s4 s10
+srli t1 a0 6
+mul a0 ra s3
+lui s10 629386
+xor gp t5 a7
+sll s8 s7 s1
+slli a1 gp 26
+mulh s4 x0 a1
+sltu a4 s5 t2
+srai t3 x0 9
+remu a0 t3 gp
+mulhu a1 s4 s1
+lui s9 999415
+sub a6 s1 s6
+srl t5 a6 t3
+andi s11 s11 -650
+and t2 t4 s2
+and t3 t0 a4
+lui x0 946039
+xori tp t3 -1812
+srl s8 t5 x0
+rem t5 s1 a1
+lui t2 625104
+add t0 t0 t2
+sub tp t3 t5
+or ra t4 a6
+rem t6 gp a3
+sll t4 a2 gp
+rem s11 a5 s7
+slti t1 x0 -1063
+slti t3 t6 53
+slt s11 s10 s6
+or s3 s6 x0
+divu a1 s0 x0
+srai t1 s11 15
 addi a0 x0 10
 ecall
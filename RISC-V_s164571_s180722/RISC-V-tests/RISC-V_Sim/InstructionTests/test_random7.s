@@ -30,105 +30,105 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-sll s9 t3 s4
-div a7 a0 t1
-sll s10 s9 s6
-sra t0 t6 a2
-slt a6 s4 s3
-div s2 s11 x0
-xor s10 s9 t0
-sltiu s5 s7 1187
-xor a4 t1 s5
-srl a4 ra s4
-mul ra a1 s10
-slli s11 a4 21
-srl s3 t1 a2
-srli a1 s8 31
-and t3 s11 t0
-sra s9 t5 a2
-sub s2 a3 a6
-divu s3 a5 a1
-srl t4 t2 tp
-or s2 t0 t3
-sub a2 a2 s11
-sltu a2 a7 t3
-sub t0 s10 s11
-auipc tp 315812
-mul s2 s3 a6
-srl a3 s5 s9
-ori t5 t1 -714
-sub t4 s8 a1
-sltu s1 a7 a0
-slti s8 t1 -1424
-mulhsu x0 t0 s10
-mulhsu s11 t1 s0
-mul s7 x0 t5
-and s9 x0 s5
-div t0 s10 t5
-add s3 s10 t5
-srl t6 s10 t2
-mulh s6 x0 s1
-ori t3 s5 -1973
-mul gp s10 s6
-slli a1 s0 17
-remu tp s10 s10
-mulhu s5 t0 a0
-srai s8 a1 1
-ori a6 s7 -1436
-sub ra t0 s0
-slli a7 s8 5
-div s4 a3 s11
-add s7 s9 a6
-auipc a5 279545
-srai s0 t2 11
-sll t1 t6 s0
-add s2 t2 t3
-srai s5 tp 4
-mul a0 s5 a7
-slt t4 t6 s11
-srli a3 t1 13
-div s2 a0 s11
-sltu s10 s1 a3
-andi s5 a5 1285
-mul t1 a4 a0
-divu t1 tp s8
-div s5 s6 t6
-mulh t1 t6 s0
-xor s8 t0 t6
-slti a6 tp -1039
-slt s8 t1 s3
-sra t3 gp s6
-srai s3 a3 19
-auipc s7 1029069
-div a2 a0 t6
-or a1 s4 t2
-slli x0 a1 29
-lui a6 885347
-sra t5 gp s6
-xor s10 a4 t5
-sra gp a5 s11
-mulh t3 gp a3
-srai gp a2 19
-lui t6 126660
-lui t4 918844
-sub t0 x0 t0
-mulhu a5 a5 tp
-addi t4 t0 -873
-mul s8 s0 s7
-srai a5 a0 27
-remu a0 a5 ra
-lui a2 582072
-slli ra a6 30
-srli t0 a7 0
-rem a3 t0 s8
-sra s3 t6 t6
-div s10 a0 t4
-and s5 t0 t5
-and a3 a3 s5
-div x0 a4 a1
-ori a1 a1 1725
-rem s9 ra t0
-divu a3 s1 a4
-or a3 s4 t3
+sltu s0 gp t2
+sltu gp a2 t2
+xori s11 t2 -1361
+slti a4 s2 -1195
+slti s8 a7 -138
+or s0 t4 s10
+srli a5 t0 14
+andi t0 a4 -724
+slt a1 s1 a4
+srli gp a7 18
+srai s1 s11 30
+ori x0 t6 1450
+remu t6 a0 a5
+sll a4 ra x0
+mulh a2 x0 a0
+lui ra 726900
+sub t0 a5 s1
+srli a5 s4 24
+slti ra a4 -348
+sub t5 s9 a5
+mulhu a2 a6 s0
+slli s0 a4 20
+slli s2 s0 0
+add s3 s0 t6
+remu s9 a1 s5
+slti t5 a5 843
+srli s7 a5 23
+addi s2 t3 -600
+div s6 s8 a7
+srl t1 s8 t3
+add ra t3 a4
+and s0 a5 s1
+or s5 t6 t4
+remu ra t2 s7
+mulh s5 s11 tp
+and t1 s4 s5
+divu s10 a6 s3
+sltu t6 a0 s5
+mulhsu gp s9 t2
+xori s8 tp 534
+divu t1 a5 x0
+mulhsu x0 s6 a6
+slt s5 s6 x0
+xor s11 s2 t4
+div t3 s2 s0
+slli a4 s11 2
+mulh ra s2 a7
+mul s5 s9 t3
+div s5 a7 s3
+or s3 t4 x0
+srai s0 t2 23
+sltiu s9 s9 -862
+divu t5 t6 t0
+xor t5 s8 a3
+or t6 s11 x0
+slti t6 x0 1400
+sub s7 s4 s11
+or s4 a2 s7
+mul s10 s7 a3
+mulhsu s6 a7 t3
+and s8 s7 a5
+sub a7 s10 s10
+remu t3 x0 a2
+mulhu a3 s8 a7
+div a3 x0 ra
+srai s11 gp 3
+mul tp t2 a7
+divu t0 a7 s0
+auipc s6 105120
+xori a2 x0 252
+or a4 s9 ra
+div a1 t6 t6
+mulh a0 tp s5
+mulhsu s10 s1 s4
+xor t6 a2 a5
+andi x0 ra 1432
+add s8 t6 gp
+sll a7 s1 tp
+sltu s8 ra a1
+lui a6 397787
+auipc t1 721840
+ori s0 gp -1821
+mulh t5 s10 t0
+mulhu a0 s2 t3
+srl t3 a7 a2
+slli s10 ra 2
+slti ra t5 2031
+srai t6 s3 15
+mulhsu t2 s7 s4
+sub a0 s4 s0
+slt s8 s7 a7
+xori a6 a2 -1372
+srli s2 s11 16
+mulh a4 s10 a0
+sra s1 t1 t3
+mulhsu gp s6 t5
+slt t1 s6 gp
+slli s6 t6 30
+lui s3 402059
+sra s8 a6 x0
 addi a0 x0 10
 ecall
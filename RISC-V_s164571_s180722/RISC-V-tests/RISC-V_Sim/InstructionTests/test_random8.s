@@ -30,105 +30,105 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-lui s10 402059
-ori t0 a2 -807
-lui tp 889888
-sltiu a2 gp -1912
-add gp a1 s9
-slti s11 s2 -1514
-srai s11 s5 22
-mulhsu ra t5 t0
-mulh t3 s1 s3
-auipc s11 898685
-mulh t5 t2 s6
-div t0 a2 t6
-or a7 t1 s6
-sra s7 s7 a2
-slli t4 s3 11
-remu s7 s4 t4
-rem a1 x0 s7
-slti a6 a2 -1402
-mulh ra a2 t6
-or s1 s0 a4
-xor x0 x0 t1
-andi gp t3 -279
-mulhsu t5 tp s2
-xor s8 a6 a1
-xori s5 t3 -1490
-slli a1 a0 15
-slli t4 s9 4
-srai tp s10 21
-xor s4 a5 s9
-sra s5 gp a0
-mulhu gp a1 s1
-srai a1 s8 5
-mulh s2 s7 s1
-and t5 s7 s9
-divu tp s6 s0
-xori a1 tp 639
-add t4 s8 gp
-mulhsu s1 s10 s8
-ori t0 a1 -1287
-sub s11 t0 s7
-and tp tp a4
-srl a6 a3 gp
-sltu x0 t4 s1
-xor a3 s9 s1
-sub gp s4 s6
-srli s0 a6 28
-addi s10 x0 419
-remu s10 s4 a1
-addi a5 t6 -102
-ori t1 t4 -470
-div tp s7 a1
-rem a3 x0 a6
-mul gp t5 s11
-or x0 s10 tp
-srli x0 a5 1
-sra a5 tp t3
-ori s4 t6 -1037
-divu a0 s3 a5
-xori ra s5 1822
-mulhu a7 a6 t6
-divu a5 a1 t1
-xor a3 tp a6
-sltiu a6 t2 1196
-divu a6 s9 a7
-lui a1 635302
-sll t1 s11 ra
-sltiu a3 t5 -1373
-mulh gp t0 t0
-slt ra ra s11
-slti s6 s1 -1467
-remu x0 a5 gp
-div t3 s1 tp
-rem s5 a1 t0
-andi s10 t5 -1411
-mulhu a6 s2 a4
-lui s3 284820
-div s11 s6 gp
-ori s2 s10 1118
-add a2 s10 s2
-ori s4 t6 -1689
-div t0 t3 a3
-xor t4 a6 s11
-sltu ra a4 a7
-mulhu a7 ra t6
-and a2 a6 a2
-add gp x0 s8
-sltiu s2 s4 1390
-addi a5 a4 -1006
-mulhsu s11 s0 a4
-sub s1 s5 t1
-rem x0 a1 s6
-divu t4 t5 x0
-auipc s3 428329
-add t4 t6 gp
-divu t0 tp s5
-mulh s11 a4 s6
-sltiu s7 a0 -449
-sltiu a1 s10 -303
-sra t4 t1 x0
-srli s4 t2 21
+sltiu a2 t4 -1403
+xor s11 t3 gp
+add gp s11 t2
+sra gp s0 x0
+addi s0 a6 -860
+srli gp a1 17
+divu t2 t3 t2
+sra t5 s5 t5
+andi x0 tp 650
+andi t5 t0 1984
+srai t5 a3 21
+slti a3 x0 169
+sra a6 s3 t1
+ori a3 s7 -429
+srl s2 t2 t3
+slt s4 gp s2
+srai s3 a5 6
+sra a4 t2 s5
+srl t5 a4 t1
+mulh t5 t3 s7
+sll s3 s7 x0
+sra gp a3 tp
+srli s5 s11 30
+divu s4 s11 s9
+sra t0 s5 ra
+divu a3 s8 s6
+auipc a3 40629
+div s6 ra s6
+and t6 a1 s1
+divu t2 gp a0
+addi t0 t2 -264
+sltiu t6 s10 234
+add a0 s10 s6
+sltiu tp s1 -1655
+and gp s10 s10
+srl t4 s6 t6
+slli s3 t4 25
+add s6 s5 s11
+lui a0 643130
+xor x0 t6 s9
+slti t6 s4 -1117
+addi a5 tp 1688
+addi s3 s6 -1141
+slti tp s6 -1670
+and a5 tp s2
+mulh s6 x0 s10
+or s5 a1 s3
+sra gp s6 ra
+xori s10 s5 -1800
+remu t6 a0 gp
+or x0 s11 t1
+slli s4 a3 13
+mul a7 s1 a5
+auipc t1 1032842
+and x0 a5 a4
+div a5 s2 t5
+sub t3 s4 t3
+sra t2 s4 gp
+rem a0 t4 a4
+div x0 t4 t2
+srli t0 t1 5
+divu t3 a4 x0
+sltu a0 t5 s0
+sltiu x0 t2 -509
+sll ra s6 a4
+and t5 ra x0
+sltiu a0 a0 1678
+mulhsu s8 a7 s4
+xori s9 s4 -252
+add s5 gp x0
+sll s4 s4 t5
+srl a1 s7 s11
+remu t6 t3 t5
+auipc s2 69720
+sub s10 t5 s1
+sll s2 a4 s3
+slt a2 t5 a4
+srai a2 t3 18
+divu a0 s6 s2
+divu x0 t0 gp
+divu t6 t5 t2
+sltu t1 a3 t2
+andi s10 s9 -1603
+srl x0 s5 tp
+or s8 t5 s5
+sltu t5 s3 tp
+divu a7 s2 a4
+sll x0 s5 t1
+mulhu a7 t1 x0
+ori s3 t6 481
+or s3 t2 gp
+addi a7 x0 -387
+sub a2 a5 s8
+div a5 s3 t0
+sltiu tp a1 1815
+mulhu t5 s9 a4
+addi s4 s2 -1656
+ori t1 t5 962
+lui s8 353062
+mulhsu tp a6 s7
 addi a0 x0 10
 ecall
@@ -30,10005 +30,10005 @@ addi t3 x0 28
 addi t4 x0 29
 addi t5 x0 30
 addi t6 x0 31
-mulh t5 t2 tp
-sub t6 s8 t2
-sra s7 tp s7
-slti s5 t0 -724
-sltiu a3 a3 -1034
-addi s8 t5 -658
-divu t2 x0 s0
-sltiu ra x0 1504
-lui a0 790410
-divu s1 a0 s4
-xor t3 a5 s3
-andi s7 x0 -1537
-mulh a6 s0 t2
-xori t6 ra -1581
-slli s1 a2 20
-mulhsu ra t5 a2
-addi s6 a0 1465
-sub s1 t2 s7
-sltu a6 a1 s5
-srl t3 t1 x0
-xor a0 t2 s9
-slt s0 s5 s8
-sltu s11 t3 ra
-div t5 a3 t3
-slt a3 s2 s10
-mul s6 s8 s7
-srai tp a4 11
-slli t4 a7 21
-slli a7 x0 2
-srai s8 s2 18
-sltiu t4 s11 134
-ori s2 s6 -1158
-slt t4 a1 a5
-sll s2 a1 s5
-mulh s5 a1 s11
-srl s1 s2 a2
-auipc t3 920316
-slti a0 a0 -54
-sll a2 gp t1
-add x0 s8 s10
-sub x0 s11 t4
-lui s1 640330
-sra s9 s1 s0
-or t2 t2 t5
-or s10 s11 ra
-auipc a7 318445
-srl s9 s11 s11
-xori x0 a7 -1588
-div s7 a0 s1
-srl a7 a5 tp
-sub s5 t6 t1
-sra t0 s9 s1
-lui t0 116190
-mulhu s4 s2 t3
-sltiu t0 a7 1173
-add a4 tp tp
-sra tp a1 gp
-xor a7 t6 x0
-mulhu a7 s11 s8
-srai s11 x0 23
-add t0 x0 t2
-add s10 t1 s8
-srl s7 a2 s11
-and s3 t2 a3
-sub s4 a3 t4
-srli a0 s6 27
-mulhsu tp s10 x0
-addi x0 s4 1620
-sll a5 a4 a4
-srli s10 gp 31
-andi t0 t1 338
-mulhu s4 a4 t4
-lui s8 727037
-xor s6 s10 gp
-slli t5 s4 25
-divu a3 s0 ra
-srli a5 a1 31
-rem s4 s3 t6
-ori s11 a0 -642
-xor t4 a6 a3
-add s6 x0 s1
-srl s6 s2 s1
-sub a6 t6 a3
-srl ra x0 t5
-lui s5 207290
-auipc s10 290671
-or s8 a5 x0
-mulhu t2 t2 x0
-xori a4 t4 497
-slli s9 a0 28
-lui a1 362597
-and a2 x0 s1
-sub s7 s11 a4
-srli a0 s10 18
-srli x0 s5 12
-lui s5 910473
-srl gp s8 s9
-slt t6 t6 a2
-slti tp ra -217
-mulhu s8 x0 s8
-and s3 a6 s8
-srai s11 tp 4
-divu a2 t1 s6
-sltiu gp a5 -614
-and t0 s0 a3
-rem a4 a0 s2
-mulhsu a1 t5 s3
-remu s9 x0 s2
-slti a4 a4 -636
-addi a6 ra -1165
-lui x0 661045
-xori tp a4 711
-ori x0 tp -903
-sltu s10 a0 gp
-mulhu t2 s3 s4
-srli s0 s8 15
-srl x0 s5 t3
-add t3 s11 s8
-srai s7 t3 7
-addi s9 a7 -1174
-add s5 tp t5
-sra gp t4 s2
-mulhu s0 x0 a0
-addi s9 s10 -1957
-xor s0 t2 t3
-auipc x0 93065
-mul s11 s5 a7
-mulhsu s6 s6 ra
-add s8 s6 a2
-sltiu s7 a2 1927
-sub t1 s5 x0
-mulhsu a2 s7 a0
-sll s4 a4 ra
-slli x0 s4 0
-sltiu s5 t0 -1668
-andi s1 t5 -1177
-mulhsu s9 t0 s9
-or t5 a3 s4
-slli s4 a6 13
-sub t0 x0 a3
-auipc a6 264959
-add gp a7 t3
-auipc s7 733085
-andi s5 a2 -1975
-auipc a5 753758
-slti s9 s10 -1685
-sltiu t4 s10 -1628
-slli s4 t5 2
-mulh a5 t5 t5
-addi s6 a7 197
-addi t6 t3 -1793
-lui s5 102893
-or t6 s4 a5
-auipc a2 32889
-andi s3 t5 222
-ori tp s7 344
-slli gp s6 29
-or a6 tp s1
-slti t3 gp 509
-srai s3 t6 22
-mulhu s6 t2 s3
-sltu t1 s1 s9
-sltiu t3 ra -1979
-slli s4 t1 25
-ori gp s9 -306
-mulhsu a1 t5 s5
-remu s11 s10 s11
-add s4 ra t4
-xor s4 t4 ra
-sub x0 a3 x0
-xor a3 t1 s3
-sltiu s8 s0 -151
-addi s7 s10 -470
-sltu a6 a4 s0
-sltiu tp t6 942
-divu ra x0 gp
-xor s10 s6 a7
-addi s10 s11 -405
-ori gp s10 1922
-xori s1 s10 -1491
-divu a5 x0 s7
-rem t3 a4 s8
-sltiu a5 t0 137
-rem t0 s1 t4
-slli s10 s2 7
-mulhu s5 s2 a2
-srai s9 s8 8
-or s5 a4 s10
-srl a3 x0 x0
-and t0 x0 s10
-div a1 t2 a7
-div a2 s11 s2
-lui a0 540922
-sra s1 t0 s8
-srl t1 s6 s10
-add s10 s5 x0
-mul s5 s6 s5
-mulhu s8 s8 s5
-slti t0 tp -1641
-ori s7 s10 -1891
-mul s1 s9 t1
-remu t0 a4 s1
-slli s4 a3 4
-add s7 ra a7
-sra a6 ra a1
-srai s5 a1 1
-or t0 tp t2
-mulhsu t2 t2 s1
-divu a1 a1 a6
-auipc a0 41627
-mulhu a5 s2 t5
-xori s2 t4 -1178
-or s0 x0 s1
-auipc a4 368990
-slli s11 t3 7
-mulh a7 a7 a7
-sltu t1 t3 tp
-sltu a4 s3 t2
-addi a2 s5 -1291
-slli gp a5 2
-slli t0 t6 10
-ori a6 a2 1748
-remu tp a0 s7
-sra a6 gp t3
-auipc t4 126421
-slt a0 s4 a1
-div a3 t5 a5
-xori gp t2 703
-andi s4 x0 -293
-div tp t5 t3
-ori s3 s11 101
-div a4 s3 s5
-mulhu a2 a4 s8
-addi tp s9 -948
-lui a3 317912
-remu a0 s8 s4
-slli a5 a6 10
-srl s9 s2 a5
-slli s6 s7 30
-sll s2 t1 t1
-mulh t0 t0 s4
-slt t1 s0 a4
-remu ra t6 a4
-srl gp a6 a4
-sub a4 x0 x0
-and t1 s3 a4
-mul x0 s2 t4
-mulh s4 a1 s0
-auipc t4 653833
-srli x0 t3 24
-ori a1 s0 -92
-add a6 a2 s6
-srai a1 a2 0
-slti x0 t3 -716
-sll s9 tp t1
-mulhsu s2 s4 a6
-or tp t5 s1
-addi a2 ra 1966
-mul t6 s1 a6
-sra t2 a3 s0
-srl tp s5 a2
-srli gp s0 19
-sll s3 s11 s1
-ori s11 s3 673
-add a1 t2 t6
-mul s11 a1 s11
-xor t2 s0 t3
-srai ra a7 0
-sll a0 s2 t3
-addi tp s6 -232
-and a1 s1 a2
-remu t6 s8 x0
-srai ra t1 31
-xori s3 a2 -1124
-divu gp t3 s3
-auipc t5 685622
-xor t5 s8 t0
-mulh s1 a6 t4
-or t3 x0 s5
-xor a1 t4 s2
-xori a5 gp -970
-ori s8 s3 -1579
-and s9 t5 t2
-add s4 a1 t4
-divu t5 t2 s5
-rem t5 s5 t5
-addi tp a1 9
-mulhsu t6 s1 s0
-sltu s1 s8 ra
-slli a0 gp 29
-addi s11 a0 1236
-div s10 t4 s3
-sub a1 a4 s8
-div t2 x0 s4
-remu a7 t5 t3
-auipc t1 137251
-andi s3 s5 47
-slt tp a7 s7
-srai a3 t6 17
-and t6 s2 ra
-mulh a0 a0 a4
-xori t3 s11 -1480
-sltiu a5 tp -1961
-sltiu s4 s2 854
-sra a3 x0 t3
-lui s11 677405
-srli s11 a0 1
-div tp t6 t1
-xor t4 t0 a4
-xor t0 a4 a6
-remu t4 t6 s10
-srl a0 s4 s8
-mul a2 s10 s6
-andi s1 s9 -1726
-xori t5 ra 47
-sltu s6 t2 t4
-srli s9 s1 22
-or s3 t2 x0
-sub a6 t5 a3
-divu s7 s2 s3
-mulh x0 a6 t5
-add t3 s10 a7
-mulhu s8 a3 s8
-srli s5 a5 26
-sltiu a2 a2 -2036
-srai x0 s8 23
-slt a2 t2 a5
-srai t6 a6 14
-slt a7 t6 s9
-sub t0 s1 s7
-slt s2 gp s6
-rem s3 t6 ra
-sub s9 a7 s0
-or gp s4 s6
-and s6 ra a2
-mulhsu s7 s3 t5
-div t1 s5 t4
-xori t3 a3 -546
-sub x0 s4 t2
-remu tp s7 s9
-srl a4 s3 t0
-sll t3 a3 s3
-andi a6 s11 413
-or a5 s2 s5
-andi a4 s0 -793
-slli t4 s1 24
-add s3 a6 s8
-ori t2 a2 1101
-xor t5 a1 s8
-or t5 s10 t3
-srai x0 s11 15
-srl ra a7 s0
-sll s6 s11 a2
-sub s8 s6 x0
-ori s3 t6 -1835
-mulhu ra s9 gp
-mulhu t3 a0 x0
-sltu a7 a1 tp
-sltiu s10 x0 1413
-xor s3 s6 gp
-xori s8 a4 -1622
-auipc t6 923005
-srli t0 a6 19
-sltiu a4 t0 -826
-and t0 s11 s3
-divu s6 tp a7
-andi tp gp -845
-mulhu t2 s1 a5
-sltiu a1 t0 -1069
-divu s1 t5 t5
-divu s4 gp s10
-slti tp s6 -1373
-slt a1 s10 s0
-sub ra gp a0
-lui gp 473298
-auipc x0 174340
-or t3 t6 x0
-or s6 t4 s6
-or s7 t2 a1
-xori a4 a4 -537
-div a1 t3 s7
-sra s8 t0 t4
-ori s4 x0 -1652
-sra t3 a4 s11
-sltu s1 s1 s3
-sltiu t0 a2 -975
-slti s8 a1 269
-auipc a6 101568
-xor a7 s5 s4
-auipc a0 538183
-auipc ra 714888
-sltiu s10 s0 1170
-slli t5 s6 0
-add t4 a6 t1
-andi a2 s1 674
-remu a6 a5 a1
-xori s6 s4 -924
-ori s0 s10 -944
-mulhu s4 s1 t3
-sltiu s9 s9 -688
-slti s6 t1 -37
-mul a7 t2 s6
-sra a5 s11 a0
-mulhsu s7 a2 s5
-xor x0 s6 x0
-divu s0 s6 t5
-ori a0 t0 -408
-slt s11 a5 x0
-sub s6 t5 s11
-xor t0 s8 s11
-srl a6 a2 a7
-div a6 s5 s11
-rem s7 a2 a0
-sll ra a7 t2
-div s3 s8 s11
-sltu s9 s2 t3
-srli a3 ra 17
-slt s7 t5 s11
-mulh s8 x0 t0
-ori x0 s6 -370
-sltu s11 s11 s10
-sltu s7 a0 a2
-add a0 x0 a3
-sub s4 s5 s6
-xor t6 t0 s3
-mulh s5 t1 s5
-sltiu s1 s1 -1396
-auipc s2 971578
-sltiu ra s4 -717
-rem s7 a1 s6
-rem s4 a6 t3
-slti gp a6 1914
-add a5 t5 s6
-remu a0 t1 s4
-divu s7 s9 t0
-remu a5 a3 s4
-slt t6 t3 a6
-and a3 a5 x0
-div s2 a7 s0
-sra s5 t5 s8
-div a3 s1 a5
-divu s7 a3 t6
-and a1 a3 s8
-mulhsu t5 ra a7
-slli t4 ra 8
-slli a5 s1 4
-xor s3 a5 a2
-and s5 t2 t0
-srli gp a2 28
-div s9 s0 s2
-slli s6 a6 30
-add t4 s6 t0
-sll s6 a0 a5
-srl x0 a5 s10
-or a3 s10 a2
-mul s4 t1 s9
-rem a1 a0 s3
-slli s2 s10 25
-slli s11 s11 29
-mulhsu t6 s0 s10
-addi s8 t0 -1964
-add a3 t6 t1
-or t0 t2 t2
-slt t5 t1 s0
-ori t1 s11 -643
-mulh a0 ra t3
-mulhsu t3 ra a5
-mulhsu s9 s5 t6
-divu a5 t2 t1
-lui s10 33
-ori gp x0 -1283
-remu s9 a3 a0
-addi t4 s4 -33
-mul s3 tp t2
-ori s8 a3 -1698
-mulhsu s6 s10 s0
-xor a5 tp a6
-rem x0 a2 t0
-auipc tp 217315
-sub a4 s6 a6
-mul t2 t3 ra
-and s9 t1 s5
-or s4 gp t2
-lui s3 973763
-ori s0 ra 2040
-and gp ra s1
-srli t5 a3 17
-div s8 s10 a0
-auipc t4 205190
-srl a0 a2 ra
-sltu tp ra t2
-mulh a7 t2 s3
-divu t0 s5 ra
-ori t3 a7 368
-srai s3 s3 24
-mulh a5 t2 a2
-srli t6 s2 21
-slt s5 a5 a6
-and t3 t4 ra
-sub t0 a7 a7
-add s2 a3 a4
-sra tp a4 tp
-sub a5 a7 s10
-slt s9 s3 s9
-srli s10 s3 1
-sra a0 t5 t6
-slti tp t1 1701
-rem s9 x0 s4
-srai s11 s5 9
-mulhu a6 s9 t3
-or s9 a4 x0
-mul s7 s3 a2
-div t6 a4 s9
-auipc t3 469571
-ori t0 x0 244
-srli t6 t4 3
-rem t6 x0 t1
-srli s1 t5 9
-lui a3 9105
-xori t1 t2 1078
-sub s1 t0 s11
-sltu a2 a4 t0
-mulhu a7 s8 a5
-xori a4 s1 960
-mulh a4 s11 t4
-and t6 a5 s7
-sltiu s7 s1 -1661
-addi gp t2 -1739
-srai t2 s5 18
-rem a7 t2 t1
-xori s4 s2 1521
-ori s5 t3 -948
-srl s10 a1 s8
-srl t5 t2 s11
-sra tp a4 x0
-divu s1 t3 a2
-mulh s0 s4 t1
-xor a2 x0 ra
-xori s8 a3 642
-mulhu a2 a3 a5
-srl s6 s1 s11
-lui s0 650992
-sll a4 t4 s9
-srl t1 s1 s2
-sltiu a2 s2 1578
-sltu gp a2 t1
-andi t6 t4 -1391
-and s3 t5 s2
-sll s2 t2 a2
-lui a6 51308
-slli t1 s8 14
-sub t6 a6 a7
-div s11 a4 a6
-mulh t4 t0 t5
-mulhsu gp t1 s9
-remu s3 s5 a4
-slt a5 t3 tp
-mulh s11 s11 a6
-add s5 s8 s8
-andi a3 s3 -399
-ori x0 s8 -645
-div t3 t1 a4
-xori a3 a1 -525
-sltiu a4 t5 -588
-mulh t4 a7 a0
-lui s9 209309
-slt s10 s9 t2
-add s4 t0 t1
-or t6 s3 s6
-remu t5 t6 t2
-srli tp t5 21
-srl a1 t1 a5
-slti t4 a3 -494
-rem t4 t4 tp
-slt tp s11 a1
-mulh s11 s5 tp
-lui s6 604627
-srai gp s0 30
-and a0 t6 s4
-slt ra a4 gp
-srl t0 s1 t6
-rem s10 s4 ra
-auipc s11 306672
-div s7 s4 s11
-rem a0 a5 s0
-srai a1 s10 4
-rem s5 s1 s8
-andi t0 a6 -1511
-srl s1 s7 t5
-ori s9 t1 -319
-sltiu x0 s6 -903
-div s10 s1 s10
-lui a1 210870
-sra s11 s2 ra
-add a6 t0 a5
-or s2 t1 t4
-andi a3 t3 156
-addi t1 t4 -394
-remu t3 a5 t1
-remu s6 a1 s9
-lui t4 101606
-rem a0 a7 a6
-mulh t2 t1 s7
-mulhsu t2 t6 gp
-andi s4 s3 -1526
-addi s1 ra -1050
-sub t3 s5 s5
-slti t6 a0 1235
-andi s3 t2 -839
-srli t5 t2 3
-sub a3 s11 tp
-srli ra t2 0
-xor s11 ra a1
-mulhsu s3 t2 a1
-mulhu s8 s8 s9
-div t5 s6 a4
-div s2 s3 t5
-div s6 s8 s1
-sltu gp a7 gp
-andi s5 t4 -1264
-rem t4 s7 x0
-xor ra t2 s10
-slt s5 a6 s8
-div s9 t0 s3
-ori s7 t5 -401
-srl s7 a6 s5
-sra s8 t6 s8
-sltu s2 t5 s6
-div s6 a2 a2
-rem t5 s4 s0
-mulhsu t6 a2 s3
-div t1 t2 s9
-sltiu s3 t0 1797
-ori a5 a2 592
-mulh s3 s2 t4
-slli s5 a1 23
-slti a5 t4 -612
-sltiu t0 t3 1380
-xori s0 s4 1584
-sltu t6 a6 a0
-mul s4 s2 s6
-sll a6 a4 tp
-srl a6 t0 t5
-srli x0 t3 16
-srai s3 gp 13
-auipc a2 474264
-srai s9 s5 31
-xori a4 t3 -510
-remu t0 a7 tp
-xori a7 t2 -362
-addi x0 s9 -1189
-sub a0 x0 s9
-remu s4 a2 s5
-sra t6 ra a4
-srai t6 x0 15
-xori s0 ra -906
-sltu s2 t4 a3
-lui s7 749388
-andi t4 t6 1952
-div a4 t4 s10
-slt a5 s11 t6
-xori gp ra -87
-or s7 s1 a7
-srl t0 a4 s11
-srl t4 s0 s5
-rem s2 s9 x0
-lui t5 272053
-mulhu t3 a6 s4
-add gp t3 s6
-sll s3 s5 a3
-and s8 s0 t6
-mul s6 s4 tp
-sub s5 a0 s2
-slt s5 t0 s7
-sub s2 s10 a1
-srai a2 tp 9
-mulhsu ra a4 s6
-mulhsu a2 s2 s6
-remu s5 a6 s7
-slli s7 s0 14
-srl a0 t5 s5
-auipc a2 38443
-sltu s9 t6 a7
-add s4 s3 s4
-sra t4 tp t4
-andi ra gp -1808
-srai t2 s4 0
-addi a3 s5 -1806
-divu s8 s5 s2
-srli s8 s9 11
-rem s11 s8 s11
-srai s8 t5 15
-srl x0 s8 a7
-andi s7 s2 1973
-ori s9 s7 -1688
-sra ra a4 x0
-add t5 s0 s6
-slt s2 s6 s11
-remu s4 s8 s4
-rem a3 a0 t5
-divu t1 a4 s3
-slt a4 s0 gp
-remu s3 a2 gp
-andi t4 a4 1857
-mulh t4 t5 gp
-slti a4 s9 -1745
-rem s6 s11 a7
-add s8 a7 s6
-srli a0 s1 13
-auipc a3 93176
-lui s6 265600
-or t4 s5 s4
-mulhsu s8 t3 s5
-and t0 a6 s4
-mulhsu a1 a0 a2
-andi s1 gp -1584
-ori a1 a7 -1252
-sra a3 s7 gp
-remu t6 s10 s5
-mulh t6 t4 s11
-divu s4 s7 a5
-sub t0 a1 s6
-slti s1 t3 758
-ori t5 t0 -1789
-sll s9 s6 s10
-auipc a0 472661
-slti x0 x0 -508
-remu s6 gp x0
-auipc ra 282079
-divu a5 t2 s8
-andi t0 a4 -1566
-addi a6 t5 -1693
-sltu tp a3 t6
-ori a4 s4 -1663
-mulh s8 a2 s9
-auipc s0 396107
-ori s0 ra -1768
-srai a2 s1 27
-mulh t4 s4 a3
-ori s9 a6 -562
-auipc s7 77120
-mul t6 s6 s3
-add a2 ra s6
-sll a1 a7 t0
-slli s2 s1 3
-sltiu a4 x0 -813
-and s0 s2 gp
-sltiu s3 a2 1044
-mulhu t4 s1 a0
-ori s1 t4 -1424
-or s4 t2 t4
-mulhu a3 a7 a0
-xori s1 s10 -362
-mul s3 ra s11
-and a6 s10 a7
-auipc t3 532904
-sltu a1 t0 s10
-mul s11 s11 a3
-sub ra a3 tp
-addi s3 s4 -1721
-xor t5 x0 t0
-auipc a0 540461
-sltiu s7 x0 1848
-auipc s7 107107
-slli s0 s5 24
-ori tp x0 1364
-rem s4 s6 a2
-mul t1 x0 s1
-xor x0 a5 s9
-sll t1 tp t4
-sra a0 x0 t4
-sltu t5 s10 t2
-sub s0 gp t6
-div s1 a0 x0
-add s9 a0 s10
-slti x0 s0 -77
-xori x0 tp -1331
-ori a3 s3 1062
-remu s5 a2 x0
-addi x0 s5 -936
-srai s6 s2 29
-srl t1 s0 a7
-slli ra s0 13
-divu t3 a6 t0
-xor a0 a5 s4
-rem s11 tp t2
-or t2 x0 s9
-or s6 t0 s0
-addi s8 s7 -233
-sll x0 x0 s3
-sll t2 t2 a6
-slti s11 t4 739
-mul t3 x0 t4
-rem s8 s0 s6
-remu s9 tp t4
-sra t1 s9 s3
-sltu a4 s7 a5
-sltiu t4 a1 1269
-xor a1 s3 a5
-srli x0 s2 10
-mulh tp t5 t4
-auipc s8 120413
-srli a3 s9 22
-srli s6 t1 12
-div s4 a3 t3
-mulhu t5 s1 s10
-or x0 x0 x0
-div t5 a7 x0
-sra s11 t0 s7
-srl t5 a1 a7
-sll t5 s0 gp
-and t4 s9 a5
-and a4 s6 s2
-sra ra t5 a5
-or a4 s10 s11
-srai t5 t2 27
-slt x0 s2 tp
-srli ra s2 22
-xori s7 a4 -1421
-remu s11 s4 a7
-slli s4 t1 3
-andi x0 a6 -798
-andi t5 s10 -332
-divu s6 s9 a3
-slli a0 t6 27
-srl s6 s4 s6
-slt s8 s8 t2
-mul a5 t3 a6
-slli s0 s11 1
-addi t2 s0 -1189
-srli a3 s1 20
-xori a7 s8 -833
-slti s10 a1 -1950
-remu t0 s10 s9
-slti s3 s9 -127
-slt a1 s5 s7
-slt s7 s7 a3
-div s8 s9 s2
-slli a5 s2 26
-mulhsu s7 s7 x0
-and t2 t0 x0
-rem a4 a1 t5
-auipc a4 584716
-slt s9 s3 a1
-divu a0 t2 s2
-srl s11 ra a1
-sll s11 s10 t5
-divu t3 s9 t5
-srli x0 s1 7
-divu x0 s5 s8
-srl s2 a4 x0
-ori x0 t5 491
-slt x0 a1 s5
-rem a2 s4 a1
-remu ra s7 t3
-slti a1 a1 -441
-slt s0 t5 tp
-sltiu a1 a5 1918
-remu s6 tp s5
-slt s5 tp a4
-xori s4 t4 1088
-sra gp a0 t4
-mulhsu a1 x0 a1
-andi t1 x0 -246
-add s11 t1 t1
-sltiu t6 a2 -1235
-add s6 t2 x0
-mulhsu s3 s7 ra
-ori t3 t0 -1249
-sra a6 x0 s3
-mulhsu a7 s6 x0
-auipc s9 816269
-sltiu t5 s0 -911
-addi ra s10 1053
-srl t0 a1 ra
-divu s8 x0 s10
-mul s5 t3 t6
-sub s1 t4 t6
-mul t2 ra t6
-sll s8 s2 s7
-sra a5 x0 ra
-sll s8 gp t6
-slli tp a6 9
-sll s0 t0 s9
-srli ra x0 0
-lui a7 279706
-remu t6 a7 s3
-sra gp a6 a6
-add x0 t0 s11
-xori t5 ra 774
-addi s6 tp -1639
-mul a6 a1 t2
-srl t5 t5 ra
-sltiu tp x0 1743
-sub t4 a2 t3
-sra s2 x0 a5
-div a3 t1 ra
-ori s8 a6 36
-and s9 s6 t2
-sub a1 s6 gp
-divu a4 s2 a4
-rem t4 s9 x0
-slt a6 s6 a1
-sltu s3 a3 a4
-slt ra a3 t3
-divu a7 s3 ra
-remu ra s2 a7
-xor a0 t0 a2
-mulh t5 s10 gp
-mulh ra a4 tp
-xor s0 s7 a4
-srli a0 t4 21
-remu x0 s9 s4
-auipc s2 152693
-lui t1 1022861
-add a1 t4 a3
-andi ra s3 1569
-srai t3 s1 27
-mulhsu s3 tp s10
-srli s0 x0 15
-sltiu s1 tp 661
-mulhsu s10 t5 s6
-srli t5 t0 18
-sra t3 s4 t2
-addi s1 a2 -236
-lui s5 123587
-slli t0 t5 25
-and t2 a4 a2
-sltiu a1 gp -715
-srli s9 a0 24
-mulhu x0 t0 s0
-ori s3 s2 1848
-remu s8 a3 s0
-xori ra ra -793
-srli a3 s10 17
-mul a0 t1 a3
-andi a0 s8 595
-slti s1 s10 -1
-xor a6 a1 s7
-lui s11 510440
-div t1 s8 s8
-sll a3 a7 t0
-sll a3 s7 s2
-andi a6 t6 -230
-xori s1 a5 -1460
-srl s9 s11 s6
-mulhu ra a5 a6
-sll t1 gp s8
-slli a3 x0 1
-mulh t4 x0 s0
-mul t4 s1 s1
-sltu s8 t6 s2
-sltu s10 a6 s1
-mulh t2 ra s6
-mulhsu s0 t5 a7
-srai s5 s10 6
-addi t3 s9 -278
-slti s8 a3 57
-rem a4 t0 ra
-xor a2 ra s5
-ori s1 t0 -1875
-slli a0 a3 13
-or t0 s2 a6
-slti t4 t6 -669
-and s7 a2 s3
-slt t3 t2 a4
-or x0 a2 s6
-add t1 a1 x0
-mulhsu s3 tp a5
-srai a1 a2 1
-mulh t6 s8 a6
-sltu s5 s3 a3
-sltiu s8 s2 -965
-and s4 s3 t5
-mulhu x0 t2 a3
-sll s7 s5 a2
-remu s0 s1 ra
-srli a3 a2 6
-srl t3 a7 gp
-sub t1 a4 x0
-sra s4 s7 t2
-mulhsu s7 s3 gp
-remu s11 t5 s10
-add tp s4 t0
-sra a7 a0 s10
-mulhu s11 a2 s5
-auipc a4 889038
-div s3 a6 s10
-srli a3 a1 2
-sll t0 t1 t2
-addi s7 x0 -1417
-addi s8 a3 -2018
-srai s8 a0 17
-srl s5 s9 a7
-slt tp s3 s4
-remu t3 s7 s7
-slt a6 a3 t0
-divu a1 s4 tp
-mulhu a4 s2 s9
-andi t5 s7 -1514
-remu s5 x0 x0
-slt a4 t4 t1
-lui s5 894111
-mulhu gp s5 a2
-mulh a4 a0 x0
-mul t5 s6 s10
-add t1 t5 t0
-addi ra s9 -586
-sltiu tp t3 1436
-addi a4 x0 1196
-ori s6 s4 -354
-addi s5 a0 -495
-xor s3 s10 t6
-srai tp a0 7
-ori s8 tp 869
-or a6 t4 x0
-mulhsu s8 a0 x0
-and s10 s2 a2
-ori s1 a2 -125
-mulhsu a1 t4 ra
-sra s11 t1 t6
-slti s5 x0 934
-add a0 t6 a4
-mul t6 tp s1
-divu s4 t6 t2
-mulh a6 s0 a2
-sltu s8 t1 s3
-srai s1 s3 11
-slt s10 a5 a5
-remu t5 s5 a2
-or s1 a4 s10
-sltu t0 t5 a3
-or ra a2 ra
-andi s10 s3 -1175
-srai a5 x0 26
-auipc a2 370113
-slt s11 x0 a5
-sltu ra a4 a0
-add t1 a3 a0
-remu a0 t1 s9
-srli a1 t0 15
-lui x0 170256
-mulhsu t0 s1 t0
-add s9 a7 s8
-add ra gp t1
-addi tp s10 -565
-sltu s7 s6 a5
-addi s6 t0 -1300
-sra x0 a2 s3
-mulh t1 s8 t5
-srli t3 a5 16
-addi s6 a2 -1985
-or s1 s0 a0
-rem tp s0 s10
-sltu a0 s0 s6
-sra t4 a0 t0
-srli x0 s4 14
-divu s8 tp x0
-srai s4 s8 8
-srl a0 a3 t6
-and s10 t5 x0
-srl s3 t4 x0
-xor t1 s9 tp
-mulh s9 t4 x0
-ori t4 t1 -338
-div s2 a3 a2
-srai a1 t4 0
-div t5 a0 t4
-auipc a3 535037
-mulhu a4 x0 t4
-srai t4 t6 30
-sltiu s8 t1 -1825
-sll t5 a2 s3
-sll s6 s0 a2
-mul a2 s7 tp
-addi gp a4 -1226
-mulhsu s3 s4 t4
-srai x0 t6 4
-sll a4 a5 s8
-srai x0 tp 4
-andi a1 s11 480
-remu s9 t0 s7
-srl a6 s11 s11
-xori t2 s3 -1449
-ori a1 s11 -326
-sltu t5 gp a6
-mulhu a2 s7 a0
-remu a7 s7 a2
-sra s1 gp s10
-lui s11 330390
-srai s0 s9 9
-divu a6 a5 t0
-divu s2 a4 t2
-divu s8 t4 t1
-or a4 s8 x0
-xori s8 t6 -1581
-divu t2 s0 t4
-srl a7 t6 t2
-sll a5 s9 a0
-srl a2 a6 a1
-srli x0 s10 11
-slli a2 a5 8
-xori a1 ra -1212
-mulhu ra s5 x0
-or x0 gp t6
-mulhsu s7 a7 t3
-slt t6 t1 t0
-xor s9 s5 a1
-sltiu s0 a7 -980
-srli ra t3 24
-mulhu t3 s2 s2
-divu s2 a2 s4
-srai s1 a0 26
-mulhu t1 s9 s7
-auipc a3 594724
-rem t2 a4 t5
-slti gp s2 -1424
-sra t3 a4 s5
-mulh x0 tp t4
-andi s10 s2 18
-srli t4 a6 24
-sra s6 a1 t5
-add a7 s4 s9
-mulhu a7 t3 gp
-sll s6 a2 t2
-mulhu s1 a7 s3
-srl a3 a1 a5
-mulhu s4 t2 s5
-sra x0 s4 t2
-auipc t3 299841
-remu s0 t5 t6
-sub t0 a5 t2
-and t6 ra a4
-sll a0 s3 ra
-sltiu s6 s0 -1753
-xori gp gp -329
-sltu t5 x0 a1
-mul a4 ra tp
-srl a2 s3 t0
-and a2 s10 t5
-srli a3 s2 28
-srli a7 a1 2
-sra t5 t6 t5
-srai s6 s9 18
-lui s2 798357
-add a4 a0 a2
-srl a6 s1 s9
-mulhu s4 s0 s0
-auipc t5 805505
-mul s6 s3 s11
-sra t3 a2 a3
-slti tp s8 -78
-srli a6 s5 15
-xor t1 s2 a7
-sltu s6 s1 s6
-xor s3 a2 a4
-sll a6 a2 s9
-lui ra 774529
-mulh gp a5 t4
-div ra t4 ra
-slt t3 a4 s4
-add t6 s11 s10
-slti s10 tp -1950
-mul t2 x0 a4
-mul a7 t6 t5
-xor a1 t2 t4
-sub a4 s7 s11
-srl t4 s6 a7
-mulhu s0 a6 s11
-mul t0 x0 x0
-mul t0 s10 a6
-sll s9 t4 a5
-div t5 a1 s8
-addi t4 a0 1997
-sltu gp s3 s0
-xor gp s4 x0
-ori s7 a2 -1056
-srli a3 ra 16
-add tp s11 s0
-slt s2 a5 s0
-sub s2 x0 ra
-mul t1 s2 s5
-sll s10 tp s6
-ori s11 t1 -499
-ori a6 x0 -1321
-sll t4 tp t4
-divu s3 t4 a5
-and x0 a0 t6
-divu tp s3 t6
-xori gp t6 1044
-srl s2 s8 s9
-rem x0 a1 t3
-or ra t2 t1
-andi s10 a5 1387
-mulh a4 a1 t6
-sltiu s6 s11 -399
-remu s11 a5 ra
-andi s10 s11 17
-rem a4 t2 s8
-rem a5 t0 s10
-slti s7 s2 -2027
-srl tp a0 a0
-and s7 a5 a7
-div s9 s0 s4
-mul a3 s1 s4
-sltu s0 s0 x0
-slli s9 s10 31
-or gp t4 s3
-mulh t0 t5 a1
-addi a3 t5 -342
-div s7 gp s10
-srli s4 t5 13
-mulhu s4 s4 s9
-sll tp t1 tp
-or t5 gp s8
-slli a6 s11 8
-and s8 t3 x0
-divu t5 a5 t0
-slli a4 s6 15
-andi s1 a0 -610
-mulhu t0 tp t3
-srl s9 x0 x0
-auipc a1 476040
-slti s3 s8 -300
-andi s2 s3 -890
-ori a1 a2 1182
-slli s3 t0 26
-slti s8 s11 616
-slti x0 s6 1581
-remu ra a7 tp
-slt t0 s0 s5
-remu a1 x0 x0
-srai a4 t0 6
-srli x0 s10 28
-srai s10 tp 13
-add x0 t6 s2
-xori s8 a1 -1620
-mulhsu s4 s9 a5
-and s8 ra s8
-lui s6 341141
-srl s7 x0 t0
-auipc a5 160730
-mulhu t3 s1 t3
-or gp s9 a1
-sra t4 s1 a0
-xori t5 s6 -311
-srai t1 a2 12
-sll t4 s9 s4
-auipc t3 525591
-xor s11 t2 s3
-rem a3 a1 a0
-auipc s4 560061
-add t5 a7 t1
-sub a4 a1 t0
-remu s1 a3 s10
-divu s1 ra s11
-mul s7 t6 s2
-add a6 s4 a7
-rem s0 a7 s0
-sub a6 a5 ra
-sll s7 s0 a6
-sra a2 s1 s2
-add a7 ra a1
-auipc t3 774610
-mulh gp a0 s1
-ori t5 s3 -1717
-xori s1 a0 1955
-slli s10 s1 30
-mulh t6 s3 a6
-add s0 s1 tp
-div a6 s0 a2
-lui a3 790835
-sltiu t6 s4 178
-sub t2 s2 ra
-and s6 t4 a2
-srl t0 s10 s0
-sltu s7 x0 x0
-add a4 s3 t0
-rem s3 t4 t3
-slli s5 t3 26
-srli s1 s0 14
-srl s0 x0 s4
-lui a4 192958
-srli t6 s4 15
-andi s9 t2 -515
-addi a1 s2 -1155
-lui t2 956941
-remu s5 s7 s11
-and gp s2 s4
-andi t3 ra -35
-sltiu s8 a7 -129
-slti s5 a5 -1888
-slti a5 s7 -713
-slt s0 a4 s3
-xor t5 a4 s1
-or t1 x0 t1
-or x0 tp a1
-sra t6 t2 x0
-lui s11 63167
-auipc x0 585098
-mulhsu s2 tp t5
-add a7 t4 t1
-srli t4 s4 1
-and a7 t6 a2
-mulh s4 t6 s1
-divu a2 a4 t5
-mulh s2 s8 t2
-sll s10 a1 s6
-add x0 t3 a2
-slti t4 s8 490
-sll t0 x0 gp
-slt a1 a4 a0
-auipc x0 1020782
-slti a7 t4 980
-xori ra a7 -449
-sltu a7 s1 t6
-slli s6 a5 22
-slli a0 t0 16
-xor a4 s8 s5
-mulhu ra s1 t0
-rem t1 s3 ra
-divu a6 s5 s3
-lui gp 398357
-sltu s6 a4 x0
-sltiu a7 x0 -960
-div tp t2 s8
-srli a6 s10 6
-xor s1 s11 s3
-and gp ra a7
-add t3 s1 s2
-sra t5 a2 a6
-slt a6 a4 s7
-and s10 t5 s7
-srli a0 t1 26
-sltu t1 a7 t5
-lui t4 777192
-srl s3 x0 a0
-auipc s4 441486
-divu a2 t2 tp
-sra s6 a2 s3
-remu ra t5 a5
-div a1 t5 t5
-xori t0 tp -824
-srli s10 s9 27
-mulhsu s1 x0 t5
-sll s10 ra x0
-mulhsu x0 a2 s9
-slt t0 s3 x0
-srli s1 t4 9
-slli s8 s10 1
-xor s11 s11 t3
-sltu t5 t6 s2
-remu a2 s7 x0
-slli gp s0 7
-sltiu s3 a6 1903
-divu t2 a4 a0
-andi s7 a3 -1937
-divu ra a2 a2
-or s0 t4 a5
-xor gp s0 a7
-or s7 s1 gp
-sra s8 a5 x0
-slt s6 x0 s3
-sub a7 a3 t0
-srli a7 s1 17
-and s11 t5 s4
-auipc s6 737569
-slti t0 t2 -1775
-srai s1 t3 13
-div s4 s8 a3
-rem t1 s2 gp
-and s4 x0 t6
-mulhsu s10 a5 a2
-slt a5 a4 tp
-addi a5 s7 -1529
-auipc a6 1026480
-srl t4 s7 s3
-xori a3 t4 -1261
-sltiu s2 t5 -1902
-addi t1 s10 -1659
-divu s4 s0 a6
-sra s3 gp t0
-sltiu a2 a7 -1940
-andi a3 s10 -1511
-sltu a5 a1 s2
-addi a4 s6 803
-slt t1 s0 tp
-andi t0 a7 -1939
-xori s3 s3 -895
-and t6 a0 t0
-mulhsu s4 s0 s8
-add s8 s7 a4
-sltiu ra a1 -1253
-andi t2 s5 1979
-sltiu a1 t1 1767
-sll t1 t5 a2
-lui s9 996551
-mul a6 x0 t0
-add ra s6 a0
-addi t6 s7 -451
-divu a3 s7 t1
-slli t5 tp 28
-remu s6 t0 s11
-slt s9 t4 t2
-mulh t5 s1 s9
-and s2 t3 a3
-xor t4 s4 a0
-divu t0 gp s9
-srl a0 a0 tp
-sll s6 gp s1
-mulh t0 a4 a2
-sra s2 s11 s2
-and a7 t5 gp
-rem s8 s2 a7
-sll a2 s3 ra
-remu s1 a0 t3
-addi x0 s5 -1858
-div s7 s0 s6
-rem s7 s4 s3
-slti s0 ra -1104
-divu t6 t2 s2
-sltu a3 a7 s4
-slli x0 ra 23
-xori a4 s3 424
-and a4 t4 a3
-srl gp a3 s10
-slt s5 a1 s2
-remu t2 s8 s11
-ori x0 s3 -2007
-sub s6 a0 s7
-lui t1 248614
-rem t3 a3 s4
-ori gp t6 -1622
-rem t6 s0 s11
-add x0 t0 a2
-xori s11 a6 1232
-andi s6 gp 198
-add gp s1 x0
-sll t2 s4 s2
-or s1 s1 a2
-srl a7 a6 a7
-slt t5 ra t4
-srai s1 t4 4
-xor s8 s2 gp
-sll s3 a4 t0
-sltu s10 a0 t5
-mulh s4 t0 s6
-lui t4 715970
-srli t3 t1 7
-remu ra s8 a4
-xor s0 s7 gp
-xori t0 s5 -1322
-auipc a2 921370
-slt s2 a5 a3
-sll s5 s3 s8
-auipc s2 340030
-xori a7 x0 -613
-sub s2 s0 s2
-sra gp s10 ra
-sra s10 a4 x0
-srai x0 t2 9
-auipc s0 251415
-divu a7 s2 s1
-lui a7 612093
-div a4 s4 a4
-lui s5 148459
-div s5 a5 s6
-add a0 t3 a3
-sltiu s3 ra -1495
-srl s2 s3 s5
-lui s7 458365
-ori s11 a5 912
-andi x0 gp 988
-slt s11 s7 t0
-rem s3 s0 t3
-sub s1 ra gp
-slt a1 a7 t3
-sltiu s4 s11 -674
-sra s3 a6 t3
-sltu s0 s5 a6
-div s7 t0 s10
-sltu t2 t6 x0
-andi t2 a2 1549
-mulh a7 s2 ra
-srai s7 s8 31
-slt x0 tp x0
-rem t5 s7 a3
-andi s7 gp -1885
-sltiu t2 gp -1739
-or s6 s5 s10
-lui tp 722717
-slti s6 t0 -310
-divu a5 s5 a3
-sltu t1 s11 s3
-slt s2 x0 t1
-addi s3 t0 -230
-mulhsu s0 a0 gp
-and a7 a6 t0
-srl s5 t3 s2
-srli s5 s1 26
-remu x0 a0 a7
-mulh s6 a7 s8
-srli t2 s11 16
-div tp s4 s5
-divu s4 a4 t5
-mulhsu t4 t6 a0
-slli s3 t6 12
-or s8 a6 t3
-sub s8 s3 s2
-mulhu t2 a5 a3
-slt s9 gp ra
-ori s5 s6 1278
-mul s4 a7 s6
-mul s7 t6 s0
-sltiu s8 gp -6
-xor s10 t6 a6
-lui tp 624987
-xor a5 t2 a6
-sra x0 t3 t2
-mulh a2 t3 t6
-srl t2 s5 s3
-mulh s4 a1 s1
-mulhu a7 gp a1
-div s6 s9 a2
-add s3 a3 a0
-mulhu s4 tp t0
-mulhu ra a1 s8
-sub a1 a2 tp
-auipc x0 681684
-mulhu a6 t0 s9
-slti s2 t2 1420
-mulh t0 a5 t6
-rem t3 t2 s3
-mulhu s4 t5 t0
-sub a0 t0 s9
-auipc s10 579402
-auipc s7 32715
-mul tp s1 s9
-auipc a5 282147
-srl t4 ra tp
-or tp s9 s9
-mulhu s8 s7 t3
-slti t4 s2 -1459
-sll a3 gp s1
-andi a2 s9 1435
-slt t4 s3 x0
-or s9 a0 tp
-mulh a4 a0 s7
-srli s2 tp 21
-andi x0 tp -159
-xor t0 s10 t2
-slti s0 a6 -559
-lui t3 304722
-add a4 t1 a2
-and x0 a1 s6
-mulh s1 t0 s2
-and a6 a0 s7
-slti a7 s10 -1159
-sltu ra s0 a0
-rem a0 gp s2
-sltiu a3 s0 -517
-sll t0 a4 t0
-remu s4 s2 s10
-sltiu x0 t1 1902
-xori a1 t6 1770
-slt a3 s11 t3
-remu a1 a2 s5
-sltu a7 a1 t2
-div tp s9 a0
-srai a5 tp 4
-div t5 s4 a1
-sub t6 a3 t6
-xor a5 a6 t4
-and s5 t1 s8
-div s7 t6 t3
-remu ra a1 s3
-srai a6 x0 26
-mulhu t3 s10 gp
-remu a0 s0 s1
-srl a0 s6 a4
-srli s4 x0 27
-mulhu a3 a0 a7
-slli x0 s1 0
-rem a1 s3 s7
-mulhsu x0 s9 s0
-or a1 s11 t6
-div s4 s11 t3
-ori s1 s10 132
-slt s3 a5 s5
-and s4 a5 s9
-or t1 a0 s0
-remu s9 x0 s8
-auipc a6 509926
-srli s3 t6 27
-mulh a6 t1 s3
-sll t3 a6 s6
-auipc x0 473371
-mulhu s2 s2 s2
-lui tp 474345
-mul s0 a1 s4
-slti a1 s4 -1574
-add a3 t0 s2
-slti s0 s5 -1344
-divu x0 t4 s7
-sra x0 t4 s9
-sub s8 t6 t0
-sltu gp t5 t2
-sltiu s6 a0 -1106
-slli t4 s1 9
-mulhsu a7 s8 a7
-xor x0 t6 s2
-addi gp gp 245
-remu t1 s8 a5
-srai t5 s1 7
-add s4 s5 a3
-sub s7 x0 s8
-lui s2 37124
-and s9 s10 a6
-sll gp s10 s10
-sub s10 s9 x0
-div t6 s0 t4
-and a0 gp t3
-rem s0 s5 s2
-slti s5 a2 -922
-addi s8 a5 -800
-mulhu s10 a5 s10
-mul gp s4 x0
-add a6 a2 s3
-mulh a4 s5 s1
-divu t0 a2 s11
-ori a0 a2 -1457
-sub s10 a2 a6
-addi a3 a3 -1573
-div s4 s7 s9
-addi a5 s3 928
-srai s11 s6 7
-divu x0 s8 t3
-srl t6 tp s9
-srl t6 s11 x0
-mulh a1 s3 s0
-ori s7 s2 -1964
-sltiu ra a4 -1192
-slt s11 s0 x0
-sub t4 s5 s0
-mulh a7 a6 s3
-and ra s2 s7
-and a5 s11 a4
-lui s3 176534
-mulhu a7 s1 a5
-lui a6 578941
-auipc t6 161257
-sra a2 s8 a3
-xor t3 gp s5
-or a4 a5 t4
-srl s2 t4 t6
-srl t0 a4 t4
-div x0 t3 s0
-divu t3 ra gp
-sub s10 t2 a3
-div a6 a3 t1
-sltiu t0 ra -1523
-and t6 s7 a2
-mulhsu t4 ra a5
-lui t5 1681
-sll t2 s10 gp
-xor ra s3 a0
-xor gp t2 a4
-sra x0 tp s3
-div s5 t6 s2
-srli x0 t3 18
-or gp tp ra
-ori s9 a0 -892
-mulhsu s11 t4 x0
-and a5 a1 s4
-ori s6 t1 1159
-and tp s5 ra
-mul t3 t6 a4
-slti t5 x0 -1509
-sra a7 a7 a7
-mul s11 s5 a5
-sltu a5 gp a4
-auipc t2 264917
-ori s6 t2 -1513
-sltu s4 s0 t6
-sll s5 s4 t6
-or a0 tp s11
-or t1 s10 t0
-mulhsu a6 t0 s10
-mulhsu s8 a5 s4
-lui t0 308749
-mulh s10 s10 tp
-xori a5 s5 980
-div t5 s3 a0
-remu t5 x0 s1
-lui t5 695385
-or t3 a4 s5
-or a6 s2 s1
-divu s10 s10 a2
-lui a5 227252
-andi s7 s10 423
-add s11 s4 gp
-and s10 s3 t4
-sub t5 a6 t4
-sll t6 s2 s7
-add t5 a0 x0
-xor a3 x0 a6
-andi s9 a2 575
-slt t6 ra a5
-and t2 t2 a6
-add a2 a7 a2
-or a6 a5 a3
-srai s4 a1 15
-xor a0 x0 t6
-srl t5 s6 s4
-and a6 s2 t4
-slt t1 s4 s8
-ori a0 a6 105
-sub t5 a1 s9
-sra t2 a6 s10
-addi t2 a3 -1955
-andi a6 s4 -698
-auipc s9 113023
-srl s4 a2 s8
-add s6 x0 t6
-sra t0 s10 t6
-remu s6 a2 t6
+srai gp a3 20
+sltu x0 t1 a3
+andi a0 a7 -752
+mulhsu s5 s7 a7
+mul x0 t6 x0
+div a1 ra t4
+sra t2 a5 t0
+sltiu s1 s11 -996
+sra s10 a2 a1
+remu a5 t4 s5
+mulhu a1 t2 a0
+div s9 a2 t5
+mulh s9 a5 a2
+mulhsu s11 s5 s11
+mulhsu t5 s0 s9
+srai a2 s9 24
+divu t6 t0 t1
+mulh a7 s10 t2
+srl a0 s6 a3
+andi t6 s11 -172
+srli t1 x0 19
+div x0 s10 t1
+mulhsu t4 s5 ra
+xori ra s5 -903
+xori x0 a1 -996
+remu a7 a5 t3
+lui a7 335245
+xor ra ra x0
+slli x0 s10 18
+divu x0 s9 t3
+sub s3 x0 a0
+mul t4 s6 s5
+slt a6 a7 t6
+and a7 ra s0
+mulh a6 a4 a5
+div a5 s1 x0
+sltiu s9 x0 -11
+srai t4 a6 29
+sll a0 s5 s3
+mulhu ra s0 a4
+mulhsu t6 a6 a3
+addi s10 s3 1814
+remu a7 s7 s5
+slti a0 s4 -846
+mulhsu a2 a1 s3
+div tp x0 t4
+addi s3 s7 -956
+xori a6 t4 544
+sra gp t0 s7
+sra a1 a4 t5
+slli x0 t0 31
+mulhu a2 tp a7
+sll t6 ra s1
+auipc a7 469091
+slt a0 s3 a2
+mulhsu ra s10 a0
+ori x0 s0 697
+srli t0 t2 16
+rem a0 t0 t3
+srai gp t1 6
+srai a4 s5 29
+slt s11 t5 a5
+sub t5 ra s1
+lui a2 405174
+lui s7 353553
+mulhsu s10 x0 s2
+xori gp t1 -374
+addi a0 a3 -1902
+remu a6 x0 s2
+mulhsu s9 a4 s7
+srli t1 s9 25
+sra ra t3 x0
+divu s10 a4 a2
+mulhu ra s6 a7
+andi t5 t5 -1678
+sltiu s9 a6 -733
+div tp s11 s8
+auipc s2 226091
+and s9 a7 a0
+rem gp a5 a0
+mulhsu t6 a1 s10
+or a1 t3 s7
+srli a4 s11 8
+add t5 t0 s11
+sll t5 t4 s8
+sub x0 x0 x0
+mulh a7 s1 s7
+mulhsu gp a7 a0
+lui t2 50398
+mul s10 x0 a1
+slt s2 t0 s2
+sltu s9 s5 s4
+add s7 a0 x0
+or t4 a3 a6
+div a2 a3 t4
+mulh s7 x0 t5
+sub s4 t1 a7
+ori s6 a4 -1787
+andi s3 ra 956
+slli a0 s3 11
+slli a5 ra 10
+rem x0 s10 x0
+mulhu x0 s5 t2
+slti a4 t5 -1459
+srli s9 t3 5
+lui t4 562581
+mul s3 a4 s3
+slti a5 s6 -711
+srai s1 tp 3
+mulhsu a2 t2 tp
+slli s5 a3 14
+srli t3 s8 3
+auipc ra 73707
+xor a4 x0 s9
+div s10 t1 s11
+and t2 gp s0
+mulhu s0 s7 a6
+mulh x0 s6 t4
+sll s11 s7 a0
+sub gp a6 t1
+rem a3 x0 t2
+andi a3 t2 -227
+mulhu s5 tp s0
+auipc a2 532241
+sra s11 s8 t1
+lui t0 847086
+andi x0 s9 -2004
+add t4 t1 a1
+mul a6 tp tp
+ori s4 s3 -186
+slt s2 a1 t6
+mulhsu x0 t2 gp
+mulhsu s11 s8 t5
+rem t4 s3 a4
+add t0 s6 t2
+div s6 t4 t3
+sltiu s7 t2 444
+divu s6 a7 s3
+slt a3 t6 s2
+slli s11 s1 26
+addi t6 a1 1323
+remu s0 s1 tp
+remu t3 s5 s10
+xor s9 t0 s2
+mulhu s0 s10 s0
+divu a4 ra t3
+addi s1 a0 -687
+slli a6 x0 21
+remu s4 t0 s8
+mulhu s1 s5 x0
+ori s0 s8 -695
+sll t4 s0 t6
+add s1 s2 s0
+or s4 gp x0
+srai a2 s4 26
+and s6 a2 x0
+srai s5 x0 0
+auipc t3 21944
+sra t0 t4 t2
+slli t3 s4 10
+sltu s5 gp t0
+rem a4 s8 t4
+sll s11 a6 a7
+lui tp 324188
+xor a2 s9 s7
+sub t2 a5 t2
+and a0 s0 x0
+xor t3 t0 s10
+rem x0 s10 t3
+sra a3 t1 tp
+divu a0 s7 t4
+ori t0 s7 1977
+slt t1 s0 t5
+sll t4 a3 s0
+mul t1 s8 s5
+andi tp s0 1254
+add s8 s7 tp
+remu a2 gp s1
+sra t6 x0 s9
+sll s9 tp a7
+slli s4 s2 21
+sra t3 s4 s3
+and s4 s1 t5
+rem t4 t5 t2
+slli s6 tp 21
+andi tp t2 -1962
+andi a7 t2 -1046
+srli ra a0 12
+srai t1 t1 29
+sltu s4 s10 t3
+addi ra a3 2006
+srl s10 x0 t5
+slli ra s9 1
+auipc s8 627385
+srai t4 s5 23
+mul t1 t1 t6
+mul gp s1 a5
+mul t6 s11 s9
+rem t2 t1 x0
+sltu s0 t0 t6
+sltiu a1 t5 -1867
+mulhsu s10 a3 a3
+divu s0 s3 x0
+sltu t5 s11 a3
+remu t2 s10 t2
+ori a0 s6 -1780
+mulh a6 s4 a4
+or ra t5 s7
+andi s5 s3 -145
+sra x0 a3 t2
+ori s5 s2 -487
+sra t6 s11 t6
+sub a4 s10 s11
+sra a3 t6 t5
+mulhsu s9 a3 x0
+srli t1 tp 11
+auipc s9 268364
+srl gp a2 t3
+lui a5 479045
+mul s10 a3 t1
+divu a7 s6 s1
+mul s7 ra a1
+and s1 a6 a5
+sll a3 t0 s4
+mulhu a6 s10 a4
+xor t2 a2 a0
+div a6 a0 s9
+srl tp a1 s5
+mul t3 s4 s9
+sll a7 a2 t5
+andi s7 ra -1719
+mulhsu t5 s3 s2
+addi tp s5 -1790
+sltiu x0 s11 -566
+srai t0 a2 2
+add a7 t4 s8
+add t6 s5 t0
+andi s8 s11 -582
+sub x0 s2 tp
+and gp t5 a3
+ori s6 s3 -2025
+remu s8 s7 s3
+div a2 s4 a7
+auipc a3 300392
+slt a1 a0 a5
+sll x0 a4 gp
+sub gp t1 t0
+mulhsu s0 s1 a4
+mul x0 t4 s10
+xor gp t1 a4
+add s10 s10 s9
+sll s6 s2 a4
+lui a2 201169
+divu t3 a2 a4
+addi t4 s4 -908
+xori t5 s2 -946
+or a1 ra s9
+srai a4 s0 11
+sra a3 ra t4
+divu t2 ra x0
+and a2 t0 s4
+auipc a2 268363
+mulh t6 a0 a0
+mulh s6 s1 s1
+mulhu x0 t4 a5
+sub a6 s4 ra
+mul s1 t3 ra
+divu x0 s2 a5
+addi x0 s4 -1177
+slti gp t3 741
+slti t0 x0 -926
+rem x0 a4 a4
+divu a3 s3 s10
+srai a3 s3 27
+srl t1 tp x0
+slli s7 a5 16
+xor s5 s0 s2
+slli t2 a6 3
+lui x0 782041
+and s0 x0 s2
+andi a0 s5 1607
+xori s10 t0 -728
+mul s5 t0 s7
+srli ra t1 20
+srl t6 s5 t2
+remu t3 a3 t3
+andi s9 t6 -49
+and a6 s5 s9
+rem t1 a7 s11
+slti s8 s1 -1805
+sltiu s2 t3 2047
+mulh t6 x0 ra
+addi a1 s9 -273
+auipc t3 573768
+sll s5 a0 x0
+slti a0 s2 -504
+and t6 t4 t4
+addi t4 s4 785
+divu a0 s0 x0
+srai a3 t2 7
+rem s8 ra s3
+xori s8 t3 535
+mulh s9 s0 gp
+slt t2 s2 s4
+rem ra a6 s9
+mulhsu gp a3 s6
+sltu s11 a6 x0
+slt a2 a1 a6
+slt t3 tp t4
+or s1 tp a3
+mulhsu s2 s6 s0
+div a1 a5 gp
+ori t0 a3 1280
+rem x0 a1 t5
+andi s10 t3 -578
+slti t3 s5 -1239
+slti s0 t3 680
+or s5 s0 t1
+div ra a0 ra
+sub s4 s3 t4
+sra s0 t0 t2
+xor x0 s9 ra
+sra gp x0 s10
+divu s10 a6 t0
+remu ra a3 ra
+addi gp a7 -778
+mulhu x0 t3 s9
+sll tp a7 t5
+remu a6 a2 s2
+xor t0 s2 a6
+addi t2 t5 -236
+addi t4 s5 -1991
+srl a3 x0 t2
+srai t3 s5 26
+slli s1 t4 21
+srl a2 a2 t3
+addi s3 s0 -1116
+slli s4 ra 11
+mulhsu s3 s4 gp
+slti s10 a2 1330
+sltu t2 s3 a3
+sll s2 s7 s2
+slt t1 a2 s3
+rem s4 s9 s3
+slti x0 a6 1020
+sltu a2 x0 s9
+sltu t3 a1 s3
+andi s1 a3 85
+ori s5 s7 -175
+xor x0 a6 s3
+rem x0 s0 tp
+and a1 s7 t5
+addi x0 s7 -717
+ori a6 s8 -598
+add s3 s4 t0
+srai gp a1 1
+xori t2 a1 787
+andi s5 x0 -925
+rem ra s8 tp
+slti s6 a6 1734
+or gp s6 x0
+xor s1 t1 a2
+ori t5 a5 472
+sll x0 t6 s4
+sltiu t4 s0 1943
+srai t3 s6 26
+ori s10 t1 -838
+sll t5 gp t2
+and tp s3 t0
+lui s5 921338
+slti s10 s8 -1759
+ori s1 s0 1823
+auipc s9 760116
+sll t5 s10 s7
+xori s3 t5 -553
+andi s8 tp 342
+lui a3 472694
+mulh a2 a5 s2
+rem a7 s9 s9
+sra a2 t0 a0
+and gp s1 s1
+mul x0 s10 t3
+slt s9 s10 t4
+auipc a0 395031
+srai t5 a3 25
+sll s0 t3 t6
+srli a7 t4 5
+slli t3 t6 24
+srl a1 a4 s6
+rem s5 a7 a5
+srl s7 s2 s6
+addi a1 ra 1119
+mulhsu t1 a0 s8
+sub s8 s6 t1
+lui s3 940107
+lui a7 915840
+andi a0 s9 -276
+sub a0 s3 s7
+andi a4 t6 -1716
+slli s5 a4 27
+div a4 a3 x0
+auipc s0 255450
+divu a0 t4 a4
+addi a6 a0 -834
+rem a3 s0 s6
+sltiu s2 t1 -1564
+rem s0 a5 a6
+mul a5 s7 t2
+mul s7 s1 s8
+sll s3 s5 s3
+divu t0 a7 s9
+sra ra t4 s0
+xori a7 s4 -1771
+slli s10 s8 27
+remu a1 a1 t2
+ori gp t4 -326
+ori s8 a2 -1217
+ori s4 a1 -1974
+remu s3 s9 s1
+addi t1 s7 -1354
+slti t4 s2 -991
+xori s6 s9 824
+sub s11 a4 ra
+ori t4 s7 -1161
+srli t2 s7 25
+srli a2 t5 17
+ori x0 a7 -849
+divu s7 ra t2
+mulhsu ra s1 s7
+sra s4 t4 x0
+mulhu s0 s2 a4
+addi ra s11 874
+addi a0 a6 55
+remu t4 x0 tp
+or t1 s7 a1
+slti s11 t2 1685
+add s6 s8 x0
+mulh gp x0 t5
+srai t6 a5 5
+srl s1 t6 a2
+srli s8 a2 21
+div a0 t3 a7
+slti t5 ra 961
+addi a4 t2 -791
+slt t2 ra s5
+remu t5 tp s3
+sub gp t2 s10
+add t6 a6 t1
+srai s10 gp 4
+auipc s7 494946
+slt s7 x0 tp
+remu a3 s2 s5
+rem s10 tp t0
+lui s2 9368
+rem s0 x0 t4
+remu t1 s8 a6
+andi a2 a4 -1558
+srli s9 s0 7
+lui t6 750187
+ori t6 t1 593
+or a3 t0 s5
+sra s1 s4 s3
+div a6 s4 s4
+xori s6 tp -675
+xori x0 s10 164
+sra a6 s11 s0
+slt t1 s8 t3
+sra t4 a2 x0
+or s9 s3 a0
+sltiu s7 a1 -204
+add t2 a4 s0
+slt s0 a3 gp
+and s10 t2 a1
+remu s2 s4 a5
+mulh t1 s6 t6
+divu x0 a7 t4
+sll a7 s4 a5
+sltiu a3 a4 -1340
+sltiu s6 s10 -1116
+sub gp ra t2
+add t6 s11 t1
+mulh s0 t5 a1
+addi a7 s0 -1832
+addi s8 tp -1625
+sra x0 a3 s4
+andi s5 a3 -1651
+auipc t0 613793
+xor t3 ra t4
+or t6 t1 s1
+rem t1 s2 ra
+divu t6 s7 a7
+sll tp gp s6
+mulhu a0 s5 s7
+mulhsu t0 s11 a1
+divu s1 ra a3
+auipc a0 564002
+sra s11 s0 s10
+sltiu s7 a1 968
+slt t2 s6 s3
+srli s5 ra 12
+slti t0 a5 -768
+auipc t6 855419
+mulh s2 a0 x0
+mulhsu gp a2 a7
+divu t4 t5 a4
+rem t6 t3 x0
+sll s0 a4 t4
+xori ra a5 950
+xor a2 t6 a3
+divu t4 s5 s3
+srl t3 t5 t1
+lui s6 884861
+srli s0 a3 22
+mul s2 t2 s7
+auipc t3 1011403
+xor t4 s7 gp
+srli t6 t6 20
+mul t5 s1 t1
+slti t6 s9 -651
+xori a0 t2 -1140
+xori x0 t1 -988
+mulhsu t6 t4 a0
+xor a7 a3 t3
+mul t0 t4 t4
+slt t1 a3 t3
+sltiu s3 a5 441
+lui x0 210109
+sra s9 a5 s0
+sra a5 x0 a2
+srai s6 a7 9
+sltu t0 s5 tp
+sra a3 t1 a7
+remu t3 ra s2
+lui s0 980004
+divu s6 s0 a5
+sub t1 s1 t4
+remu t5 t6 t4
+div s4 t2 s7
+div ra gp a2
+xori t2 a3 -1883
+mulhsu tp a3 s6
+rem ra s6 s10
+rem t3 a0 s5
+div s4 ra s0
+andi x0 s1 -1555
+or s3 s0 a5
+sll s1 x0 s4
+mul t4 x0 x0
+auipc s3 134021
+srai s0 a2 8
+sll s3 t6 a4
+mulhu s7 a1 s9
+mulh s8 a1 t3
+auipc tp 28785
+add s9 a2 a7
+addi t3 a5 1346
+divu s11 s8 s7
+sra s11 t1 t0
+mulhsu s8 a5 a0
+rem t6 t2 s4
+mul t3 s8 s10
+mul s0 tp gp
+lui t0 419670
+srl a6 s9 a0
+andi a1 a2 -1206
+mul t1 s11 tp
+sltiu t6 a7 -1500
+slli a3 a5 25
+mulhsu t4 t4 a7
+or s10 a1 s3
+srl s10 t3 a6
+auipc a0 921220
+sra s4 t2 s9
+srl s6 a3 t4
+sra t1 s8 s8
+sub gp a1 a5
+mulhsu s4 s7 s4
+srl a3 t1 gp
+addi t3 a5 1403
+rem s0 s10 t0
+mulh tp x0 s1
+slti t2 s0 -1142
+andi a5 a2 -1036
+sub s9 s7 t6
+mul s8 a3 t3
+slli s11 t2 26
+slti tp a1 -1063
+xori x0 t4 -99
+sll a6 s10 a1
+and ra a3 x0
+slti t3 a4 1532
+auipc x0 504792
+sltu t3 s10 ra
+mulhu t0 s7 s0
+div tp s7 s11
+div s9 s1 s5
+mulh s6 a7 a2
+andi ra t3 -1391
+sra s6 a0 s11
+or t6 s10 s2
+slli a2 s4 4
+mulhu a2 ra a2
+slli a1 a5 0
+xor t2 s0 a5
+mulh s9 s9 t2
+or a1 s3 tp
+xor s1 t3 s8
+divu s4 x0 x0
+sltu t6 s2 s6
+sub a0 a0 t4
+slli ra s3 7
+slti s8 a1 -1898
+add a7 s1 s6
+sltu t6 a3 s4
+andi s0 a3 -45
+slt s2 s9 s11
+sra x0 s4 t0
+addi a7 t0 -1944
+xor a3 a1 a5
+ori s0 t0 1221
+and s1 a4 t4
+add t1 s9 x0
+slti a0 a0 -105
+ori s5 s6 131
+or a1 s11 a2
+lui s5 1011149
+auipc a1 436595
+divu a5 a1 s8
+remu s4 t2 t0
+div a6 a1 s1
+mulhsu s9 t3 t3
+sra s7 s4 t0
+sltiu a3 s0 -706
+lui s3 1004761
+sra t6 a4 tp
+slt s7 tp x0
+srl s8 a5 t1
+mulhu t3 s2 t0
+andi t0 a4 -1855
+mulh a7 s6 s5
+sltu a7 t3 x0
+srl gp a6 a7
+lui s4 722181
+sub s9 a1 s1
+divu x0 t1 t6
+srli s8 s0 15
+srli ra s1 11
+rem x0 t0 t0
+slt s2 t0 gp
+auipc t1 483292
+mulh s0 t5 s0
+sltu t1 s10 x0
+slt s11 s6 s11
+xor t2 t6 t2
+slli a7 a4 10
+and s6 t5 a7
+andi t6 t3 -1241
+slti x0 t4 -764
+mulh gp s5 t6
+xori t1 t4 -2033
+srai x0 s3 14
+add a1 s2 s10
+div s0 s4 a3
+slti s2 t4 -620
+remu t1 s0 t4
+mulhu s1 s9 s9
+ori ra s7 221
+sll s7 s2 t2
+andi t6 gp -1912
+slti s10 s4 -1359
+srl t0 t0 a3
+sltu a1 t0 s6
+lui a5 775312
+sll a6 s9 a1
+mulhu t1 s10 t3
+auipc s10 654142
+andi x0 s9 -1800
+srl a4 s11 a2
+xori tp s3 -137
+mulh gp t6 x0
+srai s11 tp 18
+mulhu gp t0 s0
+or t3 tp a6
+sltiu a1 t3 -2
+srai a7 x0 3
+slli a7 s2 25
+sll s2 s3 s5
+ori tp t4 -610
+mulhu t6 a1 a1
+auipc s4 17549
+slti s0 ra -1837
+andi s0 ra 1361
+lui s4 729068
+sra t6 t5 a2
+or a0 a0 tp
+mul s7 gp s1
+srl a2 x0 t6
+mul s3 a2 tp
+div a4 a3 x0
+andi a4 t3 -584
+xori s0 s2 -1365
+addi a5 x0 -1818
+sltu x0 s4 t6
+slti s1 s5 -301
+rem s1 s4 s6
+mulhu a5 t1 t6
+rem s6 s5 s8
+addi a1 a4 771
+ori a6 a2 -304
+sra a0 a1 s5
+mulh a0 s0 s10
+auipc s8 512645
+andi s1 ra 1742
+slt a1 a5 ra
+slt s5 s2 a7
+div a0 s6 s6
+and s11 s2 x0
+sra s4 ra s0
+sll s3 s8 s9
+addi t3 a1 1384
+ori t3 s0 -1146
+srli t6 t2 6
+add s1 s11 a6
+andi s3 s9 1073
+or t5 a0 a0
+add a7 s8 x0
+remu s11 s9 a5
+slli x0 s8 23
+divu s11 x0 a2
+xor s7 t4 tp
+xori t3 a5 1475
+rem t5 s9 s8
+xori a5 t0 1009
+rem tp a5 s6
+mulhu t3 s2 a5
+xor a0 tp s6
+mulhu a1 s2 tp
+srai t5 a4 20
+srl a3 s11 a6
+addi a3 s6 376
+sltiu t3 s2 -1904
+andi x0 t3 -1447
+mulhsu s0 a0 a3
+srai s7 a5 0
+sll a2 gp a4
+and gp a2 a4
+and s3 t0 s9
+slli x0 a2 1
+auipc a2 123392
+rem t3 t4 s2
+andi a6 t6 -1450
+slti s6 t4 -232
+srai s6 s4 9
+remu s4 s6 a4
+addi t6 s11 -1020
+sltu t2 s3 a7
+sll s2 a7 t4
+addi t2 s0 486
+and s10 s8 x0
+or a3 a6 s5
+lui x0 541667
+xori a0 a6 -1482
+sltiu t6 t5 1423
+auipc a0 445312
+rem s11 ra x0
+slli s9 ra 8
+xor s8 tp a7
+mulhsu a6 a4 t3
+xori s7 x0 -718
+slli t2 x0 25
+divu s0 s1 a0
+sll tp s7 a0
+andi x0 t5 -1955
+and s6 s9 gp
+remu x0 tp x0
+and t3 s9 s8
+mulhu s3 s6 x0
+rem s6 tp t6
+slt s7 a4 t4
+srl t6 s4 x0
+slti s9 t0 -1968
+div a5 s8 s1
+rem s6 s5 a0
+slli s2 a0 17
+srl t4 s7 t1
+xori s8 a4 -381
+divu a1 t0 s2
+xori s8 t2 -1669
+mulhu t3 x0 t1
+addi s3 x0 -187
+and a0 s10 s0
+lui t3 378883
+remu gp s5 t5
+xor x0 x0 t3
+auipc s7 778080
+divu t6 t5 a0
+slli s0 a7 23
+divu s9 t1 a4
+div s5 ra s3
+add ra s3 a5
+sltiu s7 s6 -1095
+and t6 tp t0
+andi x0 ra 345
+ori a4 s8 -994
+mulhu t0 s2 s3
+sll a0 x0 gp
+addi t6 a3 1324
+sll a3 t1 a7
+lui s6 308576
+mul s10 s8 s2
+sub t2 a6 s8
+rem t1 t0 t2
+addi x0 ra -1363
+andi a7 s0 118
+and a7 x0 a6
+mulhsu a5 a7 x0
+sra s11 s0 t1
+slti s10 a1 -2040
+xor a4 s1 s5
+mulhu s9 t3 x0
+lui t6 887332
+ori t2 t4 -1775
+srli a3 s6 6
+sra s11 t4 s2
+andi x0 s7 -1976
+sub x0 t3 s6
+addi a0 t6 -309
+xor a4 a5 s5
+and s8 s3 t5
+xori s2 x0 -257
+sra x0 s3 s0
+addi a1 a1 -1378
+addi a7 s9 -115
+lui x0 370974
+mul s1 t4 s4
+or gp t5 s5
+slli s10 tp 31
+slt gp s10 tp
+mulhu t6 t6 x0
+add s5 x0 t4
+mulh tp s10 s10
+mulh a6 a1 t2
+add t5 a1 s5
+divu x0 a3 s4
+sra tp s1 t5
+add s9 a1 a3
+and a0 s6 t1
+sltiu s8 a6 219
+sll x0 ra s4
+mulhsu x0 t5 a5
+mulhu a0 t3 s8
+div s4 s11 s9
+addi a1 t5 -260
+xor gp a7 s2
+srli s6 t2 28
+mul a5 a1 a1
+and s3 a3 a4
+mulh a4 x0 s10
+mul a7 t6 t3
+and s5 s4 s3
+div s0 s0 s9
+ori ra s6 1938
+xor a6 s8 s2
+mulhu gp s0 t4
+sll gp s7 t6
+slt a0 x0 x0
+xor a3 a4 t0
+auipc a2 977495
+slli a2 t4 28
+mulhsu x0 a7 s10
+slli a7 s9 0
+sub s1 a4 s11
+slt t1 s3 a1
+sltiu a4 t3 1889
+addi x0 s7 1936
+and t2 x0 s8
+mul s5 a6 s1
+sra x0 t0 s1
+and s10 s3 s3
+slli a6 x0 27
+div s4 a0 t1
+sub x0 t1 s8
+sll s5 ra ra
+srl a3 t4 s9
+mulhu s3 t6 t2
+srai tp t4 24
+mulh s3 s5 x0
+add t4 a5 ra
+addi s7 a7 -1130
+mul x0 x0 a0
+mulhsu s6 a7 s6
+mulh a5 a5 gp
+slli t6 s10 2
+sra ra x0 a5
+mulh s5 a1 tp
+remu s0 s7 t0
+div x0 s1 a2
+ori a7 ra 177
+srli t6 t2 22
+srli s8 s2 15
+div x0 x0 t3
+div a0 tp a6
+xori ra t3 204
+srli a0 a4 27
+mulhu a5 ra s7
+slli a2 a7 26
+ori a5 a5 -198
+auipc s2 73558
+andi s10 t5 53
+and tp s5 a0
+slti s11 s8 218
+andi t5 a4 1335
+add s2 s10 gp
+sltu t1 x0 t3
+xori a6 a1 -200
+mul s6 s2 s7
+ori s8 t0 411
+andi t4 tp -452
+remu t0 t5 ra
+slt a0 s2 a0
+rem t1 t3 a1
+sltiu s2 s2 -1542
+divu a2 s7 s2
+remu a3 s6 x0
+slti s0 t5 -1900
+slt a6 a6 a3
+mulhu gp s0 a4
+ori t5 a0 -1236
+mulh t2 a3 a3
+auipc a5 352194
+auipc s8 12370
+sltu a5 a4 s7
+sra t3 a1 s6
+slt s0 t2 s2
+mul a4 a1 t3
+sltu a0 a2 s7
+mulh a4 a2 s3
+sll a1 a3 x0
+xori t1 t5 -1663
+div s0 s1 s9
+mulhu t6 x0 a4
+lui gp 882154
+div s1 t2 s9
+divu t1 a3 a0
+mulh s11 s5 s3
+rem s9 s8 a2
+addi x0 tp -260
+div t0 s7 s1
+sub s11 tp s2
+lui t0 375065
+and gp gp t3
+srl a3 s11 t2
+sll a7 gp t5
+mul t3 t6 t4
+div a2 s8 a7
+mulhsu a7 a6 x0
+slli a5 x0 28
+add a4 s0 s2
+divu t6 s7 s1
+mulh a7 t4 s9
+add s10 s6 ra
 mulhsu a3 ra s7
-rem gp a4 s11
-remu s9 tp t4
-srai s4 tp 17
-slli s8 s5 30
-sltiu a4 a3 310
-sub s7 tp t0
-addi s3 a5 1262
-mulhu x0 t3 s3
-and s0 x0 s7
-remu tp a3 t5
-remu s10 a5 a7
-andi a6 x0 1688
-sll a6 s9 a2
-and a1 s6 t4
-mulhsu s3 s7 a4
-srl gp tp a0
-mulh s7 a2 x0
-sll ra s0 s3
-mul t2 s5 a6
-srli t1 a6 14
-lui s9 972746
-addi a5 t1 1532
-slt s5 t4 s0
-divu a3 t3 s7
-slti a1 a4 -721
-sltu t3 a0 s4
-mul s6 ra s9
-mulhu a0 a4 t0
-auipc x0 1043956
-div s9 a6 s5
-srl t5 s2 s8
-slti tp a0 -1531
-sltu s11 s4 s9
-or t6 s5 t6
-ori s1 s0 -1724
-sltiu s11 t2 -739
-divu x0 t3 a6
-sra tp s7 t1
-slt s4 a3 a0
-slti a3 s1 -1907
-srai t2 t2 18
-remu a7 t6 s3
-divu s7 s4 a3
-slli s0 s10 0
-srai s5 s9 25
-slti t3 a7 1938
-xori s10 gp -1862
-lui t1 24777
-lui ra 133503
-sra t1 a2 s1
-xor s1 s5 t1
-sll t6 ra t3
-mulhsu t3 s9 a0
-and s1 s5 a4
-addi s0 t3 -499
-and gp a3 s8
-mulhu t5 gp tp
-sltu s1 a7 s6
-rem a1 t3 t4
-srl tp a3 a2
-addi t0 t2 -705
-slt gp s4 a5
-sll s5 s1 t5
-sltu s5 s5 s7
-auipc s3 684912
-srl s7 a2 x0
-mul s6 x0 ra
-sll s8 t0 a1
-xor s7 s4 t3
-sll t5 x0 s5
-slti t5 a4 575
-slt tp a2 s11
-slli t0 t4 30
-slti t2 s8 -85
-xori a0 a5 315
-addi x0 t5 -836
-or t0 a3 s5
-div s5 t4 tp
-xor a3 t6 s4
-xor x0 s11 a3
-sra x0 a4 ra
-srl tp x0 s1
-add t3 s8 t1
-remu ra s2 x0
-ori a4 x0 -1361
-rem t6 a0 s4
-div s4 s10 x0
-lui a6 428282
-divu s11 a1 a1
-and s3 t2 s5
-andi s1 s7 -299
-mulhu a0 a0 s10
-addi a4 a0 -1731
-divu x0 a1 s6
-or t0 x0 a3
-add ra s7 s10
-srai t1 a7 15
-xor a1 ra s2
-sra s11 s6 s4
-lui s0 385928
-mul s4 a1 x0
-slli a5 a4 4
-add x0 s5 a6
-slti a5 s2 852
-srl a7 t5 t3
-rem s5 t2 s5
-mulhsu a0 s0 s4
-xor s3 a4 s2
-xor t3 s1 a2
-srli gp a3 28
-xor t3 s11 t5
-slli ra s2 24
-or t4 t6 t2
-auipc gp 313474
-andi t4 a2 1595
-mulh s8 t2 s7
-sra s8 s8 t0
-divu t1 s3 s1
-mul t3 a0 t3
-srli s10 s11 26
-mulh s3 a0 s10
-srl t0 x0 a6
-xor ra tp a0
-rem t0 a7 t5
-lui a1 314761
-divu s11 a5 t6
-and s2 t5 a3
-xori x0 ra 1060
-mul t1 s7 s3
-slli t6 a0 16
-slli a3 s7 23
-ori s10 s3 1166
-ori gp a4 -1077
-sltiu t6 a6 -677
-and t5 s7 a4
-sra t0 s0 ra
-mul tp s0 s2
-add a4 a3 a3
-mul s11 t0 tp
-auipc a6 174587
-ori a6 a0 554
-auipc a4 553626
-slt a2 t5 a7
-srl a2 t3 a1
-xor s3 s4 s4
-add a5 s10 s6
-andi s5 a0 -306
-div x0 t6 s11
-mulh t3 x0 t4
-srli a7 t2 26
-srai t4 ra 8
-divu s3 s5 s9
-slt a4 t5 t0
-sltu a2 s11 t1
-sltu t4 gp gp
-mulh a3 s9 t0
-add a2 t3 a1
-slti a3 t5 -1591
-rem a1 a1 s9
-mul a1 t5 s1
-sltu s4 s5 x0
-add t5 a3 t5
-addi gp ra 1877
-mulhu gp x0 s5
-sub a1 t0 s4
-sra s6 x0 s2
-sltu s8 a5 t4
-mulhsu s3 a1 s10
-sltu a0 s11 t0
-ori s0 s5 952
-xori t0 a3 -1389
-slt ra s11 s3
-div s4 a6 t2
-andi a0 a4 -1660
-sub t2 s3 a2
-mul a2 x0 s7
-divu a0 s5 s6
-or t2 ra s2
-slti s7 a1 -412
-sltu ra gp a5
-sltiu a7 ra -1647
-auipc tp 69573
-mulh a2 gp t1
-mulhsu s7 x0 a2
-sra s7 x0 a5
-srai gp ra 14
-divu s0 a3 a4
-mulh ra s3 s5
-sll s2 ra s3
-mulhsu x0 gp gp
-xori t2 a0 -1320
-srli gp s1 10
-lui s1 576112
-xor t4 a6 a7
-mulh s3 s4 s6
-div s3 x0 s7
-srl s3 t1 a5
-lui a7 50160
-divu x0 x0 a4
-add s9 s3 s10
-div s8 x0 s1
-sub s10 x0 a2
-mulhu t5 t6 t2
-addi t4 gp -1504
-sub x0 x0 t6
-sltu s2 s3 a4
-mul a6 a6 ra
-mulhu a0 a0 a5
-slt s3 a1 s7
-sub t6 x0 t0
-sltu s4 s11 t3
-sltu s6 s0 a7
-srli t1 s2 26
-auipc a1 789291
-remu s1 gp a2
-mulhu a5 t1 a0
-lui x0 708462
-mulhu t6 s3 gp
-slli s6 tp 22
-mulh t6 s0 a6
-rem t0 s6 a1
-ori t0 x0 808
-srl x0 x0 a4
-srl s1 s2 s4
-srli a0 tp 22
-auipc t5 157235
-sub t5 s4 s6
-sra a6 t5 tp
-remu t3 s4 a2
-slt x0 t2 x0
-and a5 s5 s6
-rem s10 t3 a7
-slli s3 s2 14
-divu a2 a2 s3
-lui t4 513571
-slt s0 x0 s9
-sub a7 s8 gp
-srli s7 s10 4
-add s4 gp t0
-and a7 tp t6
-and s4 s3 tp
-sra s5 a1 a6
-sltu t0 s0 t4
-ori s5 a1 -433
-sra ra a0 s10
-remu s5 s0 s6
+sltu s9 tp s10
+auipc a2 108867
+and s4 t6 t2
+srl s0 s7 x0
+sll t2 s1 s8
+andi t1 a7 -1934
+auipc x0 437768
+divu s8 t5 t1
+sub s3 a2 t1
+srai t5 x0 12
+mulhu s2 s2 s4
+srai ra s4 17
+srli s10 t6 16
+add s6 t1 t6
+srai t0 t2 6
+and t1 t4 s7
+mul a6 s1 t4
+remu s2 s6 a1
+auipc t4 778239
+add s7 a6 s10
+or a0 x0 s2
+mulh t2 gp s0
+mul s3 a1 t1
+ori a0 s4 -920
+sll x0 s5 t0
+srl a1 x0 a3
+srai ra a4 20
+auipc s2 417576
+and tp t0 x0
+slli s9 s6 2
+divu t6 s11 t6
+auipc s11 772978
+sub s9 a5 t6
+mulh gp s1 a5
+mulh s2 t2 s1
+mulhu s4 a0 s2
+auipc t5 937331
+sra s10 t3 a2
+ori t0 t1 -1963
+mulhu s7 t2 t6
+xor x0 s9 a4
+div a3 t3 x0
+slli a5 a1 8
+xor tp a0 a0
+slli s10 t5 17
+sll s9 x0 a0
+slti a6 x0 -365
+ori a7 t1 -1662
+lui t3 779601
+sltiu t5 s9 -433
+lui a5 890006
+addi t3 t0 -1322
+xori a2 a7 1913
+auipc x0 240107
+lui a2 718086
+auipc t2 460214
+remu ra x0 s8
+mulhu s5 x0 t4
+sll a7 x0 s9
+addi t0 a0 -1458
+lui s4 437505
+mulh x0 ra t5
+srai gp a3 4
+rem a2 a5 s4
+xori s7 s9 -143
+slt t4 s3 ra
+or s5 t1 ra
+lui s0 373863
+mulhu s0 a2 t1
+andi s5 ra -1258
+sll s2 s6 s0
+srli a7 s10 24
+sub s0 t0 s8
+andi s9 t2 -1315
+sltiu t3 ra -1198
+xori a1 s5 -122
+add x0 s9 t4
+slti s10 t0 -628
+mulhsu a0 a6 tp
+mulh t0 t4 s2
+slt s3 s1 gp
+slli a4 s2 21
+add t6 ra a4
+rem a3 t5 s7
+slt x0 t3 t5
+srai ra ra 18
+xor a0 t4 gp
+addi t1 s8 -1330
+sltiu s10 a0 -1482
+slli s11 a2 5
+mulhsu t5 x0 a4
+sltu s2 t6 s0
+divu s5 a4 s11
+srl t2 s0 a3
+rem s0 t0 gp
+mulhu t3 s10 a1
+sll a3 a7 t4
+div s8 t6 s4
+addi s1 a1 1896
+srai s7 a5 29
+sll s0 s4 s2
+sll s11 s5 t2
+sll t6 s7 tp
+sra a2 a5 t4
+remu s11 s4 s11
+rem t3 s3 a1
+mulh t6 gp x0
+add a6 s9 a5
+ori a2 a0 593
+srli s2 a2 12
+divu s10 ra a1
+sub s2 t1 s7
+andi s0 t6 -716
+xor a3 a5 s0
+srl t6 s11 s6
+lui s7 143376
+ori t5 x0 -400
+xor s2 a4 x0
+srl s8 x0 a5
+mulhu a4 s6 a5
+addi gp s1 -1869
+mul t6 s10 s1
+srli s4 s9 31
+mulh a2 a0 a6
+and a1 a0 a4
+lui s2 1013207
+mulhu s7 x0 x0
+ori t4 s7 -556
+mulhsu t3 s10 x0
+slli tp t2 24
+slli t2 t3 9
+slti a1 s10 785
+slt a3 s3 s4
+slli t6 ra 11
+andi t2 t2 -327
+mul t6 s9 t5
+slti s8 t5 143
+lui s7 130746
+sltu t6 s3 s3
+remu gp s0 s7
+rem s9 s5 a1
+mul a6 t2 s7
+slli s11 t5 17
+slli t5 s2 14
+xori s0 s9 -78
+srai a6 t5 11
+mulhsu t1 t2 s11
+srai x0 s0 17
+sltiu t2 a6 -1343
+divu a5 t6 t6
+div s6 a0 s7
+slli s5 s7 30
+sll a2 s1 t6
+srl a4 a0 x0
+sll s11 s4 s2
+sra t5 a6 s10
+mulh a3 s0 s0
+rem t1 a3 s6
+srai s8 t6 24
+srl t1 t4 tp
+srl t0 s9 a2
+divu x0 gp gp
+mulhsu s8 a0 s7
+remu ra t3 gp
+slt a1 a6 tp
+or a4 s7 ra
+sltiu x0 ra 730
+xori t1 a2 -840
+mulhsu a5 ra t4
+divu x0 s4 a1
+mulh t0 a5 ra
+slt gp s9 a1
+srli gp a6 17
+remu a0 t5 t4
+slli a5 a0 10
+slt s5 s0 a4
+srl s6 a6 s5
+div t1 a6 t0
+and s2 tp s10
+remu a2 s11 a1
+sltu s10 t3 a3
+srai x0 s8 3
+andi s3 s0 245
+srli t0 t6 22
+andi a3 s7 -1723
+srai s8 s7 29
+divu a7 a4 a1
+mulhsu s1 t3 s7
+srl t3 ra s4
+sra t5 a0 x0
+ori a4 s7 -1124
+mulhsu ra s11 a2
+srai t5 a5 29
+mul s9 s5 s11
+mulhsu tp t5 tp
+sub a2 t4 t0
+remu s6 x0 a6
+mulh gp t0 a7
+mulhu t0 a0 gp
+lui t6 136626
+sra s6 t0 s3
+remu ra s10 a7
+mul s9 a5 gp
+slli s6 tp 19
+mul t1 x0 s8
+xori a2 s6 -1300
+addi t4 x0 -1753
+slti a2 s0 -1625
+srai a6 s4 9
+srli s2 s4 23
+add t5 s10 s4
+mulhu gp x0 s10
+rem a6 s9 s2
+rem ra s7 ra
+xori s0 t0 -1912
+mulhu a5 t3 a0
+mulhsu a6 s5 s1
+mul a2 a2 s5
+lui s9 217151
+sra gp t0 gp
+addi s11 t3 381
+mulhu s1 s1 x0
+rem x0 t4 a2
+srli s2 t3 2
+mulhu t2 x0 a6
+srai a5 s8 23
+sltiu s4 s3 237
+slti ra gp -1199
+rem s7 t6 t3
+ori s0 a6 486
+div t5 s10 a0
+and x0 a7 s0
+sra s6 t0 s11
+slli gp s6 13
+andi x0 a7 -1322
+and tp t2 s5
+auipc s7 1004886
+srai a2 tp 3
+auipc a5 713974
+slli s8 t1 12
+xor t3 t4 s9
+xori s9 t3 1694
+auipc a7 11033
+mulhsu a2 s9 t1
+mulhsu a0 a0 s3
+srli s10 t4 31
+slti a0 a0 1106
+mul x0 t1 t4
+ori a3 t1 -47
+xori a5 s11 -892
+sub t5 s0 t1
+divu tp s4 a3
+add a2 t6 s0
+div s3 s10 s11
+mulhu s6 t4 t1
+srli a6 s2 30
+xori a0 a5 -437
+mul s7 a2 s1
+or t3 s11 gp
+xori a6 a3 -313
+add a1 t2 a5
+auipc s6 616807
+andi t6 s4 1702
+xori a1 a0 -558
+and s4 t1 s4
+rem gp x0 s1
+div x0 s2 s9
+lui s8 197185
+or a5 t3 t0
+xor s7 s5 tp
+srai s6 a6 8
+div t2 gp a1
+mul s5 a7 s2
+sltiu t3 x0 268
+xori tp s7 -477
+mulh a4 s9 s7
+remu a2 t2 t4
+mulhu s2 s3 gp
+mulhsu a7 s6 ra
+remu tp s1 a3
+or a5 t6 s2
+mulh x0 s6 a2
+mulhsu s10 a0 x0
+andi a1 s5 -1437
+mulhsu a4 s11 a3
+srl s2 t3 t3
+slli tp x0 6
+sll s9 a5 t0
+mulh t0 x0 s11
+mulhu t4 gp s6
+auipc t4 700484
+andi t1 s1 -1226
+slt a1 s1 t3
+mulhsu gp a4 tp
+srli s8 t2 0
+srli x0 a5 0
+andi s7 t5 -1963
+sltu s3 x0 t4
+srli a5 a2 24
+sll a7 s0 s10
+andi s5 a3 -2015
+mulhu gp a2 s9
+mulhu s10 t0 s7
+div s7 s10 t1
+ori a4 s9 -1538
+sltiu s0 s1 -663
+ori s0 s11 -1928
+sltu a5 s5 a5
+sltu s9 a0 t4
+remu a7 s9 ra
+sltiu s2 s2 -1464
+srli a1 t6 16
+srli t5 t3 13
+sltu s0 s3 a0
+lui t3 630807
+mul a2 s8 t6
+sltiu gp s11 -945
+sltu a1 gp t4
+sub x0 ra t6
+slt a5 a5 t1
+andi x0 s5 -213
+sra a4 s8 ra
+remu x0 t6 a5
+xor s8 s11 s5
+srai t2 s0 7
+add s0 a5 s10
+srl a4 a2 s3
+slt t4 t0 t3
+lui s4 417723
+ori x0 s10 -1439
+mulh s8 a0 s5
+remu x0 tp s4
+or a3 t2 s5
+sltiu t1 a4 895
+andi s3 x0 658
+xori s11 s11 -524
+slli t3 t1 29
+sll s3 t0 x0
+slli t0 a5 8
+srli x0 t0 25
+auipc t5 282036
+add a6 s7 s8
+auipc a1 122538
+mul t2 a1 tp
+add s3 x0 a3
+slli t2 a2 8
+andi s1 a5 1224
+sltu x0 s11 t1
+srl t3 s9 t4
+andi s5 t3 -1139
+ori s4 x0 -120
+sltu s2 t4 x0
+lui s1 818382
+sub a4 a6 a4
+srl gp x0 tp
+sltu t1 ra s9
+sub t5 s5 s7
+div a6 a7 t1
+mulh s8 a2 gp
+or s2 a5 a1
+sltu tp tp s4
+remu a0 t4 a1
+sub a1 a6 a6
+rem s5 a3 s2
+andi t6 t1 507
+sltu gp t0 t2
+srli x0 a3 18
+add a7 x0 s6
+srli gp s3 2
+mul t4 t4 tp
+xori a3 s0 -1502
+addi ra x0 -809
+srli t1 t1 6
+srl s10 t3 t5
+xori s0 a6 -1289
+and x0 t3 a7
+srli s1 t0 17
+sub a7 s7 x0
+mulh t3 a6 t6
+slti s5 a3 1723
+remu t0 tp a6
+rem s8 t0 t1
+mulhu x0 a2 t5
+xori a1 a3 1576
+sll s5 x0 a2
+srai s7 s3 2
+divu a1 s7 s10
+xor a6 s10 a7
+xor s0 t4 s9
+slti s0 s4 1427
+auipc t3 886504
+sra t1 t5 ra
+srli s6 a7 7
+mul a0 t5 s6
+mulhsu s7 t0 ra
+lui tp 640096
+srl a7 x0 x0
+srl s9 s0 s4
+ori a6 a3 -1965
+and s0 a1 gp
+srai a7 s11 21
+srl ra t2 s1
+mulhsu t4 x0 s3
+xori t6 t5 -1113
+and a5 s1 a1
+remu s9 t6 tp
+srl gp s9 a5
+ori t5 t0 1281
+ori s0 s9 1490
+sra a3 a7 a2
+srai t2 t2 5
+sub s11 ra s8
+or a7 a2 t0
+sub s8 a0 a0
+sra t6 a6 s4
+div s5 s4 t3
+add s2 ra a3
+add s5 t1 a4
+add s9 a2 a7
+slti s4 s6 -356
+sra s5 t6 s7
+slti gp s6 1378
+xori s4 s0 -534
+divu s2 x0 a4
+remu a5 t6 a3
+slli s4 t4 26
+divu s3 a6 s2
+andi t2 t1 -619
+mulhu a7 t2 s1
+ori a5 a1 -839
+lui s0 164015
+or t0 s11 a7
+slli t2 a6 18
+and t3 t0 a0
+andi s2 s11 -478
+or a5 t1 a4
+slti s2 t2 -740
+xori a0 s1 166
+lui tp 911243
+srai a7 s9 6
+sltu s9 a5 s3
+remu t2 t5 s8
+slt x0 s2 a1
+slti t0 s5 13
+add s8 a7 s10
+addi t1 x0 -1928
+auipc t3 850309
+and t5 t3 t1
+auipc s7 532254
+div a2 s9 ra
+ori s4 gp 214
+mulhsu a7 a4 x0
+lui gp 986273
+and a5 x0 s11
+mulh a0 s2 gp
+sub a0 gp x0
+srl s5 x0 t2
+slli a4 a1 30
+mulhsu x0 a6 a3
+div t5 t4 t6
+div t3 s11 x0
+xor s11 x0 a3
+addi s3 s0 -1804
+mulhu a1 t6 t0
+sll s6 a4 t2
+slli s2 a2 6
+sltiu t6 t1 -555
+sll t0 t1 a2
+auipc s7 427234
+lui a2 19275
+andi s1 s8 -859
+slli t0 s0 12
+mulhsu s6 s9 a2
+div t3 t2 s10
+andi x0 s5 -1988
+mulhsu t6 s4 t6
+div ra ra t1
+slli a2 t5 8
+add a5 t3 tp
+sltu s7 s2 a2
+lui tp 548644
+or t4 t5 s5
+slli tp gp 26
+auipc s1 280111
+ori a4 a6 -1017
+xori s1 t6 1389
+sltiu t3 s1 381
+mul a4 t3 tp
+srli a0 t0 15
+sltu s10 tp tp
+add s7 x0 t4
+lui x0 18017
+slli tp x0 15
+lui s3 133272
+xor ra s1 s0
+xor a7 s7 a6
+div s6 t2 a7
+addi s2 x0 -1734
+srai a1 a7 21
+and a1 s3 a2
+sub s0 s5 s5
+or s5 x0 s2
+andi a7 s1 1010
+divu t0 t0 s2
+srl s11 s2 ra
+mul tp a1 gp
+slt s9 s2 s0
+div s6 t3 a7
+andi t6 a1 777
+mulhu ra t4 t0
+sll s1 s2 t1
+srli a2 a0 25
+sltu s9 s9 s2
+andi s3 s10 -1783
+rem gp a6 s3
+mulh s3 s3 x0
+div s3 a4 s2
+addi s2 t5 -1904
+mulhu t0 s9 s8
+sll a3 s7 t3
+mul s8 t5 s9
+lui t2 543738
+or t1 t5 t0
+remu t1 tp s11
+div t1 s10 s0
+addi s2 a3 -538
+mul s4 s11 x0
+and s6 a6 t0
+slti ra t0 -484
+mulhu s6 s3 s1
+and s4 a7 t1
+sub a7 a2 t0
+sub t1 s9 s7
+rem a5 s4 s3
+auipc t1 925380
+slli s6 a6 0
+sltiu t5 a0 -136
+or s5 a5 t2
+xori s7 s1 -1095
+sltiu s0 a0 -872
+ori s8 s1 -828
+xor a5 x0 gp
+and a2 t2 gp
+mulhu a3 t2 a2
+sll t6 s4 a1
+sll s9 t5 gp
+or t6 a1 t1
+srl a7 s6 tp
+ori s10 t2 -101
+and t5 tp s0
+ori s5 x0 -135
+mulhsu t2 a6 a4
+sll s8 s10 t2
+auipc s0 491320
+xori t4 s4 476
+sltu s10 s0 ra
+mul a3 t5 x0
+srai t6 t3 27
+sra a3 t2 s5
+mul s10 t5 s10
+and s2 a7 s4
+mulh s6 s2 t1
+xor a3 s7 s6
+sltu s6 s3 t4
+mul s7 s0 s2
+srli s9 s5 8
+slti s8 ra -992
+div s6 s5 s3
+mulh s5 s8 a1
+slt s1 t3 s4
+andi a3 t6 1524
+remu s10 tp x0
+and t6 s7 s7
+auipc s8 634821
+mul a1 a1 t6
+div s3 a6 s8
+ori t3 t6 -96
+remu s7 a7 a4
+divu t6 s7 t2
+mulhu t1 a1 t1
+srai s5 s9 0
+srl t0 a4 a0
+ori s0 t3 -851
+srai a4 a4 0
+mulhsu a0 x0 s1
+lui s7 671843
+ori s7 s4 1220
+divu a2 t5 s1
+sll s9 s10 t3
+remu a1 a4 a5
+sub s5 t0 s11
+srli a5 s7 31
+srl x0 t0 s1
+srai s4 a2 14
+xori t0 a5 301
+srl t6 a5 s6
+srl s3 s5 x0
+divu a4 gp s9
+xori t2 s6 -637
+mulhsu a6 t3 t6
+slt t2 s2 a1
+slti t2 s2 -1251
+xori t2 t5 2005
+slt s0 t0 s6
+div a2 t2 s8
+add s9 tp a6
+xori t1 a4 -741
+mulhsu s8 s10 a1
+or s3 a4 s11
+and s6 t2 s9
+slt t3 s0 s0
+xor s6 t0 s5
+sltiu s0 s7 126
+lui a7 423212
+ori s0 s0 -1927
+slli t5 t2 15
+sll s10 s4 t5
+rem x0 tp s9
+sub gp gp s8
+remu s1 t5 s4
+sub tp t3 tp
+slli t1 t0 3
+mulhu x0 a7 s1
+divu ra x0 t3
+divu t4 a4 s3
+mul a5 s2 t6
+remu ra a4 t3
+mulhu a1 s7 s3
+sub s5 s6 a7
+mulhsu s9 t5 t0
+lui a6 470649
+mulh x0 t4 a5
+xor t6 s0 t5
+xor s6 ra x0
+add s8 a2 a4
+sra t4 s7 a3
+divu a6 x0 x0
+sra a7 a2 a7
+slti tp s4 -1052
+slli s1 s1 12
+mulhsu tp x0 s1
+srli s9 x0 18
+sra a4 s5 s1
+mul s3 s5 s1
+sltu t6 tp t6
+mulhsu s11 x0 x0
+sra t4 a4 a3
+slli t1 s6 25
+slli tp s11 16
+addi s3 s9 1051
+srl t4 ra a6
+sltiu s8 s3 394
+slt ra t6 t1
+addi s5 s10 -53
+sra s7 t5 s0
+addi t5 a0 -280
+slli s9 s8 2
+sltiu s10 t6 -1071
+srl a4 s7 t4
+ori a3 t1 1142
+and t6 t6 gp
+xor t3 s6 t2
+slt s6 a6 s5
+mulh a5 gp s0
+ori a2 s2 -328
+lui s5 206502
+sll t4 s7 s0
+sll s8 a3 s1
+xori a6 s3 -1927
+mulhu s3 s7 s0
+mulh s2 s6 a0
+sltu s2 gp a5
+xori s3 tp -1769
+xor t4 s9 x0
+and tp s6 t1
+sub a2 ra s4
+mulhsu s0 t3 a1
+mul a5 a6 a0
+mul t3 a2 s11
+div s2 s0 s3
+sra s4 t4 t2
+addi t0 a6 600
+divu s7 s9 t3
+mulhu a2 s5 ra
+slti t0 s9 -390
+sub a5 gp x0
+sltu t4 a7 s8
+auipc a4 421838
+mulh a1 t3 s5
+remu s3 a6 t6
+slli x0 a7 23
+div s10 t1 a5
+div s6 a5 t6
+srai t0 t4 23
+lui a5 316778
+slt a1 ra tp
+sra tp t3 a1
+mulh a0 s11 s2
+slli s11 t2 2
+xori x0 s11 -87
+lui s2 456897
+sltu s3 t3 a3
+ori t1 s1 -637
+mul s1 t2 s2
+div s10 s0 a6
+add a0 s11 t4
+mul s9 a5 t6
+divu a2 x0 t4
+add s7 t0 s1
+srai t2 s1 11
+srl t5 a6 s7
+ori s6 gp -1070
+divu a6 s8 s1
+sll s2 tp t4
+srl t6 a2 t5
+and t0 a5 s2
+mulh s8 a7 a3
+sltiu a1 tp 1569
+srl s6 t0 a0
+lui s5 990491
+mul t6 t0 ra
+mulhu a6 a5 ra
+add s1 a5 t6
+sltu t1 a7 a3
+mul t5 a7 s6
+xor gp s10 s7
+ori ra s1 1986
+remu s9 t6 tp
+mulhsu s7 x0 t0
+mul t2 a2 s7
+sra a1 gp s3
+rem t0 s2 ra
+srl a2 gp t5
+sll s10 t1 s9
+mulh tp s7 s4
+mulhu a7 t3 s10
+sub a0 a6 s2
+mulhsu a2 s3 s9
+auipc t3 78312
+slt a7 s0 t2
+div t5 s0 s8
+mulh a0 s8 t1
+andi a2 a1 -8
+remu s5 t3 a5
+add s6 tp x0
+div t2 s8 t6
+rem t2 x0 ra
+sub gp t0 s3
+xori s0 x0 -1546
+div gp a6 s2
+slli gp a4 30
+srl gp s7 t3
+mul x0 s9 s6
+rem s5 t5 x0
+lui t5 1043829
+divu s3 s0 ra
+srli a7 s5 26
+sub s7 a0 a6
+sltiu t6 s5 643
+remu a4 s2 s1
+or gp s2 t4
+srli s1 ra 8
+srl tp t1 a5
+sltiu s3 a2 820
+sll t2 t4 s10
+mulhsu s7 s2 s2
+sll s11 s5 x0
+div t6 s2 s2
+add a2 a7 t3
+mulh a0 t6 s9
+rem t1 a2 a4
+mulhu s2 x0 x0
+srli s9 s0 25
+mul a3 ra t6
+xori s6 s7 -360
+addi x0 s1 -577
+sltiu s6 t1 1060
+sll a2 a2 ra
+andi s2 a2 1584
+sra a1 a4 a1
+slti s5 a1 -412
+mulhsu s0 t4 s7
+sltiu s1 s5 1352
+sub s1 a1 s11
+mulh s6 tp s4
+addi s6 t0 1734
+sltiu s7 s9 1474
+rem gp gp t2
+xor t3 a5 t5
+or a2 t4 s5
+div a3 s0 s7
+addi t3 a4 -1373
+remu s2 s4 s8
+lui x0 343949
+sll s1 a1 s3
+sub t2 t3 s2
+xor a2 a7 a1
+remu s0 t6 s7
+or t6 s9 s7
+rem t1 ra s2
+sll t1 t0 t2
+sltu s4 a2 s0
+addi s4 s3 355
+mul t4 a7 s9
+add s0 s3 s7
+sll a7 a3 s11
+andi t2 s3 536
+slti t5 s4 -1223
+mul s6 a0 ra
+slti a3 s4 -188
+addi s2 a1 -1569
+mulh x0 x0 s1
+remu t2 s8 s4
+ori a2 s6 1171
+sltu a0 s6 a5
+mulh t2 s5 t4
+slli x0 s7 20
+srai s0 t2 12
+mulhu s1 t1 s10
+mulh x0 x0 t4
+sltiu ra a5 1448
+andi t0 a3 702
+ori a1 t0 1233
+andi s4 t2 -1545
+div s0 a6 x0
+add t2 s11 gp
+and t4 s3 x0
+div tp t6 gp
+div t4 t0 s0
+ori ra s9 122
+and a1 s7 s0
+sra s9 s0 t0
+auipc t3 777712
+sltiu a3 x0 1858
+divu a4 t5 a7
+sub s8 tp s11
+srl x0 s6 t2
+srai s4 s6 23
+auipc t5 885936
+div a0 t6 a4
+xori t3 x0 -738
+remu s6 x0 gp
+mulh x0 t4 a7
+andi s0 a2 -805
+div a3 s8 a7
+ori tp a6 -1267
+add s6 s0 a1
+ori a4 s1 -1768
+or s3 x0 t1
+slt a6 t6 x0
+srl s1 s5 s0
+sra a3 s5 t5
+sub a2 s4 t5
+sll a4 s4 t3
+mul a6 s10 s4
+sltiu x0 t2 -626
+or t2 s8 s11
+auipc a7 38798
+sub s8 s4 gp
+mulhu s6 t4 a1
+slli s6 s0 28
+or ra s1 s6
+addi a2 t3 -1503
+slt s8 a0 a2
+sltu t0 a6 s9
+or s7 a2 a2
+divu x0 s3 tp
+sll a5 a5 x0
+ori t1 s7 -1782
+and a4 s1 t0
+mulh s9 a7 s11
+sltiu t2 t1 -285
+auipc s9 679048
+srl s6 tp a6
+lui t6 412748
+mulhsu a6 a5 s0
+add s3 a5 gp
+sub s3 t1 s6
+rem s9 t2 s0
+xor s2 s10 a5
+sll x0 t6 s7
+divu s6 t4 s8
+slti ra s3 1085
+slti t4 t0 -997
+addi t3 s9 -1929
+slt s2 t0 a3
+srl a5 s0 s11
+xori s10 a5 -808
+sra s3 s6 ra
+sltu t6 s5 t3
+addi x0 gp 691
+ori t5 s11 -466
+rem s1 a3 t3
+remu x0 a4 a6
+lui s9 651969
+mulhsu gp t0 s6
+srl s8 s0 s4
+slti gp s9 869
+mulhu s11 a5 a4
+mulhsu s1 s6 a0
+srl t4 t2 a6
+srai a3 s11 14
+slti t0 s7 316
+mulhu x0 t0 t5
+slli a6 s10 5
+div t3 a1 a2
+andi s1 a5 -1433
+mulhu s10 t5 t4
+xor a1 s1 s10
+sltu s0 a3 gp
+remu a7 a4 a4
+slli t2 a4 19
+xori x0 tp -253
+sltiu a1 t5 138
+divu ra t1 a1
+remu a3 s5 s11
+mul s1 s0 t1
+mulhu s5 s1 s6
+slti a7 a3 -1626
+slli t0 s3 12
+xor s8 a5 a6
+slli s7 t4 6
+andi s1 a5 -1812
+or s1 s5 s3
+add t0 t3 s3
+or a3 s0 s2
+sltiu s0 s6 -14
+xor gp s7 x0
+slli s5 a0 24
+sub a4 a3 s6
+div tp t5 s7
+rem t6 x0 t3
+addi s6 a5 -207
+remu gp ra x0
+xori t6 ra -606
+and x0 s9 a3
+andi t5 t5 -1131
+sub s4 a1 a2
+srai a6 s4 10
+slt t4 a0 t2
+sll t1 a3 s2
+div t6 a4 a4
+sltu a3 x0 s10
+srli s5 s9 1
+mulh s6 s2 s9
+sll t2 a4 gp
+div s4 ra a6
+remu a7 a3 x0
+and s10 ra a0
+or t6 gp s9
+mulh s5 s8 a1
+rem t5 t6 gp
+sra t5 x0 a3
+and gp s6 x0
+remu s1 t3 x0
+sub a7 a0 ra
+addi a0 s1 -1524
+xori a6 a0 -1181
+mulhu s4 a6 a3
+auipc s1 584734
+xori a0 s1 773
+xor x0 a0 ra
+add s1 s11 t2
+addi t0 t2 59
+mul t0 t0 a7
+mul gp s1 s0
+srai x0 a4 29
+srl t1 t2 t0
+andi s9 a3 -247
+rem t0 s10 a0
+sra s4 t5 s3
+srli a6 a7 1
+mulh s11 s5 s9
+mulhu t4 s8 a6
+divu s4 x0 tp
+auipc ra 370398
+add a5 s10 a6
+xori s10 tp -910
+add s3 a4 s2
+auipc a0 1036809
+srai s7 x0 20
+mul x0 s0 s10
+add s7 a7 t3
+auipc s4 590448
+lui a5 75391
+sll a3 s6 a1
+slti s10 s3 -1658
+remu a1 s7 t5
+xori a3 t3 991
+srai a2 tp 8
+mulh t4 s8 a4
+andi a3 x0 -631
+mul ra a6 ra
+xori s2 a7 -497
+div s8 a1 a3
+div a1 a7 a7
+xor s10 s5 gp
+div a1 s4 s0
+sltu a0 a1 s9
+auipc s11 199505
+mul s6 s9 a0
+sltu s9 a0 s10
+andi a7 t4 -1680
+add s9 s1 s0
+add gp t4 s3
+or a5 s5 x0
+ori a4 s8 -668
+mulhsu s11 a1 t2
+srai x0 s6 5
+divu x0 t4 s11
+srai a2 s2 31
+and s3 s5 s3
+mulhu a2 s3 a2
+slt s8 tp s0
+srl a6 t3 s3
+divu t2 a6 a7
+rem x0 a5 t0
+add t1 s0 a6
+div t3 s6 s5
+mulhsu s9 s3 gp
+rem a3 s3 ra
+rem s3 a3 t2
+srli a7 t1 9
+slti tp x0 406
+slli ra s6 3
+mul a7 a4 s7
+rem t2 s8 s4
+mulhu gp a2 tp
+mulh t1 s4 t3
+or a5 gp s6
+auipc s8 529041
+mul s11 a6 a0
+or t1 s5 t5
+or a2 ra tp
+sra a4 a5 s6
+ori s6 t0 -528
+mul s2 s10 s7
+ori s4 s9 1313
+rem t1 a4 s8
+mulhu s7 s8 a7
+sltiu gp a5 -761
+div t6 t2 s0
+sub a2 a2 t2
+mulh s11 x0 x0
+xori s7 t0 556
+or gp tp t2
+slt gp s7 a4
+slti t0 s2 -775
+mul a4 t3 a6
+andi x0 x0 414
+srai s8 a1 6
+and t2 a0 a5
+lui s9 807900
+ori t6 s10 -1067
+srli a0 s6 28
+sll a2 s2 a1
+and t2 x0 s5
+rem t1 a5 ra
+mulhu tp tp a1
+mulh s10 s1 s1
+sll t2 a0 s6
+mulhu a0 s11 a7
+add t6 t6 s9
+sll x0 t1 a5
+mulhu t5 a5 a7
+sltu t0 s8 s2
+auipc s9 501561
+mulhu s8 s7 t0
+mulhsu s9 ra t5
+auipc tp 790802
+ori s2 s4 80
+div a3 t5 a4
+auipc t6 89111
+sltiu x0 ra -1500
+srai t6 t0 31
+xori x0 a4 -1399
+or s1 s9 s4
+ori s11 s7 -1561
+xori gp a6 -744
+ori ra t5 -1198
+slti a4 a6 -181
+xor t5 a1 s7
+sub t0 a3 s2
+and x0 s4 s3
+remu a7 t0 ra
+xor s3 a6 a1
+slt s4 s10 a7
+sltiu a6 s10 -1794
+srai s5 s0 1
+divu s6 s8 a6
+slt s6 gp s1
+srli s9 a2 2
+lui s2 580915
+srai s3 s10 26
+sub s4 s6 s6
+slt s5 s9 s1
+sltiu t5 s7 358
+addi a4 s5 -1106
+mulh x0 t6 s9
+or s2 s1 a1
+srai t6 a0 11
+mulhu t5 t0 a5
+sll t3 ra s5
+slti s11 t1 1824
+xor a0 s3 x0
+andi a1 s10 854
+mul s6 a3 t0
+andi s9 a3 2008
+mulhsu s2 gp s6
+slti t6 s4 1482
+lui s2 432217
+sub s6 t0 a3
+sltiu s1 t6 -50
+remu s6 t4 tp
+add a7 s1 s3
+remu a7 tp a0
+xori s2 x0 -964
+add t0 t4 a4
+addi a1 s11 -1181
+sll t5 s3 t2
+remu a5 a0 t2
+div s1 a3 t6
+xori s4 s7 -908
+add t3 a6 t3
+srai s1 t1 18
+ori s4 t3 -660
+sub a4 t3 a3
+sltu t3 x0 a3
+ori a3 t4 -1994
+div ra t1 s0
+srl t2 s0 a1
+mul s4 t6 gp
+srli a7 t4 28
+divu t0 a7 a4
+sltu gp s1 a4
+lui s3 966035
+sub s3 a4 tp
+sltiu s7 s2 1164
+auipc s4 823373
+sra s7 s5 ra
+or t4 t3 a5
+mulhsu x0 s9 a2
+and x0 x0 a7
+sltu s9 t0 s3
+mul t0 s7 gp
+srl t2 a5 gp
+div s1 a1 t4
+slt a5 s0 s3
+or tp t2 s2
+xor s1 s0 s11
+srli a5 s4 2
+remu s2 a0 s4
+and a5 t2 a1
+divu a7 s1 x0
+or t0 a2 a2
+or t0 s6 s5
+rem s1 s7 s10
+sltiu s11 gp -913
+ori x0 x0 1594
+auipc tp 220438
+sub t1 s8 s6
+xori a2 s10 -1500
+and a3 s9 s9
+addi t4 a3 -695
+mulhu s5 ra s0
+mulhsu s10 a5 t0
+add t2 t6 s7
+or ra s0 gp
+sll a0 t4 s1
+auipc a3 985494
+slli t5 a4 16
+sltiu s0 t2 2043
+mulh a4 a0 s6
+and s0 s7 s0
+mulh s3 t4 t3
+div s3 tp a5
+auipc a1 192018
+srai a3 a2 21
+mulhsu s0 ra a1
+xor s11 ra a7
+sltiu s2 s2 -1111
+srai t0 gp 31
+mul s5 x0 a3
+rem tp s3 s1
+add s6 t6 s0
+xori t6 s11 1082
+rem a7 x0 ra
+add t1 t1 a4
+slt tp t2 x0
+srl a5 tp s4
+lui a6 81389
+mulhu t6 s7 x0
+div a6 s6 a7
+divu t1 t2 a5
+slli x0 s11 15
+slt gp a6 a1
+and ra s0 s1
+xor x0 a4 a2
+rem s8 s6 s7
+mulh a1 s9 a0
+mulh s0 a2 a3
+and t4 s11 a5
+andi a2 t2 -1801
+sll x0 s10 a2
+slti gp x0 605
+srl s7 s10 s9
+and t6 a0 s4
+srai s5 t5 19
+slli a6 a1 4
+lui t1 859098
+div gp ra s3
+div x0 t0 t5
+andi s4 t2 -1710
+srl s4 s11 ra
+mulh t0 a7 a5
+divu x0 a3 a1
+xori s4 s3 -528
+divu tp t0 s9
+sltiu t2 t6 -1789
+or tp t1 a2
+sra t4 x0 t5
+and s8 gp gp
+sltiu s9 t2 -59
+auipc t4 970634
+or s0 s1 a2
+add s0 s1 s5
+sra a7 ra a1
+sltiu a0 s6 -535
+sub s0 t4 s11
+srl t4 s0 t0
+addi s6 a4 -1393
+sra a5 s1 a3
+ori t3 s10 1057
+and x0 tp a0
+sra s11 a4 a7
+divu a7 t5 a4
+sra tp t3 a0
+slt a4 a4 t3
+xori tp a5 1860
+div a6 s8 a3
+sra t3 t2 t5
+srai t1 a1 16
+auipc tp 485030
+remu s2 tp a1
+ori ra s7 -1743
+or t0 tp t1
+sltu s5 a7 ra
+xor s7 a5 s8
+slli a2 a1 1
+srli s9 ra 1
+div s1 a5 t6
+slt ra s1 a2
+slt t5 s5 x0
+and s10 s10 s6
+sra t4 t6 a5
+slti x0 s0 700
+sltiu s9 tp -59
+divu a1 a2 s4
+slt s11 s10 a3
+mulhu tp a4 s5
+ori t5 s8 -1584
+lui s9 720746
+sll s7 s3 x0
+mul t3 a4 s2
+srl s5 s8 gp
+remu a1 s8 a1
+and t5 a3 s8
+ori x0 tp 1559
+add a1 s3 s8
+mulhsu s6 s5 x0
+xori s0 t2 -1868
+sra t3 a5 s4
+mul a7 s7 t0
+sub a2 s9 t0
+rem gp a7 s7
+mulh a7 s1 a0
+srl s10 gp s2
+lui s4 988205
+slt a1 s9 tp
+auipc a4 28952
+sra a2 s5 a0
+mulhu a7 s5 s1
+divu a7 t2 a2
+srli t3 s6 3
+sltu a0 x0 t3
+sub ra a4 x0
+srli s9 a4 1
+rem s11 s11 t3
+xor s1 a4 t4
+xor s2 s4 a3
+xor t5 a7 s3
+or a2 a4 ra
+divu s5 s0 t1
+slli s11 gp 26
+srai tp x0 17
+xori t4 t3 -211
+srai s6 a1 5
+rem t2 a5 ra
+mulh t5 a5 a6
+slli a3 x0 24
+xori ra x0 -1140
+divu t5 gp a2
+slli s1 t1 8
+mulhu s2 s8 s6
+andi ra s9 -1038
+srai x0 s6 4
+sll ra s5 t1
+divu x0 s7 t1
+or t3 s1 a7
+ori t0 s9 -1927
+add t6 s4 s6
+sll s7 s4 gp
+auipc gp 720348
+xori t3 a1 -192
+and x0 t6 s4
+div s4 a6 s10
+sltiu s4 s5 -1106
+div s11 a0 a1
+srl s8 a2 t5
+addi t5 a5 -679
+sltiu ra s2 -1188
+srli s11 x0 10
+slti s11 t1 -1933
+mulh s8 t0 s10
+slli gp x0 25
+ori a4 s0 692
+ori tp s8 260
+sltu a7 a0 a1
+sltiu a0 t3 1098
+remu s5 t2 t2
+slt a1 x0 a4
+and t6 gp a4
+xori s8 s1 -401
+or a6 t4 s6
+addi s1 t4 -1996
+xor a4 s5 a7
+add t4 a7 a3
+sra a3 a5 a7
+auipc s5 754075
+auipc t2 344545
+andi s1 t0 -1144
+sltiu a6 s0 -1614
+sll x0 a5 t5
+xori a2 s9 -312
+sra s4 a1 a3
+srai s6 a1 15
+slti s0 a1 1109
+sub a7 s10 s10
+div s9 x0 a5
+sltu s7 t1 s4
+slt t6 a1 s11
+xori gp s5 971
+slt a1 s3 a7
+mulhsu gp s10 s5
+xor s11 a6 s0
+srli gp t3 8
+add gp t6 s1
+sltiu t3 ra 213
+div a4 t1 s1
+mulhsu a5 a6 s4
+srl tp s1 a4
+ori x0 s5 -850
+mulh a1 s8 s6
+mulh a2 s4 x0
+sltiu s9 a6 1692
+xori a5 gp -45
+sltiu t0 a1 -1329
+sub tp s0 gp
+sub a3 s5 gp
+slt a5 a2 s1
+mulh t2 s1 s11
+xori s5 t3 1197
+slli tp s1 23
+sra a1 a4 a7
+auipc a0 136140
+and a2 s4 a5
+xor x0 s5 x0
+slt a0 a4 s11
+xori t0 t3 39
+sra a4 t4 a2
+srai a0 s0 9
+add gp a2 s7
+or s4 a5 s9
+xori t3 x0 -1540
+slli x0 t4 5
+sub tp s8 t5
+sub ra s9 a0
+remu s4 s4 t0
+mul a7 t1 t2
+remu a2 ra s10
+mulhsu s9 s5 s6
+mul tp s0 a2
+remu s8 x0 t2
+slli a6 a3 14
+mulhu s5 x0 t4
+srli t1 ra 30
+sll s3 gp a4
+xori s7 x0 -1402
+sub a6 s7 s6
+xori t5 s5 1445
+sll s2 s6 a1
+rem a3 t0 s9
+mulhsu ra s7 s3
+srli a0 a7 23
+slli a6 a6 27
+xori a1 t5 1803
+mul ra t2 s7
+mulhu t2 a4 a7
+slli s10 x0 5
+addi s4 t0 -1807
+slli t2 s4 30
+ori s6 a6 -864
+srl s10 tp s11
+add t4 a5 t6
+auipc a0 124875
+and tp s0 s5
+sltu a5 ra x0
+div tp gp s3
+div s0 t4 s8
+sub s2 a3 t4
+srl s1 s5 s9
+srli s8 t2 14
+mul a3 s3 s5
+sltu s8 a1 s7
+sltiu s0 s7 -774
+xor s9 a4 t0
+divu t3 t3 s4
+srai a4 s7 7
+mulhsu tp tp a7
+xori s11 s1 1688
+srl a6 s0 a6
+xor t6 s10 ra
+divu a5 x0 s10
+srai t2 s1 16
+sub a7 s11 a6
+sltu a5 t6 a0
+sltu x0 a1 t5
+mulhu t3 s4 x0
+xori x0 x0 168
+mulhu t6 t3 s3
+sll s7 a0 s1
+slti s9 s11 -657
+mulhu a7 a7 x0
+sub s4 x0 s7
+add s4 t0 t2
+mul t0 s7 a7
+xori s5 t3 -1927
+lui a3 982235
+xor s3 s3 ra
+mul t0 tp a7
+remu t3 x0 a7
+sra a6 t1 ra
+slt s11 a3 s1
+ori s8 t1 -351
+slt s4 t4 t6
+and t5 a4 a1
+mulh s0 s1 x0
+andi s8 a7 -1679
+xor s2 s10 a4
+sra a0 x0 t0
+slt s6 t1 t4
+mul t5 t0 s10
+auipc t1 998839
+lui s10 432255
+div s10 t2 a5
+lui ra 952477
+auipc t5 149999
+sub a4 s6 tp
+divu t4 s0 ra
+sll s2 s6 x0
+xori t4 x0 366
+lui s5 269336
+or a4 x0 s7
+mulh s3 t5 s9
 add s10 a1 a4
-add s3 s10 t3
-mulh s11 a0 t6
-mul a1 x0 s8
-srl t4 a3 gp
-lui a4 417454
-and s9 t6 a7
-addi tp s8 -675
-sra gp a5 t2
-xor s11 a0 s9
-sub t0 a3 s11
-mulhsu s4 t5 t5
-remu s8 t5 gp
-sll t6 t4 t4
-sub t3 t4 a2
-remu s1 t0 a5
-mulhu a3 s4 a7
-slli a5 s5 7
-srai t6 a2 11
-srai t0 s5 19
-xori s4 s3 -821
-lui s1 368832
-rem a3 a3 t5
-andi s5 t2 310
-srai t6 s3 27
-auipc s3 402920
-sltiu x0 t0 -1134
-slli gp s0 15
-add a0 a5 s2
-andi a7 a3 -35
-sltiu a5 s10 695
-srai s3 t3 6
-srl s2 a1 s8
-srai s9 ra 29
-ori a7 a1 -563
-mulhu a2 t1 gp
-xor a3 s0 tp
-remu x0 a2 t4
-add a6 a3 s4
-slti a3 t2 -1860
-mulh s5 s1 t2
-addi s6 s6 1903
-div s5 s10 tp
-sub s2 a4 t1
-srli a1 s4 29
-and s1 s2 s4
-ori a4 a6 1563
-srai x0 s9 8
-slt s3 s7 s9
-mul a5 s4 s6
-andi s7 s7 -1895
-auipc s9 89064
-addi t5 s1 1712
-mulhu t1 a2 s1
-div a3 t0 x0
-slli s2 a2 19
-slli s2 s7 12
-srl t0 a1 t1
-mulh gp s2 t4
-and tp ra a0
-and a2 t3 a0
-sub s0 s2 tp
-remu s2 t2 tp
-ori s10 t3 1145
-mul a5 a4 ra
-rem t6 s11 s9
-srl a3 gp t4
-slli s11 ra 25
-sltu s4 s2 s6
-sub t3 t2 gp
-xor x0 a4 s4
-srli s10 s11 26
-sll ra s9 s5
-sra a1 s6 s8
-xori s8 x0 596
-or t5 s10 ra
-divu a6 x0 s7
-slti s4 t0 -491
-xori t1 s9 324
-slti s11 t1 1993
-sltu a1 s8 s8
-srli ra a7 30
-remu t2 a0 a6
-add t0 s1 a2
-slti a7 ra -358
-sltiu t2 s7 -792
-auipc a2 112097
-auipc t2 518428
-mulhsu s11 s8 a5
-or s1 a1 t2
-mulhsu t5 a7 t3
-remu s7 t5 a1
-divu s10 t2 s1
-lui a2 960835
-and s11 ra a6
-sll s3 a5 a4
-slt a2 s8 s10
-mulh a3 s8 a7
-srl tp s0 t2
-and x0 x0 a6
-remu s1 t6 s0
-divu s2 a3 t5
-sll x0 a1 x0
-srl s2 a7 a3
-ori a4 s1 -1857
-div ra gp a1
-or gp t2 tp
-sltu a1 a5 t0
-auipc t5 180889
-div a4 tp s11
-mulhsu a3 a0 s9
-lui t1 890778
-remu s5 t3 x0
-addi t4 s2 39
-mulhu a7 s3 s9
-mul t1 s7 s11
-slti s10 t4 -438
-div a7 s11 a5
-xori gp s10 -60
-mulhu s9 t5 s11
-rem s1 s3 s7
-ori a5 a1 -366
-div s1 s8 s10
-rem s2 t0 s11
-divu a3 a5 t4
-sub ra s3 s2
-addi t0 t3 -1600
-slt a6 s1 x0
-addi s2 a4 1391
-div ra s11 s1
-mulh a3 a4 t6
-sltu x0 t2 s9
-srai t0 s4 17
-sltu s2 x0 s7
-sra s7 a0 a4
-or s7 s1 a4
-add s4 a5 ra
-lui a6 1022375
-and a5 t0 a1
-sltiu t4 a4 1752
-auipc s2 168980
-div s11 t2 x0
-slt a2 t6 t4
-andi s2 s2 -312
-xor t1 t6 s0
-sra s4 t1 s2
-ori s6 gp -687
-xori t3 a2 1333
-sra s0 a0 x0
-sll a1 s10 t4
-ori s4 a5 -1266
-sub a2 s6 s5
-mulh s11 t5 t4
-srl t4 s5 s11
-slt a5 tp s1
-slt s10 a0 s2
-sltiu a4 a0 -872
-divu a6 s10 a6
-lui s1 184064
-sub s3 t0 t3
-mulhu s6 a4 t4
-xori s9 s5 -206
-divu s11 t6 s6
-and t6 x0 s11
-mulhu s6 t5 s5
-sra x0 t2 ra
-mulh s4 ra s10
-rem s4 s3 t3
-mulhu t2 a0 s1
-andi a4 tp 67
-and s6 s4 t3
-xor x0 s4 t4
-srai s8 t4 12
-srai a3 t5 20
-slti s9 s6 -725
-mulhu a1 t2 s1
-mul s1 s4 x0
-sltu ra ra x0
-ori t3 x0 -635
-sltiu a7 a1 1886
-xor x0 s6 s11
-div gp tp a4
-remu s2 a3 a5
-slli t2 t1 2
-slt a4 gp t0
-srai a2 t6 26
-xor t2 a6 s6
-sll s7 s7 a2
-auipc a1 57901
-mulh s7 t3 s11
-andi s7 x0 -1325
-or s9 a6 s6
-sub s5 s3 a5
-rem s2 s3 s3
-slti a5 ra -156
-xor a3 s0 t3
-slt t6 tp t1
-srl s1 x0 s1
-srli a5 s8 21
-sltu s10 s11 s3
-ori tp t3 383
-lui a1 180331
-remu t4 t2 t6
-rem t0 a7 s11
-srli gp s0 21
-rem a4 x0 ra
-sltu a7 s3 s10
-add a1 a2 s7
-div s1 a6 s7
-sll t6 x0 ra
-srli a1 s1 18
-mulhu t3 x0 t3
-mul tp a7 a7
-xori t6 t6 -2036
-lui s0 762730
-srai tp t3 5
-div s2 s7 t1
-sll t0 s11 a7
-divu a4 a7 t0
-srli a5 t1 20
-or a2 a4 a5
-andi x0 s0 705
-slli t4 s2 4
-xor a4 a5 s3
-or s0 t6 s0
-addi a4 t2 1688
-sll s6 gp s4
-srl s7 s8 t5
-div t4 s4 a7
-div ra s9 a5
-rem s1 x0 gp
-sra s9 t2 s6
-sub a4 t1 s4
-xori t6 s2 -1280
-ori a4 s9 206
-divu s11 a3 s1
-or s9 s9 s10
-divu a1 t5 a3
-andi t3 s0 11
-sltu s7 s4 s10
-or s2 s1 a5
-sltiu a4 s0 -619
-divu s0 t1 s6
-xori s6 s4 -1784
-slli s3 x0 8
-auipc s9 259853
-divu s7 a5 s0
-mulhsu a7 s0 s5
-srli tp s10 19
-xor t6 s1 s10
-sra a6 t0 a1
-andi t0 x0 -1535
-mul a1 ra x0
-slli x0 s4 25
-srl s5 a3 x0
-div t5 tp tp
-mulhsu t6 s6 t2
-xori ra t2 -757
-addi t6 s2 1608
-divu a2 s4 s2
-remu a6 s0 t0
-sltu s4 a1 a4
-andi s1 tp -1082
-remu s10 x0 t2
-divu t6 a2 a0
-sltu s8 s10 x0
-mul t4 t0 a4
-sub a7 a3 s1
-xor t4 s6 a0
-slti tp a7 596
-slti s11 a0 -1396
-srai a1 s11 7
-add s1 t3 s2
-sltu a4 s11 t0
-mulhsu s9 x0 a5
-sra a5 s4 t5
-srai tp s0 11
-andi s10 tp -1137
-mulhsu a4 t3 x0
-lui x0 151541
-sra x0 gp a2
-mul a4 s3 s2
-addi a6 s9 -564
-addi t0 a5 1051
-slli a5 s8 27
-sll tp s9 t2
-mulhu s9 s8 a3
-srl s11 s9 s0
-slt t5 a7 t5
-xor s2 a5 t2
-ori a1 t3 87
-add s11 ra gp
-srli s5 t6 6
-slli t5 a2 4
-sltu a0 s3 s10
-sltu a0 a7 s4
-slt ra x0 s10
-sltiu s5 s7 1577
-addi s9 t0 -253
-sll x0 s4 a2
-mul a3 t3 s6
-slti s1 gp -740
-slti s1 t5 -1259
-auipc s2 179728
-auipc a0 125273
-sub t5 a7 s11
-sra s8 tp s9
-slli t2 x0 14
-sltiu t6 s7 -892
-xori s11 a0 -1751
-sra a3 gp s1
-xori s1 a0 -512
-slti a6 t2 -270
-sltiu s3 a0 -158
-sub a7 gp t0
-addi s2 t3 -93
-mulhsu t3 gp gp
-and s1 s3 a5
-ori s2 s6 -225
-sra s7 s10 s0
-sll a3 tp t0
-lui s11 229274
-srli s10 s8 12
-mulh t2 a3 gp
-slt s8 a5 a5
-xor a7 x0 s10
-slli s10 s2 6
-divu a2 ra s10
-mulhsu a3 s11 s5
-mul t4 a3 t4
-lui t4 447030
-rem t2 a5 a3
-mul s4 t5 s7
-slti a2 ra -1758
-andi t2 t0 -685
-mul t0 s1 t3
-sltu tp s6 t2
-rem t1 s4 s8
-srai t6 tp 22
-add s0 t2 a2
-div t4 t5 a7
-srli s0 s11 29
-xori s8 a0 -1408
-sub t1 t4 s8
-add a7 s1 s1
-slti t2 s8 -1817
-srli s2 x0 5
-addi s11 a0 -5
-lui a6 753281
-sltu t3 s0 s10
-sra t2 s2 s11
-sltu a3 a4 a1
-sltiu s11 s9 2026
-ori a4 x0 -1864
-divu t3 t2 s1
-slti t6 a6 -1252
-sll x0 s3 x0
-lui t1 814731
-srli a5 s4 9
-xor t4 s10 s0
-mulhu t2 t3 s5
-addi a7 s0 1569
-srl t3 s7 a2
-srl s0 s4 a4
-mulhu s3 s9 a7
-slt x0 a1 a6
-srai s9 t1 11
-lui s3 672473
-rem s2 t1 a7
-remu t3 x0 s1
-add t5 s1 a4
-mul s3 tp s9
-andi tp s5 -1182
-auipc a3 977373
-lui x0 845721
-xori t5 a2 -164
-and s4 t0 t3
-mulh t2 a2 a6
-srai ra s1 8
-sll s9 t4 a7
-xor x0 a0 a3
-lui a1 255943
-add gp s3 s3
-sltu a4 s4 t0
-sra t0 a7 tp
-xori t0 t6 -404
-srli tp s0 9
-sltiu tp s0 725
-mulh s8 t2 a0
-mulhu a4 a6 s8
-addi a2 s11 -1734
-addi a3 tp -897
-sltu s4 s4 s9
-add x0 x0 t6
-divu x0 s0 s1
-ori a0 x0 -1596
-mulhsu s3 s2 a4
-srai a1 s11 19
-sra s10 a5 t4
-sub a3 ra a1
-add a4 a6 a5
-lui x0 858551
-sll s3 t4 s8
-srl ra t3 s1
-srli a0 t3 26
-mulh a2 s1 a7
-sll t5 s2 s4
-sra t0 t2 a0
-srli t0 s0 8
-mulhsu t2 a5 a1
-add a0 gp x0
-sll t1 gp s2
-lui s5 1002140
-slli a2 x0 30
-sub t2 x0 s2
-srl s5 t3 t4
-sltu t3 s2 a1
-remu t6 a0 s9
-add s5 tp t1
-and s4 a3 t0
-slt t3 a3 s6
-mulh a6 t6 t2
-div s4 s8 x0
-and t2 a7 s6
-sltu a1 gp s8
-srai t5 a1 15
-slti tp x0 -1956
-auipc s1 7490
-slli s10 x0 26
-mulhu x0 t6 a6
-andi a5 t5 -803
-remu s9 s3 ra
-rem s5 s7 t4
-sub t4 s2 s2
-ori s10 s4 -980
-xor tp t4 s5
-lui s3 694519
-add t6 t1 s8
-mulhu t2 a7 s6
-sltu s7 t4 s5
-sub s5 s5 x0
-xor a3 s6 ra
-addi s7 s0 437
-mulhsu gp s9 s2
-mulhsu x0 a2 s6
-sltiu a7 t3 1969
-xor t5 s5 s10
-slli s2 s1 7
-rem a1 a5 s9
-lui s11 684448
-sll s10 a5 s10
-slt x0 s3 s5
-div t0 x0 t5
-addi t3 t5 1081
-andi t0 t0 -2011
-srl t6 a7 s9
-rem a3 s9 t0
-div a2 s4 a6
-slti a3 a3 -1124
-sub a1 a1 s1
-add a6 a0 s2
-xori a5 a6 1843
-divu a5 a5 a0
-xor s4 t4 t4
-slti s2 a5 -132
-div a0 s7 s6
-and tp s9 t5
-sll a7 a5 s11
-remu s6 a4 s10
-sltiu a0 s8 1864
-mulhu s7 t2 a6
-mulh t0 s11 ra
-srl a7 tp t3
-srl s11 a4 a1
-rem t4 s8 t0
-remu ra s10 t3
-divu s10 tp a1
-auipc s2 579218
-mul s3 t2 x0
-slt x0 s11 s1
-mulhsu s0 s7 s10
-slli s11 a6 15
-srai x0 a7 18
-or s9 s5 s1
-addi a0 x0 -785
-sltu a0 gp t5
-andi s2 s11 1066
-srl a6 s3 s1
-slti t3 t3 1645
-mulhu t2 s8 s1
-div a6 t1 s5
-mulhu tp s5 t4
-mul a0 a7 x0
-sub t3 s2 x0
-slti a4 t6 84
-remu s3 t2 t2
-sra s7 s4 t1
-rem s1 a7 t0
-add ra t6 a6
-mul t3 s10 s5
-add s10 x0 gp
-rem s7 a3 s1
-remu s2 t2 x0
-divu s9 a5 gp
-sll s5 t2 s0
-ori x0 t3 790
-rem t2 a1 s8
-sltiu t4 s6 -908
-lui t1 997508
-andi a4 a6 -1624
-rem s11 a4 a1
-slli a0 t6 26
-mulhsu s9 s5 a6
-sub a4 s8 x0
-xori a5 t1 843
-mulhu t6 a4 a2
-sra t4 s6 ra
-sra a2 a5 s7
-sltiu s9 t2 96
-lui s1 226569
-xori a4 s0 -1893
-sltiu s10 a5 1925
-addi s8 s1 -2032
-sub t5 s0 t3
-mulhsu a5 s2 a5
-mulhu t6 x0 gp
-mulhsu tp t0 t1
-mul s2 a6 a7
-lui s8 145596
-mul t0 s10 s7
-mulhu s6 x0 a5
-srli a2 a6 4
-sltu a7 a7 tp
-srli x0 a6 4
-srl a2 a0 a4
-xori s10 s3 1024
-slti s8 t1 -519
-remu t1 s5 s10
-mul s4 s8 t2
-lui s1 129196
+and s0 a0 a2
+or t3 s4 s4
+and x0 s6 s7
+div s2 s10 s3
+sra s2 a2 s9
+mul a2 a4 s3
+mulhu ra t6 a6
+div s1 s8 tp
+lui t4 125275
+sltu s7 x0 t1
+auipc t3 938855
+sra s6 t2 t3
+slti s7 s9 1983
+srli a1 s1 13
+xor t2 ra t1
+divu x0 t5 s8
+srli t3 s0 2
+srai gp s9 12
+ori a0 s3 1955
+ori a3 s5 924
+sltiu a6 s7 1167
+ori a7 t2 1244
+mulhsu t4 s9 a2
+div a6 s3 a1
+lui a5 429758
+sltu a3 t3 x0
+add x0 x0 s1
+divu s8 s8 t0
+srl s10 gp t4
+mul s0 s7 s3
+mulh s5 x0 t3
+xori a5 ra -476
+srai s2 a2 27
+lui t0 284834
+or a1 s2 a3
+mulhsu s8 tp t5
+srai s9 s9 7
+div t1 a0 t0
+or t2 s2 t0
+ori s8 t2 -1411
+xor tp s0 t0
+or a0 a2 s9
+addi a0 s10 -930
+xori t4 a0 -1264
+addi s10 a3 -1880
+addi s6 a0 -1676
+srai s10 a6 16
+addi s9 t3 -437
+auipc s7 568859
+add a7 s10 t1
+auipc s7 262024
+srli s10 a1 29
+slli a0 a1 8
+srai s11 s6 0
+andi s6 t6 -1892
+slti t2 a2 -194
+or t5 s7 a5
+mulhu s10 ra x0
+rem t1 s1 s1
+andi s5 s7 475
+ori s6 t5 -1054
+slli x0 s9 16
+lui t1 169090
+add t4 t3 t3
+mulhu a4 s8 a5
+lui tp 930186
+div a0 a1 s5
+mul a3 t1 a4
+sltu a4 s1 t3
+sltiu t2 t3 1885
+rem s1 s6 s9
+sltiu s5 t6 951
+xori s9 ra -1283
+add a0 a6 s8
+sub x0 x0 x0
+mulhu a2 ra t5
+sll x0 tp a7
+sub a7 a5 gp
+ori a2 t4 1486
+srai s0 s3 30
+xor t6 a1 s10
+add s5 s6 a0
+sll s0 a0 s10
+lui s4 678192
+slt t6 t0 t6
+auipc s4 531361
+addi a3 t2 -413
+xor s9 t4 t0
+ori tp t3 1160
+ori t5 s8 -657
+addi a7 t3 -1633
+add s9 s4 a6
+or t2 gp a7
+sub a4 t6 ra
+xor t0 tp s9
+add a7 a4 s9
+sra s9 s9 s6
+srai t3 a1 20
+xori a4 a0 677
+andi s8 s11 -1948
+sltiu t5 s4 528
+or t6 s10 t1
+remu s2 s2 s3
+mulhu t4 t4 t5
+lui t0 46228
+xor t0 t3 x0
+mulhsu s9 s7 a2
+add s4 t3 t1
+xor s11 t2 s7
+rem a5 a7 s5
+divu ra s8 s9
+sltu t3 tp s4
+rem s1 s2 a7
+div t2 s1 s1
+srl ra t2 a3
+slt a5 t1 s2
+add t5 s5 t0
+andi s5 s11 1922
+slti s0 t4 -865
+srli a0 x0 23
+add x0 t4 s2
+mulh gp t0 t4
+mulh s0 s9 t2
+or a2 gp t1
+lui s9 791644
+divu s2 t2 a0
+ori s9 t0 -774
+ori t5 s6 733
+xor s8 s6 s6
+sltu s8 ra s7
+sub t5 s7 a5
+rem t2 a5 x0
+mulhsu t5 t1 s8
+addi a1 a4 1402
+xori tp x0 -1746
+divu x0 t4 s1
+slti t3 ra -264
+slli a4 t3 8
+sra x0 s5 s0
+srai s10 a7 18
+sub s8 s0 t3
+sll s2 s6 a5
+div a1 a5 t1
+sll a0 s3 t4
+mulh a7 a5 t2
+ori s8 t6 -1113
+ori ra tp -420
+add s3 t2 s5
+sltiu s11 s6 -1902
+mul s1 ra s8
+andi s4 t6 1868
+or t3 t4 t0
+addi s9 t3 -1974
+mulhu a3 s4 s9
+ori s1 s3 -1849
+div a4 s0 t5
+srai s8 t2 27
+slli gp t1 17
+sll a6 t5 a3
+slt a2 t5 x0
+auipc a1 180994
+sltu s0 x0 t1
+slti s1 t1 -1179
+lui a5 752554
+sra t6 s4 s8
+andi a0 s11 -1070
+mulhsu s8 tp t4
+remu s5 s6 s7
+lui a0 651099
+sra tp t5 t5
+remu s3 a1 a7
+addi t4 t1 336
+addi s8 a3 1221
+add s0 s4 s6
+slt tp a3 a6
+xor s4 a1 a1
+sub a7 x0 s4
+divu a5 s10 a3
+and tp s5 s4
+sub x0 t6 s9
+mulhu ra s9 a5
+sub x0 a5 s6
+sltu s3 t0 a5
+slli s10 a5 14
+lui a3 764019
+slt t2 a5 t4
+srl a7 a4 x0
+remu t6 s9 s7
+xori s4 a4 -501
+lui tp 337301
+addi t3 x0 -2042
+rem tp x0 s7
+mul a2 s3 s0
+divu s5 ra a7
+divu s1 a5 s4
+srl s1 s3 s8
+srl t4 a3 s6
+mulhsu t4 t4 s7
+auipc a2 848549
+sltu a3 t3 gp
+srl t6 a4 s0
+div t1 t3 s9
+slt t0 t1 a4
+lui t1 420486
+srai gp t2 27
 divu s0 tp x0
-mul a0 s1 t3
-mul a2 t0 ra
-slli x0 a6 28
-sltu tp tp t1
-divu gp x0 s6
-add a5 a7 s10
-divu s1 s9 a4
-mulh a4 a6 a4
-sll t2 s1 s5
-sra t4 t3 s5
-divu s6 a2 a7
-andi s11 t4 -766
-add a0 ra s4
-slti a7 s1 521
-and t3 s7 t1
-slti s5 s7 -2019
-mulhu s4 a6 a4
-mulh s6 t2 a3
-auipc a5 685394
-add tp tp x0
-rem t5 a4 s2
-sra s8 gp a7
-div s1 a4 s1
-lui t4 893456
-mulhsu s3 a5 t5
-or s1 a5 s4
-srli gp s1 8
-mul t2 tp a0
-mul s1 ra s5
-srai t6 a1 5
-lui s5 767246
-remu ra a3 a3
-sltu a0 gp s6
-lui x0 653191
-slti a1 ra -373
-andi ra s4 1740
-srl t5 t2 s1
-sltiu s11 s7 1711
-auipc a2 981911
-slti x0 s2 -22
-lui s2 589200
-srli s9 s3 23
-addi t4 s7 -1989
-div t3 tp a1
-srai s4 a7 17
-slli a2 a5 18
-sra s9 s0 a3
-auipc a6 349712
-sub a0 s0 ra
-ori s7 t3 -1808
-sll gp s4 s4
-slli s2 s9 18
-addi tp a4 -379
-xori s11 a0 -267
-srai t6 s8 29
-mulhsu t6 a0 s9
-slt a3 ra s1
-mul s7 s2 s7
-divu t3 s0 s1
-slt t3 a7 a4
-sltu s11 s8 a5
-slt s6 t4 s9
-auipc a1 896300
-and s0 a3 a2
-sltu s7 a5 x0
-auipc t6 929785
-xor a3 s7 s1
-lui t3 124434
-slli s9 s4 8
-add s10 s9 s5
-divu a0 x0 t0
-mulhu t6 s9 s2
-sra s6 a2 a3
-slt s0 s1 a0
-sub t1 s2 a0
-addi t4 s7 872
-divu a0 s11 s5
-and a0 t2 a6
-auipc t5 20367
-andi t4 s7 202
-srli s0 s2 19
-sltu t1 s3 s2
-addi a3 s4 -721
-srli t2 s5 29
-div s8 a6 s5
-andi t4 s1 1534
-andi a4 a2 -423
-or a0 a2 tp
-mulh x0 a5 gp
-mul a0 a4 s6
-srai s9 s9 5
-div t3 t0 s10
-srli s4 t2 5
-slti s8 t5 -1747
-andi s5 t4 -876
-mulh t6 x0 a6
-sub a5 x0 s6
-mul t6 s3 s2
-slt a3 s10 a4
-addi s4 s8 -261
-remu x0 s2 t3
-slti a7 s2 -477
-remu s8 s1 a4
-srai tp s3 18
-sltu t5 a3 a0
-andi s2 a5 354
-divu s10 s10 s0
-sltu a7 s2 s7
-srli gp a0 18
-xori s4 t3 -237
-sltiu a7 s1 -702
-srli t6 s9 28
-slt t2 tp t0
-addi t6 t5 -1411
-and s4 s9 s6
-sltiu s10 s5 -575
-div a1 x0 a7
-srai s9 a4 11
-addi s11 t1 1250
-add s10 gp s10
-or a5 s7 t6
-xor t0 gp a0
-and x0 s3 a4
-srl s0 a7 x0
-sltiu s10 s0 -726
-srl t4 a7 s8
-lui s3 797090
-andi t5 x0 -1910
-srli t2 t5 28
-slt s9 a1 a4
-add a5 ra a5
-srl gp a1 x0
-sltiu s1 gp -416
-sltu s0 t2 ra
-auipc s7 25123
-sltu t2 a5 t1
-sub s0 s5 s11
-sltu s5 gp t1
-andi x0 s7 -1000
-auipc t6 692001
-auipc s7 968863
-srli s6 t0 12
-lui a5 188717
-slti t6 a7 -853
-rem a6 a3 a4
-rem a2 x0 a2
-ori t0 s0 -528
-sltiu s7 a5 1605
-srl t5 x0 a5
-or s8 tp t5
-sltiu x0 s1 -1787
-lui s11 833240
-addi a5 t4 -247
-andi s6 t5 -740
-mulhsu a1 x0 s1
-slt t6 a0 t2
-sll s1 a5 x0
-addi s3 t0 762
-sltiu s4 s4 -1388
-mulhsu a6 s11 s3
-andi a1 ra -1937
-slti t5 a2 -1671
-andi t1 s7 703
-sltiu a6 s10 -1503
-divu x0 tp t6
-divu t6 a0 s9
-mulhu ra t3 t6
-sltiu tp s8 -1701
-addi a0 s3 -1413
-sltu s10 s8 a7
-and t6 s5 t2
-srl a1 gp t6
-mulh a2 a1 a5
-srli s4 ra 13
-andi s6 ra -496
-sltiu a5 x0 1213
-mulh t3 a7 s11
-xor x0 s8 x0
-slti s6 s11 -932
-auipc a0 161733
-sra t6 a1 a6
-sub x0 a6 t1
-ori x0 s2 -1892
-remu a7 ra s6
-slti s0 t6 -752
-ori t1 a7 -1261
-addi s9 t3 1195
-srli tp s10 10
-remu t3 t0 s11
-xor s4 x0 tp
-srai x0 a4 13
-mul s6 a5 x0
-sltu t3 s2 s4
-or s10 s11 a3
-mul s0 s7 s7
-and s6 s5 s2
-mulhu a0 s10 t1
-srli gp s8 2
-addi a1 a7 -2013
-sll ra ra x0
-divu x0 s4 a6
-srli s1 x0 9
-slli s7 gp 14
-remu x0 a7 s8
-remu s6 gp t2
-lui a1 368055
-remu t2 s6 a2
-slt x0 s0 s10
-xori s3 x0 -1986
-slti s0 s9 -354
-mulhsu s8 a7 s7
-rem s4 t3 s6
-add s11 a1 s1
-andi a5 a3 -1851
-mul t1 a2 a6
-mulhsu t4 tp s11
-or s1 gp s1
-mulhu t5 t6 tp
-xor s6 t0 a5
-sll s5 a2 s8
-mulh s4 s11 t0
-sltu s7 s6 s11
-mulhu s3 s10 a3
-slli s6 s8 9
-sll t6 tp t5
-mulhu s7 x0 tp
-srli s5 s6 18
-mul a2 a7 s10
-and a6 s7 a1
-addi s5 a4 38
-sra a2 t0 s9
-ori s4 a4 -1450
-ori a4 s10 -822
-slti t3 s8 -1048
-rem s6 s1 a7
-slt a5 s4 a7
-xori s7 t2 -1375
-auipc s1 640202
-and a5 a0 a2
-srai a2 s8 0
-ori s3 a3 1171
-slti s0 a0 824
-srli s8 s10 24
-andi a3 s11 1889
-slli s0 s8 16
-sll s6 t6 t5
-sltu t3 t5 a2
-mulhsu a6 s6 a6
-sltiu s11 a5 -1409
-and s7 s7 s7
-add t0 ra s2
-addi t1 ra -1270
-srl t1 x0 t4
-sltu x0 x0 s3
-div x0 s10 x0
-andi a6 s3 -45
-and tp gp tp
-sltiu s4 s7 -472
-sub tp a6 a7
-sub s10 ra s6
-addi t1 a7 -1672
-remu t6 ra t5
-rem s5 a0 s6
-srai s7 s6 21
-mul a5 t2 s1
-or a5 s7 t5
-srai gp x0 21
-sltiu a1 s7 -468
-slti s7 s1 -1387
-andi s6 s6 666
-or a2 s11 s5
-slt s9 s6 t3
-addi t0 t0 -4
-xori t4 tp -1418
-or t6 t4 ra
-mul s10 a5 s3
-rem t5 a7 t6
-andi t2 s10 -1160
-mulh s4 s8 ra
-addi t1 x0 669
-srl a3 s5 t6
-add a4 a4 s5
-add t0 x0 t3
-srli x0 s11 1
-sub s3 s3 s3
-add t6 s4 s6
-sub s5 tp a3
-srl s0 a1 a2
-auipc t3 837529
-div a7 t4 s8
-srl a5 a0 s7
-divu a6 gp s11
-and a5 t6 s9
-rem s10 t2 s5
-slti a6 a2 -654
-lui s9 861668
-auipc s2 113551
-sltiu s7 t5 598
-srai s0 t5 27
-add t0 t2 s0
-rem x0 a6 s3
-remu a1 s1 t4
-mulhu a6 a4 a7
-remu t2 s8 tp
-srli s4 t4 23
-lui t6 661471
-srai tp s3 22
-add t0 t4 a7
-rem a6 x0 s6
-or a2 s0 s4
-sra t5 s7 ra
-sltu gp a7 t4
-ori t0 tp -442
-addi a4 x0 1157
-srli t2 s7 21
-or s5 s0 s5
-slti s4 t4 -1916
-mulh a1 a4 a2
-slti a2 s2 -1655
-slli a3 a5 17
-sra s11 x0 t1
-srai t4 s5 24
-slti s0 t5 -657
-remu s4 s5 ra
-xor s5 s0 s1
-sltu gp t6 a0
-slti gp s5 -148
-andi a4 s4 -1967
-div a5 s0 a1
-mulhsu s10 a7 s5
-mulhu a2 t4 ra
-xor t2 t1 a5
-xor s1 a3 s7
-sltiu t2 tp 2003
-sltiu s9 tp -1157
-slti t1 t4 -715
-divu s3 s3 s3
-xor s5 s10 t2
-sra gp x0 gp
-mulhsu t1 s9 s11
-xori a6 s0 -1530
-srli s5 a4 0
-remu t4 x0 t4
-slti s7 s2 -666
-and s3 s1 t4
-mulhsu s2 t1 s1
-sub t5 a4 a1
-div s1 s4 gp
-srl a6 s0 s5
-divu s4 x0 a4
-sra t1 s1 a4
-auipc tp 624047
-add a3 a1 t3
-lui s5 148187
-and a1 s9 a6
-srai a5 a7 7
-srl a6 t4 s4
-mul a5 s8 gp
-lui x0 362124
-slt s7 t2 s7
-slti ra a4 -68
-mulh s9 x0 s3
-xori a0 t3 -1025
-mulhu s2 s9 s10
-remu a7 s4 s10
-mulh a2 a5 a1
-slti t4 t1 1236
-ori gp s5 -1125
-sltiu tp s1 -1854
-auipc a7 78112
-lui x0 223660
-ori s4 x0 -657
-xori a1 ra -956
-sll t2 s2 s2
-lui a2 98678
-and x0 s6 s5
-sltu t4 s8 a3
-sltiu t0 s1 -2022
-slt s0 s6 s6
-srai a0 s6 6
-lui ra 1019098
-srli s8 a7 11
-slti t2 s8 -1134
-auipc t6 855778
-remu a2 ra s9
-remu s0 t2 a4
-slt a3 x0 t2
-slti gp tp -943
-auipc a2 808753
-slt s0 a7 t4
-and s2 a5 ra
-slti s7 s7 -734
-sltu t4 t4 s5
-sltiu s9 s8 -479
-add t4 a3 s1
-mulhsu t5 ra t6
-mulhu a2 s0 tp
-andi a2 t2 -806
-mulh s5 gp s5
-lui a5 242645
-sltu t6 s11 a2
-sra a7 x0 s10
-mulhu s7 t4 a3
-mulhsu x0 t4 a3
-xori s7 s8 -1986
-divu s9 t4 ra
-srl t4 a6 t2
-xor a2 s3 a5
-sltiu t3 s2 1906
-andi t0 s11 -811
-sub s1 a2 t3
-sltiu a7 t6 -894
-sltiu a3 s1 1595
-mulh a0 ra s11
-sra s7 a0 a2
-sltiu s11 t0 -1842
-div s4 s6 t3
-add s9 t3 s1
-ori a1 s5 -1680
-mulhsu a3 s6 ra
-remu s5 a6 a2
-and x0 s0 t3
-slti s10 s10 -164
-sub a3 a4 s11
-auipc s4 743758
-srl s8 t3 s10
-divu x0 t0 s5
-ori s3 gp 86
-sra t2 x0 x0
-add s5 s3 a5
-slt t1 t1 a7
-mulhsu ra a7 s7
-srli s4 s4 17
-slli t3 a6 23
-div s2 t4 a0
-andi t6 a3 -1913
-sub s0 s5 a6
-xor t0 a3 s8
-add a0 t4 t2
-mulhsu tp s1 s0
-xori s2 s0 -734
-div s1 t2 s9
-slti t0 t3 2031
-sll t1 t5 a3
-div gp a3 x0
-sltiu a3 s10 -1687
-mulhu s6 s3 s2
-sra a6 a1 s1
-remu t6 s5 s5
-addi s7 s5 21
-srai s1 a5 12
-auipc s5 505070
-or s6 s11 s3
-sll a1 t0 a2
-remu s11 t1 x0
-lui s10 470912
-srl tp s4 t4
-remu s8 t0 s5
-sll s1 a6 s3
-mulhsu a2 s8 t2
-xori a3 t2 -492
-slli s5 s2 30
-and t0 s11 tp
-auipc s6 1006558
-addi a7 ra -338
-sub s5 a3 x0
-sltu s9 x0 s11
-mulhu s8 s9 s7
-sltiu s4 x0 -444
-sll s11 s4 s4
-xor a6 t6 s9
-srli a1 t2 6
-sra t3 a7 s4
-mul s4 s6 gp
-addi a3 s7 -607
-ori t2 x0 -961
-srl s6 a1 s3
-and t2 s9 s9
-sra gp s0 s1
-remu t0 a2 a3
-lui t4 227530
-xori s2 a5 -2018
-slt a2 t1 s8
-ori s6 t4 -1678
-or s6 s4 s5
-remu tp a0 t2
-mulhsu a3 a0 t0
-sra t3 s4 s1
-srli a3 t4 15
-mulhu x0 t3 x0
-srl s6 t2 s3
-slti s3 t0 -560
-sra a2 t1 x0
-lui t1 446367
-srl a1 s0 s0
-srl s11 s6 s3
-xori s3 t1 -313
-sub s9 t0 x0
-sltiu a6 s4 -1637
-add s2 s3 s3
-rem s4 tp tp
-add t4 x0 s11
-and a0 t0 t5
-mulhsu t4 t3 s1
-ori s1 x0 -1315
-sll t3 x0 s6
-xor a4 a0 a6
-mulh s9 s11 s10
-sltu ra a0 s8
-mulhsu s2 t4 t4
-srl a2 s1 a3
-rem t2 s0 t3
-rem s4 t0 s0
-sra s7 s2 a0
-srai t6 x0 11
-srli s1 t4 9
-srl a6 t4 a0
-sltu s11 s10 a2
-add tp ra s11
-mul a1 tp ra
-slt a5 tp s8
-divu x0 s9 gp
-srli ra a2 21
-mulhu t1 s7 s1
-xor ra s3 a4
-sub t2 t3 t3
-and s1 s6 a4
-sub t6 a7 a0
-mulhsu s10 t5 s3
-auipc s1 620201
-srli t6 s1 14
-slli a3 x0 29
-and a7 a2 s0
-lui s4 937319
-and tp s7 t0
-xor a6 a2 s2
-xori t4 t1 1630
-andi s5 a2 1062
-add s9 t2 s11
-sub s3 x0 t6
-slli s0 s0 27
-div s0 s4 t4
-and tp gp s1
-srl s10 t3 x0
-mulh a2 s7 t5
-and x0 s8 t1
-mul t2 a4 s5
-add t2 tp a6
-mulh s0 tp t0
-sll ra a3 ra
-slt a4 gp s9
-srai t0 s7 6
-auipc ra 701054
-srl a7 s0 t0
-mulh t2 x0 s6
-remu s8 gp s0
-mulhu s1 t2 s0
-mul s6 x0 gp
-mul s11 a5 t3
-lui s7 732416
-add t1 ra s2
-remu t3 a0 a3
-sra a0 gp x0
-mulh s1 a2 s4
-auipc s11 528208
-auipc t5 449938
-add a1 t5 s5
-sltiu t3 t2 -1331
-xori s2 a1 -1023
-div x0 s7 t2
-auipc t1 59188
-or s4 t6 s10
-auipc a3 489322
-srl s3 s9 s11
-lui t5 1001762
-rem s1 s0 s2
-slli s0 t6 8
-and x0 a7 t3
-srl t6 t5 s9
-auipc s0 736841
-addi a5 t2 -349
-sra s0 s3 s5
-sub s2 a7 s8
-andi a2 t4 -521
-srai x0 t1 29
-addi a4 t3 1961
-auipc s10 750148
-srai t6 s4 0
-and ra s2 t6
-mulhsu s2 s6 s5
-andi a0 s4 187
-slti a1 t3 219
-sub t0 s10 a3
-sub ra a1 tp
-sltiu a2 a4 -1760
-addi tp a4 259
-or a5 t5 s7
-sra a4 a0 s3
-andi s0 a1 1411
-and s8 a7 a2
-addi s9 s0 748
-xori t2 x0 -687
-mul gp s6 s11
-slli s4 a2 27
-or t1 s11 ra
-remu a2 s7 s8
-sltu a0 s5 ra
-mulh s3 s5 a1
-sra a5 t2 s7
-sltiu s6 s11 -1090
-srl t2 t3 tp
-ori tp s5 1502
-div t2 s3 a5
-slli s8 a5 16
-mul a3 a1 s3
-sll a1 x0 s2
-andi t1 t5 -1850
-lui a4 866286
-addi s5 s4 -1004
-srli s6 s3 5
-slti s8 a2 -1018
-srai s2 a1 18
-addi s7 t2 1746
-and s7 a2 gp
-slli a0 s7 3
-xor t3 s3 t0
-srli s4 a2 3
-mulhsu s7 s11 a1
-slt a4 t2 s0
-sltiu s6 s11 1103
-slti x0 a4 1247
-sltiu s3 x0 -381
-mul s11 x0 s3
-xori s0 s9 -900
-or s4 s8 s10
-sll a0 a4 s4
-xor s0 s4 ra
-xor s7 a6 t4
-srli a5 x0 25
-andi x0 t4 -57
-add t1 a4 gp
-add s1 s11 x0
-sltiu a4 a1 -467
-sll s3 ra t3
-mul a7 a7 s10
-auipc t3 66826
-mulhsu ra s1 t5
-sltiu a1 gp 1154
-sub s9 s10 t1
-srai a1 tp 28
-divu s2 s9 a2
-srl a6 t0 t4
-andi a6 t4 -1536
-auipc t6 808454
-div t1 a3 t4
-mulhu a6 ra s4
-add t2 a2 x0
-and a6 t0 s1
-addi tp s6 579
-and s10 s6 a3
-sra t5 s3 s8
-lui a6 437068
-lui t4 215878
-divu t6 s6 s11
-slti x0 s11 1578
-slt s6 s3 s5
-sll s6 t2 s7
-mulh s7 t5 a7
-srli s6 a5 27
-and a4 s11 x0
-and s2 t1 a1
-auipc s2 692255
-mulh s0 s0 tp
-mulh s3 a7 s0
-add s2 t2 a2
-slt t1 x0 t0
-div a3 ra a6
-add t1 a5 t6
-sltu gp t2 s9
-xor s8 t3 a0
-or a1 a1 a0
-xor s5 a0 a2
-sra t5 s11 t6
-mul tp ra a7
-divu t0 t1 s8
-auipc a7 373392
-srl a5 s8 t2
-mulh a4 a0 t6
-sra t6 x0 tp
-mulh a7 a6 s0
-slli x0 s9 18
-mulh s4 s11 s8
-xori s0 s2 1502
-slti t3 a7 1882
-slt t4 a6 t6
-sltu s0 s10 t0
-rem a2 x0 tp
-mul s0 a2 a4
-srli s10 s10 11
-mulhsu a0 t6 s11
-sltiu s9 a1 1492
-remu t5 t1 s2
-ori s1 s11 33
-divu a6 s5 t0
-sll t0 t5 s11
-auipc gp 308385
-slt s10 s5 gp
-div a5 a1 a2
-and t4 s3 s2
-sll ra ra s11
-and x0 tp t4
-mul s7 ra s1
-div s1 s7 s11
-xori s1 t5 -492
-sltiu s1 s3 -348
-andi t1 s8 -248
-slt x0 s10 s5
-sltu tp gp a3
-div t0 s10 t5
-xor t1 s11 ra
-div a4 s5 s10
-sltiu s6 tp -812
-srai s5 t3 18
-auipc s0 1047802
-lui s3 185293
-mulhsu a2 a7 tp
-sll s3 tp s8
-sub a0 s4 s5
-lui t5 400520
-divu x0 a1 x0
-addi a1 s9 -1798
-divu s8 s9 a7
-divu t6 s9 ra
-rem a5 t6 t4
-sra s8 a6 s11
-auipc s8 236783
-slli x0 a3 11
-mulhsu t4 x0 ra
-ori a7 s3 -1150
-mul x0 ra s5
-sra t1 s6 s9
-mulh t2 s9 s3
-rem s10 t6 ra
-sltu t5 s0 a3
-sra s8 a2 tp
-addi s5 s1 -1525
-sll s10 s10 a3
-remu a4 s6 t4
-srl a7 t2 x0
-addi s2 s2 -254
-sub s11 t2 t6
-slt t0 t1 a7
-mulhu s8 s7 t0
-slli a1 t4 22
-sltu a2 t5 s1
-divu t2 s6 t3
-xor s11 a7 s4
-div a1 s9 a7
-remu t0 t4 s4
-xor s6 t5 t3
-andi t6 a5 -1132
-div s1 t2 s5
-xori a7 a7 -1846
-add x0 s4 s7
-xori a6 gp -1253
-lui s4 859132
-mul t0 t5 a4
-xor t0 a2 t5
-addi gp gp -1270
-or s11 t3 s0
-mulhsu x0 s5 ra
-srli t0 a0 5
-slti x0 s11 586
-and a4 a7 t1
-lui tp 136403
-mulh s0 s11 s8
-sltu t5 s4 s0
-xor a1 s7 tp
-xori t3 s9 -1530
-sll s1 ra s2
-sltu s2 x0 t5
-ori s3 s4 -639
-mulh a1 t2 t5
-mulhsu t2 a7 x0
-srli s8 t6 9
-ori s6 a0 79
-srli a7 a7 14
-srli s1 t4 21
-slli t1 a5 0
-lui t2 655678
-divu s10 a6 a4
-sll a0 s8 x0
-srl s10 s6 x0
-slli gp t6 5
-slli a5 s0 11
-andi s6 s9 -1429
-sltu a3 a0 s10
-mulh s0 s9 t0
-srai s0 a2 29
-or s11 s0 t0
-srli s0 t1 28
-add s2 tp a3
-sll x0 a7 x0
-add s3 s0 gp
-and t5 tp a4
-div s0 s5 s6
-or s8 t4 s5
-slt s8 a5 t0
-auipc t1 498029
-add t6 t0 ra
-auipc s2 539408
-slli gp gp 25
-xori ra a6 -1179
-xor ra t4 t4
-srl t1 t3 x0
-sra s11 a3 s10
-sll t2 s3 a5
-add s11 s3 t2
-slli t5 a3 15
-ori s0 s7 1551
-add gp s11 s3
-xori t1 s11 -2
-divu s2 t5 s8
-slli s5 t2 4
-sub t1 s0 a2
-rem a6 t6 t2
-mulhsu a1 s8 s1
-srai t6 s10 15
-srai a3 s5 5
-add s4 a0 x0
-add s11 t4 x0
-srl x0 a1 t3
-slti s7 s1 631
-sltiu x0 t0 -2018
-addi t0 a6 -602
-xori t3 t4 -1054
-mulhsu s10 gp t4
-sub t3 s4 tp
-sra x0 s11 a4
-mul x0 s4 t0
-mulhu s8 a3 x0
-slt t1 a3 t0
-lui gp 295650
-sltu t0 a5 a5
-srl s1 s5 s11
-addi tp s11 -1229
-mulhsu s10 t3 s8
-xori s5 a6 302
-and a0 s1 a5
-ori a4 s9 -519
-or a4 s4 a3
-mulhu a5 a7 a0
-xori a4 s1 -2033
-auipc a0 1016703
-slt t4 t5 a7
-divu s5 a2 t2
-srli x0 t5 28
-div a5 a7 ra
-or a3 t1 a0
-and a5 t0 s1
-lui t6 611015
-mulhsu a2 t5 s6
-srli a2 a4 31
-srai s1 s9 18
-srai s11 ra 0
-sll a0 a0 s8
-srl s8 a4 a5
-sra t2 a4 t2
-mul s0 a1 a2
-srai t5 t0 14
-slt ra s10 a4
-sll s2 a5 s10
-sltu t0 a3 t2
-xori t0 s2 -1193
-or a4 ra a7
-andi a7 a5 -1841
-andi a2 s11 440
-ori a0 s4 -1443
-xori t2 s8 -562
-andi s3 a6 -1538
-auipc s9 51976
-addi t3 s2 -1575
-lui t1 657013
-mulhsu a2 a7 a0
-mulhsu t4 s9 x0
-addi t5 t3 -49
-slli s4 s9 19
-lui a4 420102
-xor s2 ra s8
-sltu t0 s0 x0
-sll a4 s4 t6
-sltu s3 t5 s4
-sltu gp s2 a5
-addi a0 s9 250
-srl a3 a3 s8
-slli s8 x0 2
-addi x0 s1 -1449
-and t2 a0 s6
-slt t4 a2 s6
-ori t6 s8 564
-addi t0 a6 -1870
-sra s5 a2 s7
-sub s8 tp a5
-sltu s8 s10 s10
-rem a4 t2 t3
-slti tp gp -1623
-slli ra s11 25
-srai s2 s10 2
-mul s5 s5 s9
-srl t4 s3 t2
-sra a3 t3 t6
-slt gp a2 a6
-mulh s11 gp s9
-sra a6 t5 s3
-xori t5 tp -1309
-mulhu s7 a4 s0
-sltiu gp s9 37
-sltiu a5 tp -850
-xor a4 s6 t6
-andi t6 a4 -83
-add x0 s3 s3
-slli s5 a5 25
-sra x0 t2 s2
-xor t6 a2 s6
-ori a5 s6 229
-slli a0 t5 26
-slli ra ra 14
-sltu s8 s0 s10
-ori t0 x0 -655
-slt a4 a2 s10
-div s8 x0 s1
-and a4 x0 s4
-and s9 a7 s5
-slti s7 t1 1963
-sra s9 s9 a1
-or s9 a6 a7
-auipc s9 295003
-add s8 s10 a5
-andi s1 s6 463
-sltu s0 a6 tp
-andi t2 tp -721
-mulh gp t3 t1
-divu s2 s8 s11
-auipc s0 686665
-divu t3 s4 t2
-auipc a3 480439
-xor a2 a2 s1
-divu t1 s8 s2
-add a5 s6 a6
-ori a0 a2 -200
-slt ra a4 a3
-or t4 a2 t3
-lui s8 761594
-ori gp tp -1213
-xor s8 tp t4
-rem t2 s3 s3
-add s9 a3 s2
-srl s10 tp s7
-xor s8 x0 s5
-xor s0 a0 a2
-slti ra s1 -1470
-sll s2 t0 s8
-slt a0 s11 t5
-sub a3 s5 a3
-sub s5 s11 a7
-slli s0 t0 11
-divu t4 s7 s4
-xor a3 t0 a5
-sra s10 x0 t3
-mul t5 a0 a3
-auipc a4 758514
-and x0 s4 s9
-addi s0 gp 160
-sltu s0 t1 ra
-add s0 a7 s8
-mulhsu a5 s8 s0
-slti tp t0 -1113
-srl a6 a3 x0
-mulhsu a5 t2 t1
-slt s4 s6 s4
-mulhsu s8 s8 gp
-sub t5 s4 s0
-remu s8 x0 tp
-rem s11 s1 a5
-mul a7 s8 s11
-mulhu t3 x0 x0
-div s5 s5 a6
-rem a7 s4 a1
-add ra x0 a6
-sll ra t4 x0
-sltiu s1 t3 -1980
-slli t1 s2 20
-auipc ra 945546
-remu s0 s10 a7
-xori t0 t0 -1657
-lui s11 73264
-mul s8 a2 t5
-sub s8 s1 s11
-sub t3 t0 s7
-add s9 s11 t3
-srl a1 s10 s9
-sltu t2 s6 s6
-add gp a1 ra
-add a7 ra gp
-sra t0 a6 s7
-lui s1 244820
-mulhsu s0 s8 t2
-slti x0 x0 -87
-sltiu x0 t5 1812
-sub s4 t1 a1
-lui a7 449013
-add a1 s3 a1
-remu t6 t4 t4
-auipc s0 815387
-andi t1 a0 -1969
-lui t4 726943
-slli t1 a1 25
-sltu s3 s0 t4
-sltiu x0 s3 -1604
-lui s0 60969
-addi t1 a4 -676
-mul s9 a5 tp
-ori s4 a2 851
-xori gp s4 -597
-divu t3 t5 s5
-sltu a1 x0 tp
-andi a5 s4 -731
-mulh a2 s4 a6
-mul s2 t6 a0
-sll s10 t3 t1
-srai a1 s0 3
-or a5 ra tp
-mul a1 s5 s9
-slt a0 s2 s1
-addi t2 s11 32
-sra ra t2 a5
-mulhsu a2 a2 s2
-add t6 ra a4
-add x0 a7 a4
-mul a4 t4 tp
-slli a0 a7 28
-srai s11 x0 21
-srai x0 a6 2
-div s0 s3 tp
-sra s7 s9 s1
-andi t3 t0 -1298
-mulh t6 t5 a1
-slti s7 s1 -1402
-mulh t3 x0 s5
-or s2 s6 x0
-srli s3 t6 13
-and s8 a2 ra
-sll t5 a7 t2
-ori a1 s9 -98
-sltiu t1 s1 745
-mulh s1 s6 s3
-and t0 a1 s11
-slli t1 s0 3
-add s7 ra s9
-remu a5 t4 s6
-lui s4 567972
-auipc a3 935216
-mul a5 s10 s6
-srai a0 s9 4
-remu a6 a6 a7
-srai s9 t5 7
-sll t2 s2 s1
-lui s10 194450
-mulhsu gp s1 a0
-ori tp x0 -1890
-mulh t4 t1 a7
-lui s4 662558
-sltiu x0 tp 301
-remu s1 t0 t2
-srai ra s3 9
-lui s9 668493
-srl gp s10 t3
-srli gp ra 25
-mulhu a6 x0 s9
-remu t6 a2 s3
-rem s4 s10 a7
-srai s5 x0 17
-andi s2 a4 -1962
-auipc a7 729393
-srl s7 t0 t0
-sub a2 gp t6
-sltu s8 s7 a3
-ori s4 t1 -122
-and t1 s9 s5
-srl s1 t2 s6
-ori t3 a3 143
-sra t4 t4 t6
-slti s4 s10 -276
-srl ra tp a3
-auipc t0 497596
-mulh s1 a7 a7
-sll s1 tp a3
-mulhu s4 a7 s5
-mulhsu s6 t5 s11
-sltu s2 ra s0
-or tp x0 s5
-auipc s10 771944
-sltu a1 x0 ra
-slti s11 s3 -1777
-sra s8 s7 a4
-sub a7 t6 t0
-slti a7 s11 8
-slt tp a1 t3
-divu t3 a3 s6
-mulhsu gp s5 t5
-rem a1 s1 a6
-mulhu t2 s1 a4
-slti a5 s11 1452
-sltiu t1 t4 1772
-sub x0 s1 t1
-sra x0 a1 a5
-mulhsu a1 a5 x0
-ori s6 s7 -920
-remu tp s7 s3
-sub t4 t0 t2
-sltiu t2 gp -1960
-addi t2 a2 -245
-sltiu s11 s5 1979
-slt t3 a6 ra
-slt a1 t2 t3
-sltiu a1 gp -1093
-xor s8 a4 a2
-div t2 s0 t0
-xori s11 s1 -1663
-srli s11 t2 14
-andi s6 s4 -1030
-or a4 t6 x0
-addi x0 s6 -361
-slti s3 a5 -1819
-and t0 s1 a5
-xori a3 a7 -986
-mulh t2 t0 t3
-srli a2 s6 16
-andi t5 a0 -1436
-slli a6 s10 31
-andi gp x0 1513
-and a2 x0 t2
-slli t6 s4 15
-divu a0 t2 s5
-slti a7 s5 886
-srl s10 t3 a0
-div s8 a4 t5
-sltu tp ra s5
-add a0 s8 a2
-slti s8 s7 864
-sra s7 t3 a3
-andi t3 a6 585
-addi a6 s11 -985
-mulh x0 s6 t1
-mul s7 gp x0
-srl s5 t1 s9
-ori s0 t6 -1760
-addi s9 s10 -160
-and t1 s10 a5
-xori s6 s5 428
-xori a2 t2 538
-rem t5 t6 s5
-srai s2 a4 12
-sub a6 s6 t4
-and s1 ra s10
-srl t3 t1 gp
-divu a7 a2 s8
-addi t2 s8 94
-mulhu ra s5 s0
-addi s9 a3 -631
-mulhu t1 s6 a0
-sll a5 s0 t5
-addi s7 t0 -1024
-mul s1 s8 a2
-mulh s9 s4 t6
-andi x0 a0 259
-srl t2 s3 x0
-sltiu s8 tp 487
-srli s3 tp 14
-add s2 ra s10
-andi s9 s10 -1209
-srai a6 t5 24
-slt t3 s11 x0
-ori t6 s7 1589
-mulhu s2 tp t5
-srai tp s5 2
-slt a3 tp a4
-sll s2 ra t5
-xor a0 t1 s9
-mulhu s5 t3 s9
-add s2 s3 a5
-srl s10 a3 a3
-sltu s7 s3 s8
-srai t1 s10 15
-mulhsu s3 t4 t6
-slt t0 t3 s1
-slti a1 s6 -2048
-remu x0 x0 s8
-slli t3 a3 20
-div a0 a1 s10
-xor ra a7 s6
-mul a3 a4 t6
-div t1 a5 t5
-rem s0 s2 s4
-addi s0 x0 562
-sub a2 a7 s6
-or s0 tp s5
-add a1 gp a6
-mulhsu a3 t1 tp
-xori t3 a1 -1657
-sll t2 tp a4
-and a7 a2 s5
-div t5 a2 t5
-mulhsu s6 a5 tp
-addi a5 s10 1716
-sll a0 t4 s10
-slti s2 t4 -449
-sltiu t0 t3 1393
-sub x0 t1 s1
-xor a0 s2 a1
-sltu x0 gp x0
-mulhsu s3 t6 s5
-andi s10 a1 -1385
-div gp s8 s5
-mulhu s6 t2 s1
-sub a1 s10 a2
-remu s10 x0 s5
-srli t5 t1 28
-addi s5 s11 -670
-addi t0 s8 258
-mulhsu x0 a5 a7
-div s7 s1 x0
-auipc a7 456320
-divu t3 t0 gp
-srl t5 x0 ra
-sltiu tp x0 -906
-remu t0 a7 s8
-addi s5 t3 -697
-lui a6 553649
-srli a7 a4 5
-addi gp s2 1949
-rem t5 a0 ra
-or t5 a5 a5
-andi a5 a7 -430
-sub t5 t2 s1
-lui a5 464744
-xor s8 ra s8
-slli s7 s2 7
-srl tp s6 a5
-or x0 x0 s2
-slti x0 s8 -1743
-remu s11 s0 t1
-div s0 s7 ra
-srai t1 s6 16
-rem ra s4 a0
-xor ra a2 s3
-sltiu a0 x0 104
-mulhu s7 a6 a3
-divu t2 s6 a4
-add t2 t4 a4
-xor s10 s6 tp
-srli s11 s7 21
-mul a1 a6 t1
-slt s0 s8 s8
-add s5 ra a1
-mulh t6 s6 t0
-sub gp s2 a6
-xor s2 x0 t1
-div t4 s6 t1
-mul t2 a5 a7
-slti s10 s9 -59
-sll s11 s9 s6
-srli s3 s0 20
-sra s1 a5 a6
-andi a6 s6 -1854
-xori s6 a6 1565
-sra a0 a4 s3
-sltu s4 s2 t2
-srl ra s9 s1
-andi ra s9 -1911
-and s3 a2 s0
-andi s7 t5 1407
-srl x0 t6 tp
-sll t2 s0 s3
-srl s11 s0 s3
-add a6 gp a4
-slti s11 s4 -950
-mulhu s0 a2 t6
-slt a1 s8 a4
-mulhu a5 s1 x0
-addi s5 s2 484
-ori t3 s4 -912
-xori a4 gp -1173
-div t5 t2 s2
-sltu s3 a4 a6
-auipc gp 75937
-srl s2 x0 s5
-srl s6 ra t0
-slt a2 s9 a1
-sltiu tp t6 1019
-slti s0 s6 1984
-sltu s5 x0 a0
-slli s5 s1 4
-mul ra a4 s5
-sub t0 s9 a6
-slt s2 t6 tp
-mulhu x0 s7 x0
-sltu t2 a4 ra
-slti a1 gp 1805
-or s6 gp x0
-srli s0 x0 20
-mulh x0 t0 x0
-srl s9 s2 t6
-mulh t1 a1 s3
-sltu s6 ra s0
-and s3 t3 a1
-and a5 t5 ra
-sll s1 gp t1
-slti a3 x0 -403
-ori s6 a2 -1632
-lui ra 1015345
-and t1 tp s4
-andi tp s7 966
-or a0 t2 s8
-auipc a2 534878
-sll a2 a7 a7
-add t0 a1 a4
-slt s9 a0 a3
-addi gp gp -150
-mulhu t4 a6 s11
-mul s8 t4 x0
-divu a1 s3 t1
-lui a4 1007221
-addi a1 x0 1952
-srai s8 a0 25
-auipc s3 273481
-sub s1 t1 s10
-sub s9 a5 a2
-auipc t6 784809
-slti t3 s8 -1600
-srai x0 a1 28
-add a2 ra t1
-sltu s11 s5 s1
-andi a6 s10 1924
-sub s9 s5 gp
-slti a6 t2 -966
-sltu s0 s10 s1
-divu s3 a4 s9
-add t5 s5 s8
-srl s11 a5 x0
-sra s11 t2 a1
-andi s0 x0 1923
-remu t4 a4 a7
-sra s10 a0 t4
-mulhsu a0 a3 t0
-slli s10 a6 3
-addi s6 t0 -1230
-mulhsu t0 t2 x0
-sltu s7 a5 s4
-sltiu t6 s0 511
-rem s7 s2 s5
-mulhu a3 s7 a3
-lui s11 892002
-sll a2 s11 a5
-add s6 s4 t5
-divu s0 a3 s6
-sll s9 a6 s11
-divu t6 x0 t6
-xori s3 t4 450
-xor s8 a0 t3
-xori t3 t1 1318
-rem a7 s1 gp
-mulh s7 s4 gp
-slt t2 s5 t3
-srai s8 s5 11
-or s4 s6 s6
-and t2 gp t3
-sltiu a1 tp 1181
-sltu x0 a7 t4
-sltiu s11 s4 419
-sltiu x0 a2 -1619
-sltu s9 s3 s0
-mul ra tp s5
-slt s1 x0 t1
-auipc a3 594495
-srli s11 a3 14
-addi a0 a5 791
-or s8 s10 t1
-auipc s10 559789
-srl a3 t5 s7
-remu s4 s6 s11
-sltu a0 t5 s10
-divu x0 s11 t2
-ori s4 s3 -433
-and t4 s7 tp
-or a0 tp a1
-srli s8 s9 0
-lui t2 239023
-and t0 a3 s5
-divu t3 t5 t5
-slt a1 t1 tp
-rem s10 gp s0
-addi a0 a3 -1840
-srai a5 a0 29
-div s0 gp s9
-lui tp 33020
-lui t3 253000
-auipc s2 524704
-slli a1 x0 29
-and t5 s6 s3
-rem t4 a0 x0
-rem a1 s5 a4
-sra s6 s9 ra
-xori a7 s4 -1723
-srai s4 t0 20
-srai a2 t6 13
-ori s5 a5 -869
-addi s1 s11 855
-ori s4 s6 -1944
-mulhsu t5 t5 t4
-sra s5 s7 x0
-sltiu s2 s6 982
-divu s5 s0 s5
-addi s5 ra -1765
-slti s1 a6 -389
-xori a7 a1 -1957
-xor ra a7 s8
-slti t1 s1 -1829
-sltu x0 s2 s0
-srl s9 x0 s11
-srai a1 t4 10
-sra t4 a6 s11
-ori s6 t0 418
-or s11 gp s6
-mulh s10 s9 t0
-rem s1 tp s6
-addi tp ra -1851
-and s1 s11 t4
-divu s5 s1 a7
-slli x0 s6 1
-slti s9 s2 1847
-add t5 s1 t5
-auipc tp 945046
-slli s2 t1 28
-auipc gp 316486
-divu s3 a0 x0
-sra x0 s0 s6
-sll s6 a7 s6
-xor s11 s3 x0
-slti s8 a6 204
-or s9 a2 t4
-addi ra t5 -1797
-slt ra s8 a3
-add s2 t6 t2
-srai a0 tp 5
-sltu s4 a1 a6
-mul s1 t2 a6
-andi t2 t5 389
-remu x0 t2 s5
-sltiu t3 a0 1725
-or s5 a2 s5
-slti x0 s1 -1948
-remu t4 a1 a2
-slt s11 t3 a1
-sll s6 s3 s2
-srai s4 x0 6
-srli a6 s9 25
-slli x0 s11 1
-sltiu s1 t3 -1211
-mulhsu gp s0 a4
-divu t5 a7 a6
-sub a1 t1 s11
-addi a1 a2 -1684
-andi a1 s1 -1138
-srli s0 s5 7
-sub s6 a7 s6
-ori x0 s8 886
-slli a1 a5 5
-xori t5 t5 -1916
-mulh a2 s2 t5
-add x0 s0 s2
-sltiu a5 a0 -938
-mulhu a7 s10 t4
-sra s9 a6 t4
-sltiu a0 t4 -627
-or a3 t1 t2
-lui t4 473282
-slti s1 s9 949
-remu t4 gp t4
-slli t2 t3 8
-add ra a4 s6
-auipc s9 80245
-remu x0 s4 s3
-srl a7 a3 a4
-mulhu s7 a6 a0
-xori s6 s2 -1572
-rem s6 a0 s8
-rem t3 s3 s9
-srli s5 s7 1
-lui a6 901878
-slt t4 t4 gp
-or a1 a1 t5
-addi a0 s11 871
-mulhu s2 s3 a1
-and s1 s9 s6
-auipc a2 75412
-auipc s10 6388
-mulhu a6 t3 t2
-add a0 s4 s5
-lui s10 844397
-slti x0 a0 1185
-slli s5 a5 1
-srli gp t6 18
-lui a7 281613
-addi t2 t3 -16
-xor t5 s9 s0
-mulhsu t2 s0 a2
-and s9 s2 s0
-slt s10 t4 s10
+mulh t1 s0 t6
+addi gp x0 711
+sltu a1 gp t0
+add tp tp s5
+or s3 a5 s4
+xori s10 s4 722
+srai a0 s3 8
+add a2 a2 tp
+srai s9 tp 21
+auipc a6 171356
+sltu a3 a5 a0
+mul s11 a5 s0
+srli t4 s6 10
+sll a6 s10 x0
+slli s0 s1 18
+div t2 a0 a6
+sra t2 x0 s5
+divu s3 s7 a3
+divu a1 s8 t1
+slli a2 s11 30
+srai a3 t4 11
+slti s0 ra -1393
+rem t5 s10 t6
+sub a6 a7 s4
+or a7 s7 s7
+slt t4 a6 a5
+addi gp t1 -37
+or s1 t5 t6
+slli s8 t5 4
+auipc a1 725672
+andi s10 s6 -1756
+add s7 s9 s9
+sltu t6 a3 t3
+slli a5 a4 11
+sub s10 t0 s11
+div s11 t6 s9
+sltu s5 t1 s7
+xor a3 tp t2
+and a3 t0 t6
+divu s8 s7 t6
+divu s2 s10 t6
+sra t2 a0 t3
+sltiu t4 s9 -524
+divu a6 s1 t2
+sub a6 a1 s0
+remu x0 s1 a5
+sll a1 a3 x0
+sra s8 a6 a1
+auipc s9 283475
+xor x0 s6 a1
+add s7 s6 x0
+add t6 ra x0
+addi s8 t6 229
+div a5 s5 a5
+slli t0 t5 21
+remu ra s9 s1
+ori s7 t4 -1649
+remu a6 t4 s8
+xori s5 a4 -500
+sra tp a1 gp
+sltiu s1 s11 -1281
+ori t6 s3 -944
+srl a5 t2 a5
+divu t1 a4 gp
+sltiu t4 a7 2021
+divu a1 a4 s4
+mulhsu a5 s8 a3
+andi a3 tp -330
+add s4 s5 s3
+srl x0 gp s3
+mulh t3 s9 a3
+sll s0 t6 a0
+div s9 a6 t1
+mul s11 s8 ra
+sra a2 x0 s6
+xor a1 t0 a1
+srai a5 s1 30
+srli s11 a4 4
+slli a3 s7 17
+slli t3 a5 11
+slt s3 t3 s2
+mulhsu gp s3 s2
+lui s6 12136
+xori x0 ra -533
+sll s1 s10 t1
+mulh s6 a5 gp
+andi x0 a3 -223
+lui a2 332875
+remu a3 s5 s6
+mulhu s2 a1 s4
+andi a4 tp -957
+ori t5 s4 -236
+mulh a7 a5 a4
+mulhu s8 ra a4
+addi a4 t4 -507
+xor t2 tp a4
+mulhu a6 a6 a2
+xori s0 x0 -1300
+slt gp x0 gp
+sub a4 s9 s10
+slli t2 a5 31
+andi s3 a0 1327
+auipc x0 417765
+remu t5 s11 a5
+and a1 t0 t2
+srl a3 a1 a4
+sra a1 x0 a3
+auipc a7 882150
+slti s5 s9 -601
+srai s1 t3 3
+slli s4 ra 10
+slti s11 t0 -349
+slt t0 a6 s1
+and tp t5 t5
+srl s1 ra a0
+divu t1 s10 s6
+lui t2 399062
+rem s9 ra s8
+sub tp s10 s4
+rem t4 s6 x0
+mulh a2 s11 t2
+or t0 t4 x0
+ori t3 s2 809
+sll a2 t4 s7
+sltiu tp s10 -1330
+addi s5 a6 -517
+slli ra a2 25
+sra t1 t5 s8
+add t2 s5 a2
+slt s11 s5 t2
+sltiu gp a7 680
+andi tp t0 1130
+ori t6 a3 1842
+auipc s3 467998
+sra a3 s1 s7
+mul a3 x0 a3
+andi a7 t4 380
+and t2 x0 gp
+addi s5 s6 -850
+or a3 s4 tp
+sltiu x0 a6 1158
+rem t3 s0 x0
+sub s9 s4 s1
+sll s5 ra a6
+mul s6 t3 s9
+lui ra 417860
+or s5 a1 ra
+and t6 s11 a1
+sub s1 a6 a7
+andi a7 s6 -860
+remu s4 a0 a2
+slli s2 ra 15
+sltu a2 s0 t3
+srli a3 a7 4
+add s11 t3 ra
+mul a1 gp s11
+sltiu t5 x0 198
+ori s8 x0 -1100
+mul t2 a6 x0
+sltu tp t5 t0
+and t0 s0 a2
+auipc s0 122961
+auipc a6 797824
+slti a4 s7 -314
+ori s5 s4 -1956
+add a6 a4 s11
+mulhsu t4 t0 a2
+addi t0 s3 -253
+divu t0 s0 x0
+remu tp a2 s7
+sltu t0 a4 s3
+sub x0 tp s6
+sll t6 s6 s4
+sra s2 a4 a2
+add s4 x0 s5
+srl s6 t0 ra
+remu a1 s2 t3
+divu s3 s7 s11
+lui gp 367064
+srai t5 tp 7
+div a4 x0 s11
+mulh a5 s8 s0
+andi s6 s7 807
+xori tp a0 -956
+auipc t2 956659
+or s3 s6 s11
+srli s7 ra 21
+sub a2 t3 a3
+andi x0 t3 1050
+remu a5 t1 a4
+sltiu x0 ra 282
+sltiu a5 ra 1796
+mulhsu s6 t0 a6
+auipc a1 44715
+slt a6 a1 t3
+or s3 s4 t5
+lui x0 937938
+sll t4 s11 s6
+slt s1 t0 x0
+mul a0 t3 t2
+lui a0 13108
+mulhsu x0 s3 t5
+slti t2 a4 -1951
+sra t0 t6 a5
+addi s7 t1 1218
+slti s9 a4 -317
+mulhu s2 s5 s5
+mul t3 t2 a1
+sltu tp s2 t6
+xori t2 a6 -474
+sltiu x0 s4 -11
+remu tp s10 t5
+mulhsu s9 t3 t2
+slli a6 t1 5
+sltiu a3 t6 1615
+sltu t2 a0 a6
+and a7 x0 a6
+div t4 s8 a1
+mulhsu x0 s3 s7
+sub a6 a5 t2
+srli t0 a7 20
+addi a2 s11 -76
+sltu s0 a2 ra
+srl s8 s4 a3
+slt t0 a7 t3
+srl s5 t2 tp
+divu s6 s6 s1
+remu s3 t4 t0
+or s2 t5 a5
+divu t5 s0 a0
+addi t6 gp -169
+srl x0 s1 t3
+xor s6 ra tp
+mulhsu s8 a4 s1
+sra t2 a0 s10
+sub a5 a6 s10
+srl s5 t0 s0
+rem a3 s10 a7
+lui s7 354383
+sll a1 t6 t6
+mulhu s6 a6 a3
+remu a5 a5 a2
+srl s8 x0 s2
+add s2 s10 s9
+srai s7 s11 27
+mulhsu t4 s2 a1
+auipc t3 54515
+ori t2 t2 -459
+mulhu t3 s8 a4
+srl t4 s9 s10
+mulh a7 s7 s1
+remu s5 tp tp
+sub s11 s5 t3
+mulhu a2 s10 t0
+sra t3 s5 s10
+and s9 gp t1
+xor s8 a5 t5
+mulhu s2 s4 s0
+slt a4 a1 gp
+sub a3 tp s2
+sltiu ra tp -675
+mulhu gp t6 s9
+mulh s3 a6 s3
+div t2 s7 s1
+slti s7 s2 -1188
+auipc a0 567083
+mulhsu s5 t4 s10
+slli s7 ra 2
+mulhu s6 t0 t4
+srai t2 a6 17
+divu tp t0 a5
+lui a2 361037
+sra a6 tp a0
+sltu s2 s8 s11
+srli t1 tp 11
+andi a0 s7 -1463
+srai a2 tp 24
+srl s10 t0 s7
+srli s11 s0 14
+div t3 x0 a2
+and s5 s4 s7
+or t4 x0 a6
+slt x0 t2 s5
+sltiu t0 a2 276
+ori s10 t6 -822
+xor a4 a3 a1
+rem a7 t0 a4
+xor a3 t2 x0
+and s0 s11 s2
+mulh tp s5 s4
+or t2 s0 s8
+xori s5 ra -473
+mulhsu s5 a1 s7
+remu s8 s8 t5
+slt x0 t1 t0
+xori a5 s7 -980
+slti s4 s2 -1715
+sll t3 t6 a1
+mulh t2 a4 x0
+sltu s0 a7 tp
+slti s6 x0 1293
+auipc t6 1006963
+auipc s1 640640
+addi s2 ra -759
+auipc s2 1013629
+sub t4 a5 a7
+xor s6 tp s1
+divu t6 s10 s7
+srli x0 a2 12
+auipc t6 139356
+slt tp t2 t0
+or x0 gp t2
+remu s11 x0 a5
+sub s8 t0 s4
+sltiu a7 s8 1521
+rem gp t3 t1
+sub s3 t3 s2
+sra t1 a0 s3
+mulhu x0 t5 ra
+add s9 s3 t3
+xor x0 s8 a5
+andi s11 s10 -1488
+sll a2 a3 t2
+auipc a6 857436
+slli a0 s4 24
+mulhsu a3 a1 s11
+mulh t2 s11 s3
+addi s4 s4 367
+slt s2 s2 s7
+mulhsu s6 s7 s8
+srai x0 gp 17
+mulhu s7 x0 s8
+ori gp s9 193
+sltu s4 t5 s3
+lui x0 738569
+slti t4 a1 -1722
+srl s11 a2 t5
+slti a0 t4 -585
+divu s1 ra a1
+andi a7 a1 1777
+slt s2 x0 a4
+srl s8 s6 s4
+remu s10 s3 t0
+sub t6 s8 x0
+divu a4 s5 x0
+mul t6 x0 ra
+mulh s3 a0 a3
+rem ra a6 tp
+slli s1 s7 7
+divu tp t1 ra
+mulhu s3 x0 s6
+add s11 a3 a4
+sll a5 a2 t3
+mulhu x0 a0 s4
+slti tp t5 1344
+auipc gp 634382
+lui a1 513019
+srai s7 x0 25
+srli a6 s8 16
+slli s9 a4 23
+auipc t0 472607
+and a0 t3 a4
+remu ra ra ra
 srl a4 a6 s11
-lui t3 524173
-slli x0 s5 3
-add a0 s0 t3
-rem a5 s7 ra
-and s2 a6 t3
-andi s1 s6 1287
-sltiu a2 a7 -87
-xori t2 tp 1117
-auipc t4 649357
-mulh s1 tp a7
-slli s2 x0 9
-srl a4 a6 ra
-sra t3 s10 ra
-sltu s1 t4 s2
-mulh s0 a3 t2
-sltiu x0 a2 -803
-xor s3 s10 gp
-xor s0 a1 a3
-srl s11 s7 gp
-add s4 s1 a7
-addi s1 s8 -1297
-sll s7 x0 a5
-and s8 s0 s9
-mulhsu t2 a7 t1
-andi s5 a0 -1118
-rem t5 s8 gp
-rem a2 a5 t2
-remu s1 s10 t3
-sltu x0 gp t1
-srai s3 s7 25
-or s4 s9 s11
-and a1 a2 s6
-addi s0 s3 -94
-xor s5 s0 s10
-sub t4 t2 t0
-srl s10 a4 gp
-srl tp tp t0
-xor gp s3 s2
-sra s9 s3 s2
-srai s0 s10 14
-addi s3 s2 -107
-or ra s8 ra
-srli s6 s1 0
-and s8 s2 s11
-auipc x0 476506
-rem ra s9 s3
-rem s10 a5 s8
-andi s1 s10 -1321
-auipc s3 131720
-srai a4 a5 13
-sub t0 a7 s8
-auipc t2 363608
-mulhsu t5 s5 x0
-slli s11 a0 16
-divu ra a1 t5
-mulhsu a0 s4 s5
-rem a7 a4 ra
-mulhsu s4 s8 t4
-or s11 s6 s6
-lui a0 887988
-auipc tp 424400
-sra a4 s6 x0
-srli s9 s5 17
-srai a3 t0 29
-slti a1 gp -423
-slli s11 tp 17
-rem x0 s11 gp
-mul t4 s9 s2
-sltu a7 ra a6
-and s1 s5 tp
-lui t0 678744
-srl s9 s11 t0
-mul a7 s9 a5
-addi a3 t1 1578
-srai s6 s6 27
-auipc s1 203369
-sltu ra t0 a4
-slti s0 a1 -1274
-lui tp 200799
-auipc s0 505592
-and t5 a0 t2
-sra t1 t1 s1
-xor a4 t4 tp
-div a6 s10 t0
-add s11 x0 s6
-ori t6 a4 -1930
-and a1 s4 a6
-add s9 a4 s2
-sltu s5 a4 s11
-ori t5 s10 -2037
-sub s0 s3 t0
-remu s11 a5 s6
-mulhsu t6 s10 t4
-auipc tp 645928
-div ra s7 s7
-slli t1 s8 17
-srl s3 s6 s2
-andi gp s11 -1432
-sltu s2 s9 s2
-andi t6 a0 320
-slli s2 s11 22
-or t2 s5 a7
-mulhu s1 a7 t6
-srai ra a2 17
-srl a4 ra s2
+rem s7 a6 a2
+xori x0 s11 2007
+srai s10 a7 1
+divu t3 a5 a1
+addi s11 tp -1121
+div a6 ra t2
+or s8 t4 t5
+and s7 t4 x0
+slt a4 t6 s7
+add a5 s7 s9
+addi a4 a1 -1217
+xor s4 ra tp
+sll t0 s6 s0
+ori a0 s11 -388
+srai a1 a0 8
+addi s6 t5 253
+div s3 gp a7
+sltu s0 a0 tp
+remu t6 s11 x0
+slt t3 s9 s4
+xori t4 t1 217
+mulh s4 t0 s8
+slt a4 tp s3
+slti tp s10 -627
+divu a3 ra a2
+ori s1 a5 1828
+slli gp s2 30
+slli a3 a3 19
+andi t0 t2 -1362
+sll s1 s3 s7
+auipc a1 357124
+sub t0 a6 s11
+mul x0 s6 s0
+mul x0 s1 a5
+slli ra ra 30
+xor a0 a4 s3
+mulh x0 ra t5
+srai s4 t3 13
+xori s1 s3 -1972
+or s9 a2 s0
+addi s1 s4 -1395
+slli a5 t0 24
+slt s7 s0 s1
+srl t6 s4 x0
+rem a6 gp s1
+sub t2 s10 a3
+sub s5 a3 s4
+mul a6 t0 a2
+slli s6 s4 2
+divu t5 s8 s10
+sll a4 a2 ra
+slli a0 s3 15
+andi t5 s5 900
+mulhsu a3 a1 s10
+xor gp s10 t5
+sll t6 s11 a2
+srli s6 a7 11
+ori x0 s3 -1895
+sra t2 a4 a0
+divu a3 s7 a5
+remu a7 a1 s9
+slt a3 x0 tp
+mulhsu s10 s10 tp
+divu s5 a4 gp
+sra a5 t4 a3
+sll s4 a3 x0
+rem x0 s4 a5
+sll t5 t2 s0
+srli a7 ra 28
+srl t3 s9 t6
+div a0 a7 s9
+add s0 t2 a4
+srli s7 a2 1
+ori s9 t0 -660
+div ra x0 tp
+xori t3 gp -181
+mulh s9 s10 a5
+div t1 x0 s7
+slt t3 a7 s9
+and t2 a6 s8
+sub s7 s4 a2
+mulhu s1 a4 t5
+sub s3 a0 t4
+slli s1 s1 5
+ori s3 s1 -118
+remu t5 s10 a7
+auipc s6 17207
+xor a3 a7 a1
+remu s3 t6 t2
+sra a2 tp x0
+addi a3 ra -210
+div gp a0 t4
+addi t6 s6 -602
+auipc t3 604265
+remu s5 s7 s5
+mulhsu gp t1 t1
+mulh s2 s6 s5
+mulhsu a5 a0 a7
+addi s9 s3 -1649
+srai a3 t2 15
+lui a5 1033258
+or a5 t2 t3
+ori s7 s9 334
+ori a2 a1 1896
+slli t6 s7 27
+slli t3 x0 29
+ori t1 a6 903
+and t0 tp t0
+sub x0 a4 a5
+divu a0 s4 a3
+rem t5 a0 a5
+div s9 s7 a2
+rem s4 gp t0
+xori a2 s2 733
+mulhsu t2 t1 a5
+sub x0 t4 s4
+divu s8 a2 s5
+mulh a5 s5 a2
+mul t4 s3 s6
+rem a2 a1 s3
+andi s11 tp -470
+slti s4 a1 -2009
+and a5 s2 s1
+sltu a7 a5 s0
+and s2 s3 s5
+sub s0 a6 t3
+divu a2 a7 t5
+rem a5 a7 a4
+xor s7 t2 a3
+sltiu s10 a4 -1063
+xor a6 s11 s2
+add s11 x0 x0
+sltu s0 s3 s0
+mulh s10 s3 s1
+mulhu t2 t4 s11
+slti x0 gp -427
+srai s1 t6 11
+mulh a7 gp s5
+ori t5 a6 550
+xori s0 t0 484
+srl s11 tp t3
+sub s1 t0 s1
+mulhu t0 s5 a4
+div a3 a0 x0
+xori s5 a1 437
+divu gp t5 t2
+divu s5 s5 s10
+remu t6 ra t0
+mulh gp a2 a0
+xori s9 s3 -1149
+and a6 a2 a5
+srai a3 t1 28
+remu s11 s7 s3
+slti t3 a3 1607
+slt t4 t6 t6
+sll a1 x0 s1
+slt a7 a5 a7
+srl s6 a6 s9
+sltiu a7 a7 -1728
+sub a6 a4 s6
+auipc s7 923512
+sll gp a6 tp
+sltu a6 a7 s2
+sra a4 a0 s9
+ori tp s5 1168
+auipc t1 362690
+mul s6 gp s7
+mulhu a4 s1 a5
+remu tp s11 ra
+srl s10 a1 a2
+mulhsu a2 t6 a4
+xori x0 t6 30
+auipc tp 212504
+sltiu s11 t0 -1580
+add s0 a4 a4
+div s9 s3 s8
+xor t6 t0 s10
+slti a6 a3 -651
+divu t2 s1 a3
+ori s0 s5 -302
+addi s9 t3 -746
+remu s7 s10 x0
+sltiu s0 t5 -784
+mulh x0 x0 a4
+and gp t6 t5
+auipc t4 878574
+sltiu a4 a3 -1437
+divu t2 s6 a5
+xor a0 s6 a2
+srli a6 s9 21
+divu t6 a1 ra
+mulh x0 s6 x0
+lui gp 986001
+and s10 x0 t3
+slt a2 t6 x0
+mul a7 t4 a1
+lui s5 306936
+sltiu a4 t0 -659
+mulhu x0 s10 x0
+ori a4 s0 1316
+slli t3 t3 26
+auipc s7 499610
+slt x0 x0 ra
+xori t1 ra -226
+and t1 a7 t1
+sub s8 s6 tp
+andi s8 s4 -838
+sub a0 ra gp
+mulh x0 s10 a2
+div a5 a6 a6
+mul a3 ra s1
+add t5 s4 s7
+auipc s10 201621
+xori s2 t3 -303
+sltiu s5 t0 603
+add a3 a4 a0
+addi s4 x0 -958
+ori a7 a0 -1643
+sltu s11 a1 s10
+sub s10 s2 s11
+sub s10 t4 t3
+lui s8 343489
+remu a5 s1 t3
+and s8 t2 gp
+slt s6 a3 s3
+add s5 t4 s10
+add s2 a5 a6
+mulhu a6 s9 s8
+slti s3 a3 -1706
+slti t3 t3 1215
+slt x0 s2 t6
+sub t6 a6 t6
+and a1 t2 tp
+srl s3 s0 a3
+sll x0 x0 a2
+add a3 x0 a5
+sub t5 s11 t6
+remu x0 s5 t2
+sll s11 s5 s8
+andi s6 t5 -932
+xor t3 s1 x0
+andi s2 s11 23
+slt s11 s1 s1
+slt s6 s2 s0
+mul s3 s10 s6
+xori a2 a2 -186
+srl t1 tp s3
+add a5 gp t6
+mul t2 s11 a3
+addi s8 t0 -1914
+addi a6 a6 1619
+sub a5 tp s6
+xor a0 t1 t2
+mulhu s11 s9 t3
+ori a0 t4 1249
+slli s4 t6 23
+addi a4 t5 -1572
+sub t0 a6 gp
+divu gp a7 t2
+sltu s2 ra t0
+slt t2 s10 s5
+sub s6 s0 t0
+div a4 s6 s5
+srl t5 s5 a5
+or s3 x0 a1
+auipc a7 541690
+or a6 a7 t3
+slli a4 x0 26
+sub a6 t1 s3
+and a0 a2 tp
+mulh a2 a7 s4
+sra x0 s9 s1
+srai s0 s10 15
+srl s0 s5 s5
+auipc t0 166658
+mulhu s8 x0 s5
+remu t0 a2 a7
+sll s5 t6 t0
+srai x0 t2 25
+ori tp s8 505
+srai a0 a7 22
+srai a0 a5 30
+srai a0 s2 30
+divu s10 t4 s8
+xori a3 a6 189
+sltu s6 s3 a0
+andi s5 s1 1067
+mul a1 a3 a5
+remu x0 a5 a7
+slti a0 s3 754
+xori ra t6 -1045
+slli t0 s0 3
+auipc s2 388759
+sltu a2 t5 ra
+xor tp s4 s4
+mulhsu s7 a0 t1
+auipc tp 223790
+mulh t4 s5 t2
+ori s5 s7 -803
+mulhsu ra s5 s11
+sra t1 a5 t2
+mulhu s3 s3 a3
+and a4 t5 s3
+sltiu x0 s6 -113
+lui s6 1022768
+mulh ra ra s3
+mulhsu s7 gp a6
+or ra s1 s2
+srl t2 a7 a5
+divu t2 tp s1
+auipc s11 399252
+srli x0 gp 29
+addi t3 s5 -1459
+sra a3 t6 x0
+srai s8 ra 8
+sltiu t0 s3 -1250
+mul t6 tp s11
+slli s2 t5 6
+mulhsu a7 x0 t3
+div t2 a3 t5
+srai t2 t1 8
+sltiu a1 a5 -1203
+xor gp t6 s5
+sltu a6 t1 t6
+mulh t2 t6 a1
+lui gp 622175
+sll s8 t3 s3
+sltu s5 s2 t1
+sltiu a7 x0 -1862
+rem s3 s9 s0
+slli a5 ra 14
+auipc s6 631637
+slt a4 s11 s1
+and gp s7 s8
+srai a6 a4 7
+slli t5 ra 27
+mul x0 s1 s11
+addi a7 gp -1354
+andi t6 a6 -1985
+div gp s2 s9
+addi s0 a5 840
+mulhu a0 a5 s1
+add s0 s9 t2
+sra s3 s2 a6
+mulhu a4 s7 a1
+srli a1 t4 27
+sub a6 t4 a4
+mulhu a6 a0 s8
+srai a4 s5 16
+add a2 t5 a3
+mulh s4 a0 a5
+xor t1 s4 tp
+slli s0 s5 18
+mulhsu a1 s6 s3
+rem s10 s6 a0
+remu t0 x0 a2
+slt a7 a5 ra
+slti s0 a0 1741
+mulhu t0 t5 s4
+mulhu ra t3 a0
+sra tp s3 t3
+sra t3 a3 s11
+lui a4 332747
+remu a7 t0 t1
+div s11 s9 t6
+remu t1 a0 a3
+remu a1 t3 s5
+and s3 a4 t4
+addi s5 s1 -1530
+xor x0 a1 x0
+slti a7 s10 -218
+rem a7 t3 a6
+sra s4 gp s3
+addi t6 t2 -1611
+sub t2 t0 ra
+sll a3 s6 s4
+or t0 s2 s4
+addi ra s2 -753
+mulhu s6 t2 t4
+mulhsu a4 s6 s1
+rem a1 a5 t0
+slt s4 a7 t6
+sll s10 a6 ra
+mulhsu s7 a7 s11
+and s0 t1 ra
+sll a2 a4 s6
+andi t2 x0 -429
+srli tp t3 13
+andi s2 a7 -1303
+xor a5 x0 a5
+rem s0 x0 x0
+and t3 s1 a5
+srl s6 t5 a0
+sub ra s10 a3
+slli s5 s8 12
+div a3 s9 a5
+mulhsu s6 s9 s8
+slt s11 t6 s3
+lui a0 972331
+sub a4 s11 t1
+divu tp t3 s7
+and s1 s3 t4
+slt t3 s9 t0
+mulhu a7 s4 a5
+or s3 x0 t0
+or t3 s6 a0
+slti t3 a5 -1460
+mul s1 s2 gp
+sll t4 a7 t4
+mulh gp t3 a6
+andi a4 s7 -642
+mul s7 a7 s3
+mulhsu x0 s10 a5
+addi a4 s4 -1763
+and t6 s4 a3
+or t3 t4 s7
+sll tp s0 t5
+rem a7 ra s8
+xor x0 s11 a6
+ori x0 a3 923
+divu s7 s9 s0
+slli t0 t4 0
+mulhu s2 a0 t1
+xori tp t1 -1746
+sltu s3 a4 t0
+sra s0 s6 a5
+srli t6 s5 0
+mulhsu s1 a2 s10
+srl x0 a1 s9
+ori x0 s9 1795
+and a2 t2 x0
+auipc t0 223967
+and a0 t3 s7
+or s1 a7 s5
+or t1 a7 s6
+ori t6 a1 -340
+lui s0 777815
+divu s4 a4 s9
+sub s4 s0 s5
+and s4 tp t0
+sra a3 s1 s2
+rem s10 a1 t5
+add s5 s3 s11
+or a3 ra a4
+mulh a5 ra a6
+or x0 a5 a5
+srl a3 t4 a3
+xor a0 t1 t3
+srli x0 t0 2
+or ra t1 s3
+andi s7 a7 -1346
+mulhsu t4 gp a4
+addi ra a1 -44
+mulh s0 gp s9
+sltu s8 ra a5
+xor s8 t6 s11
+andi a2 t2 -1338
+divu a3 t0 a2
+add s6 a0 a3
+mul s5 s7 s7
+add t1 s0 t2
+sub t2 s10 s3
+ori t1 s7 -15
+sub a7 t6 a3
+srli ra a3 23
+div t5 s1 t2
+mulh a4 a0 s1
+sub t3 s1 t0
+mulh tp gp t3
+slti s4 a0 -265
+xor s0 gp x0
+remu s6 s3 a6
+ori s8 s2 -467
+mul gp s5 t6
+auipc s10 626957
+and t3 x0 s1
+srl t0 s4 s9
+mulhsu s1 s5 s5
+lui s9 136675
+addi s5 a0 693
+srai a1 a4 17
+slt t1 t5 tp
+sltu a6 s8 tp
+slti a0 a1 322
+ori s3 x0 1565
+lui s3 507897
+slti s11 s0 -159
+div a2 ra s10
+srai a3 t0 22
+add a5 t3 s8
+and x0 s3 t3
+xori t4 a6 -226
+mulhsu s2 s2 s7
+andi ra s2 1078
+andi t3 s3 -221
+auipc s5 66631
+mulh t3 s5 t0
+mulhu a2 s10 s7
+rem t4 a5 a5
+divu s5 x0 s2
+xor s9 s10 a5
+auipc s7 212169
+divu s9 a3 s0
+addi a7 a7 -695
+mulhu s10 a4 a6
+sltu a2 t3 t5
+andi t3 a3 692
+sltiu s6 t0 2008
+srl s7 s10 a6
+sub t1 a7 a4
+xor s3 t1 s2
+sltiu a0 a3 1828
+or s6 a0 s9
+rem a4 a2 a2
+srai a7 t6 29
+sra s5 s6 t1
+slt a2 tp s3
+srai a7 s9 12
+srli s5 t3 27
+sub a2 s11 t2
+slt t0 x0 s10
+mulhu s8 t6 s10
+mulh s10 x0 tp
+mulhsu s11 gp s2
+addi s1 t4 -1165
+add t2 t2 s6
+div x0 s1 a7
+and s11 ra t2
+sra ra s0 a1
+lui a2 188488
+srai a6 a2 31
+divu t4 s7 t5
+auipc gp 773591
+mulh s10 s8 s1
+srai tp s9 16
+xor s7 s9 s11
+sub t0 gp s6
+xor s5 gp a1
+srli s1 t3 6
+ori t1 s7 -1920
+sltiu s7 s7 635
+remu x0 s5 t4
+addi s7 s7 -556
+and s10 a0 t5
+remu tp s11 a0
+or s9 x0 a2
+sltu s4 a5 a2
+or a1 tp t2
+srai s4 a6 3
+mulhu a7 x0 a2
+auipc t5 729241
+xor a4 a6 a0
+xori t2 a7 -1403
+srli x0 s6 7
+remu s6 a1 x0
+ori x0 s8 1295
+mulhsu s11 a1 s9
+ori s7 tp -763
+auipc t2 719933
+sub s7 t4 s6
+rem a2 a1 a5
+div a5 t4 s2
+slt t2 s0 s4
+sub a0 t3 t3
+divu s11 s6 t6
+srai a4 a0 5
+xori s8 ra -66
+sltiu a0 s0 -1870
+addi t4 x0 -768
+mul ra t2 t6
+xori t2 s2 276
+or a3 t3 s0
+slli x0 t3 31
+div s4 s1 s11
+divu a3 a6 t0
+and t6 s3 s6
+auipc s4 615774
+andi s8 t3 -592
+sltu gp t2 a3
+srai a6 t1 9
+mulhu s6 t5 t4
+auipc a0 294638
+sltiu s5 a3 1582
+srl t5 s3 a1
+sra a0 s11 s3
+mul s8 s3 s2
+slli t2 s0 20
+srai s5 a3 16
+srai a6 t1 7
+addi a4 s1 1197
+remu a6 x0 t6
+mulhu a6 a5 s2
+mul gp a6 a5
+slli t0 a0 8
+mulhu a6 tp t4
+ori s9 a2 -1925
+sll a3 t1 a3
+ori s8 gp -1364
+or s1 a5 a0
+sltiu t5 s5 -144
+sltiu s3 s1 -1269
+slti a7 t4 -266
+auipc t6 682147
 sub s10 s8 a7
-sra ra a1 t0
-add t3 t1 s6
-and a2 s0 s0
-add gp a1 s5
-rem t2 gp s2
-div s2 s6 t2
-xori tp t3 -1492
-rem s10 a6 s9
-add s9 x0 tp
-rem t0 a0 s11
-divu a4 a6 x0
-addi s11 t4 -1277
-xori gp a5 -361
-srli a5 s10 19
-ori s5 a5 -1318
-ori a0 a1 -574
-remu t3 t1 s1
-sra s1 x0 a4
-divu s2 s2 a4
-sll t2 s5 tp
-ori s10 t5 -613
-and s10 t5 s2
-srli s10 s7 14
-remu a0 t6 a2
-ori x0 s1 -508
-sub x0 s4 s1
-addi a1 s9 -1137
-andi a0 t4 1961
-sltiu s9 a3 -882
-mulhu s6 t3 t0
-mul x0 a0 s7
-sub gp s3 s7
-and a7 s1 x0
-rem gp x0 a3
-lui t4 486195
-lui a7 617248
-slt t0 t1 a7
-srli gp s1 31
-xor s8 ra a4
-mulhsu t2 s5 s8
-sltu t5 s7 a5
-ori s6 a0 -1518
-mulhu s11 a6 s7
-srai a6 a0 29
-divu t1 s10 s2
-add t6 ra t6
-and t6 s4 t0
-add s8 a4 x0
-ori t2 s5 -251
-mulh s4 t4 a3
-addi ra x0 -927
-auipc a7 977987
-or s7 gp a5
-andi a5 t6 278
-slt x0 a2 a7
-addi a2 s8 -1216
-mulhu tp t0 gp
-addi t6 s4 -110
-remu a3 a2 a5
-auipc ra 167733
-sll t0 s8 s2
-rem ra x0 ra
-srl a4 x0 s2
-or s9 t5 ra
-mul s3 t4 tp
-srli s5 gp 31
-auipc t2 580228
-slli tp s6 5
-andi t0 s3 -379
-xori s0 a0 -990
-add s10 t0 s10
-srli t1 s7 23
-xori a6 a5 -503
-mulhsu x0 a6 s2
-sra s8 t5 x0
-slti ra t2 880
-divu s10 a4 s1
-slt a2 a3 s10
-sra a4 x0 t4
-srl a2 a7 s3
-xori t6 a0 595
-divu s1 a2 s5
-slli gp a5 17
-rem s3 ra gp
-addi t4 s2 -497
-andi a0 t6 -626
-mulhu s5 s5 a1
-divu x0 a5 ra
-xor t3 s6 tp
-mulhsu s9 a3 s5
-sltu s2 a1 a4
-sll s5 gp x0
-srl s6 tp t4
-srli s5 x0 22
-div t6 a7 gp
-srai s10 a7 20
-sltu t1 s2 ra
-sltu s2 s3 s10
-rem t6 s1 s7
-slt s7 t0 s5
-srl s5 gp s9
-srli ra t5 12
-divu t1 s11 a2
-slti s6 ra -965
-auipc a4 218291
-and s6 s4 a4
-srai a7 tp 19
-xori s2 t5 1522
-xori t6 t4 800
-auipc t2 428616
-mulhu a7 a3 a6
-mulh a1 t5 s7
-lui s5 370706
-addi a5 s4 -1164
-remu x0 gp s5
-mulh s2 a0 x0
-srl t2 a3 t6
-and a6 x0 a1
-sltu a5 a7 a2
-divu a1 x0 s10
-mulhsu tp a5 t6
-mulh t0 a5 x0
-sra s4 a6 a6
-sub s9 s6 t5
-xori s8 s5 -1921
-xori x0 t4 -1435
-sub x0 t2 t1
-mulh s4 a2 t4
-and s3 t5 tp
-sltu s0 s4 x0
-slti s0 s7 -43
-srai t6 t2 7
-or s4 tp t5
-sub s6 a6 t0
-and s9 t3 t3
-mulh s3 t2 s1
-slt a1 s11 t2
-sub t2 t3 a1
-srli s6 s10 16
-addi a0 a1 -1745
-srl s0 s9 a7
-srli s1 s11 29
-divu t3 a4 t5
-mulhsu s8 a1 a0
-or t0 s10 s9
-auipc t3 773355
-add s1 s6 a1
-xor a7 s1 t6
-xori t4 a2 -1047
-sltu s0 a6 s6
-mul t4 s10 t5
-auipc s9 1039160
-auipc a1 702087
-xori a0 s9 -884
-sll a2 a6 t2
-remu s3 s9 a1
-srai t5 t1 21
-andi t6 s9 -403
-srai s8 t5 17
-srl a3 t0 s3
-divu x0 a2 a2
-div s4 a1 s9
-auipc s8 745250
-and t2 s6 a0
-sll s0 s0 s5
-or a5 a0 s9
-slt s5 s0 gp
-divu s0 s3 t5
-mulhu s9 s0 s5
-slti s6 a6 581
-and t5 a7 t1
-xor s6 ra tp
-lui s7 523177
-sll s3 ra a3
-xor s5 s3 s1
-mulhsu a6 t4 s7
-xori t1 s3 -1304
-mulh t5 a5 t0
-slti s8 s0 -557
-add s2 s9 a0
-rem a5 a6 t0
-andi t5 x0 -564
-andi a6 a7 -1242
-or s6 s10 gp
-lui s2 851841
-slli s11 t4 17
-slti s7 t4 -21
-slli x0 a7 3
-or a2 s3 a4
-divu s2 s2 tp
-and s2 x0 s8
-addi s11 s2 1958
-andi s9 a1 -955
-xor t3 ra t0
-xori t3 s10 1536
-addi a5 a2 -835
-sltiu s9 a7 -220
-slt s6 a4 s5
-remu tp s4 x0
-sll t6 t6 s3
-lui s4 196645
-lui a0 751687
-or tp t1 s2
-slti tp ra -1554
-mul t1 t6 s0
-srli t0 gp 20
-ori x0 gp -794
-or a6 s1 a0
-auipc a1 512385
-auipc s7 927306
-addi s0 tp -1059
-srai s0 s8 12
-xori s2 t6 -1448
-div s5 t3 t2
-divu gp t3 a5
-div s6 s10 t5
-mulhsu a6 s11 a6
-sltu t3 s9 s0
-auipc t5 753332
-ori s8 a3 1180
-slti s4 t3 -1878
-divu t1 s6 t5
-auipc a7 81788
-xori x0 gp -362
-sub gp t2 s10
-remu t2 gp s4
-mulhu s4 t3 s5
-lui a6 409130
-mulhu ra s2 s9
-sltiu s10 s4 -1613
-and tp x0 s3
-or s10 a7 s11
-sub a6 s6 s6
-divu x0 s1 s6
-divu t0 s9 s11
-and a0 a4 t2
-addi x0 gp -582
-srli s2 a7 10
-lui s7 601977
-srai ra t4 10
-and s0 a0 ra
-xor t0 s8 a6
-mulhu a2 a4 s1
-sll t2 a2 s1
-sll tp s10 a6
-sub s11 gp s0
-lui t2 674567
-divu t5 s7 s1
-xor a4 s2 s0
-srai t6 x0 3
-div a5 t3 s2
-sltu s9 a5 x0
-mulhu t0 s5 t2
-ori t5 t4 -2007
-ori s4 s1 1162
-andi s4 x0 -1396
-and tp s6 s9
-sra t4 a3 t6
-srai a3 a6 31
-div t0 a1 t2
-slt a2 s7 a3
-lui s3 237792
-andi a1 a2 -1768
-sub t6 t3 x0
-auipc a4 286412
-sub s4 a2 s2
-div s4 s4 a0
-srai t6 t6 3
-divu a0 a2 a3
-ori a7 t6 -1880
-remu t5 s8 t0
-slt s8 s6 a3
-mulh x0 t4 s5
-add a1 x0 a3
-remu t3 tp s8
-andi s10 s1 447
-srli a2 s0 20
-addi t5 t1 -1531
-mulhsu s3 s0 t0
-slti a6 t2 -1503
-andi x0 s6 -663
-xori s10 t3 1113
-auipc t0 1018051
-and a4 s6 a6
-sll gp t4 a4
-remu a1 t6 a4
-slli t3 ra 29
-slti s4 t2 -536
-sra a6 s9 a7
-andi s3 a6 -712
+xori t2 s0 -1894
+div t5 s5 a2
+sub t4 t5 gp
+sll a2 t5 t4
+and s11 a0 s7
+mulhsu gp t4 x0
+add x0 a3 t0
+rem s3 tp a0
+slt s8 a2 s4
+add a6 s2 a5
+sltu a5 t4 s6
+xor a2 a7 s2
+remu s4 s4 s3
+and s3 s0 a3
+divu a7 x0 s3
+add t5 a4 tp
+sltiu gp s1 -236
+sub s11 t5 s3
+ori s4 t4 -655
+lui s0 530489
+add s0 tp s8
+mulh s11 x0 s2
+sra gp a3 ra
+slti ra a3 -521
+addi s8 s10 1871
+andi s6 s11 -509
+slti t4 x0 1459
+addi s3 s7 1841
+srli gp a0 22
+slli s7 a2 23
+sll s10 a1 tp
+div a2 t6 t1
+sll s8 s10 a2
+sltu a6 a1 t6
+div a6 t3 a4
+lui s8 980565
+srl ra s1 s9
+and s8 a5 s11
+sltiu s2 a6 -1415
+ori t0 s0 -1731
+lui s2 824296
+sltiu s9 s10 -1340
+slti tp a3 -1353
+slt s2 ra t1
+andi a2 x0 -364
+xor a6 t5 s10
+xor s9 tp a1
+and s11 t6 s1
+mulhu s5 tp a5
+slli t3 a1 3
+sub a1 ra s3
+xor a1 s7 a4
+sra a5 t3 a1
+addi ra t6 -1056
+srli a2 gp 31
+sra s2 s9 s9
+sra s0 x0 ra
+or s3 s10 ra
+and s8 s3 t4
+xor gp t2 t6
+add t2 x0 a5
+mulhsu ra t3 a7
+sub gp tp a7
+sub s0 s7 a2
+div a4 t2 t1
+mulh s1 x0 s9
+mulhsu x0 s1 s7
+sra s1 s8 s10
+div a6 x0 t5
+srl a4 x0 s9
+sra a1 a4 gp
+or a1 a2 t4
+sra s9 t3 a6
+auipc s5 221840
+rem x0 s3 t2
+slt x0 ra s2
+srl s1 t0 s7
+and s5 a6 a5
+auipc s4 978340
+slli s7 a7 19
+add t6 t1 a4
+lui s3 1015006
+sltu x0 t1 s1
+rem t0 t1 t6
+sll a0 x0 t0
+addi s7 a5 -1629
+mul a0 a4 a7
+xori s4 s1 692
+rem a6 tp x0
+srli s8 a5 16
+srai a2 a1 4
+srl t4 t0 t6
+or t4 t5 s2
+addi gp s2 -1731
+sltiu t0 a5 -1929
+auipc a7 37627
+add s10 t3 ra
+divu s9 t4 s8
+mulhu a0 s2 a5
+slti s11 a0 -294
+remu s9 a1 t6
+mul s7 a1 tp
+div a2 s11 t1
+and a1 a1 ra
+srl s10 x0 s5
+mulhsu s5 t5 a1
+addi s3 s11 -765
+srl s5 t4 a0
+srl s7 s10 a5
+andi s7 s2 -234
+srai a2 s10 17
+mulh s2 t5 x0
+ori s6 s4 -3
+srai t5 gp 9
+mulhsu a7 a6 gp
+slti s5 ra 140
+srli tp s2 16
+rem t1 s2 t5
+div t0 x0 s3
+rem s0 a4 s3
+lui a6 208587
+mul t4 x0 a6
+add x0 gp gp
+sll t4 s11 a1
+sltu t2 a3 a1
+sltu ra s1 x0
+sltu a1 t0 s7
+srli tp a3 1
+xor a6 t5 t4
+divu tp s8 gp
+slli a1 ra 15
+sll a6 s6 t2
+srai a3 s2 17
+xori a7 s2 -162
+mulh a6 a7 s4
+sub t1 s0 a0
+slt s5 a0 s3
+andi a2 t4 178
+rem gp a7 gp
+slt x0 x0 s1
+and s3 t6 s7
+addi t0 a6 896
+srli s5 ra 5
+ori t5 s0 481
+or t2 t5 a5
+or a0 a2 t1
+slli a0 s10 9
+mulh s11 a2 s8
+ori a6 gp -1385
+mulh a4 t6 t2
+sub a7 a4 tp
+sll tp a3 s0
+divu ra s9 s1
+remu s3 t0 s2
+addi t6 s7 523
+slti a6 s2 -2022
+xor x0 a5 a3
+and a5 t2 a6
+xori s9 a0 238
+slti t6 a3 296
+or s9 s6 a2
+sra a7 s3 t6
+mulh x0 s5 s0
+lui s0 367395
+remu a2 a4 t5
+mulhu s8 t5 t2
+or a0 t5 s6
+ori a2 s3 1335
+andi t4 t0 -513
+andi x0 t1 -1162
+sltu a2 t1 s8
+slli s6 s3 20
+mul s5 a2 t1
+add s0 t2 ra
+mulhu t4 s7 s1
+mulhu a4 s3 a5
+srli t5 s2 20
+sub s9 t6 a0
+srai s3 x0 14
+mulhu x0 s9 t4
+slli a1 s4 15
+sltu tp s7 a6
+xor s1 gp t2
+div s1 tp t0
+slt s1 s3 a1
+slli ra t2 14
+xor a5 t1 t4
+sltiu s6 s11 -1121
+sll a4 s4 a5
+srl s8 gp s1
+sll s9 s2 x0
+or s3 s8 ra
+remu t0 a3 t3
+div t6 t4 a6
+and s11 gp gp
+slli a4 s2 23
+sub a0 tp a6
+and t6 t1 x0
+xori t5 a6 -1419
+andi t4 s4 678
+sltu s0 x0 a0
+slti s7 a2 -961
+srl t6 a0 x0
+mulhsu tp s6 a1
+mul s10 x0 s1
+andi a0 s7 -1607
+andi ra gp 450
+mulhsu s5 a1 t0
+rem s2 s7 s4
+mulhsu t5 s0 s9
+add a4 s5 a0
+rem ra s8 s1
+auipc a1 244423
+sltiu s2 t0 1464
+srli tp t6 2
+slli t1 a3 17
+mul x0 t0 t1
+div s6 s5 a7
+mulhu s8 t3 t3
+and s3 s2 a5
+divu s7 a5 s0
+sltu s9 t4 s7
+sltiu a2 s8 -548
+div t4 s4 t6
+slli t1 s10 22
+slti s6 s1 1437
+addi s0 s1 -1875
+addi s1 s11 -1823
+or s3 s9 t2
+sltu s7 a7 a2
+mulhu s2 s5 s4
+div s10 s0 a3
+lui t3 170668
+mulh tp s1 a2
+mulhsu s3 s8 s10
+addi a4 a4 -1891
+mulh s10 t4 a0
+remu s2 a4 a5
+add s7 s6 x0
+sll a3 a2 a3
+slli t1 s10 21
+add ra s10 s0
+xori a3 s8 -798
+sltu a4 s0 t5
+addi t1 t5 -1088
+srl s2 s5 s0
+slt s8 ra t3
+mulhu a5 a1 s0
+mulhsu t5 a0 t3
+addi a4 a5 785
+and s6 gp s1
+slt s10 s10 s1
+srai s8 s6 14
+mulhu a5 s11 s6
+srl a3 a6 s4
+slti a0 s0 -1379
+mulh tp s2 a1
+sltu t3 t6 t3
+srai t4 s8 27
+mulhu x0 s6 s6
+lui a7 928817
+sltiu gp s11 -590
+addi a1 a3 -1429
+srli a5 x0 4
+remu t4 s4 a2
+mulhsu s0 s6 s4
+rem s5 s11 s3
+sra s1 a2 s4
+mulhsu x0 t2 gp
+or t5 a1 s3
+sll s2 x0 a1
+sltu t4 ra s3
+slt t4 s10 a4
+divu a1 a0 ra
+addi s3 ra -907
+auipc x0 963519
+xor a6 s5 a0
+ori t2 a6 232
+mulhu s10 a3 a7
+andi s6 s7 -817
+ori a4 x0 1714
+lui t1 650526
+xori a0 a6 355
+srl t5 tp a4
+andi t6 gp 1398
+sub s6 a2 tp
+add s3 t6 a4
+sra s2 s8 s8
+sub gp s1 gp
+srli a7 x0 13
+xor a4 a7 t0
+or s5 a0 t1
+sltiu a0 a6 -640
+add tp t4 s9
+ori t0 s7 -706
+sll a4 s5 t5
+auipc a0 162183
+divu t3 s1 s3
+remu s4 t2 a7
+sltu s4 t1 t3
+and s9 s11 t4
+remu t6 s1 t2
+and x0 t0 a0
+ori a1 s8 993
+mulhsu x0 t0 t4
+lui s4 745983
+srli t5 a1 14
+slti a1 s7 -994
+slli s4 x0 18
+and a0 ra x0
+mulhsu t0 s10 s6
+mulhu a2 s7 s10
+lui a3 229398
+add a2 t5 x0
+sll a5 x0 a4
+srli t4 t5 6
+ori gp x0 1120
+div t6 a4 t0
+mul s9 s3 s2
+sltiu a4 s1 1885
+lui tp 977032
+and s2 gp x0
+xor t4 s4 s11
+sll s11 a4 s5
+div s7 s2 t4
+rem a0 s3 a6
+div x0 a6 t0
+andi s10 t2 -1678
+or a2 a4 a3
+srl x0 x0 s8
+add x0 t0 x0
+mulhsu a5 a3 a2
+mul t0 a3 t5
+rem tp a4 a2
+sra a0 gp a2
+sub s10 a6 t4
+xori a5 tp 878
+mul s6 x0 t1
+xori s8 x0 -607
+mul s10 s8 s5
+lui a6 958381
+divu a4 x0 a6
+xori s10 s5 1748
+rem tp s0 s1
+rem a2 s9 s5
+lui a0 794375
+xori a3 s1 -899
+sll t3 t5 t3
+srai s6 a2 16
+srl x0 t0 a4
+div t5 t1 s2
+ori t1 x0 -387
+xor t0 t1 tp
+sll a7 a6 a7
+auipc s5 282070
+mulhsu s9 s9 a7
+or a1 t1 t3
+xori s0 a7 -219
 and s4 t3 t0
-or s6 s6 a3
-add a2 a7 s9
-sltiu s1 s5 -597
-div a2 a4 a0
-and a0 t3 a3
-srai s9 x0 2
-and x0 t1 s5
-srli t2 s2 0
-andi t2 s0 1941
-mulh t6 s0 s11
-sll s7 s4 s3
-div gp s1 s11
-and s3 s5 s1
-sltu a3 s0 s11
-sub gp s10 ra
-xor a4 t6 gp
-divu x0 tp tp
-sltiu a1 s6 1109
-xori s4 a2 -1041
-sltu a2 x0 ra
-xor a0 t6 t6
-slti tp a3 -828
-div a0 a7 t1
-mulhu a0 t6 gp
-srli a0 s1 28
-slli x0 t6 30
-mul s4 t1 s10
-mul a5 s9 s6
-sra t5 t1 s2
-add a2 gp t2
-ori a1 s6 -189
-srai s3 t4 14
-mulhsu x0 s11 t0
-xori tp a7 -640
-mulhu a0 s7 a2
-srli s7 gp 31
-srl t5 a5 t6
-slli a1 a4 16
-xori a6 tp -627
-mulh s6 s10 gp
-div s9 s10 t6
-mulhsu t2 s1 a1
-mul s11 s2 x0
-ori t3 t2 -153
-sra t0 s8 t6
-mul s10 s4 s9
-sra tp s0 s7
-srl s2 t5 t1
-sub t5 t3 t2
-addi a1 tp -855
-addi s3 s2 1546
-and s0 s6 t2
-mulhu t0 s8 s7
-or a5 t0 x0
-xor gp s7 a4
-sub s4 gp s0
-sltiu s8 s8 1701
-srl gp t4 a6
-sub t6 s8 t2
-slli t0 t4 5
-slti s3 t1 -107
-auipc ra 307870
-sltiu s6 a5 980
-mulhsu s2 t1 x0
-sub a5 x0 a0
-rem s8 s9 ra
-sll t2 s8 t4
-andi t5 s10 972
-auipc a1 839767
-sltu t0 s10 t4
-mulh s8 ra t3
-lui t1 436558
-and s7 s4 a7
-sub t1 s7 s10
-mulhu t2 s11 tp
-mulhsu s10 s1 gp
-add tp a1 s0
-slti a5 s9 941
-rem s10 s4 a3
-add a5 s7 s8
-slt a2 a3 s7
-srl s7 s6 t6
-lui t1 5209
-auipc ra 241093
-mulhu s3 t1 t3
-addi s2 s6 1582
-srl s8 s2 s7
-sltiu a4 t1 -256
-and t4 s3 a2
-sltu a1 s9 a0
-slti s0 s3 -58
-or ra s5 a4
-xor t2 s8 a4
-slti a3 t2 -23
-slti s11 s11 -1344
-slti s6 s11 30
-divu a7 s11 gp
-srai t6 s0 7
-xor a3 a4 x0
-slti t0 s9 -1598
-slt tp gp tp
-div s5 t4 a6
-mulhu s9 s3 a0
-mul x0 a3 s0
-mulhsu s11 a1 s10
-mulhu s11 gp s7
-auipc x0 489461
-auipc s8 667339
-lui s0 743722
-mulhsu t4 a2 x0
-srai a3 s7 20
-mulhu t2 a5 s5
-srli t2 a1 28
-auipc ra 430228
-sll s0 a2 s9
-lui gp 100806
-slti s9 t3 898
-mulh x0 a1 a0
-div t0 gp t3
-or a2 t6 a1
-div s2 tp s10
-sltu ra t6 s7
-lui s4 978810
-xor t0 a0 x0
-add t6 ra s5
-or x0 a7 a3
-sra s1 s10 s8
-sltiu tp s4 -685
-sltu t0 t1 t1
-or x0 s5 s4
-slt t2 s3 s3
-srli a7 a0 25
-remu s7 tp gp
-mul t6 x0 s10
-sll gp s11 a0
-div tp s4 t3
-rem t3 tp s11
-divu a2 s7 a4
-div x0 t2 x0
-slt t5 s0 gp
-or a4 t0 t3
-srl tp a2 s10
-addi s7 a5 -1154
-rem a1 a6 a6
-divu a5 a4 t3
-xori s8 s2 1749
-srai t4 s7 10
-mulh s10 a6 a7
-remu ra s8 x0
-mulh a5 a1 ra
-mulh s5 a7 t0
-div s1 s7 t4
-addi t6 s6 -435
-and s9 s0 t0
-srl a1 tp s11
-sub t2 a0 x0
-div s8 gp a1
-lui gp 687074
-sub s1 a2 x0
-remu t2 tp a5
-xori t3 t1 -1153
-xor s7 a7 a5
-lui a2 908560
-mulhu s6 t2 x0
-slli s8 t6 23
-sub t0 s7 t1
-div tp s11 t1
-or tp s3 a5
-sra t1 ra t0
-sra s10 ra s5
-srli a7 a0 18
-andi a2 s5 1202
-xor tp x0 s2
-sll a5 t5 a1
-srai ra s3 10
-remu t5 s7 t6
-mulh x0 ra s0
-div tp s5 x0
-divu a1 t0 s5
-xor tp t0 t5
-mulh tp s7 t0
-sltiu a1 s2 -442
-mul x0 t1 s3
-srli a3 a6 0
-and s9 s7 s0
-mul x0 s4 s1
-srai t6 t5 12
-slli t0 gp 13
-addi t2 a7 -360
-or a1 s11 t1
-add t0 x0 gp
-sra s5 t3 s8
-srl s4 a6 t6
-mulhu t4 t0 a2
-mulh s2 s7 a3
-remu ra s2 a2
-sll a3 a1 t5
-div tp a6 a4
-xori a1 t2 -1342
-add t1 s10 t1
-addi s9 x0 -40
-auipc tp 708662
-auipc s7 706006
-srai a6 tp 4
-andi s11 t2 -950
-sltiu t6 t5 -1095
-add s4 a1 s9
-mulhsu s2 s2 s3
-xori s2 a4 -397
-sub t0 a0 s11
-sra s11 a1 a4
-xor a2 s3 t0
-remu x0 t4 s9
-auipc s10 796773
-sltu a3 s11 t5
-sra gp t3 a7
-xor x0 t0 a3
-sltu s3 t0 t6
-srl a3 s8 a1
-sltu a0 a6 gp
-or a4 s2 s3
-sll a0 s5 s4
-divu a2 x0 tp
-sub t0 s11 a7
-mul a6 t2 gp
-mul s8 ra a2
-xori s3 a0 -1847
-sub t6 a4 gp
-and t6 a4 s0
-remu a0 s7 a1
-addi s10 a4 -179
-mulhsu t2 a4 tp
-mul gp t6 t6
-sub t5 s7 t4
-and s4 s6 a3
-sra t4 t6 a6
-sub tp t5 t3
-srai ra a3 0
-andi s3 a7 824
-srl t3 a7 s1
-xor a7 t6 a3
-xor s4 a2 s3
-xori s10 s1 -464
-mul s2 s4 tp
-sll a0 s7 t0
-auipc s5 38324
-add a7 a2 a2
-auipc s9 134574
-mulh x0 s7 s10
-mulhsu t0 s7 t3
-rem s11 a5 a0
-sltiu x0 s2 -1338
-srai a2 s5 22
-srai x0 gp 17
-srai t3 s2 27
-mulhsu gp s8 t1
-auipc s6 703539
-srli a7 s11 22
-addi t6 t6 -1362
-and a5 ra s10
-addi t3 t6 -1984
-and s6 a4 t5
-andi s1 ra -243
-srli tp a5 8
-auipc a1 927197
-srl t4 a6 s8
-srai t2 s9 0
-sltu a1 t0 a0
-slti t4 x0 598
-and a1 s1 x0
-sltiu s3 s8 702
-div t1 a7 a2
-divu t4 a6 s9
-mulhu t5 s2 a5
-srai t0 a2 28
-sra s0 a2 s2
-div s8 ra s2
-addi a3 s0 -1396
-remu s10 a3 a7
-add a6 t4 s6
-xor s11 s3 a0
-rem t1 x0 s5
-mulhu a6 gp a2
-div t1 a7 s3
-and gp s11 s3
-or a1 t3 s0
-slti t1 s5 -1945
-mulhu a2 s5 a3
-srai a4 s5 7
-mul t0 t2 s2
-sll a5 s7 t1
-sll t2 tp t3
-mulh ra s10 a7
-ori t2 a3 1530
-mul t3 s10 s9
-add s0 s5 t1
-andi a5 t0 -1125
-slti tp s4 -608
-mulh a4 a1 t2
-mulhsu s10 a4 s10
-add x0 t4 a1
-divu t2 s0 t1
-sltiu s0 a6 -1582
-mul a0 tp s1
-srl gp a3 s7
-slti a3 ra -110
-mulh a6 a7 a2
-mulhsu t4 s2 t3
-mulhsu s8 x0 ra
-srl gp a5 s2
-srli a4 s7 8
-slti s2 s1 -1050
-mulhsu t6 x0 s8
-divu a7 a7 s4
-sltiu s9 s1 -1731
-add s0 s11 s9
-sub a1 x0 s5
-mul s2 s7 s7
-or x0 s7 a3
-slt s0 s9 s10
-mul a3 s2 t5
-andi s7 t2 1014
-andi s1 a1 -1696
-mul s1 s8 s10
-mul t5 s6 x0
-mul s8 gp t3
-div a7 tp s5
-or a1 a7 s8
-sltu a5 a5 s11
-srli a5 x0 27
-sra gp a1 t3
-add t4 a5 t6
-srli s4 t2 24
-andi s5 a6 1765
-sltu s8 s3 t6
-xori t4 s11 -214
-sll x0 s10 s3
-slt s7 ra a0
-mulh s6 s8 a7
-sll a4 x0 t1
-sub a0 s2 s2
-slti s4 t5 986
-slli a7 a4 12
-or s8 s7 x0
-rem t4 s2 s7
-xori gp t3 -281
-addi tp s10 -133
-slli a7 a2 26
-slti a2 t0 -1186
-sltiu a6 a2 1218
-mulh t3 a7 a7
-mul s9 a3 t0
-srai a0 a4 10
-mulh ra t6 s1
-sltu a2 a4 a2
-lui t2 212231
-slli s9 s4 23
-srli s3 a1 11
-sltiu a6 x0 -478
-srli a4 t6 25
-sll s9 s0 s9
-slti s3 t6 870
-mul s8 s0 s10
-remu s1 t4 a0
-sra s4 a4 s2
-divu t2 s9 a4
-mulh ra s9 a5
-and a3 t4 s6
-sltu a6 s1 t5
-srl s4 a6 tp
-andi a1 a1 -838
-sll x0 t0 x0
-slti s9 s3 -859
-and a6 a1 a2
-slli t2 s3 27
-srli a3 a4 13
-lui t6 13092
-remu t5 a6 a1
-lui s9 855253
-sll t1 s5 s6
-sll a6 a2 s7
-mulhu t5 s1 s8
-addi a3 s11 1502
-mulh a5 a1 tp
-mul a4 a3 s2
-rem s9 s10 ra
-divu t3 s8 s5
-ori a7 s5 -1799
-sltu gp ra a4
-lui t0 827708
-addi s11 t5 0
-divu s0 s9 a6
-slti s6 s4 -1353
-sltiu s3 s4 -759
-srl a3 a3 t6
-sltu s0 a1 a4
-slti s6 s10 -687
-andi s9 s3 -1975
-or x0 a7 t2
-and gp t3 a5
-sll ra s1 gp
-remu s5 a4 a5
-auipc x0 920341
-remu s2 a1 s6
-or t4 t3 s1
-divu t4 s8 a6
-sll a2 t3 t5
-mulhsu s11 s9 s7
-and t1 x0 t2
-divu t3 s7 a4
-xor s7 ra s1
-addi s8 t0 -1167
-or x0 s1 t5
-div s4 t3 a3
-addi s3 s4 -1109
-srai a0 a1 20
-sltiu t1 s5 300
-sltiu a7 gp -354
-slt ra t0 t3
-sra s3 a2 a4
-sra a1 t4 a4
-sll s8 s10 a4
-lui a7 588334
-sll s1 t0 t0
-ori t3 s9 -210
-mulhsu a7 s0 tp
-remu s8 x0 t0
-add a2 s11 s11
-addi a3 a3 -1749
-slli s11 s0 18
-mulhu s9 a3 t1
-rem a1 s8 a4
-add tp s0 s1
-slti s8 t5 -1744
-mulhsu a5 s5 a0
-mul a0 t4 a0
-divu gp x0 t2
-srai t0 t1 25
-mulhu a7 s2 a4
-add x0 s1 s2
-mulh s1 a3 s2
-sltu t6 s7 t3
-auipc s2 552646
-and s6 s1 a2
-slli a7 s9 30
-lui s2 608821
-xor t2 t2 x0
-sltiu ra s7 -1487
-divu t2 s1 s2
-xori gp s11 -197
-mulhsu t0 s1 s2
-or ra s8 t6
-slt s3 s3 a1
-and a3 ra a6
-sra a4 s0 s4
-mul x0 s0 t6
-srli t2 a4 29
-andi x0 ra -655
-remu s0 s3 s7
-or t3 s3 a3
-sra t6 a7 gp
-srai s1 s0 5
-mul t5 t1 t6
-slti x0 tp -642
-slli a4 t5 5
-sltu t2 a0 s7
-sltiu a1 s5 -1676
-xori a7 t5 -1224
-divu s2 a2 t3
-andi s3 a1 1127
-srli t4 a1 3
-addi t3 t0 134
-slli s8 s4 8
-sub a7 s6 a5
-auipc a7 898333
-srl tp s0 s11
-sll s3 s2 t2
-sltu s8 s10 a2
-or a1 t5 a4
-slt s4 a7 x0
-and ra t3 t3
-srl x0 t1 a2
-and tp t1 a2
-xori a0 t5 -1940
-divu t0 x0 a7
-slt t4 s3 t4
-mul s4 a5 a7
-mul a0 t5 s2
-andi s0 t5 -913
-ori t0 s7 -1463
-div x0 a7 t1
-xori a0 t1 -207
-sub s7 s9 a1
-slli t3 x0 11
-slti t6 a4 -396
-mulhsu a6 s3 tp
-srl x0 s7 x0
-mul s2 s4 a0
-sltiu s1 a0 -1602
-addi x0 s5 -423
-mulhsu a6 s11 t0
-xori x0 s1 224
-srai t5 s4 9
-mulh s7 t0 s4
-div gp t0 a0
-sub gp a6 a6
-slti s11 gp 1660
-sltiu s0 s10 2041
-divu t3 t2 s1
-divu a0 s5 x0
-lui ra 995719
-and t4 a5 a2
-sll ra t3 s6
-mulhsu t5 t3 x0
-slli a1 t6 9
-sltu s7 a6 t3
-mulhu s2 s5 s3
-div t6 a6 s0
-srl s3 t5 a7
-xor s2 t6 t1
-sltu x0 gp t0
-mul a6 s4 t4
-slt t2 t3 x0
-mulhsu a2 t3 x0
-slli a5 a4 31
+sll a5 t0 gp
+lui s11 950013
+mulhsu s1 s0 s5
+andi s10 a1 1001
+mulhu a2 tp a5
+sub a1 a5 t4
+ori a1 gp -1631
+sll t2 a2 a0
+srli t4 s10 5
+sub s7 s6 t0
+rem a1 s1 s4
+srai t0 gp 6
+ori a6 s0 -1121
+mul s8 a1 t5
+mul a0 a3 s7
+divu s6 s6 a2
+lui s5 268082
+remu t2 a5 a5
+add t3 a4 x0
+add t0 s0 a6
+srl s6 s10 a6
+srl s11 tp a5
+lui a7 803133
+andi a6 s4 -864
+andi ra s4 1303
+sltiu x0 t5 -1100
+sra t6 s1 gp
+or tp s3 gp
+sub t1 s2 ra
+slti t2 t0 -1211
+slti s4 s0 -701
+rem ra s9 s8
+div s10 t4 t3
+sra t2 a7 t2
+srai t5 s3 18
+mulhu ra t2 t0
+slli s11 x0 14
+lui s11 868493
+sra s6 a6 t4
+mulhu s9 s3 ra
+sltu a4 s10 s4
+divu a2 a5 t1
+mulhsu s3 s1 a1
+divu s0 t3 t2
+mulhu t2 s10 s1
+mul t3 x0 t0
+remu a3 s7 a5
+slli s7 s2 21
+lui gp 29625
+addi s11 t3 -172
+mul a7 s7 s9
+mulhu t6 s10 t0
+or a1 s2 s2
+mul t5 s2 gp
+divu s11 a2 s6
+mulh t6 s2 a3
+auipc a6 388062
+srl tp s10 x0
+ori s5 a7 864
+or a7 s0 s2
+xori a2 t0 -1150
+mulhsu a2 a0 s9
+slti t1 ra -52
+mulhsu gp a0 t4
+slti s6 s5 1000
+mulhsu s11 a5 s10
+add t2 a4 a5
+mulh s8 t5 s0
+sra t3 s4 s10
+auipc s9 563079
+add a7 a2 s11
+and a3 t6 s2
+divu a4 a1 a4
+xori t4 tp 1671
+srli s8 s6 28
+divu t4 ra a2
+srli s8 a0 25
+sub a3 a5 ra
+srai s8 t2 0
+lui s3 289089
+ori a5 a0 -78
+andi a4 a7 -1317
+mul s2 s10 s2
+and s1 a5 a7
+sra a1 s7 s2
+rem s1 t2 a3
+sltu a6 tp a1
+slti s0 x0 1528
+sltu gp s11 a1
+auipc t5 972545
+sltu ra t3 s9
+and a4 tp a5
+srli t5 gp 30
+sltu s7 s2 x0
+sltu s11 t0 s7
+add a1 t2 s6
+srai tp gp 21
+slt t1 ra tp
+slli a2 s7 25
+sltiu t3 s2 -1796
+xor t0 a3 a6
+andi tp x0 -901
+slt s3 t2 t2
+remu a0 s4 a5
+slli tp a7 12
+addi s5 a4 1457
+mul s3 s1 s4
+add a6 t4 s9
+remu s8 s2 t2
+addi s10 t5 -1882
+mulhu s6 s6 t4
+sub t5 t5 t3
+addi a3 t4 -1506
+mulhsu s8 a6 x0
+sll s9 a4 t2
+lui t2 330306
+srli x0 s3 4
+and a2 s2 s11
+and s11 s2 t4
+xori x0 s6 1565
+sra a2 s7 a7
+slli s8 a5 2
+xori s5 tp -1269
+srai a7 s11 1
+srai s5 a2 11
+mul s3 s11 a1
+xori t2 a5 -128
+and s11 x0 s1
+add a6 a4 ra
+srai s3 a0 9
+sub a4 a5 t5
+addi a5 s8 -1306
+slti t2 a1 1409
+and s6 s7 t2
+ori x0 a1 1551
+sltu s2 s6 s5
+mulh a6 a0 t1
+sltiu t0 a1 -1386
+mul a6 a5 a7
+add s9 a6 a2
+slt s5 ra a5
+ori t2 a0 -171
+srl s3 a3 t6
+sltiu a2 s6 -91
+add t1 t0 a4
+sltu a6 t3 s4
+sll s3 s5 s5
+lui s7 167575
+mulhsu a3 ra s6
+slt t6 a3 t1
+sltu s1 s10 a3
+sltiu s9 a3 -1274
+sra gp s6 t4
+lui s0 976705
+slli s11 s1 21
+rem t3 t3 s9
+addi ra x0 -936
+andi s7 s9 -1256
+div s7 s1 t5
+rem t6 s5 s6
+xori t4 gp -1298
+addi a6 t1 -1619
+sltiu a5 s4 -1956
+add s4 a7 t1
+add s11 a6 t5
+mulhsu a2 a4 t2
+xori s8 s7 -358
+divu t5 s2 s9
+srl s9 a5 s11
+andi s8 s4 60
+xor a2 tp a6
+div s1 gp t3
+and a1 s1 a0
+mul s5 t5 t5
+lui s3 255155
+slti s0 tp -770
+remu a0 s9 s3
+addi s5 s1 -218
+and t2 a2 t4
+addi t0 t4 954
+srai t3 s10 17
+sub s3 gp a1
+xori a5 t5 -1713
+sra tp x0 a2
+xor x0 a1 a1
+rem t5 a7 a4
+div a3 t2 a2
+mulhu t1 a7 a0
+sub a4 t5 s3
+mulhu s8 t1 a0
+xori s6 ra 518
+add gp a2 ra
+mul t3 s11 s1
+add a1 a1 a0
+mulhsu tp t3 a2
+slti t6 t2 524
+rem a4 a2 s2
+add t3 t5 a1
+add s9 s3 a2
+addi ra s10 -441
+sltiu s0 gp -1346
+sltu s7 s8 s0
+divu t6 s6 s1
+lui a5 13952
+andi t2 s0 954
+slt s1 s5 a4
+slti a6 a2 981
+ori s10 a1 90
+slti a7 t4 -986
+srli s5 t5 5
+divu t2 s6 a2
+lui t4 706780
+slti s10 t0 1892
+srli s2 a7 1
+mulhu ra ra s4
+add t0 s8 s7
+slli x0 t5 24
+mul t1 a4 s2
+add a1 a4 s8
+div s6 a3 s5
+srli t4 s5 8
+slti t1 a4 -1228
+andi s3 a0 402
+srl a3 a7 a5
+ori s8 a3 -1043
+slti t3 t5 -1298
+xor a6 s0 a6
+xori a3 s9 -120
+srl t3 t6 x0
+srli gp a1 29
+sltu t4 a5 s10
+sll s6 a1 t4
+sra t1 s11 x0
+ori x0 s2 -1906
+divu a5 s2 t1
+remu t5 s7 s11
+addi tp s8 1217
+andi s2 s9 -1118
+rem s0 a2 s1
+addi t4 a1 1974
+slti s1 t3 -1662
+andi s11 t3 -40
+mul a5 t1 s7
+sltiu gp t4 -1693
+sub s3 t2 t6
+sltiu a4 t5 -1518
+srli s3 s5 28
+mulhsu t1 a2 gp
+slti a3 x0 120
+mulhsu x0 s0 gp
+xor a0 t3 s8
+lui a1 670529
+xor t0 t1 s7
+and a0 s10 t5
+mulh a7 s7 s10
+mulhsu s9 a5 t0
+lui s8 849916
+lui tp 920815
+xor a1 t3 s0
+xor t3 t4 a4
+sub s8 a4 s9
+srai s4 s2 4
+srli a6 a4 5
+mul s7 s3 s0
+sub s10 x0 a2
+or t3 s9 a7
+div tp a3 t5
+sltu s5 ra a7
+srai s2 ra 31
+mulhu s8 s11 a1
+remu a0 s4 t5
+or a6 a7 a2
+divu s3 t1 t1
+xor s4 s9 s5
+div t4 t6 t3
+div a4 x0 x0
+auipc s3 975433
+srli s2 a6 7
+sll a6 s11 s8
+andi s0 a4 -599
+xori s2 t0 -1845
+slti t3 a3 -1742
+srl a1 tp a7
+addi tp t1 -535
+sltu s2 s0 s1
+sub a3 gp s7
+mulhu a6 ra s0
+xori s7 s1 -955
+remu a2 s3 a1
+div s8 s7 s0
+sra s7 t2 gp
+rem t3 s5 a0
+mulhsu tp gp s3
+mul s2 s2 t3
+add s10 a3 t0
+xori s9 s6 659
+add a6 tp t2
+slli s7 a5 25
+slt s9 a1 a4
+mul ra t4 s3
+divu a6 a3 a4
+mulhu t1 a3 s4
+sra ra s7 t3
+xor a0 a0 s11
+sltiu s9 a1 968
+addi t5 s2 -306
+sltu a1 s9 a6
+slti s10 x0 -1823
+slt a3 a0 s1
+srl t6 tp s2
+srl s10 s0 t6
+add t6 s0 s1
+sra a7 a7 a0
+andi t2 s9 -1765
+sltu a4 a3 s5
+mul x0 a2 s6
+xori a6 a5 -1227
+slti a6 s3 -967
+sll x0 t6 a2
+auipc s5 814923
+srli a4 t4 1
+srl s11 gp s6
+mulhu s9 a6 x0
+slli s7 a4 1
+divu a5 t1 t1
+auipc t0 255741
+div t4 ra t5
+xori s1 a6 1832
+sra t0 s1 tp
+lui a4 768170
+mulhsu t6 a6 a1
+div t2 x0 s1
+xor t0 a4 t0
+mulh s11 gp ra
+mulhsu s4 ra t6
+rem s7 t0 t2
+srl a6 gp a5
+or a3 s6 t3
+divu s11 x0 s7
+divu a6 gp s7
+remu a4 t3 a5
+sll s9 s7 s11
+rem a0 t1 a6
+andi a5 a5 -335
+srai x0 a4 18
+sltu a1 a0 a6
+auipc s7 376436
+divu t2 s6 t1
+slti gp a1 481
+ori t5 s6 868
+andi s4 s4 -1624
+sra s7 t5 a0
+slt t6 t5 a3
+divu tp a4 s9
+mulh t4 gp s4
+srai a3 x0 18
+sll t5 a3 gp
+addi s8 a6 1321
+mulhsu a3 t6 s4
+remu ra s6 x0
+sub t5 s2 x0
+or s9 x0 t4
+remu a2 t2 s10
+lui t5 816606
+mul t1 t2 x0
+mulhsu t4 a6 t0
+sltu gp s3 a4
+slli x0 gp 15
+slti gp s5 1492
+rem t2 a4 s6
+mulhu t3 ra t5
+xor a1 a6 s6
+slt s7 s6 s11
+mul a0 t4 t5
+sub a3 a0 t3
+divu t3 x0 a0
+xori s5 gp 1357
+sltu s8 a6 a7
+add s9 x0 x0
+or t4 t5 s3
+srl x0 x0 gp
+div s8 t5 s3
+slli a6 s7 4
+srl a5 s0 s7
+sll x0 s1 t4
+sltiu x0 a4 -52
+rem a0 ra t0
+srai a2 s4 22
+srai s2 t4 20
+div s5 t5 t3
+mulh s3 t4 a7
+srai ra tp 28
+mulhu gp s9 s1
+mul s1 a0 s8
+slti s5 s5 -1727
+andi tp s9 535
+add t3 s10 t6
+ori s0 tp -1877
+mul gp ra t0
+xor t3 s4 t5
+sltiu t3 t2 -479
+ori x0 a1 -220
+div s5 s3 t4
+slt tp t5 x0
+srli a6 t6 21
+slli a0 s4 2
+rem x0 t0 s9
+mulh a4 s9 s4
+sll a2 s3 gp
+sll t6 a4 s6
+srl a4 s1 t4
+sub t1 s11 tp
+sra t2 ra t3
+xori t0 s11 1115
+slti s2 s4 -905
+sltu tp a1 s3
+mul x0 ra tp
+auipc a5 139954
+slt a7 s3 t3
+xori s9 x0 -1211
+srli t6 t2 18
+srl a7 a0 s11
+slti x0 s5 829
+mul s9 t6 a5
+and s11 a5 a7
+or s10 t2 a1
+sll a3 s4 a5
+auipc s6 430048
+srai a5 a6 16
+add t2 t4 a7
+slt s9 s6 s11
+xori s8 t4 359
+sltu a5 s1 s5
+xor t2 t0 a0
+or s1 a0 gp
+mulh t1 gp s9
+auipc t4 652329
+lui a2 290405
+lui a3 801438
+addi t4 t1 1487
+srli s11 s11 25
+add t5 s1 s1
+xori s9 x0 -1017
+mulh a6 x0 s7
+div s9 a5 x0
+lui s1 722100
+ori tp a1 427
+slli s0 t0 31
+slt t5 t4 t3
+slti a7 s4 -203
+rem gp s5 s4
+mulh t0 s6 s2
+xori s8 s7 -1518
+slt s8 a4 s6
+lui t2 504713
+sub s10 s11 s5
+srli s11 a2 28
+rem s11 a7 a5
+slti t1 a4 -817
+lui a7 385273
+sra a2 s5 s10
+sra a0 s11 s8
+srli s7 a5 8
+addi a0 s9 -721
+andi a1 t6 1257
+srl a4 a5 s6
+div s5 a6 s3
+div a2 s10 gp
+mulhsu s5 gp s6
+mul t2 s6 s9
+sltiu ra s8 -1708
+div ra s2 a3
+mulh a3 s2 a7
+sub t6 a3 a2
+sltiu t4 a7 474
+add s7 a2 a7
+sltiu s11 s0 631
+auipc s2 636005
+sra x0 x0 a5
+sll t1 t2 ra
+srli s9 t5 12
+and x0 s5 s10
+mulhu a1 s4 s0
+sll t6 x0 t0
+srai t2 s7 1
+ori gp a2 -1817
+rem s2 a6 s1
+srl t5 a4 t4
+and s9 t4 t0
+andi s6 x0 1796
+remu t6 a4 t5
+srai s2 x0 10
+slli t3 s9 6
+sub t4 t4 s5
+sltiu s5 t3 -286
+xori t5 a0 986
+remu t2 t0 s6
+sra s3 a7 tp
+addi a5 s4 -10
+div s6 s7 a2
+sll t4 t2 t4
+mul t0 a3 t4
+lui t6 313294
+mulhsu s6 a0 s4
+srli s4 s10 4
+auipc s6 872437
+and s11 t3 a4
+sll a1 t6 s4
+sltiu a1 s9 1441
+xori t3 s6 -1534
+lui s1 16874
+mulhsu s6 a4 s5
+div a6 a2 t6
+andi t2 t4 922
+or a7 t5 a6
+mul s6 s2 tp
+remu a3 a0 ra
+srli a7 t1 8
+mul t5 s9 s7
+divu s6 a0 t6
+divu x0 s8 tp
+mul a1 tp s6
+srli a4 t6 31
+auipc s3 574591
+rem t2 s5 t5
+auipc ra 142649
+slt x0 x0 s5
+xori t5 a3 -1111
+slti t5 t0 1012
+xor s2 s10 s0
+mulhsu t2 s11 s4
+sltu s2 a7 t3
+or gp gp t5
+sltiu a3 s11 -34
+div s2 a6 s3
+div s2 t1 t6
+rem t2 gp a6
+sll s0 t3 t1
+ori tp s2 -750
+xori s10 s10 -803
+auipc t0 653722
+srli t2 a1 27
+srli s1 a6 0
+divu s4 gp s7
+addi s11 x0 -1256
+xori a4 s6 1158
+sra a2 s4 s6
+div t1 s2 a7
+sll s4 a1 t6
+sltiu t5 s10 -1742
+srai s9 s6 4
+slt s3 t0 s7
+and a0 t5 s10
+auipc a1 21606
+sll a0 t2 s11
+andi ra t5 -1551
+sltu x0 t6 s1
+ori a4 gp 694
+and t5 s2 a6
+ori t4 x0 582
+slli gp t4 15
+mulhsu s0 a6 s9
+lui t4 510793
+srli t4 s2 7
+sra s7 a5 x0
+xor a1 s9 s5
+slli s1 ra 9
+mulhu s10 s5 s9
+remu s7 s6 s4
+sra s7 s0 t6
+xori s3 a2 -953
+sll s0 s8 a5
+slli s0 s5 9
+xor x0 gp x0
+xori t0 t6 1171
+srai a1 s9 30
+slli s0 a6 2
+ori t3 t5 1903
+slli t3 a3 25
+srl s5 s6 t4
+slli s7 a5 11
+addi a6 a4 -1423
+slti t1 s11 -50
+srl a6 a2 a1
+or a6 t4 x0
+mulh t0 gp a5
+sltu gp s1 a3
+mul s6 t5 s0
+srli tp s10 26
+slt t2 s1 t4
+lui a5 12704
+sltiu s5 t2 -2014
+or t5 s11 a2
+srl tp tp t2
+sra a3 s10 s10
+mulh s0 s3 a3
+srli s7 x0 21
+lui t2 99070
+xor s4 t1 t3
+xor a0 a0 s3
+xor s6 s9 x0
+mulh s1 s6 t6
+srli x0 a2 27
+xor a2 x0 a7
+remu s0 s6 t3
+mulhsu t1 a0 a3
+mul x0 s5 s8
+sub s11 a1 x0
+sltiu t1 t3 -1841
+remu s5 t2 t4
+auipc a2 158906
+rem s9 t2 t4
+xor tp a3 s8
+slt t4 x0 a4
+sra s4 a4 t1
+auipc t4 436050
+andi ra tp -1776
+ori a3 s4 -316
+srai s8 a1 20
+sltu t2 a6 t2
+or s11 a6 a3
+addi s0 a5 2043
+mulh t6 s3 tp
+slt s4 s6 t6
+addi s5 s11 592
+addi s3 s5 -1502
+andi s11 a0 -160
+slli a4 a3 20
+divu a3 t0 t6
+lui s4 272552
+div s7 x0 t2
+add a4 s4 ra
+slli t1 a5 6
+sub s9 x0 s10
+ori ra s7 1362
+mulhsu t5 t1 s1
+srli t1 s10 2
+rem a5 tp s4
+xori t5 s4 -2005
+add a4 x0 a2
+mul a3 ra s0
+xori a3 a2 1259
+slti a5 a7 1952
+div s9 a4 t6
+add a3 s2 t4
+addi a3 a5 45
+srai s2 t0 5
+addi ra s6 -1549
+mulhsu s10 x0 s8
+lui t4 403643
+addi t6 ra -6
+andi t4 x0 -2017
+sub s10 s9 t1
+lui a0 772129
+ori s11 tp 1461
+mulh a2 a5 t3
+div s0 s7 t0
+div s2 s10 s2
+sra s1 t6 a6
+sltu t6 s3 t5
+auipc t6 818706
+slti tp a1 361
+slli x0 a6 1
+lui a5 968463
+mulhu a4 x0 x0
+xori s7 t6 1590
+mulhsu x0 s6 t6
+xor a6 t0 t1
+sltu s3 a2 a2
+add a1 a5 s2
+srl a7 a1 a3
+mulhu s6 s3 a4
+xori gp t3 38
+sub a5 t6 a7
+srli s2 s0 19
+xor s9 s9 s0
+or t5 s4 t4
+srl s9 t6 t2
+ori a0 t1 -453
+sll gp s6 t1
+ori s11 t6 -831
+srli t3 t1 3
+mulhu tp t0 t2
+rem t1 t3 t6
+sltiu s4 t1 -2044
+sltu t2 s3 t3
+mulhu s4 t4 s3
+remu t1 t6 gp
+rem s0 a7 t2
+srai a1 s2 27
+sltiu ra a5 -843
+mulhsu s5 t2 ra
+div t5 t5 s4
+sltiu t4 s8 -496
+sra tp s9 a2
+slt s8 t6 s8
+remu t0 s0 a3
+ori a4 s2 -1598
+srli a4 s5 31
+srai s6 a4 8
+divu s10 t2 s7
+mul a2 s0 s6
+mulhsu t0 a1 s9
+rem a1 a5 s3
+sll s8 s4 s8
+sltiu a6 t1 1209
+sub s6 x0 a4
+sltiu t5 s9 540
+auipc s7 799012
+slt s6 s11 a0
+srai a0 s6 11
+slt a7 a7 a4
+xori t1 a5 1
+sll a3 a7 t5
+mul t0 t5 a4
+mulhu a4 t6 a7
+mulh a2 s7 tp
+xori ra s1 1158
+srli s7 s7 30
+or t0 s5 t5
+slti s4 s6 -552
+mulhu x0 s10 s5
+lui s0 218120
+slti t2 s2 -1948
+remu a4 ra t2
+srai t3 s4 24
+remu gp s11 x0
+divu x0 t0 s2
+sub s6 s0 a3
+xori s4 a2 -447
+srai s6 x0 19
+mulh s1 a1 s10
+sra gp t6 s6
+sra t4 tp s9
+divu t0 s6 t0
+mulhu s9 a6 s1
+mulhsu s9 a5 a4
+addi a7 t2 943
+divu t0 x0 x0
+srli a3 s8 20
+xori s8 a3 428
+mulh s5 t5 a5
+srli a7 s9 10
+srl a3 s6 a7
+sltu t4 s6 a4
+slti s6 s2 695
+divu t3 x0 s2
+divu t0 s5 x0
+lui s7 379654
+mulh s11 x0 s11
+mulhu s10 s1 s4
+andi a7 s3 -103
+slt s3 a7 a1
+ori s5 a2 -461
+srl ra a2 t1
+mulh s1 s1 s10
+divu ra t5 s0
+slli t3 t3 21
+mulhu s6 a4 t6
+mulhsu s10 s5 tp
+sll a3 x0 ra
+divu a6 t0 t0
+ori s4 a7 -1318
+xor t6 x0 s4
+mulhsu t0 t4 s7
+slt a2 a3 t5
+mulhu a1 a6 s4
+sll a0 x0 a5
+divu a3 s4 t3
+andi t5 s1 1132
+ori s0 t0 -1076
+div s8 s1 s1
+ori a6 s3 -2040
+add a7 a5 s3
+mul s3 a7 s7
+add x0 a7 s4
+andi x0 a1 -84
+and a7 s9 s6
+mul s11 tp gp
+sltiu a3 s10 -207
+div s7 a0 s9
+sra a2 a4 s1
+sub x0 s7 s0
+mulhu s4 s3 a6
+lui s6 155729
+mulhsu a2 t2 s9
+mul x0 t3 t3
+mulh t2 x0 t5
+div ra s9 s9
+divu t1 a0 a5
+sltu a0 s0 x0
+mulhu s0 a2 x0
+srl t4 tp tp
+sll s4 s11 s8
+srai t2 t6 8
+sll a3 t4 s5
+mulhu s5 t1 t1
+xori t5 t4 -141
+andi x0 a1 -471
+sub s5 t0 a2
+rem a4 s9 tp
+mul s11 s7 t3
+rem a2 tp t5
+slti x0 t1 -1015
+sll ra t2 t1
+div s0 s8 s4
+mulhsu a3 s3 a6
+divu s3 s9 a3
+srl s6 s6 s8
+mulh s7 s9 s5
+andi s3 x0 2044
+srl a6 t3 a3
+and a3 s10 ra
+mulhu t1 s11 s5
+andi s5 s1 -945
+lui s11 594646
+and t4 s1 s1
+xori t5 a5 -53
+or s1 s4 t2
+auipc t4 529090
+lui s5 112076
+mul t6 s11 s6
+xor s2 a3 s7
+mulhu t0 s7 tp
+mulhu t0 a2 gp
+sub x0 t5 s4
+mulhu a5 s4 s9
+xori s10 a7 1056
+sltiu t0 a0 -518
+lui a6 268285
+add s6 ra s4
+sltu s8 a3 a4
+xori s1 a6 -422
+remu s5 a7 t3
+srl a3 s11 s1
+slt s5 t4 s8
+divu ra s3 t1
+mul a0 s0 s7
+xori t3 s11 1001
+mulhu a4 a0 tp
+xori x0 s4 1174
+and a6 s1 t6
+auipc s8 1041439
+remu a2 a5 t3
+ori t2 s8 2007
+xor s5 t0 a5
+sll tp t3 x0
+andi t3 s0 2015
+lui s11 1039024
+slt t2 s3 a6
+sra a5 x0 t6
+add a6 t1 a2
+sltu s8 a2 t6
+sll a5 t5 s3
+div s2 a4 a6
+slti t0 a4 643
+slti t2 t0 -501
+sltiu a1 t3 -1083
+sltiu s0 s1 1395
+rem s6 a1 t3
+slt a0 t0 a5
+or a3 t5 s5
+or t0 gp s8
+xori s6 a4 -629
+sltu s1 t6 s6
+mulhsu s1 x0 t5
+mulhsu a7 t2 s9
+slt s2 t4 s11
+xor s5 t0 ra
+rem ra t2 t0
+mulhu s2 x0 s4
+sltiu s10 s5 -1955
+sub t3 a3 a0
+mulhu gp x0 s7
+sll s11 a7 tp
+addi a2 t4 773
+srli s5 t6 23
+mulhsu s2 x0 tp
+mulhsu s11 t3 s5
+slti s1 a4 -890
+mulhsu a2 s4 s5
+sltiu s6 t3 -994
+sub gp t1 t4
+slt ra t5 s10
+sltiu t2 ra -831
+slti s11 x0 -541
+and s4 a2 t3
+slti s5 x0 -452
+xor t5 a3 s2
+mulhsu t6 ra a5
+andi a0 a4 -319
+mulhu a0 gp t1
+mulhu t2 ra t2
+remu a4 t5 s8
+slti s2 ra -427
+srl t3 a0 a4
+addi s4 a1 1103
+mul s5 s10 s3
+and t5 s3 a0
+mul t3 gp s3
+sll s6 t4 tp
+srli t6 x0 0
+divu ra a5 t3
+sra s5 a4 s4
+or s6 s3 a4
+div t6 a1 t3
+or s5 s8 a0
+lui s10 19855
+or a1 t3 s3
+sltu a1 s4 s1
+sltu s2 s9 t2
+xori tp s1 -548
+mulhu ra t1 t3
+slli s7 s5 20
+andi s4 s9 1927
+slti t6 s6 1957
+divu s9 a1 s3
+mulhsu s5 t6 a2
+mulhu x0 s4 t0
+slt a6 a2 s3
+sub s6 x0 s9
+xori a2 tp -620
+ori a0 s5 -389
+add a6 tp a2
+mul x0 s9 s11
+srli a7 t3 20
+and a4 s6 a6
+or s0 s7 s6
+mul a4 s11 t3
+slt s10 s4 gp
+srl s9 s3 a5
+srli s5 x0 5
+slti a4 s0 -640
+auipc s1 810947
+slt t1 t4 s2
+xor a7 a3 s11
+srl a3 s2 t4
+rem s0 ra a4
+lui s10 870103
+divu s8 tp t2
+or a3 a7 a2
+srai a1 t5 10
+srl a0 s10 a5
 srli t2 a3 7
-srai gp s3 12
-slli s11 s11 2
-slti s7 x0 -706
-sll s10 s5 s9
-or a6 a0 a5
-slli s0 t1 19
-or a6 a3 a3
-mulh s5 t5 s4
-mulhsu t5 s9 s8
-xor t3 a2 s4
-sll x0 tp s1
-div t0 x0 a6
-srl tp a1 a1
-andi a5 t1 1258
-srli s6 tp 13
-rem ra t6 s11
-ori a7 a4 -1152
-sltu s0 t4 s9
-remu x0 t6 s2
-remu a3 t4 a1
-and s10 s2 tp
-divu s0 s7 ra
-srli t5 s1 25
-sltu a4 s9 s4
-remu ra x0 s0
-sra t4 x0 s7
-rem s9 s6 t5
-remu x0 a7 t3
-srl s3 s5 ra
-add t4 t5 x0
-xor s8 s11 s10
-div t5 a4 x0
-remu a2 t0 tp
-div x0 t4 ra
-srai s6 t3 7
-srli s2 t3 26
-div t5 s9 ra
-srl a0 s10 t1
-srli s7 a4 11
-rem s10 s6 a0
-rem a3 ra s4
-auipc a2 489627
-lui a4 758778
-sll a1 a2 s10
-rem t4 t6 t5
-or x0 s9 a5
-lui s9 565412
-srai t4 s4 17
-add s0 x0 t6
-slt t1 t0 t1
-sltu t2 a6 a6
-sra s2 gp t6
-div t2 t4 gp
-sll t1 t6 s8
-remu t1 gp t6
-mulhsu a1 s0 t2
-lui a4 669581
-mulhu t1 s10 s4
-sltu gp t4 s2
-and a0 a0 s11
-xor ra x0 t5
-sll a7 t1 s0
-sra s4 t3 t1
-sltiu a3 s9 1654
-and t1 s3 t0
-mul a6 a6 s0
-andi a0 s3 -558
-remu a2 a1 t0
-sll t4 s3 a1
-mul tp ra s3
-sltu tp s2 ra
-or x0 t6 s11
-mulhsu a1 s7 s10
-mulhsu a2 x0 t2
-mulhsu s10 a4 a1
-srli gp t1 26
-lui t1 477878
-sub s4 s3 s9
-lui a3 108686
-xori s3 a3 661
-and ra s4 a3
-and tp s8 a1
-slt t1 t1 s1
-xor t3 s11 t0
-sra a2 s0 t2
-sub gp a6 s3
-div t0 s7 s1
-mulhsu t3 x0 s11
-srl s0 t0 s1
-ori s7 s3 -418
-slt s4 t5 s7
-mul a2 a2 a5
-or a4 tp t5
-mul s9 ra t0
-sltiu s2 a4 -1917
-add s6 s8 a0
-div s10 t4 ra
-slt s7 a0 t3
-ori s11 a3 987
-add a7 s9 t6
-sra a4 a0 a7
-remu x0 s3 t0
-srai s9 s5 21
-sltiu a0 a5 -685
-sltu s7 a5 s1
-sltu ra s5 x0
-sra a7 a0 t6
-andi t1 s5 -722
-slti a2 s2 51
-sll a1 s6 a7
-slli s3 t5 12
-andi s6 a6 778
-sltu s7 s10 s1
-addi a6 a4 -1047
-srli s10 s11 1
-mulhu a2 s8 ra
-mulhsu a5 s9 s11
-rem t5 a2 a3
-srli tp s6 15
-rem s3 x0 a1
-srli x0 s7 14
-lui a0 725936
-slti x0 ra -1792
-slti tp s0 -1733
-sra s3 a1 x0
-or s8 t1 s11
-srl a4 t2 tp
-remu a4 a7 x0
-srai s2 tp 5
-add a5 a6 s11
-xor s1 ra x0
-ori t2 a3 -1746
-rem s7 tp t1
-mul a7 gp x0
-mulhsu s3 a4 tp
-sra gp s3 tp
-lui t5 938883
-slt t5 gp a7
-and a3 s4 a1
-and s7 a0 a6
-remu s8 a6 s5
-and s4 t5 s6
-sll a5 a6 s2
-add x0 x0 a2
-xori a6 t6 938
-auipc s0 723669
-srli t2 s9 14
-slt x0 t6 t2
-slti s5 s9 588
-mulhu s0 s8 a4
-srai s5 s10 26
-sll a2 t0 t2
-mul s5 a6 s9
-slti a4 s2 -1715
-sltiu s7 x0 1450
-rem t6 a7 t6
-sll t0 s3 s1
-ori a1 s8 -758
-sltu a4 t5 tp
-add a4 s0 s0
-xor s10 a5 s9
-sra t3 x0 t1
-addi t0 a2 -1874
-sltu gp a0 s3
-andi s2 a7 -1168
-div t5 t6 ra
-xori t0 a7 1085
-auipc t5 957803
-sltu t4 s5 a1
-slt s1 s2 s11
-xor s8 a6 a6
-ori x0 t6 1206
-slti t3 a2 -616
-divu a4 s0 t3
-ori s7 a0 -1806
-lui tp 292930
-mulh a4 s11 t2
-andi a0 s0 -254
-addi tp s10 -317
-sub s3 s8 s5
-mulh s7 s8 gp
+and a3 a2 ra
+mulhsu a5 ra x0
+slti t0 t1 -1358
+mul s9 a2 a5
+add x0 ra t3
+srl s10 a1 s4
+lui t3 13663
+remu s10 a1 s9
+auipc t5 192620
+divu t3 s7 s9
+addi x0 s6 1419
+or t5 tp s5
+sll s0 t2 t0
+ori s1 t5 -1428
+xor t4 a6 t2
+divu x0 x0 t3
+slti t6 a0 -747
+slti a5 s4 328
+or a0 t2 s9
+or t1 a4 t4
+sltu s7 t0 s1
+sltiu a1 s4 -2033
+slli a3 s3 28
+or a7 a6 a6
+sra gp gp s7
+sltiu a3 a5 -1298
+xor s2 t1 t1
+mul a0 a0 x0
+srl s0 a6 s10
+and a7 s7 x0
+xori t0 t4 -154
+xori s5 t1 1672
+xor s0 t5 x0
+mulhsu s0 s7 s5
+sll t2 t1 a1
+remu s4 a5 s2
+andi t4 s1 -298
+rem s4 s1 a7
+xori t2 x0 -1785
+mulh a7 x0 s9
+sll t4 gp s7
+sltu a1 s9 a1
+sltu a4 s7 t4
+srli t5 x0 30
+and t6 a4 s6
+sll a1 a4 t0
+auipc ra 459153
+srli x0 a0 9
+div t3 s4 t3
+mulhsu a1 s6 s8
+addi a2 t1 -8
+sll tp t1 t2
+sub a6 t5 s10
+srai s11 a6 20
+lui s2 692737
+slli ra s9 19
+auipc s5 497643
+slti s3 s9 -1314
+remu s10 s10 a2
+mulhu t4 s0 t3
+slt x0 s5 s1
+srl s1 x0 t2
+sltu s3 s11 s5
+srli a3 t4 14
+addi s2 s8 -828
+srli s0 t3 13
+auipc a0 65870
+slli ra s6 26
+slt a5 t1 t5
+slli t1 ra 25
+andi x0 s6 1161
+srl a3 a1 a4
+sll a2 a2 a4
+sltiu s0 tp 88
+srai tp t1 11
+sll gp x0 t6
+mulhu x0 t5 t3
+sltu tp t6 t4
+or gp s1 ra
+div s3 s9 t0
+srli gp s0 10
+mulhu a0 s8 s3
+lui s9 116493
+sra s3 s1 t1
+andi t6 s2 -1882
+sra t4 s11 s11
+or x0 s8 t0
+srli t1 s10 19
+auipc a7 426110
+sub gp t5 s0
+ori s6 s11 1181
+divu t5 s0 t1
+add s0 a1 s10
+sub a7 a3 x0
+addi ra s1 694
+or a1 s1 t6
+sll tp x0 s8
+sub a7 a4 s7
+or s2 t1 a4
+mulh s9 s7 s1
+and x0 gp s4
+mulh t1 a6 t3
+slti a0 tp 1144
+ori s10 t0 -313
+addi a3 s2 347
+slli a2 s0 25
+div t0 ra s11
+sra x0 x0 t0
+mulh t0 x0 s4
+remu t2 tp a7
+srl t5 a3 x0
+xori a2 t6 -1618
+lui a4 937187
+mulhsu s6 a0 t6
+sltiu s3 a5 901
+srl a5 a3 a4
+srai s6 ra 17
+xori a2 s10 1656
+rem s3 t0 s3
+lui t3 412173
+or s8 s7 s2
+remu t2 t4 s2
+and s7 s2 a7
+divu x0 a6 x0
+mulhsu ra s1 x0
+srai s7 ra 12
+slti s6 s6 -1485
+srli s9 t6 9
+andi a0 x0 1979
+addi t3 a0 1721
+sra ra a5 a2
+mulh s5 gp a0
+lui gp 574973
+ori a2 gp 757
+slli a2 s2 27
+xori s2 t5 958
+sub s8 a4 s10
+slli s1 t3 30
+srl s5 s9 a2
+slt gp s0 t6
+srai a7 s1 1
+mulh t6 s3 s4
+xor s1 s0 s7
+auipc t4 920971
+remu s8 s11 tp
+slli s0 t3 6
+sltu a5 s10 s9
+add ra a7 s0
+rem tp s10 s4
+sll tp a6 t3
+slti t2 a5 553
+divu s7 x0 x0
+slt ra t6 s5
+sub a1 s1 s2
+sra s8 a7 s2
+auipc x0 513668
+slti t6 t0 -1132
+xor s2 a2 a5
+mulh s11 a1 a4
+and tp s9 t0
+mulhsu a1 t2 t0
+mulh s7 t0 a7
+divu gp a2 t4
+mulhu s9 s11 a3
+srai a2 t1 2
+divu s0 s10 t1
+sltiu a1 a3 1156
+sltiu t4 ra -1028
+remu x0 s4 s9
+or a2 a0 a5
+mul a4 tp x0
+add s5 a7 s7
+and s2 s2 t0
+mulh s6 s0 s3
+mulh s6 s10 a5
+srli s4 s5 6
+lui s10 160727
+sltiu t3 s6 -374
+div s1 a2 s7
+slt s8 x0 a2
+and a2 a2 x0
+slti s5 t1 -1481
+andi t1 s1 813
+sltu gp s5 tp
+rem s2 t5 x0
+sra s8 gp t5
+or a3 x0 t6
+xori a0 a2 1312
+and a2 t6 s9
+addi s5 ra -432
+remu a6 x0 s7
+sll t0 t6 s11
+add t2 s2 s2
+sra gp a6 s7
+divu s10 t3 t6
+sra s3 t2 a0
+andi s2 t4 -1982
+remu s3 x0 t2
+remu t0 s10 x0
+sltiu t6 a1 -173
+or s5 s3 a7
+sltiu t5 a3 -679
+sll a1 a6 a4
+sra t3 a3 s9
+mulhsu s6 s11 tp
+sll a3 s11 a3
+and ra s6 s10
+mulhu x0 a7 a2
+div x0 s5 s5
+srl t3 t3 a2
+sub s11 s0 a6
+sll a5 x0 s8
+ori t2 t2 776
+or s7 a1 s10
+addi s5 a1 1082
+sra t2 s7 tp
+rem t6 a7 s9
+sll s11 s2 a2
+xor a2 t4 ra
+auipc s3 143873
+and s9 s10 t6
+mul s7 a5 t4
+addi a3 a4 -1879
+addi t4 t6 1825
+mul a7 tp a2
+xori s11 a3 563
+srl s7 x0 s11
+remu s7 t4 a5
+rem s0 s1 a6
+div s8 s9 s3
+andi s9 s8 -1473
+srai tp a5 6
+xori t6 s9 1456
+or a3 a4 s10
+srai t5 a1 5
+sub s4 s1 a1
+mulh t3 s2 t6
+slti s2 s2 115
+addi s0 s3 -1713
+sub x0 ra a6
+slli s9 a4 13
+addi a3 t0 -912
+sltiu t1 a0 -992
+sll t1 t2 s11
+srai s11 t5 3
+or x0 a0 s9
+mul t1 a3 a1
+xori t1 s0 -831
+srai s4 s7 21
+and a6 x0 ra
+lui a5 649703
+and a2 s10 s2
+addi s7 a0 -1621
+slti s11 a0 876
+divu s1 s6 a7
+mulhsu a2 s7 s6
+sltu a4 s7 t4
+andi gp a0 -841
+mulhsu s11 s5 a0
+mulh x0 t1 s1
+auipc s5 336750
+mulhsu tp x0 gp
+sra ra a7 a6
+srai s2 s6 12
+lui s3 748908
+or s2 x0 tp
+slli t3 t3 22
+ori a0 x0 446
+and a6 tp a2
+lui x0 209493
+or s7 ra s5
+mulh s4 t4 s4
+mulhu a2 s5 s9
+addi s9 t0 -730
+and s3 a3 t5
+addi a3 s0 1598
+mul t5 s10 a3
+mulh t6 t1 s7
+auipc t1 564101
+mulh s2 s4 s4
+add t3 s0 t3
+sltu t0 t1 a1
+sra x0 a0 a0
+rem s2 a4 a6
+lui a3 405698
+andi t1 t3 -57
+sub a0 a6 s7
+rem s5 s9 ra
+sll a6 a6 s7
+xor a5 t0 s7
+sra s0 gp x0
+srli s0 a7 2
+sll t1 t1 a0
+xori t1 t5 -1350
+xori x0 a7 -1154
+mulh a5 s6 a0
+add a3 a5 t4
+srli s7 t0 19
+sub s1 t2 tp
+slti t5 s10 -117
+div s9 s1 x0
+sltiu t4 gp -348
+srai x0 t4 31
+srl t3 s7 x0
+srl t5 a4 a5
+ori t4 ra -906
+andi s5 t5 -814
+divu s10 a4 a2
+addi a4 s6 -1966
+slli s9 a3 3
+slti s3 t2 -385
+srai t5 gp 11
+and ra t0 gp
+div s0 a1 t0
+addi gp a7 1782
+mul t1 a6 a6
+mulhu gp s8 s6
+sltu s3 t2 s2
+ori s2 t2 -1961
+mulhu a4 s8 t0
+rem a4 t2 a2
+sltu gp t3 s7
+sra a3 x0 a4
+srai x0 t3 11
+divu s2 t0 a5
+addi t3 s6 -487
+remu a4 a4 s5
+sltu s5 t0 a1
+sll t2 t3 s5
+srl a7 s10 gp
+rem x0 s3 s4
+add s2 a7 s7
+mul a5 a6 s2
+sub t2 s1 a7
+or tp t6 s3
+mul s2 t5 a0
+sll a7 t4 gp
+mulhu t4 s7 a1
+mulhsu t6 s9 a0
+slt s10 s1 s0
+xori t0 tp 389
+mul a0 x0 t4
+sltiu x0 x0 1255
+add x0 t6 s5
+slt t1 x0 s1
+ori t6 s9 275
+mulhu a7 s7 x0
+addi ra t3 -1720
+slti t2 t2 67
+and a6 a0 t4
+and s6 a0 s10
+and s5 s1 t2
+xori s4 s9 -1231
+or a5 s9 a0
+slti t6 s10 -1299
+slt s10 a4 t5
+sub s9 s7 s6
+lui s7 139641
+mulhu a5 t6 s8
+xor s7 t6 a6
+mul a7 a7 s7
+divu s7 s0 gp
+slt t4 s6 t6
+remu gp s2 gp
+or s7 a4 s0
+mulhu gp a5 s6
+srli t3 a2 21
+xor t6 tp t4
+srai t0 s0 31
+divu a1 s11 s4
+add a4 s0 s9
+xor a2 a5 a7
+sub tp s2 t3
+slli s3 s7 24
+sll x0 s2 t1
+srl s0 t2 a4
+slt t4 tp s8
+mulhsu s0 a6 a2
+slli s7 a2 25
+srai t1 s11 8
+srli s7 t6 29
+div x0 a3 t5
+add t4 a6 a0
+or a1 s9 a4
+rem s10 x0 gp
+divu s2 s8 s0
+sra s10 s9 s5
+srai t0 t1 12
+srl t4 s10 s0
+auipc gp 827803
+divu s6 tp a5
+slli x0 s3 17
+mul ra s6 a2
+xori s1 t5 -1450
+rem a3 s2 a6
+addi s10 s4 564
+sll a3 t1 tp
+addi t4 s4 -125
+srli s0 a4 26
+addi gp t0 917
+srai t6 a1 9
+sll a2 s6 t2
+div t5 a2 t3
+ori a1 s8 -52
+div s10 a2 a3
+divu s3 t5 t6
+auipc s2 93892
+addi t3 a1 -498
+andi a2 a2 -1113
+addi s9 s7 1294
+xori a4 t5 -443
+ori a1 t1 -76
+slti a2 s11 -1471
+andi s4 s11 -875
+srai a7 s9 8
+sub s5 t3 a5
+add s3 t4 x0
+mulhsu s10 a1 s2
+sll s2 s9 t5
+remu a7 s0 a1
+addi a1 a1 -680
+lui s8 54331
+sra x0 a4 s2
+mulhsu s4 a2 s7
+add ra s4 a0
+mul a2 t3 s11
+sra t5 t2 ra
+sll a5 t3 a3
+lui ra 107637
+auipc s7 15317
+sub t6 a1 s9
+or s9 s7 x0
+slli a5 s11 21
+srl ra s2 s3
+and a6 a3 s0
+add s7 s6 s0
+xori a1 s10 -1208
+rem t0 t0 a7
+mulhsu tp s8 t6
+rem a5 ra t2
+sll s3 a5 s4
+andi a4 t6 -1976
+remu s0 t0 x0
+slti t2 a6 424
+sll s5 a7 a3
+slli s1 tp 12
+sub x0 a6 a7
+div a0 s5 a4
+slt a2 t4 s8
+andi ra s5 -644
+sltiu s10 t5 -1464
+or t4 t2 s11
+sub s10 s8 t2
+xori s1 t4 -606
+mulhsu gp tp gp
+auipc s5 348113
+addi s5 s9 191
+remu s0 tp gp
+xori t4 ra 1397
+sub tp t1 s9
+div s8 a7 s0
+and s10 s2 x0
+sub s0 a1 ra
+srai a7 s9 19
+mulhu t0 t2 x0
+lui s0 191051
+remu s9 s3 s8
+lui s2 221809
+sltu x0 t1 t2
+mul t5 x0 a5
+xori a7 a0 631
+addi t2 s2 -302
+div t1 a6 t3
+and s4 s5 s1
+sltu s1 a6 s0
+andi s11 t4 1323
+mulh a1 a3 s8
+mulhsu x0 t6 ra
+lui s10 1567
+sub a1 x0 t2
+divu t1 t6 x0
+auipc x0 262334
+srai t2 t2 5
+remu a6 s6 s8
+div s10 s3 a1
+sra s0 s7 s1
+srl gp s5 s10
+div s1 s7 s3
+mul ra gp gp
+or s5 t5 a0
+sra s7 s0 s8
+srai s11 s2 1
+lui gp 945652
+ori t2 s7 -28
+andi s11 t0 -1148
+xori gp s6 753
+addi a0 ra -640
+srai ra t4 15
+divu a5 s3 s9
+slt x0 t3 s7
+sltu s5 t6 ra
+srli s4 s0 16
+lui s10 687075
+remu t0 a5 t2
+div s6 s6 t5
+mulh s1 s3 s2
+srai a1 s11 10
+sltu s2 s1 s5
+sltiu t2 s2 -665
+mulhsu a3 ra a3
+add s7 x0 a7
+lui a3 4476
+divu s9 s8 a2
+divu t6 s11 s11
+sll ra s9 t6
+auipc gp 446484
+srli s9 s1 12
+andi a6 a2 -1606
+srai s6 s11 4
+sltiu s0 a7 -1758
+sra s9 s5 gp
+mulhsu t2 a0 a0
+andi s2 a1 899
+andi s2 a7 887
+rem a3 a2 t6
+srli s6 s7 11
+remu ra a2 s1
+mulhsu a5 a7 t5
+andi x0 s6 304
+mulhsu t1 x0 a5
+divu a5 t5 s9
+ori s11 t1 -15
+ori a3 s3 -1758
+xor s6 t5 t0
+rem s9 a2 s10
+andi a1 a6 477
+andi t5 a5 -1163
+mul s7 s7 a7
+or t0 t1 s10
+mul t4 a0 x0
+sra t3 gp t5
+div s10 s6 x0
+srli s2 x0 9
+and s5 gp s0
+slli a4 t1 4
+rem s10 a6 a4
+sll ra t4 a5
+sll s6 t5 a6
+sltu s11 s2 a4
+srai s0 ra 6
+sll x0 s3 t3
+div s2 ra t1
+add t1 a4 t6
+mulhsu a5 s6 s6
+andi x0 s6 1440
+div s4 s4 s0
+slti t3 a5 313
+mul s1 gp s0
+srai a4 s3 22
+or t6 s1 t0
+slt a6 a2 s3
+addi s0 t2 -1853
+mulhu a7 a6 a4
+or t6 s5 t1
+srl s1 s8 s7
+mulh s4 s6 s10
+sltu s1 t0 a7
+slt s4 a6 x0
+and s5 t0 s5
+xori s8 s8 1578
+remu t2 tp s8
+rem s8 s9 s2
+srai ra x0 6
+andi a3 a1 847
+xor a1 t1 s5
+mulhu s11 t5 a7
+sra t6 tp t6
+srli s8 gp 22
+xori s3 a5 -1614
+srai x0 t5 24
+addi tp t5 -850
+xori s3 s8 -376
+srl a2 t1 t4
+div t3 t3 s8
+slt tp a3 a4
+ori t6 s11 -1407
+mulhsu a7 s2 t2
+mul t6 t2 t3
+sra t3 t3 s2
+mul t3 s2 t6
+div a2 t2 t2
+srl t3 a3 s9
+and a0 s7 s3
+slti t3 s5 930
+rem a7 a4 s9
+srli s11 t1 9
+mulhu a6 t3 s7
+or tp tp s10
+div x0 s7 s9
+and a7 a6 s2
+sltu s2 s11 a1
+sltu s2 s10 s4
+srl s1 t5 ra
+srai s5 s3 1
+sub s8 a6 a3
+add a7 a5 x0
+xori s3 t6 -435
+divu a2 s3 t4
+addi s2 s2 -245
+mulh t2 s1 s7
+mulhu a5 a0 x0
+mulhu s7 gp a1
+rem tp t6 a4
+mulhu s8 s9 t2
+xori s3 s0 -1433
+sll s7 s3 x0
+sra s7 gp t6
+sltu t6 s9 t0
+xori t0 ra -843
+ori s11 s2 939
+mulh t2 a2 t6
+mul a7 t1 s5
+and s11 a4 a3
+rem t1 s3 gp
+and s11 t2 s7
+andi s10 s7 2027
+slt t3 a7 t2
+lui t6 958119
+srli x0 gp 10
+slti t0 s4 -318
+andi a3 t5 25
+and t0 s2 s7
+mulhsu s8 a7 s1
+div gp s10 a3
+mulh a4 ra s4
+ori s9 a5 -1762
+add s10 t5 s8
+slti a4 gp -508
+slt a4 tp t6
+xor s10 x0 ra
+ori t4 a5 147
+srai a3 gp 3
+and s7 s3 gp
+add t6 a1 a2
+slti s7 s2 -192
+mul t2 s2 s5
+mul tp a3 t1
+srai s7 t1 18
+srai t5 a1 24
+xor a0 a5 a6
+mul s7 a3 s5
+auipc s1 1027498
+and s4 s6 s11
+xori t6 gp 1640
+sltu s8 t4 s2
+addi s4 t3 -1580
+andi t5 s6 -76
+mulhu s7 a7 s7
+slt s6 a3 t1
+srl a7 s3 s5
+sll s10 s5 t1
+div s3 s11 s0
+ori s0 s4 841
+divu a0 t1 a5
+add s9 x0 a3
+slli t0 s1 11
+ori t0 a2 -1649
+remu x0 s6 t4
+mul t2 a6 s11
+addi t0 x0 -18
+ori ra x0 840
+ori x0 t5 -201
+lui a7 783868
+auipc s2 847875
+sub t1 a7 s4
+slt t1 x0 x0
+mulhsu t1 t6 s7
+sltiu gp t5 -199
+ori gp s5 427
+and a3 s6 s3
+and s4 t0 s9
+lui t3 146030
+mulhu s7 s0 t2
+or t6 t5 s4
+mulhsu t2 t5 a3
+mulh x0 ra s10
+divu s9 s4 tp
+mulhsu s9 s7 t2
+and t0 gp s9
+srli a4 s11 0
+slli a6 x0 27
+xori x0 s7 486
+rem t3 x0 a1
+srl s2 ra tp
+addi a0 a1 1649
+lui a0 753316
+srai s9 s8 5
+lui t2 240578
+sltu t0 s11 s11
+srli a0 t6 15
+auipc s9 903197
+or s0 s3 a7
+slti t4 a4 -1299
+addi t6 s8 1898
+mulhsu s5 s3 t3
+divu ra a7 t6
+mulh t5 t5 tp
+mul s8 t5 s0
+remu a5 a3 s2
+auipc s7 362181
+srl a2 s9 s9
+slli a1 s11 7
+or s5 s6 a1
+slti tp s9 1775
+srli s10 s10 31
+divu t0 tp t0
+mulhu t0 s4 tp
+mulhsu s9 tp a4
+mul s0 t4 a7
+and a6 tp a1
+rem t2 a3 x0
+addi s0 s1 525
+rem s5 s6 a3
+addi a4 s2 -681
+slli s11 a6 3
+xor gp t1 s0
+ori t6 t3 1379
+rem s9 a5 a7
+sltu t3 x0 s10
+add s5 t3 s8
+or s0 s10 a1
+rem a2 a0 t3
+lui tp 599998
+or s1 a6 gp
+mul a2 tp a4
+div a3 s4 a3
+slt s10 a7 gp
+slli t5 a4 23
+or t6 a5 t3
+sra x0 tp a1
+mulhu t6 s7 a0
+ori s6 s0 -1416
+div t3 t4 s1
+divu s8 s3 tp
+andi t2 s5 1035
+ori s1 s1 1070
+srl s8 s1 s11
+sub ra a2 x0
+sltiu t6 s7 -28
+sra a5 a6 t0
+mulh s3 ra a0
+sll s8 s11 s6
+rem ra t0 s10
+srli s11 tp 8
+div t0 s5 s0
+mulhu s3 t6 a0
+sub tp s3 t1
+sltiu x0 a3 139
+srli t6 s1 20
+xor ra ra s5
+rem tp s5 gp
+slti ra s2 -1417
+andi s10 s5 -557
+addi t5 x0 1341
+mulhu t5 x0 s6
+slt s8 s11 a1
+sltiu s1 t6 -1042
+addi a7 s7 -665
+add t2 s3 a5
+xori s2 s3 -301
+mulhsu a3 a4 a1
+sub s0 s7 a2
+addi t5 t6 -638
+srl t0 a1 tp
+andi t4 a0 -78
+mulhu a0 a5 s7
+auipc s4 506464
+slli s5 ra 23
+andi s2 x0 1215
+mul a1 a1 s2
+mulhsu t3 s2 ra
+divu s10 t5 s11
+xori s2 s1 1663
+auipc s5 401703
+remu s8 a0 gp
+andi x0 t0 -1955
+andi x0 t4 -1605
+andi a7 t2 -1703
+rem t6 s4 s2
+srl s8 a1 a7
+rem ra t4 s7
+ori a0 gp 529
+addi t5 a7 1859
+rem tp x0 tp
+xori a4 a6 -866
+mulhu x0 a2 s1
+slli s8 s1 2
+slli a6 a0 17
+rem ra s9 t3
+and a7 t3 ra
+slli t5 gp 27
+slli s11 s3 26
+mulh a0 t5 t4
+xori a3 t4 -732
+ori s9 s0 -986
+srai a1 t4 16
+sra tp a0 t5
+mulhu a3 s3 tp
+sltu t2 t2 s8
+div tp s10 a5
+mul a5 s4 s2
+mul t6 ra x0
+ori s5 t6 409
+auipc t5 197073
+andi a6 s6 -1160
+rem t6 a6 t4
+sltiu a4 t0 1227
+xor t3 s1 s5
+and a2 x0 x0
+srai s4 x0 11
+srli t4 s0 3
+ori a7 s7 1706
+mulhsu a6 x0 s5
+remu t6 s2 t5
+and gp ra t4
+xori t0 a5 -1582
+add t2 t3 s1
+or t0 gp s10
+slt gp a5 t1
+slti t2 t2 -1279
+addi a1 s0 -947
+or a7 s6 t5
+sltu gp s10 t3
+ori s7 s1 905
+slli s1 t5 30
+sub a3 s9 s7
+srai t3 a5 14
+mulh t3 t0 s8
+div x0 s1 a4
+mulhsu s5 t2 a6
+srli s1 a7 16
+auipc a3 495223
+andi s8 s4 -1205
+auipc t1 825692
+srl t4 ra s3
+or t5 t2 s2
+andi a1 a7 -1059
+divu t0 s2 s4
+remu ra a2 tp
+slli t3 a2 17
+sra t0 t5 ra
+or s3 a0 a3
+slt t6 s10 s2
+mulhu s0 t2 tp
+and t5 t6 s0
+or x0 t4 a0
+mulhsu a0 a0 s9
+slli s10 x0 22
+mulh a7 t3 s8
+sll gp gp t3
+add s7 s2 a2
+xor s4 s2 a1
+ori s11 a3 -1140
+srai t4 a2 13
+divu a7 s5 s11
+mul s11 t2 a2
+addi s6 tp -2027
+addi s11 t5 -1943
+sra a1 a6 s4
+remu t2 s5 ra
+mulh a3 a6 gp
+srai t6 s3 9
+and t5 a3 s1
+sll t5 s4 x0
+ori s6 s11 -1852
+andi s11 s1 -1893
+rem a0 tp a3
+add t6 t0 a5
+sub a7 t3 a3
+lui a2 979700
+rem a4 s10 x0
+ori s8 s9 1524
+auipc s3 404344
+rem a0 a7 tp
+or a5 t2 t2
+srl t5 s3 a4
+srli a0 ra 15
+and x0 t0 a4
+mulh s2 a3 x0
+add a4 s10 t5
+addi a4 s7 -1079
+xor t0 tp t2
+lui a4 30240
+rem s0 s2 gp
+auipc s1 845494
+or ra s1 s8
+or tp s1 a4
+divu t1 t0 s11
+xor a5 t5 a1
+andi t5 a2 -1258
+sub s11 t3 t6
+andi t6 a2 -1101
+sub t4 s3 s7
+mul s8 t3 s6
+add t4 a0 s8
+divu a5 s8 t5
+lui t1 179304
+sltiu t5 t2 972
+addi a7 a1 676
+sub x0 t5 a2
+srl s9 ra gp
+mul t4 s6 gp
+sltu tp s6 tp
+lui s8 1046790
+addi s5 s6 -463
+div tp s6 s8
+rem s1 ra s4
+sra a2 tp s4
+or t5 x0 tp
+addi s2 gp -1317
+div s2 s8 a2
+remu a2 x0 s4
+or s2 a7 s4
+mulhsu t5 a0 a7
+lui a4 159794
+sra s3 a4 s4
+rem s2 s8 tp
+addi t3 a7 -804
+sltu t5 t4 a5
+mulh t0 s8 a6
+slt s6 a0 s7
+mulhsu t1 x0 t2
+sll s2 t2 tp
+div a0 ra t2
+divu t3 a6 x0
+srli t2 gp 27
+sltiu t1 s0 -817
+lui t6 229539
+sltu gp s3 s9
+xor a0 s10 a0
+mulh s11 x0 t1
+srai s1 t3 16
+xori s0 s8 874
+sltiu t6 s10 -1081
+mul s6 a4 s10
+slti s7 a0 -665
+ori t6 t6 -1860
+or a6 s10 t2
+xori s7 s1 -1907
+slli t6 s1 28
+sra ra x0 t0
+sll a5 s0 t5
+srl a5 t2 s1
+mulhu x0 t4 gp
+or t1 t2 a7
+rem a7 s6 t1
+mulhsu s7 s11 s6
+sltu a4 s5 a7
+lui t1 749654
+sltiu t1 s8 -2031
+sll x0 a7 gp
+ori a5 t3 -945
+or a5 s10 s6
+andi a4 t6 -1267
+sltiu tp t1 1576
+sll t5 s4 a3
+sltiu gp s9 -485
+remu ra s7 ra
+sub s0 s10 gp
+mul t2 ra a0
+auipc t5 295151
+remu t2 t1 a3
+rem t1 a6 s0
+remu s10 s0 s11
+add t1 a2 s0
+sll ra s5 a3
+srai s4 ra 1
+srli s7 ra 17
+sltiu s3 a0 -357
+addi a6 s0 -252
+sltiu s6 s11 -1888
+sltu s0 a0 s9
+rem s11 s4 t4
+srai s5 x0 23
+ori s9 s10 -1212
+sll s6 s2 a4
+lui a7 1048132
+div t5 s8 t5
+slt t3 s0 t0
+srli x0 x0 29
+mulh s6 t2 a1
+sll s10 s10 s7
+mulhu t2 a6 a1
+xori x0 a6 -1418
+lui s6 674232
+andi s4 s0 -35
+sltu ra s11 ra
+slt s7 a5 s0
+mulh a3 gp s0
+sra s6 x0 a6
+slli s4 t4 9
+xor t2 a2 tp
+xori tp s6 1042
+lui s0 227327
+and s7 t1 a5
+andi x0 s4 -156
+sll a0 s6 s11
+lui s7 498439
+remu x0 a6 x0
+auipc s7 197119
+xor s10 ra a2
+andi s7 tp -1985
+addi t3 t4 -247
+mulhu s4 t6 s0
+mulhu a5 tp s1
+add s10 ra s9
+sra x0 tp t0
+sll t6 s3 s9
+srli a0 s10 14
+sltu a2 s5 x0
+slt s10 a6 s7
+andi s0 a3 -497
+remu x0 s0 s7
+mulh a7 t5 gp
+and s2 a6 a0
+slli x0 t0 18
+sll t4 a4 a6
+addi s2 t5 -1424
+remu s9 a1 s4
+sub s7 t4 t3
+sll s3 t6 s11
+srai t2 a5 10
+div s3 t4 s8
+lui s0 970140
+addi s11 a2 1486
+ori gp a3 -1583
+sub ra t3 x0
+ori t5 ra 356
+xori s3 t2 -1030
+sub a6 a4 a6
+sub s9 s10 s3
+mul s7 t5 x0
+slti t0 a0 -19
+sub x0 a0 x0
+or x0 s6 t5
+addi a3 a5 -216
+slt s5 a5 a1
+mulhu t1 s5 s10
+ori x0 a4 1204
+srai x0 s11 21
+divu s8 t3 t2
+sra ra s2 t0
+sltu gp t5 t2
+sltiu s6 ra -108
+mul a7 s3 a3
+sltu a5 s2 t1
+mul gp t5 t2
+ori gp s5 -274
+sltiu gp a7 556
+sll s2 t4 t3
+add s5 s11 s9
+mulhu s2 t4 s0
+sltiu s5 s8 1412
+srl x0 a1 t1
+or t3 a4 x0
+sll s6 t6 s3
+andi x0 s10 -761
+mulhsu t2 s3 t2
+andi s2 t2 -1572
+mul x0 s8 x0
+xori s7 t5 -1996
+auipc s8 515982
+remu ra a7 s3
+and s11 t0 t4
+sll t5 tp s1
+addi ra s6 -1517
+srli t1 gp 14
+divu a5 a7 t5
+slli t6 s8 9
+sra s8 a5 t3
+sll s8 a0 t6
+remu gp s8 ra
+div t2 s8 a2
+and t1 t6 a2
+addi t2 s2 -159
+srai a6 a5 21
+xori s0 s1 -1553
+div a4 t4 x0
+lui s3 898949
+mulh s1 s8 s6
+mul a0 s3 s7
+sll gp a6 t3
+mulhu tp s7 a2
+div s10 ra s11
+mul a4 ra x0
+and a5 s0 t1
+remu tp s9 a3
+sll s11 t1 t1
+slt s11 a0 x0
+slli s11 s8 18
+remu s1 s1 s10
+sltiu t0 t5 -416
+divu s5 s6 s8
+sltiu t5 a1 -1836
+ori a7 a6 55
+sll gp s11 ra
+slti x0 x0 -510
+lui tp 188751
+sub t2 s5 a0
+auipc s1 161879
+divu s10 a1 a4
+xori s8 s2 -1869
+mul t3 s1 tp
+xori x0 a3 -1254
+sltiu a5 t0 1144
+sra s10 a2 s8
+slli gp a4 11
+srli s3 s8 5
+addi a7 s7 1074
+mulhu tp t2 a2
+srli a7 s8 4
+xori s8 a4 -1362
+add a0 t6 a0
+xori a6 s10 98
+slt s10 s9 t1
+divu s0 a7 a5
+andi tp s1 2017
+xori t4 a7 104
+xori s4 s9 1010
+andi s3 tp -1868
+xor a4 a4 x0
+sub s2 t0 x0
+slt t2 s9 x0
+andi t3 a6 -393
+srl a2 a4 tp
+sltu s1 s1 t4
+xor t4 x0 s9
+addi x0 s11 97
+divu a5 a7 a1
+mulh t3 a3 t0
+sltiu a0 t0 -573
+or t0 a2 s1
+slt ra s7 ra
+mulhu a2 s9 a2
+slli s7 s9 27
+slli a5 s3 15
+mulh s0 s7 s1
+sltu t1 s11 a1
+sra t0 a2 a0
+divu s7 s1 a4
+or t1 s10 tp
+slti s11 s5 -274
+srai s1 s9 16
+sra t5 s7 s7
+srli x0 x0 10
+add ra s2 a6
+sra a6 t3 t1
+remu a1 a0 t6
+lui a0 861836
+addi s0 t6 1065
+xori s2 s10 -1543
+andi s9 a0 -1327
+lui t6 647671
+slt a4 s6 t4
+lui t6 990733
+sra a5 a6 t4
+rem a1 s6 s11
+srl s10 s3 t1
+srai a6 s6 29
+andi t2 s11 -76
+srli t1 a6 1
+sll x0 s8 t1
+divu a0 s8 s6
+slli s4 s8 31
+slt s4 t1 s0
+and s2 t0 tp
+divu a4 t1 t2
+divu a0 s1 a5
+rem t6 s11 ra
+divu t3 a3 x0
+mulhsu gp s11 a6
+addi x0 a7 -1575
+sll a2 t4 a4
+rem a2 a6 s11
+sub t4 ra a7
+slti gp tp -1655
+srli x0 a7 16
+add s3 a6 s2
+slti s3 a5 1282
+mulhsu t5 a4 s4
+sltu a2 s7 t5
+div tp t6 t0
+ori x0 tp 843
+ori x0 s5 -1025
+slt a5 ra tp
+auipc a6 191742
+sub t1 gp t0
+xori s2 s2 -1996
+auipc a6 889378
+and a0 t0 a5
+and a6 a2 tp
+add t6 s2 t4
+rem t1 a3 s6
+srli x0 tp 18
+auipc gp 781210
+srai s5 t3 30
+add t1 t6 s9
+sub a4 s5 a5
+div ra s1 s5
+lui gp 956121
+div t4 t2 a7
+lui tp 1030308
+add s7 s8 a4
+rem a4 s10 a4
+div s7 s1 a1
+add t6 t6 ra
+ori s5 s8 -1809
+addi s10 a4 -1004
+div s1 t5 gp
+mulhu t1 t3 gp
+srai gp a5 10
+slt s10 gp s2
+sltu s5 a4 t2
+srli s8 t1 29
+sub s7 gp a1
+auipc a3 817054
+lui x0 627556
+slli ra s11 15
+srl s1 gp s4
+remu a5 a7 s3
+or a4 t1 a1
+slti tp a2 -552
+mulh a4 s3 ra
+add s8 a7 x0
+sltiu t6 a4 -1522
+sub s7 gp s7
+xor s8 s2 a3
+ori x0 s9 -198
 srl a1 a0 s9
-srai s5 tp 3
-sra a6 s4 t5
-lui a2 650876
-sll s4 t4 s10
-lui a4 986438
-mulhsu s8 s8 a1
-mulhsu a6 a2 s2
-srl t5 s6 s1
-add t4 a1 a2
-slt a5 s4 a3
-addi s3 t2 1980
-sra s8 ra a3
-mulhsu a6 a4 t3
-div t2 s5 a0
-sll gp s4 s2
-slt gp ra gp
-srai t4 s1 20
-or s8 s10 t4
-sub ra t6 t1
-add t1 s6 s7
-remu tp a6 gp
-auipc a7 501820
-sub s8 a5 s8
-sltiu x0 s1 -1669
-mulhu a6 s9 tp
-slt s1 s4 s2
-div a2 a6 s11
-divu s7 s0 s4
-addi t2 s2 -1548
-remu s11 tp t1
-ori tp s2 -387
-mul t3 t5 s3
-slli t1 s0 16
-srai s6 t1 12
-andi gp t5 -85
-div t3 s0 s8
-xor t3 s2 s9
-remu s7 t0 gp
-sub s5 s4 x0
-sltiu s7 a1 -1626
-sll s8 a5 s9
-divu a7 t2 s10
-lui a0 750092
-xor ra a3 tp
-sltu s10 s11 s6
-divu a6 t4 t5
-divu s0 a3 s2
-add a3 x0 a2
-mulhu s10 t0 a4
-xori s7 s11 -696
-mul a7 t0 a2
-xor t5 s8 t4
-srli a5 s3 26
-add t1 a5 s0
-sra tp s3 t2
-sub a6 t1 s7
-mulhu s2 s10 s6
-andi s9 s0 682
-auipc t4 323431
-and t6 s11 t6
-xori s9 a0 -2039
-sltu s5 t1 tp
-andi t6 x0 1236
-sra s11 a1 s5
-add tp s9 s6
-sub t3 a6 t5
-mulhu a5 s5 a0
-mulhu s2 s4 t0
-sltiu x0 tp -383
-slt gp a4 s7
-sltu s1 s8 s6
-add ra t2 a4
-divu s9 s0 t5
-remu a0 t6 a5
-rem a3 s8 a4
-mulhsu tp t6 s3
-xor s11 s8 s2
-xori t6 gp 153
-mul s3 t4 a3
-slt a4 s5 s11
-addi tp t2 -49
-rem t2 a7 a0
-srli x0 s1 19
-slli t6 s7 28
-mul a1 t2 a3
-lui s9 891833
-div t2 s10 s8
-div a1 t1 a1
-sltiu a6 s1 -1345
-add ra t4 x0
-sra s7 s2 s11
-mulhu t6 a5 s2
-slt a7 s2 a5
-lui s5 786473
-mulhu t6 a6 t1
-and ra t6 s11
-slti s4 a1 1819
-slti a2 s10 -1451
-add a4 t5 s10
-srai t5 s11 1
-srl s6 t3 t1
-mulhu t2 x0 s0
-and t2 a1 s3
-xori gp s9 -1998
-slti gp a3 1827
-sltu t6 s11 a0
-sltu t3 a3 s7
-mulh s5 t0 a7
-or s0 t4 a7
-mulh s11 s0 a1
-srai s3 a2 4
-ori s7 s10 -1549
-sltiu s2 t6 -316
-slt s7 a2 t2
-mulh a5 a2 a1
-sra a0 s8 t1
-sub a2 s5 s11
-slli t6 t5 15
-srli s1 t1 22
-addi t4 s0 -66
-mulh a6 t0 s2
-sltu s9 t6 x0
-slli t6 x0 16
-slt a4 a1 s0
-mulhsu a1 gp tp
-slli s3 s2 16
-sra t5 ra a6
-rem s0 s6 s11
-sra a1 a1 s5
-sltiu a3 s3 -1361
-auipc ra 640679
-mul s7 s11 s8
-mulhu t1 t2 gp
-div s4 t3 s9
-srai x0 gp 29
-srai tp a1 26
-sltiu s2 s0 1329
-rem t2 t2 a1
-mul t3 a4 a2
-srai a0 a4 0
-ori s7 s8 -250
-or a3 s6 a5
-xor ra ra ra
-srli t0 s8 30
-divu t4 t6 a5
-sra a4 a5 s10
-remu s5 s9 t1
-sub t3 a7 a2
-srli a3 s5 22
-lui t2 924404
-srai a7 s9 17
-sub s4 x0 s8
-mul a3 x0 tp
-and t6 a6 t4
-mulh gp s5 s11
-auipc s7 253183
-srli ra s5 12
-mulhu s2 s7 t5
-divu t2 t6 t5
-or s0 a3 a2
-sltiu s3 s11 -463
-andi s5 a6 -602
-slt t3 s6 gp
-xori t1 a1 -1115
-srai x0 s7 16
-ori tp tp -1406
-ori x0 s0 -1002
-mulh t2 s1 ra
-rem t6 s6 t5
-srli s7 a3 8
-div s1 t6 a3
-ori a1 s2 -1834
-lui s4 409712
-rem t1 gp ra
-and s2 s4 s11
-sra a3 a4 a4
-srai s1 s10 18
-sltiu t6 s5 -893
-andi t4 s10 -1423
-divu s3 t4 t3
-mulh a6 a2 a4
-add s2 x0 x0
-divu a2 t4 a5
-ori s2 gp 1616
-and a0 t3 a6
-sra s3 x0 t3
-srli t4 s1 27
-auipc s11 850870
-slti x0 s9 -1522
-srli a6 s6 24
-rem a3 t6 a7
-srl t0 s6 a6
-add a7 a6 s3
-sltu a7 t4 a2
-srl t0 a1 a6
-auipc s5 184458
-divu t2 t0 s5
-rem t3 t3 a3
-and a1 a6 s10
-add s3 gp s6
-mulhu a6 a5 a3
-andi a0 a1 -203
-mulhu s9 a3 s9
-divu a3 gp a7
-srl s2 a7 x0
-divu tp a3 tp
-slli a0 ra 27
-lui tp 624071
-and s6 ra t3
-sltu t1 s7 a7
-remu t3 t4 tp
-rem ra s10 a4
-mul s8 s7 s5
-sltu s4 s3 t5
-mulhsu t4 t6 a5
-sra s4 a6 tp
-xor gp s7 a6
-mulhu t4 a4 s3
-and t2 s0 s11
-div a2 tp x0
-mulh gp s5 s4
-lui a3 1016861
-sltiu s11 a6 -702
-srai t1 s9 31
-or t3 a1 t5
-slti s3 a0 1074
-srai a6 t4 3
-auipc t6 412622
-sra s7 a2 s9
-and t1 a7 s8
-sra a1 t1 a7
-ori t0 s6 -1878
-mulhsu s8 tp s2
-addi tp s1 -659
-srl a1 a7 s6
-slti s2 t4 -1481
-srl s6 gp tp
-or s2 a6 s6
-sltu t0 gp t1
-lui t4 461029
-sra s0 a7 t5
-remu s7 s10 s3
-add s3 a7 ra
-srli s2 t4 23
-rem t0 gp t3
-mul tp a5 s3
-mulhu a4 t0 a1
-sll s5 s11 s10
-mul x0 t5 gp
-mulh a1 s11 gp
-sltiu s10 x0 -245
-add t6 a0 t0
-mulh t5 a0 a3
-or s9 s7 a3
-div t1 s2 a3
-ori s9 a5 -1546
-add a6 x0 a1
-auipc t6 352019
-ori t1 t5 876
-sub t1 a2 t6
-divu x0 a5 t1
-sra a5 a6 s11
-ori ra t3 204
-sub s8 s8 s3
-sra t6 s4 a3
-slti t6 a7 578
-add a7 a4 s10
-sll t1 a4 t0
-add a1 s11 s10
-sra a6 t0 s8
-sll a7 s11 t3
-mulh a0 s5 a2
-mulhu x0 s5 t4
-mul s3 ra ra
-slli t4 t6 29
-sltiu s1 s1 -322
-div s6 gp s0
-lui a6 620530
-div a6 x0 x0
-remu s8 s5 t1
-sub t3 t4 t5
-slt t1 gp tp
-sra s3 a1 t4
-addi tp a3 -1604
-auipc a5 673961
-slti gp s6 -123
-mulhu s11 a1 s6
-slt s0 tp t0
-andi ra t3 -1551
-divu s11 a6 s0
-slli s3 x0 2
-sra t4 s10 s3
-srl s9 s6 a4
-rem a7 s8 x0
-mul gp gp t5
-andi s11 a4 -701
-andi gp s0 6
-ori s1 s7 58
-sltiu x0 tp -1792
-or tp t3 t1
-srli s2 t6 11
-sub a5 a1 a2
-xor a2 a5 ra
-slt a2 s2 gp
-addi tp s6 -1732
-sub a0 s2 t5
-addi s1 gp -1500
-mulh t4 s10 a1
-mulhu a7 s9 t1
-slli s5 t5 25
-mulhu s1 s6 ra
-or a3 a7 s5
-srl a6 t0 t0
-lui a7 471402
-xori tp gp -1875
-or a1 s11 t6
-sltu a5 s5 a6
-xor a0 x0 t1
-slt a5 t1 t4
-slti s4 s2 841
-addi s5 a0 -1105
-srli t1 s2 1
-mul t5 s4 s1
-xori t1 s0 1512
-and s0 s10 s11
-div tp s4 x0
-and x0 ra s2
-divu s4 t0 a6
-sltu s6 t6 t5
-divu s11 s9 a0
-remu t3 s7 t4
-andi tp s6 -1702
-or ra t3 s6
-sltiu a2 a5 -995
-srai ra ra 21
-lui t3 949165
-srli a1 a0 31
-xor s3 t0 t5
-lui s4 184200
-div s4 s6 a0
-rem s8 t4 s4
-xor s1 t2 a4
-slli s0 s6 17
-mulhsu a1 t4 x0
-mulhu s5 ra s7
-slt s0 a6 tp
-sub t0 a1 t0
-divu x0 s6 t2
-remu a7 t3 tp
-lui s6 294957
-mulhsu s5 s6 s4
-sub a7 t3 t5
-div tp t1 t2
-sltu s9 s6 s5
-slti a2 a0 1623
-and ra t2 s9
-xori s9 t6 -1293
-mul t0 a6 s0
-rem ra t3 s8
-lui s2 549434
-srl t1 s8 a0
-xor tp s10 s8
-auipc t1 131928
-sll s11 s5 s8
-lui t4 573856
-sra a1 t2 s6
-addi x0 s7 -1264
-sra t1 s11 a2
-mulh s9 s6 t6
-mul tp a6 s1
-sltu s10 a1 s9
-mul a5 t1 t1
-lui t1 954325
-remu t0 s7 s6
-or a4 s5 s9
-sll s9 a7 s1
-mulh s1 a4 t2
-ori t3 s6 1787
-mul s3 a2 s5
-mul s1 t2 s11
-sltu t1 s7 t4
-mul t2 t6 s7
-slti a1 t5 2014
-srli a2 t5 18
-add gp t6 a4
-andi a4 a4 1375
-divu t2 a3 s6
-divu a3 x0 s4
-addi tp s6 707
-sub x0 t2 x0
-srai t2 s3 14
-sub t4 t6 t1
-srl a1 a1 ra
-rem s10 tp t2
-mulhsu t4 s7 s5
-mulhu t6 s10 t3
-auipc a2 683210
-srai a1 s9 27
-mul s10 t0 t6
-slt t0 a7 x0
-sra t1 a0 s3
-div t0 a6 s11
-ori t1 s4 -1953
-addi t1 s11 -1605
-sll a6 a4 gp
-sra a1 a0 t5
-xor a3 s1 t2
-addi s10 a1 -918
-lui gp 101418
-mulhsu s5 t6 a7
-srai a4 s2 20
-srli s10 ra 13
-remu a7 s2 t5
-sll a7 t1 s6
-divu gp a3 t2
-sltiu gp a7 -903
-remu s10 s11 gp
-mul a4 s10 a4
-and t4 s9 a6
-lui a7 730127
-remu a5 a6 tp
-sltiu t6 s8 -1789
-and s7 s6 a7
-sltiu x0 a0 1499
-slt t2 gp t3
-xori a3 t0 -1122
-sra a3 a6 s7
-srai a2 a7 30
-sll t6 s0 t5
-and s11 t3 t1
-divu x0 s3 s9
-and a5 s10 gp
-srl t5 s8 gp
-remu s1 s0 t5
-ori s4 tp -1619
-add a5 s8 a7
-sll t5 s5 s6
+sltiu s6 a7 -1849
+mulh t4 t4 t2
+sll t0 t0 x0
+srl t6 x0 s7
+xori s7 s0 931
+slti x0 s0 1462
+slt ra a0 t6
+slti a4 t1 983
+addi s5 s6 1220
+rem a6 s3 t0
+divu t0 a0 s3
+add t3 t4 s2
+mul s6 s0 x0
+andi t2 s8 -1727
+rem x0 t6 a7
+slli tp s6 29
+mulhu t3 a4 a3
+mulhu tp x0 a0
+ori s9 ra 2044
+srl a1 s4 s1
+srli s0 s0 22
+lui tp 132771
+sll gp t3 x0
+div s9 x0 tp
+mulhsu t2 a1 a6
+sltiu s7 s6 -290
+srai s1 t4 26
+xor s2 a1 a7
+slti s1 s7 -671
+remu t2 a1 s8
+addi t2 x0 1084
+xori x0 t5 690
+mul t6 t6 s7
+div t5 s1 s3
+slli t6 t5 3
+sub t6 a2 x0
+andi a6 a4 -1502
+addi a4 tp 1734
+auipc a0 212827
+lui tp 58832
+slt s4 s5 t0
+srai s0 s6 26
+xori s8 t1 -1483
+xor x0 x0 a7
+slt t2 s10 s2
+andi a4 s11 -1497
+lui s4 321774
+and s2 a0 t2
+ori x0 gp -905
+mul tp s1 s10
+srli t2 s10 0
+add a1 s0 a1
+ori s0 s2 -412
+srl a3 s11 a4
+slti gp s0 1525
+xor x0 t6 s3
+div s1 s3 a4
+sltiu s6 s6 2024
+xori x0 t1 1036
+remu t3 s11 s8
+xori s7 s8 -865
+mulhu a0 t5 s0
+slli ra x0 16
+rem a5 t3 s8
+mulh s4 s6 s1
+remu a2 s4 s5
+sub a2 a1 t4
+ori x0 t3 96
+srl t3 a6 s8
+addi s11 s6 -1369
+add a7 s9 ra
+mulhu tp gp t1
+addi ra s9 -92
+mulh s2 t6 s6
+or t1 s10 t0
+xor a5 s3 tp
+mulhu s3 a4 x0
+slti t2 s8 -826
+srl t0 s7 s7
+add t2 s6 s0
+sub a7 t3 ra
+mulhu t4 t4 a7
+sltiu a2 s7 -180
+add s6 a4 x0
+lui t5 866353
+or a0 s11 x0
+slli t0 t6 25
+sub tp s7 t5
+divu s7 a4 t3
+remu s8 x0 ra
+add t2 a6 t4
+sltu t3 t5 s8
+or a7 a5 t1
+sll a2 t6 t6
+sub a4 s9 t6
+srli t1 t1 15
+slt a0 x0 s7
+rem s5 x0 t0
+mulhu s1 s8 t6
+sltu s0 t4 x0
+srl s7 a7 x0
+or a3 s11 s7
+remu a0 s4 a1
+andi a7 a5 -435
+or a1 t2 s8
+xor s2 x0 x0
+remu a1 s9 tp
+sub tp a7 x0
+lui s10 598692
+sub t5 a7 t3
+sra s8 s9 s8
+add gp t0 s1
+srai t3 s8 28
+and t4 t1 s9
+mulh ra a3 t6
+and s7 s6 t1
+ori t4 s4 -969
+ori s10 s9 707
+or t0 a1 s1
+and t3 a5 s10
+sltiu a2 s9 -119
+divu a0 a7 s2
+divu t2 a5 s10
+divu ra a1 a5
+div ra ra s11
+sra a1 a1 t3
+sltiu t0 x0 -863
+sub a2 t5 a4
+addi t2 t2 -1185
+mulhsu a0 x0 s11
+slli a4 s8 9
+sll a7 s5 ra
+slti t0 ra -1065
+div a4 t1 s3
+slli ra a1 5
+xor tp tp s11
+sltu s10 s9 a0
+sub t1 s4 ra
+mulh s3 s9 s4
+xori tp a0 -1801
+rem a1 s11 s10
+and s3 a1 a5
+remu ra s7 s9
+lui t6 815593
+and a5 s1 t4
+sub s5 t6 a7
+and t0 t5 s9
+mulh gp x0 s11
+slli a5 a0 12
+add t3 s9 s5
+lui t3 90880
+slt t1 s9 s2
+sltu s3 t1 t5
+srl a2 tp s0
+and a3 s6 a6
+mulh t4 t0 s11
+lui s10 600063
+andi a3 s5 -1820
+auipc ra 179490
+add t0 s5 s2
+slt t2 a1 s0
+or a2 a1 a5
+div gp s4 t3
+mul t1 s8 a4
+sltiu t5 a7 1400
+mulhsu t0 s5 t2
+or s7 s8 ra
+sltiu a4 a3 -1731
+sub s9 a2 tp
+divu s8 s7 s0
+remu s8 a3 t1
+xori s6 a4 -1254
+addi t1 a1 1086
+andi a5 a4 -545
+divu s10 a1 a4
+srli s9 x0 0
+ori t5 a1 -203
+srl s2 t5 s3
+lui s0 721941
+ori s10 a6 -2
+rem a7 s7 t2
+auipc s11 80995
+sltu s3 s6 s3
+mulhsu s2 x0 s5
+mulhu tp t5 a7
+sub t3 s9 x0
+lui t1 414680
+rem s4 s2 a4
+div a4 ra a4
+auipc a4 690437
+addi t5 a0 -1096
+srli x0 t0 4
+mul x0 t6 t2
+sll a1 a1 s10
+slli a7 s0 28
+srai a7 a6 31
+rem a4 x0 s0
+slti gp t5 947
+lui s7 166184
+slt s1 s0 t2
+or s4 a1 s9
+sub t3 s5 s0
+remu t1 s4 s6
+mulhsu s11 a6 x0
+ori s7 s7 -1550
+add t5 s5 s1
+sra a4 s10 t6
+xor t4 s6 tp
+divu a1 gp t2
+srai a1 a3 2
+auipc s11 290614
+remu tp s4 a0
+mulhsu s0 a7 a1
+divu tp s2 ra
+remu s0 t4 t5
+mul a0 s6 t3
+srli x0 s0 13
+sub s6 tp s10
+sra t5 a7 s9
+ori t5 a1 -835
+slti t6 s10 -1421
+auipc s2 461342
+slli t0 t3 18
+srai s4 s8 26
+mul ra gp s6
+lui a1 951136
+mulhu x0 t0 s0
+ori s3 s11 -899
+andi a4 t3 -1363
+srli t3 ra 12
+srli t6 s2 12
+slt s2 s11 s7
+rem a1 t6 a3
+sll s3 s0 s3
+divu s2 s9 s7
+xori s1 a1 -1661
+mulhsu t6 t4 a0
+andi s1 t4 -1574
+ori s3 s1 -2041
+sub t0 t1 a2
+sltiu x0 gp -497
+and x0 a6 ra
+sltiu a4 s7 1112
+mulh x0 s4 t6
+divu t2 t2 t6
+srli s0 a1 3
+rem s6 t1 t3
+sltu a2 t0 s1
+ori t4 gp -1061
+mulh s5 tp gp
+sll gp a0 s6
+rem x0 a2 gp
+sltiu t5 t0 1568
+sub s2 a3 a0
+add s1 s2 tp
+xor s7 a6 a6
+sub s1 s7 t6
+rem t6 t6 a5
+add t3 s7 x0
+andi s8 a1 1102
+divu a7 tp a0
+slti t6 t3 -71
+remu x0 a6 a4
+sltiu a4 ra -955
+addi t3 a2 1398
+xor a4 tp a7
+xori s8 s2 -968
+srai a5 a1 27
+mulhu t6 s7 a4
+slti t5 a6 -933
+slli a1 s9 18
+or x0 t2 s3
+slti a4 s3 -1420
+slli t4 gp 3
+sltu s6 t2 t1
+lui a1 906631
+mul a1 ra x0
+slti s1 s3 -928
+xor ra a5 s6
+auipc t3 156835
+divu a5 t6 s2
+remu s4 s10 a3
+mul t0 s9 t0
+and s3 a6 t4
+or t5 t1 s11
+slli t3 tp 10
+slli s0 s8 26
+slti a6 s10 -1400
+mulhsu a2 t0 s4
+mulh a5 a7 s7
+srai t4 t0 6
+slli t3 t1 8
+andi a4 s0 -105
+slti s0 x0 287
+addi t3 s9 923
+mulh a5 s7 s2
+div a4 a5 t6
+srai s7 x0 14
+xori t2 t2 1894
+slti s9 s3 -448
+mulh a6 s2 s3
+sll t3 t6 s3
+div t3 a1 a1
+ori t1 x0 -301
+xori a2 s6 -1475
+ori s3 s2 -545
+andi s11 t2 -1715
+sra a2 s6 a4
+mul t1 s7 t4
+sltu a7 t5 s4
+div a2 s4 a4
+mulhsu gp t4 t4
+slt t0 t4 s6
+sll tp s6 s11
+sra t5 s7 a2
+sltiu a1 a1 -1593
+andi tp t0 320
+addi a3 s2 1239
+div x0 s10 s5
+or gp s8 t1
+xori t0 s3 -1562
+addi a3 a3 1113
+and t0 s11 s3
+remu t6 t2 s10
+srli s3 x0 21
+sll s2 a6 a3
+sll a3 ra t1
+xor a1 a7 s6
+div x0 tp t4
+slt s6 x0 t3
+rem s8 ra s1
+mulh s1 t3 s5
+srai s9 x0 31
+div s11 a3 s5
+mulhu s6 gp a5
+auipc s8 710906
+auipc s8 428972
+srai t1 s7 29
+slt t6 x0 s6
+slli a3 a6 9
+mulh t4 s8 a7
+srl a2 s1 t0
+addi s1 a6 -1024
+sra t6 tp a0
+srl ra s10 x0
+slt s5 t2 gp
+div s2 a5 s4
+auipc s5 908200
+slt ra ra t3
+mulhsu t1 a5 gp
+srai tp gp 15
+auipc t2 256679
+slti s9 s3 -310
+slti t3 s0 -661
+mulhsu t4 s8 s9
+lui s3 344634
+lui t0 690146
+mulhu t3 s4 t1
+div t0 t1 s9
+remu s8 gp a2
+sra t4 s1 t0
+ori a6 t0 967
+and s7 x0 s0
+ori t0 s11 -1958
+srli a4 x0 5
+sra a2 s5 a4
+or tp tp t2
+sra t5 a7 a4
+or s9 a6 s6
+mul t5 s8 s3
+rem a0 a7 tp
+auipc x0 23441
+mul s11 s4 s0
+sll a6 a7 x0
+andi t6 s10 1026
+xori t6 s9 1103
+slt s9 s9 tp
+sltiu s11 s3 -399
+andi a4 a0 -280
+slt a5 x0 a1
+andi a7 t2 -418
+slti t5 a2 -1143
+sub t1 s4 a3
+mulh a2 s3 a3
+div a7 ra s4
+slti x0 s4 -1272
+and t2 t5 s0
+mulh s4 t1 s10
+mulhsu s9 t4 s3
+lui s7 216588
+slli a2 s4 4
+divu x0 x0 a0
+sltu x0 tp s9
+andi x0 s3 -819
+and t0 s8 t6
+div s11 t6 a5
+andi s4 a3 -264
+add t0 t6 t3
+sll s10 t4 x0
+slt a2 t0 a6
+and s1 a1 s2
+sll a0 x0 t3
+xor s8 x0 t2
+and x0 ra a1
+sltu tp t0 x0
+sltiu t3 a6 1043
+auipc t4 37852
+sltu t6 s2 a2
+addi s0 s8 -453
+remu t6 s10 x0
+srai a0 s3 23
+slt s5 s5 s11
+lui a2 325422
+remu a5 gp s9
+lui s0 939017
+mul s1 s0 s2
+divu s0 s7 s8
+sltiu t3 gp -2002
+sra s11 s5 a3
+sltiu s1 t3 1237
+mulh x0 t4 t4
+div ra s3 t2
+or t6 a2 t4
+ori s7 ra 116
+srl t4 x0 gp
+xor a0 t6 t0
+lui t4 461417
+xor x0 t3 t2
+srli s2 s2 11
+auipc t4 81937
+rem s7 a0 s1
+xor s11 a1 t3
+add t0 ra a5
+auipc gp 238491
+auipc a0 745130
+or s1 s7 t4
+divu s11 s5 s1
+ori t6 s9 -964
+addi s4 ra 794
+srai t1 x0 23
+sltu gp ra s0
+sll t3 t3 t3
+divu a4 s11 s2
+slt s10 t2 s4
+add gp a0 s3
+mulhu s11 t3 s2
+lui a0 479275
+srai a0 s1 19
+srl a1 t4 t0
+sltu t2 a3 s1
+ori s3 s0 -1409
+remu s6 s8 s4
+lui a2 364269
+mul a5 gp t6
+srli a2 s5 18
+mulh a1 a5 s1
+rem s8 s5 t0
+ori a2 s4 -590
+srl s7 t4 s11
+divu a0 s9 x0
+slti s9 t0 105
+srai s4 s7 19
+rem gp t0 s0
+mulh t4 x0 a3
+sltu a2 t4 a3
+sra a2 t4 s6
+remu t6 gp a7
+ori a4 s8 -1962
+remu s5 t0 s6
+mul tp s7 s2
+mul a4 t2 gp
+lui x0 253043
+mulh a3 a6 a6
+slli t4 a7 13
+sltiu ra a5 1583
+mulhu x0 t0 s2
+xori t0 t6 1354
+slti s5 s3 -316
+add t2 a2 a6
+divu s7 s10 s11
+remu a3 s9 s9
+ori t6 a6 -1868
+xor ra a4 s8
+sra a4 s4 t3
+sra tp s11 a0
+sltiu t4 a4 -208
+div t6 a3 t2
+sltu s0 s4 s3
+mulhu a7 s6 tp
+xori t5 ra -1260
+ori a5 s1 1687
+srl s8 s9 a0
+lui s1 807985
+addi a1 s0 595
+xori gp t4 1505
+mul s5 s5 s1
+sltiu a0 a3 -74
+slli a1 x0 28
+addi s7 t5 -1334
+add t5 s1 t5
+slli s5 s4 8
+srli t5 s4 24
+slti t0 s4 -596
+rem s2 s3 a3
+mulh s9 a2 s3
+srl a3 a5 a4
+rem s7 s5 t4
+xor s7 s3 t2
+lui s4 279219
+or s11 gp a5
+xori t5 a3 -588
+andi s0 x0 -305
+ori a2 t5 -1513
+sub s1 s11 gp
+slli s3 a6 26
+slt a3 tp tp
+auipc a0 278909
+slt t2 t2 a5
+sub s9 s6 t6
+mulh s6 s3 x0
+slti gp s11 451
+mulh s0 x0 a6
+and a6 s7 t0
+sra s8 a2 s10
+lui gp 881677
+slt t6 a2 s1
+add s5 s2 tp
+auipc a4 192613
+rem t4 s0 s1
+div gp t0 a5
+sub t4 gp t1
+xor s4 s10 x0
+sltiu s5 s11 -350
+auipc s10 250777
+srai a1 s11 30
+sub a4 t4 s2
+mulh s4 s10 tp
+srli x0 s2 20
+mulhu gp s8 s10
+sll a7 s2 ra
+divu ra s4 a3
+ori a1 a2 -1263
+remu tp a7 a7
+mulh a5 s6 s0
+divu a5 t0 a1
+sub s4 tp a1
+divu s10 a1 t1
+xori t4 x0 -542
+srl s5 t0 t0
+remu s10 x0 t1
+slli s2 a3 6
+sltiu t4 a0 -514
+sra gp s5 a2
+sltu t0 s9 tp
+sra a6 a5 s2
+auipc x0 139204
+slti t5 s0 -353
+div s8 a7 a6
+and s9 a0 t2
+add t1 ra tp
+sltiu s8 s10 -1366
+or s8 t3 t1
+slli t0 t5 7
+mulhu a7 s9 s11
+divu x0 ra ra
+srli t2 a4 16
+sra tp a1 gp
+sltiu a3 s0 -121
+and t0 ra s4
+sltiu s3 s1 -1761
+andi s4 t2 -1519
+mulhu a7 s1 t6
+sltiu s2 a5 -1353
+mulhsu a5 t5 tp
+ori s5 t3 2011
+sltiu s6 s5 1506
+sll x0 tp s3
+xori a5 t1 -770
+and t3 x0 a5
+ori s6 s3 1392
+mulhu a0 s1 t3
+divu s4 s0 s0
+sub s3 s2 a0
+ori s4 s10 -653
+divu t4 s1 gp
+addi s1 t6 223
+sra t4 t6 t6
+srli s7 t6 30
+srli a4 ra 9
+mulhu s5 t1 s8
+divu a1 x0 s2
+mulhsu x0 s9 a4
+auipc s4 919711
+addi t4 t3 -341
+mul a4 a5 s9
+srai ra a2 7
+sra x0 s1 t0
+add t4 s11 a0
+sll t4 gp t2
+lui a4 896395
+sltu s5 s1 a3
+sub a6 s5 t1
+srai a1 s5 20
+auipc s9 788260
+and a3 t1 s6
+slt ra ra a6
+sltiu t2 s1 722
+auipc tp 663286
+rem a4 s6 t5
+remu t5 s10 a7
+andi s3 gp -102
+div a0 a4 s2
+addi s5 tp -1959
+sltu x0 s0 t4
+srl t3 t3 s7
+slti a1 gp -1306
+srli x0 tp 21
+divu a1 s2 t5
+remu s5 s3 a7
+slli ra a4 6
+mul t6 a6 t5
+sll s11 s4 t5
+srai a4 x0 0
+xor s6 a6 a4
+xori s2 s6 1780
+srl s8 s9 a2
+mulhsu x0 t1 t2
+auipc s1 407689
+ori t5 s7 1044
+add a3 t0 s0
+slt a1 s0 a2
+auipc t2 213187
+remu t3 a6 s4
+ori s1 a3 1944
+ori x0 s1 -1620
+div ra a1 a3
+mulh s1 t6 a5
+rem s11 a4 s2
+sltiu s0 s1 1564
+lui a6 253970
+auipc s5 330073
+remu s9 a6 s8
+slti s4 s5 1703
+auipc s5 924033
+slt x0 tp s4
+add s4 s10 s8
+sub s0 t3 a1
+slli a0 x0 29
+srl x0 t6 x0
+and t2 gp t6
+auipc s3 371853
+mulh t5 t6 s1
+or s8 s1 t2
+slli s0 s1 2
+divu s4 s11 t6
+slt t6 s2 a2
+mulhsu s4 gp t5
+srai s0 ra 31
+xor t5 s7 tp
+or s0 s9 s2
+mulhu a5 gp s4
+div s5 s4 s6
+auipc tp 59186
+slli a2 a5 9
+auipc gp 904330
+addi a0 s3 -1253
+sltiu s4 t4 255
+lui t4 778018
+mulh ra a0 s10
+slti t6 s2 -1475
+srli s2 x0 3
+addi s4 x0 -317
+srl s10 a5 a1
+mul t4 s3 a2
+mulh t4 a0 ra
+xori t1 s6 -1651
+slli t2 a5 30
+auipc s10 86597
+mul t0 t0 a5
+slli s3 s7 5
+or a5 s0 s5
+add tp s2 s0
+or s7 ra a0
+mul s11 s2 s4
+div s1 a1 a7
+srl t1 s4 x0
+sra gp a2 s9
+add a5 s5 s11
+remu tp s5 s3
+divu s10 s5 t2
+mulhu s3 a4 a6
+or s5 s4 s0
+srli s7 a7 8
+ori s10 s3 -353
+slli a7 s3 26
+xor t4 s10 a6
+lui s1 105450
+div s9 a3 a3
+ori a6 a5 -1250
+sltiu s5 ra -562
+srli a4 t5 14
+rem t4 tp s5
+and a5 a6 x0
+mulhu s2 s8 s9
+or s11 s4 s5
+lui s3 497715
+mul a4 t3 s0
+divu t6 t2 s10
+xori t2 t3 -1630
+auipc a4 584798
+mul s11 s8 t5
+srai tp t2 23
+srli s7 a3 12
+sltiu t3 x0 -883
+slti t2 a2 1520
+mulhu s8 s7 s3
+slt a3 t1 s3
+xori s10 t3 912
+andi s3 s4 -1134
+add x0 t1 t6
+slti a1 x0 751
+sra s3 a7 t6
+addi s0 s4 -1943
+slti a0 a5 -1636
+divu t5 a3 t6
+and t3 a1 t0
+andi t4 s4 -1411
+addi x0 ra -367
+div s4 s6 t4
+slli a5 t0 7
+auipc s2 481117
+slti t6 a1 -493
+mulh tp s5 s3
+add s5 a3 t6
+srli s1 s3 30
+srai x0 x0 2
+divu a4 s4 a6
+addi tp s7 -896
+xori s10 a2 -1718
+xor t0 s9 s2
+srl a3 ra s1
+slt a0 a6 s7
+mulhsu a6 s7 ra
+remu a4 s0 t3
+mulhsu s11 a6 a1
+xor s4 t4 a6
+andi t2 s4 1410
+and x0 s3 s9
+add s3 a4 t6
+sra x0 s8 gp
+sll a0 s3 a3
+srai ra s4 8
+sub t5 a6 t0
+srli s7 a5 6
+srli gp s6 27
+sltiu a3 s8 1391
+xor t0 a1 a5
+add a5 a6 t4
+and s1 gp gp
+add s4 ra s5
+sra t0 t3 t1
+addi a4 s6 -820
+mul a6 tp a0
+srli s6 s8 5
+mul a0 s8 t2
+rem t3 t5 x0
+div s9 a3 s0
+sll s10 gp s2
+srli t6 t4 0
+sub t3 t2 a4
+srl t3 a4 a3
+sll s6 s4 s1
+mul t2 t2 t0
+sub t4 s11 a3
+slti s7 s3 -756
+sltu x0 tp a7
+slli a0 t4 18
+divu t5 x0 a4
+add a7 a2 s2
+sltiu a3 s11 -786
+add a1 s2 ra
+mulhsu a3 a5 s3
+xor t2 t3 s11
+auipc t2 530603
+lui t1 581283
+sll a4 ra a1
+mulhsu t0 a7 s9
+sltiu s6 t6 -477
+xor s2 s0 a2
+sltu gp x0 s4
+sltiu ra s11 -1269
+srli s2 s11 25
+srl t0 s9 x0
+slli s11 x0 2
+sll a1 a4 s1
+xori t1 a7 302
+addi gp s8 -515
+addi s5 t4 -84
+and t3 t0 a0
+div ra a6 t0
+add a2 s2 a0
+lui s2 178750
+xori s1 s1 2025
+srli a5 t4 11
+div s7 s10 s7
+addi s7 x0 -1677
+srai t3 gp 19
+sltu s7 a5 s6
+sltiu a4 a3 -1692
+srl s2 a0 x0
+mulhsu a7 tp a2
+divu s4 a6 t2
+mulh s8 a6 a1
+sra s1 s9 t2
+or x0 s5 s8
+mulhsu s2 t5 t1
+addi t5 tp -1450
+srl s9 s4 t3
+slt s7 s6 s10
+sltiu a7 s11 -1759
+srli t1 s1 23
+remu tp s5 s0
+ori gp x0 -99
+mulhsu a5 s6 ra
 mulhsu t0 s9 ra
-sltiu t3 s2 -705
-sll ra s5 s3
-slt s1 t1 x0
-sll gp a0 s10
-auipc a2 425105
-addi s11 t1 -303
-div t4 a4 s4
-mulhu s4 t2 a3
-div t6 s10 a5
-sra tp s3 a7
-or a4 s3 a2
-remu t3 a5 a7
-divu a5 t3 a7
-mulh t3 s11 t4
-rem a3 s0 a0
-auipc s8 474307
-slti s8 a6 -1611
-auipc t5 133999
-add tp a6 t5
-mulh t6 s3 s3
-lui t3 567216
-ori s8 t1 517
-slti s4 t5 -1289
-sub t3 x0 t0
-remu ra s10 s3
-divu a4 a1 ra
-srli t2 a5 9
-or ra t5 s7
-srai tp t6 10
-mul s2 s2 ra
-slli s2 s8 2
-div s9 a0 s9
-slli s4 s1 9
-remu s6 tp t5
-slt a4 a5 a0
-or s8 t1 a6
-sltu t0 t0 s10
-mulhsu a3 t6 a1
-mulhu s4 s3 a1
-lui s0 11904
-xor t4 s3 a1
-div a4 s10 s8
-divu a0 s7 a0
-sltiu s3 ra 538
-lui t3 996826
-sub a6 t2 t6
-mulhu x0 t5 a4
-and s2 s7 t5
-xori a2 a0 -1277
-sub s3 s6 s7
-sltu x0 gp x0
-andi t2 a7 -207
-sll s6 t3 s3
-sltiu gp s4 -605
-mulhu a4 gp a3
-xor gp a4 s4
-andi s2 s2 311
-srl x0 x0 t4
-slli gp t2 17
-xori t3 s3 -822
-slt s8 a7 a3
-divu s5 t6 x0
-mulhsu s7 t6 t3
-sltu t1 t6 a2
-div x0 t4 s2
-remu s1 s7 a4
-div a5 t5 a7
+addi a7 s9 -868
+mulhsu a3 x0 t4
+xori tp s11 -1942
+remu s0 s8 a6
+srai x0 a7 11
+slli t4 t5 2
+sll t3 s4 a1
+lui ra 519691
+mul s9 t1 s3
+mul a6 t0 t0
+slti s3 gp -769
+sra t2 t6 t1
+mulh ra t2 a2
+xori s2 a0 1968
+mulhsu x0 a6 a0
+sltu t2 s2 t5
+mul a0 t0 gp
+remu s5 tp tp
+srli a4 t4 3
+lui s8 615776
+sra s2 s5 t0
+sra x0 a6 s10
+ori s8 t4 -823
+slt a4 t5 a5
+mulhu s2 t0 a3
+sub s1 s9 a7
+addi s6 s0 921
+sltiu s6 s4 -286
+slti t4 t4 -118
+mulhu t6 a2 tp
+mul s2 ra s2
+srl s11 a5 a7
+ori a6 s2 -1651
+ori s2 s6 -257
+srai t2 tp 31
+mul t6 a0 s2
+slti t3 s11 -1435
+andi a2 a1 1646
+srli x0 a3 28
+slti x0 s8 -1426
+mulhsu a1 s2 s5
+rem s1 t5 a2
+lui s11 526329
+mulhu t5 a2 t6
+slli s7 ra 28
+or t0 a1 a6
+ori s3 x0 -452
+slti s8 t4 -914
+div x0 t0 a3
+sltu tp t3 ra
+mulhsu a2 s9 a6
+andi a6 a5 -1567
+lui a3 537524
+srl s4 t1 a0
+addi t0 a0 952
+mulhu a0 s10 s0
+xori t1 gp 461
+divu a1 tp s11
+mul a2 a7 a4
+remu s4 a5 t0
+xori s10 t0 -1917
+sra t6 s3 s9
+xor s0 s0 s10
+or s3 t3 ra
+mulhu a5 x0 t1
+sub a0 s5 t6
+slti t5 gp -1148
+andi a6 t4 -1673
+sra x0 a7 s1
+mulh s8 a1 x0
+slli tp gp 29
+sll s10 s3 a5
+or t3 s4 a1
+srai s11 s11 14
+sra s0 ra s2
+sltu a3 gp a6
+sra t6 s7 s0
+div a4 a0 a0
+rem x0 t1 a0
+sll a3 a3 s0
+addi a3 a7 -1539
+sltu t4 t4 s8
+sra s4 t5 ra
+mulhu gp tp s1
+rem t0 s0 s3
+slli a3 t5 12
+mulhsu t6 x0 s6
+sltiu a0 s6 -1826
+srl s2 s4 t0
+sra a6 t1 a6
+and s0 s7 s7
+mulhsu t1 t3 t0
+or a3 t0 ra
+slti a7 x0 1320
+mulhu s4 s7 x0
+slt a2 tp a4
+ori s8 s8 -142
+rem a2 s0 ra
+or a5 s6 s11
+lui a2 227636
+auipc a4 41967
+srai s0 s9 21
+remu x0 ra s1
+rem s1 s9 x0
+remu gp s1 s5
+srai gp t3 8
+andi s1 x0 814
+sll a0 t1 x0
+mulhu s10 a0 s1
+mulh x0 s2 a0
+srl tp s5 a0
+add a4 s11 a1
+div t4 t0 tp
+slti a1 t1 -260
+sltu ra t6 t3
+sltiu x0 a1 -1887
+auipc ra 594833
+xori s11 s4 1642
+div a5 s2 ra
+slt ra a3 a3
+xor a2 t0 s0
+mul a7 a0 a3
+srl a6 ra s0
+remu t2 s11 t2
+or s9 s2 s10
+addi t3 a2 -223
+auipc s9 974368
+srli a1 a4 13
+sll x0 a0 a1
+mulhsu s1 t0 a1
+sub a0 a6 s0
+sll a3 t5 a0
+srli a3 a0 27
+srl s6 s10 t2
+srli s3 a5 5
+srl s5 s7 s8
+and a6 s2 s9
+srli s9 a5 4
+lui t6 954244
+ori t2 s3 1005
+remu a7 s0 s1
+div a4 a6 s3
+ori a4 t3 -1565
+sra s6 a0 t3
+addi a1 x0 351
+srli a1 s11 4
+lui t0 149358
+srl a2 tp s1
+xor a4 s11 tp
+div a3 x0 s7
+sltu x0 a4 t2
+or s11 x0 s2
+and a1 s1 t0
+mulhsu s3 tp t3
+xori t2 t5 -308
+srai s5 t6 3
+rem gp tp s8
+srli a1 s7 12
+srl a0 s10 a6
+xor s3 s7 s10
+srl t1 s10 ra
+lui t2 109585
+srl a3 t5 s8
+xor gp t6 a7
+remu a3 a1 tp
+addi s10 a4 -1078
+xor t6 t5 a0
+sltu s7 t4 s5
+lui s3 911642
+mul x0 t4 a7
+lui s0 90633
+auipc s6 376131
+mulh x0 gp a1
+sltiu t0 x0 -435
+remu s3 s0 s9
+sll t2 a2 a0
+mul s4 a5 a0
+mulh x0 s2 s8
+srai a4 t4 25
+add t2 t6 s3
+remu s6 a2 a7
+mul s0 t5 t5
+mul s11 s10 s11
+divu x0 t4 a1
+and s6 a2 a5
+sltiu a7 a5 1784
+auipc a3 571201
+mulh s10 s9 s9
+sub s8 s1 a2
+mulhu s8 a4 ra
+sltiu s8 a6 -1161
+divu a6 s9 s0
+and s10 t2 tp
+lui a6 120033
+srai a3 a2 15
+andi s5 s3 -598
+divu s1 x0 t1
+mul a1 s8 t1
+slti s11 t5 -582
+srai a3 a0 9
+mulhsu t4 a0 x0
+mulh t4 s3 t4
+mulhsu t0 s8 s6
+xor s1 t5 t3
+lui t4 116246
+mulhsu s1 a3 s9
+sltu x0 s3 gp
+slti s9 s7 2016
+div a1 t5 s7
+and s8 s2 a7
+auipc s3 323485
+mulh x0 a3 a7
+rem s5 s4 s11
+andi tp t3 -998
+slt x0 s4 x0
+auipc s11 886130
+xori a6 ra -1540
+xori a6 s0 -1051
+slt a2 x0 t4
+srli a6 s5 6
+remu t3 s4 t5
+srl s9 a7 a0
+sltu a6 s0 s5
+mulhsu ra a6 a3
+div s0 t4 s6
+slli a7 t2 19
+sltiu s3 a4 -1627
+xor t0 a1 gp
+xori a0 t5 -910
+auipc t3 1023422
+auipc tp 373572
+srai t6 s0 7
+auipc s5 539675
+addi gp t4 -837
+srl t4 a2 s4
+divu t6 a7 s10
+sra s9 s2 s4
+sll t6 a7 s7
+sll a3 s10 t2
+add ra s1 a7
+and t0 ra s0
+lui s6 759538
+and t2 gp tp
+slli t3 s9 11
+xori t5 t2 -987
+rem s0 a0 a3
+sll ra t4 a4
+srli t4 s6 19
+add a3 t3 t1
+sub s1 x0 s4
+xori a1 s5 1433
+andi x0 t0 533
+div s6 s9 s0
+ori tp s1 -1988
+slli s0 a3 31
+remu s11 t6 a6
+auipc s0 470133
+sll s3 a2 s4
+remu a6 gp s2
+div t0 t0 a3
+ori x0 t6 1641
+xori t3 a1 261
+and s2 s5 x0
+addi x0 s10 1834
+divu s6 s7 t4
+addi a5 s8 -1366
+xori s1 s5 1573
+div s7 a0 t2
+divu a0 t2 a5
+sll s4 s10 s3
+sltu a3 s10 tp
+sll tp s0 a4
+sll tp gp s4
+xor s8 s8 t4
+srl s3 t5 s7
+sltu gp t0 s11
+add s4 a5 a7
+sltiu s4 s11 1190
+xor s6 s6 s8
+srli s7 x0 18
+andi x0 x0 440
+srli s1 a7 13
+and a1 a3 a1
+mul s3 s5 s0
+sub a4 s9 s3
+rem a3 ra s9
+srai ra s6 9
+sltu s5 s11 s6
+add a0 a0 s4
+mulhu t3 s2 s5
+sra a6 t0 t0
+remu a4 a2 s2
+sll s0 t1 s0
+srl t6 ra s4
+srli a4 s0 31
+rem a6 tp t0
+mulhsu a1 s9 t4
+slli s9 a7 13
+addi s8 t3 -1279
+remu s1 a2 s9
+or t3 s9 s4
+slli ra a1 31
+auipc s9 915868
+mulhsu tp x0 t5
+auipc s8 545115
+auipc t6 54205
+mulhsu a6 s8 tp
+andi a7 t1 -1724
+or a7 s2 s11
+sub s11 x0 s2
+and s10 s9 gp
+remu s4 ra a3
+auipc s6 748931
+sll s10 x0 s0
+sll a0 x0 s2
+andi s0 s6 -971
+srai s5 x0 10
+slli t0 t0 1
+mul t5 tp ra
+ori a7 s1 95
+mulh tp a5 a7
+slt t6 s3 s7
+mulhu s11 s3 ra
+srl x0 a2 a3
+xori s3 s7 -1665
+div s6 s8 s4
+sra x0 x0 s11
+sltiu s0 a2 1660
+and t0 ra a1
+ori s9 x0 -1919
+sub s6 x0 ra
+xori s8 s5 -1554
+rem a0 a2 a3
+or s9 ra a3
+rem s7 x0 s7
+rem s1 t4 s7
+remu s6 gp s1
+divu x0 a1 t1
+mulhsu s4 x0 x0
+mulhu a2 a0 tp
+xori gp tp -586
+auipc s9 247128
+sra s8 s8 t6
+srai a1 s6 2
+srl t2 t6 a6
+slli s7 tp 4
+slti s2 s5 -668
+mulh a0 a5 s5
+andi x0 s9 788
+sll a0 x0 gp
+sub s6 a0 s4
+srai a4 s9 19
+xori a6 s3 1209
+remu x0 t0 s7
+sub s0 s2 s10
+div t3 x0 a5
+slli s9 s8 11
+ori a4 t0 -1094
+add t2 s5 s1
+slti s9 t4 -836
+sltiu s7 s0 1423
+sltu t5 s3 t2
+remu a7 ra t3
+mulh s3 a7 t1
+mulhsu t4 s6 a1
+ori s10 s10 377
+mul s8 tp tp
+sll ra t4 x0
+ori t6 s9 -308
+sltu t1 t1 gp
+addi t4 t4 228
+add s7 t4 a5
+mulh s9 x0 a3
+and a3 s0 x0
+div a1 a7 a0
+auipc s8 580037
+sll s8 gp s4
+div s0 s4 s8
+sltu t5 s8 x0
+sra t0 t5 t4
+or t0 a0 s7
+rem s5 a1 t4
+rem t1 s7 s1
+xor a4 a4 a6
+sltu s11 gp s10
+ori s0 s8 -860
+remu s2 tp t2
+slt a4 s4 s8
+sll s10 s0 t0
+srai s11 s0 5
+add tp x0 s11
+sub s3 a0 s4
+slli x0 s5 1
+mulhu s6 s10 a4
+mul s6 t5 t0
+sll tp a6 a5
+xori s1 s4 -564
+xori t6 s2 -337
+sltiu a6 a6 1097
+srl tp t5 a7
+srli a2 s7 14
+divu a6 a4 a5
+slli a0 a7 12
+andi s5 a3 751
+or s3 s0 s2
+mulh s8 a0 t3
+addi s9 a1 -544
+mulhu s7 x0 t2
+slti a3 tp -1785
+sra s8 x0 a2
+mulhu a7 s5 t3
+xori s0 s2 1423
+sub s9 t6 t3
+srli a2 x0 26
+remu a0 t0 s6
+addi a7 t2 -1099
+xor t6 s6 s10
+addi a7 t0 946
+srl s7 x0 s6
+sra t2 s1 s4
+remu s9 tp s4
+remu s3 s3 x0
+div a3 t1 t4
+slli s2 t1 8
+or s2 t2 t5
+sra a2 a2 x0
+divu a6 t5 s10
+sltiu x0 s8 -371
+mulh s4 x0 a2
+mulhu ra a4 a0
+mulhsu s7 t5 t2
+sra a0 a4 t3
+or a7 x0 s10
+remu s7 t1 s10
+slt s4 a1 s0
+and a0 s2 s9
+mulhsu a1 s6 s5
+srl a5 gp s9
+mul s1 s0 s8
+remu t5 x0 s2
+mulh s7 a2 s10
+srai s2 t5 4
+lui s0 194775
+divu a1 t2 t1
+srai a5 t2 12
+rem t2 s1 s5
+sub s6 s10 s9
+sll t6 x0 s0
+slti s10 s11 -1284
+srli a4 tp 0
+divu s0 a6 ra
+mulh a3 t1 s3
+addi s4 s0 -19
+and s6 s5 s11
+xor s10 a2 x0
+or a2 a0 a7
+sltu x0 s9 s11
+and s3 ra s1
+srli a5 t0 8
+lui t2 75282
+ori a1 a2 -1119
+srai a4 s10 9
+div s10 s1 s3
+sll a1 s3 a3
+or t0 t5 t0
+lui t3 224080
+srai s9 s6 8
+lui a4 355607
+slt t4 s3 tp
+andi a7 a0 776
+lui s5 250481
+div s5 t4 t1
+xori s10 t4 316
+sra s9 t1 a7
+xor s3 a4 a0
+div s5 t3 s7
+slli t3 s0 21
+srl a7 s2 a7
+mulhsu t0 a6 s11
+add a5 s2 a3
+sltiu tp s5 -1167
+divu s5 t1 t6
+add s1 a0 x0
+remu a3 s6 s6
+mulhu t4 t5 t6
+add tp gp s9
+auipc t1 795856
+xor gp t2 a7
+sltu x0 t4 x0
+slli x0 a0 17
+auipc t4 10499
+divu t4 t6 s11
+rem s4 s9 tp
+ori s1 s7 -435
+rem a1 tp s7
+sltiu a7 s5 39
+sltiu gp s8 -1872
+srai s2 s7 14
+or a4 a4 s6
+add s7 a3 a7
+divu s6 a1 a5
+andi a6 s10 -1366
+addi s3 s4 1104
+or s10 ra tp
+sll ra a7 t2
+ori gp s6 187
+srai t2 s2 29
+mulh s10 a1 t5
+lui x0 84938
+mulh a0 a3 s9
+slli gp gp 18
+mulh s3 a3 ra
+lui ra 99665
+sub a2 s1 s0
+remu a5 s0 a4
+add s0 ra s11
+sub t6 s0 s6
+sltu s9 s11 s0
+rem t6 t3 a5
+lui a3 167154
+xor a6 s11 a3
+andi t3 s8 1575
+slti s2 x0 -654
+remu s6 t2 ra
+srai tp a2 22
+sltu a2 t2 s10
+sltu t2 t4 t4
+ori t5 s9 141
+mulh t1 x0 a1
+sub t0 s6 s2
+or s5 a1 s3
+add s8 s4 a4
+lui s6 36177
+and ra a7 s10
+sra s5 tp s2
+lui a2 700477
+and t3 gp x0
+slti t5 t3 -1044
+slli s5 gp 23
+sub a6 a4 a0
+andi x0 t0 -640
+sltiu t5 s4 -2002
+sub t4 s11 s5
+ori s9 x0 -1652
+sub gp t1 a5
+div s9 t6 s10
+slli s10 a0 7
+or a4 a5 a3
+and s8 tp s11
+sub s6 t3 s10
+lui tp 886226
+sltiu tp x0 1011
+mul x0 s1 t6
+mulh ra ra s0
+sra s4 s0 x0
+mul s3 a0 s11
+mulhsu x0 tp ra
+ori a6 t1 1169
+andi a2 s4 1164
+sra s10 a2 t1
+slt s6 t3 s3
+slli s2 s2 3
+xor a6 s3 s11
+srai s10 tp 28
+srl a3 s9 tp
+rem s7 t4 t5
+mulh t0 a0 a6
+auipc a6 398748
+remu a4 a4 a7
+mulh s8 t6 t1
+mulh s0 a1 s9
+auipc s7 595008
+sra t5 a6 x0
+and a3 s5 gp
+xor a0 s2 t4
+slt a7 a4 s6
+sra a1 s3 s7
+srai s0 t6 16
+add s4 x0 s5
+lui s11 36688
+slt s0 s0 ra
+sll gp s5 s5
+auipc s7 819959
+mulhsu t6 s7 ra
+slli x0 t1 24
+mulhsu s10 t6 s8
+mulh x0 t6 t3
+xor a0 s3 a2
+sltiu a5 a5 -1671
+slti t0 s11 842
+sra a2 t5 a4
+slti s10 a4 -1961
+or a3 s2 t1
+slti s5 s11 294
+divu a3 s5 a7
+lui s10 189639
+remu s5 a0 x0
+mulhsu a5 s2 s10
+ori t5 s0 1944
+sra a1 s0 t5
+andi s7 s11 -448
+and t0 a5 a7
+rem t3 s10 a3
+ori t6 s6 -902
+remu t5 s11 gp
+slti s7 t3 -1345
+mulhsu a3 t5 s5
+mulh t3 tp t2
+sra a6 a1 t1
+mulh s2 s5 ra
+srai s6 t6 0
+sll s5 s4 ra
+xori s9 s5 -915
+div t1 t2 t6
+lui s6 185500
+mulhsu t3 s2 t5
+remu t6 t0 x0
+sltu t0 s9 a2
+lui s3 362906
+slt s0 s11 t2
+xor a4 gp tp
+srli s1 s3 6
+and t4 ra s10
+auipc a4 258478
+mulhu s11 s2 s7
+auipc a6 942698
+sra s5 s3 a4
+rem x0 tp a6
+sltu t3 ra s4
+mulhu s5 x0 t5
+mul s7 s9 x0
+slli a3 x0 10
+div s10 t5 s0
+srl x0 a6 s0
+auipc tp 272562
+slt a4 a2 t2
+srl a6 t3 a6
+slti s11 gp -1108
+srli s7 a5 31
+remu t2 t3 gp
+xor s7 s3 a2
+sltiu s8 s3 -1107
+ori s9 t0 1935
+divu t1 a7 a7
+sltu ra s0 tp
+mul s9 s6 a6
+mulh a1 s10 ra
+sub ra s6 s8
+andi a5 t0 -909
+sltiu s9 s0 -1633
+srl tp s4 a6
+add s10 a0 t4
+addi a7 s3 -1758
+srl tp s8 a2
+addi t4 t4 1675
+andi a2 a7 -1033
+lui a0 148642
+add x0 s4 tp
+divu s7 s10 gp
+mulh s9 a4 t0
+sub s10 s7 t4
+add s2 a0 t3
+auipc a1 329928
+sub t5 t2 a2
+mulh a0 tp t2
+srli x0 gp 10
+lui s6 131562
+mulh s5 a0 s4
+add a4 s1 a5
+mulh tp a2 t5
 remu a2 t1 s10
-rem a4 s11 gp
-mulhu a6 s10 a5
-mulhu t2 tp s9
-ori s7 s0 -200
-xor a0 a5 a6
-ori s4 t2 -1534
-lui a5 512798
-mulhu t5 t3 s6
-div s5 s2 a3
-slti a7 t2 312
-xor a2 a1 s1
-mulhsu t6 t2 gp
-mul t4 a5 s10
-slli t3 s4 1
-add t4 t4 a4
-remu t2 a6 x0
-slli t5 a2 4
-slli a3 t0 4
-srai x0 s7 6
-lui a1 645109
-mulhu s9 t1 gp
-divu s9 a7 gp
-addi x0 a3 1792
-sub t6 a5 a0
-sll tp s5 a3
-addi a2 x0 1334
-rem t1 t5 s3
-mulh gp s6 s3
-srai s5 tp 26
-xori s9 a4 -67
-sltu a5 s11 a2
-mulhsu t6 t1 a4
-rem x0 s6 t2
-xor x0 a3 t3
-remu t1 a3 s4
-xori gp s2 1945
-slti a6 s5 -1757
-add x0 s2 t2
-sra s1 t1 t0
-mulh x0 x0 t2
-mulh s1 s8 t1
-mul s10 t4 gp
-mulhsu s7 a2 s11
-andi a5 s0 -1128
-auipc s3 649853
-sra x0 s2 t2
-div s1 s7 t3
-add t1 tp s5
-rem s8 a1 s9
-sra t5 s3 tp
-divu ra a3 gp
-remu t5 t2 tp
-ori gp t6 -1033
-remu s3 x0 s2
-sub a6 s8 t1
-andi s8 t2 -984
-lui tp 463244
-sltiu a4 s6 -1780
-mul tp a0 s3
-sltiu gp s8 -914
-sltu a3 a1 a7
-mul t2 x0 a6
-remu a0 a4 ra
-add a4 s0 s3
-and ra t6 tp
-mulh a0 s7 a0
-ori s9 s11 1279
-slt s11 s2 s11
-sltiu tp s2 -981
-lui s7 743661
-sub s5 s9 s4
-xori ra a6 -265
-sltu a7 t1 a5
-srl s8 s5 s6
-rem t6 a4 s11
-sltu s7 a1 s0
-xor s7 t0 t2
-sll s7 tp a2
-sra t0 s8 s11
-sltu t1 t1 t0
-sltiu s0 t4 468
-slt s10 s0 t3
-mulhsu t2 s1 a6
-srli a4 a5 4
-auipc s2 119119
-or s11 s3 t2
-sltu s5 s9 x0
-srli t0 a0 9
-mulh gp s7 a5
-srli s5 s1 7
-sltiu s4 x0 690
-lui t6 200860
-rem s10 x0 s1
-sub a3 s3 s10
-sll s2 t3 t3
-rem s1 s8 x0
-and s5 t0 t1
-div t5 s8 t2
-and s6 s5 x0
-xori a2 s9 -1255
-div tp s1 s1
-remu gp ra a1
-xori x0 s3 1667
-andi s3 s7 -1046
-mulh x0 a6 s5
-or a4 a7 a5
-srai t1 t5 14
-sub t6 t0 a6
-lui x0 401483
-rem s5 t0 a3
-mulh s3 a0 s3
-sub s10 a5 s10
-addi a3 t1 -1246
-ori t4 t3 1133
-sub s2 t2 s1
-slti a5 s2 -302
-add x0 t5 t0
-sltiu s2 t3 168
-srli a6 s8 7
-and t5 t0 tp
-mulh t0 s2 t6
-slti a4 t4 104
-div s4 t5 s2
-mul a7 a1 a2
-add a7 s8 t3
-lui s10 19409
-srli t3 t6 27
-mulh s0 s4 s0
-ori s9 a5 -1362
-sra a1 t4 s1
-and x0 gp s6
-sll s3 s10 t2
-xori ra ra 1119
-or x0 gp t6
-mulhsu a1 a7 tp
-and tp t4 t4
-mulhu s1 s3 s7
-rem s0 t0 a7
-xori s1 t1 -917
-sra s9 t2 s7
-srai s11 a5 23
-sll s2 s7 a6
-sub a5 a7 t3
-sltiu a7 a6 -1978
-div s6 t3 a0
-xor a6 gp s2
-div a3 s0 s8
-addi s0 ra -1791
-lui s10 129052
-sltu s2 ra t6
-srai ra a1 13
-srli s5 a2 19
-mulhu x0 s5 a2
-ori a5 a3 -1399
-ori x0 a7 -1453
-addi s2 ra -80
-rem s2 t3 t5
-ori s5 a2 -1278
-srai t2 a5 5
-divu t5 a2 t5
-slt a0 a6 s6
-remu s9 t0 s4
-lui s11 665312
-lui a1 589584
-mulh s5 a1 s4
-sra a5 a7 x0
-addi t6 s11 -1652
-slli gp t5 29
-srli s8 s1 22
-sra s6 a4 s9
-srai s11 x0 28
-mulhsu s2 a3 t5
-div s8 s11 t1
-divu a4 t0 t4
-div ra s4 s8
-remu a1 s2 s1
-sll s8 t3 t5
-remu gp a6 s8
-sra ra t2 t1
-andi ra a5 -503
-mulh s10 gp s3
-mulh tp x0 gp
-remu gp s6 s11
-ori s6 s11 -900
-srai s8 s5 5
-lui s4 286263
-divu ra a2 t6
-or a2 x0 a2
-srli s11 gp 12
-srli a1 t3 28
-ori t2 tp 958
-rem s8 s9 t3
-add s11 x0 s11
-xori a4 ra 426
-xori x0 tp -1992
-andi s11 x0 -839
-auipc a6 747824
-remu s3 s8 x0
-srl a5 s11 t5
-mulh s5 tp t2
-lui a7 891620
-slt t2 x0 tp
-srl t1 s3 ra
-sub t4 t4 a2
-sltiu t3 a3 -32
-mul x0 a2 tp
-slli a3 t2 12
-srai t5 t1 20
-srl a3 s10 s6
-slti a1 a4 312
-sll t4 x0 s11
-sltu t6 a7 t0
-sra s10 t6 s7
-srai a1 s4 14
-sltu s2 t4 a3
-divu ra ra x0
-slli a5 t3 20
-sll s4 t0 s8
-xori t0 s4 151
-slli a2 a1 29
-andi tp t4 2045
-sub a3 a2 t3
-or t3 s2 s10
-andi s10 s6 1957
-divu x0 s9 tp
-mulhu a2 t5 a7
-or a4 a0 ra
-mul x0 x0 a4
-slli t3 t4 4
-sltiu t0 x0 820
-rem tp t4 a0
-mul s4 s4 t1
-srl a1 s5 s5
-or a3 x0 t1
-srl t1 x0 t1
-srai a3 a2 18
-addi t5 a2 -953
-ori t4 t2 -1247
-sub x0 t1 s1
-mulh s5 s7 t5
-div s3 a6 s6
-sub tp x0 s11
-sltiu s6 x0 -1283
-ori a0 ra -1431
-sll x0 s9 a0
-srai a6 a1 21
-ori s0 s10 -397
-lui a2 667480
-xor s1 s10 s1
-mulhsu tp t2 x0
-mulh t2 a3 a7
-sub a3 t0 s0
-addi t6 a0 -1713
-xori t1 x0 1172
-div a3 ra t5
-ori x0 ra 1367
-sll a1 a5 s0
-srli s10 s5 23
-sltiu s3 s6 -1558
-rem a1 s3 a4
-auipc a6 1163
-mulhu s1 t5 t3
-mulhsu t1 tp s7
-sltu t5 s9 a4
-add s5 s11 gp
-mulhsu t4 t2 t3
-divu s6 s6 s5
-xor s11 t1 a3
-add t2 x0 t2
-srai a1 s5 8
-sltiu s1 s2 -1499
-rem s8 s3 t1
-xor s5 s3 s3
-mulh t5 s0 s8
-slli ra s4 10
-mulhsu tp s10 s0
-rem s9 s8 s0
-andi tp s3 -877
-mulhu x0 t3 a7
-sltiu s10 t0 -2
-mulhsu a5 ra s10
-lui t3 535263
-sra a4 gp s7
-divu s3 s11 t0
-mulhu s7 a7 x0
-divu t5 s8 a7
-sub s8 s2 s1
-xori t2 s11 -890
-rem s0 s11 ra
-ori a7 s9 -946
-xor ra ra t2
-xor s9 s6 a2
-and tp s10 x0
-addi t0 s0 -1890
-rem a0 t3 s3
-andi a6 s10 1010
-ori x0 s7 -950
-lui tp 922005
-slti s5 t6 -929
-and s2 s3 t3
-sub t3 s0 s1
-remu s0 a0 s6
-div a5 a1 a0
-srai a4 s9 23
-srl s7 t4 gp
-sltu s5 t0 s7
-xori t5 s11 -1035
-slli s4 x0 30
-andi a1 s5 -31
-mulhu s6 t2 a5
-sub a0 s8 a5
-add a6 t1 ra
-add t1 s6 s7
-mulh a7 a6 gp
-divu s6 a5 a6
-divu s9 a7 x0
-slti ra tp -621
-mulh x0 s0 t3
-sll s11 t1 a3
-divu s3 tp a0
-slli s4 s4 27
-sltiu a2 s7 -1177
-slti a7 t5 -126
-auipc ra 861707
-lui s1 351174
-xor s8 s3 s11
-addi s0 s10 -219
-div s9 a4 s4
-srli a7 gp 31
-xori s3 s5 -1443
-sltiu s11 a6 739
-or x0 t1 a0
-lui s6 210411
-srai s8 s1 8
-addi s11 tp -1782
-slt s3 a2 t4
-srli s4 s5 16
-sltiu t0 s9 -1817
-slt s11 a7 ra
-mulhsu t5 ra t4
-ori s11 s8 -234
-andi a0 tp 1146
-and t0 gp t4
-andi t6 gp -450
-sra a0 s1 s11
-rem t2 s9 x0
-slti a0 t1 -203
-srai a4 s4 2
-auipc ra 740934
-srai s9 s3 16
-mulh x0 s6 a7
-andi s2 a2 -1223
-sll a6 s9 s10
-mulhu t6 t4 s3
-div a7 x0 s10
-lui a7 534551
-auipc t3 414050
-mulh t1 a1 t4
-addi t5 t5 -464
-srl s3 t2 s11
-slli ra t0 9
-srl a4 a3 a0
-add a2 s8 s3
-sll s0 ra t2
-slt t2 a4 s2
-sra a0 t1 s9
-sra t1 t1 gp
-or s1 s9 t6
-slt x0 s5 s0
-srl s11 tp t2
-slt s1 t1 a5
-mul s1 s7 s6
-mulhu t4 a4 t3
-xori a1 gp 1150
-xori s0 s1 -1348
-mulhu s3 t6 a0
-slti s2 tp -1325
-xori ra a3 -1348
-remu s9 t5 a2
-mulh s5 s10 t6
-srl s2 t3 s1
-mulh t4 t4 a2
-sll s10 x0 x0
-xori t0 s3 -1151
-mulhsu s8 a2 a0
-auipc a7 861233
-and x0 t0 t5
-rem a0 s0 s8
-add t1 s5 tp
-mul a4 s2 a1
-mulhu s6 x0 a3
-rem s2 t1 s8
-div a7 a6 a2
-mulh a0 t0 t6
-add ra a2 t6
-slt s4 a3 a1
-srl s0 s5 s6
-and a0 s5 s7
-rem s11 ra t4
-srli s7 s9 17
-remu x0 s9 t5
-div s11 s7 t4
-divu s4 a3 s6
-sltu x0 s1 s9
-andi gp s10 864
-remu t6 tp a4
-xor s6 ra x0
-xor t5 s6 tp
-mulhu t4 a2 t2
-auipc a2 837279
-div t5 t2 t1
-ori s6 t2 -570
-slli s4 s5 7
-auipc a4 732261
-xor t6 s0 s5
-sltu a2 a0 a5
-srai a4 a6 29
-mulh a4 s1 t2
-mulhu s4 tp gp
-sub s4 a3 s8
-sll a7 s4 a7
-sll t4 a6 t4
-sltiu a1 a6 1516
-sra s8 a6 s9
-slli t5 x0 25
-and t3 s10 a5
-xori t6 s1 -1904
-add s2 gp gp
-mulh t0 s3 s2
-slti a3 t0 133
-sltu s10 s4 t3
-sub s7 a5 a1
-add a4 a2 t0
-sra s9 x0 x0
-add t2 s7 tp
-div a6 t6 x0
-or a7 s6 gp
-mulhsu s9 t4 a5
-add s1 s0 s6
-or s0 t6 s3
-andi s0 x0 335
-srl s9 t1 a0
-slti s0 tp 495
-slt s9 s3 a3
-sub s7 t3 s1
-mulhu t5 t2 a7
-srl s8 s10 t0
-xori t4 s8 -68
-xor a7 s9 t1
-slti s9 s4 575
-srai t0 t4 0
-ori s10 s4 -1855
-sub s6 a3 s10
-ori s11 t6 -300
-or a5 s10 a7
-auipc a3 354849
-xori s4 s10 -311
-sltiu a5 a3 -1559
-sll t5 s8 s8
-slli t1 s8 9
-mulhsu a5 a0 t6
-andi t4 s1 1627
-andi s11 a4 -1768
-xori s10 x0 -1044
-sltu t2 s1 a6
-andi a2 x0 153
-ori s10 s9 908
-rem gp s7 a4
-auipc s8 47660
-sll a2 t5 t0
-add a4 t1 x0
-addi t2 s4 -469
-sltu x0 t6 x0
-or t0 t3 t0
-rem t6 a1 a0
-mulh t4 s4 s8
-mulhsu a5 s7 a5
-slli a2 a1 12
-or a4 t3 s6
-sltu a0 gp t3
-sra s1 a2 x0
-and s7 a7 s7
-sll s7 s4 t3
-rem t2 tp t0
-sltu s6 a0 a6
-sub s2 t4 t6
-srli t0 t0 13
-sll t5 s11 a3
-sltiu t4 a3 1010
-sltu ra s10 a6
-rem a4 s8 s6
-slt a4 t6 a7
-andi a6 a7 -1049
-srli s7 t4 2
-slli ra a2 26
-div s5 s2 s2
-add t3 s10 a5
-mul a2 a0 t6
-add s1 t3 tp
-sll a1 x0 t3
-sll s3 s5 s2
-add s8 a3 gp
-srai s0 s1 14
-mul a4 t4 gp
-addi x0 t6 -1796
-slli s10 ra 24
-sub t6 a6 tp
-sra s11 a3 a6
+auipc t1 1020038
+lui t1 1044523
+sub t3 a2 gp
+mulhu s2 s1 tp
+xor s7 s9 s8
+add ra s7 a4
+lui s9 292483
+ori s0 t0 -197
+remu t4 t1 t2
+srai a2 t5 12
+lui s11 326259
+xori s4 t5 1894
+slli s0 s4 8
+srli s8 a3 2
+slt t3 t0 x0
+or s1 s5 a1
+srli a7 t6 10
+ori gp a1 -279
+slli s7 tp 13
+slt t3 a6 t4
+sub a7 tp s6
+and t5 tp s9
+srl s4 s1 tp
+ori s5 a5 -960
+remu x0 s11 a4
+lui s11 10093
+srai gp a3 25
+mulhu s7 t5 s10
+addi tp a6 990
+srl t6 s0 s3
+slti t1 gp 625
+ori a2 ra -175
+auipc a1 725168
+auipc s11 465436
+slli s8 s1 5
+addi a6 t0 214
+auipc x0 186221
+sra x0 a4 t0
+div s1 gp a5
+srai a4 x0 15
+sltu s11 s1 t0
+ori a7 a7 913
+slti s7 s7 -710
+lui a2 213379
+ori t5 t0 -799
+mulh a5 s9 s1
+lui a4 259235
+andi s7 s9 845
+ori t1 ra -1561
+divu x0 a7 a6
+slti s1 a4 -92
+srai s5 t2 6
+ori a6 s0 -1924
+xor s6 a4 x0
+auipc ra 1043904
+mulhsu s10 a4 t5
+rem t6 s4 a5
+rem gp t3 gp
+remu s5 a3 s7
+lui a0 578361
+divu a0 s11 a4
+lui t3 370699
+auipc t1 820709
+mulhsu t4 x0 a4
+slti s1 s0 -19
+sub a7 s3 tp
+sltiu s4 tp -1180
+auipc s2 471765
+sub a2 s0 t1
+slti tp t0 1097
+mulhsu s11 t4 x0
+mulh t5 s5 a7
+srl t5 s10 a2
+sltiu s10 s4 -15
+divu s3 a3 t3
+and s5 s10 s7
+addi s11 s6 131
+and a1 a6 s9
+srli s5 s3 18
+mulhsu a7 s4 gp
+slt t4 t6 s8
+sltiu ra s5 -73
+add tp s6 s0
+mul ra t6 t0
+auipc s4 29756
+mulhu x0 s3 a3
+srl t4 s5 x0
+and s5 s7 s7
+div t3 t4 s9
+ori x0 a0 -1110
+mulhsu s1 x0 t2
+srl a1 gp s9
+mulhsu t6 a4 s4
+xori a0 s8 -1567
+sub a7 s2 s5
+sub t6 s7 a1
+addi s2 a5 -502
+or a7 gp t0
+or a6 a2 ra
+sltiu t4 s8 15
+slti gp a7 -1521
+add s10 a3 s8
+sltu s3 s4 gp
+lui a3 106748
+auipc x0 793325
+slti s0 s9 1783
+addi t3 t4 493
+andi a0 a4 -1513
+mulh t6 t2 s5
+andi s1 ra 800
+xor a3 a5 t6
+remu a7 s11 x0
+sra s2 a2 s11
+srl t0 a6 x0
+or s9 s11 s6
+srli ra s11 12
+lui s10 902950
+sub t1 a2 a6
+srli a2 s0 17
+slt a1 s6 s2
+srli t6 s8 17
+remu x0 s2 t0
+sra a6 a1 x0
+addi t0 t0 -313
+xori t2 s0 -490
+ori a7 ra 1100
+sltiu x0 a7 1204
+remu s7 s8 s0
+mulhsu t6 s10 t4
+divu a0 t1 t5
+mulhsu t0 x0 x0
+rem s2 t6 tp
+ori a7 s2 -1350
+slti t3 a5 -1319
+sltu s2 a0 a0
+addi a7 s3 1722
+sra s4 s10 a5
+slli t0 a2 22
+auipc t1 550722
+sltu a5 t5 s11
+slli a4 a6 16
+srli s9 t1 19
+divu t1 s8 s3
+divu t0 s3 x0
+slt t2 ra a0
+addi s9 a2 266
+sub t6 a1 s11
+add t2 t2 t5
+divu a4 s4 a3
+and s7 t0 t0
+or s4 a4 s1
+srli s8 s11 15
+mulh a1 a1 a5
+lui a0 305023
+addi t0 s0 -471
+sltiu s1 t0 -953
+or gp a4 a3
+sltu s1 s3 tp
+or s3 t1 s2
+or s10 s9 a3
+ori a4 t5 -1745
+mulh s10 gp s0
+sll tp a7 t0
+mul a0 a4 s1
+sub ra a1 s6
+srai t4 a0 21
+auipc a4 809448
+srli a3 x0 27
+andi s0 s3 -521
+sltiu s10 s11 1941
+div tp tp a6
+divu x0 s2 t3
+auipc s5 684650
+srai t5 x0 8
+srai a6 a2 21
+rem s6 x0 gp
+addi t0 a3 515
+lui a2 716262
+sra a4 a0 s1
+addi s8 s0 -447
+mulhsu s10 s10 a7
+lui x0 379347
+sub s8 t1 t1
+slti t1 a5 -183
+auipc s6 626918
+auipc t6 862760
+srai a3 tp 23
+slli gp s10 17
+mulhsu s2 t6 t5
+slt gp a2 x0
+slt a6 s7 t3
+mulhu t4 t6 s10
+lui s0 898545
+mulhsu s0 a2 s2
+sltiu s11 s3 722
+ori a0 a5 -121
+slti t1 t0 1828
+sltu s0 x0 t4
+andi a2 s8 1806
+xori s10 s0 -1475
+mul t1 a5 s9
+and s1 s11 a7
+sll x0 t6 t4
+divu t6 a0 s11
+lui s6 411931
+sra s1 t4 a3
+rem s3 gp s7
+remu t6 s4 s1
+and a7 s11 a7
+mulhu ra s0 x0
+andi s1 gp 1419
+addi t1 tp -172
+sltu s0 gp a6
+add a1 a4 s8
+rem a1 ra a2
+add a7 s5 a6
+sll x0 t6 a7
+slt a0 t0 s5
+mul x0 gp s2
+lui s8 800184
+ori ra ra 77
+and s1 s6 a3
+divu x0 s6 a7
+ori t6 t1 304
+slti a6 a4 -1360
+srl s5 a1 s3
+auipc s6 296039
+mulhsu a3 ra s5
+sltiu t1 s0 -198
+sltu t5 a7 a5
+sra t1 a2 s1
+mulh t3 s6 s8
+lui s0 64312
+andi tp s1 -1673
+addi a6 gp -848
+srli t1 a2 27
+xor a4 s4 gp
+rem s3 x0 t6
+xori t3 t2 -52
+remu a0 a5 a0
+xor x0 s8 s2
+srli s4 a1 28
+mulhsu a1 t5 a6
+mulh t0 a0 tp
+sub s0 a3 t1
+srai s5 s0 8
+ori ra x0 -1300
+sltiu a3 ra -579
+auipc t0 204461
+mulh s4 t6 s11
+and a1 x0 s1
+rem a0 s9 t0
+remu s1 t0 a4
+srl s3 t2 tp
+add t5 gp s1
+srl a7 s11 s5
+xori s5 a3 -1843
+xor s11 s9 s5
+div ra tp gp
+rem a7 gp x0
+sltu a5 s7 s8
+mulhsu t4 gp a7
+slt t0 t2 s7
+and a1 gp s9
+div s3 s10 tp
+addi a3 s11 -125
+add a0 s3 t0
+mul s1 a2 a6
+srai s8 t5 28
+divu s9 t3 s0
+div a7 s2 s11
+addi t2 t2 -455
+slt s9 s8 t2
+div s6 s2 s7
+divu s9 t5 s3
+mul tp s10 s1
+xor gp t5 a1
+lui a3 1017112
+srai s2 s7 30
+srl ra s2 t5
+add a0 t0 tp
+mulhsu s1 a7 x0
+auipc x0 832964
+or t3 s0 s11
+sub s11 t3 tp
+add a2 t1 t5
+xor a3 t2 t5
+divu x0 s6 t2
+add x0 ra ra
+slt s9 s6 s0
+srai s0 a7 5
+or x0 s10 s4
+remu a4 a7 s9
+sltiu t0 t5 -1235
+sltu t6 a3 gp
+addi s1 a3 -1176
+ori s5 s9 -1773
+and s2 gp x0
+addi s11 a4 -29
+sltu t4 s6 s7
+andi t5 t6 -1940
+add t3 a6 s4
+xori t4 s7 1015
+sub s8 gp a2
+srl t3 a4 s7
+addi x0 t1 426
+rem x0 t5 t0
+remu a6 s10 a2
+slt s4 a1 ra
+srai t6 t4 10
+srai x0 a2 21
+add a3 s2 t1
+xor a6 tp s2
+add a5 s7 t2
+mulhsu s10 t3 s0
+mulhu t0 a6 x0
+sub a3 a3 a3
+andi t0 ra -1963
+mul t1 t0 ra
+lui s9 745481
+andi s6 t4 -1821
+auipc s1 360661
+div a2 s7 t3
+div ra s8 x0
+sltiu a3 s10 852
+slti s6 a7 -998
+mulhu s5 a4 t4
+lui a1 977368
+mulhsu s1 a2 t3
+srl s7 s9 s3
+xori a5 s10 -1255
+lui gp 198823
+slt s6 s7 t3
+mulhsu t0 s7 x0
+mulhsu s8 gp gp
+slli a7 s3 21
+sltiu s10 s4 -341
+sub a1 a5 t1
+sltu s1 s3 a1
+div s1 a6 a7
+and t6 t0 s10
+sub t4 s9 s6
+auipc gp 861063
+mulh s11 t6 a6
+mulhsu s0 s1 s3
+xor ra s2 a1
+xor a1 t3 s3
+srl s0 s2 s3
+slti t2 t6 26
+mul s9 a2 a4
+sra a4 a3 s10
+mulhu x0 t1 ra
+div s9 t3 s3
+auipc a1 749573
+sra s5 a6 gp
+slt t5 t4 s11
+rem a2 a6 a2
+lui s3 658380
+mulhu gp s1 t0
+mulhsu s3 s7 s4
+rem gp s7 x0
+slt s9 a5 a1
+or s10 t5 s3
+mulhsu s9 x0 ra
+andi t4 x0 379
+lui s3 1007314
+slli x0 s9 13
+mul s3 s11 s7
+sltiu ra x0 -1965
+sltiu a7 s11 -408
+xor ra s1 t1
+and s1 s3 s4
+or x0 a2 a5
+slti a2 a2 453
+ori s6 tp -844
+add t2 t2 a1
+srai s8 gp 28
+mulh t0 s3 s5
+slli a0 a6 19
+mulhu t2 a1 tp
+slli s0 a0 7
+srai a3 a3 29
+srai a2 s5 2
+addi s7 s11 -269
+rem t0 s10 s4
+div a7 a6 a5
+and s9 a1 s8
+and a5 a1 x0
+addi a7 a6 -337
+and a5 a0 t3
+sra ra t6 s3
+div s10 t1 s0
+or t0 a2 a0
+xori s9 a0 -233
+or s10 gp t1
+srai s6 t1 23
+ori s5 t1 -527
+sltiu t1 a5 -1222
+andi s0 t1 652
+sll gp gp gp
+divu a1 s4 s3
+sltiu a6 s8 -865
+slti s0 t3 -827
+and a5 gp s3
+mulhu t3 x0 t1
+xor a3 s6 a2
+rem t2 s5 s8
+srli t3 t3 21
+srli s11 t0 20
+divu s2 t5 a4
+sltiu s6 gp 1725
+mulhsu gp s6 s3
+srai s4 s11 17
+and a4 s7 a0
+srai s11 a0 26
+addi t3 a3 1892
+add s8 t0 s5
+mul s10 t6 s5
+rem s2 ra a4
+sltu a6 x0 t0
+ori a6 s3 1619
+andi ra t3 -1960
+mulhu s9 a6 s3
+slli t1 t3 12
+sll t2 a3 a2
+sll t6 s8 s5
+slti a2 s2 1202
+add t0 s7 s0
+remu x0 s5 t0
+addi a4 s7 1033
+div a6 s9 s2
+div gp s10 s9
+sub s9 t2 s7
+lui t3 408659
+slt s4 s4 a3
+auipc t3 967457
+mulh a4 t4 s10
+or t0 t4 t2
+andi a7 s8 -362
+sra s7 x0 t1
+srl t5 a6 s3
+srli t4 t4 20
+slli a0 t5 1
+remu s3 s5 x0
+srl t3 s2 a1
+srli t5 a4 1
+mulhsu a6 s4 a3
+srli s11 a4 14
+ori t1 s8 2024
+sltu s8 t5 s9
+or a5 s10 t2
+andi a3 a3 -849
 mulh a6 x0 s1
-ori x0 a6 820
-sub x0 a6 s9
-mulh t1 s3 s10
-rem s4 t3 ra
-and a3 s7 t1
-sub t0 a3 s4
-auipc t0 242038
-div s10 a7 s10
-divu s2 s11 t4
-addi a3 s1 -199
-slti x0 t6 1745
-srai s6 s1 29
-rem s2 ra s3
-mulhu a3 x0 gp
-mulhu s2 s3 t4
-lui x0 358943
-divu tp x0 t1
-and a6 tp s4
-xori t0 s10 -1510
-lui s11 1022232
-lui t1 937249
-mulhsu s9 a1 a4
-slti t4 s3 -74
-srai s5 ra 22
-mulh a4 s2 a2
-sub gp t3 t0
-sra s7 a4 t4
-mulh s8 x0 s10
-mulh t5 t3 s8
-remu a0 s9 t1
-slti s11 gp -1830
-lui ra 351853
-mulhsu a1 a2 gp
-slt a0 s9 s3
-sra t1 t5 a4
-srai s11 s0 3
-add s7 a5 x0
-and t4 a5 s3
-div x0 a1 s10
-sltiu ra a2 -1647
-mulh s5 a1 a6
-auipc t3 827830
-sll s0 a0 a4
-mul s9 s1 x0
-lui s5 876039
-srai t0 t6 4
-srl t1 a1 s8
-mulh gp tp s3
-sltu a2 a5 s6
-slti x0 x0 -905
-srl t4 s2 a2
-sub t5 gp s1
-mul s6 s11 s7
-add gp a4 tp
-ori s7 a4 -110
-sltu tp t3 a7
-and t4 t3 x0
-or x0 t1 a5
-lui t1 651515
-sll a3 t6 tp
-auipc a6 385863
-mulhu t3 t3 s7
-mulhu a7 a0 s3
-lui s1 958495
-mulh a0 s2 s9
-mulhsu t1 a2 s2
-mulhsu t4 tp s4
-slt s5 t1 a1
-div s1 a2 s6
-lui gp 253779
-slti a5 t2 214
-xor t3 a6 t4
-mulh s6 s11 a6
-remu s3 a2 s3
-lui s9 185983
-add s4 s5 s4
-addi t3 x0 950
-addi s0 s6 -589
-div s0 t1 t1
-sll a0 t0 t2
-srl a0 s6 s2
-slti s6 a3 -1311
-srl s0 a5 a1
-and gp s2 t6
-sltiu ra t3 -289
-or s7 a5 t4
-or s8 a6 s4
-ori a3 t5 1048
-rem s2 t1 t6
-div a7 a3 t4
-mulhsu x0 a2 a4
-slti a2 a4 -1999
-xor a3 s10 a1
-add s1 a6 a6
-or x0 s0 t0
-divu s2 a0 s7
-ori s4 a7 -8
-add s5 s5 gp
-rem s0 t6 ra
-mulhu s9 a4 s9
-divu a2 x0 s1
-add s3 a3 a4
-srli s11 a3 10
-sltu gp s6 s11
-xor s2 s5 x0
-mulh s7 s8 s9
-addi t0 a6 976
-mul s5 a6 s7
-sll t1 s3 a7
-or s4 gp s4
-sltu s3 s1 a4
-xori a5 x0 320
-sra s1 a2 s7
-divu s4 t2 tp
-slti a5 s1 -1175
-srli a5 s1 6
-sll t4 t1 a3
-slli s2 x0 31
-srl a0 t1 a2
-sub x0 s9 a4
-srai s5 s2 2
-xori s4 t3 -1060
-srai s11 t4 18
-xori t0 a5 -1380
-srli a7 t1 18
-mul t6 t5 t3
-slti a7 tp 90
-add t0 s10 x0
-andi s1 a0 -266
-add s9 t0 t0
-or gp s4 t5
-sltu s8 a4 t2
-rem a7 x0 t1
-add x0 x0 s9
-srl s10 a2 s8
-div s7 a3 s0
-srl s9 a1 ra
-slt t6 s2 a1
-sll a6 a5 t0
-remu s8 s8 t3
-and a7 s1 t2
-mulh t6 t2 a1
-slt s11 s1 a6
-xori a4 x0 -1728
-ori gp x0 243
-or s0 s11 a1
-ori t1 t6 -1613
-ori s2 s4 -946
-ori a2 x0 -976
-sub t0 s10 s1
-sltiu a3 t1 494
-mulhsu s5 s9 a6
-rem a2 gp t2
-or a6 a3 t4
-slli s2 x0 12
-div tp s11 t2
-sltiu t5 t4 -727
-ori s1 s5 -1258
-and ra a2 t4
-sra s4 s9 a6
-sltu a7 a0 s2
-add s2 s8 s4
-divu t1 t6 a3
-sll a3 t2 t1
-mul t4 a2 a6
-srai a7 a5 7
-mul t4 a5 t2
-andi s4 s0 1614
-ori a2 s2 -1254
-sra a5 ra s2
-xori x0 t2 -127
-ori t4 s4 -105
-srli a3 t0 29
-slt s7 s2 a1
-sra a3 s5 a2
-srli a3 t3 6
-lui t0 858452
-slti tp a2 -1002
-div tp t0 s7
-or t6 s1 s1
-rem a7 t4 s4
-xori a4 s5 -1698
-auipc s10 995269
-xori a4 s7 -1078
-sll x0 tp x0
-andi a7 t0 2044
-slti a0 s4 1954
-andi s4 a3 227
-slt s5 a3 tp
-slti s8 t1 -1731
-divu a4 t5 t0
-srl a1 a1 t1
-rem t1 s10 a5
-xori a5 t0 -1269
-mulhu a6 a7 x0
-srl t4 s8 a6
-sll t6 s6 t5
-mulh t3 s8 s5
-xor gp a5 a7
-xor s7 s10 t4
-xori x0 s9 73
-and t3 t0 t3
-sub a4 s4 s2
-add s5 t1 t5
-srl a3 t1 s3
-ori s9 a0 -23
-auipc t6 1012184
-sltu s6 s3 s2
-div t2 t4 s5
-srl s4 s8 t0
-sub t3 t5 t4
-sub x0 s1 a3
-sltiu s7 s1 -909
-remu a0 s11 s2
-and x0 s10 t6
-srl a7 t2 s3
-rem s9 s0 a3
-auipc s9 878013
-xor t6 s2 s10
-sltu s10 a0 s3
-sub t2 a0 t6
-add s7 tp a6
-mulhsu a5 t2 s7
-rem s9 gp a7
-mul a5 s11 a6
-andi s1 x0 907
-slti s6 t2 -1783
-mulhsu s0 s1 s6
-addi t5 s11 -543
-add a4 t2 a2
-remu a4 s8 t2
-sub s9 tp a5
-slt s4 s10 s8
-slli t0 s6 18
-rem a4 t1 a4
-sltiu s7 t6 -322
-slli ra a3 15
-lui s4 562279
-mulhsu a4 ra s8
-mulhu a2 s4 s3
-addi t0 t3 -1043
-srai t0 a0 28
-srli a4 t6 28
-slti t2 a5 -1990
-slt a5 tp s4
-sll a2 s3 a5
-mulhu t2 ra a3
-div s11 x0 s7
-srai tp s11 7
-sltiu s8 s2 1371
-slti a6 tp -950
-divu t1 s0 a1
-auipc a4 239135
-auipc a5 9788
-srai a2 a1 12
-auipc s9 540199
-andi s0 tp -395
-div a5 tp s0
-slli s11 a6 23
-remu t2 s7 s3
-or s6 a7 t0
-sltu t2 s9 s9
-slt t1 a3 a2
-sltu s1 a2 s5
-remu s6 t5 a3
-rem a1 s0 a6
-slt s5 a7 s9
-andi t3 t3 -1709
-add a4 ra s4
-remu ra t2 x0
-mulh t4 x0 t5
-and t3 a2 s8
-sub a0 s1 s1
-and s0 s6 a7
-sra x0 t2 a5
-srai gp s10 16
-mulhsu a0 x0 a4
-srl x0 a3 s4
-srai s8 s6 0
-or t3 a7 s10
-mulhsu a2 t2 tp
-sub t0 s5 t4
-add s7 s10 s2
-ori a7 x0 1267
-addi a0 s3 -1526
-sltiu a6 a3 -1433
-andi tp a1 1813
-add t2 s4 a2
-div x0 t2 t6
-remu s8 s4 s11
-mulhsu s3 a1 t1
-mulhsu t6 x0 s6
-srl s4 gp a3
-auipc ra 735810
-sll t0 s1 a6
-divu s7 s3 x0
-mul a3 t2 ra
-auipc x0 146789
-sra t3 gp a4
-remu a7 a4 t4
-divu a3 a1 s11
-sll t0 t6 s11
-mul t5 t6 a1
-slti a7 s5 -1080
-sltu a2 gp a2
-lui s6 705246
-slli a7 a1 18
-or s8 a3 gp
-sll a0 gp t4
-or a4 s5 a7
-mul gp a6 gp
-sra t4 t4 s0
-slti s8 a2 -328
-srl a0 t5 s0
-auipc t6 583879
-srli s2 s1 24
-remu s1 x0 a3
-rem t2 ra ra
-sltiu ra x0 1962
-srai s6 s0 5
-and t4 s6 gp
-mulh t1 t1 t0
-ori s6 a0 -1237
-divu a0 s6 s4
-sra gp t4 s3
-mulhsu s8 t4 s3
-srli s2 s3 16
-auipc s9 620826
-auipc s8 176630
-mulhu t0 s10 t3
-mulhsu a5 t3 ra
-sltu s10 s10 a2
-and s7 a2 a6
-andi t4 s4 -1667
-sll a2 t4 a7
-remu gp a7 a5
-slli s4 t1 17
-mul s8 s2 a0
-auipc t5 214603
-rem x0 tp t6
-sltu a1 x0 t5
-sltiu ra ra -1211
-mulh s4 t1 a3
-xori s9 s7 911
-slti t4 a3 249
-mulh s3 a4 s10
-mulhu ra t2 a1
-sra a0 s9 s9
-remu s5 gp t3
-sub x0 t5 x0
-divu t5 a7 t1
-mulh a7 a0 s9
-rem t0 a7 t2
-lui x0 69018
-mulhsu t2 s6 t6
-remu t2 s5 t6
-mulh gp a4 t0
-addi s9 a5 -49
-add t5 s3 s3
-lui t4 780018
-sltu s7 t6 t1
-ori tp s1 -771
-srli s0 a4 17
-rem s1 s9 a3
-srai ra t5 13
-remu t0 a2 a4
-mulhu s9 a6 t3
-ori a1 ra 1801
-slti s10 a0 1915
-add s3 a7 s2
-addi t6 x0 -1137
-slti a4 s8 800
-mulhsu t2 t5 s9
-slli s7 ra 29
-sub t1 a2 gp
-slt ra s7 s9
-add s7 t1 x0
-srl t6 a2 t4
-div gp t2 s1
-div a6 a6 x0
-auipc a5 539154
-and ra t4 s7
-andi t3 a1 -663
-srl t6 a2 a1
-mul a7 s0 s1
-and s11 s5 t2
-srli a4 s0 26
-sra t6 s7 a3
-div s4 s3 s4
-srl x0 s10 s8
-ori a3 t4 -135
-sltiu s5 a2 -1839
-mul s7 t6 t0
-srl a6 x0 s7
-mulh a4 a6 t1
-mul s5 s6 gp
-mulhu a4 t0 a2
-xor s5 t1 a5
-sra s10 a4 t4
-mulh x0 s8 a7
-remu s2 t2 s6
-rem s4 a7 t2
-add a5 a0 t4
-add t4 a7 a3
-sra a3 s3 s11
-rem s0 s0 a7
-srl s6 a4 t1
-and s5 s0 a2
-or a0 s3 a7
-xori tp a6 -377
-slti a2 t4 -1013
-auipc s6 719645
-ori s0 s1 -1744
-slt s8 ra t2
-mulhsu t0 x0 t4
-xor x0 t3 ra
-or a4 s10 gp
-lui a1 263291
-auipc s4 5656
-div t0 tp s1
-div a4 a0 a7
-or s4 s0 t4
-sra ra t6 tp
-sll t2 a7 s1
-sltu s1 x0 t3
-srai s8 s11 5
-mul ra t5 t2
-slt tp s9 a3
-xor t1 x0 s5
-xor t4 t0 a5
-divu ra x0 s9
-srli a0 x0 28
-xori s10 s11 1084
-srai s2 a4 0
-sltiu t3 s0 -966
-mulhu x0 t6 t2
-andi s5 t3 -1094
-mulh a7 ra s7
-slt a0 ra s9
-lui s7 688846
-divu a6 a6 s3
-sra a3 t3 s8
-xori a6 tp -409
-srai s11 s9 13
-mulhu a4 a6 t3
-mul s7 s1 s0
-sll s10 t4 t5
-mulhsu t6 t3 s1
-auipc t0 181569
-ori a6 s5 -1084
-srl s8 t0 a5
-mulh s5 x0 t6
-srli t1 t4 19
-add s2 gp x0
-sltiu s2 t5 -723
-andi t2 s10 -1999
-slti a3 x0 1741
-sltu a6 gp ra
-slti s8 a7 -210
-add s4 s11 ra
-ori ra s7 1876
-sll gp a4 s0
-mulh tp ra s10
-mulhu s5 s6 t1
-divu a5 s5 a0
-slt s11 s11 s11
-slli s1 a7 9
-auipc s8 482821
-srli a3 t6 19
-div s11 a2 t4
-and x0 s4 x0
-sub s7 s8 gp
-sltu t6 s9 s5
-mulh s2 t2 a2
-and tp a4 a6
-lui s7 120552
-mulh s1 t0 t1
-auipc s9 989338
-rem s1 t6 tp
-mulh t5 s2 ra
-rem s9 s11 s3
-srli s4 s8 3
-sll a0 s9 x0
-rem a7 x0 s1
-addi a3 s7 -1285
-sltiu a0 a2 -895
-srai t6 x0 15
-sltu gp s0 s4
-mulhu ra s4 t4
-mulhu s3 s4 s5
-mulhsu ra t0 a5
-mulhu s9 a5 a2
-add s1 s0 t2
-xori t1 ra -665
-auipc s9 443605
-mulhu a0 a4 s9
-auipc t3 749662
-xori s9 a4 -214
-slli s11 t0 24
-sub x0 tp gp
-add a4 a1 a6
-divu s7 t1 s5
-srl t2 t4 s5
-xori s6 a2 -320
-sra tp a4 t4
-mulhu a1 s7 x0
-xori t2 a7 1621
-srl tp x0 ra
-sub s10 t6 a4
-slli s11 gp 2
-mulhu a2 s7 s8
-sll t3 a5 a1
-sub s8 s2 t4
-rem s6 x0 s9
-mulhsu s3 t1 ra
-mulhu s8 x0 x0
-mul s2 gp t1
-add a6 ra ra
-sll t3 a6 a6
-srl s6 a3 a2
-mulhu s10 t4 s1
-xori a6 tp -1449
-xor t0 s11 s2
-sll t6 a2 a6
-sra x0 s10 s6
-ori x0 t5 -56
-mul a7 s1 a2
-srai s10 x0 6
-addi gp a6 822
-auipc t4 1047550
-srai x0 t0 26
-ori t2 ra 849
-addi s7 a1 -1941
-srli t0 s9 13
-sub s0 s11 s7
-xori a7 a4 925
-xori t0 gp -397
-remu t0 x0 s4
-add s11 a1 s0
-mulhu s6 s8 s2
-andi s7 s5 -715
-mulhsu s3 t6 s7
-andi s2 s2 -569
-sra tp s3 s6
-rem a2 s9 a4
-andi a3 s9 -61
-srli s1 t5 30
-divu s1 a6 a2
-slti s4 a3 -1889
-or x0 a1 a6
-andi gp a1 612
-remu a2 s1 t3
-andi a4 t3 -266
-srai t0 s9 8
-slt a2 a1 s8
-auipc t1 640639
-sltiu t6 a4 -873
-mulhsu t4 a3 s5
-or s6 x0 t4
-srl a6 s7 gp
-mulhsu s3 s6 t3
-remu t5 s0 ra
-lui t1 436457
-sub s11 a1 t6
-divu gp a3 tp
-mulh s2 s10 t0
-sub s9 t2 a3
-addi ra ra -1261
-slti s11 a5 -1099
-ori t4 s7 -837
-xor s4 s0 s0
-mulhu a1 a0 s10
-andi s5 s8 -1240
-andi a5 ra 17
-auipc s2 702438
-sub ra a3 t0
-sub gp s3 s6
-lui a6 463744
-or s7 t2 s7
-xori a1 s1 1284
-divu s1 a6 a6
-or t5 s11 x0
-srai gp t1 20
-srai a5 s9 24
-sltiu tp s0 1264
-srli s6 s11 7
-mul a6 a2 a5
-sub s9 s2 a1
-mulh a7 s6 a2
-sltiu s0 t6 1799
-and a1 s7 s11
-and x0 t6 x0
-or s4 a2 a3
-andi a3 a1 -1070
-add s4 a1 t4
-srl t0 s10 s10
-mulhu s2 s2 t1
-or t4 a7 t4
-addi a6 a1 1099
-sltiu t3 t6 -1260
-sub ra ra ra
-add a1 t5 t6
-slt x0 a1 a5
-srl a4 t5 a1
-and ra ra t3
-mulhsu s0 a3 a0
-addi t2 gp -383
-or s10 s1 t1
-mulh s2 gp ra
-div s3 ra s1
-remu a3 s2 s4
-slli tp a7 8
-mulhsu t4 t2 a1
-srl gp t3 s4
-sltu s10 t6 t2
-xori t3 a7 -34
-div a2 t1 tp
-divu s9 s3 a1
-slli s3 s3 28
-mul s3 s8 s2
-or a0 a5 s1
-srai gp a3 27
-add t2 a5 a2
-mulhsu s2 s1 t0
-xor t1 a5 s1
-rem s5 t6 s0
-remu t2 s1 x0
-addi s5 s11 -1988
-or s8 s0 t0
-or t2 s5 t4
-rem x0 s2 gp
-ori t1 s9 1305
-xor t4 s8 s7
-mulhu a5 a5 a1
-auipc s8 301468
-add a0 a2 a0
-xori a5 s4 -848
-sub s9 a7 s8
-mulhu a1 t6 a3
-mul x0 t0 t5
-sll s7 s2 a3
-mulh s1 a0 t1
-mul a5 t0 s6
-sltu a3 s11 s10
-sub t2 s5 s10
-mulh s4 s5 a2
-lui x0 584592
-slt tp a0 a4
-xori s6 tp -58
-or t6 x0 tp
-slli a1 a2 4
-slli x0 s4 3
-remu ra a3 a2
-slti t1 t0 -1027
-xori a0 s2 -1034
-slti s8 s2 -1513
-lui a4 794817
-mulhsu s6 a1 gp
-remu t0 t0 a3
-or ra a3 s10
-auipc s10 156836
-div s8 s9 s9
-xori s4 s1 -321
-sra t5 s1 s5
-add x0 t4 gp
-ori a4 gp -1186
-slt gp s9 x0
-slti a7 s9 -1837
-div s1 t3 s9
-remu a0 t1 t0
-addi tp a4 -228
-sll s11 t6 s5
-slli a7 s11 11
-divu s3 t4 a5
-andi s0 s0 1406
-slli t6 s7 18
-divu x0 gp a2
-slti gp s6 1289
-mulh tp a5 s3
-sll t6 a1 s8
-and ra t3 a5
-ori a7 t0 -1566
-div a3 a0 a3
-lui s10 75760
-divu t4 gp s7
-ori s5 s7 1823
-sltiu s5 t4 213
-div a0 ra gp
-slli s3 a6 12
-mul tp s1 t6
-div s3 x0 t1
-add t5 t0 a5
-or s9 s9 gp
-lui s9 908274
-xori s5 a6 -1270
-div t6 t0 a0
-xori x0 t5 1269
-slli s4 a0 18
-div gp a5 s7
-rem s8 a0 a2
-slti a0 a1 -445
-rem a1 a4 t4
-remu x0 t3 t5
-sltiu s4 a4 -1957
-slti s7 a5 -1332
-sltiu a4 t5 -450
-slli t6 s0 5
-srli gp s2 20
-mulh a7 a5 t4
-mulhu t4 ra s1
-remu s6 s0 t3
-remu ra s7 s3
-srli t1 a5 26
-mulhsu a2 x0 t6
-mulh s10 s10 t0
-lui t3 581737
-mulhsu a1 s5 s11
-srli t0 t1 29
-mulhsu s8 s11 tp
-mul x0 t2 a4
-xor a6 gp s2
-mulhu a5 a4 s0
-mulh s4 a6 s7
-srl s10 ra s9
-slt a3 t2 a0
-mulhu t4 t5 s5
-add t4 s11 s8
-sub a3 t6 s5
-slti t4 a6 -491
-addi s0 t2 1347
-remu t4 s4 tp
-sltu a0 a2 t5
-rem s5 s7 t1
-divu a0 a5 a2
-and t2 a6 t4
-addi s1 s9 -1297
-mulh t2 a7 x0
-rem t4 s4 t2
-sra s5 s6 s0
-add gp t3 a6
-rem s4 a7 s11
-mul s11 s0 a5
-srai t6 a6 15
-sltu t1 s4 a7
-mulhsu s2 gp t4
-lui s10 220619
-add s5 s2 a6
-srli tp a6 20
-and s0 a0 a4
-xor x0 a1 s1
-add a6 t0 x0
-sll x0 s2 a3
-srai t5 a7 31
-srli t2 s1 7
-remu t3 t6 tp
-slt s4 t2 s0
-mulhsu s10 t4 s9
-ori t2 t4 -573
-srai x0 t1 4
-sltu a5 a7 t4
-sltu t6 a1 gp
-mul s8 s4 t5
-rem a1 s6 t3
-add a5 a2 s6
-and ra a7 a7
-xor x0 s9 s3
-slli s8 a5 27
-rem s4 a2 s0
-and t0 tp s8
-sll s0 a0 t1
-slli s6 s9 30
-slli s9 s1 9
-sll a2 s8 a2
-slli s7 ra 4
-slt t2 s6 s1
-mulhu x0 a1 s0
-slli a0 t6 24
-slt t4 a0 t3
-divu s5 a7 s3
-auipc gp 408865
-srl x0 s8 a2
-lui a0 608562
-xor s0 t6 s4
-sltu x0 s11 s11
-slli t4 t0 30
-auipc x0 152002
-xori s7 t1 -65
-addi s5 x0 108
-srai tp s4 14
-xor s11 a3 s3
-xori t5 s5 -382
-sub t5 a1 s10
-srli t1 s6 7
-lui s3 801238
-lui s6 909017
-sll x0 s4 t6
-xori t4 t5 1427
-mul a6 a3 t3
-sub tp x0 s4
-addi tp s5 -30
-xori a4 x0 1025
-mul a6 s10 s0
-slti ra s7 -364
-ori tp ra -310
-ori t4 t4 -1079
-andi s11 s0 -59
-add a1 a3 s0
-div x0 t0 ra
-srai gp s0 4
-xor s3 s10 s2
-remu s1 s5 a4
-ori s6 s5 -1185
-mul x0 s0 gp
-mulhsu s7 s2 ra
-mulhsu a4 s7 a5
-srl a3 t4 tp
-auipc s4 751928
-mulh gp a5 t1
-sltiu t6 s0 -890
-slli tp a6 16
-slli t5 s9 27
-srl a0 t3 t2
-add s4 s6 gp
-sub a4 t4 s10
-slti s1 s9 620
-mulhu s9 a4 t3
-sltu s11 s9 s9
-xori t2 s5 -677
-andi s5 t4 -142
-sltiu a7 a7 1014
-rem s6 a5 t6
-divu t3 t5 s3
-auipc s4 517920
-sltu s8 s2 s4
-or tp a3 t4
-sra x0 gp s2
-remu a6 a7 s5
-srli a5 t0 14
-slti t2 t1 638
-slt x0 s10 gp
-xor a5 tp s2
-sll s6 a1 a2
-addi t3 a7 -780
-mulhu x0 gp a6
-or s7 gp s0
-andi s2 a5 1003
-xori a3 s1 -706
-sub a0 a2 t6
-lui x0 277770
-ori s10 t5 1736
-sra s0 s4 t1
-xor s11 gp s9
-auipc s1 289301
-ori s6 s2 1744
-or a0 x0 s11
-div gp s1 a0
-div s0 s8 x0
-slti ra s9 -907
-slti t6 s6 1810
-sub s5 s9 a5
-srli ra s1 0
-addi a2 ra 1155
-divu gp ra t4
-sub a0 ra t5
-sub s5 s9 a0
-auipc s9 675357
-xor a5 a2 a5
-slti tp a2 1604
-srai t4 a4 31
-srli s5 t3 16
-mul x0 t0 s6
-or s8 t6 t4
-div s7 s0 t6
-mulh s11 a4 s2
-sub s5 t4 s3
-mulh t4 s7 t6
-sltu a2 s5 s3
-slti tp t1 -305
-add t0 gp t5
-mulhu s6 t0 x0
-sub a0 s1 s11
-slt s3 a4 t3
-mul t1 ra x0
-remu x0 a4 tp
-addi gp s3 293
-mulhu s7 x0 s6
-srl s6 a6 s3
-divu s1 a2 a2
-slt s2 s4 s3
-sra s3 a5 t6
-div a6 s3 t4
-remu tp gp t0
-mulhu t0 a3 a3
-ori gp a0 1252
-addi s4 s1 1311
-srai s3 x0 17
-slti s1 t2 -1150
-and a3 t0 t0
-andi s6 s0 -1676
-mul gp s9 a6
-sub a5 a5 a6
-ori s1 t1 -1174
-sltiu s4 s8 -1115
-mulh gp s1 t3
-sra s10 s1 t3
-sub t1 a4 ra
-xor t4 a3 t5
-sra a1 s2 x0
-rem t5 s3 a1
-ori x0 a0 1926
-sub a3 a3 s10
-slli t2 s6 17
-andi s2 a5 -124
-remu s7 a2 s8
-sltiu a5 t4 -1149
-xor a5 s9 s1
-sll a1 t5 x0
-sltiu a1 tp 1533
-sltiu s0 s7 -778
-xori x0 s11 -1607
-srai s11 s8 25
-lui t4 915186
-xori s1 ra -2020
-xori a7 ra -2046
-sltu s3 a5 t1
-addi tp s10 -722
-mulh t0 a7 a6
-sll a3 s11 x0
-srl s2 x0 s10
-remu a1 x0 a0
-sltu tp s5 t3
-sltiu s4 gp 1935
-srl t6 s1 a0
-slt s3 s11 a4
-div a4 s7 s4
-div t2 s4 a4
-srl s6 t0 s0
-auipc s8 479110
-divu s3 ra x0
-addi a5 s1 -646
-slli s0 a4 0
-slti s3 s1 -204
-add a0 s8 a4
-srl t1 t4 gp
-or t3 s10 x0
-sll ra gp x0
-sltiu t1 s11 -226
-slli x0 gp 10
-xori t0 t5 -860
-or s6 a3 a0
-srl t3 s6 t0
-sra x0 s6 t5
-sltiu x0 s1 -660
-and ra s3 tp
-auipc t5 1012605
-addi s11 a1 -60
-mulhsu t5 a7 ra
-andi a2 s9 -12
-remu t2 t1 s5
-xori a0 x0 -1281
-sra a5 s7 s5
-sub a5 a2 s10
-div a6 t5 s11
-mulh t6 x0 s9
-slt s5 a5 s7
-rem s2 s6 ra
-slli a7 t6 12
-mul tp t5 t0
-rem s2 t4 tp
-div ra x0 a5
-or s11 tp a3
-mulhsu a7 t0 x0
-sll tp s1 x0
-mulh x0 ra t1
-auipc s0 120892
-auipc a2 748093
-lui a7 836424
-mulhu s1 a3 s3
-addi t6 x0 -1922
-and t0 s9 s8
-div t4 a0 ra
-srli s7 a2 31
-sltiu x0 t0 -1251
-slti gp a4 498
-xori a7 s5 -1449
-rem t0 s10 a5
-mulh s5 s7 s6
-add a7 a4 s10
-srai s5 s5 2
-andi s2 a1 -1376
-srli a4 a1 15
-auipc t1 556649
-div x0 s8 s8
-lui a1 158350
-srl a3 t2 a3
-xori x0 x0 -1863
-mulhsu s6 a6 x0
-mul a0 s7 s1
-mulhsu a1 t4 a5
-addi s10 x0 -405
-slt s0 t0 t3
-slti s10 gp -1841
-addi a4 a7 1553
-slli s5 s4 3
-ori s9 s5 -233
-sltiu a2 tp -1248
-lui s6 79780
-srli a4 a4 17
-sltu a5 s8 t3
-xor a7 a1 s7
-ori s3 t3 1018
-srai s1 t2 2
-mul t0 a6 s10
-slti a2 a7 72
-remu t3 gp a4
-ori t5 s8 934
-mul s9 s4 x0
-ori s6 s8 1802
+or s10 tp a1
+mulh a5 a2 s10
+sll s6 s10 a7
+mulhsu t0 a6 a7
+rem a7 t6 s8
+mulhsu t5 t1 a2
+slli s3 t5 2
+xori tp s8 1536
+mulhsu s1 t2 tp
+rem tp a2 a4
+div s0 a4 a4
+sll s1 t3 x0
+srai s7 t4 17
+slti a2 t6 586
+and x0 s11 t3
+mul s6 s6 s8
+andi x0 ra -1501
+or t2 s7 gp
+add gp ra s3
+div t2 s2 ra
+slt a7 s11 ra
+sltiu s5 s8 1544
+srl s6 s6 a2
+sll s10 a3 s11
+auipc s10 99657
+add t1 s1 s0
+or tp a5 t5
+mulhu s11 a7 s0
+sltu s4 a1 s8
+addi ra s4 -545
+and a2 s11 s5
+div s2 s0 s11
+xori tp x0 -200
+add t3 a3 a7
+mulhu t4 t5 gp
+xori s11 s3 -762
+sll s0 x0 s2
+srli a6 t6 24
+sll gp gp s0
+sub a6 t6 t0
+mulhsu s5 t3 ra
+mulh a5 s5 t0
+sll s1 s1 ra
+ori t3 a3 196
+sra a4 s11 t3
+mulhu t4 s11 a1
+auipc t0 906980
+sll a6 a3 a3
+slti a2 s6 -244
+mulhu a4 s10 gp
+slt s2 t1 a4
+srai a1 a6 31
+lui t1 125776
+div a5 t0 s3
+sra s1 gp s1
+remu s9 a7 s7
+xor s5 s1 gp
+slt t5 t3 s4
+divu a2 s0 t2
+slt t6 a1 t1
+sltu s11 s1 t0
+addi t5 x0 329
+mulhu s11 t0 s10
+sll t3 s4 x0
+srli s9 t3 7
+mul t5 a7 gp
+ori s8 t4 1172
+divu a7 gp s4
+div s9 s2 a3
+and s1 t4 tp
+sltiu a5 tp -64
+xori s11 t3 1686
+srai t6 s8 4
+or tp s0 x0
+mul s3 s8 s6
+sub a1 s2 s1
+sltiu tp t6 102
+and s0 s2 s5
+rem s2 x0 t0
+slti tp a2 -1962
+mulhu s9 a0 tp
+or a7 s0 s9
+div tp t1 a1
+div s11 s6 s3
+sltu s0 a0 gp
+ori gp a2 -1410
+or t4 s9 s3
+mulhu t3 s0 a3
+lui a3 689826
+xori gp s4 -1987
+add t2 t2 s7
+mulh a0 t1 a6
+remu t1 a6 s11
+mul x0 s10 t0
+and t0 t6 a0
+mulhsu t5 a6 s4
+srl a7 t6 a0
+srai s7 a7 0
+addi s10 s1 -288
+srai a6 s0 25
+mulhsu t1 x0 s2
+mulh x0 a1 a5
+andi gp t5 738
+xori x0 s8 636
+sltiu a2 s11 -290
+srl x0 s2 s5
+auipc a7 944570
+srl s7 x0 a6
+ori a7 t6 -1280
+sltiu s10 s2 -533
+xori s1 x0 -94
+div s8 t6 s0
+ori s2 s5 -1825
+ori s8 gp -1608
+srli s2 t6 30
+sll a5 a3 s2
+sltu s4 x0 x0
+andi s3 x0 -943
+andi gp t5 -1437
+srl s7 t3 s8
+sll s11 tp t6
+slti a7 t0 -673
+sltu s5 t5 t6
+slti s3 s4 -1642
+div t2 t5 s0
+srli s9 s7 9
+srl a3 s9 s10
+mulhsu gp x0 a2
+sltiu tp a5 1982
+ori t2 s1 1130
+slt s5 a7 a6
+andi s0 s0 -1563
+sra a0 a1 t0
+xor x0 a2 x0
+rem t5 t2 a1
+mulhsu t6 a2 t0
+slt s5 s8 a6
+slti s5 x0 -580
+auipc x0 148381
+mul ra s11 s7
+div s3 t3 s9
+sra s10 s5 a2
+andi a5 s11 -1840
+mul a4 s11 t5
+mulh s6 t3 a6
+slti s3 t3 -1238
+rem t6 s1 t4
+sltiu s11 t6 -1979
+add s6 x0 s1
+remu a3 t0 a1
+and s3 t4 s11
+slti s7 ra 673
+sltu s10 t4 s6
+addi a3 t5 -725
+xor s6 a7 a7
+srli s5 s6 2
+div t2 ra s0
+auipc a5 279781
+rem t2 s3 s2
+mulh s4 gp tp
+sra ra s6 s7
+sub t1 t6 a7
+mulh s0 a0 a2
+andi s8 s1 -1311
+slli s2 t2 12
+mulhsu x0 t4 t1
+addi t6 s2 -90
+slt tp s3 t5
+and s9 t3 a7
+srli s7 gp 2
+slt s0 t0 a4
+slli s9 s7 25
+addi x0 t5 -1082
+divu s6 a2 a1
+sll a5 t6 s7
+ori s7 a3 -1369
+xor s11 s3 s3
+srli s11 s0 5
+lui s0 822967
+remu s0 a5 a1
+mulh x0 t6 s7
+slli s9 x0 21
+mulhsu a4 x0 s4
+sub s2 a3 a6
+sub a3 a0 tp
+srli s5 s0 28
+divu s3 a0 a6
+slt a5 t1 t3
+lui tp 829025
+sll t4 tp s10
+mul s6 s2 s0
+xori s1 s10 -531
+sltu x0 s0 s7
+addi s4 a7 1204
+mulhu a1 x0 t4
+xori x0 a6 76
+srli s0 s4 26
+and t5 a5 a2
+addi s9 s10 -548
+add gp s3 a3
+mulh a0 t5 s0
+or x0 tp a4
+andi a5 s7 744
+ori s8 s6 -1713
+remu tp t1 s3
+mulh s9 s7 a1
+mulhu s5 s3 a7
+srai s4 tp 17
+remu a7 s7 s10
+sltu t3 s6 tp
+srai t3 a0 9
+mul t5 s9 s11
+sra a7 s5 s4
+xori ra s4 1142
+addi a6 a3 53
+and s3 a5 a6
+addi t1 s3 -1083
+mulh s4 gp s8
+slli s9 t2 3
+div a0 s0 s10
+and tp a1 s5
+sltiu s9 t3 1794
+or s11 s1 t2
+mulhu t2 t4 s7
+divu t3 t1 t3
+auipc ra 413276
+slli a0 s4 31
+sra a2 a1 s6
+mulh ra a0 gp
+mulh s5 s3 s2
+sll s8 t0 a4
+sltu x0 s4 tp
+sll a0 a3 s11
+div a4 s0 s6
+sltiu x0 a1 -2038
+mulhu a2 a4 a0
+slli t1 s7 12
+addi s4 s8 -276
+mulhsu t1 a3 gp
+and a3 t5 s2
+mul s8 x0 a7
+srli t0 s0 28
+mulh ra a0 t4
+sll a6 s9 ra
+add s11 a4 s1
+xor s6 s5 t5
+and t6 a3 a5
+rem a4 t5 ra
+rem t1 x0 gp
+mulhu s10 a1 a0
+sltu s11 t1 s2
+sll t0 x0 t4
+auipc t4 305838
+mulhsu t4 a0 a1
+addi a4 s7 864
+sub a3 s7 a6
+addi t3 s11 -488
+slli x0 t0 25
+xor s10 t3 a1
+mul s6 tp t5
+addi s10 a4 -1294
+slti a4 a7 -425
+ori x0 a1 -752
+slli x0 s3 25
+mulhu s2 ra a1
+slli s5 s11 30
+sra a1 x0 gp
+divu s9 a2 a3
+sltiu t6 t0 547
+mulhsu s11 s8 t1
+mulh t4 s8 a1
+add t2 a4 a0
+slli t1 a3 17
+slt t4 a3 a2
+sub a1 s1 s1
+sltiu t6 gp -1752
+xor a7 t1 s7
+xori s8 gp -288
+add t4 t2 a7
+sra s4 a6 t4
+divu t0 s0 t0
+xor t0 x0 s1
+srli s11 t4 19
+remu a4 a3 a7
+or t2 s0 t1
+sltiu a0 s1 -41
+srai s5 tp 7
+div a7 s9 s9
+slti t4 s0 399
+sltiu t0 a5 453
+mul ra t0 s5
+add a0 s7 s0
+sll s7 a5 a0
+sll a2 a1 t6
+andi a4 gp -1471
+ori x0 a7 -601
+slti ra a0 -553
+addi t3 s11 -884
+slt s5 a2 s2
+auipc ra 178817
+remu s5 x0 t4
+mulhsu x0 s3 s11
+mul a3 s10 s4
+srli t3 tp 25
+andi s10 a4 218
+sltiu t2 a0 -738
+and s2 s0 s5
+sra s0 s4 s1
+sltiu s2 s4 -928
+mulhu a6 s2 t6
+slli t5 t2 3
+sltu t1 ra s4
+srai t5 a7 7
+lui a0 835648
+slli t2 a3 14
+mulh s8 a3 tp
+xor s1 a2 s6
+srli a0 s4 12
+slti s0 s8 -1052
+srai tp s11 16
+andi gp t3 -999
+slli x0 s8 24
+srai s9 s2 1
+srai t0 a0 18
+auipc t0 687927
+addi a6 s6 1002
+sltiu s8 a3 631
+mulhsu t5 s1 a4
+auipc a1 788288
+sll s2 x0 s2
+slli s3 gp 24
+and a7 x0 s11
+mul t3 s2 ra
+add s9 a6 s3
+and s11 s0 s6
+mulh t4 s4 t3
+rem a5 gp s3
+mulh gp a5 x0
+mulhsu s3 s10 ra
+sltu s9 a5 tp
+add s7 a4 a7
+srl a5 t3 tp
+mulh a2 x0 a0
+mulhu s4 s6 a3
+mulh a7 s5 s2
+srai s9 a2 25
+or a7 t3 s3
+slli t6 t0 17
+ori t0 s2 -171
+mul s0 gp s6
+ori a6 a2 492
+div t5 t0 t4
+xor a1 tp tp
+xor s0 s5 a4
+auipc a4 953185
+slt tp s3 s9
+srai tp s0 25
+div s9 t5 a0
+xor t0 gp s4
+mulh s2 t4 s9
+remu s2 s4 a6
+mulhsu t6 s5 s10
+mulhu s4 a2 t1
+ori s11 t1 2047
+sltiu a4 x0 -1542
+div a0 t2 a0
+ori x0 a6 1425
+and tp s11 s5
+remu a1 ra s11
+ori s9 s2 -606
+srai a5 t5 17
+mulhsu a0 ra s7
+and s11 s9 s1
+xor t3 s2 gp
+srai a1 a2 13
+srl s8 s2 s5
+srai t5 x0 3
+srai x0 a3 31
+remu t0 t0 t0
+andi x0 gp 1540
+mulhsu x0 a6 a2
+lui t6 35007
+srl s6 s11 s9
+rem t0 ra t4
+srl a5 x0 s5
+rem x0 s6 s7
+mul s3 s4 a6
+srli t1 a3 9
+slli s0 s11 17
+or s3 t5 t0
+srl t2 a4 s7
+or t6 x0 s8
+lui s4 991654
+add a6 a3 s0
+rem s4 t4 a4
+slti a7 s0 -189
+addi s8 x0 -1734
+and s4 t0 a1
+and t6 x0 ra
+srai a5 s4 27
+mulhu x0 x0 t1
+andi s6 t1 -1561
+slli t5 a5 30
+sltiu s0 x0 -1270
+andi a5 gp 1720
+slti s0 s2 1577
+andi a3 gp 1248
+mulhsu s6 x0 a7
+rem s6 ra s3
+xor a0 s11 t3
+sll a0 a4 a4
+mulh t3 t0 t6
+addi gp t5 1806
+mulhu s8 x0 a3
+slli tp tp 27
+mulhsu x0 a3 a3
+xor s7 t4 s1
+and a4 t3 gp
+srli s4 s3 9
+and s6 s11 s9
+slt a4 t4 x0
+rem s1 ra s2
+sll s2 s3 s11
 srli s4 t5 2
-sub a6 t0 ra
-xor t2 a0 s0
-or s11 ra tp
-sltiu x0 x0 -785
-and a4 a1 a2
-srli gp t6 6
-sll a7 t2 a0
-and s8 tp a4
-sra a7 t2 s5
-addi s5 t5 -337
-addi t5 gp -759
-srai tp s11 13
-addi x0 s1 -1973
-srl tp s3 s6
-and x0 a5 s10
-divu x0 ra s3
-mulhu t0 a6 s4
-ori t6 s10 585
-or s3 a7 s6
-xor x0 a4 s2
-add t4 a4 t6
-and a6 t1 s4
-add s9 x0 s11
-auipc a1 930059
-addi a3 t2 -1656
-lui a1 350688
-add t6 t2 s1
-mul x0 a2 t0
-srl a4 s0 t4
-xor a2 s8 a5
-div s1 a4 ra
-add s6 t5 a7
-sltiu s4 gp 1092
-auipc t6 362959
-andi s7 s9 -1694
-remu s8 s11 s3
-rem s5 t1 s1
-sub t6 s4 s10
-add t3 x0 t3
-mulhsu gp s7 s11
-auipc tp 839731
-lui t3 169686
-sll t0 a1 a0
-ori t6 t2 1222
-mulhsu s0 a2 s11
-mulh t0 a7 s2
-slt a4 s8 s10
-slt tp t4 tp
-sll s7 x0 s6
-srai x0 t3 23
-slt a6 s6 s0
-mulh a0 a3 s3
-or t3 s0 a5
-ori a3 s4 -1201
-xori a3 s7 -1258
-mulhsu ra s8 s9
-sltu a2 t6 s3
-mul t4 t3 a7
-remu t0 t4 s8
-mul s9 t3 t6
-sub gp ra t1
-sltiu gp gp -420
-div t0 gp t4
-sll t0 s3 t1
-slti a0 a3 -1624
-sub gp s0 s8
-xor s4 s1 s8
-rem a1 a0 t2
-remu s8 t1 a6
-sltu a1 a4 x0
-slti a3 a4 1767
-rem s3 s9 gp
-slt s10 s6 gp
-srl a3 a7 t1
-srl a6 t5 s7
-lui a7 55557
-or a6 s0 s10
-divu t0 s10 s1
-rem a6 a6 t6
-sltu a6 s7 t5
-slti t2 a6 -813
-mulh s0 a0 a7
-slli a3 t6 2
-slli t0 s6 25
-slli s0 a2 12
-mulh a6 s4 x0
-andi s10 a7 -688
-slt a6 a5 s5
-srl x0 a0 x0
-remu a1 x0 x0
-srli s11 a7 8
-mulhu s0 a3 t2
-mulh t4 t1 a1
-auipc a6 660788
-remu t5 s1 tp
-mulh s1 a2 t2
-lui s8 714535
-and a4 a6 s5
-mul s10 x0 s8
-lui a2 71280
-xor s11 t3 a7
-slt a2 a5 s4
-xor x0 s2 tp
-addi s2 t0 -438
-slli a3 gp 7
-sra s3 t0 t2
-slt t6 a6 a6
-ori t3 a7 -1762
-ori t0 a6 -745
-rem t5 ra a6
-srl s6 t5 a3
-ori a3 a5 -386
-sra s10 a2 s4
-or t4 tp s6
-add a5 gp a1
-xor x0 x0 t5
-slli a7 s0 27
-sra s5 s4 a7
-mulhsu a4 a2 s11
-sll s10 tp t2
-add a3 a3 a3
-srli s9 s4 8
-srai a7 s1 5
-and s2 a2 a0
-srai t3 s9 19
-lui s7 823399
-sub s3 s10 s1
-andi s5 a0 1701
-xori a1 tp 745
-addi s8 s7 2015
-add a3 s0 t0
-mulh s0 x0 ra
-sll x0 a7 a3
-rem s9 a1 a5
-andi s10 a6 -738
-mulh a0 s5 s6
-xori a7 s1 -89
-div s7 s1 s2
-sltu tp gp s2
-addi s5 s4 783
-slt a1 t5 t1
-divu gp s7 s9
-lui t0 474651
-mulhu a4 a2 a4
-slt s7 s9 a1
-srl a1 s4 x0
-sltu a0 x0 s8
-mulhu tp s8 s9
-xori tp s3 1983
-sll t6 s10 s10
-div ra a6 s11
-sll t0 s11 a7
-xor t2 s7 ra
-mulhsu x0 x0 t4
-or a0 x0 a1
-slli a6 a2 10
-or t4 s1 t6
-and s2 a1 gp
-divu gp ra x0
-slli t0 s2 14
-lui x0 367695
-lui t1 485159
-sltiu s2 ra -1331
-mulh s9 a0 a6
-sra a1 t3 t2
-sltiu s6 a5 31
-add a2 t2 a2
-sltiu s10 s1 252
-slt x0 t3 t6
-mulhsu a3 a2 s10
-mulhu s5 s0 s0
-lui t3 335575
-slti s11 t1 1692
-sltu t2 t2 a1
-mulhsu t2 s10 a0
-mulhsu t4 s1 t3
-srli a4 tp 25
-sll s1 s2 s2
-remu t5 tp s5
-mulhsu s4 a5 s3
-mulh s3 s10 s10
-divu s0 a3 a7
-ori a7 s9 1178
-sltiu a1 t3 305
-div s5 t0 s1
-ori s11 a2 1023
-remu s9 t4 s8
-srai a3 tp 9
-slti a1 t4 -792
-lui a5 38115
-xori t2 s3 -153
-mulhsu t5 s3 ra
-srai s11 s10 20
-sltiu t0 s0 -1781
-srli s7 t4 14
-xor t1 t0 s0
-slli s10 s10 2
-slti t1 t1 802
-auipc a6 467926
-sltu a3 t3 a4
-sltu t0 s0 s0
-sltiu a1 a4 -1393
-andi t4 s11 -66
-andi t3 gp 1845
-srl s7 t3 s7
-srl s9 s11 a3
-xor s9 s10 t1
-slt t5 t0 t5
-lui a4 288171
-or s2 s2 tp
-rem t6 tp t2
-addi s4 s7 1836
-sltiu ra a4 -96
-andi ra x0 -1661
-mulhsu s5 t6 a0
-andi s0 s8 1174
-slt a6 t2 s9
-add t6 s7 gp
-srl x0 s2 s3
-srl s9 s4 s6
-slli a3 a4 12
-add s3 t5 tp
-addi t2 t6 1565
-andi tp s11 1792
-auipc t3 746207
-sltiu a6 a0 1293
-rem t2 a0 a2
-mulhsu t6 x0 s8
-add a7 s8 s1
-addi s6 s5 -1781
-ori a2 t2 147
-srai s7 s4 29
-sltu t4 gp s0
-remu a7 a2 s0
-xor s6 s5 t3
-mul s0 a0 t4
-ori a7 a2 -1864
-mulhsu s1 t5 t3
-mul s1 s0 s11
-srli a6 a2 22
-ori a6 a6 818
-slli t3 x0 13
-divu a5 t4 gp
-srai s5 a6 22
-rem a6 t5 t5
-lui s4 923365
-mul s3 t2 s0
-auipc s4 555252
-div s2 a7 t3
-sll t6 s8 x0
-srli s8 t4 8
-mulhsu s10 t0 s9
-divu a5 t5 a5
-andi a6 t6 -1724
-srai t0 s9 6
-slt s8 t5 a6
-mulhu s0 s2 a5
-sll s4 t5 s8
-or a1 t3 a6
-andi s4 a6 780
-div t6 x0 t4
-add t0 s7 a1
-remu s4 s7 s6
-slti t4 s4 1668
-sll t3 s6 t2
-sll tp t4 s3
-slt a1 a0 t1
-lui s9 793323
-rem s11 s1 t2
-divu a6 s1 a1
-sltiu a1 a2 1829
-or s7 t0 x0
-auipc s4 493959
-lui t2 502747
-srli t4 ra 10
-or t5 t2 a6
-sltu s1 tp a5
-sltu s9 a6 s10
-sll s1 t0 a6
-and s10 a3 s10
-addi s2 s1 -849
-mulhu s3 gp t4
-xori s6 s7 1781
-and s1 t6 s7
-or s10 s1 s5
-xori s3 s9 -1400
-div a4 a0 tp
-sll ra t2 s6
-divu s2 s8 a3
-mul a2 ra a6
-ori a0 x0 -1968
-sltiu s7 s1 -137
-remu t5 a5 x0
-lui s10 620866
-srli t0 s8 13
-sltu s10 x0 x0
-add t3 ra a5
-srli a6 t3 14
-auipc s5 735223
-sltu s4 a0 a0
-div t3 t3 s6
-remu t2 a1 a6
-mulh s0 t5 s2
-xor a5 t5 s8
-slti s9 s1 -1340
-or s3 x0 t1
-slt tp s5 t3
-xori s1 a4 -728
-sltiu t5 t4 -1532
-div s2 t0 t5
-xori s10 ra 1794
-srli t1 s11 13
-mul a5 a2 s11
-andi x0 s2 -1465
-mul a5 s6 t5
-slt t0 s0 a5
-add t6 x0 t3
-remu t5 s6 tp
-div ra s7 s10
-slti ra s5 -1533
-divu t6 a2 x0
-lui t4 355099
-remu s0 t3 tp
-and a2 a7 s0
-lui t1 162473
-slt a0 a2 a0
-divu s8 a0 ra
-mulh a7 t3 s10
-auipc s2 419249
-slti x0 s0 -1402
-mulhsu s10 ra t4
-sltiu s3 a4 -1342
-or gp a3 a5
-sltiu s2 s3 -1459
-slli t3 a3 14
-srai tp x0 9
-mulhu a7 s3 s1
-lui x0 202283
-srl s8 gp s10
-slli a3 gp 17
-sub s11 s3 a7
-xori s9 a3 -991
-mulh t2 a5 t1
-xor x0 ra s4
-mulhsu t2 a5 t3
-addi a4 a5 -1553
-sll a4 t3 t4
-xor s7 t6 tp
-andi s6 t2 -1154
-srai a0 a0 12
-or s1 s9 s9
-sltiu s4 ra -418
-slti a7 gp 1042
-sll tp s10 s9
-mulh s5 s0 a0
-sltiu a2 a7 -1450
-ori a7 a7 -733
-mulhu tp tp s7
-addi s3 x0 -1203
-ori s10 s5 -151
-andi a5 s0 -511
-rem a4 t1 tp
-srai a3 t0 28
-lui t6 46891
-remu s4 tp t5
-and ra t4 t0
-andi s11 s10 -433
-srai t0 s10 17
-div a3 x0 t1
-add a6 a0 x0
-div a5 s5 s9
-xor tp s10 a5
-rem s7 x0 a2
-slti t4 s3 -1266
-mulh a2 t2 tp
-mulhsu t5 s0 s3
-and s11 x0 a0
-addi x0 a7 -365
-lui t1 509008
-addi a0 a5 118
-sltiu s9 t2 -308
-add a1 s2 gp
-mulh a0 gp a7
-divu t6 s6 s6
-sra s9 s1 s7
-or x0 a7 a5
-sltu s9 t5 s11
-mulh a1 a2 s6
-sra gp s11 t6
-sll a7 t3 a2
-lui tp 788267
-xori t5 s5 -1121
-srl s8 t2 t6
-xor a1 t1 a0
-lui t3 13424
-mulh s2 a1 s7
-mulhu s1 t2 a7
-mulh a2 ra s6
-sra s2 a4 t2
-mulhsu t1 s6 s1
-slt s7 s11 s2
-slt s4 x0 s7
-add a4 t1 a6
-add s6 a3 t3
-sub gp a3 s1
-div s8 t6 a5
-ori a1 tp -1959
-lui tp 517453
-divu gp a0 t3
-srl t5 t6 s8
-rem x0 a2 t0
-mulhsu s3 t2 s7
-sra a7 s8 t6
-mulhu a6 a5 a1
-sltu s11 a4 x0
-xori s7 ra -1037
-srl s8 a6 a0
-sra tp x0 a7
-lui t0 542748
-andi a7 s11 689
-divu t2 gp tp
-addi ra s5 1765
-remu s3 s11 s0
-sra s9 s7 s10
-lui s5 341395
-slt t6 t5 s10
-sra t1 s9 t6
-lui a0 602521
-slt a6 a1 s9
-sll ra x0 s8
-and t6 a7 t1
-slti tp s11 -478
-sltu s5 t4 a1
-mulhu a5 a4 s10
-srai ra t5 0
-srl t5 t1 s0
-srai s10 a3 13
-andi x0 a2 -152
-lui a1 788836
-add t1 s9 s8
-slt s7 s1 s9
-xor s7 s8 ra
-sltiu gp t1 1729
-srli s10 t3 29
-add a2 a2 t0
-addi t5 s2 731
-divu t0 s7 s4
-sltiu s2 tp -666
-mulh s6 a2 s5
-divu t4 x0 s2
-andi gp gp 1652
-or a7 x0 s8
-div t3 a4 s5
-divu s10 s0 a2
-div a2 s11 s3
-add a1 s9 t4
-remu s4 s3 a7
-or a0 a6 t2
-slt s0 s8 a7
-lui t1 362782
-divu t0 a6 t3
-sll s9 a7 a5
-ori s1 a5 989
-addi s8 a2 -635
-lui s1 490935
-lui t4 725438
-mulh a3 s0 s4
-lui ra 520122
-mulh a3 a0 a4
-ori a3 s4 -1187
-mulhu t3 s0 t2
-rem a0 s4 a2
-or a6 s10 s6
-and gp x0 a2
-slli s9 a2 13
-andi x0 a6 -1197
-mulh ra gp s0
-ori s10 s3 1222
-sll a5 s10 x0
-sub s4 a1 a4
-rem a0 s2 s4
-slti s7 t6 303
-divu s10 s8 t5
-remu s3 t6 s0
-auipc s1 814462
-mulh t3 t5 s5
-lui t3 359500
-mulh gp s2 s9
-div s5 a2 t6
-srai s4 t5 26
-add gp s6 s11
-add a0 a5 s8
-mulhsu t4 t6 s8
-rem a0 s4 x0
-mulhu s10 s6 t2
-srli s0 a5 10
-slli s3 s7 5
-xor s3 s8 a6
-sub a4 t0 t0
-xori s7 s1 -1903
-xori t4 s8 -522
-div t0 s10 s10
-andi s10 t1 830
-divu s11 t0 t1
-srl t1 t5 s5
-srai a4 gp 8
-sra ra s2 tp
-xor gp a5 t1
-slti t5 s5 -1504
-rem s3 a3 t6
-lui a6 13699
-andi a2 ra -1010
-div s10 t1 t5
-srli s10 s9 2
-sll x0 s0 s1
-xor s6 a2 a5
-auipc ra 180552
-xor s0 a7 x0
-sub x0 t3 s3
-sub s2 s6 a5
-mulh s2 x0 a5
-srl a7 s11 a7
-xori a0 a7 -168
-slli a6 x0 24
-lui a4 404243
-slti t6 s1 -1132
-divu s6 a3 t6
-srl t6 t6 t5
-div t6 s1 a0
-sub a5 s2 s7
-addi t1 t0 -1393
-srai s7 t6 14
-sra t4 x0 a7
-mul s9 s11 a5
-srl a7 a3 s5
-xor a0 x0 a0
-lui t5 698075
-sra t2 tp a6
-slt a4 ra x0
-sra a3 s10 t3
-auipc s8 46646
-rem gp s0 t5
-srl s10 x0 t6
-and s11 s8 t2
-auipc s10 146168
-slti tp t3 -183
-xori s2 s7 -1294
-ori a0 tp -669
-slli t3 a7 26
-divu t2 t3 t0
-and t0 tp s2
-srai gp a6 11
-div t6 t1 a1
-lui a1 49685
-addi t1 tp -941
-ori a7 tp -384
-srli s0 s6 7
-mulh s7 x0 t2
-sltiu a3 s0 -1466
-mulhsu s8 tp s5
-sltu t5 x0 gp
-srli s6 a0 20
-sltu t1 t5 t5
-sltiu s5 a1 -1826
-add t3 s9 s1
-mulhu t6 a7 a1
-mulhsu tp x0 tp
-divu t3 a2 tp
-mulhu s3 s0 s10
-or t5 tp tp
-slli s5 s5 30
-div s9 s10 s11
-slli a4 s9 6
-or a4 t4 a4
-srl s2 s2 t5
-slt t0 s1 ra
-or x0 x0 gp
-srli s0 s10 6
-sub s7 s4 s10
-auipc s10 368094
-mul s2 t2 ra
-remu t1 a7 s4
-slt s1 t0 a1
-rem t6 s0 a4
-sltu t0 s11 s2
-div t4 s5 s1
-sll a4 tp a0
-xor s4 t4 a3
-sltiu s1 x0 -264
-slli s3 s0 12
-ori t2 t3 548
-slti t5 t2 -504
-divu s1 t4 a6
-xori s8 a5 -702
-sll a3 tp t5
-srli s7 s11 9
-add t6 ra a2
-andi t5 ra 199
-srai t1 s2 19
-or x0 t3 a4
-or a5 t5 s5
-xor x0 s9 t0
-or x0 t4 s8
-add s1 t5 s8
-slt s4 a7 t3
-xor a1 ra a3
-mulhu a2 s7 t0
-sub a4 a2 s3
-and a7 x0 t0
-sltu a0 s2 s11
-sra s3 a2 ra
-div s8 s6 s9
-srli t6 t2 16
-mulhu s9 t5 s11
-andi s5 s9 -1425
-sra s5 a6 x0
-xor s0 s5 s10
-or s1 tp a7
-sltu tp a1 s6
-auipc t5 365654
-rem a5 s6 x0
-srli s9 s6 13
-sll gp x0 s7
-remu s0 t1 t4
-lui s6 694719
-sra x0 s0 s0
-srai a1 t4 25
-mulhu s7 s4 t5
-srli t4 t5 19
-andi t1 a6 -1784
-lui s11 252687
-auipc s4 765864
-div gp s5 s3
-and s3 t6 s7
-or gp x0 s9
-sub t6 a5 gp
-remu a1 s5 t5
-sra s9 s7 s5
-sub gp s8 t5
-remu x0 a4 t1
-mulhu s1 s2 s7
-add a7 t0 s10
-mulhu s3 a5 s2
-sra t1 a5 tp
-auipc t5 439443
-div a0 s0 s7
-addi s7 s4 -1252
-remu a2 a1 s7
-sub a7 ra t3
-sub a3 s9 ra
-srai s5 t5 23
-slli a5 s6 10
-addi s11 t6 -1117
-mul gp s7 gp
-auipc a4 301522
-slli s2 a6 15
-add a6 a7 s11
-sltiu t2 s10 -1127
-sltiu a5 s3 -727
-sltiu gp tp -1269
-slti s8 t1 -1257
-ori x0 s6 1630
-srl gp a3 a3
-sra a7 t4 s4
-srl s11 t3 s5
-sub a2 a6 s8
-auipc t3 436410
-xori t4 a2 429
-sltiu x0 t5 -1133
-ori ra t2 489
-div a0 s0 s4
-divu t0 x0 s11
-and s8 s4 t1
-srli x0 t4 4
-slti s6 x0 -539
-xor s1 a6 a6
-or s8 s6 a3
-divu s4 a3 ra
-and s11 t4 a5
-or s11 a6 x0
-srai x0 s6 19
-add s8 s0 t2
-andi s2 t4 -1595
-srl s1 t2 a6
-rem t2 a5 tp
-andi a6 t2 -1984
-rem s9 s11 a0
-auipc a4 296809
-srli t1 a2 0
-auipc t6 934565
-auipc s6 101848
-sll a5 a6 s7
-and t5 s0 t1
-srai s3 a4 2
-sub a4 x0 a3
-mul a5 s3 t5
-mulhu s1 a0 s0
-div t2 s1 a2
-xori a0 t3 1160
-remu s3 s1 t2
-sltu s11 gp tp
-sltu t5 a4 s10
-and ra a2 x0
-sra a2 t4 s8
-add s10 t6 t5
-srli a3 s1 16
-div t5 s3 t0
-and a6 s2 a7
-mul a1 s5 gp
-sra a0 a2 s8
-sltiu s1 t0 -1916
-slli x0 s0 30
-sra s3 a0 t3
-sra s1 a7 a1
-slti t5 s0 -1605
-xor s5 t4 s2
-andi a5 tp 942
-andi ra s8 -61
-div s1 a6 s2
-sltiu t3 s9 -1931
-sltiu s11 s7 -514
-rem s6 x0 a4
-xor a5 s5 a7
-lui t0 68959
-mulhu a1 a7 ra
-mulhsu s5 s2 a1
-auipc a2 508677
-sltu s11 t2 s4
-xor t4 t5 t3
-or t4 t0 a5
-addi a0 ra -1158
-div x0 t1 s9
-slti s9 t4 240
-sra t1 s6 s8
-srl x0 a4 s8
-div tp s11 s7
-sub s10 gp t2
-sll a5 ra s2
-srai t2 tp 2
-mulhu s2 s10 a5
-mul s0 s5 a3
-or s3 s9 t1
-slli s4 s7 24
-mulhsu s8 s8 a4
-add tp s4 t3
-sub a4 s0 s10
-addi s0 t0 -2013
-andi s7 a1 -1748
-andi s5 x0 -1624
-mulhu a1 a3 t6
-ori ra s6 845
-slt ra t2 s6
-slt s1 a0 t2
-or a6 ra t5
-ori t4 s4 -704
-and x0 t6 a1
-xor a5 s10 tp
-srl t4 t1 t5
-or s10 s1 t0
-sltu t0 t1 t3
-srl t2 s0 s4
-andi s11 a4 466
-sltu t0 a6 t6
-slli a5 s3 20
-sra tp a2 ra
-xor a4 x0 a1
-or gp s3 a0
-srli a5 s6 27
-remu s10 s5 s6
-xor tp t3 s2
-mul x0 t6 s1
-rem a7 t1 s4
-divu gp s6 s7
-sra s6 t6 s3
-mulh x0 a1 a4
-lui t3 915968
-addi a2 ra -1603
-or s9 s6 a2
-div gp t3 s11
-addi s2 ra -337
-mulhsu x0 s0 s2
-sub s11 s2 a7
-sra t0 s1 t1
-mulhsu a7 a5 gp
-xori tp a5 1406
-sub s1 s2 a4
-divu a2 a5 ra
-andi t0 a5 -1348
-sltu a6 tp a6
-slti s9 a2 1235
-addi a1 a7 -779
-divu t5 t6 a7
-mulh a3 s5 a7
-auipc a3 509206
-divu t4 ra tp
-sltu s8 ra t6
-lui t5 121425
-srl gp tp gp
-slt s8 x0 t0
-mul a2 s7 s5
-xor a7 a7 s10
-slt t2 s3 s2
-auipc a7 865364
-mulhu s9 t3 a6
-or a2 t6 s4
-ori a2 t0 1311
-add s10 s4 a6
-div x0 t5 s11
-sltu a0 a0 t3
-xori s4 s3 -1482
-sltiu a2 s4 -1266
-mul x0 a2 x0
-slli tp a0 28
-srai s10 x0 23
-lui t3 853080
-slt a5 s9 s1
-srl t6 tp x0
-add t4 s1 s0
-auipc s9 40883
-mulh t4 a0 tp
-divu s4 s4 a3
-auipc t6 123396
-mulhsu a4 a6 s4
-sll s8 s9 s10
-slti ra s7 1920
-xor t0 s5 s7
-add gp s3 a0
-divu t4 a4 t6
-srl s8 a1 s6
-sltiu t5 t4 -1726
-rem t1 a6 s4
-xori t1 s1 -1396
-or s6 s11 t6
-addi t6 a7 -1193
-rem s2 x0 a7
-slt t1 s8 t3
-slti ra t4 1525
-ori s0 s3 -1334
-and ra a6 s4
-srai tp s2 26
-addi t6 s3 -621
-slli s11 s11 16
-divu t6 s2 s2
-slti s9 s9 -1521
-sll t2 a3 t0
-rem s2 s3 x0
-srl s5 t3 s2
-auipc s7 264268
-xor a0 x0 a5
-srai a1 a3 22
-remu tp a4 s3
-div a2 s5 x0
-srl s10 s5 t2
-mul s0 s4 x0
-add t3 t1 a0
-mulh ra s7 x0
-srai ra s3 0
-and s3 s10 x0
-sra a4 s9 s0
-xor s1 a7 t4
-srli tp s6 15
-remu x0 a6 s1
-remu a6 s8 s1
-sltiu a6 t3 -1139
-mulhu tp s7 s4
-and s11 s2 a2
-divu gp t4 a1
-sltu s6 a5 a5
-div t1 s2 t0
-slt t6 s0 x0
-srl t4 tp a3
-sltiu a4 a4 -1523
-auipc s2 39907
-slli s10 s2 24
-srai s8 t6 4
-remu s9 t2 tp
-sub s2 s11 x0
-srl a6 s9 t0
-mulhu t4 a0 s3
-rem t2 t0 s8
-div x0 s5 s11
-srli s1 a7 20
-mulhu s9 a7 ra
-mulhu s3 t3 tp
-mul ra s1 x0
-sltu s6 s6 ra
-divu x0 a0 t3
-slti gp s7 -1768
-remu s1 x0 s5
-and t3 s8 s7
-mulhsu t3 a5 a5
-mulh t2 a7 s1
-sra s3 s1 t5
-add s4 s3 t2
-remu a0 a7 gp
-auipc a2 542150
-srli x0 a7 27
-ori s7 x0 -1472
-add s8 t5 s0
-or t4 s1 s11
-srai t1 s6 25
-mulhsu tp a5 s1
-xori s8 a2 626
-remu s1 a7 a3
-or a7 a2 a0
-div ra t6 s6
-add s8 t1 t5
-auipc s7 409208
-andi a1 s2 -1702
-auipc gp 532061
-lui s3 1026853
-srli s0 a0 11
-slt a2 s4 s10
-sltiu t5 s0 -369
-slti s4 t4 -1118
-slli s8 t4 23
-xor a6 a1 s9
-sltiu t1 a7 394
-ori s2 s8 -1105
-srl t0 a6 t3
-xori tp t0 1842
-srl s8 tp s8
-sra s4 s9 t5
-slti ra t1 -988
-sra s6 t5 s9
-srli s9 x0 18
-sll a4 s3 t5
-rem s0 s4 s2
-andi a1 s8 -1126
-slli a3 x0 12
-slli a5 s6 10
-mulhsu a3 s9 t1
-andi a1 t5 -1742
-and t0 x0 a2
-ori a7 t6 -836
-and s10 s3 a5
-rem a6 s4 a7
-slt s5 s7 a2
-divu a7 s0 a2
-slli x0 ra 19
-slt s8 gp s2
-or a7 ra a0
-add a4 a4 s5
-xor s8 a6 s1
-add a2 a6 a1
-mulh a4 s11 a2
-divu a0 t4 s5
-add a2 t4 s7
-ori s7 t1 -1769
-add t3 t6 tp
-sll s2 x0 s7
-sra s5 gp s3
-add t0 a6 a1
-and t3 s7 s10
-sltiu a5 t1 -459
-mulhu s6 s2 a3
-sub t5 t6 ra
-mulh a2 s7 a5
-sub t6 s10 x0
-auipc s8 889123
-xori t4 a0 -912
-divu s1 s3 tp
-sltiu s9 t0 -689
-sra s5 s11 x0
-mulh t3 a3 a3
-div a7 s10 ra
-sra a6 s5 s10
-divu s5 t0 t2
-slli t2 t6 2
-xor x0 a7 a5
-srl t1 s5 s11
-mulhu s7 s4 s8
-sra t5 x0 s9
-rem x0 s11 t2
-addi a7 t4 -1066
-mul t5 a6 s6
-mulhu a7 a5 t3
-sra s1 s6 tp
-div x0 x0 tp
-addi t6 a7 411
-srl s3 t4 gp
-xori x0 s4 472
-remu s7 tp t3
-sltu t3 s3 t1
-slti s8 x0 866
-slli s11 t1 15
-sra t4 s6 t1
-sub tp t1 a0
-mulhsu a6 s1 s7
-divu a1 s2 a3
-xor t2 ra s1
-rem s11 t6 t1
-mulhsu gp a6 a2
-add gp tp a0
-slt s3 tp s9
-or t2 t2 t4
-sll a2 a6 a7
-srai s10 t0 4
-add s8 a6 a0
-rem s9 s0 s8
-mulhu s9 t1 s7
-mulhu gp t4 s9
-sltiu t1 s8 1257
-addi a3 a4 -888
-mul s2 t2 ra
-slt a5 t0 s3
-sltu s1 s7 a6
-auipc s9 683149
-lui s4 257328
-sra a2 t6 s8
-srl x0 t4 s0
-slt gp a5 t3
-div s0 a6 a5
-divu a1 ra s1
-sub s2 gp t4
-sltiu s4 s0 -1613
-srli ra t5 30
-slti s2 s7 1938
-sub x0 s2 t4
-xor s1 a0 a0
-mul t5 x0 s1
-xori s0 x0 278
-xor s7 t1 a6
-mul a5 t6 t0
-sltiu tp a2 1186
-and a0 a1 s0
-sra s7 a3 x0
-srli s2 s7 16
-xor s4 s5 s2
-xor s5 s4 t4
-lui s5 462152
-remu s5 a1 a7
-sub s3 t4 s5
-srai s8 s5 7
-slli t4 a7 13
-slt tp s8 a7
-sltu a5 s3 t0
-sub tp t3 gp
-and a1 s9 s4
-div a3 tp s6
-addi s11 t4 1879
-xori a5 s8 -1722
-rem s3 t4 a6
-srli s4 a2 17
-rem s9 s9 s1
-sll a1 x0 a7
-mulh s4 a7 s0
-andi t0 t2 -1962
-slli s2 s10 30
-slli s3 ra 12
-srli t4 t2 21
-add s0 s7 a2
-addi s9 a3 1988
-sub s11 s9 s3
-srl t1 s6 ra
-lui t6 859052
-div s10 a6 a6
-or t2 x0 s1
-mulhu a7 s11 a7
-mulhsu s10 s8 a4
-srl t4 a1 t4
-xor s10 s8 s1
-add a0 s9 ra
-mulh s2 t4 s3
-and a5 t6 s6
-sll s4 s7 a7
-divu x0 s6 s8
-mulhsu a0 a0 ra
-ori ra s0 -1133
-mulh s10 gp t0
-sltu a7 t1 x0
-mul s4 t2 t0
-andi a0 s0 -917
-and t6 a1 s2
-remu t6 a4 a2
-mulh a1 tp x0
-slti s9 tp -896
-srl s3 t5 ra
-and s4 t6 s2
-addi s3 s9 -752
-rem t2 s3 s9
-slti t0 s2 81
-sltiu gp a0 919
-srli t3 a6 8
-slti a4 s4 1602
-rem a6 t4 a1
-mulhu s10 a1 a6
-sll a4 a1 x0
-mul a3 t2 gp
-slti ra t4 507
-mulhsu a5 a2 s8
-srl t6 gp s1
-rem s7 x0 a6
-mulhsu t6 s0 t6
-slt a2 t2 gp
-add a6 s9 a6
-srl s7 s7 t5
-srli a0 t6 23
-srli s6 s3 18
-srl t6 a4 tp
-mulh s10 s8 s9
-slt a5 gp s11
-divu s7 a2 t3
-lui a4 501554
-mulh s2 s11 ra
-div a1 ra s5
-srli t1 s11 18
-sll s10 s2 s5
-xor t3 x0 t5
-sub t0 s1 t3
-auipc a2 79114
-mulhsu s6 t4 s6
-andi s11 ra -817
-sltiu t6 a5 2044
-remu a3 s8 t3
-lui t4 947212
-mulhu a5 s6 s4
-ori t5 gp 90
-auipc t5 114972
-srl s11 t5 gp
-sltiu gp a5 -2034
-sltu t1 a4 t3
-divu s3 t1 s8
-mulhsu x0 t1 t0
-add s10 a6 t6
-ori a6 a1 1118
-rem a6 t6 s4
-mulhu t0 s6 s11
-srl s1 a7 a5
-mulh s3 a6 t0
-sll t1 a7 a1
-mulh x0 s3 s6
-sra s0 s1 t0
-mulhu a5 a6 s0
-srli s0 a4 10
-div a6 x0 s7
-mulh s9 s3 s11
-mulh a7 t5 s2
-remu s7 a5 tp
-remu a1 s7 tp
-sra s10 t6 t5
-or t1 s7 a7
-sltu s0 s2 a4
-xori s11 s0 -1585
-sll x0 t0 a5
-lui s4 333119
-remu s10 a6 t5
-slt a2 t4 s11
-addi s6 a3 871
-rem t5 a0 s2
-or s2 s8 t0
-divu a4 t1 a6
-srl a3 a0 ra
-mulh s0 ra a3
-sll a1 s8 t3
-remu x0 gp a3
-srli s5 a2 27
-sltiu s4 a7 -640
-rem a4 a3 s2
-and s4 a2 s2
-xori s8 x0 520
-or a6 s9 s5
-srai s10 x0 2
-sra s0 gp a5
-or s2 t0 s7
-remu s8 t1 s2
-slti s8 a0 1429
-rem t0 s9 s5
-or gp s3 a2
-mulhsu s7 x0 t2
-ori s11 ra -1800
-xori s6 s8 -784
-lui a3 1041062
-mul t1 s9 tp
-ori t0 x0 -1150
-sltiu s8 t3 1336
-div a5 x0 a0
-mulhu s9 s4 s3
-or t1 ra a6
-andi s0 a6 -1534
-ori a0 s10 994
-mulhsu t3 s0 s6
-divu tp ra t4
-sltu s5 s6 t3
-addi a1 s1 573
-remu a3 s3 s10
-and a3 a5 a7
-xor a2 a3 s9
-srli ra s7 14
-lui s1 1008184
-sll s4 ra a5
-addi t2 t1 -612
-sra s8 t0 t0
-divu s0 t1 s8
-xor a2 a3 s3
-mulhsu ra s2 s6
-mulhsu t0 t6 a4
-addi t4 s9 -1799
-sltu t1 t5 t3
-srli s6 a5 0
-div s1 a2 s6
-sub gp a1 s8
-sub s2 t2 s5
-srli s1 a4 24
-sll s5 t5 s0
-or ra s3 t6
-slli t3 s6 31
-mulh s10 t2 a7
-add t1 t6 a2
-slt t4 a3 gp
-auipc t3 808081
-add t5 a5 a0
-xor t2 a4 s9
-or s0 t2 a3
-sra a4 ra a0
-divu s0 t1 s11
-div s1 a2 a5
-div t2 s2 s0
-add s4 a6 gp
-andi s6 s10 -1565
-ori gp a0 1406
-mulhsu a0 a2 t4
-srli s0 s1 2
-div a2 t4 t1
-mulhu t6 a0 s0
-srl s1 t0 s8
-sra s11 a1 s0
-xor a6 s2 s3
-remu t1 s1 s3
-sub x0 s7 gp
-xori t6 s4 -1700
-divu s0 ra a0
-xor tp s5 ra
-remu s6 s1 tp
-or a1 a3 t4
-mulh s2 t2 a3
-ori t1 a6 -963
-slt s5 t3 a6
-srli a0 s7 8
-sra a2 s11 a0
-slt a5 s8 s10
-rem s10 t3 a0
-sltiu t2 t3 -1350
-mulh t2 x0 s10
-sltu t2 s10 s2
-mul a4 s7 tp
-sltiu x0 t3 1908
-srl a1 s10 s8
-lui s6 57585
-and a0 s2 a3
-div x0 s9 s10
-ori s4 s10 -491
-and a0 a2 s10
-sltiu a0 s9 1211
-xori t4 t1 -847
-or s7 s8 a4
-or a5 s5 t6
-sll tp t6 t4
-sltiu a6 a6 -1772
-or t6 a3 s5
-divu s11 a7 t4
-srai a1 t2 7
-div s2 t5 s5
-or a7 s9 t0
-divu t1 t6 a2
-divu t6 t4 s3
-mul s3 a5 t0
-srli s8 a0 14
-rem x0 s6 s3
-mul s1 s8 a3
-xori s2 s2 -1641
-slli s3 s3 9
-rem t6 t3 s3
-srai a0 s11 22
-slli s5 s5 4
-mulhu s1 s7 s3
-lui s6 783081
-auipc x0 856475
-sub ra t0 t1
-or s5 t3 s10
-andi s1 t2 -1214
-remu s3 x0 s0
-ori t3 s10 -13
-sll tp t6 s11
-and a7 ra a1
-lui s5 69070
-xor t4 s8 a3
-ori gp t2 -2019
-rem s11 t5 a4
-xor a5 a2 t1
-divu s2 gp a5
-sltu gp s1 ra
-sltiu a3 tp -378
-addi s10 a2 -901
-auipc a6 450724
-sltiu x0 ra -1917
-sll s1 gp x0
-sltu t5 t4 t2
-add s1 a2 s6
-or a4 t2 t1
-mulhsu t0 t5 a1
-sra s9 a5 s4
-mulhsu t6 a6 x0
-xor t2 t6 a7
-add x0 s7 s11
-sra t2 t5 a1
-ori s2 s3 1289
-sll s6 gp s3
-add t6 a0 ra
-rem t2 s8 t0
-mulh a3 gp tp
-mul s6 s2 t5
-slti a6 x0 1565
-sltu s9 a6 t1
-andi a7 a3 1060
-xor t3 s4 s4
-slli x0 a6 21
-andi s8 gp 21
-sll a5 tp a3
-or s5 s0 s4
-div gp tp t4
-srli s0 a4 7
-div s9 a3 s9
-ori tp t0 -1524
-mulh t1 a5 s3
-slti a1 s0 908
-mulhsu s7 s3 a0
-andi s10 s0 -1838
-sra s0 tp a4
-mulhu a3 a1 s4
-mulhu ra s8 s5
-remu s2 a3 t0
-sltiu a2 a3 -1676
-rem x0 t3 s1
-sltu s8 x0 a7
-mulhsu s0 t6 a3
-lui a1 1037635
-xori s3 s2 -649
-divu s10 s1 t2
-mulh t5 a1 a5
-or t4 gp t0
-sub t0 s9 s2
-sltiu a1 s10 -1672
-srli t2 a4 25
-sltu a3 a6 a4
-slli t0 a6 4
-sub t2 a2 a4
-or a1 x0 t0
-ori s1 s0 -822
-srai a3 t0 23
-ori t6 t5 1783
-xori ra s2 686
-divu a4 s3 s9
-sub t6 t2 gp
-or t6 s5 tp
-auipc t1 143925
-lui s5 660547
-mulhu t0 s2 s9
-auipc t1 497101
-mulhsu gp t3 s4
-lui s1 359442
-slli s5 s11 12
-mulh ra t1 ra
-mulhsu t1 s10 x0
-ori x0 s8 1349
-xor s2 s0 a0
-sub s3 a6 t0
-sltu s8 tp s9
-slti s2 t5 -1294
-rem x0 s0 t4
-addi gp s2 -446
-xor a2 a6 s4
-xori tp t0 -903
-ori tp s2 -880
-mul t5 s0 s8
-srai s3 t6 25
-addi s11 t2 -56
-addi s1 t5 1996
-xori a4 t3 1894
-srli s9 s3 28
-and t2 a4 t3
-mulh a2 s6 s3
-sra t2 s1 a1
-addi t2 a7 1547
-sll s7 s0 s4
-sra s0 s1 s1
-divu s8 t0 s4
-sll x0 s0 a1
-srai s7 t3 20
-rem t0 t5 t4
-sra a0 t1 s10
-srli s10 ra 1
-slli a2 s8 13
-add gp s2 s9
-mul a3 s1 a2
-sltiu a0 t4 -993
-addi a3 a7 -118
-mulh s10 s0 s10
-sub s3 s6 t2
-srl s2 s7 s8
-and a1 a3 a0
-sltiu x0 t2 -640
-mulhu a3 s3 a2
-mulhsu t1 ra tp
-mulhsu a2 s0 s6
-slli s6 s7 27
-auipc a2 1021454
-srl a2 a2 x0
-rem t5 a0 a3
-sltiu t2 t2 -2033
-sll t3 s11 s5
-srai s7 s10 10
-slt t2 a7 x0
-sub s7 s1 a6
-xori t2 a0 -424
-add s10 s5 a7
-div x0 a7 s4
-sltu a0 a5 a6
-div s6 x0 s11
-ori a0 tp -929
-mul t1 t4 tp
-auipc t1 763481
-or t3 s4 t4
-sltiu s11 s3 -1226
-divu s3 a7 tp
-srl x0 a7 ra
-sub x0 a6 x0
-xor a3 s4 s0
-mulh ra s6 t0
-srli t3 t0 13
-xori gp a0 -1032
-xor s5 a2 s8
-divu s0 s3 s3
-mulh s4 s5 t5
-ori s11 a5 -421
-addi a7 t2 193
-mulhu a7 s5 s11
-lui t4 852093
-sltiu a5 s6 -882
-mul tp t2 a6
-and s1 tp a7
-sll a5 a2 s1
-auipc s7 30518
-sll s1 s8 a0
-sra tp t5 t0
-slli gp s9 17
-slt s11 t3 s10
-andi s10 t5 -1358
-srai a4 t0 7
-sra s11 t3 s3
-srli s10 s9 7
-xor x0 a4 a2
-andi t6 s4 1563
-div tp gp s3
-mulhsu a1 s11 s1
-sub s4 t1 a7
-srai x0 s3 31
-remu tp a6 t3
-srai s4 a3 15
-remu s10 s5 s10
-slli ra s3 8
-slt t6 s8 gp
-slt s1 s10 t6
-div s11 ra s8
-add a3 x0 s3
-andi s0 s6 1851
-sltiu a3 tp 724
-mulh gp ra a5
-mul a6 a0 s8
-divu t0 gp a2
-slt gp t3 a6
-srai s4 s5 20
-sll a5 s8 a3
-mulhu s9 t6 s1
-slli s5 t0 3
-ori t3 a1 -1924
-or t0 x0 a1
-srai tp s5 24
-or tp ra ra
-lui x0 985918
-slti s10 s7 1607
-mulh tp ra s0
-slt a5 a0 a7
-mulh t4 a3 gp
-addi t5 t2 -1635
-auipc a7 780545
-and s11 t5 s0
-divu s1 a6 t4
-srai s11 a5 21
-sll ra t4 gp
-addi t2 a0 -735
-sll s1 s5 t0
-mul x0 s7 tp
-sltiu s7 s1 -760
-divu a1 t5 a1
-ori s7 x0 936
-mul a7 s7 s2
-sll a1 t2 s5
-srli s8 a5 3
-lui s6 126260
-mulhsu tp s0 a5
-divu s1 s8 t2
-sltu ra s1 s0
-slt x0 a3 gp
-xori t3 a5 -781
-ori a6 tp -1935
-mulh x0 s4 s3
-xor t3 t0 s11
-add s8 s1 t6
-addi t5 a3 -497
-xori a0 x0 -1250
-srli s9 s8 9
-sub gp s2 t5
-xori a1 t3 -1409
-rem a5 a4 s6
-srl t1 a2 a6
-addi s10 s1 122
-srai s2 x0 9
-andi s10 s5 1351
-sub s3 t6 s11
-srl a1 s6 t2
-add s3 t5 t5
-xor t1 a6 s11
-xori t6 t6 608
-sll t5 s2 s8
-or a3 s10 s3
-rem s7 s3 s7
-lui ra 838750
-sltu t2 t0 s2
-or s7 a0 a5
-divu s9 a0 a5
-andi a4 gp -171
-slti a3 a2 -1543
-auipc s2 408202
-sll s7 s9 s8
-slti x0 a7 -533
-or a6 a0 t0
-slli s4 gp 6
-add s5 t1 t3
-auipc s10 560004
-rem s1 ra t4
-xori s10 a7 991
-sra t5 a3 s6
-xori t6 s7 -111
-mulhu s2 a0 a0
-slli a5 s3 0
-sll s0 t4 t1
-mulhu t2 a3 s0
-srl t3 a3 t4
-srl a4 x0 a1
-mul a2 a5 a2
-srai x0 s1 12
-divu a3 a4 s8
-slli a2 a7 15
-xor s9 s11 s5
-slti t4 s2 -19
-divu t0 a2 t2
-srl s11 a7 t4
-sltiu s4 s8 -1862
-mulhu x0 s7 a0
-sltu s8 s6 t0
-div s6 x0 s1
-sltu t0 t3 a7
-sub gp t6 s1
-rem s6 s10 s7
-andi a5 s0 -1250
-mul x0 s5 s4
-mulhu a2 x0 s2
-mul s3 s6 t1
-addi a2 s11 -1996
-rem s8 s9 s7
-slli t1 a3 19
-or s1 a5 s3
-auipc x0 3439
-ori s0 a5 460
-div s2 s0 s5
-auipc t1 863090
-xori a0 t4 -506
-slt t2 s6 a2
-srai a5 t5 7
-mul s7 s0 gp
-mulhu t2 tp ra
-ori s10 a6 -1715
-slti ra t6 -1498
-auipc s2 168616
-sub t3 a2 t1
-sub a2 s6 tp
-mul a1 a3 x0
-or t3 t2 x0
-sra s8 s1 a0
-andi s9 a0 -661
-divu s2 tp s9
-ori s6 s11 474
-or x0 s10 a0
-sub t0 a6 t4
-lui s10 81197
-auipc a2 326889
-srli a1 s0 8
-and s10 s1 s2
-xori s6 s10 -417
-auipc ra 594227
-addi a3 tp -294
-sltiu s6 s8 -852
-sltu a3 ra t0
-srai gp s5 3
-xori t4 s1 -1156
-slli s6 a2 26
-srai t4 tp 10
-or tp t2 a4
-add s1 a0 s7
-mulh s8 s6 s5
-mulhsu s0 x0 gp
-divu x0 ra a6
-xori x0 s2 -1606
-divu a0 t6 a0
-rem tp s4 s8
-mulh s1 s8 t5
-andi a5 s2 -462
-and a2 s6 a0
-divu s6 t6 a4
-xori ra t3 -219
-or t4 a1 s9
-mulhsu s2 x0 gp
-srli a5 s10 12
-mulhu t6 s6 s6
-sltiu s2 a3 -1748
-sra s2 s0 s2
-srli t4 t6 15
-mulhu a5 s2 s3
-remu a6 s11 a5
-mulhsu a3 s4 s8
-xor s9 a0 s8
-and a0 s1 s0
-and s0 gp a4
-srl a3 s0 s2
-sltiu a4 t0 1190
-mulhsu t0 s7 gp
-slti s1 ra 633
-or a7 x0 t5
-mulhu t0 s0 s10
-ori s6 t0 -850
-sltiu t3 a0 -884
-lui s3 596560
-rem t2 s11 s9
-sub t5 s7 s2
-mulh s6 t3 s9
-addi a6 a4 -258
-mulhsu s3 t4 tp
-divu x0 t4 x0
-srl a4 s7 s10
-andi s5 t6 -1649
-add t6 s7 t5
-srai s3 s5 20
-mulhsu t4 s8 s7
-sll t3 a1 tp
-ori s11 t3 -702
-sltu t4 t2 s3
-ori gp ra -320
-slti a7 tp -1229
-rem s4 s5 a3
-auipc a2 1010709
-xor s1 t2 ra
-slli t1 t2 20
-ori t5 t1 144
-sra s1 t2 a5
-xori s0 t1 -425
-sltiu a7 gp 582
-srli a0 a3 20
-rem s10 t5 t3
-div s4 x0 tp
-sll tp a5 s8
-ori x0 x0 -1805
-sltiu t1 t2 -1202
-addi a4 a1 -755
-auipc s2 636829
-mul a0 t3 a3
-mulhu s5 a1 gp
-mulhu a2 x0 a7
-slli s1 gp 18
-srli s4 t2 18
-add gp s10 s4
-slti t3 s9 1851
-srl x0 t3 s4
-mulhsu s4 s2 a1
-remu a5 t6 s7
-sll a7 s5 t4
-sra a5 t2 s10
-mul s10 s0 t2
-sltu t1 s8 a5
-slt a2 gp s7
-lui s3 506045
-slti s2 t1 -1916
-mulh a1 a4 s3
-mulhsu t1 s3 x0
-mulhsu s8 a3 s5
-rem a2 x0 s10
-slli t0 s4 15
-mulhsu s9 s0 s11
-mul s9 a2 a6
-sltiu a6 a7 -527
-div s11 s2 s9
-sra t1 a5 s5
-addi t6 t2 -1833
-sub ra s9 a2
-mulh s6 s8 ra
-divu t1 a3 s6
-sub s8 t3 a0
-auipc t5 622840
-or s10 s7 t6
-or a2 s6 s0
-rem s8 s6 t5
-andi s1 s9 -1596
-srai t0 a5 26
-remu t0 t3 t4
-sltu x0 a4 gp
-slt t5 tp s1
-slt s10 s10 s9
-mul s11 s10 tp
-mulhu x0 tp s1
-ori a6 t2 -1992
-sll t0 a6 s1
-sltiu ra a4 -1704
-or s2 tp s7
-srli t3 s10 26
-xor a7 s1 a1
-rem a4 t4 a5
-sltu gp t4 tp
-slli a7 a2 2
-srai s10 s11 15
-and s2 s2 a0
-slt a2 x0 t6
-sra t4 t4 s10
-sub s3 t2 tp
-xor s2 s5 a3
-slti s5 s5 1612
-xor s2 s6 a7
-sub t0 s2 s1
-sltu t3 s6 s11
-or a6 t2 a3
-sll s7 s10 t5
-mulhu x0 s9 a3
-and s5 s9 a7
-add a7 t4 x0
-add a4 s7 s4
-remu t6 gp s9
-sltu a7 a3 t6
-srai s11 t0 18
-ori a7 s11 1334
-or s2 t0 a6
-auipc a5 310395
-div a0 s7 t4
-sltu t2 s9 s4
-mul a4 t2 s5
-addi a6 s6 -844
-sltiu s7 t4 243
-sub a3 gp a5
-or a4 a0 gp
-sltu s11 s0 t0
-and a1 tp s10
-sra s7 a3 t3
-sll s8 s0 a3
-sltu a2 a0 t6
-slli a1 t4 15
-mulhsu t1 s5 a1
-xori ra s1 484
-mulh s3 s11 s8
-auipc t4 37872
-sra s9 t0 tp
-mul a1 ra x0
-mulhsu s6 a7 s3
-rem a2 s8 x0
-andi t5 a0 -1695
-mul t4 s7 a5
-addi s0 s7 579
-mulhu s5 t3 gp
-xori t5 s6 -1206
-mul tp x0 t1
-add a7 s5 s9
-slli s10 s1 23
-sltiu t3 a5 -1106
-remu tp t3 t0
-mulh t1 x0 s4
-andi s8 a7 -1212
-div s9 x0 a3
-rem s8 a3 s11
-addi t1 s7 731
-divu s10 s9 gp
-sll s5 a5 a2
-mulhsu s5 t4 gp
-sub t2 x0 t4
-and s4 a6 s6
-mulhsu s3 gp x0
-srl a1 x0 s7
-ori a5 s1 -922
-or s4 a3 s0
-srai s9 a2 30
-mul s6 x0 s9
-add s10 s10 a7
-slti x0 s10 993
-sltu a7 s9 s11
-add x0 x0 s1
-divu s1 t3 s10
-sub s6 ra a4
-div a6 x0 a3
-sltu s4 s10 s11
-or t4 s6 t5
-mul t3 s0 s8
-div a7 t3 t6
-srli a0 s8 27
-or s8 x0 tp
-sltu t1 t1 x0
-srai a4 s8 6
-mulhsu s11 a5 s10
-lui t1 10178
-sltu t1 a3 s2
-slli s10 t5 10
-srl s4 t2 s4
-lui t3 322934
-sll s4 ra t6
-mulhu x0 s3 gp
-add ra s0 t3
-sll a4 s5 a1
-mulhsu a5 s7 a0
-auipc s7 174422
-remu s1 s5 s2
-sra gp s5 a2
-xor t1 s11 t4
-or a2 s5 s5
-rem a4 s7 a4
-sltu a3 s11 x0
-sltiu a7 ra -1281
-sltiu t1 s6 -1074
-remu t0 s3 x0
-sll t0 tp a2
-auipc tp 564623
-ori t4 s4 -1561
-and ra t5 a3
-andi t5 t6 -1218
-slt tp s4 s11
-auipc tp 768709
-rem tp gp a6
-add tp t4 x0
-andi s9 t3 -700
-xori s11 s5 -679
-sltu a6 t0 a0
-mul t3 tp s1
-ori s5 a1 1439
-slti a3 a3 -806
-remu gp s6 s2
-mul s4 a0 s6
-lui t5 654357
-remu s7 s8 x0
-mul t3 s6 gp
-div s2 x0 t1
-slt t4 s4 s1
-xor x0 x0 x0
-auipc t4 377431
-divu t4 t0 s1
-slli s11 x0 11
-sra s4 s6 s6
-xor a2 t3 s5
-srl s9 t5 t4
-or a5 ra x0
-mul a0 tp t3
-ori a0 s11 12
-srai s3 s10 19
-addi t2 t4 -307
-addi s11 a5 -318
-divu a1 gp s10
-mulhsu x0 s1 s10
-mul x0 x0 s7
-slt s4 a6 s2
-or s4 a1 a1
-div a2 t0 s10
-sub gp a3 a1
-slt s6 s10 tp
-div a1 s2 a0
-lui s11 463357
-srl a5 t0 s2
-addi s2 x0 -468
-mulh t1 s3 t5
-slt t4 a6 s9
-add x0 t1 s10
-rem t4 t3 a7
-mulhu s3 s6 a4
-srli tp s7 20
-mul t3 t5 s0
-mulh gp s10 x0
-remu s10 tp t6
-auipc s8 181132
-add a3 a7 t2
-slti s9 s5 -1663
-div a3 s5 a7
-srai a2 a0 28
-mulhsu s4 ra t3
-mul gp t6 s7
-divu s9 s7 s7
-sub s1 s4 gp
-addi tp a1 -500
-addi s2 s0 -972
-remu s11 a7 s10
-rem x0 x0 x0
-andi ra s6 835
-slt t6 s4 s0
-sltiu a1 x0 -1999
-srai s3 s6 28
-mul a5 s11 s9
-slti s9 a5 297
-slti a3 t5 -636
-mulhsu t2 s11 s2
-sltiu t6 a1 -451
-rem s2 x0 gp
-srli x0 t5 9
-remu t0 a3 tp
-sltu s6 s5 t6
-mulh a4 x0 s3
-slti t6 a1 -1048
-slt s11 s10 t5
-srl a6 a5 s3
-srli a6 s1 6
-remu a1 a2 t5
-andi s3 s1 -1588
-and x0 s10 a3
-remu s11 a4 a5
-ori s3 s9 1786
-xori s7 t5 1127
-xori a6 t0 -584
-xori t4 s1 -1384
-xor ra s11 s8
-mulh s11 tp a4
-sltu t6 t0 ra
-slli ra t1 28
-auipc a1 508275
-mulh s7 s11 s0
-divu t1 s7 s5
-srai s1 s4 26
-ori a6 a0 -2043
-sll s6 s7 a3
-and s0 a3 t3
-mul s6 t5 s5
-divu s10 a6 a1
-sltu t6 s5 t5
-sra s2 s1 a6
-sub x0 t6 s1
-and a6 t1 t1
-slt t2 a3 s3
-sltiu s3 ra -821
-xori t5 a3 2039
-xori a6 t3 1818
-sltiu s4 a3 -28
-mulhu s11 t6 a7
-srli s3 x0 29
-sub s11 x0 t5
-srl t2 tp a0
-srai tp s1 5
-lui t1 437663
-srai a0 t5 26
-divu s11 t6 s5
-remu s3 s6 t3
-srli s10 t5 10
-slt s6 s1 s8
-mulhu t3 s2 a5
-mulh gp s7 x0
-div s4 s9 t4
-div a2 x0 a2
-srai a7 a2 18
-sltiu t6 s7 -766
-srli a0 a4 31
-ori gp s11 -1430
-remu s0 a1 s7
-sltiu s6 s11 -149
-rem s3 a5 ra
-slli a0 s4 28
-addi s3 gp -1803
-or t3 t5 x0
-divu t2 s8 a7
-addi a5 s4 -1090
-rem t3 t2 s3
-addi a4 s6 444
-slti a7 s5 1447
-sub s4 s8 a7
-auipc t5 204860
-slli s8 s7 31
-or ra tp s0
-xori a0 s6 -604
-sltu s1 s2 s8
-mulhu a1 s1 t3
-srl t4 x0 s4
-and t1 a1 s11
-ori t1 s2 -154
-xori t0 gp -1955
-sltu t2 s8 a4
-mulh gp gp x0
-div s1 s9 x0
-xor s11 x0 x0
-add a1 a6 x0
-srl a0 s6 t1
-andi gp tp -773
-lui t6 227631
-lui tp 994139
-srai s11 s3 21
-slt a3 a4 s7
-addi s4 s2 -58
-slt gp s3 t0
-sltu s4 t2 x0
-rem s11 a3 s1
-sub a1 s1 t3
-mul s11 s1 s0
-rem s8 t1 s8
-div a4 t4 s0
-mulh s7 t1 x0
-sltu a4 a2 s7
-sll t2 s5 a3
-rem ra s3 a4
-ori s0 x0 849
-or s9 s11 tp
-add ra t1 t1
-srl a3 t4 tp
-sltu t0 s3 t4
-div a2 ra s6
-and a6 a6 t3
-lui a5 961615
-divu s8 s5 a6
-addi t6 t3 1239
-sll t5 s3 a0
-sltu a4 s3 s4
-mulhu x0 a3 gp
-and ra s9 x0
-srai tp s6 22
-mulh a5 s7 t3
-divu s6 s11 t1
-rem a2 s8 s3
-mul ra a6 s2
+xor s4 s2 s11
+rem s3 a6 s6
+addi t3 s11 195
+xori s0 a0 -1294
+xori t1 a4 -764
+sra x0 s1 s9
+slti s3 a7 325
+add s6 a1 gp
+mulhsu s5 a6 a6
+add a2 ra s11
+div s2 a3 a2
+xori a4 s10 -346
+ori s6 s9 1267
+remu tp t0 gp
+sltu s2 s7 s11
+ori s5 s10 -492
+ori a5 x0 -1162
+sra s4 s11 tp
+rem s11 s4 t3
+sltiu t3 t1 -2003
+add a0 s10 t4
+sub a7 t4 s2
+srli s1 a7 15
+sltiu t3 s0 954
+xor gp t1 tp
+and t2 s7 s11
+and t5 x0 s1
+xor s0 s9 gp
+ori x0 t1 -1746
+auipc s1 792177
+rem a0 s5 s9
+mul t4 a7 ra
+slt ra a6 s7
+remu x0 a4 t5
+div s6 s7 a0
 remu a6 s0 a6
-sll a5 s3 t4
-mul t6 a5 s1
-sra s11 s11 tp
-andi s5 s3 953
-sra t3 a4 s10
-sltu s9 s3 a3
-auipc tp 169180
-ori a2 t0 1973
-slt s0 t6 a4
-sltiu t1 s4 -1013
-srai gp t0 23
-or t4 s9 s1
-lui s9 426736
-lui s6 69671
-remu gp t3 s9
-sra s11 t3 s10
-slli t1 a0 26
-mulhsu a3 a6 s9
-xori t1 s9 1344
-slli s7 s11 7
-slli a7 a7 5
-slt a5 s0 s4
-xor s6 a7 s9
-div t5 x0 s11
-div tp s0 s11
-sll s11 s6 a0
-rem s3 t3 a2
-slti s7 t3 622
-sub s11 s6 x0
-divu a7 a1 s1
-sub t4 t3 tp
-slli x0 t5 30
-mulh t5 s6 s6
-add s7 t2 x0
-sub a4 t5 a6
-add t3 t2 a3
-srl a4 s10 s10
-rem x0 s4 t4
-sltu s0 s4 t2
-lui t3 549612
-mulhu s8 x0 x0
-auipc s3 306271
-sltiu gp ra 684
-divu t0 a6 s5
-and a2 t6 s2
-lui t3 571634
-mulhsu tp tp t1
-sub t1 s9 s4
-and s9 a4 t5
-remu t3 t3 a1
-xori tp t5 -1416
-auipc a2 284290
-srl a1 s3 a3
-mul s4 x0 t6
-andi t1 t4 -981
-div a4 t1 a7
-div a3 x0 t0
-add t0 t0 a3
-slli t5 s11 12
-mulhsu t6 s3 t6
-ori t5 s4 -508
-srl s1 s6 x0
-mulhu s5 s4 s4
-addi s7 ra -2046
-rem a7 t0 tp
-srl t3 t0 a0
-or t4 x0 s4
-xor tp t3 s11
-and s2 s8 s4
-divu a5 a6 s3
-sra x0 s10 s0
-andi s4 t1 -1407
-addi s11 s7 1809
-addi t4 a4 -714
-divu x0 s11 s10
-mul t6 s4 s10
-or a1 s4 a5
-sll t3 a2 s8
-rem t4 t5 s1
-sub s1 a5 t4
-auipc t0 640739
-andi s5 s10 -117
-andi s8 t1 765
-auipc s11 255177
-auipc tp 540871
-mulhu a4 t4 s9
-mul gp x0 s9
-divu s5 a7 t0
-or a5 t2 t0
-sll t0 t5 a3
-divu t4 t0 a0
-srl a3 s11 s9
-sltiu a7 a5 -828
-andi a4 t4 -1514
-lui a7 522770
-mulhsu s11 t1 gp
-srli t1 a5 7
-slti a6 a1 -618
-slli t5 s0 10
-remu t3 tp a0
-sra t6 t4 s6
-divu a1 a2 a3
-addi s5 s1 -597
-slt t6 t4 a3
-mulhu a6 a3 ra
-ori s6 s0 -96
-slti s6 gp -926
-sra t4 s9 s2
-lui a7 213522
-sll gp s7 t4
-add a0 s4 a3
-mulhu s8 a2 s11
-and a5 a6 t6
-rem s6 s0 s7
-srli ra x0 16
-divu s2 s1 a5
-mulh tp a0 s3
-and a6 a4 s10
-mulh s1 gp x0
-andi t6 s11 -57
-srl a5 s10 a6
-mulh a2 s8 t0
-add s5 s6 a7
-and s3 s8 s10
-srl ra s5 t0
-auipc t3 277825
-and t4 a3 s11
-srli a4 t4 24
-andi t6 s0 -1393
-srli a0 t1 17
-xor s11 t2 s11
-mulhu a7 a3 x0
-ori s3 s7 -1997
-mulh t6 s6 s3
-sub s5 a6 a0
-sra t1 x0 s9
-slti a6 s6 -249
-auipc x0 945931
-slt a2 s1 a1
-xori gp a2 2043
-mul a7 a4 a2
-remu a2 tp a7
-ori t2 tp -1169
-srli a6 t3 0
-sltiu tp t1 1219
-auipc t5 668531
-sub s8 s9 t0
-sll a0 t5 s6
-xori t3 x0 -266
-or a3 s6 s11
-slli s0 s9 16
-auipc s11 643952
-srl x0 t3 t6
-srai s5 gp 16
-auipc t6 441902
-srai a4 s0 8
-xor s3 s2 x0
-lui a6 626939
-ori a0 t3 -1889
-ori t1 a5 -1941
-lui t5 225134
-srli a2 s6 22
-sll s0 a1 a5
-ori s5 s5 1535
-addi tp s7 -2030
-remu a6 s4 s3
-srli s8 s9 24
-mul a3 s1 ra
-addi s0 t1 -1392
-and t0 t6 x0
-addi a4 t3 -984
-ori s8 gp -159
-or t2 a3 s8
-sltu s1 tp t0
-sll s5 s11 s2
-mul s10 s11 tp
-and s3 a2 t2
-srli s8 s2 26
-ori s0 a1 1806
-sltu a7 s9 s10
-sra x0 a6 s3
-slt tp s9 gp
-rem x0 s11 s7
-sltu t0 s4 x0
-sll gp tp s6
-remu s6 x0 t0
-addi t0 t3 -533
-mulhu s2 s0 s1
-slti t0 s3 -262
-mulh t1 s5 x0
-mulhu s7 a3 x0
-mulhu a0 s0 gp
-slt a2 a1 t2
-sub ra s2 t0
-and s9 s11 a5
-srai s0 s1 21
-sltiu a4 t2 -1359
-remu s5 ra s9
-xor s11 a7 s5
-sltu a1 t2 s6
-or t6 s4 s6
-andi s5 a5 992
-mul s3 a2 s1
-ori t2 s7 -259
-or a0 a7 s7
-divu s1 s10 a7
-remu x0 gp x0
-div s7 s10 s10
-and t6 a3 a7
-div s4 t4 s9
-sra t3 gp t4
-auipc s2 168448
-srai a6 x0 0
-rem a7 t2 a0
-andi a6 t4 346
-auipc a5 929001
-xori a5 tp -696
-remu a2 t0 t6
-div t1 s5 s1
-sra x0 gp a3
-auipc a3 105206
-remu a0 ra t0
-sltu t5 a2 s2
-xori x0 t1 -1526
-ori a2 a7 1176
-div s7 a0 ra
-andi t1 t4 -607
-sltu a6 s11 s5
-ori s0 t0 -1597
-slli a0 a6 26
-sltu s10 a4 s8
-ori t0 ra -109
-srai t6 s0 4
-or tp t5 s6
-lui s9 630743
-slli ra a3 11
-mulhu t3 t4 ra
-xori s7 a0 -42
-xori gp s4 -226
-sub a1 tp s3
-or s3 tp a6
-sltu a5 s9 s4
-lui s11 9101
-srl tp a5 t6
-sub gp s0 a4
-and a6 s10 t4
-sll s8 s5 t5
-sltiu s1 ra -410
-and s11 s8 s5
-xori s9 t1 1635
-sltiu t5 a7 -1235
-srai t0 gp 23
-slti x0 x0 846
-srl x0 s8 s0
-andi s5 a4 -1984
-slt t4 t4 s5
-or s3 a7 x0
-slti x0 t3 1972
-mul t2 a2 tp
-or a1 s1 s3
-rem t2 t5 s0
-sll s4 s5 x0
-srai a0 a6 28
-sub s9 a5 a0
-rem a5 a0 s4
-sltiu s7 a7 -827
-sltiu tp s1 1670
-div s9 a1 a6
-srai s6 gp 19
-lui s5 549762
-slli x0 a1 4
-sra tp a3 t6
-slli a6 s1 28
-sra x0 a1 a1
-divu a6 s5 t6
-addi ra s7 -1146
-addi s3 t2 -1163
-srli t1 a3 26
-sub a5 s6 tp
-rem a6 t3 a1
-rem a5 gp s4
-slli s11 s4 1
-sll t2 s10 s5
-mulhsu tp gp t1
-ori x0 a7 587
-add ra a2 s9
-slt s8 a6 s11
-divu a0 s9 s3
-srai t0 a6 31
-div x0 a4 a1
-mulh t1 tp a5
-divu a7 s1 t5
-andi t5 s2 -1728
-srl s7 a1 s7
-srl gp a2 s6
-lui s10 777823
-and s11 s3 a0
-addi s2 s3 242
-sra gp s0 x0
-sub s4 t0 t3
-sub s9 a2 a0
-mulhu t1 s5 a6
-mulh s6 t5 tp
-rem tp t4 tp
-sltu s4 a3 a1
-add x0 gp s5
-auipc a1 760293
-or t5 a6 s9
-auipc s3 417776
-divu tp x0 a2
-sll x0 s4 s9
-add t1 s11 s5
-rem t1 ra gp
-mul t5 t0 a7
-auipc t3 135789
-xor a7 a1 x0
-slti a1 a0 -793
-sltiu t0 s8 -1466
-lui t1 316918
-sltu a2 x0 t0
-or s4 t6 t3
-sltu a1 t0 s11
-srai t1 t0 18
-div s6 s6 s9
-sll s5 s1 s10
-and s0 t5 s9
-ori s0 s9 -1417
-ori a3 t2 -1177
-andi s2 x0 -1017
-ori t3 s0 -1788
-xori x0 s7 -1725
-xori t6 s5 1590
-and a5 s2 a0
-sra t2 s10 s11
-addi t5 a7 -1229
-xor t3 s7 gp
-xori tp t0 -1917
-sll s9 s3 a4
-lui s5 479931
-or a3 s11 t2
-slt ra a3 s7
-slli s10 s3 22
-sltu s6 x0 s0
-lui s6 180947
-sll a0 s1 s4
-rem s5 t1 x0
-add s8 gp s9
-xori s3 x0 607
-mulhsu gp t1 gp
-slli a4 a1 30
-slli a0 tp 29
-sub t4 s8 s11
-slt a0 s6 x0
-ori tp ra -562
-lui s7 219556
-mulh t6 a7 t5
-ori x0 a0 -179
-ori s9 a7 220
-divu t4 s3 a5
-sra t5 x0 tp
-addi s11 s11 1259
-addi t1 x0 334
-srl s7 ra a6
-ori s0 t5 -663
-slt s9 s6 s5
-mulhsu t0 x0 a1
-mulhsu s1 s0 s1
-auipc t1 545526
-auipc a6 121799
-or s6 a1 a2
-srai a0 s5 1
-ori x0 t1 -1566
-ori s6 a1 1272
-add t2 s3 x0
-mulhu s4 x0 a3
-slti a5 a6 364
-add a1 s9 t2
-divu s1 t0 a4
-rem t0 s6 t6
-sltu a7 t3 x0
-rem a0 t5 s7
-slt t3 a1 a3
-and ra t1 s5
-addi a6 t4 -2040
-srli s1 a6 24
-rem gp a1 s8
-srl x0 t6 s10
-mulhsu gp t5 t5
-auipc a1 579127
-xor t1 a2 s10
-xori t1 s4 -1429
-xori s2 s11 1787
-sltu s11 a1 s10
-mul a0 a6 t4
-rem s6 s2 a2
-rem s0 t1 x0
-andi t5 t0 345
-auipc s10 519524
-mulhu s0 t3 s8
-slt s3 a0 s11
-andi t3 a6 -921
-xori s3 s9 -876
-auipc s7 824378
-addi a6 s2 667
-addi t4 t3 -1792
-add s9 t0 a7
-rem a3 s3 gp
-auipc s5 51971
-srl s1 t3 s11
-xori s0 s5 -1446
-mulhu a4 a4 t0
-slti t6 x0 152
-div tp x0 a4
-and a3 a2 t0
-or s6 a2 a2
-mulhsu s0 s10 t0
-mul t3 s2 a6
-andi s0 t2 -302
-sra s1 s3 s8
-divu tp ra t0
-sltu t5 t3 s2
-or s1 s8 s9
-addi a3 s1 -1108
-mul a3 s9 a0
-remu s1 a7 s0
-sltiu t6 a7 1513
-slti s9 x0 -1314
-div x0 s0 s3
-mulh s9 x0 s4
-srai a2 s7 21
-sra a2 gp ra
-mulhu t3 a2 s11
-rem a5 s2 s9
-slli s5 s8 10
-srai tp a0 3
-div s2 s4 a0
-andi s8 a4 -1771
-mulhu t6 s1 s6
-sltiu a4 a7 1437
-div s11 ra x0
-mulh ra s11 t0
-mul a6 a6 t6
-slt s6 t4 s2
-slli s8 s0 20
-remu t3 s5 t3
-rem a1 t4 s7
-mul s11 x0 s11
-add a4 t6 s8
-sll a1 a3 x0
-mulh a4 s5 s2
-srli t0 a2 30
-remu s3 tp a4
-xori tp t2 2038
-sub t1 a4 t5
-sra a6 a6 gp
-srli s3 s1 14
-add a2 t4 a0
-srai t2 tp 31
-or a7 a6 s10
-and t4 t3 s4
-rem s7 a2 t0
-sub a5 a6 a2
-srli a5 tp 0
-sra a4 t3 a3
-remu t3 s2 t1
-xori gp t0 -202
-sltu s6 t4 s1
-srai a5 t0 21
-addi s8 t6 -1474
-mulhsu a7 gp a6
-mulh t0 s1 s0
-srai s0 s2 4
-mulh tp s9 s3
-ori t1 s9 -1968
-sltiu a4 a5 -1456
-remu a3 a5 a2
-srl s2 s3 s7
-or t5 t3 x0
-auipc a0 556764
-auipc t3 79502
-remu s10 t4 t4
-ori gp t4 1572
-slt s2 a2 tp
-srli s3 t3 28
-and t5 t0 a7
-ori s10 s0 167
-mulhsu t4 s2 t5
-andi s8 x0 -558
-srli a6 s2 14
-slli a6 a4 8
-srl x0 t0 a6
-sltiu s6 s5 0
-sll t1 a0 a7
-sub a7 s8 s10
-divu s7 s10 s8
-srl s8 t1 t2
-add s8 a2 s1
-rem s9 t2 s2
-sra t5 a0 t1
-addi s2 tp 1340
-sub x0 s3 s4
-add gp s6 t4
-auipc s4 395723
-divu s9 t6 t3
-sltu a1 a4 s3
-andi x0 t5 -1042
-div t3 s8 s8
-or s10 s2 s10
-div a6 s0 t4
-srai s3 a5 18
-mul s11 s9 s7
-remu s10 s4 s10
-mulh t1 a5 s3
-rem a3 t0 t5
-xor s6 s11 a5
-sra tp s4 s3
-slt t3 t1 s5
-remu s2 a4 t1
-sltu t3 x0 s6
-add a7 x0 tp
-remu t5 s3 s2
-ori t4 a3 -429
-and s9 s2 a5
-and a0 s2 s0
-slli s9 t0 16
-and a6 x0 x0
-mul s11 s8 s10
-xori a7 x0 -2000
-xor s1 t6 ra
-ori s5 s11 1813
-mulhu s2 t0 s8
-mul t0 a5 a0
-ori s5 s3 -487
-rem s2 s9 a3
-remu t3 a1 t0
-slt x0 a2 t2
-auipc t4 667967
-div s6 t3 gp
-xori s8 a1 -1967
-slti s7 s1 -977
-sltiu t1 s8 59
-slt x0 s1 s8
-div a7 s4 s8
-or t2 x0 s3
-auipc t4 591806
-srai s7 x0 31
-mul s6 s2 t1
-xor tp a3 t3
-rem s5 s6 x0
-ori a3 x0 -1583
-sltu x0 a0 a3
-and gp tp a5
-sub tp ra s3
-srli t4 t1 19
-sll s1 x0 s10
-addi s7 t5 -327
-rem s1 t4 t5
-mulhsu t3 ra s5
-addi t1 a6 -34
-xor s1 s6 t2
-addi s10 s2 -1352
-sll x0 s3 s1
-remu s0 s7 s4
-rem t0 s9 s7
-lui ra 369869
-sll a1 a7 t0
-mulh s7 t5 s3
-sra tp s1 s7
-rem a7 t1 s6
-xori t5 a1 -290
-sltiu x0 a6 461
-mulhu s6 a2 t4
-add s8 tp s6
-rem s3 s11 t3
-add t6 s8 s8
-auipc a1 967388
-add a1 s9 t0
-slt s5 s2 a0
-rem s0 a7 s6
-sra t4 t3 s3
-div a4 a5 ra
-rem s3 s5 s6
-slti t0 s10 -458
-mul s1 s10 t4
-xor a3 t4 s2
-addi a4 a6 -179
-addi ra a7 357
-mulh a6 t6 a5
-slti x0 s11 -1982
-mul s11 a4 s3
-slti a1 a7 1459
-auipc s1 308104
-addi a1 a1 -418
-mulhsu s4 t3 a7
-rem a1 s3 a1
-or s5 s2 s1
-rem s2 s4 a6
-mulh a7 x0 t1
-slli s11 s10 18
-rem s9 t2 a5
-lui s8 824583
-xor s11 t6 a5
-sltiu s5 s0 -252
-mulh x0 a6 s7
-mulh s5 x0 s1
-slti t3 t2 -633
-add t1 t1 a5
-sltiu a5 s0 -520
-slti s8 x0 -194
-slt a2 a1 t6
-sltu t3 x0 s5
-xor s10 s6 a5
-sltiu s4 t5 -3
-slt a6 a7 a1
-slti s2 s1 -1467
-mul a2 ra a6
-srai s10 t1 25
-add t0 s8 a7
-add s0 a6 s1
-lui t1 192396
-andi a5 s10 -1903
-slt a4 s11 ra
-rem s8 s11 a6
-mulh s8 s7 a4
-sra s3 a2 s9
-sll s9 s9 s8
-and s10 t3 s10
-mul s4 gp ra
-ori s11 s7 1721
-sltiu s9 s0 1453
-andi a0 s3 -1047
-or a6 a3 s4
-mulh ra s0 t3
-divu s0 x0 s9
-srl gp x0 t4
-lui a1 447748
-mul t2 x0 a0
-sub s1 s5 s5
-slt s6 t2 x0
-ori t4 a3 -1248
-divu gp s7 tp
-xori ra s5 30
-srai s4 a6 28
-sll gp s10 s8
-or a4 s5 a6
-slt t5 ra s8
-srli a0 a6 16
-mulhu s10 a4 t5
-remu t6 s1 s8
-mulhsu s6 a1 x0
-srli t2 s11 17
-add a2 s11 s4
-slti s1 s3 -1630
-srai s3 s8 17
-rem a3 s5 s11
-ori s6 s7 -993
-sltiu t2 t2 -540
-lui t5 288484
-mulhu s5 s7 s9
-auipc a7 183045
-slt t5 t5 tp
-sub tp s7 a6
-add s6 s1 a3
-sll a5 t3 ra
-sra s5 s4 t2
-sltiu s2 tp -1799
-slt t0 tp a7
-sub x0 t2 s11
-slli ra s10 13
-divu t2 a2 a7
-rem s3 s10 a4
-lui s9 944604
-slt a6 s8 a0
-and s6 s10 a2
-sll gp s2 s0
-auipc s0 255426
-sltu ra t2 s10
-srli s5 a3 14
-slt a2 ra s11
-slti s0 s0 1258
-or s11 s3 s0
-divu s7 x0 a3
-slli s8 t0 29
-sll s10 a6 a0
-div s3 s8 s4
-srai t5 x0 16
-lui s3 877680
-and t1 t2 s8
-srli t3 a4 29
-divu s6 s10 a6
-sra t4 t6 a3
-mulhu s9 t1 a6
-xori s11 s4 -350
-rem t6 s1 s4
-and t4 s6 ra
-rem t2 a2 t2
-srl t1 t2 s11
-divu s4 ra s3
-srai t4 s5 11
-srai ra x0 23
-lui s5 658302
-divu t6 a4 a6
-sltu x0 s4 s4
-remu x0 x0 a1
-srai s1 a0 1
-sub x0 gp s7
-ori a2 t0 -1763
-xor t0 t5 a6
-mul t0 a3 s9
-sltu s8 t1 s2
-sltiu a5 s0 -575
-slt s4 a4 a4
-xor s1 a5 t3
-rem t6 t4 a4
-srai s8 x0 3
-divu t3 s6 a0
-xori t3 s7 -2030
-srl a2 a1 a6
-addi t4 a0 -1014
-srai a2 s8 22
-slli s8 a6 5
-sub t2 a3 x0
-divu t5 x0 a5
-div t3 s11 t0
-mulhsu ra a5 s9
-sub t1 a4 tp
-and s5 t5 x0
-or t6 x0 s5
-andi a4 s6 632
-div s0 a2 s5
-sra gp s7 s4
-div a2 s8 s9
-sll a5 tp s4
-divu s6 x0 x0
-div s1 s10 tp
-lui a7 115968
-ori a0 s10 1205
-srl s1 a7 t2
-xori s10 s3 -1185
-andi t0 a2 -889
-remu gp t4 s9
-slt s6 a0 s4
-xori a3 x0 1929
-div a4 x0 s2
-slt a6 a6 gp
-sltu ra t4 s8
-or s1 a6 a6
-remu s6 s3 tp
-srai s11 x0 31
-xori x0 s0 -224
-srai tp s4 2
-or t5 ra t0
-mulhsu a5 t0 tp
-xori a6 s6 -570
-addi a3 s10 -414
-xori s1 a7 -12
-and a1 x0 s3
-mulhsu a2 a4 t6
-mulhu t2 a5 t3
-remu x0 a0 a5
-sltiu s2 t2 -621
-xori x0 x0 266
-sub s5 t1 s11
-lui s6 787374
-auipc s6 577266
-srl t0 s6 t1
-xor t1 s2 x0
-xor gp t1 s10
-slti s4 a1 -1692
-mulhsu gp s9 s9
-andi s6 s6 -24
-mulh ra a3 gp
-mulhsu x0 s7 s0
-lui a6 381009
-mul a4 a6 s10
-remu a2 s9 t0
-xor s7 s4 t3
-slt a6 t6 a0
-sra x0 a5 a0
-xor s1 t2 s0
-sub t5 s5 s3
-and a3 a7 s9
-sra x0 t6 s0
-lui s7 178789
-slli a7 s0 22
-lui s8 523255
-remu s10 a7 t4
-sub s6 t4 gp
-slli a4 s0 16
-andi a1 s6 -1516
-and s6 a2 a1
-slli s11 gp 22
-srai s0 t5 15
+div a3 t0 s8
+srl t6 t3 x0
+sra ra s8 a7
+ori t1 tp 730
+remu s0 s5 a6
+rem s10 t4 a1
+andi t0 s5 -898
+srli t0 t3 4
+div s6 s4 s1
+andi a1 s8 -18
+slli s6 t0 17
+mulh t6 a5 gp
+sltiu t3 t0 -2043
+div t2 a7 a4
+divu a5 tp t0
+xori s0 gp 280
+lui a5 53436
+and s8 t1 a1
+srai s10 s9 6
+sltiu s6 a7 586
+sltu t6 a4 s9
+sra s1 x0 t4
+lui t5 315277
+and s5 t3 t5
+ori s6 s6 -583
+mul t2 s3 a6
+add s0 s10 s9
+slli s3 a3 22
+slli a0 t3 29
+xori t4 x0 -554
+srai t2 s5 3
+or t3 s2 t2
+srl tp a0 t3
+divu x0 gp tp
+xor t1 s10 a4
+sub a0 s10 a0
+sub a0 tp t1
+divu s11 s1 tp
+sub t1 t1 a6
+sll s1 t2 x0
+mul x0 a0 t5
+srai s3 t6 15
+rem a2 s7 t6
+or s2 s3 ra
+xori a6 a0 -1124
+and a2 x0 gp
+sltu s7 s0 t6
+mul gp a2 a3
+andi a0 gp -1718
+slli s0 s9 31
+or t5 tp t6
+addi t0 a1 1104
+srl s0 t2 gp
+rem t6 t6 a1
+mulhu s9 a3 gp
+sll a2 s10 s11
+ori x0 s4 1026
+slli a5 ra 1
+srl t0 t2 a4
+rem s1 x0 t1
+slli t5 t5 25
+xor s10 t2 s8
+slti s9 a0 -1922
+mul t1 x0 s5
+srai gp tp 25
+sltiu x0 s5 -1210
+rem s11 s6 s4
+mul s11 s0 t1
+slti s3 a5 589
+srli gp gp 18
+auipc a6 1030143
+slli s2 x0 14
+lui a1 701264
+srli t4 t5 25
+mul s7 ra s3
+and s4 s9 s7
+and x0 s6 t5
+auipc a4 331105
+xori s1 a0 -1510
+sltu s3 ra t5
+mulhu a7 s2 gp
+srl s6 s8 a0
+andi x0 s5 -60
+and t5 x0 s4
+sub s4 t4 s8
+add s0 s3 x0
+andi ra a5 -1311
+srai t2 a0 22
+ori t1 s5 -181
+xor x0 s9 a7
+sll a6 s2 t3
+mulhu s3 x0 a7
+xor a6 t3 a2
+xori t5 s10 -821
+lui s4 26064
+srl t5 x0 x0
+mulhu s7 t5 a7
+srli a5 t1 12
+slti a3 s7 -1158
+srl s1 t4 t3
+mulhu s4 s8 s3
+xori tp s5 -1345
+mulhu a1 s8 a1
+slli a6 t2 18
+slli s5 gp 25
+and tp a7 s6
+andi s11 t1 -681
+div a3 x0 x0
+sll gp a1 a3
+div s0 gp ra
+div a1 s11 x0
+sltu a7 t2 s4
+and s1 s11 t6
+remu tp s6 t1
+addi a1 t2 1696
+slti s8 gp 1158
+div x0 t0 x0
+remu s1 t4 s4
+rem t5 a2 gp
+xori s6 s8 -964
+srl a4 s3 t6
+div a1 t0 s0
+sra a7 t4 s9
+lui a5 499976
+srl s5 ra s0
+slt s8 s10 s1
+sll a5 gp a4
+xor t5 s5 a1
+sll t5 s7 t6
+slli t4 s6 13
+srli a2 a7 17
+slti s4 t1 -1626
+divu s3 t2 gp
+sltiu a5 s3 -365
+xori t2 s1 594
+ori t3 s5 -486
+add s5 a2 a5
+mulh s3 s7 t2
+sll s2 s4 t6
+mulhsu s11 a7 a6
+sub a1 s8 s11
+rem gp s8 t3
+or t6 a2 x0
+mulh a5 s4 a4
+xor t1 s4 x0
+mulh s6 s7 s4
+xori x0 a0 -1564
+sub t0 s1 s3
+divu t1 a1 s0
+addi t5 t0 -1702
+mulhu a7 s10 a2
+srli s4 s7 24
+divu s2 t5 t1
+rem s0 t3 a1
+sltiu s10 s11 -441
+or x0 t1 t4
+remu t2 ra ra
+add t1 s1 t0
+divu t2 ra s10
+ori a5 t6 -720
+slt s9 s4 s5
+remu s7 t6 a7
+sll gp s11 s1
+srai a6 s10 30
+add tp t5 s8
+sltu a5 a4 t2
+srai t0 t4 5
+mulhu s4 t1 s1
+and t3 t3 t5
+srl s5 s7 x0
+slli s7 ra 8
+sltu s9 s4 ra
+add t3 a0 s9
+remu t4 t3 t1
+addi s1 t4 -838
+auipc a5 809728
+divu a3 a7 s1
+and s8 a7 s8
+srli s11 x0 4
+div s7 a6 a1
+sll s4 a7 s7
+sltu t6 gp ra
+mulhu t0 s3 s3
+andi t4 a0 -61
+srli s5 tp 0
+or t0 s7 t1
+slt t6 x0 s4
+sltiu tp t3 1550
+sltiu a6 s2 1232
+slli a7 a1 16
+slt s5 s4 t3
+slti gp a0 -953
+andi a6 s9 635
+srai s6 a1 24
+slt a5 a3 x0
+remu t5 t6 a1
+sltu a6 s10 t0
+sub s5 a1 s4
+sltu t1 s9 a6
+srai a6 t0 22
+div s0 s8 a2
+addi s4 a4 1546
+sub s4 t1 t6
+sll a3 s0 gp
+remu gp t6 t3
+sll t4 x0 a6
+addi s5 s1 -1439
+srai a3 t0 14
+mul t5 s2 t3
+ori s4 a0 460
+or s8 s5 t6
+mul a0 a7 t3
+slti s0 s10 -1266
+slli t6 gp 15
+or t6 a0 t0
+and a0 a4 a4
+or s5 s5 a3
+addi tp s6 584
+or t4 a6 t1
+slli s7 t2 21
+slti a2 a4 1519
+srl s6 s2 t1
+xori t1 a3 2021
+slt s6 s0 tp
+mulh s5 s1 t1
+mul s5 tp s6
+div x0 a0 s0
+srl ra s0 s2
+sub s4 a4 x0
+auipc s9 298227
+mulh s7 a5 s3
+xori s8 t6 -1722
+auipc s6 879625
+auipc t6 158044
+and s0 s7 s4
+srl t4 s8 s4
+addi x0 t3 -758
+sub s9 a4 a5
+auipc s8 875559
+srl s11 t3 a4
+mulh s4 t1 s6
+and a4 a6 t2
+sltiu s2 a0 -65
+addi gp s2 -564
+div s5 t0 s8
+auipc t0 281443
+auipc ra 1007534
+auipc a7 851917
+sll s7 a7 a7
+mulhsu a2 a0 s3
+and gp s10 t3
+rem t6 t1 a2
+and s11 a3 s3
+div t2 a4 s5
+sra t4 a3 gp
+sub tp t3 s3
+sll a0 t1 a3
+and s7 tp a4
+sltiu s10 t6 953
+mulhu a5 s11 a7
+mul s2 x0 a3
+srl t1 ra s11
+lui s0 12595
+addi gp t0 -373
+mulhu s8 a6 s2
+srli a2 t4 25
+slli s9 a5 20
+addi s7 t1 -47
+slti t5 x0 -1292
+remu tp a7 a2
+slt s0 s1 s7
+sltiu s11 s6 9
+srl t0 s8 s11
+rem s11 a1 s3
+mulh a4 ra t3
+slt a5 x0 a7
+rem s3 a4 a2
+mulhsu ra a2 s8
+srl x0 s0 s10
+rem x0 s5 tp
+srli s7 s10 0
+srai a2 s9 22
+mul s5 ra s0
+div a1 t6 t6
+slti a3 a2 -324
+rem a2 a0 a6
+sra s3 s6 a6
+addi s10 a0 -1234
+remu a6 t1 s8
+lui gp 309462
+srli a6 x0 6
+mulhu t2 t3 t6
+mul s7 x0 t0
+auipc s4 202747
+add t5 t0 t2
+sub x0 a1 t6
+mulh s2 s6 a5
+rem s8 t1 ra
+rem t5 a7 a2
+srl t0 t3 a4
+slti t3 s0 -649
+sltiu x0 tp -1062
+mulhu t6 t0 t3
+rem ra t5 s5
+sll tp s10 s1
+add a6 s11 x0
+lui a3 906336
+divu t3 tp s10
+sltiu s9 gp 1968
+divu s9 a3 t3
+or ra s10 ra
+mul t4 t4 s6
+and t1 s4 a3
+slti s3 t2 1510
+srl s3 t5 a1
+srli ra s4 12
+xor x0 s6 s8
+div s2 a0 s7
+div tp s6 s10
+mulhu s6 s2 t4
+sltiu s10 s10 -666
+sltu s8 x0 t3
+add a3 a2 x0
+sltiu a0 x0 -1842
+slli t0 s11 18
+mulhu a7 s5 s9
+auipc t0 133507
+mulhsu a5 tp a6
+andi t2 s11 -603
+addi s1 tp 1402
+mulhu s5 s4 gp
+addi ra t4 245
+div a6 s8 t4
+xor s2 t0 a5
+div a4 s7 a1
+sll t5 s3 s7
+and x0 s11 t5
+srl s1 s10 a0
+srl s6 t1 s8
+add a0 a7 ra
+remu s2 s3 t3
+slt t4 x0 t4
+mulhsu x0 s7 t6
+mulhsu t5 x0 t1
+mulh a0 tp s4
+lui x0 143871
+remu a7 t5 t1
+xori s8 s3 211
+or x0 a5 x0
+xor t3 t5 t1
+slt t5 s11 a4
+srli t4 a0 2
+andi t3 x0 438
+addi s0 s0 1460
+andi a3 s11 -1979
+lui gp 498177
+addi s5 s10 1822
+srl s9 s1 s1
+and t3 t4 s11
+srai s10 s5 14
+xori ra a3 -6
+addi s3 tp -306
+addi s6 s2 971
+ori a6 x0 1751
+slti s7 s3 -738
+auipc a2 108711
+mulhu s7 s2 s2
+divu t4 x0 t1
+sra s10 a6 s9
+addi s8 t6 1638
+remu s3 s2 t1
+auipc s10 917587
+andi t6 s9 -1717
+srli s9 s6 9
+ori t6 s5 -927
+slt ra s11 t1
+mulh a0 x0 a4
+sltiu t3 s0 538
+addi s9 t3 -1700
+sll a4 gp a5
+sra t0 s10 tp
+srl a0 t5 a3
+add t6 a7 gp
+slt x0 gp a0
+slti a4 s11 -889
+srl t0 t2 s4
+mulhsu t5 a5 t5
+ori s3 ra 1425
+add s2 a0 t3
+lui a3 1026528
+or t0 s11 s10
+mulh a5 s4 s10
+sra x0 t1 t2
+sltu s11 s1 s9
+sll tp s5 s9
+mulh s1 s5 t3
+or t3 t6 a3
+mulh ra a5 a3
+sll x0 tp a5
+mul tp s10 t2
+slli t5 s4 0
+rem t6 a6 t5
+sll s3 s9 s3
+xori a3 gp -1771
+remu a5 s6 t3
+xor t0 a2 x0
+mulhsu t5 s6 t3
+srl t0 s7 s1
+divu a3 tp t1
+add a3 a7 x0
+sub a4 tp t0
+sltu s0 x0 s3
+auipc a0 543481
+rem s2 a1 a4
+divu t4 t2 s2
+add t3 s9 s9
+mulhsu a0 a5 t2
+auipc t5 505314
+auipc s3 787695
+slli s9 s9 0
+add s1 t6 ra
+div gp a6 x0
+and a4 t4 s4
+add s2 t5 a3
+srai x0 tp 2
+rem s3 s3 s10
+sltiu gp s6 -502
+mul ra t3 gp
+addi s9 a0 110
+auipc a5 806463
+and x0 s4 s11
+sra ra s2 a6
+sub s0 s10 t3
+xori s4 t1 -340
+rem t2 x0 a5
+slti a5 s11 -1931
+divu t0 t3 s6
+xori tp s6 -67
+srli a2 s7 23
+and s9 tp a4
+srl x0 s10 x0
+mulh s4 t3 s4
+div s7 s6 s8
+add s8 s1 s10
+or x0 t0 a4
+andi t6 a0 2010
+divu t2 x0 a1
+mulhsu a2 x0 t6
+div a4 s6 s4
+srl a4 t0 a4
+lui a6 56258
+andi gp t6 -1742
+ori s7 s6 1947
+auipc s11 636189
+slti s7 s2 -493
+andi t6 s8 -1772
+addi s1 s1 -1116
+sltu tp tp a5
+mulh a2 a6 t1
+srl s10 s5 a5
+sra s6 s6 s8
+mulhsu ra a3 a3
+divu t1 t5 t6
+sra a6 s0 a5
+rem a4 ra s3
+slt s3 s3 ra
+sub t6 s3 t3
+auipc t2 170058
+slt s0 t4 x0
+srli x0 a4 31
+mulhu a2 s4 a6
+slti a4 x0 1693
+sltu t0 t2 a0
+slt x0 t3 a5
+mulh s10 t4 s6
+xor s11 s4 t3
+slt t5 x0 s1
+ori s3 tp 1982
+slti s2 t1 -399
+sltiu s0 s5 -1160
+div s3 a0 s6
+sltu s2 s1 s10
+sra a6 tp s0
+sll t1 t5 s1
+div s11 s5 s5
+andi s0 s7 1499
+sra x0 s5 s8
+rem s11 x0 t1
+sltiu s1 s0 -674
+rem a1 a0 x0
+addi t2 s7 292
+divu t3 s10 s8
+rem ra s10 a1
+mulh s6 s7 x0
+auipc gp 436907
+sub t2 s10 t5
+slt s9 s3 s1
+srli s2 t5 23
+lui s6 529341
+divu a2 s2 t0
+addi gp s3 -1612
+sltiu s1 x0 1934
+srl t0 t4 t1
+xori s2 t5 -641
+xori t4 a2 -22
+slli a0 a1 6
+xori t1 a5 -1711
+xor s1 s10 t4
+sltiu a1 a2 -903
+andi t5 a2 -1896
+and t1 a1 s4
+remu x0 s11 a6
+addi t0 t1 1515
+or s4 t3 a2
+slt a3 s8 s6
+addi x0 ra 240
+slt s5 x0 s4
+sra t3 s1 a6
+xor x0 s9 t4
+divu t5 s10 t2
+srl s6 a7 s4
+sub s5 tp s9
+div s3 a2 s11
+rem s11 a3 tp
+mulhsu x0 s3 s9
+sltu a4 ra s0
+and s2 a2 s10
+srai a1 t2 17
+ori s9 s9 -1901
+xor a6 s9 a0
+mulhsu s11 s5 a3
+rem s5 s7 s4
+sltu a1 s10 a1
+slti gp a6 2023
+ori s3 t2 -1869
+div a2 a0 gp
+srai gp a1 5
+add s11 x0 s5
+mulhsu gp ra x0
+mulhsu s10 a7 t1
+auipc a3 857384
+slli a2 ra 10
+divu t0 a4 a7
+mul s7 t5 t3
+and gp s1 s2
+ori s11 a4 -1347
+mulhu a4 a7 t0
+sll t2 ra s5
+add x0 t6 a6
+div a5 a3 s3
+sltu a7 t6 s0
+mul t2 t1 s6
+mulhsu a3 s2 a7
+mulh s1 a3 s0
+divu s8 t0 t4
+or s1 t3 s6
+sltu t5 t4 a5
+div a6 s3 a5
+or t1 t0 a6
+sll a0 s2 t5
+add s2 t4 ra
+slti ra s4 1717
+add s6 ra s4
+divu t5 t4 s1
+sltiu a5 a6 -1932
+div s6 s3 s9
+and s5 t3 s7
+srli s9 a3 0
+sra s2 s2 s3
+addi s10 a7 -1101
+slti s9 x0 -941
+and a7 s2 a7
+srli a6 x0 27
+addi t1 s4 1644
+slt s1 t2 t2
+sra s8 s10 tp
+sub s9 s2 t3
+lui a7 625537
+mul s9 s3 s2
+mulh s1 s10 s9
+mulh x0 tp a7
+sra gp s7 t2
+auipc s8 37726
+srli s6 t6 24
+or a3 tp t3
+mul t0 gp t0
+lui t0 992218
+slli s6 t4 15
+sltiu t4 s2 423
+srai s0 a3 28
+srai ra tp 0
+sll t3 x0 s5
+slti ra a7 -482
+sltu a6 t2 a2
+xor gp t6 s4
+remu s3 a0 a6
+divu a2 x0 s9
+remu x0 s7 s6
+slti a1 a2 -229
+sub s7 t0 a4
+and ra ra t1
+and s4 a1 a5
+mul a3 s3 s5
+sub s5 gp s1
+and a5 a5 t3
+srli s0 s11 22
+mulhsu tp gp s9
+sltu t6 s3 t4
+add s1 a5 s9
+divu t3 t2 t4
+and s9 ra s6
+remu a3 a7 t0
+mulhsu t2 tp s9
+and s10 a6 t0
+mulhsu s3 x0 s4
+and x0 a5 s8
+slli x0 a4 26
+srli x0 t3 21
+sll a5 a7 t5
+srl s8 t3 a1
+srai s7 gp 4
+xor a3 t2 s9
+andi ra s4 -1599
+remu s0 s4 a2
+sll s11 a6 a4
+mulhsu t6 s1 gp
+slt s5 gp s0
+sltu a5 a0 x0
+sltiu ra t2 -752
+slti t0 s0 1417
+lui s5 812624
+mul s3 s4 s8
+srli a1 t1 15
+srli a5 x0 26
+xor t2 ra t1
+remu a7 x0 t5
+mulh a6 s10 gp
+sltu t3 s2 s1
+and a3 a4 s1
+srl s2 t4 s3
+mulhu t2 t0 s5
+sub s4 s0 a5
+xor tp t3 t0
+sll s9 a7 t2
+auipc x0 117041
+slt a2 t3 t1
+addi x0 x0 -360
+srli ra a4 1
+sltu a6 s5 s2
+auipc t1 126558
+sltu t6 tp a0
+addi gp gp 777
+mulhsu x0 a6 a6
+div x0 t2 s10
+mulhsu a6 x0 a1
+srli t5 t3 18
+srai s7 t0 28
+auipc s3 401695
+sltiu t6 t2 -1157
+mulhu t1 a2 a4
+div a5 a3 t1
+sra s6 s6 s2
+andi a3 x0 1148
+remu t4 tp s8
+div a2 ra t0
+slli a0 a1 18
+div s9 t3 tp
+mulhsu tp s10 a6
+srl x0 t5 a1
+slt s4 t1 t1
+mulhsu s1 s5 s6
+sll s5 a7 s4
+sra a5 s1 s0
+mul s6 s2 s10
+mul s10 gp a5
+xori t6 gp -1747
+sll t1 s0 a6
+add t2 s7 s10
+mulhu ra a5 s8
+rem a1 gp a1
+sltiu t6 t0 -130
+or t4 s11 s9
+mul t2 t5 s0
+srai t0 s5 17
+slt s0 a5 s1
+sltiu s7 s2 1111
+or t6 t4 gp
+mulh s5 a1 s3
+div gp s11 tp
+xor x0 a1 a0
+and s0 s9 ra
+srai t1 a2 11
+ori s6 t3 260
+mulhu t4 s8 s1
+srli a6 t4 25
+sltu s3 a7 t6
+or ra s2 a7
+or a4 a0 s10
+sltiu a3 t5 1643
+slt a7 t4 s5
+xori gp s9 -1820
+or s2 t2 s3
+addi a2 t3 1425
+mulhu gp x0 a3
+mulh t4 s8 t0
+divu s6 a1 a2
+sltu gp t1 t4
+mulhsu t3 t6 gp
+andi a0 s0 -1135
+srli s5 a0 31
+mul s4 s7 s2
+or gp t6 ra
+sll s5 s1 s11
+addi s2 s9 -1301
+sub s11 s1 a4
+add s10 t2 s8
+add a5 s10 t2
+andi t5 t1 -1355
+div s7 s11 x0
+add s8 s5 s4
+divu t1 tp s8
+sra t3 s9 s11
+andi x0 s4 1653
+srli s8 s1 1
+andi a1 s7 -800
+sltu s4 a1 s10
+divu s10 a0 tp
+sll s5 a0 t5
+sll s0 a1 gp
+sll s8 s5 gp
+sra s7 ra a2
+sub s7 tp gp
+xori s4 t3 1042
+mulhsu s1 a3 t6
+mulhsu a4 t6 a7
+andi t2 x0 -1192
+remu tp t3 gp
+andi a4 a0 -347
+sltiu t3 a4 -1151
+divu t1 s6 gp
+xor s10 a1 a6
+slli s10 s0 16
+div s1 t1 t1
+slti t4 s2 -724
+slli s6 t0 12
+divu s1 s5 t1
+ori a0 tp 228
+addi x0 ra 1485
+slt a0 x0 a2
+or t4 a3 a2
+ori t1 a0 1226
+slti s7 a6 -1588
+mulhu t1 x0 a3
+lui ra 339370
+lui s0 654540
+sra ra a7 a4
+slli s1 a1 27
+div a1 tp s10
+addi t2 t6 -1212
+andi gp t0 -162
+rem s2 a3 a0
+auipc t1 706002
+and a6 t6 a3
+div a0 a3 x0
+rem x0 t3 t0
+sra a0 s7 a2
+slt s6 x0 s5
+xor a3 t3 a2
+div s3 a6 a0
+auipc t5 988636
+srli t5 a2 24
+div a4 s7 s5
+mul t5 x0 t3
+sll t2 s8 s11
+div a3 a0 t1
+mulh a6 a1 a2
+slti gp gp -1128
+sltiu s7 a0 -1146
+sll s4 s4 a2
+add t3 s1 a5
+auipc s7 928267
+srl t1 s6 x0
+srli a7 a4 7
+srl s9 s9 t6
+rem s10 a5 a3
+remu a5 s3 s6
+mulhsu s7 t2 s0
+rem s1 a5 ra
+srli s11 s6 15
+srl t5 s5 tp
+sltiu s1 a4 244
+sltiu a1 ra -1632
+ori a1 s7 -353
+remu s10 x0 x0
+divu s8 ra a3
+divu s7 s11 a4
+and x0 a4 t5
+slti x0 a4 -1103
+ori s5 a4 -792
+mulhu s5 s1 a4
+sub gp a0 a5
+divu s7 s10 s0
+mulhsu a0 t4 s6
+srli a1 t5 25
+lui s9 684137
+mulhu s11 s8 s1
+sra s4 a5 s2
+addi s0 t6 1011
+srai s6 a1 28
+mul gp s4 s2
+mulh s6 gp t1
+xori a4 a4 -916
+srli t0 ra 16
+sltiu s3 gp -1423
+xor s7 s2 a7
+sltu a1 x0 tp
+srli s3 t5 10
+slli s3 gp 3
+divu s2 a0 a7
+sll a7 t5 a7
+sltiu t2 s8 -940
+mulhsu x0 x0 s2
+addi s9 s7 -347
+mulhu a3 t2 s3
+remu x0 s9 t6
+ori a6 a5 1836
+sra t1 a6 s2
+rem x0 x0 x0
+srli tp a5 6
+mulhsu s3 ra t1
+xori x0 s5 1748
+slt s9 x0 t1
+slli t2 s5 7
+auipc s3 330650
+lui a7 1045715
+slt s3 a3 s8
+mulhsu a4 x0 t1
+andi a0 t2 -1551
+sll t0 t1 s8
+srai s4 a1 11
+slti s7 a2 877
+mulh a3 x0 a0
+sll s1 t5 t0
+sltu s9 s2 t5
+or t6 s10 s0
+remu a3 a2 s9
+addi s1 s0 -1006
+mulhu s10 t0 a1
+sub a2 s3 x0
+auipc a6 209181
+srai x0 a7 30
+srl a7 s8 s0
+ori a6 x0 -66
+or a1 a0 t5
+srl tp a2 t4
+sltiu t6 s5 -695
+xori a5 t2 -1268
+sltiu s9 a2 -682
+ori t5 s9 -555
+srai a6 t1 18
+xori a6 s7 22
+remu t6 tp s11
+rem tp s6 s11
+rem s8 t5 a0
+lui t3 252941
+lui a4 383503
+mulhsu s8 ra x0
+rem s8 s9 s4
+xori t2 t3 -563
+or s8 s10 s3
+or s8 t5 s10
+add t6 a6 s1
+divu a6 s11 t5
+add s11 x0 s7
+sll t2 s1 s0
+mulhsu s8 a5 s6
+mulhu a7 s2 a0
+sltu t5 t0 t3
+rem s8 t6 s5
+remu ra x0 a7
+add t4 s8 s7
+sra s6 t6 a0
+mulhu s5 gp t5
+mul a0 s10 s7
+xori a7 x0 820
+sltiu s7 t3 -1473
+or s0 ra x0
+div a7 a4 s5
+lui t2 668553
+div gp a2 gp
+sltu a5 s6 s10
+sra a3 a4 s8
+rem s11 s0 a1
+srli s4 a5 7
+slli s7 t1 4
+add a7 s7 s8
+mulh s10 s1 s5
+xori s9 t2 62
+and s10 t3 s3
+add t4 a6 s8
+sra a5 gp x0
+lui t3 198684
+sub x0 t4 s1
+add s2 a4 ra
+slti s10 t2 1569
+srl a7 t0 a0
+slti ra t2 311
+addi x0 a5 -31
+xor t6 a4 a4
+slli t5 a2 4
+remu s5 s5 a4
+mulhsu s11 a5 t1
+sll s10 ra s10
+sll s9 s11 s6
+mulhsu s11 t2 a6
+auipc a7 217759
+slli s11 s1 5
+divu t2 t3 t0
+and s9 s0 s1
+divu s4 s1 s1
+sll t0 a1 x0
+auipc t1 668477
+srli s1 t2 19
+mulh t1 s0 s2
+srli gp a4 24
+slli tp a3 22
+slli t2 s9 20
+andi s10 a7 939
+auipc s11 544808
+divu x0 a1 s2
+sll s11 t1 a5
+andi a6 t1 -240
+andi s1 tp -1346
+srai ra t4 26
+slli s8 s7 19
+auipc tp 678496
+andi a4 a0 -25
+ori x0 a0 -1922
+xor a2 t0 s10
+divu s11 t4 s6
+ori a2 s6 1100
+lui tp 1010622
+lui a3 704610
+xor s7 a4 t3
+xor a2 s8 a3
+ori t5 s10 611
+mulhu x0 t5 s7
+sltu x0 t3 x0
+slt t0 a2 t1
+sub s1 s11 a2
+or s8 x0 s0
+mul s5 s3 t1
+div t6 x0 s11
+sltu t1 a7 s4
+auipc t0 384616
+addi s4 s5 -865
+divu gp s0 s2
+mulh s7 x0 a4
+slli s2 a1 26
+mulh t5 a0 ra
+andi ra s6 -1423
+auipc t2 340361
+sltiu t4 s4 -367
+xori s3 s9 1130
+xori s5 a7 -1107
+or s6 s6 a4
+andi s3 t0 1705
+auipc x0 371273
+lui s9 588575
+div t4 t2 a3
+divu t5 s4 s1
+xor s5 t5 a5
+mulh s11 s10 s3
+mulh s1 s0 t3
+mulh a4 s8 a6
+mulhsu t5 a6 s2
+auipc s0 490699
+sll s3 a3 s9
+divu a0 tp x0
+xor gp ra t0
+slt s4 t0 a0
+addi t0 a0 -1670
+lui t4 584585
+srl a1 s1 s1
+mul t1 a5 s8
+ori s5 a1 -1548
+addi s4 t0 -971
+sra tp gp a5
+sltiu a4 s3 -383
+addi t5 s1 708
+mulhsu t6 a0 t4
+sra s3 gp s11
+slli a5 a3 28
+mul a2 a6 s3
+slli s7 a0 19
+sub a2 s7 a6
+sub s5 t5 t2
+and t2 t2 a7
+slti a4 s6 -778
+divu t2 t3 a6
+lui t3 57958
+xori a0 t1 332
+mulhsu tp t4 x0
+srl s11 a4 s1
+srl a3 a6 a6
+rem s4 s2 x0
+slt a5 s6 a2
+sub a6 s6 a0
+srl a2 a2 t1
+sltu s8 s6 s1
+xori gp s10 -1275
+slti a7 s10 1180
+slli s11 t3 15
+mulhu x0 s6 s4
+sltu a0 s1 ra
+ori a3 t2 258
+divu s11 t0 x0
+remu tp s10 s2
+sltu t2 t2 a6
+lui a7 395435
+srli s11 s6 4
+addi gp t4 134
+xori s4 s5 1240
+slti a6 a1 1465
+or tp s6 a4
+mulhsu s9 s3 s7
+sltu x0 s9 s5
+ori s4 s0 -987
+sra gp x0 t0
+addi s0 s6 436
+srai gp s2 2
+remu t5 t6 s5
+and s7 s7 x0
+add t2 tp a2
+mulhsu s5 t6 ra
+ori s5 s10 1488
+or s8 t0 a3
+rem t3 t4 s1
+add t1 s8 a5
+addi s5 a0 -887
+srai x0 a4 18
+sll a5 a7 s11
+slti t3 a0 -190
+mul t0 t4 a5
+sra s0 s9 s5
+xor a0 a1 a2
+divu s4 x0 s6
+srl a3 s3 a4
+srli a1 t2 27
+sra s0 t0 s0
+add a0 t0 s7
+rem s9 a3 a5
+auipc s8 121516
+srl a1 x0 t5
+mul t2 t1 t1
+addi s8 a4 1834
+mul gp s5 a5
+xor t1 s1 s8
+srai t0 t0 0
+rem s6 t5 s5
+sltiu t5 t0 -429
+sltu a5 tp s2
+sra a6 s9 a2
+sub t4 s11 s5
+srli x0 t1 11
+auipc s7 605207
+mul gp s4 s8
+sub t2 s3 t3
+mulhu s5 t5 s8
+srli s8 tp 29
+xor t4 gp s8
+and s4 gp a7
+srli t3 s1 6
+srl ra t2 s5
+or a5 s7 s2
+sra a3 s11 s8
+sll ra t3 s7
+slt a7 s9 s1
+sub x0 t5 a6
+sll t2 s3 a0
+addi s11 t3 -907
+divu a6 s2 a1
+sltiu t6 tp -581
+slli t5 s1 9
+sra a4 a5 t2
+slt s7 x0 s2
+srli s8 t0 29
+xori a3 a2 -525
+mulhsu t2 x0 gp
+divu t6 a2 t3
+xori t4 t3 109
+mulh x0 s7 a6
+srli a6 s8 28
+sll t2 s3 s4
+xor s6 a4 tp
+mulh s6 t6 s3
+andi a0 ra -1594
+and a3 s10 a5
+mulhsu a4 s0 t0
+andi s1 s9 657
+lui t4 618827
+rem s3 s0 gp
+auipc s2 160710
+remu a4 s6 gp
+srli s5 s11 29
+xori a4 s3 371
+div s8 gp gp
+div a4 s5 a6
+add tp a5 s11
+sltu a6 t6 s10
+sltu ra a4 s1
+remu t2 a0 s10
+mulhsu t2 s4 s7
+mul t3 s11 t3
+xori t4 s5 -2036
+sltu t4 a6 s1
+srli s2 t5 5
+andi x0 s7 1967
+sra x0 s11 a5
+srai t2 t5 18
+mul a5 x0 a5
+slti t0 t0 -312
+slli a1 a6 31
+sub s3 a4 ra
+sra a5 a2 a1
+or t0 t6 a4
+and a7 s6 t4
+andi a5 t1 -1273
+sltu t6 t3 a6
+sltiu s4 t5 -1589
+slt s2 t4 tp
+rem s6 a2 s10
+srli x0 a0 28
+mul x0 x0 t6
+sltu s3 a4 gp
+sub s9 s9 a3
+rem t3 a2 s0
+rem t4 s11 t3
+mulhsu s7 s0 s3
+slt a7 a2 s6
+slli t6 a7 22
+mulhsu a6 a5 t0
+srli tp t2 14
+srl t0 a4 s3
+andi x0 a3 -1477
+ori t0 t4 991
+sltiu ra tp 489
+slt s11 t3 s0
+slli t4 t2 31
+div t1 t3 s5
+andi s8 t1 1489
+srai t3 s0 8
+ori s5 s0 2037
+lui a3 580922
+sra s9 a0 t3
+mulhsu ra tp a4
+ori gp s6 329
+and t2 a6 s4
+slti x0 s10 -304
+and t1 t0 s1
+sll x0 x0 x0
+add a0 s1 a7
+auipc t5 512374
+srl t2 s11 a3
+xor a6 gp ra
+sll t6 a5 a1
+mulhu s4 t4 a6
+divu a7 x0 s1
+slt t3 a5 t5
+sltiu a3 a0 1880
+mul s11 s10 s1
+srai s5 t6 27
+ori ra t3 -1717
+mulhsu t3 ra s2
+lui t2 570252
+xor t1 x0 s5
+sra s7 t4 x0
+slli a0 tp 2
+rem s5 x0 s2
+sra s2 x0 a0
+divu s6 s0 a6
+srai s7 s1 20
+xor t1 t1 s6
+ori a6 s9 -1676
+divu a6 gp a2
+divu s9 t3 s7
+rem a7 s6 t3
+mul s0 a7 s3
+sltiu s7 s5 -1495
+srli s8 s10 10
+or s11 a6 t0
+srli a0 s1 23
+andi s7 s4 47
+sra s4 ra s9
+sltu tp tp s3
+remu t3 t6 gp
+div a3 t3 a0
+srli t4 a6 31
+srai s7 gp 22
+srl t2 t6 t2
+andi s8 t2 1192
+sltiu x0 t4 -1053
+addi a6 t0 -398
+andi t0 s1 -474
+mul t6 s2 a1
+add tp s0 s5
+add s2 s3 s10
+ori t6 s4 -1732
+srai s9 s10 7
+andi t5 s2 1634
+mulh s1 a5 x0
+lui s3 2626
+remu s8 t2 a6
+div t3 s8 t0
+mulhsu ra a4 ra
+srli a7 x0 27
+srl s0 a2 x0
+mulhsu x0 s3 t0
+divu a7 a2 s5
+divu s11 s0 tp
+divu t1 a6 t4
+xor a3 x0 s7
+mulhu a5 tp s10
+xor t2 s6 ra
+divu s6 t4 s11
+andi s6 t0 -1325
+mulh x0 t0 a4
+xor a3 a0 x0
+mulh s10 a7 s3
+rem ra a3 s5
+mul ra s6 s1
+srai a4 s6 8
+slli t1 t1 10
+andi t6 s6 -385
+lui s5 530162
+div s11 a3 s11
+divu s4 a1 tp
+sub t4 t0 s1
+sltiu s9 a4 -3
+auipc s7 899550
+sltu s11 t2 s10
+xori s3 a5 1402
+sub gp s3 s10
+mulhsu s0 s5 a7
+or t0 t4 a1
+srl ra ra t6
+sub gp ra s6
+srai a7 s11 16
+or t6 t6 ra
+mulhsu s10 tp s4
+ori a7 t3 -514
+xor a2 x0 s4
+sub a5 s9 a0
+sra ra tp t4
+slli s8 t6 25
+slt s6 s2 s10
+xori s3 a7 -1480
+sltiu t5 x0 -1617
+addi a0 s2 -1854
+xori a3 x0 -1017
+sltiu a3 s0 501
+slti s9 a6 588
+mul s2 gp gp
+rem a7 t3 ra
+slti s7 a7 -791
+auipc a7 95489
+slt s11 x0 x0
+mulh s7 x0 ra
+rem a7 ra gp
+auipc s11 935521
+mulhsu s9 a2 t6
+sub a7 s7 gp
+add t0 s5 a6
+sltu t4 s10 a3
+sltu x0 a4 s5
+rem a1 s8 s0
+ori a7 a0 -73
+mulhsu s5 s1 t1
+remu a2 x0 a2
+mul ra s1 a7
+slti s6 a6 399
+remu s11 a6 s7
+or s9 a4 s7
+add ra s3 x0
+mulhsu s6 a5 s7
+andi t1 a7 397
+div x0 a5 s2
+srli s6 a5 6
+xor a0 t5 t6
+mul s2 s11 s10
+rem s1 s5 s7
+auipc ra 96446
+ori s7 s8 1553
+addi a3 t4 -274
+srli t4 t2 11
+mulh a3 a0 tp
+auipc t3 386672
+mulhu a6 ra t2
+sub s0 s7 gp
+remu s4 t6 t6
+mulhu s8 a6 s4
+ori a2 tp -1915
+or t4 x0 a5
+srl x0 x0 t4
+xor s7 t1 t4
+sra s2 gp ra
+sltiu tp x0 -323
+and t6 s2 s9
+andi a3 t0 -287
+srli s2 t2 16
+sltu s10 x0 s9
+add s6 s3 s0
+div ra s3 s11
+srai a0 x0 19
+add s9 a1 ra
+andi a0 s3 1261
+slli gp x0 13
+srli s11 s4 6
+addi s7 s11 204
+lui gp 398848
+div x0 tp s4
+ori t6 t0 -154
+ori s10 s2 1408
+slti t4 ra -1213
+srli s4 t6 16
+ori a0 s7 1357
+lui t5 404393
+ori t4 a7 -1945
+mulhu a2 a5 s8
+sltu s8 a4 a2
+slt t2 s9 s2
+srl a3 ra a7
+or tp s0 s2
+sra s3 s2 t5
+sub a4 x0 a7
+add x0 t4 a5
+or t3 t2 s5
+sltiu t2 s9 488
+lui s8 445037
+xori a0 s1 803
+sltu s7 t5 t0
+mul s10 a2 s10
+slli t2 s9 6
+slli s4 tp 7
+addi s9 s10 -389
+sub gp ra t4
+mulhu s4 s10 x0
+add a4 s1 t0
+xor a2 a2 x0
+or t1 s8 s2
+xori tp t2 729
+or s9 t2 s8
+mulh a0 t1 s8
+mulh a6 s7 s6
+sltiu ra ra -61
+sra s2 s3 t2
+mulhu a3 a2 s3
+mulh s11 t0 t0
+srai s7 a7 25
+or s7 x0 x0
+and a6 t4 t6
+xor s0 t4 a4
+andi s4 s4 872
+srai a7 a5 5
+div s0 t0 a1
+srli t2 s0 23
+mulh s1 t1 ra
+div a0 a3 s11
+srli tp a2 6
+lui t3 787427
+ori s8 a5 1288
+mul a4 gp s4
+remu a7 a0 a1
+addi s7 a7 -1163
+ori a6 t1 -617
+auipc a7 297723
+xori t0 a5 1057
+add a2 gp t2
+srli s4 s10 14
+andi t4 t1 -1953
+auipc s6 325338
+remu a0 tp s10
+andi x0 t0 -1239
+addi s3 t4 1924
+rem t1 s6 a0
+mulh t1 s9 a1
+xori t0 x0 309
+or a0 s0 t5
+rem x0 t1 ra
+and s3 s1 t3
+srai a5 t4 5
+srl s1 t4 a4
+xor s3 t3 a2
+srli t2 ra 10
+mulhu t1 s0 s11
+mulh s3 s7 gp
+srai s9 t5 13
+ori a0 s10 -227
+xor t2 s0 s8
+andi s4 t2 1580
+srli a5 s10 14
+mulhu t1 s3 a3
+sub t5 x0 tp
+ori x0 a7 876
+xori s9 a5 -1050
+slti a4 s6 -2044
+sra a3 s3 t4
+slti s8 a2 -1824
+ori t6 s3 312
+xori x0 s6 -1580
+mul a7 s1 ra
+ori a6 s8 -1156
+divu s1 s2 ra
+and s3 a2 s7
+lui a4 1035733
+slli t3 tp 24
+lui s11 269897
+lui a5 749191
+rem ra t4 s2
+andi a2 s2 -956
+div s5 a5 a6
+lui s11 17856
+srai x0 s4 27
+auipc s1 388320
+slt a2 s2 t3
+slli tp a5 27
+ori t3 t4 -1764
+add s8 t6 a2
+ori t4 a7 1138
+ori t1 tp -30
+xori s3 a3 -149
+auipc t0 934701
+sltu t3 s2 s4
+sll tp a5 s6
+rem t0 ra t4
+or t0 s0 s8
+srli s2 s1 13
+slti s2 x0 562
 addi a0 x0 10
 ecall
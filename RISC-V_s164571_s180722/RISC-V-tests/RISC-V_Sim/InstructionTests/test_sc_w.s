@@ -0,0 +1,15 @@
+addi s0 x0 77
+addi s1 x0 99
+addi a1 x0 200
+addi a2 x0 204
+sw s0 0(a1)
+lr_w.aq t0 (a1)
+sc_w.rl t1 s1 (a1)
+lw t2 0(a1)
+sc_w t3 s0 (a1)
+lw t4 0(a1)
+lr_w t5 (a1)
+sc_w t6 s0 (a2)
+lw s2 0(a2)
+addi a0 x0 10
+ecall
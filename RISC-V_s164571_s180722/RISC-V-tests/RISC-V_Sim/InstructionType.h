@@ -2,66 +2,192 @@
 
 #include <cstdint>
 
-enum class InstructionType : uint16_t
+//Instruction types are numbered from 1 without gaps so a decoded instruction
+//only needs a byte for its type and a switch over the types is a jump table.
+//Type 0 is left for words that aren't an instruction, running it fails.
+enum class InstructionType : uint8_t
 {
-	lb		= 0b000000'000'0000011,
-	lh		= 0b000000'001'0000011,
-	lw		= 0b000000'010'0000011,
-	lbu		= 0b000000'100'0000011,
-	lhu		= 0b000000'101'0000011,
-	fence	= 0b000000'000'0001111,
-	fence_i = 0b000000'001'0001111,
-	addi	= 0b000000'000'0010011,
-	slli	= 0b000000'001'0010011,
-	slti	= 0b000000'010'0010011,
-	sltiu	= 0b000000'011'0010011,
-	xori	= 0b000000'100'0010011,
-	srli	= 0b000000'101'0010011,
-	srai	= 0b100000'101'0010011,
-	ori		= 0b000000'110'0010011,
-	andi	= 0b000000'111'0010011,
-	auipc	= 0b000000'000'0010111,
-	sb		= 0b000000'000'0100011,
-	sh		= 0b000000'001'0100011,
-	sw		= 0b000000'010'0100011,
-	add		= 0b000000'000'0110011,
-	sub		= 0b100000'000'0110011,
-	sll		= 0b000000'001'0110011,
-	slt		= 0b000000'010'0110011,
-	sltu    = 0b000000'011'0110011,
-	xor_	= 0b000000'100'0110011,
-	srl		= 0b000000'101'0110011,
-	sra		= 0b100000'101'0110011,
-	or_		= 0b000000'110'0110011,
-	and_	= 0b000000'111'0110011,
-	lui		= 0b000000'000'0110111,
-	beq		= 0b000000'000'1100011,
-	bne		= 0b000000'001'1100011,
-	blt		= 0b000000'100'1100011,
-	bge		= 0b000000'101'1100011,
-	bltu	= 0b000000'110'1100011,
-	bgeu	= 0b000000'111'1100011,
-	jalr	= 0b000000'000'1100111,
-	jal		= 0b000000'000'1101111,
-	ecall	= 0b000000'000'1110011,
-	ebreak	= 0b000001'000'1110011,
-	csrrw	= 0b000000'001'1110011,
-	csrrs	= 0b000000'010'1110011,
-	csrrc	= 0b000000'011'1110011,
-	csrrwi	= 0b000000'101'1110011,
-	csrrsi	= 0b000000'110'1110011,
-	csrrci	= 0b000000'111'1110011,
+	lb = 1,
+	lh,
+	lw,
+	lbu,
+	lhu,
+	fence,
+	fence_i,
+	addi,
+	slli,
+	slti,
+	sltiu,
+	xori,
+	srli,
+	srai,
+	ori,
+	andi,
+	auipc,
+	sb,
+	sh,
+	sw,
+	add,
+	sub,
+	sll,
+	slt,
+	sltu,
+	xor_,
+	srl,
+	sra,
+	or_,
+	and_,
+	lui,
+	beq,
+	bne,
+	blt,
+	bge,
+	bltu,
+	bgeu,
+	jalr,
+	jal,
+	ecall,
+	ebreak,
+	csrrw,
+	csrrs,
+	csrrc,
+	csrrwi,
+	csrrsi,
+	csrrci,
+	sret,
+	mret,
+	sfence_vma,
+	wfi,
 
-	mul     = 0b000001'000'0110011,
-	mulh    = 0b000001'001'0110011,
-	mulhsu	= 0b000001'010'0110011,
-	mulhu   = 0b000001'011'0110011,
-	div	    = 0b000001'100'0110011,
-	divu	= 0b000001'101'0110011,
-	rem		= 0b000001'110'0110011,
-	remu	= 0b000001'111'0110011
+	mul,
+	mulh,
+	mulhsu,
+	mulhu,
+	div,
+	divu,
+	rem,
+	remu,
+
+	lr_w,
+	sc_w,
+	amoswap_w,
+	amoadd_w,
+	amoxor_w,
+	amoand_w,
+	amoor_w,
+	amomin_w,
+	amomax_w,
+	amominu_w,
+	amomaxu_w
+};
+
+constexpr uint32_t INSTRUCTION_TYPE_COUNT = static_cast<uint32_t>(InstructionType::amomaxu_w) + 1;
+
+//The encoding of every type, indexed by the type, as an identifier that is
+//opcode | funct3 << 7 | funct7 << 10 cut to 16 bits. The decoder puts the
+//same identifier together from an instruction to find its type.
+constexpr uint16_t INSTRUCTION_IDENTIFIERS[] =
+{
+	0,                    //not an instruction
+	0b000000'000'0000011, //lb
+	0b000000'001'0000011, //lh
+	0b000000'010'0000011, //lw
+	0b000000'100'0000011, //lbu
+	0b000000'101'0000011, //lhu
+	0b000000'000'0001111, //fence
+	0b000000'001'0001111, //fence_i
+	0b000000'000'0010011, //addi
+	0b000000'001'0010011, //slli
+	0b000000'010'0010011, //slti
+	0b000000'011'0010011, //sltiu
+	0b000000'100'0010011, //xori
+	0b000000'101'0010011, //srli
+	0b100000'101'0010011, //srai
+	0b000000'110'0010011, //ori
+	0b000000'111'0010011, //andi
+	0b000000'000'0010111, //auipc
+	0b000000'000'0100011, //sb
+	0b000000'001'0100011, //sh
+	0b000000'010'0100011, //sw
+	0b000000'000'0110011, //add
+	0b100000'000'0110011, //sub
+	0b000000'001'0110011, //sll
+	0b000000'010'0110011, //slt
+	0b000000'011'0110011, //sltu
+	0b000000'100'0110011, //xor_
+	0b000000'101'0110011, //srl
+	0b100000'101'0110011, //sra
+	0b000000'110'0110011, //or_
+	0b000000'111'0110011, //and_
+	0b000000'000'0110111, //lui
+	0b000000'000'1100011, //beq
+	0b000000'001'1100011, //bne
+	0b000000'100'1100011, //blt
+	0b000000'101'1100011, //bge
+	0b000000'110'1100011, //bltu
+	0b000000'111'1100011, //bgeu
+	0b000000'000'1100111, //jalr
+	0b000000'000'1101111, //jal
+	0b000000'000'1110011, //ecall
+	0b000001'000'1110011, //ebreak
+	0b000000'001'1110011, //csrrw
+	0b000000'010'1110011, //csrrs
+	0b000000'011'1110011, //csrrc
+	0b000000'101'1110011, //csrrwi
+	0b000000'110'1110011, //csrrsi
+	0b000000'111'1110011, //csrrci
+	0b001000'000'1110011, //sret
+	0b011000'000'1110011, //mret
+	0b001001'000'1110011, //sfence_vma
+	//has the same funct7 as sret and is told apart by the rs2 field,
+	//funct3 100 keeps the identifier from colliding with any encoding
+	0b001000'100'1110011, //wfi
+
+	0b000001'000'0110011, //mul
+	0b000001'001'0110011, //mulh
+	0b000001'010'0110011, //mulhsu
+	0b000001'011'0110011, //mulhu
+	0b000001'100'0110011, //div
+	0b000001'101'0110011, //divu
+	0b000001'110'0110011, //rem
+	0b000001'111'0110011, //remu
+
+	//the upper bits are funct5, the aq and rl bits
+	//are kept in the immediate of the instruction
+	0b000010'010'0101111, //lr_w
+	0b000011'010'0101111, //sc_w
+	0b000001'010'0101111, //amoswap_w
+	0b000000'010'0101111, //amoadd_w
+	0b000100'010'0101111, //amoxor_w
+	0b001100'010'0101111, //amoand_w
+	0b001000'010'0101111, //amoor_w
+	0b010000'010'0101111, //amomin_w
+	0b010100'010'0101111, //amomax_w
+	0b011000'010'0101111, //amominu_w
+	0b011100'010'0101111  //amomaxu_w
 };
 
+static_assert(sizeof(INSTRUCTION_IDENTIFIERS) / sizeof(INSTRUCTION_IDENTIFIERS[0]) == INSTRUCTION_TYPE_COUNT,
+	"Every instruction type needs an identifier");
+
+constexpr uint32_t InstructionTypeGetIdentifier(const InstructionType type)
+{
+	return INSTRUCTION_IDENTIFIERS[static_cast<uint32_t>(type)];
+}
+
+//the type with the identifier, 0 when no type has it
+constexpr InstructionType InstructionTypeFromIdentifier(const uint32_t identifier)
+{
+	for (uint32_t type = 1; type < INSTRUCTION_TYPE_COUNT; type++)
+	{
+		if (INSTRUCTION_IDENTIFIERS[type] == identifier)
+		{
+			return static_cast<InstructionType>(type);
+		}
+	}
+	return static_cast<InstructionType>(0);
+}
+
 uint32_t InstructionTypeGetOpCode(const InstructionType type);
 uint32_t InstructionTypeFunct3(const InstructionType type);
 uint32_t InstructionTypeFunct7(const InstructionType type);
\ No newline at end of file
@@ -0,0 +1,603 @@
+#include "LockstepEngine.h"
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <bitset>
+#include <algorithm>
+#include "InstructionDecode.h"
+#include "Register.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define LOCKSTEP_HAS_AVX2
+#define AVX2_TARGET __attribute__((target("avx2")))
+#include <immintrin.h>
+#elif defined(_MSC_VER) && defined(_M_X64)
+#define LOCKSTEP_HAS_AVX2
+#define AVX2_TARGET
+#include <immintrin.h>
+#include <intrin.h>
+#endif
+
+static uint32_t LaneCountOf(const uint32_t mask)
+{
+	return static_cast<uint32_t>(std::bitset<32>(mask).count());
+}
+
+static uint32_t RoundUpToPages(const uint32_t ramSize)
+{
+	if (ramSize == 0 || ramSize > 0x10'00'00'00)
+	{
+		throw std::runtime_error("Lockstep ram size has to be between 1 byte and 256 MiB.\nSize: " + std::to_string(ramSize));
+	}
+	return (ramSize + 4096 - 1) & ~(4096 - 1);
+}
+
+LockstepEngine::LockstepEngine(const uint32_t laneCount, const uint32_t ramSize) :
+	laneCount(laneCount),
+	ramSize(ramSize),
+	useAVX2(IsAVX2Supported()),
+	statistics({ 0, 0, 0 })
+{
+	if (laneCount == 0 || laneCount > MAX_LANES)
+	{
+		throw std::runtime_error("Lockstep lane count has to be between 1 and " + std::to_string(MAX_LANES) + ".\nCount: " + std::to_string(laneCount));
+	}
+	memory.assign(static_cast<size_t>(RoundUpToPages(ramSize)) * laneCount, 0);
+	std::memset(registers, 0, sizeof(registers));
+	std::memset(pcs, 0, sizeof(pcs));
+}
+
+bool LockstepEngine::IsAVX2Supported()
+{
+#if defined(LOCKSTEP_HAS_AVX2) && defined(__GNUC__)
+	return __builtin_cpu_supports("avx2");
+#elif defined(LOCKSTEP_HAS_AVX2)
+	int info[4];
+	__cpuidex(info, 7, 0);
+	return (info[1] & (1 << 5)) != 0;
+#else
+	return false;
+#endif
+}
+
+void LockstepEngine::SetUseAVX2(const bool value)
+{
+	useAVX2 = value && IsAVX2Supported();
+}
+
+bool LockstepEngine::IsUsingAVX2() const
+{
+	return useAVX2;
+}
+
+void LockstepEngine::Load(const uint32_t* rawInstructions, const size_t instructionCount)
+{
+	instructions = *DecodeInstructions(rawInstructions, instructionCount);
+	std::fill(memory.begin(), memory.end(), 0);
+	std::memset(registers, 0, sizeof(registers));
+	std::memset(pcs, 0, sizeof(pcs));
+	for (uint32_t lane = 0; lane < laneCount; lane++)
+	{
+		registers[static_cast<uint32_t>(Regs::sp)][lane] = ramSize;
+	}
+	liveLanes = (1u << laneCount) - 1;
+	statistics = { 0, 0, 0 };
+}
+
+void LockstepEngine::SetRegister(const uint32_t lane, const uint32_t index, const uint32_t value)
+{
+	//x0 stays 0 like in the processor
+	if (index != 0)
+	{
+		registers[index][lane] = value;
+	}
+}
+
+uint32_t LockstepEngine::GetRegister(const uint32_t lane, const uint32_t index) const
+{
+	return registers[index][lane];
+}
+
+uint32_t LockstepEngine::GetLaneCount() const
+{
+	return laneCount;
+}
+
+uint8_t* LockstepEngine::LaneMemory(const uint32_t lane, const uint32_t address, const uint32_t size)
+{
+	const uint32_t laneRamSize = static_cast<uint32_t>(memory.size() / laneCount);
+	if (address > laneRamSize - size)
+	{
+		throw std::runtime_error("Memory access out of range.\nTried to access memory address " + std::to_string(address) +
+			" in lane " + std::to_string(lane));
+	}
+	return memory.data() + static_cast<size_t>(lane) * laneRamSize + address;
+}
+
+#ifdef LOCKSTEP_HAS_AVX2
+//does the operation for 8 lanes at a time, lanes not in
+//the mask keep the value rd had before
+AVX2_TARGET static void RunALUAVX2(const LaneOp op, uint32_t* rd, const uint32_t* a, const uint32_t* b, const uint32_t mask, const uint32_t laneCount)
+{
+	const __m256i laneBits = _mm256_setr_epi32(1, 2, 4, 8, 16, 32, 64, 128);
+	const __m256i shiftMask = _mm256_set1_epi32(31);
+	const __m256i one = _mm256_set1_epi32(1);
+	const __m256i signBit = _mm256_set1_epi32(INT32_MIN);
+	for (uint32_t lane = 0; lane < laneCount; lane += 8)
+	{
+		const __m256i x = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + lane));
+		const __m256i y = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(b + lane));
+		__m256i result;
+		switch (op)
+		{
+			case LaneOp::Add:
+				result = _mm256_add_epi32(x, y);
+				break;
+			case LaneOp::Sub:
+				result = _mm256_sub_epi32(x, y);
+				break;
+			case LaneOp::And:
+				result = _mm256_and_si256(x, y);
+				break;
+			case LaneOp::Or:
+				result = _mm256_or_si256(x, y);
+				break;
+			case LaneOp::Xor:
+				result = _mm256_xor_si256(x, y);
+				break;
+			//only the low 5 bits of the shift amount are used, like on the host
+			case LaneOp::ShiftLeft:
+				result = _mm256_sllv_epi32(x, _mm256_and_si256(y, shiftMask));
+				break;
+			case LaneOp::ShiftRightLogical:
+				result = _mm256_srlv_epi32(x, _mm256_and_si256(y, shiftMask));
+				break;
+			case LaneOp::ShiftRightArithmetic:
+				result = _mm256_srav_epi32(x, _mm256_and_si256(y, shiftMask));
+				break;
+			case LaneOp::SetLessThan:
+				result = _mm256_and_si256(_mm256_cmpgt_epi32(y, x), one);
+				break;
+			//there is no unsigned compare, flipping the sign bit makes it signed
+			case LaneOp::SetLessThanUnsigned:
+				result = _mm256_and_si256(_mm256_cmpgt_epi32(_mm256_xor_si256(y, signBit), _mm256_xor_si256(x, signBit)), one);
+				break;
+			default:
+				result = _mm256_mullo_epi32(x, y);
+				break;
+		}
+
+		const __m256i laneMask = _mm256_cmpeq_epi32(_mm256_and_si256(_mm256_set1_epi32(static_cast<int32_t>(mask >> lane)), laneBits), laneBits);
+		const __m256i old = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(rd + lane));
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(rd + lane), _mm256_blendv_epi8(old, result, laneMask));
+	}
+}
+#endif
+
+static uint32_t RunALULane(const LaneOp op, const uint32_t x, const uint32_t y)
+{
+	switch (op)
+	{
+		case LaneOp::Add:
+			return x + y;
+		case LaneOp::Sub:
+			return x - y;
+		case LaneOp::And:
+			return x & y;
+		case LaneOp::Or:
+			return x | y;
+		case LaneOp::Xor:
+			return x ^ y;
+		case LaneOp::ShiftLeft:
+			return x << (y & 31);
+		case LaneOp::ShiftRightLogical:
+			return x >> (y & 31);
+		case LaneOp::ShiftRightArithmetic:
+			return static_cast<uint32_t>(static_cast<int32_t>(x) >> (y & 31));
+		case LaneOp::SetLessThan:
+			return (static_cast<int32_t>(x) < static_cast<int32_t>(y)) ? 1 : 0;
+		case LaneOp::SetLessThanUnsigned:
+			return (x < y) ? 1 : 0;
+		default:
+			return x * y;
+	}
+}
+
+void LockstepEngine::RunALU(const LaneOp op, const uint32_t rd, const uint32_t* a, const uint32_t* b, const uint32_t mask)
+{
+	if (rd == 0)
+	{
+		return;
+	}
+#ifdef LOCKSTEP_HAS_AVX2
+	if (useAVX2)
+	{
+		RunALUAVX2(op, registers[rd], a, b, mask, laneCount);
+		return;
+	}
+#endif
+	for (uint32_t lane = 0; lane < laneCount; lane++)
+	{
+		if ((mask >> lane) & 1)
+		{
+			registers[rd][lane] = RunALULane(op, a[lane], b[lane]);
+		}
+	}
+}
+
+void LockstepEngine::RunALUImmediate(const LaneOp op, const uint32_t rd, const uint32_t rs1, const int32_t immediate, const uint32_t mask)
+{
+	uint32_t immediates[MAX_LANES];
+	std::fill(immediates, immediates + MAX_LANES, static_cast<uint32_t>(immediate));
+	RunALU(op, rd, registers[rs1], immediates, mask);
+}
+
+//instructions that can't be done as a plain operation on every lane,
+//loads and stores go to each lane's own memory
+void LockstepEngine::RunScalarInstruction(const Instruction& instruction, const uint32_t lane)
+{
+	const uint32_t rs1 = registers[instruction.rs1][lane];
+	const uint32_t rs2 = registers[instruction.rs2][lane];
+	const int32_t srs1 = static_cast<int32_t>(rs1);
+	const int32_t srs2 = static_cast<int32_t>(rs2);
+	const uint32_t address = rs1 + static_cast<uint32_t>(instruction.immediate);
+	uint32_t result;
+
+	switch (instruction.type)
+	{
+		case InstructionType::lb:
+			result = static_cast<uint32_t>(static_cast<int32_t>(static_cast<int8_t>(*LaneMemory(lane, address, 1))));
+			break;
+		case InstructionType::lh:
+		{
+			const uint8_t* bytes = LaneMemory(lane, address, 2);
+			result = static_cast<uint32_t>(static_cast<int32_t>(static_cast<int16_t>(bytes[0] | (bytes[1] << 8))));
+			break;
+		}
+		case InstructionType::lw:
+		{
+			const uint8_t* bytes = LaneMemory(lane, address, 4);
+			result = static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+					 (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+			break;
+		}
+		case InstructionType::lbu:
+			result = *LaneMemory(lane, address, 1);
+			break;
+		case InstructionType::lhu:
+		{
+			const uint8_t* bytes = LaneMemory(lane, address, 2);
+			result = static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8);
+			break;
+		}
+		case InstructionType::sb:
+			*LaneMemory(lane, address, 1) = static_cast<uint8_t>(rs2);
+			return;
+		case InstructionType::sh:
+		{
+			uint8_t* const bytes = LaneMemory(lane, address, 2);
+			bytes[0] = static_cast<uint8_t>(rs2);
+			bytes[1] = static_cast<uint8_t>(rs2 >> 8);
+			return;
+		}
+		case InstructionType::sw:
+		{
+			uint8_t* const bytes = LaneMemory(lane, address, 4);
+			bytes[0] = static_cast<uint8_t>(rs2);
+			bytes[1] = static_cast<uint8_t>(rs2 >> 8);
+			bytes[2] = static_cast<uint8_t>(rs2 >> 16);
+			bytes[3] = static_cast<uint8_t>(rs2 >> 24);
+			return;
+		}
+		case InstructionType::mulh:
+			result = static_cast<uint32_t>((static_cast<int64_t>(srs1) * static_cast<int64_t>(srs2)) >> 32);
+			break;
+		case InstructionType::mulhsu:
+			result = static_cast<uint32_t>((static_cast<int64_t>(srs1) * static_cast<uint64_t>(rs2)) >> 32);
+			break;
+		case InstructionType::mulhu:
+			result = static_cast<uint32_t>((static_cast<uint64_t>(rs1) * static_cast<uint64_t>(rs2)) >> 32);
+			break;
+		case InstructionType::div:
+			result = (srs2 == 0) ? UINT32_MAX : (srs1 == INT32_MIN && srs2 == -1) ? rs1 : static_cast<uint32_t>(srs1 / srs2);
+			break;
+		case InstructionType::divu:
+			result = (rs2 == 0) ? rs1 : rs1 / rs2;
+			break;
+		case InstructionType::rem:
+			result = (srs2 == 0) ? rs1 : (srs1 == INT32_MIN && srs2 == -1) ? 0 : static_cast<uint32_t>(srs1 % srs2);
+			break;
+		default:
+			result = (rs2 == 0) ? rs1 : rs1 % rs2;
+			break;
+	}
+
+	if (instruction.rd != 0)
+	{
+		registers[instruction.rd][lane] = result;
+	}
+}
+
+//returns false for instructions that may change the pc of some lanes
+bool LockstepEngine::RunStraightLineInstruction(const Instruction& instruction, const uint32_t pc, const uint32_t mask)
+{
+	switch (instruction.type)
+	{
+		case InstructionType::addi:
+			RunALUImmediate(LaneOp::Add, instruction.rd, instruction.rs1, instruction.immediate, mask);
+			return true;
+		case InstructionType::slli:
+			RunALUImmediate(LaneOp::ShiftLeft, instruction.rd, instruction.rs1, instruction.immediate, mask);
+			return true;
+		case InstructionType::slti:
+			RunALUImmediate(LaneOp::SetLessThan, instruction.rd, instruction.rs1, instruction.immediate, mask);
+			return true;
+		case InstructionType::sltiu:
+			RunALUImmediate(LaneOp::SetLessThanUnsigned, instruction.rd, instruction.rs1, instruction.immediate, mask);
+			return true;
+		case InstructionType::xori:
+			RunALUImmediate(LaneOp::Xor, instruction.rd, instruction.rs1, instruction.immediate, mask);
+			return true;
+		case InstructionType::srli:
+			RunALUImmediate(LaneOp::ShiftRightLogical, instruction.rd, instruction.rs1, instruction.immediate, mask);
+			return true;
+		case InstructionType::srai:
+			RunALUImmediate(LaneOp::ShiftRightArithmetic, instruction.rd, instruction.rs1, instruction.immediate, mask);
+			return true;
+		case InstructionType::ori:
+			RunALUImmediate(LaneOp::Or, instruction.rd, instruction.rs1, instruction.immediate, mask);
+			return true;
+		case InstructionType::andi:
+			RunALUImmediate(LaneOp::And, instruction.rd, instruction.rs1, instruction.immediate, mask);
+			return true;
+		//x0 is a row of zeros so adding to it is a move
+		case InstructionType::lui:
+			RunALUImmediate(LaneOp::Add, instruction.rd, 0, instruction.immediate, mask);
+			return true;
+		case InstructionType::auipc:
+			RunALUImmediate(LaneOp::Add, instruction.rd, 0, static_cast<int32_t>(pc + static_cast<uint32_t>(instruction.immediate)), mask);
+			return true;
+		case InstructionType::add:
+			RunALU(LaneOp::Add, instruction.rd, registers[instruction.rs1], registers[instruction.rs2], mask);
+			return true;
+		case InstructionType::sub:
+			RunALU(LaneOp::Sub, instruction.rd, registers[instruction.rs1], registers[instruction.rs2], mask);
+			return true;
+		case InstructionType::sll:
+			RunALU(LaneOp::ShiftLeft, instruction.rd, registers[instruction.rs1], registers[instruction.rs2], mask);
+			return true;
+		case InstructionType::slt:
+			RunALU(LaneOp::SetLessThan, instruction.rd, registers[instruction.rs1], registers[instruction.rs2], mask);
+			return true;
+		case InstructionType::sltu:
+			RunALU(LaneOp::SetLessThanUnsigned, instruction.rd, registers[instruction.rs1], registers[instruction.rs2], mask);
+			return true;
+		case InstructionType::xor_:
+			RunALU(LaneOp::Xor, instruction.rd, registers[instruction.rs1], registers[instruction.rs2], mask);
+			return true;
+		case InstructionType::srl:
+			RunALU(LaneOp::ShiftRightLogical, instruction.rd, registers[instruction.rs1], registers[instruction.rs2], mask);
+			return true;
+		case InstructionType::sra:
+			RunALU(LaneOp::ShiftRightArithmetic, instruction.rd, registers[instruction.rs1], registers[instruction.rs2], mask);
+			return true;
+		case InstructionType::or_:
+			RunALU(LaneOp::Or, instruction.rd, registers[instruction.rs1], registers[instruction.rs2], mask);
+			return true;
+		case InstructionType::and_:
+			RunALU(LaneOp::And, instruction.rd, registers[instruction.rs1], registers[instruction.rs2], mask);
+			return true;
+		case InstructionType::mul:
+			RunALU(LaneOp::Multiply, instruction.rd, registers[instruction.rs1], registers[instruction.rs2], mask);
+			return true;
+		case InstructionType::lb:
+		case InstructionType::lh:
+		case InstructionType::lw:
+		case InstructionType::lbu:
+		case InstructionType::lhu:
+		case InstructionType::sb:
+		case InstructionType::sh:
+		case InstructionType::sw:
+		case InstructionType::mulh:
+		case InstructionType::mulhsu:
+		case InstructionType::mulhu:
+		case InstructionType::div:
+		case InstructionType::divu:
+		case InstructionType::rem:
+		case InstructionType::remu:
+			for (uint32_t lane = 0; lane < laneCount; lane++)
+			{
+				if ((mask >> lane) & 1)
+				{
+					RunScalarInstruction(instruction, lane);
+				}
+			}
+			return true;
+		default:
+			return false;
+	}
+}
+
+static bool IsBranchTaken(const InstructionType type, const uint32_t rs1, const uint32_t rs2)
+{
+	switch (type)
+	{
+		case InstructionType::beq:
+			return rs1 == rs2;
+		case InstructionType::bne:
+			return rs1 != rs2;
+		case InstructionType::blt:
+			return static_cast<int32_t>(rs1) < static_cast<int32_t>(rs2);
+		case InstructionType::bge:
+			return static_cast<int32_t>(rs1) >= static_cast<int32_t>(rs2);
+		case InstructionType::bltu:
+			return rs1 < rs2;
+		default:
+			return rs1 >= rs2;
+	}
+}
+
+void LockstepEngine::RunControlInstruction(const Instruction& instruction, const uint32_t pc, const uint32_t mask)
+{
+	uint32_t nextPCs[MAX_LANES];
+	switch (instruction.type)
+	{
+		case InstructionType::beq:
+		case InstructionType::bne:
+		case InstructionType::blt:
+		case InstructionType::bge:
+		case InstructionType::bltu:
+		case InstructionType::bgeu:
+			for (uint32_t lane = 0; lane < laneCount; lane++)
+			{
+				const bool taken = IsBranchTaken(instruction.type, registers[instruction.rs1][lane], registers[instruction.rs2][lane]);
+				nextPCs[lane] = taken ? pc + instruction.immediate : pc + 4;
+			}
+			break;
+		case InstructionType::jal:
+			for (uint32_t lane = 0; lane < laneCount; lane++)
+			{
+				nextPCs[lane] = pc + instruction.immediate;
+			}
+			break;
+		case InstructionType::jalr:
+			for (uint32_t lane = 0; lane < laneCount; lane++)
+			{
+				nextPCs[lane] = registers[instruction.rs1][lane] + instruction.immediate;
+			}
+			break;
+		case InstructionType::ecall:
+			for (uint32_t lane = 0; lane < laneCount; lane++)
+			{
+				if (((mask >> lane) & 1) && registers[static_cast<uint32_t>(Regs::a0)][lane] == 10)
+				{
+					liveLanes &= ~(1u << lane);
+				}
+				nextPCs[lane] = pc + 4;
+			}
+			break;
+		default:
+			throw std::runtime_error("Instruction isn't supported in lockstep execution: " + InstructionAsString(instruction));
+	}
+
+	if (instruction.type == InstructionType::jal || instruction.type == InstructionType::jalr)
+	{
+		RunALUImmediate(LaneOp::Add, instruction.rd, 0, static_cast<int32_t>(pc + 4), mask);
+	}
+
+	bool diverged = false;
+	uint32_t groupNextPC = 0;
+	bool first = true;
+	for (uint32_t lane = 0; lane < laneCount; lane++)
+	{
+		if ((mask >> lane) & 1)
+		{
+			pcs[lane] = nextPCs[lane];
+			diverged |= !first && nextPCs[lane] != groupNextPC;
+			groupNextPC = nextPCs[lane];
+			first = false;
+		}
+	}
+	statistics.divergences += diverged ? 1 : 0;
+}
+
+//lowest pc of the live lanes outside mask, UINT32_MAX if there are none
+uint32_t LockstepEngine::WaitingPC(const uint32_t mask) const
+{
+	uint32_t waitingPC = UINT32_MAX;
+	for (uint32_t lane = 0; lane < laneCount; lane++)
+	{
+		if (((liveLanes & ~mask) >> lane) & 1)
+		{
+			waitingPC = std::min(waitingPC, pcs[lane]);
+		}
+	}
+	return waitingPC;
+}
+
+//runs the lanes in mask from groupPC until the first instruction that
+//can send them different ways. Lanes waiting further ahead join the
+//group when it reaches their pc
+void LockstepEngine::RunGroup(const uint32_t groupPC, uint32_t mask)
+{
+	uint32_t activeLanes = LaneCountOf(mask);
+	uint32_t waitingPC = WaitingPC(mask);
+	uint32_t pc = groupPC;
+	while (true)
+	{
+		if (pc == waitingPC)
+		{
+			for (uint32_t lane = 0; lane < laneCount; lane++)
+			{
+				if (((liveLanes >> lane) & 1) && pcs[lane] == pc)
+				{
+					mask |= 1u << lane;
+				}
+			}
+			activeLanes = LaneCountOf(mask);
+			waitingPC = WaitingPC(mask);
+		}
+
+		const uint32_t instructionIndex = pc / 4;
+		if (instructionIndex >= instructions.size())
+		{
+			throw std::runtime_error("Index out of bounds.\nTried to access instruction: " + std::to_string(instructionIndex));
+		}
+		const Instruction& instruction = instructions[instructionIndex];
+		statistics.groupInstructions++;
+		statistics.laneInstructions += activeLanes;
+
+		if (!RunStraightLineInstruction(instruction, pc, mask))
+		{
+			RunControlInstruction(instruction, pc, mask);
+			return;
+		}
+		pc += 4;
+	}
+}
+
+void LockstepEngine::Run(const uint64_t maxGroupInstructions)
+{
+	while (liveLanes != 0)
+	{
+		if (statistics.groupInstructions >= maxGroupInstructions)
+		{
+			throw std::runtime_error("Lockstep program exceeded the limit of " + std::to_string(maxGroupInstructions) + " instructions.");
+		}
+
+		uint32_t groupPC = UINT32_MAX;
+		for (uint32_t lane = 0; lane < laneCount; lane++)
+		{
+			if (((liveLanes >> lane) & 1) && pcs[lane] < groupPC)
+			{
+				groupPC = pcs[lane];
+			}
+		}
+
+		uint32_t mask = 0;
+		for (uint32_t lane = 0; lane < laneCount; lane++)
+		{
+			if (((liveLanes >> lane) & 1) && pcs[lane] == groupPC)
+			{
+				mask |= 1u << lane;
+			}
+		}
+
+		RunGroup(groupPC, mask);
+	}
+}
+
+const LockstepStatistics& LockstepEngine::GetStatistics() const
+{
+	return statistics;
+}
+
+double LockstepEngine::GetLaneUtilization() const
+{
+	if (statistics.groupInstructions == 0)
+	{
+		return 0.0;
+	}
+	return static_cast<double>(statistics.laneInstructions) / (static_cast<double>(statistics.groupInstructions) * laneCount);
+}
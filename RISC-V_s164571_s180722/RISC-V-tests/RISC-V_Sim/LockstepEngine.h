@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+#include "Instruction.h"
+
+struct LockstepStatistics
+{
+	//instructions issued once for a whole group of lanes
+	uint64_t groupInstructions;
+	//instructions executed summed over every lane
+	uint64_t laneInstructions;
+	//jumps and branches that sent the lanes of a group different ways
+	uint64_t divergences;
+};
+
+enum class LaneOp
+{
+	Add,
+	Sub,
+	And,
+	Or,
+	Xor,
+	ShiftLeft,
+	ShiftRightLogical,
+	ShiftRightArithmetic,
+	SetLessThan,
+	SetLessThanUnsigned,
+	Multiply
+};
+
+//Runs many instances of the same program in lockstep, each with its own
+//registers and RAM. Registers are stored as one row of lanes per register
+//so an ALU instruction is done for every lane at once with AVX2.
+//Lanes at the same pc form a group and run together. When a branch
+//splits a group the group with the lowest pc runs first, and the lanes
+//that skipped ahead join it again once it catches up with them.
+//Only unprivileged RV32IM instructions are supported.
+class LockstepEngine
+{
+public:
+	static const uint32_t MAX_LANES = 16;
+
+private:
+	uint32_t laneCount;
+	uint32_t ramSize;
+	uint32_t registers[32][MAX_LANES];
+	uint32_t pcs[MAX_LANES];
+	//bit per lane that hasn't exited yet
+	uint32_t liveLanes = 0;
+	std::vector<uint8_t> memory;
+	std::vector<Instruction> instructions;
+	bool useAVX2;
+	LockstepStatistics statistics;
+
+	uint8_t* LaneMemory(const uint32_t lane, const uint32_t address, const uint32_t size);
+	void RunALU(const LaneOp op, const uint32_t rd, const uint32_t* a, const uint32_t* b, const uint32_t mask);
+	void RunALUImmediate(const LaneOp op, const uint32_t rd, const uint32_t rs1, const int32_t immediate, const uint32_t mask);
+	bool RunStraightLineInstruction(const Instruction& instruction, const uint32_t pc, const uint32_t mask);
+	void RunScalarInstruction(const Instruction& instruction, const uint32_t lane);
+	void RunControlInstruction(const Instruction& instruction, const uint32_t pc, const uint32_t mask);
+	uint32_t WaitingPC(const uint32_t mask) const;
+	void RunGroup(const uint32_t groupPC, uint32_t mask);
+
+public:
+	//laneCount is at most MAX_LANES, ramSize is the RAM of each lane
+	LockstepEngine(const uint32_t laneCount, const uint32_t ramSize);
+
+	static bool IsAVX2Supported();
+	//AVX2 is used when the cpu supports it, turning it off
+	//runs the same lanes with plain loops instead
+	void SetUseAVX2(const bool value);
+	bool IsUsingAVX2() const;
+
+	//resets every lane, which all start at pc 0 with sp at the end of RAM
+	void Load(const uint32_t* rawInstructions, const size_t instructionCount);
+	void SetRegister(const uint32_t lane, const uint32_t index, const uint32_t value);
+	uint32_t GetRegister(const uint32_t lane, const uint32_t index) const;
+	uint32_t GetLaneCount() const;
+
+	//runs until every lane has done ecall with a0 = 10, throws if
+	//maxGroupInstructions are issued before that
+	void Run(const uint64_t maxGroupInstructions);
+	const LockstepStatistics& GetStatistics() const;
+	//share of the issued lane slots that did useful work
+	double GetLaneUtilization() const;
+};
@@ -0,0 +1,245 @@
+#include "MMU.h"
+#include <cstdint>
+#include "CSR.h"
+#include "Trap.h"
+
+namespace PTE
+{
+	const uint32_t V = 1 << 0;
+	const uint32_t R = 1 << 1;
+	const uint32_t W = 1 << 2;
+	const uint32_t X = 1 << 3;
+	const uint32_t U = 1 << 4;
+	const uint32_t A = 1 << 6;
+	const uint32_t D = 1 << 7;
+}
+
+const uint32_t SATP_MODE = 0x80'00'00'00;
+const uint32_t SATP_PPN  = 0x00'3f'ff'ff;
+const uint32_t PAGE_SIZE = 4096;
+//physical addresses in Sv32 are 34 bits but guest memory lives
+//in the 32 bit address space, so anything above that is a fault
+const uint64_t MAX_PHYSICAL_PAGE = 1 << 20;
+
+static Trap PageFault(const AccessType access, const uint32_t virtualAddress)
+{
+	switch (access)
+	{
+		case AccessType::Execute:
+			return { TrapCause::InstructionPageFault, virtualAddress };
+		case AccessType::Load:
+			return { TrapCause::LoadPageFault, virtualAddress };
+		default:
+			return { TrapCause::StorePageFault, virtualAddress };
+	}
+}
+
+static Trap AccessFault(const AccessType access, const uint32_t virtualAddress)
+{
+	switch (access)
+	{
+		case AccessType::Execute:
+			return { TrapCause::InstructionAccessFault, virtualAddress };
+		case AccessType::Load:
+			return { TrapCause::LoadAccessFault, virtualAddress };
+		default:
+			return { TrapCause::StoreAccessFault, virtualAddress };
+	}
+}
+
+static bool IsAccessAllowed(const uint32_t flags, const AccessType access, const PrivilegeMode privilege, const uint32_t mstatus)
+{
+	if (flags & PTE::U)
+	{
+		//supervisor can only touch user pages when SUM is set
+		//and is never allowed to execute them
+		if (privilege == PrivilegeMode::Supervisor &&
+			(access == AccessType::Execute || !(mstatus & MStatus::SUM)))
+		{
+			return false;
+		}
+	}
+	else if (privilege == PrivilegeMode::User)
+	{
+		return false;
+	}
+
+	switch (access)
+	{
+		case AccessType::Execute:
+			return (flags & PTE::X) != 0;
+		case AccessType::Load:
+			return (flags & PTE::R) || ((mstatus & MStatus::MXR) && (flags & PTE::X));
+		default:
+			return (flags & PTE::W) != 0;
+	}
+}
+
+MMU::MMU(PhysicalMemory& memory) : memory(memory)
+{
+	Reset();
+}
+
+uint32_t MMU::Translate(const uint32_t virtualAddress, const AccessType access, const PrivilegeMode privilege, const uint32_t mstatus)
+{
+	const uint32_t virtualPage = virtualAddress >> 12;
+	const TLBEntry& entry = tlb[virtualPage & (TLB_SIZE - 1)];
+
+	//a store to a page that isn't dirty yet has to go through
+	//the walk so the D bit is set in the page table
+	if (entry.virtualPage == virtualPage &&
+		IsAccessAllowed(entry.flags, access, privilege, mstatus) &&
+		(access != AccessType::Store || (entry.flags & PTE::D)))
+	{
+		statistics.tlbHits++;
+		return (entry.physicalPage << 12) | (virtualAddress & (PAGE_SIZE - 1));
+	}
+
+	statistics.tlbMisses++;
+	return Walk(virtualAddress, access, privilege, mstatus);
+}
+
+uint32_t MMU::ReadPageTableEntry(const uint32_t address, const AccessType access, const uint32_t virtualAddress)
+{
+	//page tables can only live in ram, never in a device
+	if (!memory.IsRAM(address, 4))
+	{
+		throw AccessFault(access, virtualAddress);
+	}
+
+	return memory.ReadWord(address);
+}
+
+void MMU::WritePageTableEntry(const uint32_t address, const uint32_t entry)
+{
+	memory.WriteWord(address, entry);
+}
+
+uint32_t MMU::Walk(const uint32_t virtualAddress, const AccessType access, const PrivilegeMode privilege, const uint32_t mstatus)
+{
+	statistics.pageWalks++;
+
+	const uint32_t virtualPageNumber[2] = { (virtualAddress >> 12) & 0x3ff, virtualAddress >> 22 };
+	uint64_t tablePage = satp & SATP_PPN;
+	int32_t level = 1;
+	uint32_t entryAddress;
+	uint32_t entry;
+
+	while (true)
+	{
+		if (tablePage >= MAX_PHYSICAL_PAGE)
+		{
+			throw AccessFault(access, virtualAddress);
+		}
+
+		entryAddress = static_cast<uint32_t>(tablePage * PAGE_SIZE) + virtualPageNumber[level] * 4;
+		entry = ReadPageTableEntry(entryAddress, access, virtualAddress);
+
+		if (!(entry & PTE::V) || (!(entry & PTE::R) && (entry & PTE::W)))
+		{
+			statistics.pageFaults++;
+			throw PageFault(access, virtualAddress);
+		}
+		//R or X set means this is a leaf
+		if (entry & (PTE::R | PTE::X))
+		{
+			break;
+		}
+		if (level == 0)
+		{
+			statistics.pageFaults++;
+			throw PageFault(access, virtualAddress);
+		}
+
+		tablePage = entry >> 10;
+		level--;
+	}
+
+	const uint32_t physicalPageNumber = entry >> 10;
+	//megapages has to be aligned to 4 MiB
+	if (!IsAccessAllowed(entry, access, privilege, mstatus) ||
+		(level == 1 && (physicalPageNumber & 0x3ff) != 0))
+	{
+		statistics.pageFaults++;
+		throw PageFault(access, virtualAddress);
+	}
+
+	const uint32_t physicalPage = (level == 1) ? (physicalPageNumber | virtualPageNumber[0]) : physicalPageNumber;
+	if (physicalPage >= MAX_PHYSICAL_PAGE)
+	{
+		throw AccessFault(access, virtualAddress);
+	}
+
+	const uint32_t updatedEntry = entry | PTE::A | ((access == AccessType::Store) ? PTE::D : 0);
+	if (updatedEntry != entry)
+	{
+		WritePageTableEntry(entryAddress, updatedEntry);
+	}
+
+	const uint32_t virtualPage = virtualAddress >> 12;
+	TLBEntry& tlbEntry = tlb[virtualPage & (TLB_SIZE - 1)];
+	tlbEntry.virtualPage  = virtualPage;
+	tlbEntry.physicalPage = physicalPage;
+	tlbEntry.flags        = updatedEntry;
+	tlbEntry.isMegapage   = level == 1;
+
+	return (physicalPage << 12) | (virtualAddress & (PAGE_SIZE - 1));
+}
+
+void MMU::SetSATP(const uint32_t value)
+{
+	//ASIDs aren't tracked so any change of address space
+	//has to drop all cached translations
+	satp = value;
+	Flush();
+}
+
+uint32_t MMU::GetSATP() const
+{
+	return satp;
+}
+
+bool MMU::IsPagingEnabled() const
+{
+	return (satp & SATP_MODE) != 0;
+}
+
+void MMU::Flush()
+{
+	for (uint32_t i = 0; i < TLB_SIZE; i++)
+	{
+		tlb[i].virtualPage = INVALID_PAGE;
+	}
+	statistics.tlbFlushes++;
+}
+
+void MMU::FlushAddress(const uint32_t virtualAddress)
+{
+	const uint32_t virtualPage = virtualAddress >> 12;
+	TLBEntry& entry = tlb[virtualPage & (TLB_SIZE - 1)];
+	if (entry.virtualPage == virtualPage)
+	{
+		entry.virtualPage = INVALID_PAGE;
+	}
+	//the other pages of a megapage can be in any entry
+	for (uint32_t i = 0; i < TLB_SIZE; i++)
+	{
+		if (tlb[i].isMegapage && tlb[i].virtualPage != INVALID_PAGE && (tlb[i].virtualPage >> 10) == (virtualPage >> 10))
+		{
+			tlb[i].virtualPage = INVALID_PAGE;
+		}
+	}
+}
+
+void MMU::Reset()
+{
+	satp = 0;
+	statistics = { 0 };
+	Flush();
+	statistics.tlbFlushes = 0;
+}
+
+const MMUStatistics& MMU::GetStatistics() const
+{
+	return statistics;
+}
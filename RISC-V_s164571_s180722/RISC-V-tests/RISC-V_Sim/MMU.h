@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstdint>
+#include "Trap.h"
+#include "PhysicalMemory.h"
+
+enum class AccessType : uint32_t
+{
+	Execute,
+	Load,
+	Store
+};
+
+struct MMUStatistics
+{
+	uint64_t tlbHits;
+	uint64_t tlbMisses;
+	uint64_t pageWalks;
+	uint64_t pageFaults;
+	uint64_t tlbFlushes;
+};
+
+//Sv32 memory management unit. Translations are cached in a
+//direct mapped TLB indexed by the low bits of the virtual page
+//number, so a hit costs one compare and a permission check.
+class MMU
+{
+private:
+	const static uint32_t TLB_SIZE = 64;
+	const static uint32_t INVALID_PAGE = 0xff'ff'ff'ff;
+
+	struct TLBEntry
+	{
+		uint32_t virtualPage;
+		uint32_t physicalPage;
+		uint32_t flags;
+		//a megapage is cached as one entry per 4 KiB page of
+		//it that was used, and all of them go with the megapage
+		bool isMegapage;
+	};
+
+	TLBEntry tlb[TLB_SIZE];
+	uint32_t satp = 0;
+	PhysicalMemory& memory;
+	MMUStatistics statistics;
+
+	uint32_t ReadPageTableEntry(const uint32_t address, const AccessType access, const uint32_t virtualAddress);
+	void WritePageTableEntry(const uint32_t address, const uint32_t entry);
+	uint32_t Walk(const uint32_t virtualAddress, const AccessType access, const PrivilegeMode privilege, const uint32_t mstatus);
+
+public:
+	MMU(PhysicalMemory& memory);
+
+	uint32_t Translate(const uint32_t virtualAddress, const AccessType access, const PrivilegeMode privilege, const uint32_t mstatus);
+	void SetSATP(const uint32_t value);
+	uint32_t GetSATP() const;
+	bool IsPagingEnabled() const;
+	void Flush();
+	void FlushAddress(const uint32_t virtualAddress);
+	void Reset();
+
+	const MMUStatistics& GetStatistics() const;
+};
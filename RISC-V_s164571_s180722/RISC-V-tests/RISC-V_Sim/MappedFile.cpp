@@ -0,0 +1,100 @@
+#include "MappedFile.h"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#ifndef _WIN32
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static const uint32_t PAGE_SIZE = 4096;
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string& path, const FileMapping mapping, const uint32_t size) : mapping(mapping)
+{
+	throw std::runtime_error("File backed memory is only supported on linux.\nFile: " + path);
+}
+
+MappedFile::~MappedFile()
+{
+}
+
+#else
+
+static std::runtime_error FileError(const std::string& what, const std::string& path)
+{
+	return std::runtime_error(what + " " + path + "\n" + std::strerror(errno));
+}
+
+MappedFile::MappedFile(const std::string& path, const FileMapping mapping, const uint32_t size) : mapping(mapping)
+{
+	const bool shared = mapping == FileMapping::Shared;
+	const int file = shared ? open(path.c_str(), O_RDWR | O_CREAT, 0644) : open(path.c_str(), O_RDONLY);
+	if (file < 0)
+	{
+		throw FileError("Failed to open file:", path);
+	}
+
+	struct stat fileInfo;
+	if (fstat(file, &fileInfo) != 0)
+	{
+		close(file);
+		throw FileError("Failed to read size of file:", path);
+	}
+
+	const uint64_t fileSize = static_cast<uint64_t>(fileInfo.st_size);
+	const uint64_t wantedSize = shared ? size : fileSize;
+	if (wantedSize == 0 || wantedSize > 0xff'ff'f0'00)
+	{
+		close(file);
+		throw std::runtime_error("Mapped files has to be between 1 byte and 4 GiB.\nFile: " + path);
+	}
+	if (shared && fileSize < wantedSize && ftruncate(file, static_cast<off_t>(wantedSize)) != 0)
+	{
+		close(file);
+		throw FileError("Failed to extend file:", path);
+	}
+
+	this->size = static_cast<uint32_t>((wantedSize + PAGE_SIZE - 1) & ~static_cast<uint64_t>(PAGE_SIZE - 1));
+	//private so a read only mapping never can change the file
+	void* mapped = mmap(nullptr, this->size, shared ? (PROT_READ | PROT_WRITE) : PROT_READ,
+		shared ? MAP_SHARED : MAP_PRIVATE, file, 0);
+	//the mapping keeps the file alive on its own
+	close(file);
+	if (mapped == MAP_FAILED)
+	{
+		throw FileError("Failed to map file:", path);
+	}
+
+	data = static_cast<uint8_t*>(mapped);
+}
+
+MappedFile::~MappedFile()
+{
+	if (data != nullptr)
+	{
+		munmap(data, size);
+	}
+}
+
+#endif
+
+uint8_t* MappedFile::GetData() const
+{
+	return data;
+}
+
+uint32_t MappedFile::GetSize() const
+{
+	return size;
+}
+
+bool MappedFile::IsWritable() const
+{
+	return mapping == FileMapping::Shared;
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+enum class FileMapping : uint32_t
+{
+	//stores go straight to the file and persist after the run
+	Shared,
+	//the file is only read, stores are not allowed
+	ReadOnly
+};
+
+//A host file mapped into memory so it can be used as guest memory
+//without copying it. The mapping is always a whole number of pages,
+//bytes past the end of the file reads as 0.
+class MappedFile
+{
+private:
+	uint8_t* data = nullptr;
+	uint32_t size = 0;
+	FileMapping mapping;
+
+public:
+	//size is only used for shared mappings, the file is
+	//created or extended with zeros if it is smaller
+	MappedFile(const std::string& path, const FileMapping mapping, const uint32_t size);
+	MappedFile(const MappedFile&) = delete;
+	MappedFile& operator=(const MappedFile&) = delete;
+
+	uint8_t* GetData() const;
+	uint32_t GetSize() const;
+	bool IsWritable() const;
+
+	~MappedFile();
+};
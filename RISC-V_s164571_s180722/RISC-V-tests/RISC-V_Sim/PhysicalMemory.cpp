@@ -0,0 +1,359 @@
+#include "PhysicalMemory.h"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <algorithm>
+
+const uint8_t PhysicalMemory::UNMAPPED_PAGE;
+const uint8_t PhysicalMemory::RAM_PAGE;
+const uint8_t PhysicalMemory::WATCHED_PAGE;
+
+static uint32_t RoundUpToPages(const uint32_t ramSize)
+{
+	//round up to whole pages so no page is part ram and part device
+	if (ramSize == 0 || ramSize > 0xff'ff'f0'00)
+	{
+		throw std::runtime_error("Ram size has to be between 1 byte and 4 GiB - 4 KiB.\nSize: " + std::to_string(ramSize));
+	}
+	return (ramSize + 4096 - 1) & ~(4096 - 1);
+}
+
+PhysicalMemory::PhysicalMemory(const MemoryOptions& options) :
+	hostMemory(RoundUpToPages(options.ramSize), options),
+	ram(hostMemory.GetData()),
+	ramSize(RoundUpToPages(options.ramSize)),
+	pageTypes(PAGE_COUNT, UNMAPPED_PAGE)
+{
+	std::fill(pageTypes.begin(), pageTypes.begin() + (ramSize >> PAGE_SHIFT), RAM_PAGE);
+}
+
+static std::string OutOfRange(const uint32_t address)
+{
+	return "Memory access out of range.\nTried to access memory address " + std::to_string(address);
+}
+
+uint32_t PhysicalMemory::ReadSlow(const uint32_t address, const uint32_t size)
+{
+	//watched ram, or an access reaching into a watched page
+	if (IsRAM(address, size))
+	{
+		CheckWatchpoints(address, size, false, 0);
+		return ReadRAM(address, size);
+	}
+
+	const MappedRegion& region = FindRegion(address, size);
+	const uint32_t offset = address - region.base;
+	if (region.device)
+	{
+		return region.device->Read(offset, size);
+	}
+
+	uint32_t value = 0;
+	for (uint32_t i = 0; i < size; i++)
+	{
+		value |= static_cast<uint32_t>(region.data[offset + i]) << (i * 8);
+	}
+	return value;
+}
+
+void PhysicalMemory::WriteSlow(const uint32_t address, const uint32_t size, const uint32_t value)
+{
+	if (IsRAM(address, size))
+	{
+		CheckWatchpoints(address, size, true, value);
+		WriteRAM(address, size, value);
+		return;
+	}
+
+	const MappedRegion& region = FindRegion(address, size);
+	const uint32_t offset = address - region.base;
+	if (region.device)
+	{
+		region.device->Write(offset, size, value);
+		return;
+	}
+	if (!region.writable)
+	{
+		throw MemoryAccessFault("Tried to write to read only memory at address " + std::to_string(address), address);
+	}
+
+	for (uint32_t i = 0; i < size; i++)
+	{
+		region.data[offset + i] = static_cast<uint8_t>(value >> (i * 8));
+	}
+}
+
+uint32_t PhysicalMemory::ReadRAM(const uint32_t address, const uint32_t size)
+{
+	if (shared)
+	{
+		switch (size)
+		{
+			case 1:
+				return ReadShared<uint8_t>(address);
+			case 2:
+				return ReadShared<uint16_t>(address);
+			default:
+				return ReadShared<uint32_t>(address);
+		}
+	}
+
+	uint32_t value = 0;
+	for (uint32_t i = 0; i < size; i++)
+	{
+		value |= static_cast<uint32_t>(ram[address + i]) << (i * 8);
+	}
+	return value;
+}
+
+void PhysicalMemory::WriteRAM(const uint32_t address, const uint32_t size, const uint32_t value)
+{
+	if (shared)
+	{
+		switch (size)
+		{
+			case 1:
+				WriteShared<uint8_t>(address, static_cast<uint8_t>(value));
+				return;
+			case 2:
+				WriteShared<uint16_t>(address, static_cast<uint16_t>(value));
+				return;
+			default:
+				WriteShared<uint32_t>(address, value);
+				return;
+		}
+	}
+
+	for (uint32_t i = 0; i < size; i++)
+	{
+		ram[address + i] = static_cast<uint8_t>(value >> (i * 8));
+	}
+}
+
+const PhysicalMemory::MappedRegion& PhysicalMemory::FindRegion(const uint32_t address, const uint32_t size) const
+{
+	const uint8_t pageType = pageTypes[address >> PAGE_SHIFT];
+	if (pageType < FIRST_REGION_PAGE)
+	{
+		throw MemoryAccessFault(OutOfRange(address), address);
+	}
+
+	//accesses can't continue past the end of a region
+	const MappedRegion& region = regions[pageType - FIRST_REGION_PAGE];
+	if (address - region.base > region.size - size)
+	{
+		throw MemoryAccessFault(OutOfRange(address), address);
+	}
+	return region;
+}
+
+void PhysicalMemory::MapDevice(const uint32_t base, const uint32_t size, std::shared_ptr<Device> device)
+{
+	MapRegion({ base, size, device, nullptr, true });
+}
+
+void PhysicalMemory::MapHostMemory(const uint32_t base, const uint32_t size, uint8_t* data, const bool writable)
+{
+	MapRegion({ base, size, nullptr, data, writable });
+}
+
+void PhysicalMemory::MapRegion(const MappedRegion& region)
+{
+	const uint32_t base = region.base;
+	const uint32_t size = region.size;
+	if ((base & (PAGE_SIZE - 1)) != 0 || size == 0 || (size & (PAGE_SIZE - 1)) != 0 ||
+		static_cast<uint64_t>(base) + size > (static_cast<uint64_t>(PAGE_COUNT) << PAGE_SHIFT))
+	{
+		throw std::runtime_error("Regions has to be mapped at whole pages.\nBase: " + std::to_string(base) + "\nSize: " + std::to_string(size));
+	}
+	if (regions.size() >= 256 - FIRST_REGION_PAGE)
+	{
+		throw std::runtime_error("Too many regions mapped.");
+	}
+
+	const uint32_t firstPage = base >> PAGE_SHIFT;
+	const uint32_t pageCount = size >> PAGE_SHIFT;
+	for (uint32_t i = firstPage; i < firstPage + pageCount; i++)
+	{
+		if (pageTypes[i] != UNMAPPED_PAGE)
+		{
+			throw std::runtime_error("Region overlaps already mapped memory at address " + std::to_string(i << PAGE_SHIFT));
+		}
+	}
+
+	const uint8_t pageType = static_cast<uint8_t>(regions.size() + FIRST_REGION_PAGE);
+	regions.push_back(region);
+	std::fill(pageTypes.begin() + firstPage, pageTypes.begin() + firstPage + pageCount, pageType);
+}
+
+bool PhysicalMemory::IsWatched(const uint32_t address, const uint32_t size) const
+{
+	return pageTypes[address >> PAGE_SHIFT] == WATCHED_PAGE || pageTypes[(address + size - 1) >> PAGE_SHIFT] == WATCHED_PAGE;
+}
+
+void PhysicalMemory::CheckWatchpoints(const uint32_t address, const uint32_t size, const bool isWrite, const uint32_t newValue)
+{
+	if (!IsWatched(address, size))
+	{
+		return;
+	}
+
+	const WatchType accessType = isWrite ? WatchType::Write : WatchType::Read;
+	for (const Watchpoint& watchpoint : watchpoints)
+	{
+		const bool overlaps = address < watchpoint.address + watchpoint.size && watchpoint.address < address + size;
+		if (overlaps && (static_cast<uint32_t>(watchpoint.type) & static_cast<uint32_t>(accessType)))
+		{
+			const uint32_t oldValue = ReadRAM(address, size);
+			throw WatchpointHit{ watchpoint, address, size, isWrite, oldValue, isWrite ? newValue : oldValue, 0, "" };
+		}
+	}
+}
+
+void PhysicalMemory::AddWatchpoint(const Watchpoint& watchpoint)
+{
+	if (watchpoint.size == 0 || watchpoint.address >= ramSize || watchpoint.size > ramSize - watchpoint.address)
+	{
+		throw std::runtime_error("Watchpoints has to be inside ram.\nAddress: " + std::to_string(watchpoint.address) + "\nSize: " + std::to_string(watchpoint.size));
+	}
+
+	watchpoints.push_back(watchpoint);
+	const uint32_t lastPage = (watchpoint.address + watchpoint.size - 1) >> PAGE_SHIFT;
+	std::fill(pageTypes.begin() + (watchpoint.address >> PAGE_SHIFT), pageTypes.begin() + lastPage + 1, WATCHED_PAGE);
+	hasWatchpoints = true;
+}
+
+void PhysicalMemory::ClearWatchpoints()
+{
+	watchpoints.clear();
+	hasWatchpoints = false;
+	std::fill(pageTypes.begin(), pageTypes.begin() + (ramSize >> PAGE_SHIFT), RAM_PAGE);
+}
+
+void PhysicalMemory::ClearRAM()
+{
+	hostMemory.Clear();
+}
+
+static uint32_t ApplyAtomicOp(const AtomicOp op, const uint32_t word, const uint32_t value)
+{
+	switch (op)
+	{
+		case AtomicOp::Swap:
+			return value;
+		case AtomicOp::Add:
+			return word + value;
+		case AtomicOp::Xor:
+			return word ^ value;
+		case AtomicOp::And:
+			return word & value;
+		case AtomicOp::Or:
+			return word | value;
+		case AtomicOp::Min:
+			return std::min(static_cast<int32_t>(word), static_cast<int32_t>(value));
+		case AtomicOp::Max:
+			return std::max(static_cast<int32_t>(word), static_cast<int32_t>(value));
+		case AtomicOp::MinUnsigned:
+			return std::min(word, value);
+		default:
+			return std::max(word, value);
+	}
+}
+
+//Ram is always accessed as a host atomic, even on watched pages, so
+//the harts sharing it see the whole operation or nothing of it
+uint32_t PhysicalMemory::LoadWord(const uint32_t address, const std::memory_order order)
+{
+	if (!IsRAM(address, 4))
+	{
+		return ReadWord(address);
+	}
+	CheckWatchpoints(address, 4, false, 0);
+	return ToGuestOrder(AtomicRAM<uint32_t>(address).load(order));
+}
+
+uint32_t PhysicalMemory::AtomicWord(const AtomicOp op, const uint32_t address, const uint32_t value, const std::memory_order order)
+{
+	if (!IsRAM(address, 4))
+	{
+		const uint32_t word = ReadWord(address);
+		WriteWord(address, ApplyAtomicOp(op, word, value));
+		return word;
+	}
+	if (IsWatched(address, 4))
+	{
+		CheckWatchpoints(address, 4, false, 0);
+		CheckWatchpoints(address, 4, true, ApplyAtomicOp(op, ReadRAM(address, 4), value));
+	}
+
+	std::atomic<uint32_t>& word = AtomicRAM<uint32_t>(address);
+	//the host has instructions for these, the rest is a compare exchange loop
+	if (!HOST_IS_BIG_ENDIAN)
+	{
+		switch (op)
+		{
+			case AtomicOp::Swap:
+				return word.exchange(value, order);
+			case AtomicOp::Add:
+				return word.fetch_add(value, order);
+			case AtomicOp::Xor:
+				return word.fetch_xor(value, order);
+			case AtomicOp::And:
+				return word.fetch_and(value, order);
+			case AtomicOp::Or:
+				return word.fetch_or(value, order);
+			default:
+				break;
+		}
+	}
+
+	uint32_t old = word.load(std::memory_order_relaxed);
+	while (!word.compare_exchange_weak(old, ToGuestOrder(ApplyAtomicOp(op, ToGuestOrder(old), value)), order, std::memory_order_relaxed))
+	{
+	}
+	return ToGuestOrder(old);
+}
+
+bool PhysicalMemory::CompareExchangeWord(const uint32_t address, const uint32_t expected, const uint32_t desired, const std::memory_order order)
+{
+	if (!IsRAM(address, 4))
+	{
+		if (ReadWord(address) != expected)
+		{
+			return false;
+		}
+		WriteWord(address, desired);
+		return true;
+	}
+	if (IsWatched(address, 4))
+	{
+		CheckWatchpoints(address, 4, false, 0);
+		if (ReadRAM(address, 4) == expected)
+		{
+			CheckWatchpoints(address, 4, true, desired);
+		}
+	}
+
+	uint32_t old = ToGuestOrder(expected);
+	return AtomicRAM<uint32_t>(address).compare_exchange_strong(old, ToGuestOrder(desired), order, std::memory_order_relaxed);
+}
+
+void PhysicalMemory::SetShared(const bool value)
+{
+	shared = value;
+}
+
+bool PhysicalMemory::IsShared() const
+{
+	return shared;
+}
+
+uint32_t PhysicalMemory::GetRAMSize() const
+{
+	return ramSize;
+}
+
+MemoryBackingInfo PhysicalMemory::GetBackingInfo() const
+{
+	return hostMemory.GetBackingInfo();
+}
@@ -0,0 +1,315 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "Device.h"
+#include "Watchpoint.h"
+#include "HostMemory.h"
+
+//read-modify-write operations of the amo instructions
+enum class AtomicOp
+{
+	Swap,
+	Add,
+	Xor,
+	And,
+	Or,
+	Min,
+	Max,
+	MinUnsigned,
+	MaxUnsigned
+};
+
+//Thrown for an access to an address nothing is mapped at and for a
+//store to read only memory. The processor turns it into an access
+//fault trap for the guest
+struct MemoryAccessFault : public std::runtime_error
+{
+	uint32_t address;
+
+	MemoryAccessFault(const std::string& message, const uint32_t address) : std::runtime_error(message), address(address)
+	{
+	}
+};
+
+//The physical address space of the guest. Every 4 KiB page is
+//tagged as unmapped, RAM, watched RAM or belonging to a mapped region,
+//which is either a device or host memory such as a mapped file. RAM
+//always starts at address 0. Accesses to RAM pages only cost looking
+//up the tag of the page. Everything else goes through the slow path
+//which checks watchpoints or dispatches to the region owning the page.
+//When harts on several threads share the memory, RAM accesses are
+//done as relaxed host atomics so aligned accesses are never torn,
+//which needs no barriers on common hosts.
+class PhysicalMemory
+{
+private:
+	const static uint32_t PAGE_SHIFT = 12;
+	const static uint32_t PAGE_SIZE = 1 << PAGE_SHIFT;
+	const static uint32_t PAGE_COUNT = 1 << (32 - PAGE_SHIFT);
+	const static uint8_t UNMAPPED_PAGE = 0;
+	const static uint8_t RAM_PAGE = 1;
+	//ram with at least one watched byte
+	const static uint8_t WATCHED_PAGE = 2;
+	const static uint8_t FIRST_REGION_PAGE = 3;
+
+	//device is null for regions backed directly by host memory
+	struct MappedRegion
+	{
+		uint32_t base;
+		uint32_t size;
+		std::shared_ptr<Device> device;
+		uint8_t* data;
+		bool writable;
+	};
+
+	HostMemory hostMemory;
+	uint8_t* ram;
+	bool shared = false;
+	uint32_t ramSize;
+	std::vector<uint8_t> pageTypes;
+	std::vector<MappedRegion> regions;
+	std::vector<Watchpoint> watchpoints;
+	bool hasWatchpoints = false;
+
+	bool IsFastRAM(const uint32_t address, const uint32_t size) const;
+	bool IsWatched(const uint32_t address, const uint32_t size) const;
+	void CheckWatchpoints(const uint32_t address, const uint32_t size, const bool isWrite, const uint32_t newValue);
+	void MapRegion(const MappedRegion& region);
+	const MappedRegion& FindRegion(const uint32_t address, const uint32_t size) const;
+
+	uint32_t ReadSlow(const uint32_t address, const uint32_t size);
+	void WriteSlow(const uint32_t address, const uint32_t size, const uint32_t value);
+	//ram without checking watchpoints, done like the fast path does it
+	uint32_t ReadRAM(const uint32_t address, const uint32_t size);
+	void WriteRAM(const uint32_t address, const uint32_t size, const uint32_t value);
+	template<typename T> T ReadShared(const uint32_t address);
+	template<typename T> void WriteShared(const uint32_t address, const T value);
+
+public:
+	PhysicalMemory(const MemoryOptions& options);
+	PhysicalMemory(const PhysicalMemory&) = delete;
+	PhysicalMemory& operator=(const PhysicalMemory&) = delete;
+
+	bool IsRAM(const uint32_t address, const uint32_t size) const;
+	uint8_t  ReadByte    (const uint32_t address);
+	uint16_t ReadHalfWord(const uint32_t address);
+	uint32_t ReadWord    (const uint32_t address);
+	void WriteByte    (const uint32_t address, const uint8_t  byte    );
+	void WriteHalfWord(const uint32_t address, const uint16_t halfWord);
+	void WriteWord    (const uint32_t address, const uint32_t word    );
+
+	//atomic accesses of aligned words with the given host ordering.
+	//Words of devices and mapped host memory are read and written
+	//in two steps and are only atomic for one hart
+	uint32_t LoadWord(const uint32_t address, const std::memory_order order);
+	//does op with value on the word and returns the old word
+	uint32_t AtomicWord(const AtomicOp op, const uint32_t address, const uint32_t value, const std::memory_order order);
+	//stores desired if the word is expected, returns whether it did
+	bool CompareExchangeWord(const uint32_t address, const uint32_t expected, const uint32_t desired, const std::memory_order order);
+
+	void MapDevice(const uint32_t base, const uint32_t size, std::shared_ptr<Device> device);
+	void MapHostMemory(const uint32_t base, const uint32_t size, uint8_t* data, const bool writable);
+	void AddWatchpoint(const Watchpoint& watchpoint);
+	void ClearWatchpoints();
+	void ClearRAM();
+	//set before harts on more than one thread use the memory
+	void SetShared(const bool value);
+	bool IsShared() const;
+	//RAM at address as a host atomic, the address has to be aligned and
+	//the value is in host byte order, see ToGuestOrder
+	template<typename T> std::atomic<T>& AtomicRAM(const uint32_t address);
+	uint32_t GetRAMSize() const;
+	MemoryBackingInfo GetBackingInfo() const;
+};
+
+inline bool PhysicalMemory::IsRAM(const uint32_t address, const uint32_t size) const
+{
+	return address <= ramSize - size;
+}
+
+inline bool PhysicalMemory::IsFastRAM(const uint32_t address, const uint32_t size) const
+{
+	//the pages are only looked at once something is watched, an
+	//access can end on the next page which has to be unwatched too
+	const uint8_t* const types = pageTypes.data();
+	return IsRAM(address, size) &&
+		(!hasWatchpoints || (types[address >> PAGE_SHIFT] != WATCHED_PAGE && types[(address + size - 1) >> PAGE_SHIFT] != WATCHED_PAGE));
+}
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t) && sizeof(std::atomic<uint16_t>) == sizeof(uint16_t) &&
+			  sizeof(std::atomic<uint8_t>) == sizeof(uint8_t), "Guest RAM is accessed as host atomics");
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+const bool HOST_IS_BIG_ENDIAN = true;
+#else
+const bool HOST_IS_BIG_ENDIAN = false;
+#endif
+
+//guest memory is little endian, atomics see it in host byte order
+template<typename T>
+inline T ToGuestOrder(const T value)
+{
+	if (!HOST_IS_BIG_ENDIAN)
+	{
+		return value;
+	}
+
+	T swapped = 0;
+	for (uint32_t i = 0; i < sizeof(T); i++)
+	{
+		swapped |= static_cast<T>(((value >> (8 * i)) & 0xff) << (8 * (sizeof(T) - 1 - i)));
+	}
+	return swapped;
+}
+
+template<typename T>
+inline std::atomic<T>& PhysicalMemory::AtomicRAM(const uint32_t address)
+{
+	return *reinterpret_cast<std::atomic<T>*>(ram + address);
+}
+
+//misaligned accesses don't have to be atomic, so they are done a byte at a time
+template<typename T>
+inline T PhysicalMemory::ReadShared(const uint32_t address)
+{
+	if (address % sizeof(T) == 0)
+	{
+		return ToGuestOrder(AtomicRAM<T>(address).load(std::memory_order_relaxed));
+	}
+
+	T value = 0;
+	for (uint32_t i = 0; i < sizeof(T); i++)
+	{
+		value |= static_cast<T>(static_cast<T>(AtomicRAM<uint8_t>(address + i).load(std::memory_order_relaxed)) << (8 * i));
+	}
+	return value;
+}
+
+template<typename T>
+inline void PhysicalMemory::WriteShared(const uint32_t address, const T value)
+{
+	if (address % sizeof(T) == 0)
+	{
+		AtomicRAM<T>(address).store(ToGuestOrder(value), std::memory_order_relaxed);
+		return;
+	}
+
+	for (uint32_t i = 0; i < sizeof(T); i++)
+	{
+		AtomicRAM<uint8_t>(address + i).store(static_cast<uint8_t>(value >> (8 * i)), std::memory_order_relaxed);
+	}
+}
+
+inline uint8_t PhysicalMemory::ReadByte(const uint32_t address)
+{
+	if (!IsFastRAM(address, 1))
+	{
+		return static_cast<uint8_t>(ReadSlow(address, 1));
+	}
+	if (shared)
+	{
+		return ReadShared<uint8_t>(address);
+	}
+
+	return ram[address];
+}
+
+inline uint16_t PhysicalMemory::ReadHalfWord(const uint32_t address)
+{
+	if (!IsFastRAM(address, 2))
+	{
+		return static_cast<uint16_t>(ReadSlow(address, 2));
+	}
+	if (shared)
+	{
+		return ReadShared<uint16_t>(address);
+	}
+
+	const uint16_t t1 = static_cast<uint16_t>(ram[address + 0]);
+	const uint16_t t2 = static_cast<uint16_t>(ram[address + 1]);
+
+	return (t1 << 0) |
+		   (t2 << 8);
+}
+
+inline uint32_t PhysicalMemory::ReadWord(const uint32_t address)
+{
+	if (!IsFastRAM(address, 4))
+	{
+		return ReadSlow(address, 4);
+	}
+	if (shared)
+	{
+		return ReadShared<uint32_t>(address);
+	}
+
+	const uint32_t t1 = static_cast<uint32_t>(ram[address + 0]);
+	const uint32_t t2 = static_cast<uint32_t>(ram[address + 1]);
+	const uint32_t t3 = static_cast<uint32_t>(ram[address + 2]);
+	const uint32_t t4 = static_cast<uint32_t>(ram[address + 3]);
+
+	return (t1 <<  0) |
+		   (t2 <<  8) |
+		   (t3 << 16) |
+		   (t4 << 24);
+}
+
+inline void PhysicalMemory::WriteByte(const uint32_t address, const uint8_t byte)
+{
+	if (!IsFastRAM(address, 1))
+	{
+		WriteSlow(address, 1, byte);
+		return;
+	}
+	if (shared)
+	{
+		WriteShared<uint8_t>(address, byte);
+		return;
+	}
+
+	ram[address] = byte;
+}
+
+inline void PhysicalMemory::WriteHalfWord(const uint32_t address, const uint16_t halfWord)
+{
+	if (!IsFastRAM(address, 2))
+	{
+		WriteSlow(address, 2, halfWord);
+		return;
+	}
+	if (shared)
+	{
+		WriteShared<uint16_t>(address, halfWord);
+		return;
+	}
+
+	//byte stores may alias the members, so only read ram once
+	uint8_t* const bytes = ram + address;
+	bytes[0] = static_cast<uint8_t>(halfWord >> 0);
+	bytes[1] = static_cast<uint8_t>(halfWord >> 8);
+}
+
+inline void PhysicalMemory::WriteWord(const uint32_t address, const uint32_t word)
+{
+	if (!IsFastRAM(address, 4))
+	{
+		WriteSlow(address, 4, word);
+		return;
+	}
+	if (shared)
+	{
+		WriteShared<uint32_t>(address, word);
+		return;
+	}
+
+	uint8_t* const bytes = ram + address;
+	bytes[0] = static_cast<uint8_t>(word >>  0);
+	bytes[1] = static_cast<uint8_t>(word >>  8);
+	bytes[2] = static_cast<uint8_t>(word >> 16);
+	bytes[3] = static_cast<uint8_t>(word >> 24);
+}
@@ -5,48 +5,183 @@
 #include <algorithm>
 #include <memory>
 #include <vector>
+#include <atomic>
+#include <chrono>
+#include <sstream>
 #include "InstructionDecode.h"
 #include "Register.h"
+#include "CSR.h"
+#include "InstructionEncode.h"
+#include "AsyncTraceWriter.h"
+#include "ExecutionTrace.h"
 
 
-Processor::Processor()
+Processor::Processor() : Processor(DefaultMemoryOptions())
+{
+}
+
+Processor::Processor(const MemoryOptions& memoryOptions) :
+	initialStackPointer(memoryOptions.ramSize),
+	memoryOwner(std::make_shared<PhysicalMemory>(memoryOptions)),
+	memory(*memoryOwner),
+	mmu(memory)
 {
-	memory = new uint8_t[Processor::MEMORY_SIZE];
 	Reset();
 }
 
+Processor::Processor(std::shared_ptr<PhysicalMemory> sharedMemory, const uint32_t hartId) :
+	initialStackPointer(sharedMemory->GetRAMSize()),
+	memoryOwner(sharedMemory),
+	memory(*memoryOwner),
+	mmu(memory),
+	hartId(hartId)
+{
+	Reset();
+}
+
+MemoryOptions Processor::DefaultMemoryOptions()
+{
+	return { Processor::MEMORY_SIZE, false, false };
+}
+
 void Processor::Run(const uint32_t* rawInstructions, const size_t instructionCount)
+{
+	Load(rawInstructions, instructionCount);
+	if (RunFor(UINT64_MAX) == RunStatus::Trap)
+	{
+		throw std::runtime_error(GetUnhandledTrapMessage());
+	}
+}
+
+void Processor::Load(const uint32_t* rawInstructions, const size_t instructionCount, const uint32_t decodeThreadCount)
+{
+	Load(DecodeInstructions(rawInstructions, instructionCount, decodeThreadCount), 0, 0, { rawInstructions, instructionCount });
+}
+
+void Processor::Load(std::shared_ptr<const std::vector<Instruction>> decodedInstructions)
+{
+	Load(std::move(decodedInstructions), 0, 0);
+}
+
+void Processor::Load(std::shared_ptr<const std::vector<Instruction>> decodedInstructions, const uint32_t instructionBase, const uint32_t entry,
+	const InstructionView code)
 {
 	Reset();
-	const std::unique_ptr<std::vector<Instruction>> instructions = DecodeInstructions(rawInstructions, instructionCount);
+	instructions = std::move(decodedInstructions);
+	this->instructionBase = instructionBase;
+	this->code = code;
+	pc = entry;
 
 	//set stack pointer
-	registers[static_cast<uint32_t>(Regs::sp)].word = Processor::MEMORY_SIZE;
+	registers[static_cast<uint32_t>(Regs::sp)].uword = initialStackPointer;
+}
 
-	while (true)
+//RunFor returns from several places, and by throwing, while the caller
+//may print the result right away, so the printed trace catches up on the way out
+class ConsoleTraceDrain
+{
+private:
+	AsyncTraceWriter* trace;
+
+public:
+	explicit ConsoleTraceDrain(AsyncTraceWriter* trace) : trace(trace)
 	{
-		const uint32_t instructionIndex = pc / 4;
-		if (instructionIndex >= instructionCount)
+	}
+	~ConsoleTraceDrain()
+	{
+		if (trace)
 		{
-			throw std::runtime_error("Index out of bounds.\nTried to access instruction: " + std::to_string(instructionIndex));
+			trace->Drain();
 		}
+	}
+};
 
-		const Instruction& instruction = instructions->at(instructionIndex);
-		const bool stopProgram = RunInstruction(instruction);
+RunStatus Processor::RunFor(const uint64_t maxInstructions)
+{
+	if (!instructions)
+	{
+		throw std::runtime_error("No program has been loaded.");
+	}
+	if (maxInstructions == 0)
+	{
+		return RunStatus::BudgetExhausted;
+	}
+	const size_t instructionCount = instructions->size();
+	//jumps and branches stop the program once the instructions before
+	//them have reached this, so the check is only done per basic block
+	budgetEnd = (maxInstructions > UINT64_MAX - instructionsExecuted) ? UINT64_MAX : instructionsExecuted + maxInstructions - 1;
+	stopStatus = RunStatus::BudgetExhausted;
+	const ConsoleTraceDrain drain(consoleTrace.get());
 
-		if (printExecutedInstruction || debugEnabled)
+	//the try block is outside the instruction loop so
+	//the loop itself is the same as without traps
+	while (true)
+	{
+		try
 		{
-			std::cout << std::to_string(instructionIndex) << ": " << InstructionAsString(instruction) << std::endl;
+			while (true)
+			{
+				//an address below the base wraps around to a too large index
+				const uint32_t instructionIndex = (TranslateAddress(pc, 4, AccessType::Execute) - instructionBase) / 4;
+				if (instructionIndex >= instructionCount)
+				{
+					throw Trap{ TrapCause::InstructionAccessFault, pc };
+				}
+
+				const Instruction& instruction = (*instructions)[instructionIndex];
+				if (trace)
+				{
+					BeginTraceRecord(instruction, instructionIndex);
+				}
+				const bool stopProgram = RunInstruction(instruction);
+				instructionsExecuted++;
+				if (trace)
+				{
+					EndTraceRecord(instruction);
+				}
+
+				if (debugEnabled)
+				{
+					DrainConsoleTrace();
+					std::cout << std::to_string(instructionIndex) << ": " << InstructionAsString(instruction) << std::endl;
+					PrintRegisters();
+					std::cin.get();
+				}
+
+				if (stopProgram)
+				{
+					budgetEnd = UINT64_MAX;
+					return stopStatus;
+				}
+			}
 		}
-		if (debugEnabled)
+		catch (const Trap& trap)
 		{
-			PrintRegisters();
-			std::cin.get();
+			//the faulting instruction didn't change any state
+			//so just continue from the trap handler
+			if (!TakeTrap(trap))
+			{
+				unhandledTrap = trap;
+				budgetEnd = UINT64_MAX;
+				return RunStatus::Trap;
+			}
+			//a trap is the end of a block too, otherwise a
+			//handler that keeps faulting would never stop
+			if (instructionsExecuted > budgetEnd)
+			{
+				budgetEnd = UINT64_MAX;
+				return RunStatus::BudgetExhausted;
+			}
 		}
-
-		if (stopProgram)
+		catch (WatchpointHit& hit)
 		{
-			break;
+			//the access wasn't done so pc still points at the instruction
+			hit.pc = pc;
+			hit.instruction = InstructionAsString(instructions->at((TranslateAddress(pc, 4, AccessType::Execute) - instructionBase) / 4));
+			watchpointHit = hit;
+			hasWatchpointHit = true;
+			budgetEnd = UINT64_MAX;
+			return RunStatus::WatchpointHit;
 		}
 	}
 }
@@ -77,9 +212,16 @@ bool Processor::RunInstruction(const Instruction& instruction)
 			registers[instruction.rd].uword = static_cast<uint32_t>(GetHalfWordFromMemory(registers[instruction.rs1].word + instruction.immediate));
 			pc += 4;
 			break;
+		//harts on other threads see every access before the fence
+		//before any access after it
 		case InstructionType::fence:
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			pc += 4;
+			break;
+		//instructions are decoded once and can't be modified
 		case InstructionType::fence_i:
-			throw std::runtime_error("Instruction not implemented yet.");
+			pc += 4;
+			break;
 		case InstructionType::addi:
 			registers[instruction.rd].word = registers[instruction.rs1].word + instruction.immediate;
 			pc += 4;
@@ -178,37 +320,55 @@ bool Processor::RunInstruction(const Instruction& instruction)
 			break;
 		case InstructionType::beq:
 			pc = (registers[instruction.rs1].word ==  registers[instruction.rs2].word)  ? pc + instruction.immediate : pc + 4;
+			stopProgram = instructionsExecuted >= budgetEnd;
 			break;
 		case InstructionType::bne:
 			pc = (registers[instruction.rs1].word !=  registers[instruction.rs2].word)  ? pc + instruction.immediate : pc + 4;
+			stopProgram = instructionsExecuted >= budgetEnd;
 			break;
 		case InstructionType::blt:
 			pc = (registers[instruction.rs1].word <   registers[instruction.rs2].word)  ? pc + instruction.immediate : pc + 4;
+			stopProgram = instructionsExecuted >= budgetEnd;
 			break;
 		case InstructionType::bge:
 			pc = (registers[instruction.rs1].word >=  registers[instruction.rs2].word)  ? pc + instruction.immediate : pc + 4;
+			stopProgram = instructionsExecuted >= budgetEnd;
 			break;
 		case InstructionType::bltu:
 			pc = (registers[instruction.rs1].uword <  registers[instruction.rs2].uword) ? pc + instruction.immediate : pc + 4;
+			stopProgram = instructionsExecuted >= budgetEnd;
 			break;
 		case InstructionType::bgeu:
 			pc = (registers[instruction.rs1].uword >= registers[instruction.rs2].uword) ? pc + instruction.immediate : pc + 4;
+			stopProgram = instructionsExecuted >= budgetEnd;
 			break;
 		case InstructionType::jalr:
 			registers[instruction.rd].uword = pc + 4;
 			pc = registers[instruction.rs1].word + instruction.immediate;
+			stopProgram = instructionsExecuted >= budgetEnd;
 			break;
 		case InstructionType::jal:
 			registers[instruction.rd].uword = pc + 4;
 			pc = pc + instruction.immediate;
+			stopProgram = instructionsExecuted >= budgetEnd;
 			break;
 		case InstructionType::ecall:
 			EnvironmentCall(&stopProgram);
 			pc += 4;
 			break;
 		case InstructionType::ebreak:
-			PrintRegisters();
-			std::cin.get();
+			//without a console the caller decides what
+			//to do and can continue after the ebreak
+			if (useConsole)
+			{
+				PrintRegisters();
+				std::cin.get();
+			}
+			else
+			{
+				stopStatus = RunStatus::Breakpoint;
+				stopProgram = true;
+			}
 			pc += 4;
 			break;
 		case InstructionType::csrrw:
@@ -217,7 +377,9 @@ bool Processor::RunInstruction(const Instruction& instruction)
 		case InstructionType::csrrwi:
 		case InstructionType::csrrsi:
 		case InstructionType::csrrci:
-			throw std::runtime_error("Instruction not implemented yet.");
+			RunCSRInstruction(instruction);
+			pc += 4;
+			break;
 		case InstructionType::mul:
 			registers[instruction.rd].word = registers[instruction.rs1].word * registers[instruction.rs2].word;
 			pc += 4;
@@ -275,6 +437,20 @@ bool Processor::RunInstruction(const Instruction& instruction)
 			}
 			pc += 4;
 			break;
+		case InstructionType::lr_w:
+		case InstructionType::sc_w:
+		case InstructionType::amoswap_w:
+		case InstructionType::amoadd_w:
+		case InstructionType::amoxor_w:
+		case InstructionType::amoand_w:
+		case InstructionType::amoor_w:
+		case InstructionType::amomin_w:
+		case InstructionType::amomax_w:
+		case InstructionType::amominu_w:
+		case InstructionType::amomaxu_w:
+			RunAtomicInstruction(instruction);
+			pc += 4;
+			break;
 		case InstructionType::remu:
 			if (registers[instruction.rs2].uword == 0)
 			{
@@ -287,7 +463,9 @@ bool Processor::RunInstruction(const Instruction& instruction)
 			pc += 4;
 			break;
 		default:
-			throw std::runtime_error("instruction identifier not recognized. iid: " + NumberToBits(static_cast<uint32_t>(instruction.type)));
+			//privileged instructions are rare so they are kept out of
+			//the main switch to not slow down the common instructions
+			stopProgram = RunPrivilegedInstruction(instruction);
 			break;
 	}
 	//the 0'th register can only be 0
@@ -311,6 +489,7 @@ void Processor::EnvironmentCall(bool* stopProgram)
 {
 	if (registers[static_cast<uint32_t>(Regs::a0)].word == 10)
 	{
+		stopStatus = RunStatus::Exited;
 		*stopProgram = true;
 	}
 }
@@ -337,11 +516,146 @@ void Processor::SetDebugMode(const bool useDebugMode)
 }
 void Processor::SetPrintExecutedInstruction(const bool value)
 {
+	if (value != printExecutedInstruction)
+	{
+		//turning it off waits for the lines still in the ring
+		consoleTrace = value ? std::make_shared<AsyncTraceWriter>(std::make_shared<TextTraceWriter>(std::cout)) : nullptr;
+		trace = consoleTrace;
+	}
 	printExecutedInstruction = value;
 }
+void Processor::SetUseConsole(const bool value)
+{
+	useConsole = value;
+}
+
+void Processor::SetTrace(std::shared_ptr<TraceSink> sink, const InstructionView code)
+{
+	trace = std::move(sink);
+	this->code = code;
+	consoleTrace = nullptr;
+	printExecutedInstruction = false;
+}
+
+static bool IsTracedLoad(const InstructionType type)
+{
+	return (type >= InstructionType::lb && type <= InstructionType::lhu) || type == InstructionType::lr_w;
+}
+
+static bool IsTracedStore(const InstructionType type)
+{
+	return (type >= InstructionType::sb && type <= InstructionType::sw) || type == InstructionType::sc_w;
+}
+
+static bool IsTracedAtomic(const InstructionType type)
+{
+	return type >= InstructionType::amoswap_w && type <= InstructionType::amomaxu_w;
+}
+
+//everything except stores and branches has an rd, but these never write it
+static bool WritesRd(const InstructionType type)
+{
+	switch (type)
+	{
+		case InstructionType::fence:
+		case InstructionType::fence_i:
+		case InstructionType::ecall:
+		case InstructionType::ebreak:
+		case InstructionType::sret:
+		case InstructionType::mret:
+		case InstructionType::sfence_vma:
+		case InstructionType::wfi:
+			return false;
+		default:
+			return true;
+	}
+}
+
+uint32_t Processor::GetRawInstruction(const uint32_t instructionIndex) const
+{
+	return (instructionIndex < code.size) ? code[instructionIndex] : 0;
+}
+
+//the operands are read before the instruction runs as it may overwrite them
+void Processor::BeginTraceRecord(const Instruction& instruction, const uint32_t instructionIndex)
+{
+	traceRecord.pc = pc;
+	traceRecord.rawInstruction = GetRawInstruction(instructionIndex);
+	traceRecord.rd = instruction.rd;
+	traceRecord.flags = (instruction.rd != 0 && WritesRd(instruction.type)) ? TRACE_WRITES_RD : 0;
+	traceRecord.rdValue = 0;
+	traceRecord.memoryAddress = 0;
+	traceRecord.memoryValue = 0;
+
+	const InstructionType type = instruction.type;
+	if (IsTracedLoad(type) || IsTracedStore(type) || IsTracedAtomic(type))
+	{
+		//atomics have no immediate, it holds the ordering bits
+		const bool hasImmediate = type != InstructionType::lr_w && type != InstructionType::sc_w && !IsTracedAtomic(type);
+		traceRecord.memoryAddress = registers[instruction.rs1].uword + (hasImmediate ? instruction.immediate : 0);
+	}
+	if (IsTracedStore(type))
+	{
+		traceRecord.flags |= TRACE_STORE;
+		const uint32_t value = registers[instruction.rs2].uword;
+		switch (type)
+		{
+			case InstructionType::sb:
+				traceRecord.memoryValue = value & 0xff;
+				break;
+			case InstructionType::sh:
+				traceRecord.memoryValue = value & 0xffff;
+				break;
+			default:
+				traceRecord.memoryValue = value;
+				break;
+		}
+	}
+	if (IsTracedLoad(type))
+	{
+		traceRecord.flags |= TRACE_LOAD;
+	}
+	if (IsTracedAtomic(type))
+	{
+		traceRecord.flags |= TRACE_LOAD | TRACE_STORE;
+	}
+
+	//a device may print when it's accessed. With paging the
+	//address isn't physical, so every access waits for the trace
+	const bool accessesMemory = (traceRecord.flags & (TRACE_LOAD | TRACE_STORE)) != 0;
+	if (consoleTrace && accessesMemory && (translationEnabled || !memory.IsRAM(traceRecord.memoryAddress, 1)))
+	{
+		DrainConsoleTrace();
+	}
+}
+
+//the printed trace is written on another thread, so it has to catch
+//up before the run thread prints anything after those instructions
+void Processor::DrainConsoleTrace()
+{
+	if (consoleTrace)
+	{
+		consoleTrace->Drain();
+	}
+}
+
+void Processor::EndTraceRecord(const Instruction& instruction)
+{
+	traceRecord.instruction = instructionsExecuted - 1;
+	if (traceRecord.flags & TRACE_WRITES_RD)
+	{
+		traceRecord.rdValue = registers[instruction.rd].uword;
+	}
+	if (traceRecord.flags & TRACE_LOAD)
+	{
+		traceRecord.memoryValue = registers[instruction.rd].uword;
+	}
+	trace->Write(traceRecord);
+}
 
 void Processor::PrintRegisters()
 {
+	DrainConsoleTrace();
 	std::cout << "Registers:" << std::endl;
 	uint32_t index = 0;
 	for(Register x : registers)
@@ -349,88 +663,651 @@ void Processor::PrintRegisters()
 		std::cout << std::setw(3) << RegisterName(index) << "  ";
 		std::cout << std::setw(10) << std::to_string(x.word) << "  ";
 		std::cout << NumberToBits(x.uword) << "   ";
-		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 0) << ": " << std::setw(10) << GetWordFromMemory(index * 4 + 32 * 4 * 0) << "  ";
-		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 1) << ": " << std::setw(10) << GetWordFromMemory(index * 4 + 32 * 4 * 1) << "  ";
-		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 2) << ": " << std::setw(10) << GetWordFromMemory(index * 4 + 32 * 4 * 2) << "  ";
-		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 3) << ": " << std::setw(10) << GetWordFromMemory(index * 4 + 32 * 4 * 3) << std::endl;
+		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 0) << ": " << std::setw(10) << GetPhysicalWord(index * 4 + 32 * 4 * 0) << "  ";
+		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 1) << ": " << std::setw(10) << GetPhysicalWord(index * 4 + 32 * 4 * 1) << "  ";
+		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 2) << ": " << std::setw(10) << GetPhysicalWord(index * 4 + 32 * 4 * 2) << "  ";
+		std::cout << std::setw(3) << std::to_string(index * 4 + 32 * 4 * 3) << ": " << std::setw(10) << GetPhysicalWord(index * 4 + 32 * 4 * 3) << std::endl;
 		index++;
 	}
 	std::cout << std::endl;
 }
 
-void Processor::VerifyMemorySpace(const int32_t index, const int32_t size)
+uint32_t Processor::TranslateVirtualAddress(const uint32_t address, const int32_t size, const AccessType access)
 {
-	if (index < 0 || index + size > Processor::MEMORY_SIZE)
+	//an access that spans two pages would need two translations,
+	//the spec allows trapping instead so do that
+	if ((address & 0xfff) + size > 4096)
 	{
-		throw std::runtime_error("Memory access out of range.\nTried to access memory address " + std::to_string(index));
+		throw Trap{ (access == AccessType::Store) ? TrapCause::StoreAddressMisaligned : TrapCause::LoadAddressMisaligned, address };
 	}
+	return mmu.Translate(address, access, privilege, mstatus);
 }
 
-uint8_t Processor::GetByteFromMemory(const int32_t index)
+//the memory throws for physical addresses without ram or a region and
+//for stores to read only regions, which the guest sees as access faults
+//of the virtual address. Nothing is done for accesses that succeed
+template<typename Access>
+static auto CheckAccessFault(const TrapCause cause, const uint32_t virtualAddress, const Access& access) -> decltype(access())
 {
-	VerifyMemorySpace(index, 1);
+	try
+	{
+		return access();
+	}
+	catch (const MemoryAccessFault&)
+	{
+		throw Trap{ cause, virtualAddress };
+	}
+}
 
-	return memory[index];
+uint8_t Processor::GetByteFromMemory(const int32_t virtualIndex)
+{
+	const uint32_t address = TranslateAddress(virtualIndex, 1, AccessType::Load);
+	return CheckAccessFault(TrapCause::LoadAccessFault, virtualIndex, [&]() { return memory.ReadByte(address); });
+}
+uint16_t Processor::GetHalfWordFromMemory(const int32_t virtualIndex)
+{
+	const uint32_t address = TranslateAddress(virtualIndex, 2, AccessType::Load);
+	return CheckAccessFault(TrapCause::LoadAccessFault, virtualIndex, [&]() { return memory.ReadHalfWord(address); });
 }
-uint16_t Processor::GetHalfWordFromMemory(const int32_t index)
+uint32_t Processor::GetWordFromMemory(const int32_t virtualIndex)
 {
-	VerifyMemorySpace(index, 2);
+	const uint32_t address = TranslateAddress(virtualIndex, 4, AccessType::Load);
+	return CheckAccessFault(TrapCause::LoadAccessFault, virtualIndex, [&]() { return GetPhysicalWord(address); });
+}
+uint32_t Processor::GetPhysicalWord(const int32_t index)
+{
+	return memory.ReadWord(index);
+}
 
-	const uint16_t t1 = static_cast<uint16_t>(memory[index + 0]);
-	const uint16_t t2 = static_cast<uint16_t>(memory[index + 1]);
+void Processor::StoreByteInMemory(const int32_t virtualIndex, const int8_t byte)
+{
+	const uint32_t address = TranslateAddress(virtualIndex, 1, AccessType::Store);
+	CheckAccessFault(TrapCause::StoreAccessFault, virtualIndex, [&]() { memory.WriteByte(address, static_cast<uint8_t>(byte)); });
+}
+void Processor::StoreHalfWordInMemory(const int32_t virtualIndex, const int16_t halfWord)
+{
+	const uint32_t address = TranslateAddress(virtualIndex, 2, AccessType::Store);
+	CheckAccessFault(TrapCause::StoreAccessFault, virtualIndex, [&]() { memory.WriteHalfWord(address, static_cast<uint16_t>(halfWord)); });
+}
+void Processor::StoreWordInMemory(const int32_t virtualIndex, const int32_t word)
+{
+	const uint32_t address = TranslateAddress(virtualIndex, 4, AccessType::Store);
+	CheckAccessFault(TrapCause::StoreAccessFault, virtualIndex, [&]() { memory.WriteWord(address, static_cast<uint32_t>(word)); });
+}
 
-	return (t1 << 0) |
-		   (t2 << 8);
+//aq and rl as the host ordering of the access
+static std::memory_order AtomicMemoryOrder(const int32_t orderingBits)
+{
+	switch (static_cast<AtomicOrdering>(orderingBits & 0b11))
+	{
+		case AtomicOrdering::Release:
+			return std::memory_order_release;
+		case AtomicOrdering::Acquire:
+			return std::memory_order_acquire;
+		case AtomicOrdering::AcquireRelease:
+			return std::memory_order_seq_cst;
+		default:
+			return std::memory_order_relaxed;
+	}
 }
-uint32_t Processor::GetWordFromMemory(const int32_t index)
+
+void Processor::RunAtomicInstruction(const Instruction& instruction)
 {
-	VerifyMemorySpace(index, 4);
+	const uint32_t virtualAddress = registers[instruction.rs1].uword;
+	const bool isLoadReserved = instruction.type == InstructionType::lr_w;
+	//unlike plain loads and stores atomics have to be aligned
+	if (virtualAddress % 4 != 0)
+	{
+		throw Trap{ isLoadReserved ? TrapCause::LoadAddressMisaligned : TrapCause::StoreAddressMisaligned, virtualAddress };
+	}
+	const uint32_t address = TranslateAddress(virtualAddress, 4, isLoadReserved ? AccessType::Load : AccessType::Store);
+	const std::memory_order order = AtomicMemoryOrder(instruction.immediate);
+	const uint32_t value = registers[instruction.rs2].uword;
 
-	const uint32_t t1 = static_cast<uint32_t>(memory[index + 0]);
-	const uint32_t t2 = static_cast<uint32_t>(memory[index + 1]);
-	const uint32_t t3 = static_cast<uint32_t>(memory[index + 2]);
-	const uint32_t t4 = static_cast<uint32_t>(memory[index + 3]);
+	uint32_t result;
+	try
+	{
+		switch (instruction.type)
+		{
+			case InstructionType::lr_w:
+				//a load can't be a release, so lr.w.rl orders like lr.w.aqrl
+				result = memory.LoadWord(address, (order == std::memory_order_release) ? std::memory_order_seq_cst : order);
+				hasReservation = true;
+				reservationAddress = address;
+				reservationValue = result;
+				break;
+			//fails if another hart changed the word since lr.w, but
+			//can't tell if it was changed and then changed back
+			case InstructionType::sc_w:
+			{
+				const bool isReserved = hasReservation && reservationAddress == address;
+				hasReservation = false;
+				result = (isReserved && memory.CompareExchangeWord(address, reservationValue, value, order)) ? 0 : 1;
+				break;
+			}
+			case InstructionType::amoswap_w:
+				result = memory.AtomicWord(AtomicOp::Swap, address, value, order);
+				break;
+			case InstructionType::amoadd_w:
+				result = memory.AtomicWord(AtomicOp::Add, address, value, order);
+				break;
+			case InstructionType::amoxor_w:
+				result = memory.AtomicWord(AtomicOp::Xor, address, value, order);
+				break;
+			case InstructionType::amoand_w:
+				result = memory.AtomicWord(AtomicOp::And, address, value, order);
+				break;
+			case InstructionType::amoor_w:
+				result = memory.AtomicWord(AtomicOp::Or, address, value, order);
+				break;
+			case InstructionType::amomin_w:
+				result = memory.AtomicWord(AtomicOp::Min, address, value, order);
+				break;
+			case InstructionType::amomax_w:
+				result = memory.AtomicWord(AtomicOp::Max, address, value, order);
+				break;
+			case InstructionType::amominu_w:
+				result = memory.AtomicWord(AtomicOp::MinUnsigned, address, value, order);
+				break;
+			default:
+				result = memory.AtomicWord(AtomicOp::MaxUnsigned, address, value, order);
+				break;
+		}
+	}
+	catch (const MemoryAccessFault&)
+	{
+		throw Trap{ isLoadReserved ? TrapCause::LoadAccessFault : TrapCause::StoreAccessFault, virtualAddress };
+	}
+	registers[instruction.rd].uword = result;
+}
 
-	return (t1 <<  0) |
-		   (t2 <<  8) |
-		   (t3 << 16) |
-		   (t4 << 24);
+uint32_t Processor::ReadCSR(const uint32_t csr)
+{
+	switch (static_cast<CSR>(csr))
+	{
+		case CSR::sstatus:
+			return mstatus & MStatus::SSTATUS_MASK;
+		case CSR::sie:
+			return mie & mideleg;
+		case CSR::stvec:
+			return stvec;
+		case CSR::sscratch:
+			return sscratch;
+		case CSR::sepc:
+			return sepc;
+		case CSR::scause:
+			return scause;
+		case CSR::stval:
+			return stval;
+		case CSR::sip:
+			return (mip | raisedInterrupts.load(std::memory_order_acquire)) & mideleg;
+		case CSR::satp:
+			return mmu.GetSATP();
+		case CSR::mstatus:
+			return mstatus;
+		case CSR::misa:
+			//RV32 with the I, M, A, S and U extensions
+			return (1 << 30) | (1 << 0) | (1 << 8) | (1 << 12) | (1 << 18) | (1 << 20);
+		case CSR::medeleg:
+			return medeleg;
+		case CSR::mideleg:
+			return mideleg;
+		case CSR::mie:
+			return mie;
+		case CSR::mtvec:
+			return mtvec;
+		case CSR::mscratch:
+			return mscratch;
+		case CSR::mepc:
+			return mepc;
+		case CSR::mcause:
+			return mcause;
+		case CSR::mtval:
+			return mtval;
+		case CSR::mip:
+			return mip | raisedInterrupts.load(std::memory_order_acquire);
+		case CSR::mhartid:
+			return hartId;
+		default:
+			throw Trap{ TrapCause::IllegalInstruction, 0 };
+	}
 }
 
-void Processor::StoreByteInMemory(const int32_t index, const int8_t byte)
+void Processor::WriteCSR(const uint32_t csr, const uint32_t value)
 {
-	VerifyMemorySpace(index, 1);
+	const uint32_t mstatusMask = MStatus::SIE | MStatus::MIE | MStatus::SPIE | MStatus::MPIE |
+								 MStatus::SPP | MStatus::MPP | MStatus::SUM  | MStatus::MXR;
+	switch (static_cast<CSR>(csr))
+	{
+		case CSR::sstatus:
+			mstatus = (mstatus & ~MStatus::SSTATUS_MASK) | (value & MStatus::SSTATUS_MASK);
+			break;
+		case CSR::sie:
+			mie = (mie & ~mideleg) | (value & mideleg);
+			break;
+		case CSR::stvec:
+			stvec = value;
+			break;
+		case CSR::sscratch:
+			sscratch = value;
+			break;
+		case CSR::sepc:
+			sepc = value & ~3;
+			break;
+		case CSR::scause:
+			scause = value;
+			break;
+		case CSR::stval:
+			stval = value;
+			break;
+		case CSR::sip:
+			mip = (mip & ~mideleg) | (value & mideleg);
+			break;
+		case CSR::satp:
+			//ASID isn't supported so only keep mode and root page number
+			mmu.SetSATP(value & 0x80'3f'ff'ff);
+			UpdateTranslationEnabled();
+			break;
+		case CSR::mstatus:
+			mstatus = value & mstatusMask;
+			break;
+		case CSR::misa:
+			break;
+		case CSR::medeleg:
+			medeleg = value;
+			break;
+		case CSR::mideleg:
+			mideleg = value;
+			break;
+		case CSR::mie:
+			mie = value;
+			break;
+		case CSR::mtvec:
+			mtvec = value;
+			break;
+		case CSR::mscratch:
+			mscratch = value;
+			break;
+		case CSR::mepc:
+			mepc = value & ~3;
+			break;
+		case CSR::mcause:
+			mcause = value;
+			break;
+		case CSR::mtval:
+			mtval = value;
+			break;
+		case CSR::mip:
+			mip = value;
+			break;
+		default:
+			throw Trap{ TrapCause::IllegalInstruction, 0 };
+	}
+}
+
+void Processor::RunCSRInstruction(const Instruction& instruction)
+{
+	const uint32_t csr = static_cast<uint32_t>(instruction.immediate) & 0xfff;
+	//bits 9:8 is the lowest privilege that can access the csr
+	//and bits 11:10 being all ones means it's read only
+	if (static_cast<uint32_t>(privilege) < ((csr >> 8) & 3))
+	{
+		throw Trap{ TrapCause::IllegalInstruction, 0 };
+	}
+
+	const bool isImmediate = (InstructionTypeFunct3(instruction.type) & 0b100) != 0;
+	const uint32_t source = isImmediate ? instruction.rs1 : registers[instruction.rs1].uword;
+	const uint32_t oldValue = ReadCSR(csr);
+
+	bool doWrite;
+	uint32_t newValue;
+	switch (instruction.type)
+	{
+		case InstructionType::csrrw:
+		case InstructionType::csrrwi:
+			doWrite = true;
+			newValue = source;
+			break;
+		case InstructionType::csrrs:
+		case InstructionType::csrrsi:
+			doWrite = instruction.rs1 != 0;
+			newValue = oldValue | source;
+			break;
+		default:
+			doWrite = instruction.rs1 != 0;
+			newValue = oldValue & ~source;
+			break;
+	}
+
+	if (doWrite)
+	{
+		if ((csr >> 10) == 3)
+		{
+			throw Trap{ TrapCause::IllegalInstruction, 0 };
+		}
+		WriteCSR(csr, newValue);
+	}
+	registers[instruction.rd].uword = oldValue;
+}
+
+bool Processor::RunPrivilegedInstruction(const Instruction& instruction)
+{
+	switch (instruction.type)
+	{
+		case InstructionType::wfi:
+			if (privilege == PrivilegeMode::User)
+			{
+				throw Trap{ TrapCause::IllegalInstruction, 0 };
+			}
+			pc += 4;
+			//interrupts aren't taken yet, so with one pending
+			//wfi just continues like the spec allows
+			if (!IsInterruptPending())
+			{
+				stopStatus = RunStatus::WaitingForInterrupt;
+				return true;
+			}
+			break;
+		case InstructionType::sret:
+			ReturnFromTrap(PrivilegeMode::Supervisor);
+			break;
+		case InstructionType::mret:
+			ReturnFromTrap(PrivilegeMode::Machine);
+			break;
+		case InstructionType::sfence_vma:
+			if (privilege == PrivilegeMode::User)
+			{
+				throw Trap{ TrapCause::IllegalInstruction, 0 };
+			}
+			if (instruction.rs1 == static_cast<uint32_t>(Regs::x0))
+			{
+				mmu.Flush();
+			}
+			else
+			{
+				mmu.FlushAddress(registers[instruction.rs1].uword);
+			}
+			pc += 4;
+			break;
+		default:
+			//a word the decoder didn't recognize, which decodes to 0
+			throw Trap{ TrapCause::IllegalInstruction, GetRawInstruction((TranslateAddress(pc, 4, AccessType::Execute) - instructionBase) / 4) };
+	}
+	return false;
+}
+
+void Processor::UpdateTranslationEnabled()
+{
+	translationEnabled = mmu.IsPagingEnabled() && privilege != PrivilegeMode::Machine;
+}
+
+bool Processor::TakeTrap(const Trap& trap)
+{
+	const uint32_t cause = static_cast<uint32_t>(trap.cause);
+	const bool delegated = privilege != PrivilegeMode::Machine && ((medeleg >> cause) & 1);
+	const uint32_t handler = delegated ? stvec : mtvec;
+
+	//programs without a trap handler would just jump to 0,
+	//so it's more helpful to stop the simulation here
+	if (handler == 0)
+	{
+		return false;
+	}
+	//the handler may switch to other code, which mustn't be able
+	//to complete the sc.w of the interrupted code
+	hasReservation = false;
+
+	if (delegated)
+	{
+		scause = cause;
+		sepc = pc;
+		stval = trap.value;
+		mstatus = (mstatus & MStatus::SIE) ? (mstatus | MStatus::SPIE) : (mstatus & ~MStatus::SPIE);
+		mstatus = (privilege == PrivilegeMode::Supervisor) ? (mstatus | MStatus::SPP) : (mstatus & ~MStatus::SPP);
+		mstatus &= ~MStatus::SIE;
+		privilege = PrivilegeMode::Supervisor;
+	}
+	else
+	{
+		mcause = cause;
+		mepc = pc;
+		mtval = trap.value;
+		mstatus = (mstatus & MStatus::MIE) ? (mstatus | MStatus::MPIE) : (mstatus & ~MStatus::MPIE);
+		mstatus = (mstatus & ~MStatus::MPP) | (static_cast<uint32_t>(privilege) << MStatus::MPP_SHIFT);
+		mstatus &= ~MStatus::MIE;
+		privilege = PrivilegeMode::Machine;
+	}
+
+	pc = handler & ~3;
+	UpdateTranslationEnabled();
+	return true;
+}
+
+void Processor::ReturnFromTrap(const PrivilegeMode from)
+{
+	if (static_cast<uint32_t>(privilege) < static_cast<uint32_t>(from))
+	{
+		throw Trap{ TrapCause::IllegalInstruction, 0 };
+	}
+
+	if (from == PrivilegeMode::Machine)
+	{
+		privilege = static_cast<PrivilegeMode>((mstatus & MStatus::MPP) >> MStatus::MPP_SHIFT);
+		mstatus = (mstatus & MStatus::MPIE) ? (mstatus | MStatus::MIE) : (mstatus & ~MStatus::MIE);
+		mstatus |= MStatus::MPIE;
+		mstatus &= ~MStatus::MPP;
+		pc = mepc;
+	}
+	else
+	{
+		privilege = (mstatus & MStatus::SPP) ? PrivilegeMode::Supervisor : PrivilegeMode::User;
+		mstatus = (mstatus & MStatus::SPIE) ? (mstatus | MStatus::SIE) : (mstatus & ~MStatus::SIE);
+		mstatus |= MStatus::SPIE;
+		mstatus &= ~MStatus::SPP;
+		pc = sepc;
+	}
 
-	memory[index] = static_cast<uint8_t>(byte);
+	UpdateTranslationEnabled();
 }
-void Processor::StoreHalfWordInMemory(const int32_t index, const int16_t halfWord)
+
+const MMUStatistics& Processor::GetMMUStatistics() const
+{
+	return mmu.GetStatistics();
+}
+
+uint64_t Processor::GetInstructionsExecuted() const
+{
+	return instructionsExecuted;
+}
+
+uint32_t Processor::GetRegister(const uint32_t index) const
+{
+	return registers[index].uword;
+}
+
+void Processor::SetRegister(const uint32_t index, const uint32_t value)
+{
+	if (index != 0)
+	{
+		registers[index].uword = value;
+	}
+}
+
+uint32_t Processor::GetPC() const
+{
+	return pc;
+}
+
+uint32_t Processor::GetHartId() const
+{
+	return hartId;
+}
+
+void Processor::SetInterruptPending(const uint32_t bits, const bool pending)
 {
-	VerifyMemorySpace(index, 2);
+	if (pending)
+	{
+		raisedInterrupts.fetch_or(bits, std::memory_order_release);
+	}
+	else
+	{
+		raisedInterrupts.fetch_and(~bits, std::memory_order_release);
+	}
+}
 
-	memory[index + 0] = static_cast<uint8_t>(static_cast<uint16_t>(halfWord) >> 0);
-	memory[index + 1] = static_cast<uint8_t>(static_cast<uint16_t>(halfWord) >> 8);
+bool Processor::IsInterruptPending() const
+{
+	return ((mip | raisedInterrupts.load(std::memory_order_acquire)) & mie) != 0;
 }
-void Processor::StoreWordInMemory(const int32_t index, const int32_t word)
+
+const Trap& Processor::GetUnhandledTrap() const
 {
-	VerifyMemorySpace(index, 4);
+	return unhandledTrap;
+}
 
-	memory[index + 0] = static_cast<uint8_t>(static_cast<uint32_t>(word) >>  0);
-	memory[index + 1] = static_cast<uint8_t>(static_cast<uint32_t>(word) >>  8);
-	memory[index + 2] = static_cast<uint8_t>(static_cast<uint32_t>(word) >> 16);
-	memory[index + 3] = static_cast<uint8_t>(static_cast<uint32_t>(word) >> 24);
+std::string Processor::GetUnhandledTrapMessage() const
+{
+	return "Unhandled trap.\nCause: " + std::to_string(static_cast<uint32_t>(unhandledTrap.cause)) +
+		"\nValue: " + std::to_string(unhandledTrap.value) +
+		"\npc: " + std::to_string(pc);
+}
+
+void Processor::ReadPhysicalMemory(const uint32_t address, uint8_t* buffer, const uint32_t size)
+{
+	for (uint32_t i = 0; i < size; i++)
+	{
+		buffer[i] = memory.ReadByte(address + i);
+	}
+}
+
+void Processor::WritePhysicalMemory(const uint32_t address, const uint8_t* buffer, const uint32_t size)
+{
+	//ram is written directly so loading a program never hits a watchpoint
+	const bool isRAM = size != 0 && memory.IsRAM(address, size);
+	for (uint32_t i = 0; i < size; i++)
+	{
+		if (isRAM)
+		{
+			memory.AtomicRAM<uint8_t>(address + i).store(buffer[i], std::memory_order_relaxed);
+		}
+		else
+		{
+			memory.WriteByte(address + i, buffer[i]);
+		}
+	}
+}
+
+MemoryBackingInfo Processor::GetMemoryBackingInfo() const
+{
+	return memory.GetBackingInfo();
+}
+
+void Processor::AttachDevice(const uint32_t base, const uint32_t size, std::shared_ptr<Device> device)
+{
+	memory.MapDevice(base, size, device);
+}
+
+void Processor::MapFile(const uint32_t base, const MappedFile& file)
+{
+	memory.MapHostMemory(base, file.GetSize(), file.GetData(), file.IsWritable());
+}
+
+void Processor::MapHostMemory(const uint32_t base, const uint32_t size, uint8_t* data, const bool writable)
+{
+	memory.MapHostMemory(base, size, data, writable);
+}
+
+void Processor::AddWatchpoint(const Watchpoint& watchpoint)
+{
+	memory.AddWatchpoint(watchpoint);
+}
+
+void Processor::ClearWatchpoints()
+{
+	memory.ClearWatchpoints();
+}
+
+const WatchpointHit* Processor::GetWatchpointHit() const
+{
+	return hasWatchpointHit ? &watchpointHit : nullptr;
 }
 
 void Processor::Reset()
 {
-	std::fill(memory, memory + Processor::MEMORY_SIZE, 0);
+	//devices, mapped files and watchpoints stay, only ram is
+	//cleared so files keep their contents between runs, and ram
+	//backed by a file isn't cleared either. Shared ram is cleared
+	//by the system owning the harts instead
+	if (!memory.IsShared())
+	{
+		memory.ClearRAM();
+	}
+	hasWatchpointHit = false;
+	hasReservation = false;
+	instructionsExecuted = 0;
 	for(uint32_t i = 0; i < 32; i++)
 	{
 		registers[i].word = 0;
 	}
 	pc = 0;
+
+	privilege = PrivilegeMode::Machine;
+	mstatus  = 0;
+	medeleg  = 0;
+	mideleg  = 0;
+	mie      = 0;
+	mip      = 0;
+	raisedInterrupts.store(0);
+	mtvec    = 0;
+	mscratch = 0;
+	mepc     = 0;
+	mcause   = 0;
+	mtval    = 0;
+	stvec    = 0;
+	sscratch = 0;
+	sepc     = 0;
+	scause   = 0;
+	stval    = 0;
+	mmu.Reset();
+	UpdateTranslationEnabled();
+}
+
+//instructions run between checks of the time limit
+static const uint64_t WATCHDOG_SLICE = 1 << 22;
+
+uint64_t CheckRunLimits(const Processor& processor, const RunLimits& limits, const std::chrono::steady_clock::time_point start, const std::string& subject)
+{
+	const uint64_t executed = processor.GetInstructionsExecuted();
+	if (executed >= limits.maxInstructions)
+	{
+		throw std::runtime_error(subject + " exceeded the limit of " + std::to_string(limits.maxInstructions) + " instructions.");
+	}
+	const double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	if (limits.seconds > 0.0 && elapsed > limits.seconds)
+	{
+		std::ostringstream seconds;
+		seconds << limits.seconds;
+		throw std::runtime_error(subject + " exceeded the time limit of " + seconds.str() + " seconds.");
+	}
+	return limits.maxInstructions - executed;
 }
 
-Processor::~Processor()
+RunStatus RunWithLimits(Processor& processor, const RunLimits& limits, const std::string& subject)
 {
-	delete[] memory;
+	const auto start = std::chrono::steady_clock::now();
+	while (true)
+	{
+		const uint64_t remaining = CheckRunLimits(processor, limits, start, subject);
+		const RunStatus status = processor.RunFor(std::min(remaining, WATCHDOG_SLICE));
+		if (status == RunStatus::Trap)
+		{
+			throw std::runtime_error(processor.GetUnhandledTrapMessage());
+		}
+		//nothing can raise an interrupt for a single
+		//hart, so wfi just continues after the wfi
+		if (status != RunStatus::BudgetExhausted && status != RunStatus::WaitingForInterrupt)
+		{
+			return status;
+		}
+	}
 }
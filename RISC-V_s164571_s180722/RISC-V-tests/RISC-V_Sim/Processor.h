@@ -1,8 +1,46 @@
 #pragma once
 
 #include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
 #include "Instruction.h"
 #include "Register.h"
+#include "MMU.h"
+#include "PhysicalMemory.h"
+#include "Device.h"
+#include "Watchpoint.h"
+#include "MappedFile.h"
+#include "Trap.h"
+#include "TraceSink.h"
+#include "ProgramImage.h"
+
+enum class RunStatus
+{
+	//the guest did ecall with a0 = 10
+	Exited,
+	BudgetExhausted,
+	//ebreak while the console isn't used
+	Breakpoint,
+	WatchpointHit,
+	//a trap without a handler, pc is at the faulting instruction
+	Trap,
+	//wfi without a pending interrupt, pc is after the wfi. Running
+	//again continues as if an interrupt had woken the hart
+	WaitingForInterrupt
+};
+
+//Run throws when the program hasn't stopped within these
+struct RunLimits
+{
+	uint64_t maxInstructions;
+	//wall clock time, 0 turns the watchdog off
+	double seconds;
+};
+
+class AsyncTraceWriter;
 
 class Processor
 {
@@ -10,31 +48,170 @@ private:
 	const static int32_t MEMORY_SIZE = 0x00'00'7f'ff;
 
 	uint32_t pc = 0;
+	uint32_t initialStackPointer;
 	Register registers[32];
-	uint8_t* memory;
+	//memory is owned by memoryOwner, which other harts may share
+	std::shared_ptr<PhysicalMemory> memoryOwner;
+	PhysicalMemory& memory;
 	bool debugEnabled = false;
+	//printed through a trace instead of in the instruction loop
 	bool printExecutedInstruction = false;
+	//ebreak prints the registers and waits for enter
+	bool useConsole = true;
+	uint64_t budgetEnd = UINT64_MAX;
+	RunStatus stopStatus = RunStatus::BudgetExhausted;
+	Trap unhandledTrap = { TrapCause::InstructionAddressMisaligned, 0 };
+	//decoded programs never change, so processors can share one
+	std::shared_ptr<const std::vector<Instruction>> instructions;
+	//address of the first instruction, 0 except for elf programs
+	uint32_t instructionBase = 0;
+
+	MMU mmu;
+	PrivilegeMode privilege = PrivilegeMode::Machine;
+	//true when loads, stores and fetches has to go through the mmu.
+	//Kept as a single flag so bare mode only pays for one branch
+	bool translationEnabled = false;
+	uint32_t mstatus  = 0;
+	uint32_t medeleg  = 0;
+	uint32_t mideleg  = 0;
+	uint32_t mie      = 0;
+	uint32_t mip      = 0;
+	//bits of mip set by other harts or devices, which may
+	//happen on another thread while this hart is running
+	std::atomic<uint32_t> raisedInterrupts{ 0 };
+	uint32_t mtvec    = 0;
+	uint32_t mscratch = 0;
+	uint32_t mepc     = 0;
+	uint32_t mcause   = 0;
+	uint32_t mtval    = 0;
+	uint32_t stvec    = 0;
+	uint32_t sscratch = 0;
+	uint32_t sepc     = 0;
+	uint32_t scause   = 0;
+	uint32_t stval    = 0;
+	uint32_t hartId   = 0;
+	uint64_t instructionsExecuted = 0;
 
-	void VerifyMemorySpace(const int32_t index, const int32_t size);
+	bool hasWatchpointHit = false;
+	WatchpointHit watchpointHit;
+
+	//set by lr.w, sc.w only stores if the word at the
+	//reserved address still has the value lr.w read
+	bool hasReservation = false;
+	uint32_t reservationAddress = 0;
+	uint32_t reservationValue = 0;
+
+	//null unless retired instructions are traced
+	std::shared_ptr<TraceSink> trace;
+	//the trace SetPrintExecutedInstruction prints with, null otherwise
+	std::shared_ptr<AsyncTraceWriter> consoleTrace;
+	//the words of the program if they are known, trace records and
+	//illegal instruction traps have the raw instruction
+	InstructionView code = { nullptr, 0 };
+	//filled in before an instruction runs, written once it retired
+	TraceRecord traceRecord;
+
+	uint32_t TranslateAddress(const uint32_t address, const int32_t size, const AccessType access);
+	uint32_t TranslateVirtualAddress(const uint32_t address, const int32_t size, const AccessType access);
 	uint8_t  GetByteFromMemory    (const int32_t index);
 	uint16_t GetHalfWordFromMemory(const int32_t index);
 	uint32_t GetWordFromMemory    (const int32_t index);
+	uint32_t GetPhysicalWord      (const int32_t index);
 	void StoreByteInMemory    (const int32_t index, const int8_t  byte    );
 	void StoreHalfWordInMemory(const int32_t index, const int16_t halfWord);
 	void StoreWordInMemory    (const int32_t index, const int32_t word    );
 	void EnvironmentCall(bool* stopProgram);
+	void RunAtomicInstruction(const Instruction& instruction);
+
+	uint32_t ReadCSR(const uint32_t csr);
+	void WriteCSR(const uint32_t csr, const uint32_t value);
+	void RunCSRInstruction(const Instruction& instruction);
+	bool RunPrivilegedInstruction(const Instruction& instruction);
+	void UpdateTranslationEnabled();
+	bool TakeTrap(const Trap& trap);
+	//0 when the words of the program aren't known
+	uint32_t GetRawInstruction(const uint32_t instructionIndex) const;
+	void BeginTraceRecord(const Instruction& instruction, const uint32_t instructionIndex);
+	void DrainConsoleTrace();
+	void EndTraceRecord(const Instruction& instruction);
+	void ReturnFromTrap(const PrivilegeMode from);
 
 public:
 	Processor();
+	Processor(const MemoryOptions& memoryOptions);
+	//a hart of a multi hart system, memory is shared with the other harts
+	Processor(std::shared_ptr<PhysicalMemory> sharedMemory, const uint32_t hartId);
+	static MemoryOptions DefaultMemoryOptions();
 	void Run(const uint32_t* instructions, const size_t instructionCount);
+	//resets the processor and decodes the program without running it,
+	//the words have to stay valid while the program runs. decodeThreadCount
+	//is the threads DecodeInstructions uses
+	void Load(const uint32_t* instructions, const size_t instructionCount, const uint32_t decodeThreadCount = 1);
+	//resets the processor and runs a program decoded before
+	void Load(std::shared_ptr<const std::vector<Instruction>> decodedInstructions);
+	//same for a program whose first instruction is at instructionBase
+	//and which starts at entry instead of address 0. code is the words
+	//it was decoded from if they are known and has to stay valid while
+	//the program runs
+	void Load(std::shared_ptr<const std::vector<Instruction>> decodedInstructions, const uint32_t instructionBase, const uint32_t entry,
+		const InstructionView code = { nullptr, 0 });
+	//continues the loaded program until the first jump or branch
+	//after maxInstructions, it can be called again to resume
+	RunStatus RunFor(const uint64_t maxInstructions);
 	bool RunInstruction(const Instruction& instruction);
 	void PrintInstructions(const uint32_t* rawInstructions, const uint32_t instructionCount);
 	void PrintRegisters();
 	void SetDebugMode(const bool useDebugMode);
+	//prints every retired instruction to std::cout from a background thread,
+	//which replaces the trace sink while it's on. The lines are all written
+	//before anything the processor or a device prints and before RunFor returns
 	void SetPrintExecutedInstruction(const bool value);
+	void SetUseConsole(const bool value);
+	//gives sink a record for every instruction retired from now on.
+	//code is the words the loaded program was decoded from and has to
+	//stay valid while tracing, loading a program sets it to the words
+	//it was loaded with. A null sink stops tracing
+	void SetTrace(std::shared_ptr<TraceSink> sink, const InstructionView code);
 	void CopyRegistersTo(uint32_t* copyTo);
+	const MMUStatistics& GetMMUStatistics() const;
+	uint64_t GetInstructionsExecuted() const;
+	uint32_t GetRegister(const uint32_t index) const;
+	void SetRegister(const uint32_t index, const uint32_t value);
+	uint32_t GetPC() const;
+	uint32_t GetHartId() const;
+	//can be called from any thread
+	void SetInterruptPending(const uint32_t bits, const bool pending);
+	//an interrupt enabled in mie is pending, whether or not mstatus
+	//enables interrupts. This is what wakes a hart waiting in wfi
+	bool IsInterruptPending() const;
+	const Trap& GetUnhandledTrap() const;
+	std::string GetUnhandledTrapMessage() const;
+	void ReadPhysicalMemory(const uint32_t address, uint8_t* buffer, const uint32_t size);
+	//writes around watchpoints, for placing a program in memory
+	void WritePhysicalMemory(const uint32_t address, const uint8_t* buffer, const uint32_t size);
+	MemoryBackingInfo GetMemoryBackingInfo() const;
+	void AttachDevice(const uint32_t base, const uint32_t size, std::shared_ptr<Device> device);
+	void MapFile(const uint32_t base, const MappedFile& file);
+	void MapHostMemory(const uint32_t base, const uint32_t size, uint8_t* data, const bool writable);
+	void AddWatchpoint(const Watchpoint& watchpoint);
+	void ClearWatchpoints();
+	const WatchpointHit* GetWatchpointHit() const;
 	void Reset();
-
-	~Processor();
 };
 
+inline uint32_t Processor::TranslateAddress(const uint32_t address, const int32_t size, const AccessType access)
+{
+	if (!translationEnabled)
+	{
+		return address;
+	}
+	return TranslateVirtualAddress(address, size, access);
+}
+
+//throws when the processor has run into one of the limits since start,
+//naming subject in the error, and returns how many instructions it may still run
+uint64_t CheckRunLimits(const Processor& processor, const RunLimits& limits, const std::chrono::steady_clock::time_point start, const std::string& subject);
+//runs the program in slices so the watchdog can check the time between
+//them without a thread or any cost per instruction. Throws when a limit
+//is hit or on a trap without a handler
+RunStatus RunWithLimits(Processor& processor, const RunLimits& limits, const std::string& subject);
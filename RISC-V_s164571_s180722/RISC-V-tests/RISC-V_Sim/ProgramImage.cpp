@@ -0,0 +1,69 @@
+#include "ProgramImage.h"
+#include <cstdint>
+#include <stdexcept>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include "PhysicalMemory.h"
+
+static uint32_t SwapBytes(const uint32_t word)
+{
+	return (word >> 24) | ((word >> 8) & 0x00'00'ff'00) | ((word << 8) & 0x00'ff'00'00) | (word << 24);
+}
+
+ProgramImage::ProgramImage(const std::string& path)
+{
+	struct stat fileInfo;
+	if (stat(path.c_str(), &fileInfo) != 0)
+	{
+		throw std::runtime_error("Failed to open file: " + path);
+	}
+	//make sure file can be used as an array of words
+	const uint64_t fileSize = static_cast<uint64_t>(fileInfo.st_size);
+	if (fileSize % 4 != 0 || fileSize == 0)
+	{
+		throw std::runtime_error("File doesn't have the correct length. Length: " + std::to_string(fileSize));
+	}
+
+#if !defined(_WIN32)
+	if (!HOST_IS_BIG_ENDIAN)
+	{
+		//the mapping starts at a page so the words are aligned
+		mapping = std::make_unique<MappedFile>(path, FileMapping::ReadOnly, 0);
+		view = { reinterpret_cast<const uint32_t*>(mapping->GetData()), static_cast<size_t>(fileSize / 4) };
+		return;
+	}
+#endif
+
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+	{
+		throw std::runtime_error("Failed to open file: " + path);
+	}
+	words.resize(static_cast<size_t>(fileSize / 4));
+	file.read(reinterpret_cast<char*>(words.data()), static_cast<std::streamsize>(fileSize));
+	if (!file)
+	{
+		throw std::runtime_error("Failed to read file: " + path);
+	}
+	if (HOST_IS_BIG_ENDIAN)
+	{
+		for (uint32_t& word : words)
+		{
+			word = SwapBytes(word);
+		}
+	}
+	view = { words.data(), words.size() };
+}
+
+InstructionView ProgramImage::GetInstructions() const
+{
+	return view;
+}
+
+bool ProgramImage::IsMapped() const
+{
+	return mapping != nullptr;
+}
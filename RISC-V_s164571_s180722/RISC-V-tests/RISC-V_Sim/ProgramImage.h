@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+#include "MappedFile.h"
+
+//instruction words owned by something else, like a std::span
+struct InstructionView
+{
+	const uint32_t* data;
+	size_t size;
+
+	const uint32_t* begin() const { return data; }
+	const uint32_t* end() const { return data + size; }
+	uint32_t operator[](const size_t index) const { return data[index]; }
+};
+
+//The instruction words of a .bin file, which are stored little endian.
+//On a little endian host with mmap the file is mapped read only and the
+//words are used right where they are, so loading a program costs the page
+//faults of reading it once. Anywhere else the file is read straight into
+//one buffer, and the bytes of every word are swapped on a big endian host.
+class ProgramImage
+{
+private:
+	std::unique_ptr<MappedFile> mapping;
+	std::vector<uint32_t> words;
+	InstructionView view;
+
+public:
+	explicit ProgramImage(const std::string& path);
+	ProgramImage(const ProgramImage&) = delete;
+	ProgramImage& operator=(const ProgramImage&) = delete;
+
+	//valid for as long as the image is
+	InstructionView GetInstructions() const;
+	bool IsMapped() const;
+};
@@ -1,14 +1,44 @@
 #include <cstdint>
+#include <cstdlib>
 #include <iostream>
 #include <fstream>
 #include <string>
 #include <memory>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <thread>
 #include "Processor.h"
 #include "TestEncodeDecode.h"
 #include "TestInstructions.h"
 #include "ReadProgram.h"
 #include "RISCV_Program.h"
 #include "TestRandomInstructions.h"
+#include "TestVirtualMemory.h"
+#include "TestDevices.h"
+#include "TestWatchpoints.h"
+#include "TestFileMemory.h"
+#include "TestHostMemory.h"
+#include "TestBatch.h"
+#include "TestLibrary.h"
+#include "TestLockstep.h"
+#include "TestSMP.h"
+#include "TestForkServer.h"
+#include "TestSimulationServer.h"
+#include "TestShardedBatch.h"
+#include "TestElf.h"
+#include "TestTrace.h"
+#include "Benchmark.h"
+#include "DecodeSweep.h"
+#include "ExecutionTrace.h"
+#include "AsyncTraceWriter.h"
+#include "BatchRunner.h"
+#include "ForkServer.h"
+#include "SimulationServer.h"
+#include "ShardedBatch.h"
+#include "UART.h"
+#include "Watchpoint.h"
+#include "MappedFile.h"
 
 void testFile(std::string filePath)
 {
@@ -23,6 +53,20 @@ int runAllTests()
 	TestAllEncodeDecode();
 	TestAllInstructions();
 	TestRandomArithmeticInstructions();
+	TestVirtualMemory();
+	TestDevices();
+	TestWatchpoints();
+	TestFileMemory();
+	TestHostMemory();
+	TestBatch();
+	TestLibrary();
+	TestLockstep();
+	TestSMP();
+	TestForkServer();
+	TestSimulationServer();
+	TestShardedBatch();
+	TestElf();
+	TestTrace();
 	try
 	{
 
@@ -46,6 +90,424 @@ int runAllTests()
 	return 0;
 }
 
+struct FileArgument
+{
+	std::string path;
+	uint32_t base;
+	uint32_t size;
+	FileMapping mapping;
+};
+
+//accepts both decimal and 0x prefixed hex
+static bool ParseNumber(const char* text, uint32_t* number)
+{
+	char* end;
+	const unsigned long value = std::strtoul(text, &end, 0);
+	*number = static_cast<uint32_t>(value);
+	return *text != '\0' && *end == '\0';
+}
+
+static bool ParseNumber(const char* text, uint64_t* number)
+{
+	char* end;
+	*number = std::strtoull(text, &end, 0);
+	return *text != '\0' && *end == '\0';
+}
+
+static bool ParseSeconds(const char* text, double* seconds)
+{
+	char* end;
+	*seconds = std::strtod(text, &end);
+	return *text != '\0' && *end == '\0' && *seconds >= 0.0;
+}
+
+//--max-instructions <count> and --timeout <seconds>, shared by --run and --batch
+static bool ParseLimit(int argc, char* argv[], int* i, RunLimits* limits, bool* isValid)
+{
+	if ("--max-instructions" == std::string(argv[*i]) && *i + 1 < argc)
+	{
+		*isValid = ParseNumber(argv[++*i], &limits->maxInstructions);
+		return true;
+	}
+	if ("--timeout" == std::string(argv[*i]) && *i + 1 < argc)
+	{
+		*isValid = ParseSeconds(argv[++*i], &limits->seconds);
+		return true;
+	}
+	return false;
+}
+
+//--batch <directory|manifest> [-o <summary>] [--threads <count>]
+//        [--max-instructions <count>] [--timeout <seconds>]
+static int RunBatchCommand(int argc, char* argv[])
+{
+	const std::string source = std::string(argv[2]);
+	std::string summaryPath = "batch_summary.txt";
+	//0 lets the pool use every core
+	uint32_t threadCount = 0;
+	RunLimits limits = { UINT64_MAX, 0.0 };
+	for (int i = 3; i < argc; i++)
+	{
+		bool isValidLimit;
+		if (ParseLimit(argc, argv, &i, &limits, &isValidLimit))
+		{
+			if (!isValidLimit)
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		else if ("-o" == std::string(argv[i]) && i + 1 < argc)
+		{
+			summaryPath = std::string(argv[++i]);
+		}
+		else if ("--threads" == std::string(argv[i]) && i + 1 < argc)
+		{
+			if (!ParseNumber(argv[++i], &threadCount))
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		else
+		{
+			std::cout << "Incorrect arguments" << std::endl;
+			return -1;
+		}
+	}
+
+	try
+	{
+		return RunBatch(source, summaryPath, threadCount, limits);
+	}
+	catch (const std::runtime_error& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+//--fork-server [--kill-after <seconds>] [--max-instructions <count>] [--timeout <seconds>]
+static int RunForkServerCommand(int argc, char* argv[])
+{
+	RunLimits limits = { UINT64_MAX, 0.0 };
+	uint32_t killAfter = DEFAULT_KILL_AFTER;
+	for (int i = 2; i < argc; i++)
+	{
+		bool isValidLimit;
+		if (ParseLimit(argc, argv, &i, &limits, &isValidLimit))
+		{
+			if (!isValidLimit)
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		else if ("--kill-after" == std::string(argv[i]) && i + 1 < argc)
+		{
+			if (!ParseNumber(argv[++i], &killAfter))
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		else
+		{
+			std::cout << "Incorrect arguments" << std::endl;
+			return -1;
+		}
+	}
+
+	try
+	{
+		return RunForkServer(limits, killAfter);
+	}
+	catch (const std::runtime_error& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+//--serve <socket> [--threads <count>] [--max-instructions <count>] [--timeout <seconds>]
+static int RunServeCommand(int argc, char* argv[])
+{
+	const std::string socketPath = std::string(argv[2]);
+	//0 lets the pool use every core
+	uint32_t threadCount = 0;
+	RunLimits limits = { UINT64_MAX, 0.0 };
+	for (int i = 3; i < argc; i++)
+	{
+		bool isValidLimit;
+		if (ParseLimit(argc, argv, &i, &limits, &isValidLimit))
+		{
+			if (!isValidLimit)
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		else if ("--threads" == std::string(argv[i]) && i + 1 < argc)
+		{
+			if (!ParseNumber(argv[++i], &threadCount))
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		else
+		{
+			std::cout << "Incorrect arguments" << std::endl;
+			return -1;
+		}
+	}
+
+	try
+	{
+		return RunSimulationServer(socketPath, threadCount, limits);
+	}
+	catch (const std::runtime_error& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+//--shard-init <directory|manifest> <workdir>
+//--shard-worker <workdir> [--lease <seconds>] [--max-instructions <count>] [--timeout <seconds>]
+//--shard-merge <workdir> [-o <summary>]
+static int RunShardCommand(int argc, char* argv[])
+{
+	const std::string command = std::string(argv[1]);
+	RunLimits limits = { UINT64_MAX, 0.0 };
+	uint32_t leaseSeconds = DEFAULT_LEASE_SECONDS;
+	std::string summaryPath = "batch_summary.txt";
+	const int firstOption = (command == "--shard-init") ? 4 : 3;
+	if (argc < firstOption)
+	{
+		std::cout << "Incorrect arguments" << std::endl;
+		return -1;
+	}
+	for (int i = firstOption; i < argc; i++)
+	{
+		bool isValidLimit;
+		if (command == "--shard-worker" && ParseLimit(argc, argv, &i, &limits, &isValidLimit))
+		{
+			if (!isValidLimit)
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		else if (command == "--shard-worker" && "--lease" == std::string(argv[i]) && i + 1 < argc)
+		{
+			if (!ParseNumber(argv[++i], &leaseSeconds) || leaseSeconds == 0)
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		else if (command == "--shard-merge" && "-o" == std::string(argv[i]) && i + 1 < argc)
+		{
+			summaryPath = std::string(argv[++i]);
+		}
+		else
+		{
+			std::cout << "Incorrect arguments" << std::endl;
+			return -1;
+		}
+	}
+
+	try
+	{
+		if (command == "--shard-init")
+		{
+			InitShards(argv[2], argv[3]);
+			return 0;
+		}
+		if (command == "--shard-worker")
+		{
+			const uint32_t ran = RunShardWorker(argv[2], limits, leaseSeconds);
+			std::cout << "Ran " << ran << " programs" << std::endl;
+			return 0;
+		}
+		return RunShardMerge(argv[2], summaryPath);
+	}
+	catch (const std::runtime_error& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+//--generate <prefix> <count> <size> [--seed <seed>] [--threads <count>]
+static int RunGenerateCommand(int argc, char* argv[])
+{
+	const std::string prefix = std::string(argv[2]);
+	uint32_t count;
+	uint64_t size;
+	uint64_t seed = 1;
+	//0 lets the pool use every core
+	uint32_t threadCount = 0;
+	if (argc < 5 || !ParseNumber(argv[3], &count) || !ParseNumber(argv[4], &size) || size == 0)
+	{
+		std::cout << "Incorrect arguments" << std::endl;
+		return -1;
+	}
+	for (int i = 5; i < argc; i++)
+	{
+		if ("--seed" == std::string(argv[i]) && i + 1 < argc)
+		{
+			if (!ParseNumber(argv[++i], &seed))
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		else if ("--threads" == std::string(argv[i]) && i + 1 < argc)
+		{
+			if (!ParseNumber(argv[++i], &threadCount))
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		else
+		{
+			std::cout << "Incorrect arguments" << std::endl;
+			return -1;
+		}
+	}
+
+	try
+	{
+		const auto start = std::chrono::steady_clock::now();
+		GenerateRandomTests(prefix, count, size, seed, threadCount);
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		std::cout << "Generated " << count << " programs with " << (count * size) << " instructions in " << seconds << " seconds, " <<
+			(count * size / seconds / 1e6) << " million instructions per second" << std::endl;
+		return 0;
+	}
+	catch (const std::runtime_error& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+//--verify-decode [--first <word>] [--count <count>] [--threads <count>]
+static int RunVerifyDecodeCommand(int argc, char* argv[])
+{
+	uint64_t first = 0;
+	uint64_t count = ALL_WORDS;
+	//0 uses every core
+	uint32_t threadCount = 0;
+	for (int i = 2; i < argc; i++)
+	{
+		bool isValid = i + 1 < argc;
+		if ("--first" == std::string(argv[i]) && isValid)
+		{
+			isValid = ParseNumber(argv[++i], &first);
+		}
+		else if ("--count" == std::string(argv[i]) && isValid)
+		{
+			isValid = ParseNumber(argv[++i], &count);
+		}
+		else if ("--threads" == std::string(argv[i]) && isValid)
+		{
+			isValid = ParseNumber(argv[++i], &threadCount);
+		}
+		else
+		{
+			isValid = false;
+		}
+		if (!isValid)
+		{
+			std::cout << "Incorrect arguments" << std::endl;
+			return -1;
+		}
+	}
+	//the whole sweep unless a range is given, so count follows first
+	count = std::min(count, ALL_WORDS - std::min(first, ALL_WORDS));
+
+	try
+	{
+		const auto start = std::chrono::steady_clock::now();
+		const DecodeSweepResult result = SweepDecoders(first, count, threadCount);
+		const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+		for (const std::string& example : result.examples)
+		{
+			std::cout << example << std::endl;
+		}
+		std::cout << "Swept " << result.words << " words in " << seconds << " seconds, " << (result.words / seconds / 1e6) << " million words per second" << std::endl;
+		std::cout << result.valid << " valid, " << result.illegal << " illegal, " << result.mismatches << " mismatches" << std::endl;
+		return (result.mismatches == 0) ? 0 : 1;
+	}
+	catch (const std::runtime_error& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
+//--trace-read <trace> [--first <instruction>] [--count <count>]
+static int RunTraceReadCommand(int argc, char* argv[])
+{
+	uint64_t first = 0;
+	uint64_t count = UINT64_MAX;
+	for (int i = 3; i < argc; i++)
+	{
+		bool isValid = i + 1 < argc;
+		if ("--first" == std::string(argv[i]) && isValid)
+		{
+			isValid = ParseNumber(argv[++i], &first);
+		}
+		else if ("--count" == std::string(argv[i]) && isValid)
+		{
+			isValid = ParseNumber(argv[++i], &count);
+		}
+		else
+		{
+			isValid = false;
+		}
+		if (!isValid)
+		{
+			std::cout << "Incorrect arguments" << std::endl;
+			return -1;
+		}
+	}
+
+	try
+	{
+		TraceFileReader reader(argv[2]);
+		//a block at a time, so a long range doesn't have to fit in memory
+		while (count > 0)
+		{
+			const std::vector<TraceRecord> records = reader.Read(first, std::min<uint64_t>(count, reader.GetInterval()));
+			if (records.empty())
+			{
+				break;
+			}
+			std::string text;
+			for (const TraceRecord& record : records)
+			{
+				text += TraceRecordAsString(record);
+				text += '\n';
+			}
+			std::cout << text;
+			first = records.back().instruction + 1;
+			count -= records.size();
+		}
+		std::cout.flush();
+		return 0;
+	}
+	catch (const std::runtime_error& e)
+	{
+		std::cout << e.what() << std::endl;
+		return -1;
+	}
+}
+
 int main(int argc, char* argv[])
 {	
 	//if no arguments then run all tests
@@ -58,15 +520,96 @@ int main(int argc, char* argv[])
 	{
 		return runAllTests();
 	}
+	else if ("--benchmark" == std::string(argv[1]))
+	{
+		//without a name every benchmark is run
+		const std::string name = (argc > 2) ? argv[2] : "";
+		if (name != "" && name != "memory" && name != "lockstep" && name != "smp" && name != "forkserver" && name != "load" && name != "decode" && name != "layout" && name != "trace")
+		{
+			std::cout << "Unknown benchmark: " << name << std::endl;
+			return -1;
+		}
+		try
+		{
+			if (name == "" || name == "memory")
+			{
+				BenchmarkMemory();
+			}
+			if (name == "" || name == "lockstep")
+			{
+				BenchmarkLockstep();
+			}
+			if (name == "" || name == "smp")
+			{
+				BenchmarkSMP();
+			}
+			if (name == "" || name == "forkserver")
+			{
+				BenchmarkForkServer(argv[0], "InstructionTests");
+			}
+			if (name == "" || name == "load")
+			{
+				BenchmarkLoad();
+			}
+			if (name == "" || name == "decode")
+			{
+				BenchmarkDecode();
+			}
+			if (name == "" || name == "layout")
+			{
+				BenchmarkLayout();
+			}
+			if (name == "" || name == "trace")
+			{
+				BenchmarkTrace();
+			}
+		}
+		catch (const std::runtime_error& e)
+		{
+			std::cout << e.what() << std::endl;
+			return -1;
+		}
+		return 0;
+	}
+	else if ("--fork-server" == std::string(argv[1]))
+	{
+		return RunForkServerCommand(argc, argv);
+	}
+	else if ("--verify-decode" == std::string(argv[1]))
+	{
+		return RunVerifyDecodeCommand(argc, argv);
+	}
 	
 	//for this next part atleast two arguments
 	//are rquired
-	if (argc <= 1)
+	if (argc <= 2)
 	{
 		std::cout << "Incorrect arguments" << std::endl;
 		return -1;
 	}
 
+	if ("--batch" == std::string(argv[1]))
+	{
+		return RunBatchCommand(argc, argv);
+	}
+	if ("--generate" == std::string(argv[1]))
+	{
+		return RunGenerateCommand(argc, argv);
+	}
+	if ("--serve" == std::string(argv[1]))
+	{
+		return RunServeCommand(argc, argv);
+	}
+	if ("--trace-read" == std::string(argv[1]))
+	{
+		return RunTraceReadCommand(argc, argv);
+	}
+
+	if ("--shard-init" == std::string(argv[1]) || "--shard-worker" == std::string(argv[1]) || "--shard-merge" == std::string(argv[1]))
+	{
+		return RunShardCommand(argc, argv);
+	}
+
 	std::string input;
 	//default output file
 	std::string output = "result";
@@ -83,18 +626,271 @@ int main(int argc, char* argv[])
 		return -1;
 	}
 
-	//if another output file was specified then
-	//change the default to the specified file
-	if (argc == 5 && "-o" == std::string(argv[3]))
+	bool printStatistics = false;
+	bool attachUART = false;
+	std::vector<Watchpoint> watchpoints;
+	std::vector<FileArgument> files;
+	MemoryOptions memoryOptions = Processor::DefaultMemoryOptions();
+	RunLimits limits = { UINT64_MAX, 0.0 };
+	uint32_t hartCount = 1;
+	uint64_t quantum = 0;
+	uint32_t workerCount = 0;
+	ElfDefaults elfDefaults = { 0, 0 };
+	std::string tracePath;
+	uint32_t traceInterval = TraceFileWriter::DEFAULT_INTERVAL;
+	bool printTrace = false;
+	uint32_t traceRing = AsyncTraceWriter::DEFAULT_CAPACITY;
+	TraceFullPolicy tracePolicy = TraceFullPolicy::Block;
+	for (int i = 3; i < argc; i++)
 	{
-		output = std::string(argv[4]);
+		bool isValidLimit;
+		if (ParseLimit(argc, argv, &i, &limits, &isValidLimit))
+		{
+			if (!isValidLimit)
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		//if another output file was specified then
+		//change the default to the specified file
+		else if ("-o" == std::string(argv[i]) && i + 1 < argc)
+		{
+			output = std::string(argv[++i]);
+		}
+		else if ("--stats" == std::string(argv[i]))
+		{
+			printStatistics = true;
+		}
+		else if ("--uart" == std::string(argv[i]))
+		{
+			attachUART = true;
+		}
+		//--watch <r|w|rw> <address> <size>
+		else if ("--watch" == std::string(argv[i]) && i + 3 < argc)
+		{
+			const std::string type = std::string(argv[i + 1]);
+			Watchpoint watchpoint;
+			if (type == "r")
+			{
+				watchpoint.type = WatchType::Read;
+			}
+			else if (type == "w")
+			{
+				watchpoint.type = WatchType::Write;
+			}
+			else if (type == "rw")
+			{
+				watchpoint.type = WatchType::ReadWrite;
+			}
+			else
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+			if (!ParseNumber(argv[i + 2], &watchpoint.address) || !ParseNumber(argv[i + 3], &watchpoint.size))
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+			watchpoints.push_back(watchpoint);
+			i += 3;
+		}
+		else if ("--memory" == std::string(argv[i]) && i + 1 < argc)
+		{
+			if (!ParseNumber(argv[++i], &memoryOptions.ramSize))
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		else if ("--harts" == std::string(argv[i]) && i + 1 < argc)
+		{
+			if (!ParseNumber(argv[++i], &hartCount) || hartCount == 0)
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		else if ("--quantum" == std::string(argv[i]) && i + 1 < argc)
+		{
+			if (!ParseNumber(argv[++i], &quantum) || quantum == 0)
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		else if ("--workers" == std::string(argv[i]) && i + 1 < argc)
+		{
+			if (!ParseNumber(argv[++i], &workerCount) || workerCount == 0)
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		//--sp <address> and --gp <address> for elf programs without the symbols
+		else if ("--sp" == std::string(argv[i]) && i + 1 < argc)
+		{
+			if (!ParseNumber(argv[++i], &elfDefaults.stackPointer))
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		else if ("--gp" == std::string(argv[i]) && i + 1 < argc)
+		{
+			if (!ParseNumber(argv[++i], &elfDefaults.globalPointer))
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		//--trace <path> writes a binary trace of every retired instruction
+		else if ("--trace" == std::string(argv[i]) && i + 1 < argc)
+		{
+			tracePath = std::string(argv[++i]);
+		}
+		else if ("--trace-interval" == std::string(argv[i]) && i + 1 < argc)
+		{
+			if (!ParseNumber(argv[++i], &traceInterval) || traceInterval == 0)
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		//--print-trace prints every retired instruction instead
+		else if ("--print-trace" == std::string(argv[i]))
+		{
+			printTrace = true;
+		}
+		//records the trace can fall behind the run before it waits or drops them
+		else if ("--trace-ring" == std::string(argv[i]) && i + 1 < argc)
+		{
+			if (!ParseNumber(argv[++i], &traceRing) || traceRing == 0)
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+		}
+		else if ("--trace-drop" == std::string(argv[i]))
+		{
+			tracePolicy = TraceFullPolicy::Drop;
+		}
+		else if ("--huge-pages" == std::string(argv[i]))
+		{
+			memoryOptions.useHugePages = true;
+		}
+		else if ("--numa" == std::string(argv[i]))
+		{
+			memoryOptions.bindToNUMANode = true;
+		}
+		//--ram-file <path>
+		else if ("--ram-file" == std::string(argv[i]) && i + 1 < argc)
+		{
+			memoryOptions.ramFileMapping = RAMFileMapping::Shared;
+			memoryOptions.ramFile = argv[++i];
+		}
+		//--ram-file-private <path>
+		else if ("--ram-file-private" == std::string(argv[i]) && i + 1 < argc)
+		{
+			memoryOptions.ramFileMapping = RAMFileMapping::Private;
+			memoryOptions.ramFile = argv[++i];
+		}
+		//--file <path> <address> <size>
+		else if ("--file" == std::string(argv[i]) && i + 3 < argc)
+		{
+			FileArgument file = { std::string(argv[i + 1]), 0, 0, FileMapping::Shared };
+			if (!ParseNumber(argv[i + 2], &file.base) || !ParseNumber(argv[i + 3], &file.size))
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+			files.push_back(file);
+			i += 3;
+		}
+		//--file-readonly <path> <address>
+		else if ("--file-readonly" == std::string(argv[i]) && i + 2 < argc)
+		{
+			FileArgument file = { std::string(argv[i + 1]), 0, 0, FileMapping::ReadOnly };
+			if (!ParseNumber(argv[i + 2], &file.base))
+			{
+				std::cout << "Incorrect arguments" << std::endl;
+				return -1;
+			}
+			files.push_back(file);
+			i += 2;
+		}
+		else
+		{
+			std::cout << "Incorrect arguments" << std::endl;
+			return -1;
+		}
+	}
+	if (printTrace && !tracePath.empty())
+	{
+		std::cout << "Incorrect arguments" << std::endl;
+		return -1;
 	}
 
 	try
 	{
-		std::unique_ptr<RISCV_Program> program = LoadProgram(input);
+		//one program is run, so it can be decoded on every core
+		std::unique_ptr<RISCV_Program> program = LoadProgram(input, std::max(1u, std::thread::hardware_concurrency()));
+		program->SetMemoryOptions(memoryOptions);
+		program->SetLimits(limits);
+		program->SetHartCount(hartCount);
+		program->SetQuantum(quantum);
+		program->SetWorkerCount(workerCount);
+		program->SetElfDefaults(elfDefaults);
+		if (attachUART)
+		{
+			program->AttachDevice(UART::DEFAULT_BASE, UART::SIZE, std::make_shared<UART>(&std::cout));
+		}
+		for (const FileArgument& file : files)
+		{
+			program->AttachFile(file.base, std::make_shared<MappedFile>(file.path, file.mapping, file.size));
+		}
+		for (const Watchpoint& watchpoint : watchpoints)
+		{
+			program->AddWatchpoint(watchpoint);
+		}
+		//the trace is compressed or printed on its own thread
+		std::shared_ptr<TraceFileWriter> traceFile;
+		std::shared_ptr<AsyncTraceWriter> trace;
+		if (printTrace || !tracePath.empty())
+		{
+			std::shared_ptr<TraceSink> sink;
+			if (printTrace)
+			{
+				sink = std::make_shared<TextTraceWriter>(std::cout);
+			}
+			else
+			{
+				traceFile = std::make_shared<TraceFileWriter>(tracePath, traceInterval);
+				sink = traceFile;
+			}
+			trace = std::make_shared<AsyncTraceWriter>(sink, traceRing, tracePolicy);
+			program->SetTrace(trace);
+		}
 		program->Run();
+		if (trace)
+		{
+			trace->Close();
+			if (traceFile)
+			{
+				traceFile->Close();
+			}
+			if (trace->GetDroppedCount() > 0)
+			{
+				std::cout << "Dropped " << trace->GetDroppedCount() << " trace records" << std::endl;
+			}
+		}
 		program->PrintResult();
+		program->PrintWatchpointHit();
+		if (printStatistics)
+		{
+			program->PrintStatistics();
+		}
 		program->SaveProgramResult(output);
 		std::cout << "Program ran sucessfully" << std::endl;
 	}
@@ -0,0 +1,188 @@
+#include "RISCVSimAPI.h"
+#include <cstdint>
+#include <stdexcept>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#include <memory>
+#include <new>
+#include "Processor.h"
+
+//all state lives in here so simulators don't share anything
+struct rvsim
+{
+	Processor processor;
+	//the processor keeps a pointer to the words for the value
+	//of illegal instruction traps, so they are copied
+	std::vector<uint32_t> code;
+	bool loaded;
+	std::string lastError;
+
+	rvsim(const MemoryOptions& options) : processor(options), loaded(false)
+	{
+		processor.SetUseConsole(false);
+	}
+};
+
+static rvsim_status ToStatus(const RunStatus status)
+{
+	switch (status)
+	{
+		case RunStatus::Exited:
+			return RVSIM_EXITED;
+		case RunStatus::BudgetExhausted:
+			return RVSIM_BUDGET_EXHAUSTED;
+		case RunStatus::Breakpoint:
+			return RVSIM_BREAKPOINT;
+		case RunStatus::Trap:
+			return RVSIM_TRAP;
+		case RunStatus::WaitingForInterrupt:
+			return RVSIM_WAITING_FOR_INTERRUPT;
+		default:
+			return RVSIM_WATCHPOINT_HIT;
+	}
+}
+
+static rvsim_status Fail(rvsim* sim, const std::string& message)
+{
+	sim->lastError = message;
+	return RVSIM_ERROR;
+}
+
+//exceptions can't cross the C interface, so every
+//call that can throw goes through this
+template<typename Function>
+static rvsim_status Guard(rvsim* sim, Function function)
+{
+	try
+	{
+		return function();
+	}
+	catch (const std::exception& e)
+	{
+		return Fail(sim, e.what());
+	}
+}
+
+static std::vector<uint32_t> ReadInstructionFile(const char* path)
+{
+	std::ifstream file(path, std::ios::binary);
+	if (!file)
+	{
+		throw std::runtime_error("Failed to open file: " + std::string(path));
+	}
+	const std::vector<uint8_t> bytes((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+	if (bytes.size() % 4 != 0 || bytes.empty())
+	{
+		throw std::runtime_error("File doesn't have the correct length. Length: " + std::to_string(bytes.size()));
+	}
+
+	std::vector<uint32_t> instructions(bytes.size() / 4);
+	for (size_t i = 0; i < instructions.size(); i++)
+	{
+		instructions[i] = (static_cast<uint32_t>(bytes[i * 4 + 0]) <<  0) |
+						  (static_cast<uint32_t>(bytes[i * 4 + 1]) <<  8) |
+						  (static_cast<uint32_t>(bytes[i * 4 + 2]) << 16) |
+						  (static_cast<uint32_t>(bytes[i * 4 + 3]) << 24);
+	}
+	return instructions;
+}
+
+rvsim* rvsim_create(uint32_t ram_size)
+{
+	MemoryOptions options = Processor::DefaultMemoryOptions();
+	if (ram_size != 0)
+	{
+		options.ramSize = ram_size;
+	}
+	try
+	{
+		return new rvsim(options);
+	}
+	catch (const std::exception&)
+	{
+		return nullptr;
+	}
+}
+
+void rvsim_destroy(rvsim* sim)
+{
+	delete sim;
+}
+
+rvsim_status rvsim_load(rvsim* sim, const uint32_t* instructions, size_t instruction_count)
+{
+	return Guard(sim, [&]()
+	{
+		sim->loaded = false;
+		sim->code.assign(instructions, instructions + instruction_count);
+		sim->processor.Load(sim->code.data(), sim->code.size());
+		sim->loaded = true;
+		return RVSIM_OK;
+	});
+}
+
+rvsim_status rvsim_load_file(rvsim* sim, const char* path)
+{
+	return Guard(sim, [&]()
+	{
+		const std::vector<uint32_t> instructions = ReadInstructionFile(path);
+		return rvsim_load(sim, instructions.data(), instructions.size());
+	});
+}
+
+rvsim_status rvsim_run(rvsim* sim, uint64_t max_instructions)
+{
+	if (!sim->loaded)
+	{
+		return Fail(sim, "No program has been loaded.");
+	}
+	return Guard(sim, [&]()
+	{
+		return ToStatus(sim->processor.RunFor(max_instructions));
+	});
+}
+
+void rvsim_read_registers(const rvsim* sim, uint32_t* registers)
+{
+	for (uint32_t i = 0; i < 32; i++)
+	{
+		registers[i] = sim->processor.GetRegister(i);
+	}
+}
+
+uint32_t rvsim_read_pc(const rvsim* sim)
+{
+	return sim->processor.GetPC();
+}
+
+uint64_t rvsim_instructions_executed(const rvsim* sim)
+{
+	return sim->processor.GetInstructionsExecuted();
+}
+
+void rvsim_read_trap(const rvsim* sim, uint32_t* cause, uint32_t* value)
+{
+	const Trap& trap = sim->processor.GetUnhandledTrap();
+	*cause = static_cast<uint32_t>(trap.cause);
+	*value = trap.value;
+}
+
+rvsim_status rvsim_read_memory(rvsim* sim, uint32_t address, void* buffer, size_t size)
+{
+	if (size > UINT32_MAX - address + 1ull)
+	{
+		return Fail(sim, "Memory read wraps around the address space.");
+	}
+	return Guard(sim, [&]()
+	{
+		sim->processor.ReadPhysicalMemory(address, static_cast<uint8_t*>(buffer), static_cast<uint32_t>(size));
+		return RVSIM_OK;
+	});
+}
+
+const char* rvsim_last_error(const rvsim* sim)
+{
+	return sim->lastError.c_str();
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+//C interface of libriscvsim. Every simulator is independent of the
+//others, so any number of them can run at the same time as long as
+//each one is only used by one thread at a time. Nothing is printed
+//or read from the console, ebreak stops the run instead.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef _WIN32
+#define RVSIM_API __declspec(dllexport)
+#else
+#define RVSIM_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct rvsim rvsim;
+
+typedef enum
+{
+	RVSIM_ERROR                 = -1,
+	RVSIM_OK                    = 0,
+	//the guest did ecall with a0 = 10
+	RVSIM_EXITED                = 1,
+	RVSIM_BUDGET_EXHAUSTED      = 2,
+	RVSIM_BREAKPOINT            = 3,
+	RVSIM_WATCHPOINT_HIT        = 4,
+	//a trap without a handler, see rvsim_read_trap
+	RVSIM_TRAP                  = 5,
+	//wfi without a pending interrupt, running again continues after it
+	RVSIM_WAITING_FOR_INTERRUPT = 6
+} rvsim_status;
+
+//ram_size 0 gives the same memory as the simulator executable.
+//Returns null if the memory couldn't be allocated
+RVSIM_API rvsim* rvsim_create(uint32_t ram_size);
+RVSIM_API void rvsim_destroy(rvsim* sim);
+
+//loads little endian instruction words and resets the processor
+RVSIM_API rvsim_status rvsim_load(rvsim* sim, const uint32_t* instructions, size_t instruction_count);
+//loads a .bin file, the path includes the extension
+RVSIM_API rvsim_status rvsim_load_file(rvsim* sim, const char* path);
+
+//runs max_instructions and stops at the next jump, branch or trap,
+//calling it again continues the program
+RVSIM_API rvsim_status rvsim_run(rvsim* sim, uint64_t max_instructions);
+
+//copies x0 to x31 into registers, which must have room for 32 values
+RVSIM_API void rvsim_read_registers(const rvsim* sim, uint32_t* registers);
+RVSIM_API uint32_t rvsim_read_pc(const rvsim* sim);
+RVSIM_API uint64_t rvsim_instructions_executed(const rvsim* sim);
+//cause and value of the trap that stopped the last run with RVSIM_TRAP
+RVSIM_API void rvsim_read_trap(const rvsim* sim, uint32_t* cause, uint32_t* value);
+//reads physical memory, device registers are read like the guest would
+RVSIM_API rvsim_status rvsim_read_memory(rvsim* sim, uint32_t address, void* buffer, size_t size);
+
+//message of the last RVSIM_ERROR, valid until the next call on sim
+RVSIM_API const char* rvsim_last_error(const rvsim* sim);
+
+#ifdef __cplusplus
+}
+#endif
@@ -4,11 +4,12 @@
 #include <memory>
 #include <iostream>
 #include <iomanip>
+#include <sstream>
 #include "InstructionEncode.h"
 #include "InstructionDecode.h"
 #include "Processor.h"
 #include "ReadProgram.h"
-
+#include "SMPSystem.h"
 
 RISCV_Program::RISCV_Program(const std::string name)
 {
@@ -18,6 +19,17 @@ RISCV_Program::RISCV_Program(const std::string name)
         ExpectedRegisters[i] = 0;
 		ActualRegisters[i] = 0;
     }
+	Statistics = { 0 };
+	Memory = Processor::DefaultMemoryOptions();
+	MemoryBacking = { PageBacking::NormalPages, -1, 0 };
+	HasWatchpointHit = false;
+	InstructionsExecuted = 0;
+	HartCount = 1;
+	Quantum = 0;
+	WorkerCount = 0;
+	DecodeThreadCount = 1;
+	Limits = { UINT64_MAX, 0.0 };
+	ElfStart = { 0, 0 };
 }
 void RISCV_Program::SetRegister(Regs reg, uint32_t value)
 {
@@ -31,8 +43,41 @@ void RISCV_Program::ExpectRegisterValue(Regs reg, uint32_t expected)
     ExpectedRegisters[static_cast<uint32_t>(reg)] = expected;
 }
 
+void RISCV_Program::SetInstructions(std::shared_ptr<const ProgramImage> image)
+{
+	Instructions.clear();
+	Image = std::move(image);
+}
+
+void RISCV_Program::SetElf(std::shared_ptr<const ElfImage> elf)
+{
+	Instructions.clear();
+	Image = nullptr;
+	Elf = std::move(elf);
+}
+
+void RISCV_Program::SetElfDefaults(const ElfDefaults& defaults)
+{
+	ElfStart = defaults;
+}
+
+void RISCV_Program::CopyImageInstructions()
+{
+	if (Elf)
+	{
+		throw std::runtime_error("Instructions can't be added to the ELF program " + ProgramName + ".");
+	}
+	if (Image)
+	{
+		const InstructionView view = Image->GetInstructions();
+		Instructions.assign(view.begin(), view.end());
+		Image = nullptr;
+	}
+}
+
 void RISCV_Program::AddInstruction(uint32_t rawInstruction)
 {
+    CopyImageInstructions();
     Instructions.push_back(rawInstruction);
 }
 void RISCV_Program::AddInstruction(MultiInstruction mInstruction)
@@ -49,6 +94,7 @@ void RISCV_Program::AddInstruction(MultiInstruction mInstruction)
 
 void RISCV_Program::RemoveLatestsInstruction()
 {
+	CopyImageInstructions();
 	Instructions.pop_back();
 }
 
@@ -107,11 +153,188 @@ bool RISCV_Program::CheckProgramResult()
 	return CompareRegisters(ExpectedRegisters, ActualRegisters);
 }
 
+void RISCV_Program::AttachDevice(const uint32_t base, const uint32_t size, std::shared_ptr<Device> device)
+{
+	Devices.push_back({ base, size, device });
+}
+
+void RISCV_Program::SetMemoryOptions(const MemoryOptions& options)
+{
+	Memory = options;
+}
+
+void RISCV_Program::AttachFile(const uint32_t base, std::shared_ptr<MappedFile> file)
+{
+	Files.push_back({ base, file });
+}
+
+void RISCV_Program::AddWatchpoint(const Watchpoint& watchpoint)
+{
+	Watchpoints.push_back(watchpoint);
+}
+
+void RISCV_Program::SetLimits(const RunLimits& limits)
+{
+	Limits = limits;
+}
+
+void RISCV_Program::SetHartCount(const uint32_t count)
+{
+	HartCount = count;
+}
+
+void RISCV_Program::SetQuantum(const uint64_t quantum)
+{
+	Quantum = quantum;
+}
+
+void RISCV_Program::SetWorkerCount(const uint32_t count)
+{
+	WorkerCount = count;
+}
+
+void RISCV_Program::SetDecodeThreadCount(const uint32_t count)
+{
+	DecodeThreadCount = count;
+}
+
+void RISCV_Program::SetTrace(std::shared_ptr<TraceSink> sink)
+{
+	Trace = std::move(sink);
+}
+
+void RISCV_Program::RunWithLimits(Processor& processor)
+{
+	::RunWithLimits(processor, Limits, "Program " + ProgramName);
+}
+
+void RISCV_Program::AttachTo(Processor& processor) const
+{
+	for (const AttachedDevice& attached : Devices)
+	{
+		processor.AttachDevice(attached.base, attached.size, attached.device);
+	}
+	for (const AttachedFile& attached : Files)
+	{
+		processor.MapFile(attached.base, *attached.file);
+	}
+	for (const Watchpoint& watchpoint : Watchpoints)
+	{
+		processor.AddWatchpoint(watchpoint);
+	}
+}
+
+//ram grows to hold an elf program
+MemoryOptions RISCV_Program::GetRunMemoryOptions() const
+{
+	MemoryOptions memory = Memory;
+	if (Elf)
+	{
+		memory.ramSize = Elf->GetRAMSize(Memory.ramSize);
+	}
+	return memory;
+}
+
 void RISCV_Program::Run()
 {
-	Processor processor;
-	processor.Run(&Instructions[0], Instructions.size());
+	if (HartCount > 1)
+	{
+		if (Trace)
+		{
+			throw std::runtime_error("Only a program running on a single hart can be traced.");
+		}
+		RunHarts();
+		return;
+	}
+
+	const MemoryOptions memory = GetRunMemoryOptions();
+	Processor processor(memory);
+	AttachTo(processor);
+	if (Elf)
+	{
+		Elf->MapSegments(processor, memory.ramSize);
+		processor.Load(Elf->GetDecodedInstructions(), Elf->GetInstructionBase(), Elf->GetEntry(), Elf->GetInstructions());
+		Elf->CopySegments(processor, memory.ramSize);
+		processor.SetRegister(static_cast<uint32_t>(Regs::sp), Elf->GetStackPointer(memory.ramSize, ElfStart));
+		processor.SetRegister(static_cast<uint32_t>(Regs::gp), Elf->GetGlobalPointer(ElfStart));
+	}
+	else
+	{
+		const InstructionView instructions = GetInstructions();
+		processor.Load(instructions.data, instructions.size, DecodeThreadCount);
+	}
+	if (Trace)
+	{
+		processor.SetTrace(Trace, Elf ? Elf->GetInstructions() : GetInstructions());
+	}
+	RunWithLimits(processor);
 	processor.CopyRegistersTo(ActualRegisters);
+	Statistics = processor.GetMMUStatistics();
+	InstructionsExecuted = processor.GetInstructionsExecuted();
+	MemoryBacking = processor.GetMemoryBackingInfo();
+	HasWatchpointHit = processor.GetWatchpointHit() != nullptr;
+	if (HasWatchpointHit)
+	{
+		LastWatchpointHit = *processor.GetWatchpointHit();
+	}
+}
+
+void RISCV_Program::RunHarts()
+{
+	const MemoryOptions memory = GetRunMemoryOptions();
+	SMPSystem system(HartCount, memory);
+	//devices, files and watchpoints live in the shared memory
+	//so attaching them through one hart attaches them for all
+	AttachTo(system.GetHart(0));
+	if (Elf)
+	{
+		Elf->MapSegments(system.GetHart(0), memory.ramSize);
+		system.Load(Elf->GetDecodedInstructions(), Elf->GetInstructionBase(), Elf->GetEntry(), Elf->GetStackPointer(memory.ramSize, ElfStart),
+			Elf->GetInstructions());
+		Elf->CopySegments(system.GetHart(0), memory.ramSize);
+		for (uint32_t i = 0; i < HartCount; i++)
+		{
+			system.GetHart(i).SetRegister(static_cast<uint32_t>(Regs::gp), Elf->GetGlobalPointer(ElfStart));
+		}
+	}
+	else
+	{
+		const InstructionView instructions = GetInstructions();
+		system.Load(instructions.data, instructions.size, DecodeThreadCount);
+	}
+	std::vector<RunStatus> statuses;
+	if (Quantum > 0)
+	{
+		statuses = system.RunRoundRobin(Limits, Quantum);
+	}
+	else if (WorkerCount > 0)
+	{
+		statuses = system.RunOnWorkers(Limits, WorkerCount);
+	}
+	else
+	{
+		statuses = system.Run(Limits);
+	}
+
+	HasWatchpointHit = false;
+	for (uint32_t i = 0; i < statuses.size(); i++)
+	{
+		if (statuses[i] == RunStatus::Trap)
+		{
+			throw std::runtime_error("Hart " + std::to_string(i) + ": " + system.GetHart(i).GetUnhandledTrapMessage());
+		}
+		if (!HasWatchpointHit && system.GetHart(i).GetWatchpointHit() != nullptr)
+		{
+			LastWatchpointHit = *system.GetHart(i).GetWatchpointHit();
+			HasWatchpointHit = true;
+		}
+	}
+
+	Processor& hart = system.GetHart(0);
+	hart.CopyRegistersTo(ActualRegisters);
+	Statistics = hart.GetMMUStatistics();
+	InstructionsExecuted = system.GetInstructionsExecuted();
+	MemoryBacking = hart.GetMemoryBackingInfo();
 }
 
 void RISCV_Program::Test()
@@ -141,10 +364,11 @@ void RISCV_Program::Save(const std::string& filepath) const
 	const std::string registerFile = filepath + ".res";
 	const std::string assemblyFile = filepath + ".s";
 
-	WriteFile(binFile     , reinterpret_cast<const char*>(&Instructions[0]) , sizeof(uint32_t) * Instructions.size());
+	const InstructionView instructions = GetInstructions();
+	WriteFile(binFile     , reinterpret_cast<const char*>(instructions.data), sizeof(uint32_t) * instructions.size);
 	WriteFile(registerFile, reinterpret_cast<const char*>(ExpectedRegisters), sizeof(uint32_t) * 32);
 
-	const std::string programAsText = GetProgramAsString(&Instructions[0], Instructions.size());
+	const std::string programAsText = GetProgramAsString(instructions.data, instructions.size);
 	WriteFile(assemblyFile, programAsText.c_str(), programAsText.length());
 }
 
@@ -159,6 +383,96 @@ std::string RISCV_Program::GetProgramName() const
 	return ProgramName;
 }
 
+size_t RISCV_Program::GetInstructionCount() const
+{
+	return GetInstructions().size;
+}
+
+InstructionView RISCV_Program::GetInstructions() const
+{
+	if (Elf)
+	{
+		return Elf->GetInstructions();
+	}
+	return Image ? Image->GetInstructions() : InstructionView{ Instructions.data(), Instructions.size() };
+}
+
+const ElfImage* RISCV_Program::GetElf() const
+{
+	return Elf.get();
+}
+
+uint64_t RISCV_Program::GetInstructionsExecuted() const
+{
+	return InstructionsExecuted;
+}
+
+const MMUStatistics& RISCV_Program::GetStatistics() const
+{
+	return Statistics;
+}
+
+const MemoryBackingInfo& RISCV_Program::GetMemoryBacking() const
+{
+	return MemoryBacking;
+}
+
+void RISCV_Program::PrintStatistics() const
+{
+	const uint64_t lookups = Statistics.tlbHits + Statistics.tlbMisses;
+	const double hitRate = (lookups == 0) ? 0.0 : (100.0 * Statistics.tlbHits) / lookups;
+
+	std::cout << "TLB lookups: " << lookups << std::endl;
+	std::cout << "TLB hit rate: " << std::fixed << std::setprecision(2) << hitRate << "%" << std::endl;
+	std::cout << "Page walks: " << Statistics.pageWalks << std::endl;
+	std::cout << "Page faults: " << Statistics.pageFaults << std::endl;
+	std::cout << "TLB flushes: " << Statistics.tlbFlushes << std::endl;
+	std::cout << "Memory backing: " << PageBackingName(MemoryBacking.backing) << std::endl;
+	std::cout << "Huge page backed memory: " << (MemoryBacking.hugePageBytes / 1024) << " KiB" << std::endl;
+	if (MemoryBacking.numaNode >= 0)
+	{
+		std::cout << "NUMA node: " << MemoryBacking.numaNode << std::endl;
+	}
+	else
+	{
+		std::cout << "NUMA node: not bound" << std::endl;
+	}
+}
+
+const WatchpointHit* RISCV_Program::GetWatchpointHit() const
+{
+	return HasWatchpointHit ? &LastWatchpointHit : nullptr;
+}
+
+static std::string ToHex(const uint32_t value)
+{
+	std::ostringstream stream;
+	stream << "0x" << std::hex << std::setw(8) << std::setfill('0') << value;
+	return stream.str();
+}
+
+void RISCV_Program::PrintWatchpointHit() const
+{
+	if (!HasWatchpointHit)
+	{
+		return;
+	}
+
+	const WatchpointHit& hit = LastWatchpointHit;
+	std::cout << "Watchpoint hit by " << (hit.isWrite ? "write" : "read") << " of " << hit.size << " bytes at " << ToHex(hit.address) << std::endl;
+	std::cout << "Watching: " << ToHex(hit.watchpoint.address) << " - " << ToHex(hit.watchpoint.address + hit.watchpoint.size - 1) << std::endl;
+	std::cout << "pc: " << ToHex(hit.pc) << "  " << hit.instruction << std::endl;
+	if (hit.isWrite)
+	{
+		std::cout << "Old value: " << ToHex(hit.oldValue) << std::endl;
+		std::cout << "New value: " << ToHex(hit.newValue) << std::endl;
+	}
+	else
+	{
+		std::cout << "Value: " << ToHex(hit.oldValue) << std::endl;
+	}
+}
+
 const uint32_t* RISCV_Program::GetProgramResult() const
 {
 	return ActualRegisters;
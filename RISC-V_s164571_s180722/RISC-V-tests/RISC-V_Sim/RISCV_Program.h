@@ -7,33 +7,114 @@
 #include "InstructionEncode.h"
 #include "Register.h"
 #include "Processor.h"
+#include "Device.h"
+#include "Watchpoint.h"
+#include "MappedFile.h"
+#include "ProgramImage.h"
+#include "ElfImage.h"
+#include "TraceSink.h"
+
+struct AttachedDevice
+{
+	uint32_t base;
+	uint32_t size;
+	std::shared_ptr<Device> device;
+};
+
+struct AttachedFile
+{
+	uint32_t base;
+	std::shared_ptr<MappedFile> file;
+};
 
 class RISCV_Program
 {
 private:
 	std::string ProgramName;
 	std::vector<uint32_t> Instructions;
+	//a loaded program uses the words of its file until an
+	//instruction is added or removed, which copies them
+	std::shared_ptr<const ProgramImage> Image;
+	//set instead of the instructions for an elf program
+	std::shared_ptr<const ElfImage> Elf;
+	ElfDefaults ElfStart;
 	uint32_t ExpectedRegisters[32];
 	uint32_t ActualRegisters[32];
+	MMUStatistics Statistics;
+	MemoryOptions Memory;
+	MemoryBackingInfo MemoryBacking;
+	std::vector<AttachedDevice> Devices;
+	std::vector<AttachedFile> Files;
+	std::vector<Watchpoint> Watchpoints;
+	bool HasWatchpointHit;
+	WatchpointHit LastWatchpointHit;
+
+	uint64_t InstructionsExecuted;
+	RunLimits Limits;
+	uint32_t HartCount;
+	uint64_t Quantum;
+	uint32_t WorkerCount;
+	uint32_t DecodeThreadCount;
+	std::shared_ptr<TraceSink> Trace;
 
 	std::string GetRegisterComparison();
-	bool CheckProgramResult();
+	void CopyImageInstructions();
+	void AttachTo(Processor& processor) const;
+	MemoryOptions GetRunMemoryOptions() const;
+	void RunWithLimits(Processor& processor);
+	void RunHarts();
 
 public:
 	RISCV_Program(const std::string name);
 
 	void SetRegister(Regs reg, uint32_t value);
 	void ExpectRegisterValue(Regs reg, uint32_t expected);
+	//replaces the instructions with the words of a .bin file
+	void SetInstructions(std::shared_ptr<const ProgramImage> image);
+	//runs an elf executable instead of instructions from address 0,
+	//no instructions can be added to it
+	void SetElf(std::shared_ptr<const ElfImage> elf);
+	void SetElfDefaults(const ElfDefaults& defaults);
 	void AddInstruction(uint32_t rawInstruction);
 	void AddInstruction(MultiInstruction mInstruction);
 	void RemoveLatestsInstruction();
 	void EndProgram();
+	void AttachDevice(const uint32_t base, const uint32_t size, std::shared_ptr<Device> device);
+	void SetMemoryOptions(const MemoryOptions& options);
+	void AttachFile(const uint32_t base, std::shared_ptr<MappedFile> file);
+	void AddWatchpoint(const Watchpoint& watchpoint);
+	void SetLimits(const RunLimits& limits);
+	//more than one hart runs the program on an SMPSystem,
+	//the result is the registers of hart 0
+	void SetHartCount(const uint32_t count);
+	//harts take turns on one thread, running quantum instructions each.
+	//0 runs every hart on its own thread
+	void SetQuantum(const uint64_t quantum);
+	//harts run in slices on a pool of that many threads.
+	//0 runs every hart on its own thread
+	void SetWorkerCount(const uint32_t count);
+	//threads the program is decoded on when it's run, 0 for one per core
+	void SetDecodeThreadCount(const uint32_t count);
+	//gives sink a record for every instruction the program retires,
+	//only a program running on a single hart can be traced
+	void SetTrace(std::shared_ptr<TraceSink> sink);
 
 	void Run();
 	void Test();
+	bool CheckProgramResult();
 	void Save(const std::string& filepath) const;
 	void SaveProgramResult(const std::string& filepath) const;
 	std::string GetProgramName() const;
+	size_t GetInstructionCount() const;
+	InstructionView GetInstructions() const;
+	//null unless the program is an elf executable
+	const ElfImage* GetElf() const;
+	uint64_t GetInstructionsExecuted() const;
+	const MMUStatistics& GetStatistics() const;
+	const MemoryBackingInfo& GetMemoryBacking() const;
+	void PrintStatistics() const;
+	const WatchpointHit* GetWatchpointHit() const;
+	void PrintWatchpointHit() const;
 	const uint32_t* GetProgramResult() const;
 	void ActualToExpectedRegisters();
 	void PrintResult();
@@ -4,6 +4,8 @@
 #include <stdexcept>
 #include <fstream>
 #include <memory>
+#include "ProgramImage.h"
+#include "ElfImage.h"
 
 static const char* ReadFileContent(const std::string filename, uint64_t* fileSize)
 {
@@ -46,26 +48,6 @@ static uint32_t* char_to_uint32_t(const char* chars, const uint64_t fileSize)
 	return uints;
 }
 
-static const uint32_t* ReadInstructions(const std::string& filePath, uint32_t* instructionCount)
-{
-	const std::string instructionsFile = filePath + ".bin";
-	uint64_t fileSize;
-	const char* fileContent = ReadFileContent(instructionsFile, &fileSize);
-
-	//make sure file can be converted to integer array
-	if (fileSize % 4 != 0 || fileSize  == 0)
-	{
-		delete[] fileContent;
-		throw std::runtime_error("File doesn't have the correct length. Length: " + std::to_string(fileSize));
-	}
-
-	const uint32_t* instructions = char_to_uint32_t(fileContent, fileSize);
-	delete[] fileContent;
-
-	*instructionCount = static_cast<uint32_t>(fileSize / 4);
-	return instructions;
-}
-
 static const uint32_t* ReadRegisters(const std::string& filePath)
 {
 	const std::string registerFile = filePath + ".res";
@@ -85,17 +67,26 @@ static const uint32_t* ReadRegisters(const std::string& filePath)
 	return registers;
 }
 
-static void AddInstructionsToProgram(std::unique_ptr<RISCV_Program>& program, const std::string& filePath)
+//the file is mapped and decoded where it is instead of being copied
+//into the program word by word. An elf file is found by its magic number,
+//either at the path itself or in place of the .bin file
+static void AddInstructionsToProgram(std::unique_ptr<RISCV_Program>& program, const std::string& filePath, const uint32_t decodeThreadCount)
 {
-	uint32_t instructionCount;
-	const uint32_t* rawInstructions = ReadInstructions(filePath, &instructionCount);
-	for (size_t i = 0; i < instructionCount; i++)
+	program->SetDecodeThreadCount(decodeThreadCount);
+	if (IsElfFile(filePath))
 	{
-		program->AddInstruction(rawInstructions[i]);
+		program->SetElf(std::make_shared<ElfImage>(filePath, decodeThreadCount));
+	}
+	else if (IsElfFile(filePath + ".bin"))
+	{
+		program->SetElf(std::make_shared<ElfImage>(filePath + ".bin", decodeThreadCount));
+	}
+	else
+	{
+		program->SetInstructions(std::make_shared<ProgramImage>(filePath + ".bin"));
 	}
-	delete[] rawInstructions;
 }
-static void AddRegistersToProgram(std::unique_ptr<RISCV_Program>& program, const std::string& filePath)
+static bool AddRegistersToProgram(std::unique_ptr<RISCV_Program>& program, const std::string& filePath)
 {
 	try
 	{
@@ -107,20 +98,33 @@ static void AddRegistersToProgram(std::unique_ptr<RISCV_Program>& program, const
 			program->ExpectRegisterValue(static_cast<Regs>(i), registers[i]);
 		}
 		delete[] registers;
+		return true;
 	}
 	catch (const std::exception&)
 	{
-		//it's not exactly an error that there isn't a register file
-		//but atleast notify the user about it
-		std::cout << "Warning: No register file found" << std::endl;
+		return false;
 	}
 }
 
-std::unique_ptr<RISCV_Program> LoadProgram(const std::string& filePath)
+std::unique_ptr<RISCV_Program> LoadProgram(const std::string& filePath, bool* foundRegisterFile, const uint32_t decodeThreadCount)
 {
 	std::unique_ptr<RISCV_Program> program = std::make_unique<RISCV_Program>(filePath);
-	AddInstructionsToProgram(program, filePath);
-	AddRegistersToProgram(program, filePath);
+	AddInstructionsToProgram(program, filePath, decodeThreadCount);
+	*foundRegisterFile = AddRegistersToProgram(program, filePath);
+
+	return program;
+}
+
+std::unique_ptr<RISCV_Program> LoadProgram(const std::string& filePath, const uint32_t decodeThreadCount)
+{
+	bool foundRegisterFile;
+	std::unique_ptr<RISCV_Program> program = LoadProgram(filePath, &foundRegisterFile, decodeThreadCount);
+	if (!foundRegisterFile)
+	{
+		//it's not exactly an error that there isn't a register file
+		//but atleast notify the user about it
+		std::cout << "Warning: No register file found" << std::endl;
+	}
 
 	return program;
 }
\ No newline at end of file
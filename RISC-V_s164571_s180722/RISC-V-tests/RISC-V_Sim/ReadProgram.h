@@ -5,4 +5,7 @@
 #include <memory>
 #include "RISCV_Program.h"
 
-std::unique_ptr<RISCV_Program> LoadProgram(const std::string& filePath);
\ No newline at end of file
+//the program is decoded on decodeThreadCount threads, 0 for one per core
+std::unique_ptr<RISCV_Program> LoadProgram(const std::string& filePath, const uint32_t decodeThreadCount = 1);
+//doesn't print anything, instead tells if a register file was found
+std::unique_ptr<RISCV_Program> LoadProgram(const std::string& filePath, bool* foundRegisterFile, const uint32_t decodeThreadCount = 1);
\ No newline at end of file
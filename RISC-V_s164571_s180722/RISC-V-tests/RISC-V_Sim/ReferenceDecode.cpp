@@ -0,0 +1,206 @@
+#include "ReferenceDecode.h"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "Instruction.h"
+#include "InstructionFormat.h"
+#include "ImmediateFormat.h"
+
+static uint32_t GetImmediateMask(uint16_t instructionIdentifier)
+{
+	const uint32_t removefunct7    = 0b00000000'00000000'00000000'00011111;
+	const uint32_t wholeidentifier = 0b11111111'11111111'11111111'11111111;
+	switch (instructionIdentifier)
+	{
+		case 0b000000'001'0010011:
+		case 0b000000'101'0010011:
+			return removefunct7;
+		default:
+			return wholeidentifier;
+	}
+}
+
+static uint16_t GetInstructionIdentifierMask(uint16_t instructionIdentifier)
+{
+	const uint16_t onlyOpCodeAndFunct3 = 0b000000'111'1111111;
+	const uint16_t wholeidentifier     = 0b111111'111'1111111;
+	switch (instructionIdentifier & onlyOpCodeAndFunct3)
+	{
+		case 0b000000'001'0010011:
+		case 0b000000'101'0010011:
+		case 0b000000'000'0110011:
+		case 0b000000'001'0110011:
+		case 0b000000'010'0110011:
+		case 0b000000'011'0110011:
+		case 0b000000'100'0110011:
+		case 0b000000'101'0110011:
+		case 0b000000'110'0110011:
+		case 0b000000'111'0110011:
+		case 0b000000'000'1110011:
+		case 0b000000'010'0101111:
+			return wholeidentifier;
+		default:
+			return onlyOpCodeAndFunct3;
+	}
+}
+
+static InstructionType GetInstructionType(const uint32_t opcode, const uint32_t funct3, const uint32_t funct7OrImmediate)
+{
+	const uint16_t instructionIdentifier = static_cast<uint16_t>((opcode            <<  0) |
+																 (funct3            <<  7) |
+																 (funct7OrImmediate << 10));
+	const uint16_t mask = GetInstructionIdentifierMask(instructionIdentifier);
+
+	//the type of every identifier, found once
+	static const std::vector<InstructionType> types = []()
+	{
+		std::vector<InstructionType> typeOfIdentifier(1 << 16);
+		for (uint32_t identifier = 0; identifier < typeOfIdentifier.size(); identifier++)
+		{
+			typeOfIdentifier[identifier] = InstructionTypeFromIdentifier(identifier);
+		}
+		return typeOfIdentifier;
+	}();
+	return types[instructionIdentifier & mask];
+}
+
+static Instruction DecodeRType(const uint32_t rawInstruction)
+{
+	RType rType(rawInstruction);
+	Instruction decoded = { 0 };
+	decoded.rd   = rType.rd.GetAsInt();
+	decoded.rs1  = rType.rs1.GetAsInt();
+	decoded.rs2  = rType.rs2.GetAsInt();
+	decoded.type = GetInstructionType(rType.opcode.GetAsInt(), rType.funct3.GetAsInt(), rType.funct7.GetAsInt());
+
+	return decoded;
+}
+
+//funct5 picks the operation, the aq and rl bits below
+//it are kept in the immediate which is otherwise unused
+static Instruction DecodeAtomicType(const uint32_t rawInstruction)
+{
+	RType rType(rawInstruction);
+	Instruction decoded = { 0 };
+	decoded.rd        = rType.rd.GetAsInt();
+	decoded.rs1       = rType.rs1.GetAsInt();
+	decoded.rs2       = rType.rs2.GetAsInt();
+	decoded.immediate = rType.funct7.GetAsInt() & 0b11;
+	decoded.type      = GetInstructionType(rType.opcode.GetAsInt(), rType.funct3.GetAsInt(), rType.funct7.GetAsInt() >> 2);
+
+	return decoded;
+}
+
+static Instruction DecodeIType(const uint32_t rawInstruction)
+{
+	const IType iType(rawInstruction);
+
+	Instruction decoded = { 0 };
+	decoded.rd         = iType.rd.GetAsInt();
+	decoded.rs1        = iType.rs1.GetAsInt();
+	decoded.immediate  = SignExtend<12>(iType.immediate.GetAsInt());
+	decoded.type       = GetInstructionType(iType.opcode.GetAsInt(), iType.funct3.GetAsInt(), iType.immediate.GetAsInt() >> 5);
+	decoded.immediate &= GetImmediateMask((iType.funct3.GetAsInt() << 7) | iType.opcode.GetAsInt());
+	//sret and wfi only differ in what would be rs2 in an r type
+	if (decoded.type == InstructionType::sret && (iType.immediate.GetAsInt() & 0b11111) == 0b00101)
+	{
+		decoded.type = InstructionType::wfi;
+	}
+
+	return decoded;
+}
+
+static Instruction DecodeSType(const uint32_t rawInstruction)
+{
+	const SType sType(rawInstruction);
+	Instruction decoded = { 0 };
+	decoded.rs1 = sType.rs1.GetAsInt();
+	decoded.rs2 = sType.rs2.GetAsInt();
+	decoded.immediate = sType.GetImmediate();
+	decoded.type = GetInstructionType(sType.opcode.GetAsInt(), sType.funct3.GetAsInt(), 0);
+
+	return decoded;
+}
+
+static Instruction DecodeSBType(const uint32_t rawInstruction)
+{
+	const SBType sbType(rawInstruction);
+	Instruction decoded = { 0 };
+	decoded.rs1 = sbType.rs1.GetAsInt();
+	decoded.rs2 = sbType.rs2.GetAsInt();
+	decoded.immediate = sbType.GetImmediate();
+	decoded.type = GetInstructionType(sbType.opcode.GetAsInt(), sbType.funct3.GetAsInt(), 0);
+
+	return decoded;
+}
+
+static Instruction DecodeUJType(const uint32_t rawInstruction)
+{
+	const UJType ujType(rawInstruction);
+	Instruction decoded = { 0 };
+	decoded.rd = ujType.rd.GetAsInt();
+	decoded.immediate = ujType.GetImmediate();
+	decoded.type = GetInstructionType(ujType.opcode.GetAsInt(), 0, 0);
+
+	return decoded;
+}
+
+static Instruction DecodeUType(const uint32_t rawInstruction)
+{
+	const UType uType(rawInstruction);
+	Instruction decoded = { 0 };
+	decoded.rd = uType.rd.GetAsInt();
+	decoded.immediate = uType.GetImmediate();
+	decoded.type = GetInstructionType(uType.opcode.GetAsInt(), 0, 0);
+
+	return decoded;
+}
+
+bool ReferenceTryDecodeInstruction(const uint32_t rawInstruction, Instruction& decoded)
+{
+	//opcode is the first 7 bits
+	const uint32_t opcode = rawInstruction & 127;
+
+	switch (opcode)
+	{
+		case 0b0000011:
+		case 0b0001111:
+		case 0b0010011:
+		case 0b1100111:
+		case 0b1110011:
+			decoded = DecodeIType(rawInstruction);
+			return true;
+		case 0b0010111:
+		case 0b0110111:
+			decoded = DecodeUType(rawInstruction);
+			return true;
+		case 0b0100011:
+			decoded = DecodeSType(rawInstruction);
+			return true;
+		case 0b0110011:
+			decoded = DecodeRType(rawInstruction);
+			return true;
+		case 0b0101111:
+			decoded = DecodeAtomicType(rawInstruction);
+			return true;
+		case 0b1100011:
+			decoded = DecodeSBType(rawInstruction);
+			return true;
+		case 0b1101111:
+			decoded = DecodeUJType(rawInstruction);
+			return true;
+		default:
+			return false;
+	}
+}
+
+Instruction ReferenceDecodeInstruction(const uint32_t rawInstruction)
+{
+	Instruction decoded;
+	if (!ReferenceTryDecodeInstruction(rawInstruction, decoded))
+	{
+		throw std::runtime_error("Invalid opcode. opcode: " + std::to_string(rawInstruction & 127));
+	}
+	return decoded;
+}
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+#include "Instruction.h"
+
+//The decoder from before the decode tables, which puts every instruction
+//together field by field with the instruction format classes. It's slow but
+//simple, so the table driven decoder is checked and benchmarked against it.
+Instruction ReferenceDecodeInstruction(const uint32_t rawInstruction);
+//false for a word that isn't an instruction, which is much faster than
+//catching the error when most words aren't, like in a sweep of every word
+bool ReferenceTryDecodeInstruction(const uint32_t rawInstruction, Instruction& decoded);
\ No newline at end of file
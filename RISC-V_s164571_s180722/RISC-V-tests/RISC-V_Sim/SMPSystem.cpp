@@ -0,0 +1,343 @@
+#include "SMPSystem.h"
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <algorithm>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include "CSR.h"
+#include "WorkStealingPool.h"
+#include "InstructionDecode.h"
+
+//how many instructions a hart runs between checking the limits
+//and whether another hart has failed
+static const uint64_t HART_SLICE = 1 << 20;
+
+SMPSystem::SMPSystem(const uint32_t hartCount, const MemoryOptions& memoryOptions, const uint32_t stackSize) :
+	memory(std::make_shared<PhysicalMemory>(memoryOptions)),
+	stackSize(stackSize)
+{
+	if (hartCount == 0)
+	{
+		throw std::runtime_error("A system needs at least one hart.");
+	}
+	if (static_cast<uint64_t>(hartCount - 1) * stackSize >= memory->GetRAMSize())
+	{
+		throw std::runtime_error("Ram is too small for the stacks of " + std::to_string(hartCount) + " harts.");
+	}
+
+	memory->SetShared(true);
+	for (uint32_t i = 0; i < hartCount; i++)
+	{
+		harts.push_back(std::make_unique<Processor>(memory, i));
+		harts.back()->SetUseConsole(false);
+	}
+	if (memory->GetRAMSize() <= CLINT::DEFAULT_BASE)
+	{
+		clint = std::make_shared<CLINT>(hartCount, [this](const uint32_t hartId, const bool pending)
+		{
+			SetSoftwareInterrupt(hartId, pending);
+		});
+		memory->MapDevice(CLINT::DEFAULT_BASE, CLINT::SIZE, clint);
+	}
+}
+
+void SMPSystem::SetSoftwareInterrupt(const uint32_t hartId, const bool pending)
+{
+	harts[hartId]->SetInterruptPending(Interrupt::MSIP, pending);
+	if (pending && wakeHart)
+	{
+		wakeHart(hartId);
+	}
+}
+
+void SMPSystem::Load(const uint32_t* rawInstructions, const size_t instructionCount, const uint32_t decodeThreadCount)
+{
+	//every hart runs the same decoded program
+	Load(DecodeInstructions(rawInstructions, instructionCount, decodeThreadCount), 0, 0, memory->GetRAMSize(), { rawInstructions, instructionCount });
+}
+
+void SMPSystem::Load(std::shared_ptr<const std::vector<Instruction>> decodedInstructions, const uint32_t instructionBase, const uint32_t entry,
+	const uint32_t stackTop, const InstructionView code)
+{
+	memory->ClearRAM();
+	if (clint)
+	{
+		clint->Reset();
+	}
+	for (uint32_t i = 0; i < harts.size(); i++)
+	{
+		harts[i]->Load(decodedInstructions, instructionBase, entry, code);
+		harts[i]->SetRegister(static_cast<uint32_t>(Regs::sp), stackTop - i * stackSize);
+	}
+}
+
+std::vector<RunStatus> SMPSystem::Run(const RunLimits& limits)
+{
+	std::vector<RunStatus> statuses(harts.size(), RunStatus::BudgetExhausted);
+	std::vector<std::string> errors(harts.size());
+	std::atomic<bool> failed(false);
+	//harts in wfi without a pending interrupt sleep until one is raised
+	//for them. Once every hart that hasn't stopped sleeps, none of them
+	//can be woken up anymore
+	std::vector<bool> parked(harts.size(), false);
+	size_t running = harts.size();
+	size_t waiting = 0;
+	bool allWaiting = false;
+	std::mutex waitLock;
+	std::condition_variable interruptRaised;
+	const auto start = std::chrono::steady_clock::now();
+
+	//only called with waitLock held
+	const auto checkAllWaiting = [&]()
+	{
+		if (!failed.load(std::memory_order_relaxed) && running > 0 && waiting == running)
+		{
+			allWaiting = true;
+			failed.store(true, std::memory_order_relaxed);
+		}
+		interruptRaised.notify_all();
+	};
+	wakeHart = [&](const uint32_t i)
+	{
+		std::lock_guard<std::mutex> guard(waitLock);
+		if (parked[i])
+		{
+			parked[i] = false;
+			waiting--;
+			interruptRaised.notify_all();
+		}
+	};
+
+	std::vector<std::thread> threads;
+	for (uint32_t i = 0; i < harts.size(); i++)
+	{
+		threads.emplace_back([&, i]()
+		{
+			Processor& hart = *harts[i];
+			try
+			{
+				while (!failed.load(std::memory_order_relaxed))
+				{
+					const uint64_t remaining = CheckRunLimits(hart, limits, start, "Program");
+					statuses[i] = hart.RunFor(std::min(remaining, HART_SLICE));
+					if (statuses[i] == RunStatus::WaitingForInterrupt)
+					{
+						//the interrupt is raised before the raising hart takes the
+						//lock, so checking it again under the lock can't miss it
+						std::unique_lock<std::mutex> lock(waitLock);
+						if (!hart.IsInterruptPending())
+						{
+							parked[i] = true;
+							waiting++;
+							checkAllWaiting();
+							interruptRaised.wait(lock, [&]() { return !parked[i] || failed.load(std::memory_order_relaxed); });
+							if (parked[i])
+							{
+								parked[i] = false;
+								waiting--;
+							}
+						}
+					}
+					else if (statuses[i] != RunStatus::BudgetExhausted)
+					{
+						break;
+					}
+				}
+			}
+			catch (const std::runtime_error& e)
+			{
+				errors[i] = e.what();
+				failed.store(true, std::memory_order_relaxed);
+			}
+
+			std::lock_guard<std::mutex> guard(waitLock);
+			running--;
+			checkAllWaiting();
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+	wakeHart = nullptr;
+
+	for (uint32_t i = 0; i < harts.size(); i++)
+	{
+		if (!errors[i].empty())
+		{
+			throw std::runtime_error("Hart " + std::to_string(i) + ": " + errors[i]);
+		}
+	}
+	if (allWaiting)
+	{
+		throw std::runtime_error("Every hart that hasn't stopped is waiting for an interrupt.");
+	}
+	return statuses;
+}
+
+std::vector<RunStatus> SMPSystem::RunRoundRobin(const RunLimits& limits, const uint64_t quantum)
+{
+	if (quantum == 0)
+	{
+		throw std::runtime_error("The quantum has to be at least one instruction.");
+	}
+
+	std::vector<RunStatus> statuses(harts.size(), RunStatus::BudgetExhausted);
+	const auto start = std::chrono::steady_clock::now();
+	size_t running = harts.size();
+	while (running > 0)
+	{
+		bool anyRan = false;
+		for (uint32_t i = 0; i < harts.size(); i++)
+		{
+			Processor& hart = *harts[i];
+			const bool waiting = statuses[i] == RunStatus::WaitingForInterrupt;
+			if ((statuses[i] != RunStatus::BudgetExhausted && !waiting) || (waiting && !hart.IsInterruptPending()))
+			{
+				continue;
+			}
+			anyRan = true;
+
+			//a hart keeps all of its state in its processor,
+			//so switching to the next one costs nothing
+			try
+			{
+				const uint64_t remaining = CheckRunLimits(hart, limits, start, "Program");
+				statuses[i] = hart.RunFor(std::min(remaining, quantum));
+			}
+			catch (const std::runtime_error& e)
+			{
+				throw std::runtime_error("Hart " + std::to_string(i) + ": " + e.what());
+			}
+			if (statuses[i] != RunStatus::BudgetExhausted && statuses[i] != RunStatus::WaitingForInterrupt)
+			{
+				running--;
+			}
+		}
+		//only a hart can wake up another one
+		if (!anyRan)
+		{
+			throw std::runtime_error("Every hart that hasn't stopped is waiting for an interrupt.");
+		}
+	}
+	return statuses;
+}
+
+std::vector<RunStatus> SMPSystem::RunOnWorkers(const RunLimits& limits, const uint32_t workerCount, const uint64_t slice)
+{
+	if (slice == 0)
+	{
+		throw std::runtime_error("The slice has to be at least one instruction.");
+	}
+
+	std::vector<RunStatus> statuses(harts.size(), RunStatus::BudgetExhausted);
+	std::vector<std::string> errors(harts.size());
+	std::atomic<bool> failed(false);
+	//harts in wfi without a pending interrupt, they are
+	//in no queue until an interrupt is raised for them
+	std::vector<bool> parked(harts.size(), false);
+	std::mutex parkedLock;
+	const auto start = std::chrono::steady_clock::now();
+
+	WorkStealingPool pool(workerCount);
+	std::function<void(const uint32_t)> runSlice = [&](const uint32_t i)
+	{
+		if (failed.load(std::memory_order_relaxed))
+		{
+			return;
+		}
+		Processor& hart = *harts[i];
+		try
+		{
+			const uint64_t remaining = CheckRunLimits(hart, limits, start, "Program");
+			statuses[i] = hart.RunFor(std::min(remaining, slice));
+		}
+		catch (const std::runtime_error& e)
+		{
+			errors[i] = e.what();
+			failed.store(true, std::memory_order_relaxed);
+			return;
+		}
+
+		if (statuses[i] == RunStatus::WaitingForInterrupt)
+		{
+			//the interrupt is raised before the raising hart takes the
+			//lock, so checking it again under the lock can't miss it
+			std::lock_guard<std::mutex> guard(parkedLock);
+			if (!hart.IsInterruptPending())
+			{
+				parked[i] = true;
+				return;
+			}
+		}
+		else if (statuses[i] != RunStatus::BudgetExhausted)
+		{
+			return;
+		}
+		pool.SubmitBehind([&runSlice, i]() { runSlice(i); });
+	};
+	wakeHart = [&](const uint32_t i)
+	{
+		std::lock_guard<std::mutex> guard(parkedLock);
+		if (parked[i])
+		{
+			parked[i] = false;
+			pool.Submit([&runSlice, i]() { runSlice(i); });
+		}
+	};
+
+	for (uint32_t i = 0; i < harts.size(); i++)
+	{
+		pool.Submit([&runSlice, i]() { runSlice(i); });
+	}
+	//waking a hart requeues it from a task that is still running,
+	//so the pool is only empty when no hart can run again
+	pool.Wait();
+	wakeHart = nullptr;
+
+	for (uint32_t i = 0; i < harts.size(); i++)
+	{
+		if (!errors[i].empty())
+		{
+			throw std::runtime_error("Hart " + std::to_string(i) + ": " + errors[i]);
+		}
+	}
+	for (uint32_t i = 0; i < harts.size(); i++)
+	{
+		if (parked[i])
+		{
+			throw std::runtime_error("Every hart that hasn't stopped is waiting for an interrupt.");
+		}
+	}
+	return statuses;
+}
+
+uint32_t SMPSystem::GetHartCount() const
+{
+	return static_cast<uint32_t>(harts.size());
+}
+
+Processor& SMPSystem::GetHart(const uint32_t hartId)
+{
+	return *harts.at(hartId);
+}
+
+uint64_t SMPSystem::GetInstructionsExecuted() const
+{
+	uint64_t executed = 0;
+	for (const auto& hart : harts)
+	{
+		executed += hart->GetInstructionsExecuted();
+	}
+	return executed;
+}
+
+void SMPSystem::ReadPhysicalMemory(const uint32_t address, uint8_t* buffer, const uint32_t size)
+{
+	harts[0]->ReadPhysicalMemory(address, buffer, size);
+}
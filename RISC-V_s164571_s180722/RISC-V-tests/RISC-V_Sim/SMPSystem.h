@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "Processor.h"
+#include "PhysicalMemory.h"
+#include "CLINT.h"
+
+//Harts sharing one physical memory, each run on its own host thread,
+//all of them taking turns on the calling thread or spread over a pool
+//of worker threads. Every hart runs the same program and tells itself apart from the
+//others by reading mhartid. Plain loads and stores are relaxed, a hart
+//only sees the stores of another in order after a fence. Devices are
+//called from whichever thread accesses them and have to do their own
+//locking if more than one hart uses them. A CLINT at its default
+//address lets harts wake each other up from wfi, unless ram reaches it.
+class SMPSystem
+{
+public:
+	//bytes of stack below the previous hart's stack pointer
+	const static uint32_t DEFAULT_STACK_SIZE = 0x1000;
+	//instructions a hart runs before the next one gets its turn
+	const static uint64_t DEFAULT_QUANTUM = 1000;
+	//instructions a hart runs on a worker before going back in the queue
+	const static uint64_t DEFAULT_SLICE = 1 << 16;
+
+private:
+	std::shared_ptr<PhysicalMemory> memory;
+	std::vector<std::unique_ptr<Processor>> harts;
+	uint32_t stackSize;
+	std::shared_ptr<CLINT> clint;
+	//set while the harts run to wake up a hart waiting in wfi,
+	//only changed while no hart is running
+	std::function<void(const uint32_t hartId)> wakeHart;
+
+	void SetSoftwareInterrupt(const uint32_t hartId, const bool pending);
+
+public:
+	SMPSystem(const uint32_t hartCount, const MemoryOptions& memoryOptions, const uint32_t stackSize = DEFAULT_STACK_SIZE);
+	//the interruptor calls back into the system
+	SMPSystem(const SMPSystem&) = delete;
+	SMPSystem& operator=(const SMPSystem&) = delete;
+
+	//clears ram and resets every hart to pc 0. Hart n starts with
+	//sp at the end of ram minus n stacks
+	void Load(const uint32_t* rawInstructions, const size_t instructionCount, const uint32_t decodeThreadCount = 1);
+	//same for a program placed like Processor::Load does, with
+	//the stack of hart 0 ending at stackTop instead of ram
+	void Load(std::shared_ptr<const std::vector<Instruction>> decodedInstructions, const uint32_t instructionBase, const uint32_t entry,
+		const uint32_t stackTop, const InstructionView code = { nullptr, 0 });
+	//runs the harts until every one of them has stopped, the limits
+	//apply to each hart. A hart in wfi sleeps until an interrupt is
+	//raised for it. Throws the first error of any hart after stopping
+	//the others
+	std::vector<RunStatus> Run(const RunLimits& limits);
+	//runs the harts one after the other on this thread, each for quantum
+	//instructions rounded up to the end of its basic block. The result
+	//only depends on the program and the quantum, so runs are repeatable.
+	//A smaller quantum interleaves the harts more finely but switches
+	//between them more often. Throws the first error of any hart
+	std::vector<RunStatus> RunRoundRobin(const RunLimits& limits, const uint64_t quantum = DEFAULT_QUANTUM);
+	//runs the harts as slices of a task on a work stealing pool of
+	//workerCount threads, 0 for one per core, so there can be many more
+	//harts than cores. A hart in wfi is left out of the queues until an
+	//interrupt is raised for it. Throws the first error of any hart
+	std::vector<RunStatus> RunOnWorkers(const RunLimits& limits, const uint32_t workerCount, const uint64_t slice = DEFAULT_SLICE);
+
+	uint32_t GetHartCount() const;
+	Processor& GetHart(const uint32_t hartId);
+	//summed over every hart
+	uint64_t GetInstructionsExecuted() const;
+	void ReadPhysicalMemory(const uint32_t address, uint8_t* buffer, const uint32_t size);
+};
@@ -0,0 +1,335 @@
+#include "ShardedBatch.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <cerrno>
+#include <stdexcept>
+#include <iostream>
+#include <iomanip>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <set>
+#include <chrono>
+#include <algorithm>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#ifndef _WIN32
+#include <dirent.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+#include <utime.h>
+#endif
+
+#ifdef _WIN32
+
+void InitShards(const std::string& source, const std::string& workDirectory)
+{
+	throw std::runtime_error("Sharded batches need a posix file system.");
+}
+
+uint32_t RunShardWorker(const std::string& workDirectory, const RunLimits& limits, const uint32_t leaseSeconds)
+{
+	throw std::runtime_error("Sharded batches need a posix file system.");
+}
+
+BatchSummary MergeShards(const std::string& workDirectory)
+{
+	throw std::runtime_error("Sharded batches need a posix file system.");
+}
+
+#else
+
+//how long a worker waits before looking at the leases of others again
+static const uint32_t POLL_MILLISECONDS = 100;
+
+static uint64_t MillisecondsSinceEpoch()
+{
+	return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+static void MakeDirectory(const std::string& path)
+{
+	if (mkdir(path.c_str(), 0777) != 0 && errno != EEXIST)
+	{
+		throw std::runtime_error("Failed to create directory " + path + ": " + std::strerror(errno));
+	}
+}
+
+static void WriteTextFile(const std::string& path, const std::string& text)
+{
+	std::ofstream file(path);
+	file << text;
+	if (!file)
+	{
+		throw std::runtime_error("Failed to write file: " + path);
+	}
+}
+
+static std::vector<std::string> ReadPrograms(const std::string& workDirectory)
+{
+	std::ifstream file(workDirectory + "/programs");
+	if (!file)
+	{
+		throw std::runtime_error("Not a sharded batch: " + workDirectory);
+	}
+	std::vector<std::string> programs;
+	std::string line;
+	while (std::getline(file, line))
+	{
+		programs.push_back(line);
+	}
+	return programs;
+}
+
+static std::vector<std::string> ListLeases(const std::string& workDirectory)
+{
+	std::vector<std::string> leases;
+	DIR* const dir = opendir((workDirectory + "/leases").c_str());
+	if (dir == nullptr)
+	{
+		throw std::runtime_error("Failed to open directory: " + workDirectory + "/leases");
+	}
+	while (const dirent* entry = readdir(dir))
+	{
+		if (entry->d_name[0] != '.')
+		{
+			leases.push_back(entry->d_name);
+		}
+	}
+	closedir(dir);
+	return leases;
+}
+
+static std::string WorkerId()
+{
+	char host[256] = { };
+	gethostname(host, sizeof(host) - 1);
+	return std::string(host) + "-" + std::to_string(getpid());
+}
+
+void InitShards(const std::string& source, const std::string& workDirectory)
+{
+	const std::vector<std::string> programs = FindBatchPrograms(source);
+	if (programs.empty())
+	{
+		throw std::runtime_error("No programs found in " + source);
+	}
+
+	MakeDirectory(workDirectory);
+	MakeDirectory(workDirectory + "/pending");
+	MakeDirectory(workDirectory + "/leases");
+	MakeDirectory(workDirectory + "/results");
+	std::string list;
+	for (const std::string& program : programs)
+	{
+		list += program + "\n";
+	}
+	WriteTextFile(workDirectory + "/started", std::to_string(MillisecondsSinceEpoch()) + "\n");
+	WriteTextFile(workDirectory + "/programs", list);
+	//the pending files come last so no worker can claim
+	//a program before the list of programs is there
+	for (size_t i = 0; i < programs.size(); i++)
+	{
+		WriteTextFile(workDirectory + "/pending/" + std::to_string(i), "");
+	}
+}
+
+//keeps a lease alive by touching it from another thread
+//while this one runs the program
+class LeaseKeeper
+{
+private:
+	std::string lease;
+	std::chrono::milliseconds interval;
+	std::mutex lock;
+	std::condition_variable stopped;
+	bool stopping = false;
+	std::thread thread;
+
+public:
+	LeaseKeeper(const std::string& lease, const uint32_t leaseSeconds) :
+		lease(lease),
+		interval(std::max<uint32_t>(1, leaseSeconds * 1000 / 4)),
+		thread([this]()
+		{
+			std::unique_lock<std::mutex> guard(this->lock);
+			while (!stopped.wait_for(guard, interval, [this]() { return stopping; }))
+			{
+				//fails once another worker has taken the lease
+				//over, this worker's result is still good though
+				utime(this->lease.c_str(), nullptr);
+			}
+		})
+	{
+	}
+
+	~LeaseKeeper()
+	{
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			stopping = true;
+		}
+		stopped.notify_all();
+		thread.join();
+	}
+};
+
+static void RunLeasedProgram(const std::string& workDirectory, const std::vector<std::string>& programs, const size_t index,
+	const std::string& lease, const std::string& workerId, const RunLimits& limits, const uint32_t leaseSeconds)
+{
+	BatchResult result;
+	{
+		LeaseKeeper keeper(lease, leaseSeconds);
+		result = RunBatchProgram(programs[index], limits);
+	}
+
+	std::ostringstream line;
+	line << BatchStatusName(result.status) << '\t' << result.instructionsExecuted << '\t' << std::fixed << std::setprecision(3) <<
+		result.milliseconds << '\t' << MillisecondsSinceEpoch() << '\t' << workerId << '\t' << result.message << '\n';
+	const std::string resultPath = workDirectory + "/results/" + std::to_string(index);
+	const std::string temporaryPath = resultPath + ".tmp." + workerId;
+	WriteTextFile(temporaryPath, line.str());
+	if (std::rename(temporaryPath.c_str(), resultPath.c_str()) != 0)
+	{
+		throw std::runtime_error("Failed to write result " + resultPath + ": " + std::strerror(errno));
+	}
+	std::remove(lease.c_str());
+}
+
+//renames an expired lease to this worker, returns the
+//index of its program or -1 when there is none
+static int64_t ReclaimExpiredLease(const std::string& workDirectory, const std::string& workerId, const uint32_t leaseSeconds,
+	std::string* newLease, bool* anyLeases)
+{
+	const std::vector<std::string> leases = ListLeases(workDirectory);
+	*anyLeases = !leases.empty();
+	const double now = MillisecondsSinceEpoch() / 1000.0;
+	for (const std::string& name : leases)
+	{
+		const std::string path = workDirectory + "/leases/" + name;
+		struct stat info;
+		if (stat(path.c_str(), &info) != 0 || now - (info.st_mtim.tv_sec + info.st_mtim.tv_nsec / 1e9) < leaseSeconds)
+		{
+			continue;
+		}
+		const std::string index = name.substr(0, name.find('.'));
+		*newLease = workDirectory + "/leases/" + index + "." + workerId;
+		//only one of the workers renaming it at the same time gets it
+		if (std::rename(path.c_str(), newLease->c_str()) == 0)
+		{
+			utime(newLease->c_str(), nullptr);
+			return std::stoll(index);
+		}
+	}
+	return -1;
+}
+
+uint32_t RunShardWorker(const std::string& workDirectory, const RunLimits& limits, const uint32_t leaseSeconds)
+{
+	const std::vector<std::string> programs = ReadPrograms(workDirectory);
+	const std::string workerId = WorkerId();
+	uint32_t ran = 0;
+
+	//every worker goes through the pending programs once, a failed
+	//rename means another worker claimed that program first
+	for (size_t i = 0; i < programs.size(); i++)
+	{
+		const std::string pending = workDirectory + "/pending/" + std::to_string(i);
+		const std::string lease = workDirectory + "/leases/" + std::to_string(i) + "." + workerId;
+		if (std::rename(pending.c_str(), lease.c_str()) == 0)
+		{
+			//the lease has the mtime of the pending file
+			utime(lease.c_str(), nullptr);
+			RunLeasedProgram(workDirectory, programs, i, lease, workerId, limits, leaseSeconds);
+			ran++;
+		}
+	}
+
+	//then it stays until no other worker holds a lease,
+	//taking over the ones that have run out
+	while (true)
+	{
+		std::string lease;
+		bool anyLeases;
+		const int64_t index = ReclaimExpiredLease(workDirectory, workerId, leaseSeconds, &lease, &anyLeases);
+		if (index >= 0 && static_cast<size_t>(index) < programs.size())
+		{
+			RunLeasedProgram(workDirectory, programs, static_cast<size_t>(index), lease, workerId, limits, leaseSeconds);
+			ran++;
+		}
+		else if (!anyLeases)
+		{
+			return ran;
+		}
+		else
+		{
+			std::this_thread::sleep_for(std::chrono::milliseconds(POLL_MILLISECONDS));
+		}
+	}
+}
+
+BatchSummary MergeShards(const std::string& workDirectory)
+{
+	const std::vector<std::string> programs = ReadPrograms(workDirectory);
+	BatchSummary summary;
+	std::set<std::string> workers;
+	uint64_t started = 0;
+	uint64_t finished = 0;
+	std::ifstream(workDirectory + "/started") >> started;
+
+	for (size_t i = 0; i < programs.size(); i++)
+	{
+		BatchResult result = { programs[i], BatchStatus::Error, 0, 0.0, "No result" };
+		std::ifstream file(workDirectory + "/results/" + std::to_string(i));
+		std::string line;
+		if (std::getline(file, line))
+		{
+			std::istringstream fields(line);
+			std::string status;
+			std::string worker;
+			uint64_t finishedAt = 0;
+			std::getline(fields, status, '\t');
+			fields >> result.instructionsExecuted >> result.milliseconds >> finishedAt;
+			fields.ignore(1);
+			std::getline(fields, worker, '\t');
+			std::getline(fields, result.message);
+			result.status = BatchStatus::Error;
+			for (const BatchStatus candidate : { BatchStatus::Passed, BatchStatus::Failed, BatchStatus::NoRegisterFile })
+			{
+				if (BatchStatusName(candidate) == status)
+				{
+					result.status = candidate;
+				}
+			}
+			workers.insert(worker);
+			finished = std::max(finished, finishedAt);
+		}
+		summary.results.push_back(result);
+	}
+
+	//the workers that ran a program stand in for the threads
+	summary.threadCount = static_cast<uint32_t>(workers.size());
+	summary.milliseconds = (finished > started) ? static_cast<double>(finished - started) : 0.0;
+	return summary;
+}
+
+#endif
+
+int RunShardMerge(const std::string& workDirectory, const std::string& summaryPath)
+{
+	const BatchSummary summary = MergeShards(workDirectory);
+	PrintBatchSummary(summary, std::cout);
+
+	std::ofstream summaryFile(summaryPath);
+	if (!summaryFile)
+	{
+		throw std::runtime_error("Failed to create file: " + summaryPath);
+	}
+	PrintBatchSummary(summary, summaryFile);
+
+	return BatchPassed(summary) ? 0 : -1;
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include "BatchRunner.h"
+#include "RISCV_Program.h"
+
+//A batch split between any number of worker processes, on one host or
+//many sharing a file system, which coordinate only through files in a
+//work directory:
+//  programs         every program of the batch, one per line
+//  pending/<n>      program n hasn't been claimed yet
+//  leases/<n>.<id>  worker id is running program n
+//  results/<n>      the result of program n
+//A worker claims a program by renaming its pending file into leases, which
+//only one worker can do, and keeps touching the lease while the program
+//runs. A lease that hasn't been touched for the lease timeout belongs to a
+//worker that died, and is claimed again by renaming it to another worker.
+//Results are written to a temporary file and renamed into place, so a
+//result is either complete or not there, and a program run twice after
+//its lease was taken over just writes the same result again.
+//Only available where there is a posix file system, elsewhere these throw.
+
+//seconds without the lease being touched before a program is run again
+const uint32_t DEFAULT_LEASE_SECONDS = 30;
+
+//creates the work directory for every program in source, a
+//directory or manifest like --batch takes
+void InitShards(const std::string& source, const std::string& workDirectory);
+//claims and runs programs until every program has a result, waiting
+//for the leases of other workers to either finish or run out.
+//Returns how many programs this worker ran
+uint32_t RunShardWorker(const std::string& workDirectory, const RunLimits& limits, const uint32_t leaseSeconds);
+//the results of every program in the order of the batch, a program
+//without a result is an error
+BatchSummary MergeShards(const std::string& workDirectory);
+
+//the --shard-merge command, writes the summary to stdout and summaryPath
+int RunShardMerge(const std::string& workDirectory, const std::string& summaryPath);
@@ -0,0 +1,457 @@
+#include "SimulationServer.h"
+#include <cstdint>
+#include <cstdlib>
+#include <cctype>
+#include <cstring>
+#include <cerrno>
+#include <cmath>
+#include <stdexcept>
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <algorithm>
+#include <future>
+#include <thread>
+#include "InstructionDecode.h"
+#include "Register.h"
+#ifndef _WIN32
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+LatencyHistogram::LatencyHistogram() : buckets(BUCKET_COUNT, 0)
+{
+}
+
+void LatencyHistogram::Add(const double microseconds)
+{
+	const double position = (microseconds > 1.0) ? std::log2(microseconds) * BUCKETS_PER_DOUBLING : 0.0;
+	const uint32_t bucket = std::min(static_cast<uint32_t>(position), BUCKET_COUNT - 1);
+	buckets[bucket]++;
+	count++;
+}
+
+double LatencyHistogram::Percentile(const double fraction) const
+{
+	if (count == 0)
+	{
+		return 0.0;
+	}
+	//the rank of the latency asked for, counting from 1
+	const uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(fraction * count)));
+	uint64_t seen = 0;
+	for (uint32_t i = 0; i < BUCKET_COUNT; i++)
+	{
+		seen += buckets[i];
+		if (seen >= rank)
+		{
+			return std::exp2(static_cast<double>(i + 1) / BUCKETS_PER_DOUBLING);
+		}
+	}
+	return std::exp2(static_cast<double>(BUCKET_COUNT) / BUCKETS_PER_DOUBLING);
+}
+
+uint64_t LatencyHistogram::GetCount() const
+{
+	return count;
+}
+
+SimulationServer::SimulationServer(const uint32_t threadCount, const RunLimits& limits, const size_t cacheSize) :
+	limits(limits),
+	cacheSize(std::max<size_t>(1, cacheSize)),
+	pool(threadCount)
+{
+}
+
+std::shared_ptr<const std::vector<Instruction>> SimulationServer::GetDecodedProgram(const std::vector<uint32_t>& program)
+{
+	const std::string key(reinterpret_cast<const char*>(program.data()), program.size() * sizeof(uint32_t));
+	{
+		std::lock_guard<std::mutex> guard(cacheLock);
+		const auto found = cache.find(key);
+		if (found != cache.end())
+		{
+			lru.splice(lru.begin(), lru, found->second.lruPosition);
+			std::lock_guard<std::mutex> statisticsGuard(statisticsLock);
+			statistics.cacheHits++;
+			return found->second.instructions;
+		}
+	}
+
+	//decoded outside the lock, two workers missing on the
+	//same program at once just decode it twice
+	std::shared_ptr<const std::vector<Instruction>> instructions = DecodeInstructions(program.data(), program.size());
+	std::lock_guard<std::mutex> guard(cacheLock);
+	{
+		std::lock_guard<std::mutex> statisticsGuard(statisticsLock);
+		statistics.cacheMisses++;
+	}
+	if (cache.find(key) == cache.end())
+	{
+		if (cache.size() >= cacheSize)
+		{
+			cache.erase(lru.back());
+			lru.pop_back();
+		}
+		lru.push_front(key);
+		cache[key] = { instructions, lru.begin() };
+	}
+	return instructions;
+}
+
+std::unique_ptr<Processor> SimulationServer::AcquireProcessor()
+{
+	{
+		std::lock_guard<std::mutex> guard(processorLock);
+		if (!idleProcessors.empty())
+		{
+			std::unique_ptr<Processor> processor = std::move(idleProcessors.back());
+			idleProcessors.pop_back();
+			return processor;
+		}
+	}
+	{
+		std::lock_guard<std::mutex> guard(statisticsLock);
+		statistics.processors++;
+	}
+	std::unique_ptr<Processor> processor = std::make_unique<Processor>();
+	processor->SetUseConsole(false);
+	return processor;
+}
+
+void SimulationServer::ReleaseProcessor(std::unique_ptr<Processor> processor)
+{
+	std::lock_guard<std::mutex> guard(processorLock);
+	idleProcessors.push_back(std::move(processor));
+}
+
+static uint32_t ParseWord(const std::string& text)
+{
+	char* end;
+	errno = 0;
+	const unsigned long long value = std::strtoull(text.c_str(), &end, 0);
+	if (text.empty() || *end != '\0' || errno != 0 || value > UINT32_MAX)
+	{
+		throw std::runtime_error("Not a 32 bit number: " + text);
+	}
+	return static_cast<uint32_t>(value);
+}
+
+//arguments is everything after run, parsed on the connection's thread
+//so a malformed request never takes up a worker
+std::string SimulationServer::RunProgram(const std::string& arguments)
+{
+	std::istringstream stream(arguments);
+	std::string words;
+	stream >> words;
+	std::vector<uint32_t> program;
+	std::istringstream wordStream(words);
+	std::string word;
+	while (std::getline(wordStream, word, ','))
+	{
+		program.push_back(ParseWord(word));
+	}
+	if (program.empty())
+	{
+		throw std::runtime_error("A run request needs at least one instruction.");
+	}
+
+	std::vector<std::pair<uint32_t, uint32_t>> initialRegisters;
+	std::string assignment;
+	while (stream >> assignment)
+	{
+		const size_t equals = assignment.find('=');
+		if (assignment.size() < 4 || assignment[0] != 'x' || equals == std::string::npos)
+		{
+			throw std::runtime_error("Not a register assignment: " + assignment);
+		}
+		const uint32_t index = ParseWord(assignment.substr(1, equals - 1));
+		if (index >= 32)
+		{
+			throw std::runtime_error("Not a register: " + assignment.substr(0, equals));
+		}
+		initialRegisters.emplace_back(index, ParseWord(assignment.substr(equals + 1)));
+	}
+
+	//the task holds on to the promise, the request may be gone as soon as it is kept
+	const auto response = std::make_shared<std::promise<std::string>>();
+	std::future<std::string> answer = response->get_future();
+	{
+		std::lock_guard<std::mutex> guard(statisticsLock);
+		statistics.queueDepth++;
+		statistics.maxQueueDepth = std::max(statistics.maxQueueDepth, statistics.queueDepth);
+	}
+	//SubmitBehind so every worker takes its requests oldest first
+	pool.SubmitBehind([this, &program, &initialRegisters, response]()
+	{
+		{
+			std::lock_guard<std::mutex> guard(statisticsLock);
+			statistics.queueDepth--;
+		}
+		std::unique_ptr<Processor> processor = AcquireProcessor();
+		std::string result;
+		std::exception_ptr error;
+		try
+		{
+			processor->Load(GetDecodedProgram(program));
+			for (const auto& initial : initialRegisters)
+			{
+				processor->SetRegister(initial.first, initial.second);
+			}
+			RunWithLimits(*processor, limits, "Program");
+
+			std::ostringstream registers;
+			registers << "ok " << processor->GetInstructionsExecuted() << std::hex << std::setfill('0');
+			for (uint32_t i = 0; i < 32; i++)
+			{
+				registers << " 0x" << std::setw(8) << processor->GetRegister(i);
+			}
+			result = registers.str();
+		}
+		catch (...)
+		{
+			error = std::current_exception();
+		}
+		ReleaseProcessor(std::move(processor));
+
+		if (error)
+		{
+			response->set_exception(error);
+		}
+		else
+		{
+			response->set_value(result);
+		}
+	});
+	return answer.get();
+}
+
+std::string SimulationServer::HandleRequest(const std::string& request)
+{
+	const auto start = std::chrono::steady_clock::now();
+	std::string command = request.substr(0, request.find(' '));
+	command.erase(std::find_if(command.rbegin(), command.rend(), [](char c) { return !std::isspace(static_cast<unsigned char>(c)); }).base(), command.end());
+
+	if (command == "stats")
+	{
+		const ServerStatistics current = GetStatistics();
+		std::ostringstream result;
+		result << std::fixed << std::setprecision(1);
+		result << "stats requests=" << current.requests << " errors=" << current.errors;
+		result << " queue_depth=" << current.queueDepth << " max_queue_depth=" << current.maxQueueDepth;
+		result << " p50_us=" << current.p50Microseconds << " p99_us=" << current.p99Microseconds;
+		result << " cache_hits=" << current.cacheHits << " cache_misses=" << current.cacheMisses;
+		result << " processors=" << current.processors;
+		return result.str();
+	}
+	if (command == "shutdown")
+	{
+		stopping.store(true);
+		return "ok";
+	}
+
+	std::string response;
+	bool failed = false;
+	try
+	{
+		if (command != "run")
+		{
+			throw std::runtime_error("Unknown request: " + command);
+		}
+		response = RunProgram(request.substr(command.size()));
+	}
+	catch (const std::exception& e)
+	{
+		const std::string message = e.what();
+		response = "error " + message.substr(0, message.find('\n'));
+		failed = true;
+	}
+
+	const double microseconds = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+	std::lock_guard<std::mutex> guard(statisticsLock);
+	statistics.requests++;
+	if (failed)
+	{
+		statistics.errors++;
+	}
+	latencies.Add(microseconds);
+	return response;
+}
+
+ServerStatistics SimulationServer::GetStatistics() const
+{
+	std::lock_guard<std::mutex> guard(statisticsLock);
+	ServerStatistics current = statistics;
+	current.p50Microseconds = latencies.Percentile(0.50);
+	current.p99Microseconds = latencies.Percentile(0.99);
+	return current;
+}
+
+bool SimulationServer::IsStopping() const
+{
+	return stopping.load();
+}
+
+#ifdef _WIN32
+
+void SimulationServer::CloseConnection(const int connection)
+{
+}
+
+void SimulationServer::ServeConnection(const int connection)
+{
+}
+
+void SimulationServer::Serve(const std::string& socketPath)
+{
+	throw std::runtime_error("The simulation server needs unix domain sockets, which windows doesn't have.");
+}
+
+#else
+
+//how often the listening thread checks for a shutdown request
+static const int STOP_CHECK_MILLISECONDS = 50;
+
+void SimulationServer::CloseConnection(const int connection)
+{
+	std::lock_guard<std::mutex> guard(connectionLock);
+	openConnections.erase(connection);
+	close(connection);
+}
+
+void SimulationServer::ServeConnection(const int connection)
+{
+	std::string buffered;
+	char buffer[4096];
+	while (true)
+	{
+		const size_t newline = buffered.find('\n');
+		if (newline != std::string::npos)
+		{
+			const std::string response = HandleRequest(buffered.substr(0, newline)) + "\n";
+			buffered.erase(0, newline + 1);
+			size_t sent = 0;
+			while (sent < response.size())
+			{
+				const ssize_t count = send(connection, response.data() + sent, response.size() - sent, MSG_NOSIGNAL);
+				if (count < 0 && errno == EINTR)
+				{
+					continue;
+				}
+				if (count <= 0)
+				{
+					CloseConnection(connection);
+					return;
+				}
+				sent += static_cast<size_t>(count);
+			}
+			continue;
+		}
+
+		const ssize_t count = recv(connection, buffer, sizeof(buffer), 0);
+		if (count < 0 && errno == EINTR)
+		{
+			continue;
+		}
+		if (count <= 0)
+		{
+			CloseConnection(connection);
+			return;
+		}
+		buffered.append(buffer, static_cast<size_t>(count));
+	}
+}
+
+void SimulationServer::Serve(const std::string& socketPath)
+{
+	sockaddr_un address = { };
+	address.sun_family = AF_UNIX;
+	if (socketPath.size() >= sizeof(address.sun_path))
+	{
+		throw std::runtime_error("Socket path is too long: " + socketPath);
+	}
+	std::strcpy(address.sun_path, socketPath.c_str());
+
+	const int listener = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (listener < 0)
+	{
+		throw std::runtime_error("Failed to create a socket: " + std::string(std::strerror(errno)));
+	}
+	unlink(socketPath.c_str());
+	if (bind(listener, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0 || listen(listener, SOMAXCONN) != 0)
+	{
+		const std::string error = std::strerror(errno);
+		close(listener);
+		throw std::runtime_error("Failed to listen on " + socketPath + ": " + error);
+	}
+
+	//a connection thread sets its flag just before it ends
+	//so it can be joined without waiting on it
+	std::vector<std::pair<std::thread, std::shared_ptr<std::atomic<bool>>>> connections;
+	while (!stopping.load())
+	{
+		connections.erase(std::remove_if(connections.begin(), connections.end(), [](auto& connection)
+		{
+			if (!connection.second->load())
+			{
+				return false;
+			}
+			connection.first.join();
+			return true;
+		}), connections.end());
+
+		pollfd waiting = { listener, POLLIN, 0 };
+		if (poll(&waiting, 1, STOP_CHECK_MILLISECONDS) <= 0)
+		{
+			continue;
+		}
+		const int connection = accept(listener, nullptr, nullptr);
+		if (connection >= 0)
+		{
+			{
+				std::lock_guard<std::mutex> guard(connectionLock);
+				openConnections.insert(connection);
+			}
+			const auto done = std::make_shared<std::atomic<bool>>(false);
+			connections.emplace_back(std::thread([this, connection, done]()
+			{
+				ServeConnection(connection);
+				done->store(true);
+			}), done);
+		}
+	}
+	close(listener);
+	unlink(socketPath.c_str());
+
+	//every connection gets the answer to the request it is
+	//waiting for, but no more requests are read from it
+	{
+		std::lock_guard<std::mutex> guard(connectionLock);
+		for (const int connection : openConnections)
+		{
+			shutdown(connection, SHUT_RD);
+		}
+	}
+	for (auto& connection : connections)
+	{
+		connection.first.join();
+	}
+}
+
+#endif
+
+int RunSimulationServer(const std::string& socketPath, const uint32_t threadCount, const RunLimits& limits)
+{
+	SimulationServer server(threadCount, limits);
+	std::cout << "Listening on " << socketPath << std::endl;
+	server.Serve(socketPath);
+	const ServerStatistics statistics = server.GetStatistics();
+	std::cout << "Served " << statistics.requests << " requests, p50 " << statistics.p50Microseconds << " us, p99 " <<
+		statistics.p99Microseconds << " us" << std::endl;
+	return 0;
+}
@@ -0,0 +1,129 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+#include "Instruction.h"
+#include "Processor.h"
+#include "WorkStealingPool.h"
+
+//Counts latencies in buckets that grow by 2^(1/8), so a percentile is
+//at most 9% above the real one no matter how far apart the latencies are
+class LatencyHistogram
+{
+public:
+	const static uint32_t BUCKETS_PER_DOUBLING = 8;
+	//up to 2^40 microseconds
+	const static uint32_t BUCKET_COUNT = 40 * BUCKETS_PER_DOUBLING;
+
+private:
+	std::vector<uint64_t> buckets;
+	uint64_t count = 0;
+
+public:
+	LatencyHistogram();
+	void Add(const double microseconds);
+	//upper bound of the bucket holding the given fraction of
+	//the latencies, 0 when nothing has been added
+	double Percentile(const double fraction) const;
+	uint64_t GetCount() const;
+};
+
+struct ServerStatistics
+{
+	//run requests, errors are counted in both
+	uint64_t requests;
+	uint64_t errors;
+	//programs waiting for a worker right now and the most there has been
+	uint64_t queueDepth;
+	uint64_t maxQueueDepth;
+	//from the request being read until its response is ready
+	double p50Microseconds;
+	double p99Microseconds;
+	uint64_t cacheHits;
+	uint64_t cacheMisses;
+	//processors that have been created, they are reused between programs
+	uint64_t processors;
+};
+
+//Runs programs sent by clients over a unix domain socket on a pool of
+//worker threads. A client sends one request per line and gets one line
+//back for each, in order:
+//  run <word>,<word>,... [x<n>=<value> ...]
+//    runs the instruction words from pc 0 with the given registers set
+//    after the stack pointer, answers ok <instructions executed> followed
+//    by x0 to x31 in hex, the same registers a .res file holds
+//  stats
+//    answers stats followed by name=value pairs of ServerStatistics
+//  shutdown
+//    answers ok and stops the server, every other connection gets
+//    the answer to the request it is waiting for and is then closed
+//Errors are answered with error and the first line of the message.
+//A worker takes an idle processor instead of creating one and programs
+//are looked up in a cache of decoded programs, so a program that has
+//been run before only costs resetting a processor before it runs.
+class SimulationServer
+{
+public:
+	//decoded programs kept before the least recently used is dropped
+	const static size_t DEFAULT_CACHE_SIZE = 1024;
+
+private:
+	struct CachedProgram
+	{
+		std::shared_ptr<const std::vector<Instruction>> instructions;
+		std::list<std::string>::iterator lruPosition;
+	};
+
+	RunLimits limits;
+	size_t cacheSize;
+
+	std::mutex cacheLock;
+	//keyed by the raw instruction words, most recently used first
+	std::unordered_map<std::string, CachedProgram> cache;
+	std::list<std::string> lru;
+
+	std::mutex processorLock;
+	std::vector<std::unique_ptr<Processor>> idleProcessors;
+
+	mutable std::mutex statisticsLock;
+	LatencyHistogram latencies;
+	ServerStatistics statistics = { };
+
+	std::atomic<bool> stopping{ false };
+	std::mutex connectionLock;
+	std::unordered_set<int> openConnections;
+	//destroyed first so no worker outlives what it uses
+	WorkStealingPool pool;
+
+	std::shared_ptr<const std::vector<Instruction>> GetDecodedProgram(const std::vector<uint32_t>& program);
+	std::unique_ptr<Processor> AcquireProcessor();
+	void ReleaseProcessor(std::unique_ptr<Processor> processor);
+	std::string RunProgram(const std::string& arguments);
+	void ServeConnection(const int connection);
+	void CloseConnection(const int connection);
+
+public:
+	SimulationServer(const uint32_t threadCount, const RunLimits& limits, const size_t cacheSize = DEFAULT_CACHE_SIZE);
+	SimulationServer(const SimulationServer&) = delete;
+	SimulationServer& operator=(const SimulationServer&) = delete;
+
+	//answers one request line, a run request waits in the queue for
+	//a worker. Can be called from any number of threads at once
+	std::string HandleRequest(const std::string& request);
+	ServerStatistics GetStatistics() const;
+	bool IsStopping() const;
+	//listens on socketPath, replacing a socket file left there, and
+	//serves every connection on its own thread until a shutdown request.
+	//Only available where there are unix domain sockets
+	void Serve(const std::string& socketPath);
+};
+
+//the --serve command
+int RunSimulationServer(const std::string& socketPath, const uint32_t threadCount, const RunLimits& limits);
@@ -1,29 +1,31 @@
-#include <mutex> 
 #include <cstdint>
 #include "TSrandom.h"
 
 namespace FRandom {
-	static std::mutex initRandomLock;
-
-	static uint64_t init_x = 236432356;
-	static uint64_t init_y = 395824682;
-	static uint64_t init_z = 443425897;
+	//splitmix64, every output is a bijection of the
+	//counter so close seeds give unrelated states
+	static uint64_t MixSeed(uint64_t* counter)
+	{
+		uint64_t z = (*counter += 0x9e37'79b9'7f4a'7c15);
+		z = (z ^ (z >> 30)) * 0xbf58'476d'1ce4'e5b9;
+		z = (z ^ (z >> 27)) * 0x94d0'49bb'1331'11eb;
+		return z ^ (z >> 31);
+	}
 
-	TCRandom GetTCRandom()
+	TCRandom SeedTCRandom(const uint64_t seed, const uint64_t stream)
 	{
-		initRandomLock.lock();
-		const TCRandom newRandom =
+		uint64_t counter = seed;
+		counter = MixSeed(&counter) ^ stream;
+
+		TCRandom newRandom;
+		newRandom.x = MixSeed(&counter);
+		newRandom.y = MixSeed(&counter);
+		newRandom.z = MixSeed(&counter);
+		//xorshift never leaves the all zero state
+		if ((newRandom.x | newRandom.y | newRandom.z) == 0)
 		{
-			init_x,
-			init_y,
-			init_z
-		};
-
-		init_x++;
-		init_y++;
-		init_z++;
-		initRandomLock.unlock();
-
+			newRandom.x = 1;
+		}
 		return newRandom;
 	}
 
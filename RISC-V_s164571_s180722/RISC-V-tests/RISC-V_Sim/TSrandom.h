@@ -11,7 +11,10 @@ namespace FRandom {
 		uint64_t z;
 	};
 
-	TCRandom GetTCRandom();
+	//the generator for one stream of a seed. Streams share no state and
+	//don't overlap in practice, so giving test n stream n makes its
+	//numbers the same no matter which thread creates it or when
+	TCRandom SeedTCRandom(const uint64_t seed, const uint64_t stream);
 	int32_t RandomRange(TCRandom& random, const int32_t min, const int32_t max);
 	bool RandomBool(TCRandom& random);
-}
\ No newline at end of file
+}
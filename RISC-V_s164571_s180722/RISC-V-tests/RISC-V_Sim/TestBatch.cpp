@@ -0,0 +1,131 @@
+#include "TestBatch.h"
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "RISCV_Program.h"
+#include "BatchRunner.h"
+
+static const std::string MANIFEST_FILE = "test_batch_manifest.tmp";
+static const std::string WRONG_PROGRAM = "test_batch_wrong";
+static const std::string UNCHECKED_PROGRAM = "test_batch_unchecked";
+static const std::string ENDLESS_PROGRAM = "test_batch_endless";
+static const RunLimits NO_LIMITS = { UINT64_MAX, 0.0 };
+
+static void Success(const std::string& testName)
+{
+	std::cout << "Test Success: " << testName << std::endl;
+}
+
+static void ExpectResult(const BatchResult& result, const BatchStatus status, const uint64_t instructionsExecuted)
+{
+	if (result.status != status || result.instructionsExecuted != instructionsExecuted)
+	{
+		throw std::runtime_error("Incorrect batch result for " + result.program +
+			".\nInstructions executed: " + std::to_string(result.instructionsExecuted) + "\nMessage: " + result.message + "\n");
+	}
+}
+
+static void RemoveTestFiles()
+{
+	std::remove(MANIFEST_FILE.c_str());
+	for (const char* extension : { ".bin", ".res", ".s" })
+	{
+		std::remove((WRONG_PROGRAM + extension).c_str());
+		std::remove((UNCHECKED_PROGRAM + extension).c_str());
+		std::remove((ENDLESS_PROGRAM + extension).c_str());
+	}
+}
+
+static void Test_BatchDirectory()
+{
+	const std::vector<std::string> programs = FindBatchPrograms("tests/task1");
+	const std::vector<std::string> expected = { "tests/task1/addlarge", "tests/task1/addneg", "tests/task1/addpos", "tests/task1/shift" };
+	if (programs != expected)
+	{
+		throw std::runtime_error("Didn't find the programs in tests/task1.\n");
+	}
+
+	const BatchSummary summary = RunBatchPrograms(programs, 2, NO_LIMITS);
+	for (const BatchResult& result : summary.results)
+	{
+		if (result.status != BatchStatus::Passed || result.instructionsExecuted == 0)
+		{
+			throw std::runtime_error("Incorrect batch result for " + result.program + ".\nMessage: " + result.message + "\n");
+		}
+	}
+
+	Success("test_batch_directory");
+}
+
+//one of each kind of result, every program has to be run
+//even though the ones before it failed
+static void Test_BatchManifest()
+{
+	RemoveTestFiles();
+
+	RISCV_Program wrong(WRONG_PROGRAM);
+	wrong.AddInstruction(Create_addi(Regs::a1, Regs::x0, 5));
+	wrong.EndProgram();
+	wrong.ExpectRegisterValue(Regs::a1, 6);
+	wrong.Save(WRONG_PROGRAM);
+
+	RISCV_Program unchecked(UNCHECKED_PROGRAM);
+	unchecked.AddInstruction(Create_addi(Regs::a1, Regs::x0, 5));
+	unchecked.EndProgram();
+	unchecked.Save(UNCHECKED_PROGRAM);
+	std::remove((UNCHECKED_PROGRAM + ".res").c_str());
+
+	RISCV_Program endless(ENDLESS_PROGRAM);
+	endless.AddInstruction(Create_jal(Regs::x0, 0));
+	endless.Save(ENDLESS_PROGRAM);
+
+	std::ofstream manifest(MANIFEST_FILE);
+	manifest << "# comments and empty lines are skipped" << std::endl;
+	manifest << WRONG_PROGRAM << ".bin" << std::endl;
+	manifest << std::endl;
+	manifest << "test_batch_missing" << std::endl;
+	manifest << UNCHECKED_PROGRAM << std::endl;
+	manifest << ENDLESS_PROGRAM << std::endl;
+	manifest.close();
+
+	const std::vector<std::string> programs = FindBatchPrograms(MANIFEST_FILE);
+	//the endless program has to be stopped by the limit
+	const BatchSummary summary = RunBatchPrograms(programs, 3, { 1 << 16, 10.0 });
+	RemoveTestFiles();
+
+	if (summary.results.size() != 4 || BatchPassed(summary))
+	{
+		throw std::runtime_error("Batch manifest didn't give 4 results.\n");
+	}
+	//addi, li a0 10 and ecall
+	ExpectResult(summary.results[0], BatchStatus::Failed, 3);
+	ExpectResult(summary.results[1], BatchStatus::Error, 0);
+	ExpectResult(summary.results[2], BatchStatus::NoRegisterFile, 3);
+	ExpectResult(summary.results[3], BatchStatus::Error, 0);
+
+	Success("test_batch_manifest");
+}
+
+void TestBatch()
+{
+	try
+	{
+		Test_BatchDirectory();
+		Test_BatchManifest();
+	}
+	catch (std::runtime_error& e)
+	{
+		RemoveTestFiles();
+		std::cout << "Failed to finish all batch tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all batch tests\n" << std::endl;
+}
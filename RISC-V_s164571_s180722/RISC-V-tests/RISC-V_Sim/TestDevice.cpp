@@ -0,0 +1,53 @@
+#include "TestDevice.h"
+#include <cstdint>
+
+static uint32_t SizeMask(const uint32_t size)
+{
+	return (size == 4) ? 0xff'ff'ff'ff : ((1u << (size * 8)) - 1);
+}
+
+uint32_t TestDevice::Read(const uint32_t offset, const uint32_t size)
+{
+	accessCount++;
+
+	uint32_t value;
+	switch (offset & ~3)
+	{
+		case 0x0:
+			value = DEVICE_ID;
+			break;
+		case 0x4:
+			value = scratch;
+			break;
+		case 0x8:
+			value = accessCount;
+			break;
+		default:
+			value = 0;
+			break;
+	}
+	//smaller accesses reads the part of the register they point at
+	return (value >> ((offset & 3) * 8)) & SizeMask(size);
+}
+
+void TestDevice::Write(const uint32_t offset, const uint32_t size, const uint32_t value)
+{
+	accessCount++;
+
+	if ((offset & ~3) == 0x4)
+	{
+		const uint32_t shift = (offset & 3) * 8;
+		const uint32_t mask = SizeMask(size) << shift;
+		scratch = (scratch & ~mask) | ((value << shift) & mask);
+	}
+}
+
+uint32_t TestDevice::GetScratch() const
+{
+	return scratch;
+}
+
+uint32_t TestDevice::GetAccessCount() const
+{
+	return accessCount;
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+#include "Device.h"
+
+//Device used by the tests to check that accesses reach
+//the right device with the right offset and size.
+//0x0 read only id, 0x4 scratch register, 0x8 access count
+class TestDevice : public Device
+{
+private:
+	uint32_t scratch = 0;
+	uint32_t accessCount = 0;
+
+public:
+	const static uint32_t DEVICE_ID = 0x7e'57'de'71;
+	const static uint32_t SIZE = 0x10'00;
+
+	uint32_t Read(const uint32_t offset, const uint32_t size) override;
+	void Write(const uint32_t offset, const uint32_t size, const uint32_t value) override;
+
+	uint32_t GetScratch() const;
+	uint32_t GetAccessCount() const;
+};
@@ -0,0 +1,136 @@
+#include "TestDevices.h"
+#include <cstdint>
+#include <stdexcept>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <memory>
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "RISCV_Program.h"
+#include "UART.h"
+#include "TestDevice.h"
+
+static const uint32_t TEST_DEVICE_BASE = 0x20'00'00'00;
+static const uint32_t UNMAPPED_ADDRESS = 0x30'00'00'00;
+
+static void Success(const std::string& testName)
+{
+	std::cout << "Test Success: " << testName << std::endl;
+}
+
+static void Test_UART()
+{
+	RISCV_Program program("Test_UART");
+	std::ostringstream output;
+	const std::shared_ptr<UART> uart = std::make_shared<UART>(&output);
+	uart->AddInput("A");
+	program.AttachDevice(UART::DEFAULT_BASE, UART::SIZE, uart);
+
+	program.AddInstruction(Create_lui(Regs::t0, UART::DEFAULT_BASE >> 12));
+	program.ExpectRegisterValue(Regs::t0, UART::DEFAULT_BASE);
+	const std::string text = "Hi\n";
+	for (const char c : text)
+	{
+		program.SetRegister(Regs::t1, static_cast<uint32_t>(c));
+		program.AddInstruction(Create_sb(Regs::t0, Regs::t1, 0));
+	}
+
+	//line status, then the received byte and line status again
+	program.AddInstruction(Create_lbu(Regs::a1, Regs::t0, 5));
+	program.AddInstruction(Create_lbu(Regs::a2, Regs::t0, 0));
+	program.AddInstruction(Create_lbu(Regs::a3, Regs::t0, 5));
+	program.ExpectRegisterValue(Regs::a1, 0x61);
+	program.ExpectRegisterValue(Regs::a2, 'A');
+	program.ExpectRegisterValue(Regs::a3, 0x60);
+	program.EndProgram();
+
+	program.Test();
+
+	if (output.str() != text)
+	{
+		throw std::runtime_error("UART output was wrong.\nExpected: " + text + "Actual: " + output.str());
+	}
+
+	Success("test_uart");
+}
+
+static void Test_TestDevice()
+{
+	RISCV_Program program("Test_TestDevice");
+	const std::shared_ptr<TestDevice> device = std::make_shared<TestDevice>();
+	program.AttachDevice(TEST_DEVICE_BASE, TestDevice::SIZE, device);
+
+	program.AddInstruction(Create_lui(Regs::t0, TEST_DEVICE_BASE >> 12));
+	program.ExpectRegisterValue(Regs::t0, TEST_DEVICE_BASE);
+	program.SetRegister(Regs::t1, 0x12'34'56'78);
+
+	program.AddInstruction(Create_lw(Regs::a1, Regs::t0, 0));
+	program.AddInstruction(Create_sw(Regs::t0, Regs::t1, 4));
+	program.AddInstruction(Create_lw(Regs::a2, Regs::t0, 4));
+	program.AddInstruction(Create_lbu(Regs::a3, Regs::t0, 5));
+	program.AddInstruction(Create_lw(Regs::a4, Regs::t0, 8));
+	//ram next to the device still works as normal
+	program.SetRegister(Regs::t2, 0x100);
+	program.AddInstruction(Create_sw(Regs::t2, Regs::t1, 0));
+	program.AddInstruction(Create_lw(Regs::a5, Regs::t2, 0));
+	program.ExpectRegisterValue(Regs::a1, TestDevice::DEVICE_ID);
+	program.ExpectRegisterValue(Regs::a2, 0x12'34'56'78);
+	program.ExpectRegisterValue(Regs::a3, 0x56);
+	program.ExpectRegisterValue(Regs::a4, 5);
+	program.ExpectRegisterValue(Regs::a5, 0x12'34'56'78);
+	program.EndProgram();
+
+	program.Test();
+
+	if (device->GetScratch() != 0x12'34'56'78 || device->GetAccessCount() != 5)
+	{
+		throw std::runtime_error("Test device saw the wrong accesses.\nScratch: " + std::to_string(device->GetScratch()) +
+			"\nAccesses: " + std::to_string(device->GetAccessCount()) + "\n");
+	}
+
+	Success("test_test_device");
+}
+
+static void Test_UnmappedAccess()
+{
+	RISCV_Program program("Test_UnmappedAccess");
+
+	program.AddInstruction(Create_lui(Regs::t0, UNMAPPED_ADDRESS >> 12));
+	program.AddInstruction(Create_lw(Regs::a1, Regs::t0, 0));
+	program.EndProgram();
+
+	try
+	{
+		program.Run();
+	}
+	catch (const std::runtime_error& e)
+	{
+		if (std::string(e.what()).find(std::to_string(UNMAPPED_ADDRESS)) == std::string::npos)
+		{
+			throw std::runtime_error("Unmapped access reported the wrong address.\n" + std::string(e.what()));
+		}
+		Success("test_unmapped_access");
+		return;
+	}
+
+	throw std::runtime_error("Access to unmapped memory didn't fail.");
+}
+
+void TestDevices()
+{
+	try
+	{
+		Test_UART();
+		Test_TestDevice();
+		Test_UnmappedAccess();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all device tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all device tests\n" << std::endl;
+}
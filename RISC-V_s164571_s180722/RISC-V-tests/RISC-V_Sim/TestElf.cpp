@@ -0,0 +1,315 @@
+#include "TestElf.h"
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "RISCV_Program.h"
+#include "ReadProgram.h"
+#include "ElfImage.h"
+
+static const std::string ELF_FILE = "test_elf_program";
+
+static void Success(const std::string& testName)
+{
+	std::cout << "Test Success: " << testName << std::endl;
+}
+
+static const uint32_t CODE_ADDRESS = 0x1'00'00;
+static const uint32_t ENTRY = CODE_ADDRESS + 0x100;
+static const uint32_t DATA_ADDRESS = 0x1'10'00;
+static const uint32_t GLOBAL_POINTER = DATA_ADDRESS + 0x800;
+static const uint32_t CONSTANTS_ADDRESS = 0x40'00'00;
+static const uint32_t STACK_TOP = 0x3'00'00;
+static const uint32_t CONSTANT = 0xca'fe'f0'0d;
+//not an instruction, so the code segment has to be decoded leniently
+static const uint32_t LITERAL = 0x0b'ad'f0'0d;
+
+static void Put16(std::vector<uint8_t>& file, const size_t offset, const uint32_t value)
+{
+	file[offset + 0] = static_cast<uint8_t>(value >> 0);
+	file[offset + 1] = static_cast<uint8_t>(value >> 8);
+}
+
+static void Put32(std::vector<uint8_t>& file, const size_t offset, const uint32_t value)
+{
+	for (uint32_t i = 0; i < 4; i++)
+	{
+		file[offset + i] = static_cast<uint8_t>(value >> (8 * i));
+	}
+}
+
+//loads from the data segment, its .bss, the mapped constants and a literal after the code
+static std::vector<uint32_t> ElfCode()
+{
+	std::vector<uint32_t> code =
+	{
+		Create_lw(Regs::s2, Regs::gp, static_cast<uint32_t>(-0x800)),
+		Create_lw(Regs::s3, Regs::gp, static_cast<uint32_t>(-0x7fc)),
+		Create_lw(Regs::s4, Regs::gp, static_cast<uint32_t>(-0x700)),
+		Create_sw(Regs::gp, Regs::s2, static_cast<uint32_t>(-0x6fc)),
+		Create_lw(Regs::s5, Regs::gp, static_cast<uint32_t>(-0x6fc)),
+		Create_lui(Regs::t0, CONSTANTS_ADDRESS >> 12),
+		Create_lw(Regs::s6, Regs::t0, 0),
+		Create_auipc(Regs::t1, 0),
+		Create_lw(Regs::s7, Regs::t1, 7 * 4),
+		Create_addi(Regs::s8, Regs::sp, 0),
+		Create_addi(Regs::s9, Regs::gp, 0),
+		Create_addi(Regs::a0, Regs::x0, 10),
+		Create_ecall(),
+		Create_fence(),
+		LITERAL
+	};
+	return code;
+}
+
+//a static executable like the gnu linker makes: the headers are
+//in the code segment, data is followed by .bss and read only
+//constants are page aligned far above everything else
+static std::vector<uint8_t> BuildElf(const bool withStackSymbol, const uint16_t machine)
+{
+	const std::vector<uint32_t> code = ElfCode();
+	std::vector<uint8_t> file(0x3900, 0);
+
+	//header
+	file[0] = 0x7f;
+	file[1] = 'E';
+	file[2] = 'L';
+	file[3] = 'F';
+	file[4] = 1;
+	file[5] = 1;
+	file[6] = 1;
+	Put16(file, 16, 2);
+	Put16(file, 18, machine);
+	Put32(file, 20, 1);
+	Put32(file, 24, ENTRY);
+	Put32(file, 28, 52);
+	Put32(file, 32, 0x3800);
+	Put16(file, 40, 52);
+	Put16(file, 42, 32);
+	Put16(file, 44, 3);
+	Put16(file, 46, 40);
+	Put16(file, 48, 3);
+
+	//segments of type, offset, address, file size, memory size and flags
+	const uint32_t codeSize = 0x100 + static_cast<uint32_t>(code.size()) * 4;
+	const uint32_t segments[3][6] =
+	{
+		{ 1, 0x0000, CODE_ADDRESS, codeSize, codeSize, 5 },
+		{ 1, 0x1000, DATA_ADDRESS, 8, 0x2000, 6 },
+		{ 1, 0x2000, CONSTANTS_ADDRESS, 0x1000, 0x1000, 4 }
+	};
+	for (uint32_t i = 0; i < 3; i++)
+	{
+		const size_t header = 52 + i * 32;
+		Put32(file, header + 0, segments[i][0]);
+		Put32(file, header + 4, segments[i][1]);
+		Put32(file, header + 8, segments[i][2]);
+		Put32(file, header + 12, segments[i][2]);
+		Put32(file, header + 16, segments[i][3]);
+		Put32(file, header + 20, segments[i][4]);
+		Put32(file, header + 24, segments[i][5]);
+		Put32(file, header + 28, 0x1000);
+	}
+	for (size_t i = 0; i < code.size(); i++)
+	{
+		Put32(file, 0x100 + i * 4, code[i]);
+	}
+	Put32(file, 0x1000, 0x11'22'33'44);
+	Put32(file, 0x1004, 0x55'66'77'88);
+	Put32(file, 0x2000, CONSTANT);
+
+	//symbols of name, value, size, info and section
+	const char namesText[] = "\0_start\0data_word\0bss_word\0__global_pointer$\0__stack_top";
+	const std::string names(namesText, sizeof(namesText));
+	std::copy(names.begin(), names.end(), file.begin() + 0x3400);
+	const uint32_t symbols[5][5] =
+	{
+		{ 1, ENTRY, static_cast<uint32_t>(code.size()) * 4, 0x12, 1 },
+		{ 8, DATA_ADDRESS, 8, 0x11, 2 },
+		{ 18, DATA_ADDRESS + 0x100, 4, 0x11, 2 },
+		{ 27, GLOBAL_POINTER, 0, 0x10, 0xfff1 },
+		{ 45, STACK_TOP, 0, 0x10, 0xfff1 }
+	};
+	const uint32_t symbolCount = withStackSymbol ? 5 : 4;
+	for (uint32_t i = 0; i < symbolCount; i++)
+	{
+		//the first symbol is the null symbol
+		const size_t symbol = 0x3000 + (i + 1) * 16;
+		Put32(file, symbol + 0, symbols[i][0]);
+		Put32(file, symbol + 4, symbols[i][1]);
+		Put32(file, symbol + 8, symbols[i][2]);
+		file[symbol + 12] = static_cast<uint8_t>(symbols[i][3]);
+		Put16(file, symbol + 14, symbols[i][4]);
+	}
+
+	//sections, the first is the null section
+	Put32(file, 0x3800 + 40 + 4, 2);
+	Put32(file, 0x3800 + 40 + 16, 0x3000);
+	Put32(file, 0x3800 + 40 + 20, (symbolCount + 1) * 16);
+	Put32(file, 0x3800 + 40 + 24, 2);
+	//every symbol is global
+	Put32(file, 0x3800 + 40 + 28, 1);
+	Put32(file, 0x3800 + 40 + 36, 16);
+	Put32(file, 0x3800 + 80 + 4, 3);
+	Put32(file, 0x3800 + 80 + 16, 0x3400);
+	Put32(file, 0x3800 + 80 + 20, static_cast<uint32_t>(names.size()));
+
+	return file;
+}
+
+static void WriteElf(const std::string& path, const std::vector<uint8_t>& file)
+{
+	std::ofstream stream(path, std::ios::binary);
+	stream.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+	if (!stream)
+	{
+		throw std::runtime_error("Failed to create file: " + path + "\n");
+	}
+}
+
+static void ExpectRegister(const uint32_t* registers, const Regs reg, const uint32_t expected, const std::string& what)
+{
+	const uint32_t actual = registers[static_cast<uint32_t>(reg)];
+	if (actual != expected)
+	{
+		throw std::runtime_error(what + " was " + std::to_string(actual) + " instead of " + std::to_string(expected) + ".\n");
+	}
+}
+
+static void ExpectLoaded(RISCV_Program& program, const uint32_t stackPointer)
+{
+	program.Run();
+	const uint32_t* registers = program.GetProgramResult();
+	ExpectRegister(registers, Regs::s2, 0x11'22'33'44, "The first data word");
+	ExpectRegister(registers, Regs::s3, 0x55'66'77'88, "The second data word");
+	ExpectRegister(registers, Regs::s4, 0, "A .bss word");
+	ExpectRegister(registers, Regs::s5, 0x11'22'33'44, "A word stored in .bss");
+	ExpectRegister(registers, Regs::s6, CONSTANT, "The mapped constant");
+	ExpectRegister(registers, Regs::s7, LITERAL, "The literal after the code");
+	ExpectRegister(registers, Regs::s8, stackPointer, "sp");
+	ExpectRegister(registers, Regs::s9, GLOBAL_POINTER, "gp");
+}
+
+//segments are placed where the file says, the program starts at
+//the entry point and sp and gp come from the symbols
+static void Test_ElfSegments()
+{
+	WriteElf(ELF_FILE, BuildElf(true, 243));
+	bool foundRegisterFile;
+	const std::unique_ptr<RISCV_Program> program = LoadProgram(ELF_FILE, &foundRegisterFile);
+	const ElfImage* elf = program->GetElf();
+	if (elf == nullptr || foundRegisterFile)
+	{
+		throw std::runtime_error("The ELF file wasn't loaded as one.\n");
+	}
+	if (elf->GetEntry() != ENTRY || elf->GetInstructionBase() != CODE_ADDRESS || elf->GetSegments().size() != 3 ||
+		program->GetInstructionCount() != 0x40 + ElfCode().size())
+	{
+		throw std::runtime_error("The ELF file wasn't read correctly.\n");
+	}
+#ifndef _WIN32
+	//the data, stack and code are in ram and the constants are mapped above it
+	if (elf->GetRAMSize(Processor::DefaultMemoryOptions().ramSize) != 0x2'30'00)
+	{
+		throw std::runtime_error("Ram doesn't hold the segments and a stack.\nRam size: " +
+			std::to_string(elf->GetRAMSize(Processor::DefaultMemoryOptions().ramSize)) + "\n");
+	}
+#endif
+	ExpectLoaded(*program, STACK_TOP);
+	//a second run starts from a cleared .bss
+	ExpectLoaded(*program, STACK_TOP);
+	program->SetHartCount(2);
+	program->SetQuantum(3);
+	ExpectLoaded(*program, STACK_TOP);
+
+	bool caught = false;
+	try
+	{
+		program->AddInstruction(Create_ecall());
+	}
+	catch (const std::runtime_error&)
+	{
+		caught = true;
+	}
+	if (!caught)
+	{
+		throw std::runtime_error("An instruction was added to an ELF program.\n");
+	}
+
+	Success("test_elf_segments");
+}
+
+//without a stack symbol sp is the default or the end of ram
+static void Test_ElfDefaults()
+{
+	std::remove(ELF_FILE.c_str());
+	WriteElf(ELF_FILE + ".bin", BuildElf(false, 243));
+	bool foundRegisterFile;
+	const std::unique_ptr<RISCV_Program> program = LoadProgram(ELF_FILE, &foundRegisterFile);
+	ExpectLoaded(*program, 0x2'30'00);
+	program->SetElfDefaults({ 0x2'00'00, 0 });
+	ExpectLoaded(*program, 0x2'00'00);
+	std::remove((ELF_FILE + ".bin").c_str());
+
+	Success("test_elf_defaults");
+}
+
+static void Test_ElfSymbols()
+{
+	WriteElf(ELF_FILE, BuildElf(true, 243));
+	const ElfImage elf(ELF_FILE);
+	const ElfSymbol* data = elf.FindSymbol("data_word");
+	const ElfSymbol* start = elf.FindFunction(ENTRY + 8);
+	if (elf.GetSymbols().size() != 5 || data == nullptr || data->address != DATA_ADDRESS || data->isFunction ||
+		start == nullptr || start->name != "_start" || elf.FindFunction(DATA_ADDRESS) != nullptr ||
+		elf.FindFunction(CODE_ADDRESS) != nullptr || elf.FindSymbol("main") != nullptr)
+	{
+		throw std::runtime_error("The symbols weren't kept.\n");
+	}
+
+	//only riscv executables can be run
+	WriteElf(ELF_FILE + ".bin", BuildElf(true, 62));
+	bool caught = false;
+	try
+	{
+		ElfImage wrongMachine(ELF_FILE + ".bin");
+	}
+	catch (const std::runtime_error& e)
+	{
+		caught = std::string(e.what()).find("RISC-V") != std::string::npos;
+	}
+	std::remove((ELF_FILE + ".bin").c_str());
+	if (!caught)
+	{
+		throw std::runtime_error("An x86 ELF file was loaded.\n");
+	}
+
+	Success("test_elf_symbols");
+}
+
+void TestElf()
+{
+	try
+	{
+		Test_ElfSegments();
+		Test_ElfDefaults();
+		Test_ElfSymbols();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::remove(ELF_FILE.c_str());
+		std::remove((ELF_FILE + ".bin").c_str());
+		std::cout << "Failed to finish all elf tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+	std::remove(ELF_FILE.c_str());
+
+	std::cout << "Successfully finished all elf tests\n" << std::endl;
+}
@@ -3,9 +3,14 @@
 #include <stdexcept>
 #include <iostream>
 #include <string>
+#include <vector>
+#include <algorithm>
 #include "InstructionDecode.h"
 #include "InstructionEncode.h"
+#include "ReferenceDecode.h"
+#include "DecodeSweep.h"
 #include "Register.h"
+#include "TSrandom.h"
 
 static void TestEncodeDecodeInstruction(const uint32_t encoded, const std::string& expectedDecoded)
 {
@@ -55,11 +60,12 @@ static void Test_lhu()
 }
 static void Test_fence()
 {
-
+	TestEncodeDecodeInstruction(Create_fence(), "fence x0 x0 255");
+	TestEncodeDecodeInstruction(0x0330000f, "fence x0 x0 51");
 }
 static void Test_fence_i()
 {
-
+	TestEncodeDecodeInstruction(Create_fence_i(), "fence_i x0 x0 0");
 }
 static void Test_addi()
 {
@@ -263,27 +269,60 @@ static void Test_ebreak()
 }
 static void Test_csrrw()
 {
-
+	TestEncodeDecodeInstruction(Create_csrrw(Regs::a0, Regs::a1, 0x300), "csrrw a0 768 a1");
+	TestEncodeDecodeInstruction(Create_csrrw(Regs::x0, Regs::t3, 0x180), "csrrw x0 384 t3");
+	TestEncodeDecodeInstruction(Create_csrrw(Regs::s1, Regs::x0, 0xF14), "csrrw s1 3860 x0");
 }
 static void Test_csrrs()
 {
-
+	TestEncodeDecodeInstruction(Create_csrrs(Regs::a0, Regs::a1, 0x300), "csrrs a0 768 a1");
+	TestEncodeDecodeInstruction(Create_csrrs(Regs::t1, Regs::x0, 0x342), "csrrs t1 834 x0");
+	TestEncodeDecodeInstruction(Create_csrrs(Regs::s1, Regs::s7, 0xF14), "csrrs s1 3860 s7");
 }
 static void Test_csrrc()
 {
-
+	TestEncodeDecodeInstruction(Create_csrrc(Regs::a0, Regs::a1, 0x300), "csrrc a0 768 a1");
+	TestEncodeDecodeInstruction(Create_csrrc(Regs::t1, Regs::x0, 0x342), "csrrc t1 834 x0");
+	TestEncodeDecodeInstruction(Create_csrrc(Regs::s1, Regs::s7, 0xF14), "csrrc s1 3860 s7");
 }
 static void Test_csrrwi()
 {
-
+	TestEncodeDecodeInstruction(Create_csrrwi(Regs::a0,  0, 0x300), "csrrwi a0 768 0");
+	TestEncodeDecodeInstruction(Create_csrrwi(Regs::t1, 17, 0x342), "csrrwi t1 834 17");
+	TestEncodeDecodeInstruction(Create_csrrwi(Regs::s1, 31, 0xF14), "csrrwi s1 3860 31");
 }
 static void Test_csrrsi()
 {
-
+	TestEncodeDecodeInstruction(Create_csrrsi(Regs::a0,  0, 0x300), "csrrsi a0 768 0");
+	TestEncodeDecodeInstruction(Create_csrrsi(Regs::t1, 17, 0x342), "csrrsi t1 834 17");
+	TestEncodeDecodeInstruction(Create_csrrsi(Regs::s1, 31, 0xF14), "csrrsi s1 3860 31");
 }
 static void Test_csrrci()
 {
-
+	TestEncodeDecodeInstruction(Create_csrrci(Regs::a0,  0, 0x300), "csrrci a0 768 0");
+	TestEncodeDecodeInstruction(Create_csrrci(Regs::t1, 17, 0x342), "csrrci t1 834 17");
+	TestEncodeDecodeInstruction(Create_csrrci(Regs::s1, 31, 0xF14), "csrrci s1 3860 31");
+}
+static void Test_sret()
+{
+	TestEncodeDecodeInstruction(Create_sret(), "sret");
+	TestEncodeDecodeInstruction(0x10200073, "sret");
+}
+static void Test_mret()
+{
+	TestEncodeDecodeInstruction(Create_mret(), "mret");
+	TestEncodeDecodeInstruction(0x30200073, "mret");
+}
+static void Test_sfence_vma()
+{
+	TestEncodeDecodeInstruction(Create_sfence_vma(Regs::x0, Regs::x0), "sfence_vma");
+	TestEncodeDecodeInstruction(Create_sfence_vma(Regs::a0, Regs::x0), "sfence_vma");
+	TestEncodeDecodeInstruction(0x12000073, "sfence_vma");
+}
+static void Test_wfi()
+{
+	TestEncodeDecodeInstruction(Create_wfi(), "wfi");
+	TestEncodeDecodeInstruction(0x10500073, "wfi");
 }
 static void Test_mul()
 {
@@ -333,6 +372,260 @@ static void Test_remu()
 	TestEncodeDecodeInstruction(Create_remu(Regs::s2, Regs::t4, Regs::s11), "remu s2 t4 s11");
 	TestEncodeDecodeInstruction(Create_remu(Regs::t5, Regs::s10, Regs::t1), "remu t5 s10 t1");
 }
+static void Test_lr_w()
+{
+	TestEncodeDecodeInstruction(Create_lr_w(Regs::a0, Regs::s5, AtomicOrdering::None), "lr_w a0 (s5)");
+	TestEncodeDecodeInstruction(Create_lr_w(Regs::t1, Regs::a1, AtomicOrdering::Acquire), "lr_w.aq t1 (a1)");
+	TestEncodeDecodeInstruction(0x1605a52f, "lr_w.aqrl a0 (a1)");
+}
+static void Test_sc_w()
+{
+	TestEncodeDecodeInstruction(Create_sc_w(Regs::a0, Regs::s5, Regs::s10, AtomicOrdering::None), "sc_w a0 s10 (s5)");
+	TestEncodeDecodeInstruction(Create_sc_w(Regs::t1, Regs::a1, Regs::t4, AtomicOrdering::Release), "sc_w.rl t1 t4 (a1)");
+	TestEncodeDecodeInstruction(0x1ac5a52f, "sc_w.rl a0 a2 (a1)");
+}
+static void Test_amoswap_w()
+{
+	TestEncodeDecodeInstruction(Create_amoswap_w(Regs::s2, Regs::t4, Regs::s11, AtomicOrdering::None), "amoswap_w s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amoswap_w(Regs::t5, Regs::s10, Regs::t1, AtomicOrdering::AcquireRelease), "amoswap_w.aqrl t5 t1 (s10)");
+	TestEncodeDecodeInstruction(0x0cc5a52f, "amoswap_w.aq a0 a2 (a1)");
+}
+static void Test_amoadd_w()
+{
+	TestEncodeDecodeInstruction(Create_amoadd_w(Regs::s2, Regs::t4, Regs::s11, AtomicOrdering::None), "amoadd_w s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amoadd_w(Regs::t5, Regs::s10, Regs::t1, AtomicOrdering::AcquireRelease), "amoadd_w.aqrl t5 t1 (s10)");
+	TestEncodeDecodeInstruction(0x00c5a52f, "amoadd_w a0 a2 (a1)");
+}
+static void Test_amoxor_w()
+{
+	TestEncodeDecodeInstruction(Create_amoxor_w(Regs::s2, Regs::t4, Regs::s11, AtomicOrdering::None), "amoxor_w s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amoxor_w(Regs::t5, Regs::s10, Regs::t1, AtomicOrdering::AcquireRelease), "amoxor_w.aqrl t5 t1 (s10)");
+	TestEncodeDecodeInstruction(0x20c5a52f, "amoxor_w a0 a2 (a1)");
+}
+static void Test_amoand_w()
+{
+	TestEncodeDecodeInstruction(Create_amoand_w(Regs::s2, Regs::t4, Regs::s11, AtomicOrdering::None), "amoand_w s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amoand_w(Regs::t5, Regs::s10, Regs::t1, AtomicOrdering::AcquireRelease), "amoand_w.aqrl t5 t1 (s10)");
+	TestEncodeDecodeInstruction(0x60c5a52f, "amoand_w a0 a2 (a1)");
+}
+static void Test_amoor_w()
+{
+	TestEncodeDecodeInstruction(Create_amoor_w(Regs::s2, Regs::t4, Regs::s11, AtomicOrdering::None), "amoor_w s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amoor_w(Regs::t5, Regs::s10, Regs::t1, AtomicOrdering::AcquireRelease), "amoor_w.aqrl t5 t1 (s10)");
+	TestEncodeDecodeInstruction(0x40c5a52f, "amoor_w a0 a2 (a1)");
+}
+static void Test_amomin_w()
+{
+	TestEncodeDecodeInstruction(Create_amomin_w(Regs::s2, Regs::t4, Regs::s11, AtomicOrdering::None), "amomin_w s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amomin_w(Regs::t5, Regs::s10, Regs::t1, AtomicOrdering::AcquireRelease), "amomin_w.aqrl t5 t1 (s10)");
+	TestEncodeDecodeInstruction(0x80c5a52f, "amomin_w a0 a2 (a1)");
+}
+static void Test_amomax_w()
+{
+	TestEncodeDecodeInstruction(Create_amomax_w(Regs::s2, Regs::t4, Regs::s11, AtomicOrdering::None), "amomax_w s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amomax_w(Regs::t5, Regs::s10, Regs::t1, AtomicOrdering::AcquireRelease), "amomax_w.aqrl t5 t1 (s10)");
+	TestEncodeDecodeInstruction(0xa0c5a52f, "amomax_w a0 a2 (a1)");
+}
+static void Test_amominu_w()
+{
+	TestEncodeDecodeInstruction(Create_amominu_w(Regs::s2, Regs::t4, Regs::s11, AtomicOrdering::None), "amominu_w s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amominu_w(Regs::t5, Regs::s10, Regs::t1, AtomicOrdering::AcquireRelease), "amominu_w.aqrl t5 t1 (s10)");
+	TestEncodeDecodeInstruction(0xc0c5a52f, "amominu_w a0 a2 (a1)");
+}
+static void Test_amomaxu_w()
+{
+	TestEncodeDecodeInstruction(Create_amomaxu_w(Regs::s2, Regs::t4, Regs::s11, AtomicOrdering::None), "amomaxu_w s2 s11 (t4)");
+	TestEncodeDecodeInstruction(Create_amomaxu_w(Regs::t5, Regs::s10, Regs::t1, AtomicOrdering::AcquireRelease), "amomaxu_w.aqrl t5 t1 (s10)");
+	TestEncodeDecodeInstruction(0xe6c5a52f, "amomaxu_w.aqrl a0 a2 (a1)");
+}
+
+static const std::vector<uint32_t> VALID_OPCODES = {
+	0b0000011, 0b0001111, 0b0010011, 0b0010111, 0b0100011, 0b0101111,
+	0b0110011, 0b0110111, 0b1100011, 0b1100111, 0b1101111, 0b1110011
+};
+
+//the fields as they are, as not every decoded word has a name
+static std::string DescribeDecoded(const Instruction& instruction)
+{
+	return "type " + NumberToBits(static_cast<uint32_t>(instruction.type)) +
+		" rd " + std::to_string(instruction.rd) +
+		" rs1 " + std::to_string(instruction.rs1) +
+		" rs2 " + std::to_string(instruction.rs2) +
+		" immediate " + std::to_string(instruction.immediate);
+}
+
+static void CompareBulkDecode(const std::vector<uint32_t>& words, const std::vector<Instruction>& expected, const BulkDecodeOptions& options)
+{
+	std::vector<Instruction> decoded(words.size());
+	DecodeBulk(words.data(), words.size(), decoded.data(), options);
+	for (size_t i = 0; i < words.size(); i++)
+	{
+		if (decoded[i].immediate != expected[i].immediate ||
+			decoded[i].type != expected[i].type ||
+			decoded[i].rd != expected[i].rd ||
+			decoded[i].rs1 != expected[i].rs1 ||
+			decoded[i].rs2 != expected[i].rs2)
+		{
+			throw std::runtime_error("\nBulk decode doesn't match the scalar decoder.\nWord: " + InstructionToBits(words[i]) +
+				"\nExpected: " + DescribeDecoded(expected[i]) +
+				"\nActual:   " + DescribeDecoded(decoded[i]) + "\n");
+		}
+	}
+}
+
+//Every valid opcode with every funct3, funct7 and rs2, which are all the
+//bits the instruction type depends on, and every opcode with every funct3
+//to see that both decoders reject the same ones.
+static void Test_DecodeMatchesReference()
+{
+	FRandom::TCRandom random = FRandom::SeedTCRandom(46, 0);
+	for (uint32_t opcode = 0; opcode < 128; opcode++)
+	{
+		for (uint32_t funct3 = 0; funct3 < 8; funct3++)
+		{
+			const bool valid = std::find(VALID_OPCODES.begin(), VALID_OPCODES.end(), opcode) != VALID_OPCODES.end();
+			for (uint32_t upper = 0; upper < (valid ? (1u << 12) : 1u); upper++)
+			{
+				const uint32_t rd = static_cast<uint32_t>(FRandom::RandomRange(random, 0, 31));
+				const uint32_t rs1 = static_cast<uint32_t>(FRandom::RandomRange(random, 0, 31));
+				const uint32_t word = opcode | (rd << 7) | (funct3 << 12) | (rs1 << 15) | (upper << 20);
+
+				std::string expectedError;
+				std::string actualError;
+				Instruction expected = { 0 };
+				Instruction actual = { 0 };
+				try
+				{
+					expected = ReferenceDecodeInstruction(word);
+				}
+				catch (const std::runtime_error& e)
+				{
+					expectedError = e.what();
+				}
+				try
+				{
+					actual = DecodeInstruction(word);
+				}
+				catch (const std::runtime_error& e)
+				{
+					actualError = e.what();
+				}
+				if (expectedError != actualError ||
+					expected.immediate != actual.immediate ||
+					expected.type != actual.type ||
+					expected.rd != actual.rd ||
+					expected.rs1 != actual.rs1 ||
+					expected.rs2 != actual.rs2)
+				{
+					throw std::runtime_error("\nDecode tables don't match the reference decoder.\nWord: " + InstructionToBits(word) +
+						"\nExpected: " + DescribeDecoded(expected) + " " + expectedError +
+						"\nActual:   " + DescribeDecoded(actual) + " " + actualError + "\n");
+				}
+			}
+		}
+	}
+	std::cout << "Test Success: decode tables match the reference decoder" << std::endl;
+}
+
+//every opcode, funct3 and funct7 with random registers, then
+//enough random instructions that the decode is split between threads
+static void Test_BulkDecode()
+{
+	FRandom::TCRandom random = FRandom::SeedTCRandom(45, 0);
+	std::vector<uint32_t> words;
+	for (uint32_t opcode = 0; opcode < 128; opcode++)
+	{
+		for (uint32_t funct3 = 0; funct3 < 8; funct3++)
+		{
+			for (uint32_t funct7 = 0; funct7 < 128; funct7++)
+			{
+				const uint32_t registers = static_cast<uint32_t>(FRandom::RandomRange(random, 0, 0x7fff));
+				words.push_back(opcode | ((registers & 0x1f) << 7) | (funct3 << 12) | ((registers >> 5) << 15) | (funct7 << 25));
+			}
+		}
+	}
+	words.push_back(Create_wfi());
+	words.push_back(Create_sret());
+	while (words.size() < (5 << 18) + 3)
+	{
+		const uint32_t high = static_cast<uint32_t>(FRandom::RandomRange(random, 0, 0xffff));
+		const uint32_t low = static_cast<uint32_t>(FRandom::RandomRange(random, 0, 0xffff));
+		uint32_t word = (high << 16) | low;
+		//mostly valid opcodes, so there are few exceptions to catch below
+		if ((low & 0xf) != 0)
+		{
+			word = (word & ~0x7f) | VALID_OPCODES[high % VALID_OPCODES.size()];
+		}
+		words.push_back(word);
+	}
+
+	std::vector<Instruction> expected;
+	for (const uint32_t word : words)
+	{
+		try
+		{
+			expected.push_back(DecodeInstruction(word));
+		}
+		catch (const std::runtime_error&)
+		{
+			expected.push_back({ 0 });
+		}
+	}
+
+	CompareBulkDecode(words, expected, { true, false, 1 });
+	CompareBulkDecode(words, expected, { true, true, 1 });
+	CompareBulkDecode(words, expected, { true, true, 3 });
+	CompareBulkDecode(words, expected, { true, false, 4 });
+
+	//without lenient the first word that isn't an instruction fails the decode
+	std::vector<uint32_t> program(1001, Create_addi(Regs::a0, Regs::a0, 1));
+	program[517] = 0x0000007f;
+	program[900] = 0x00000000;
+	std::vector<Instruction> decoded(program.size());
+	for (const bool useAVX2 : { false, true })
+	{
+		try
+		{
+			DecodeBulk(program.data(), program.size(), decoded.data(), { false, useAVX2, 1 });
+			throw std::runtime_error("\nBulk decode didn't fail on an invalid opcode\n");
+		}
+		catch (const std::runtime_error& e)
+		{
+			if (std::string(e.what()) != "Invalid opcode. opcode: 127")
+			{
+				throw;
+			}
+		}
+	}
+	std::cout << "Test Success: bulk decode" << std::endl;
+}
+
+//the first and last words of the sweep over every word
+static void Test_DecodeSweep()
+{
+	const uint64_t count = 1 << 16;
+	//each of the low 16 bits has every opcode and funct3 with 64 values of
+	//rd and rs1 and nothing else set. The first words have funct7 0, which
+	//leaves 65 valid combinations of opcode and funct3. The last ones have
+	//every other bit set, where only 53 are, as there are no r types and
+	//shifts with funct7 0x7f, atomics with funct5 31 or ecalls with an immediate
+	const uint64_t firsts[] = { 0, ALL_WORDS - count };
+	const uint64_t valids[] = { 65 * 64, 53 * 64 };
+	for (uint32_t range = 0; range < 2; range++)
+	{
+		const DecodeSweepResult result = SweepDecoders(firsts[range], count, 2);
+		if (!result.examples.empty())
+		{
+			throw std::runtime_error("\nDecode sweep found a mismatch:\n" + result.examples.front() + "\n");
+		}
+		if (result.words != count || result.mismatches != 0 || result.valid != valids[range] || result.illegal != count - valids[range])
+		{
+			throw std::runtime_error("\nDecode sweep counted the wrong number of words.\nValid: " + std::to_string(result.valid) +
+				"\nIllegal: " + std::to_string(result.illegal) + "\n");
+		}
+	}
+	std::cout << "Test Success: decode sweep" << std::endl;
+}
 
 void TestAllEncodeDecode()
 {
@@ -385,6 +678,10 @@ void TestAllEncodeDecode()
 		Test_csrrwi();
 		Test_csrrsi();
 		Test_csrrci();
+		Test_sret();
+		Test_mret();
+		Test_sfence_vma();
+		Test_wfi();
 		Test_mul();
 		Test_mulh();
 		Test_mulhsu();
@@ -393,6 +690,20 @@ void TestAllEncodeDecode()
 		Test_divu();
 		Test_rem();
 		Test_remu();
+		Test_lr_w();
+		Test_sc_w();
+		Test_amoswap_w();
+		Test_amoadd_w();
+		Test_amoxor_w();
+		Test_amoand_w();
+		Test_amoor_w();
+		Test_amomin_w();
+		Test_amomax_w();
+		Test_amominu_w();
+		Test_amomaxu_w();
+		Test_DecodeMatchesReference();
+		Test_BulkDecode();
+		Test_DecodeSweep();
 	}
 	catch (std::runtime_error& e)
 	{
@@ -0,0 +1,304 @@
+#include "TestFileMemory.h"
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "RISCV_Program.h"
+#include "MappedFile.h"
+#include "ProgramImage.h"
+#include "ReadProgram.h"
+#include "Processor.h"
+
+static const uint32_t FILE_BASE = 0x40'00'00'00;
+static const std::string SHARED_FILE = "test_shared_memory.tmp";
+static const std::string READ_ONLY_FILE = "test_read_only_memory.tmp";
+static const std::string RAM_FILE = "test_ram_file.tmp";
+static const uint32_t RAM_FILE_SIZE = 0x10'000;
+static const std::string MAPPED_PROGRAM = "test_mapped_program";
+
+static void Success(const std::string& testName)
+{
+	std::cout << "Test Success: " << testName << std::endl;
+}
+
+static void Test_SharedFile()
+{
+	std::remove(SHARED_FILE.c_str());
+	{
+		RISCV_Program program("Test_SharedFile");
+		program.AttachFile(FILE_BASE, std::make_shared<MappedFile>(SHARED_FILE, FileMapping::Shared, 8192));
+
+		//increments the counter at the start of the file
+		program.AddInstruction(Create_lui(Regs::t0, FILE_BASE >> 12));
+		program.AddInstruction(Create_lw(Regs::a1, Regs::t0, 0));
+		program.AddInstruction(Create_addi(Regs::a1, Regs::a1, 1));
+		program.AddInstruction(Create_sw(Regs::t0, Regs::a1, 0));
+		program.ExpectRegisterValue(Regs::t0, FILE_BASE);
+		program.EndProgram();
+
+		program.ExpectRegisterValue(Regs::a1, 1);
+		program.Test();
+		//reset between runs must not clear the file
+		program.ExpectRegisterValue(Regs::a1, 2);
+		program.Test();
+	}
+
+	std::ifstream file(SHARED_FILE, std::ios::binary);
+	uint32_t counter = 0;
+	file.read(reinterpret_cast<char*>(&counter), sizeof(counter));
+	file.close();
+	std::remove(SHARED_FILE.c_str());
+	if (counter != 2)
+	{
+		throw std::runtime_error("Stores to a shared file wasn't saved.\nCounter: " + std::to_string(counter) + "\n");
+	}
+
+	Success("test_shared_file");
+}
+
+static void Test_ReadOnlyFile()
+{
+	//not a whole number of pages so the end of the file is tested
+	std::vector<uint8_t> contents(6000, 0x11);
+	contents[0x1000 + 0] = 0xef;
+	contents[0x1000 + 1] = 0xbe;
+	contents[0x1000 + 2] = 0xad;
+	contents[0x1000 + 3] = 0xde;
+	std::ofstream output(READ_ONLY_FILE, std::ios::binary);
+	output.write(reinterpret_cast<const char*>(contents.data()), contents.size());
+	output.close();
+
+	const std::shared_ptr<MappedFile> file = std::make_shared<MappedFile>(READ_ONLY_FILE, FileMapping::ReadOnly, 0);
+
+	RISCV_Program program("Test_ReadOnlyFile");
+	program.AttachFile(FILE_BASE, file);
+	program.AddInstruction(Create_lui(Regs::t0, FILE_BASE >> 12));
+	program.AddInstruction(Create_lw(Regs::a1, Regs::t0, 0x100));
+	program.AddInstruction(Create_lui(Regs::t1, (FILE_BASE >> 12) + 1));
+	program.AddInstruction(Create_lw(Regs::a2, Regs::t1, 0));
+	program.AddInstruction(Create_lbu(Regs::a3, Regs::t1, 6000 - 0x1000 + 10));
+	program.ExpectRegisterValue(Regs::t0, FILE_BASE);
+	program.ExpectRegisterValue(Regs::t1, FILE_BASE + 0x1000);
+	program.ExpectRegisterValue(Regs::a1, 0x11'11'11'11);
+	program.ExpectRegisterValue(Regs::a2, 0xde'ad'be'ef);
+	program.ExpectRegisterValue(Regs::a3, 0);
+	program.EndProgram();
+	program.Test();
+
+	RISCV_Program storeProgram("Test_ReadOnlyFileStore");
+	storeProgram.AttachFile(FILE_BASE, file);
+	storeProgram.AddInstruction(Create_lui(Regs::t0, FILE_BASE >> 12));
+	storeProgram.AddInstruction(Create_sw(Regs::t0, Regs::t0, 0));
+	storeProgram.EndProgram();
+
+	bool storeFailed = false;
+	try
+	{
+		storeProgram.Run();
+	}
+	catch (const std::runtime_error&)
+	{
+		storeFailed = true;
+	}
+	std::remove(READ_ONLY_FILE.c_str());
+	if (!storeFailed)
+	{
+		throw std::runtime_error("Store to a read only file didn't fail.");
+	}
+
+	Success("test_read_only_file");
+}
+
+static MemoryOptions RAMFileOptions(const RAMFileMapping mapping)
+{
+	MemoryOptions memory = Processor::DefaultMemoryOptions();
+	memory.ramSize = RAM_FILE_SIZE;
+	memory.ramFileMapping = mapping;
+	memory.ramFile = RAM_FILE;
+	return memory;
+}
+
+static void Test_SharedRAMFile()
+{
+	std::remove(RAM_FILE.c_str());
+	RISCV_Program program("Test_SharedRAMFile");
+	program.SetMemoryOptions(RAMFileOptions(RAMFileMapping::Shared));
+
+	//increments a counter in ram
+	program.AddInstruction(Create_lui(Regs::t0, 1));
+	program.AddInstruction(Create_lw(Regs::a1, Regs::t0, 0));
+	program.AddInstruction(Create_addi(Regs::a1, Regs::a1, 1));
+	program.AddInstruction(Create_sw(Regs::t0, Regs::a1, 0));
+	program.ExpectRegisterValue(Regs::t0, 0x1000);
+	program.EndProgram();
+
+	program.ExpectRegisterValue(Regs::a1, 1);
+	program.Test();
+	//loading the program again must not clear the file
+	program.ExpectRegisterValue(Regs::a1, 2);
+	program.Test();
+
+	std::ifstream file(RAM_FILE, std::ios::binary | std::ios::ate);
+	const std::streamoff fileSize = file.tellg();
+	uint32_t counter = 0;
+	file.seekg(0x1000);
+	file.read(reinterpret_cast<char*>(&counter), sizeof(counter));
+	file.close();
+	std::remove(RAM_FILE.c_str());
+	if (counter != 2 || fileSize != RAM_FILE_SIZE)
+	{
+		throw std::runtime_error("Stores to ram backed by a file weren't saved.\nCounter: " + std::to_string(counter) +
+			"\nFile size: " + std::to_string(fileSize) + "\n");
+	}
+
+	Success("test_shared_ram_file");
+}
+
+static void Test_PrivateRAMFile()
+{
+	//not a whole number of pages so the end of the file is tested
+	std::vector<uint8_t> contents(6000, 0x11);
+	contents[0x1000 + 0] = 0xef;
+	contents[0x1000 + 1] = 0xbe;
+	contents[0x1000 + 2] = 0xad;
+	contents[0x1000 + 3] = 0xde;
+	std::ofstream output(RAM_FILE, std::ios::binary);
+	output.write(reinterpret_cast<const char*>(contents.data()), contents.size());
+	output.close();
+
+	RISCV_Program program("Test_PrivateRAMFile");
+	program.SetMemoryOptions(RAMFileOptions(RAMFileMapping::Private));
+	program.AddInstruction(Create_lui(Regs::t0, 1));
+	program.AddInstruction(Create_lw(Regs::a1, Regs::t0, 0));
+	program.AddInstruction(Create_sw(Regs::t0, Regs::t0, 0));
+	program.AddInstruction(Create_lw(Regs::a2, Regs::t0, 0));
+	program.AddInstruction(Create_lbu(Regs::a3, Regs::t0, 6000 - 0x1000 + 10));
+	program.AddInstruction(Create_lui(Regs::t1, 8));
+	program.AddInstruction(Create_lw(Regs::a4, Regs::t1, 0));
+	program.ExpectRegisterValue(Regs::t0, 0x1000);
+	program.ExpectRegisterValue(Regs::t1, 0x8000);
+	program.ExpectRegisterValue(Regs::a1, 0xde'ad'be'ef);
+	program.ExpectRegisterValue(Regs::a2, 0x1000);
+	program.ExpectRegisterValue(Regs::a3, 0);
+	program.ExpectRegisterValue(Regs::a4, 0);
+	program.EndProgram();
+	//the store of the first run isn't seen by the second
+	program.Test();
+	program.Test();
+
+	std::ifstream file(RAM_FILE, std::ios::binary);
+	std::vector<uint8_t> after(contents.size() + 1);
+	file.read(reinterpret_cast<char*>(after.data()), after.size());
+	const std::streamsize read = file.gcount();
+	file.close();
+	std::remove(RAM_FILE.c_str());
+	after.resize(static_cast<size_t>(read));
+	if (after != contents)
+	{
+		throw std::runtime_error("A run changed the file backing its private ram.");
+	}
+
+	Success("test_private_ram_file");
+}
+
+static void RemoveMappedProgram()
+{
+	for (const char* extension : { ".bin", ".res", ".s" })
+	{
+		std::remove((MAPPED_PROGRAM + extension).c_str());
+	}
+}
+
+static void ExpectLoadError(const std::string& content)
+{
+	std::ofstream(MAPPED_PROGRAM + ".bin", std::ios::binary) << content;
+	bool caught = false;
+	try
+	{
+		ProgramImage image(MAPPED_PROGRAM + ".bin");
+	}
+	catch (const std::runtime_error& e)
+	{
+		caught = std::string(e.what()).find("correct length") != std::string::npos;
+	}
+	if (!caught)
+	{
+		throw std::runtime_error("A program file of " + std::to_string(content.size()) + " bytes was loaded.");
+	}
+}
+
+//a loaded program runs straight from the words of its file
+static void Test_MappedProgram()
+{
+	RemoveMappedProgram();
+	RISCV_Program saved(MAPPED_PROGRAM);
+	saved.AddInstruction(Create_addi(Regs::a1, Regs::x0, 5));
+	saved.AddInstruction(Create_lui(Regs::a2, 0x12345));
+	saved.ExpectRegisterValue(Regs::a1, 5);
+	saved.ExpectRegisterValue(Regs::a2, 0x12345000);
+	saved.EndProgram();
+	saved.Save(MAPPED_PROGRAM);
+
+	const InstructionView expected = saved.GetInstructions();
+	{
+		ProgramImage image(MAPPED_PROGRAM + ".bin");
+		const InstructionView words = image.GetInstructions();
+		if (words.size != expected.size || !std::equal(words.begin(), words.end(), expected.begin()))
+		{
+			throw std::runtime_error("The mapped program has the wrong instructions.");
+		}
+#ifndef _WIN32
+		if (!image.IsMapped())
+		{
+			throw std::runtime_error("The program wasn't mapped.");
+		}
+#endif
+	}
+
+	const std::unique_ptr<RISCV_Program> loaded = LoadProgram(MAPPED_PROGRAM);
+	loaded->Test();
+	//adding an instruction copies the words out of the file first
+	loaded->RemoveLatestsInstruction();
+	loaded->AddInstruction(Create_ecall());
+	const InstructionView copied = loaded->GetInstructions();
+	if (copied.size != expected.size || !std::equal(copied.begin(), copied.end(), expected.begin()))
+	{
+		throw std::runtime_error("The instructions of a loaded program changed when copied.");
+	}
+	loaded->Test();
+
+	ExpectLoadError("");
+	ExpectLoadError("123456");
+	RemoveMappedProgram();
+
+	Success("test_mapped_program");
+}
+
+void TestFileMemory()
+{
+	try
+	{
+		Test_SharedFile();
+		Test_ReadOnlyFile();
+		Test_SharedRAMFile();
+		Test_PrivateRAMFile();
+		Test_MappedProgram();
+	}
+	catch (std::runtime_error& e)
+	{
+		RemoveMappedProgram();
+		std::remove(RAM_FILE.c_str());
+		std::cout << "Failed to finish all file memory tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all file memory tests\n" << std::endl;
+}
@@ -0,0 +1,144 @@
+#include "TestForkServer.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <stdexcept>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "RISCV_Program.h"
+#include "BatchRunner.h"
+#include "ForkServer.h"
+
+static const std::string ENDLESS_PROGRAM = "test_fork_endless";
+
+static void Success(const std::string& testName)
+{
+	std::cout << "Test Success: " << testName << std::endl;
+}
+
+static void RemoveTestFiles()
+{
+	for (const char* extension : { ".bin", ".res", ".s" })
+	{
+		std::remove((ENDLESS_PROGRAM + extension).c_str());
+	}
+}
+
+static std::vector<std::string> SplitLines(const std::string& text)
+{
+	std::vector<std::string> lines;
+	std::istringstream stream(text);
+	std::string line;
+	while (std::getline(stream, line))
+	{
+		lines.push_back(line);
+	}
+	return lines;
+}
+
+static void ExpectResponse(const std::string& response, const std::string& status, const std::string& program, const std::string& message)
+{
+	//status, instructions, milliseconds, program and message
+	std::vector<std::string> fields;
+	std::istringstream stream(response);
+	std::string field;
+	while (std::getline(stream, field, '\t'))
+	{
+		fields.push_back(field);
+	}
+	if (fields.size() < 4 || fields[0] != status || fields[3] != program ||
+		(fields.size() > 4 ? fields[4] : "").find(message) == std::string::npos)
+	{
+		throw std::runtime_error("Incorrect fork server response:\n" + response + "\n");
+	}
+}
+
+//every program gets a line in the order they were asked for,
+//the ones after a failing one too
+static void Test_ForkServerServes()
+{
+	RemoveTestFiles();
+	RISCV_Program endless(ENDLESS_PROGRAM);
+	endless.AddInstruction(Create_jal(Regs::x0, 0));
+	endless.Save(ENDLESS_PROGRAM);
+
+	std::istringstream requests(
+		"tests/task1/addlarge\n"
+		"# comments and empty lines are skipped\n"
+		"\n"
+		"test_fork_missing\n" +
+		ENDLESS_PROGRAM + "\n"
+		"tests/task2/branchcnt\n");
+	std::ostringstream responses;
+	const uint32_t notPassed = ServePrograms(requests, responses, { 1 << 16, 10.0 }, 10);
+	RemoveTestFiles();
+
+	const std::vector<std::string> lines = SplitLines(responses.str());
+	if (notPassed != 2 || lines.size() != 4)
+	{
+		throw std::runtime_error("Fork server didn't answer every request.\n" + responses.str());
+	}
+	ExpectResponse(lines[0], "PASS", "tests/task1/addlarge", "");
+	ExpectResponse(lines[1], "ERROR", "test_fork_missing", "Failed to open");
+	ExpectResponse(lines[2], "ERROR", ENDLESS_PROGRAM, "exceeded the limit");
+	ExpectResponse(lines[3], "PASS", "tests/task2/branchcnt", "");
+
+	Success("test_fork_server_serves");
+}
+
+//a child that crashes or hangs doesn't take the server down
+static void Test_ForkServerIsolates()
+{
+	const BatchResult crashed = RunForked("crash", []() -> BatchResult { std::abort(); }, 0);
+	if (crashed.status != BatchStatus::Error || crashed.message.find("Killed by signal") == std::string::npos)
+	{
+		throw std::runtime_error("A crashed child wasn't reported.\nMessage: " + crashed.message + "\n");
+	}
+
+	const BatchResult hung = RunForked("hang", []() -> BatchResult { while (true) { } }, 1);
+	if (hung.status != BatchStatus::Error || hung.message != "Killed after 1 seconds")
+	{
+		throw std::runtime_error("A hung child wasn't killed.\nMessage: " + hung.message + "\n");
+	}
+
+	const BatchResult thrown = RunForked("throw", []() -> BatchResult { throw std::runtime_error("thrown\nsecond line"); }, 0);
+	if (thrown.status != BatchStatus::Error || thrown.message != "thrown")
+	{
+		throw std::runtime_error("An exception in a child wasn't reported.\nMessage: " + thrown.message + "\n");
+	}
+
+	//the child's output doesn't reach the parent's stdout
+	const BatchResult quiet = RunForked("quiet", []() -> BatchResult
+	{
+		std::cout << "printed by a child" << std::endl;
+		return { "quiet", BatchStatus::Passed, 42, 0.0, "" };
+	}, 0);
+	if (quiet.status != BatchStatus::Passed || quiet.instructionsExecuted != 42 || quiet.program != "quiet")
+	{
+		throw std::runtime_error("A passing child wasn't reported.\n");
+	}
+
+	Success("test_fork_server_isolates");
+}
+
+void TestForkServer()
+{
+	try
+	{
+		Test_ForkServerServes();
+		Test_ForkServerIsolates();
+	}
+	catch (std::runtime_error& e)
+	{
+		RemoveTestFiles();
+		std::cout << "Failed to finish all fork server tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all fork server tests\n" << std::endl;
+}
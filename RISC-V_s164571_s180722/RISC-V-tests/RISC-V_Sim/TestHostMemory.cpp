@@ -0,0 +1,85 @@
+#include "TestHostMemory.h"
+#include <cstdint>
+#include <stdexcept>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "Processor.h"
+#include "HostMemory.h"
+
+static const uint32_t LARGE_MEMORY_SIZE = 8 * 1024 * 1024;
+
+static void Success(const std::string& testName)
+{
+	std::cout << "Test Success: " << testName << std::endl;
+}
+
+//loads the last page of a large memory before storing to it, the
+//processor is reused so the load only reads 0 if reset clears ram
+static void TestLargeMemory(const std::string& name, const bool useHugePages, const bool bindToNUMANode)
+{
+	const std::vector<uint32_t> instructions =
+	{
+		Create_lui(Regs::t0, (LARGE_MEMORY_SIZE >> 12) - 1),
+		Create_lw(Regs::a1, Regs::t0, 0x7fc),
+		Create_addi(Regs::t1, Regs::x0, 123),
+		Create_sw(Regs::t0, Regs::t1, 0x7fc),
+		Create_lw(Regs::a2, Regs::t0, 0x7fc),
+		Create_addi(Regs::a0, Regs::x0, 10),
+		Create_ecall()
+	};
+
+	Processor processor({ LARGE_MEMORY_SIZE, useHugePages, bindToNUMANode });
+	for (uint32_t run = 0; run < 2; run++)
+	{
+		processor.Run(instructions.data(), instructions.size());
+
+		uint32_t registers[32];
+		processor.CopyRegistersTo(registers);
+		if (registers[static_cast<uint32_t>(Regs::a1)] != 0 || registers[static_cast<uint32_t>(Regs::a2)] != 123)
+		{
+			throw std::runtime_error("Incorrect program result for " + name + " in run " + std::to_string(run) +
+				".\na1: " + std::to_string(registers[static_cast<uint32_t>(Regs::a1)]) +
+				"\na2: " + std::to_string(registers[static_cast<uint32_t>(Regs::a2)]) + "\n");
+		}
+	}
+
+	if (!useHugePages && processor.GetMemoryBackingInfo().backing != PageBacking::NormalPages)
+	{
+		throw std::runtime_error("Memory used huge pages without asking for them.\n");
+	}
+}
+
+static void Test_LargeMemory()
+{
+	TestLargeMemory("Test_LargeMemory", false, false);
+
+	Success("test_large_memory");
+}
+
+static void Test_HugePageMemory()
+{
+	//whichever backing the os gives has to behave the same
+	TestLargeMemory("Test_HugePageMemory", true, true);
+
+	Success("test_huge_page_memory");
+}
+
+void TestHostMemory()
+{
+	try
+	{
+		Test_LargeMemory();
+		Test_HugePageMemory();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all host memory tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all host memory tests\n" << std::endl;
+}
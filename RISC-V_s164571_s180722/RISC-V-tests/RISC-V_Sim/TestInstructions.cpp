@@ -10,6 +10,7 @@
 #include "Instruction.h"
 #include "ReadProgram.h"
 #include "RISCV_Program.h"
+#include "CSR.h"
 
 static void Success(const std::string& testName)
 {
@@ -1029,27 +1030,113 @@ static void Test_ebreak()
 }
 static void Test_csrrw()
 {
+	RISCV_Program program("Test_csrrw");
+	const uint32_t mscratch = static_cast<uint32_t>(CSR::mscratch);
+
+	program.SetRegister(Regs::a0, 0x12'34'56'78);
+	program.AddInstruction(Create_csrrw(Regs::x0, Regs::a0, mscratch));
+	program.AddInstruction(Create_csrrw(Regs::s0, Regs::x0, mscratch));
+	program.AddInstruction(Create_csrrw(Regs::s1, Regs::x0, mscratch));
+	program.ExpectRegisterValue(Regs::s0, 0x12'34'56'78);
+	program.ExpectRegisterValue(Regs::s1, 0);
+
+	program.SetRegister(Regs::a1, 77);
+	program.AddInstruction(Create_csrrw(Regs::x0, Regs::a1, mscratch));
+	program.AddInstruction(Create_csrrw(Regs::a1, Regs::a1, mscratch));
+	program.ExpectRegisterValue(Regs::a1, 77);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_csrrw");
 
+	Success("test_csrrw");
 }
 static void Test_csrrs()
 {
+	RISCV_Program program("Test_csrrs");
+	const uint32_t mscratch = static_cast<uint32_t>(CSR::mscratch);
+
+	program.SetRegister(Regs::a0, 0b1010);
+	program.SetRegister(Regs::a1, 0b0101);
+	program.AddInstruction(Create_csrrs(Regs::x0, Regs::a0, mscratch));
+	program.AddInstruction(Create_csrrs(Regs::s0, Regs::a1, mscratch));
+	program.AddInstruction(Create_csrrs(Regs::s1, Regs::x0, mscratch));
+	program.ExpectRegisterValue(Regs::s0, 0b1010);
+	program.ExpectRegisterValue(Regs::s1, 0b1111);
+
+	program.SetRegister(Regs::s2, 5);
+	program.AddInstruction(Create_csrrs(Regs::s2, Regs::x0, static_cast<uint32_t>(CSR::mhartid)));
+	program.ExpectRegisterValue(Regs::s2, 0);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_csrrs");
 
+	Success("test_csrrs");
 }
 static void Test_csrrc()
 {
+	RISCV_Program program("Test_csrrc");
+	const uint32_t mscratch = static_cast<uint32_t>(CSR::mscratch);
+
+	program.SetRegister(Regs::a0, 0xff);
+	program.SetRegister(Regs::a1, 0x0f);
+	program.AddInstruction(Create_csrrw(Regs::x0, Regs::a0, mscratch));
+	program.AddInstruction(Create_csrrc(Regs::s0, Regs::a1, mscratch));
+	program.AddInstruction(Create_csrrc(Regs::s1, Regs::x0, mscratch));
+	program.ExpectRegisterValue(Regs::s0, 0xff);
+	program.ExpectRegisterValue(Regs::s1, 0xf0);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_csrrc");
 
+	Success("test_csrrc");
 }
 static void Test_csrrwi()
 {
+	RISCV_Program program("Test_csrrwi");
+	const uint32_t mscratch = static_cast<uint32_t>(CSR::mscratch);
+
+	program.AddInstruction(Create_csrrwi(Regs::x0, 27, mscratch));
+	program.AddInstruction(Create_csrrwi(Regs::s0,  3, mscratch));
+	program.AddInstruction(Create_csrrwi(Regs::s1,  0, mscratch));
+	program.ExpectRegisterValue(Regs::s0, 27);
+	program.ExpectRegisterValue(Regs::s1, 3);
 
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_csrrwi");
+
+	Success("test_csrrwi");
 }
 static void Test_csrrsi()
 {
+	RISCV_Program program("Test_csrrsi");
+	const uint32_t mscratch = static_cast<uint32_t>(CSR::mscratch);
+
+	program.AddInstruction(Create_csrrsi(Regs::x0, 0b10001, mscratch));
+	program.AddInstruction(Create_csrrsi(Regs::s0, 0b00110, mscratch));
+	program.AddInstruction(Create_csrrsi(Regs::s1, 0, mscratch));
+	program.ExpectRegisterValue(Regs::s0, 0b10001);
+	program.ExpectRegisterValue(Regs::s1, 0b10111);
 
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_csrrsi");
+
+	Success("test_csrrsi");
 }
 static void Test_csrrci()
 {
+	RISCV_Program program("Test_csrrci");
+	const uint32_t mscratch = static_cast<uint32_t>(CSR::mscratch);
+
+	program.AddInstruction(Create_csrrwi(Regs::x0, 0b11111, mscratch));
+	program.AddInstruction(Create_csrrci(Regs::s0, 0b01010, mscratch));
+	program.AddInstruction(Create_csrrci(Regs::s1, 0, mscratch));
+	program.ExpectRegisterValue(Regs::s0, 0b11111);
+	program.ExpectRegisterValue(Regs::s1, 0b10101);
 
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_csrrci");
+
+	Success("test_csrrci");
 }
 static void Test_mul()
 {
@@ -1445,6 +1532,249 @@ static void Test_remu()
 
 	Success("test_remu");
 }
+static void Test_lr_w()
+{
+	RISCV_Program program("Test_lr_w");
+
+	program.SetRegister(Regs::s0, 0x12'34'56'78);
+	program.SetRegister(Regs::a1, 200);
+	program.AddInstruction(Create_sw(Regs::a1, Regs::s0, 0));
+	program.AddInstruction(Create_lr_w(Regs::t0, Regs::a1, AtomicOrdering::None));
+	program.AddInstruction(Create_lr_w(Regs::t1, Regs::a1, AtomicOrdering::Acquire));
+	program.ExpectRegisterValue(Regs::t0, 0x12'34'56'78);
+	program.ExpectRegisterValue(Regs::t1, 0x12'34'56'78);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_lr_w");
+
+	Success("test_lr_w");
+}
+static void Test_sc_w()
+{
+	RISCV_Program program("Test_sc_w");
+
+	program.SetRegister(Regs::s0, 77);
+	program.SetRegister(Regs::s1, 99);
+	program.SetRegister(Regs::a1, 200);
+	program.SetRegister(Regs::a2, 204);
+	program.AddInstruction(Create_sw(Regs::a1, Regs::s0, 0));
+
+	//stores after lr.w of the same address
+	program.AddInstruction(Create_lr_w(Regs::t0, Regs::a1, AtomicOrdering::Acquire));
+	program.AddInstruction(Create_sc_w(Regs::t1, Regs::a1, Regs::s1, AtomicOrdering::Release));
+	program.AddInstruction(Create_lw(Regs::t2, Regs::a1, 0));
+	program.ExpectRegisterValue(Regs::t0, 77);
+	program.ExpectRegisterValue(Regs::t1, 0);
+	program.ExpectRegisterValue(Regs::t2, 99);
+
+	//the reservation is used up by the first sc.w
+	program.AddInstruction(Create_sc_w(Regs::t3, Regs::a1, Regs::s0, AtomicOrdering::None));
+	program.AddInstruction(Create_lw(Regs::t4, Regs::a1, 0));
+	program.ExpectRegisterValue(Regs::t3, 1);
+	program.ExpectRegisterValue(Regs::t4, 99);
+
+	//and only covers the address lr.w read
+	program.AddInstruction(Create_lr_w(Regs::t5, Regs::a1, AtomicOrdering::None));
+	program.AddInstruction(Create_sc_w(Regs::t6, Regs::a2, Regs::s0, AtomicOrdering::None));
+	program.AddInstruction(Create_lw(Regs::s2, Regs::a2, 0));
+	program.ExpectRegisterValue(Regs::t5, 99);
+	program.ExpectRegisterValue(Regs::t6, 1);
+	program.ExpectRegisterValue(Regs::s2, 0);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_sc_w");
+
+	Success("test_sc_w");
+}
+static void Test_amoswap_w()
+{
+	RISCV_Program program("Test_amoswap_w");
+
+	program.SetRegister(Regs::s0, 5);
+	program.SetRegister(Regs::s1, 9);
+	program.SetRegister(Regs::a1, 200);
+	program.AddInstruction(Create_sw(Regs::a1, Regs::s0, 0));
+	program.AddInstruction(Create_amoswap_w(Regs::t0, Regs::a1, Regs::s1, AtomicOrdering::None));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::a1, 0));
+	program.ExpectRegisterValue(Regs::t0, 5);
+	program.ExpectRegisterValue(Regs::t1, 9);
+
+	program.AddInstruction(Create_amoswap_w(Regs::t2, Regs::a1, Regs::s1, AtomicOrdering::AcquireRelease));
+	program.ExpectRegisterValue(Regs::t2, 9);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amoswap_w");
+
+	Success("test_amoswap_w");
+}
+static void Test_amoadd_w()
+{
+	RISCV_Program program("Test_amoadd_w");
+
+	program.SetRegister(Regs::s0, 100);
+	program.SetRegister(Regs::s1, 23);
+	program.SetRegister(Regs::a1, 200);
+	program.AddInstruction(Create_sw(Regs::a1, Regs::s0, 0));
+	program.AddInstruction(Create_amoadd_w(Regs::t0, Regs::a1, Regs::s1, AtomicOrdering::None));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::a1, 0));
+	program.ExpectRegisterValue(Regs::t0, 100);
+	program.ExpectRegisterValue(Regs::t1, 123);
+
+	program.AddInstruction(Create_amoadd_w(Regs::t2, Regs::a1, Regs::s1, AtomicOrdering::AcquireRelease));
+	program.ExpectRegisterValue(Regs::t2, 123);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amoadd_w");
+
+	Success("test_amoadd_w");
+}
+static void Test_amoxor_w()
+{
+	RISCV_Program program("Test_amoxor_w");
+
+	program.SetRegister(Regs::s0, 0b1100);
+	program.SetRegister(Regs::s1, 0b1010);
+	program.SetRegister(Regs::a1, 200);
+	program.AddInstruction(Create_sw(Regs::a1, Regs::s0, 0));
+	program.AddInstruction(Create_amoxor_w(Regs::t0, Regs::a1, Regs::s1, AtomicOrdering::None));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::a1, 0));
+	program.ExpectRegisterValue(Regs::t0, 0b1100);
+	program.ExpectRegisterValue(Regs::t1, 0b0110);
+
+	program.AddInstruction(Create_amoxor_w(Regs::t2, Regs::a1, Regs::s1, AtomicOrdering::AcquireRelease));
+	program.ExpectRegisterValue(Regs::t2, 0b0110);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amoxor_w");
+
+	Success("test_amoxor_w");
+}
+static void Test_amoand_w()
+{
+	RISCV_Program program("Test_amoand_w");
+
+	program.SetRegister(Regs::s0, 0b1100);
+	program.SetRegister(Regs::s1, 0b1010);
+	program.SetRegister(Regs::a1, 200);
+	program.AddInstruction(Create_sw(Regs::a1, Regs::s0, 0));
+	program.AddInstruction(Create_amoand_w(Regs::t0, Regs::a1, Regs::s1, AtomicOrdering::None));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::a1, 0));
+	program.ExpectRegisterValue(Regs::t0, 0b1100);
+	program.ExpectRegisterValue(Regs::t1, 0b1000);
+
+	program.AddInstruction(Create_amoand_w(Regs::t2, Regs::a1, Regs::s1, AtomicOrdering::AcquireRelease));
+	program.ExpectRegisterValue(Regs::t2, 0b1000);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amoand_w");
+
+	Success("test_amoand_w");
+}
+static void Test_amoor_w()
+{
+	RISCV_Program program("Test_amoor_w");
+
+	program.SetRegister(Regs::s0, 0b1100);
+	program.SetRegister(Regs::s1, 0b1010);
+	program.SetRegister(Regs::a1, 200);
+	program.AddInstruction(Create_sw(Regs::a1, Regs::s0, 0));
+	program.AddInstruction(Create_amoor_w(Regs::t0, Regs::a1, Regs::s1, AtomicOrdering::None));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::a1, 0));
+	program.ExpectRegisterValue(Regs::t0, 0b1100);
+	program.ExpectRegisterValue(Regs::t1, 0b1110);
+
+	program.AddInstruction(Create_amoor_w(Regs::t2, Regs::a1, Regs::s1, AtomicOrdering::AcquireRelease));
+	program.ExpectRegisterValue(Regs::t2, 0b1110);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amoor_w");
+
+	Success("test_amoor_w");
+}
+static void Test_amomin_w()
+{
+	RISCV_Program program("Test_amomin_w");
+
+	program.SetRegister(Regs::s0, -5);
+	program.SetRegister(Regs::s1, 3);
+	program.SetRegister(Regs::a1, 200);
+	program.AddInstruction(Create_sw(Regs::a1, Regs::s0, 0));
+	program.AddInstruction(Create_amomin_w(Regs::t0, Regs::a1, Regs::s1, AtomicOrdering::None));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::a1, 0));
+	program.ExpectRegisterValue(Regs::t0, -5);
+	program.ExpectRegisterValue(Regs::t1, -5);
+
+	program.AddInstruction(Create_amomin_w(Regs::t2, Regs::a1, Regs::s1, AtomicOrdering::AcquireRelease));
+	program.ExpectRegisterValue(Regs::t2, -5);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amomin_w");
+
+	Success("test_amomin_w");
+}
+static void Test_amomax_w()
+{
+	RISCV_Program program("Test_amomax_w");
+
+	program.SetRegister(Regs::s0, -5);
+	program.SetRegister(Regs::s1, 3);
+	program.SetRegister(Regs::a1, 200);
+	program.AddInstruction(Create_sw(Regs::a1, Regs::s0, 0));
+	program.AddInstruction(Create_amomax_w(Regs::t0, Regs::a1, Regs::s1, AtomicOrdering::None));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::a1, 0));
+	program.ExpectRegisterValue(Regs::t0, -5);
+	program.ExpectRegisterValue(Regs::t1, 3);
+
+	program.AddInstruction(Create_amomax_w(Regs::t2, Regs::a1, Regs::s1, AtomicOrdering::AcquireRelease));
+	program.ExpectRegisterValue(Regs::t2, 3);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amomax_w");
+
+	Success("test_amomax_w");
+}
+static void Test_amominu_w()
+{
+	RISCV_Program program("Test_amominu_w");
+
+	program.SetRegister(Regs::s0, -5);
+	program.SetRegister(Regs::s1, 3);
+	program.SetRegister(Regs::a1, 200);
+	program.AddInstruction(Create_sw(Regs::a1, Regs::s0, 0));
+	program.AddInstruction(Create_amominu_w(Regs::t0, Regs::a1, Regs::s1, AtomicOrdering::None));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::a1, 0));
+	program.ExpectRegisterValue(Regs::t0, -5);
+	program.ExpectRegisterValue(Regs::t1, 3);
+
+	program.AddInstruction(Create_amominu_w(Regs::t2, Regs::a1, Regs::s1, AtomicOrdering::AcquireRelease));
+	program.ExpectRegisterValue(Regs::t2, 3);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amominu_w");
+
+	Success("test_amominu_w");
+}
+static void Test_amomaxu_w()
+{
+	RISCV_Program program("Test_amomaxu_w");
+
+	program.SetRegister(Regs::s0, -5);
+	program.SetRegister(Regs::s1, 3);
+	program.SetRegister(Regs::a1, 200);
+	program.AddInstruction(Create_sw(Regs::a1, Regs::s0, 0));
+	program.AddInstruction(Create_amomaxu_w(Regs::t0, Regs::a1, Regs::s1, AtomicOrdering::None));
+	program.AddInstruction(Create_lw(Regs::t1, Regs::a1, 0));
+	program.ExpectRegisterValue(Regs::t0, -5);
+	program.ExpectRegisterValue(Regs::t1, -5);
+
+	program.AddInstruction(Create_amomaxu_w(Regs::t2, Regs::a1, Regs::s1, AtomicOrdering::AcquireRelease));
+	program.ExpectRegisterValue(Regs::t2, -5);
+
+	program.EndProgram();
+	TestProgram(program, "InstructionTests/test_amomaxu_w");
+
+	Success("test_amomaxu_w");
+}
 static void Test_li()
 {
 	RISCV_Program program("Test_li");
@@ -1536,6 +1866,17 @@ void TestAllInstructions()
 		Test_divu();
 		Test_rem();
 		Test_remu();
+		Test_lr_w();
+		Test_sc_w();
+		Test_amoswap_w();
+		Test_amoadd_w();
+		Test_amoxor_w();
+		Test_amoand_w();
+		Test_amoor_w();
+		Test_amomin_w();
+		Test_amomax_w();
+		Test_amominu_w();
+		Test_amomaxu_w();
 		Test_li();
 	}
 	catch (std::runtime_error& e)
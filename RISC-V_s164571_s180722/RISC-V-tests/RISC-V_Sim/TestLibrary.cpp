@@ -0,0 +1,195 @@
+#include "TestLibrary.h"
+#include <cstdint>
+#include <stdexcept>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <thread>
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "RISCVSimAPI.h"
+
+static void Success(const std::string& testName)
+{
+	std::cout << "Test Success: " << testName << std::endl;
+}
+
+//counts t0 up to count, which fits in an immediate, and stores it at address 0x100
+static std::vector<uint32_t> CountingProgram(const uint32_t count)
+{
+	return
+	{
+		Create_addi(Regs::t1, Regs::x0, count),
+		Create_addi(Regs::t0, Regs::t0, 1),
+		Create_bne(Regs::t0, Regs::t1, static_cast<uint32_t>(-4)),
+		Create_sw(Regs::x0, Regs::t0, 0x100),
+		Create_addi(Regs::a0, Regs::x0, 10),
+		Create_ecall()
+	};
+}
+
+static uint32_t ReadRegister(const rvsim* sim, const Regs reg)
+{
+	uint32_t registers[32];
+	rvsim_read_registers(sim, registers);
+	return registers[static_cast<uint32_t>(reg)];
+}
+
+static void ExpectStatus(const rvsim* sim, const rvsim_status actual, const rvsim_status expected, const std::string& what)
+{
+	if (actual != expected)
+	{
+		throw std::runtime_error(what + " returned " + std::to_string(actual) + " instead of " + std::to_string(expected) +
+			".\nError: " + rvsim_last_error(sim) + "\n");
+	}
+}
+
+//the program is run in small slices, the result has to be the same
+//as running it in one go. A slice ends at the first branch after
+//its budget, which is at most one loop iteration later
+static void Test_LibraryBudget()
+{
+	const std::vector<uint32_t> program = CountingProgram(1000);
+	//1 for the limit, 2 per iteration and 3 at the end
+	const uint64_t expectedInstructions = 1 + 2 * 1000 + 3;
+
+	rvsim* const sim = rvsim_create(0);
+	ExpectStatus(sim, rvsim_load(sim, program.data(), program.size()), RVSIM_OK, "rvsim_load");
+
+	uint32_t slices = 0;
+	uint64_t sliceStart = 0;
+	rvsim_status status;
+	while ((status = rvsim_run(sim, 100)) == RVSIM_BUDGET_EXHAUSTED)
+	{
+		slices++;
+		const uint64_t executed = rvsim_instructions_executed(sim);
+		if (executed - sliceStart < 100 || executed - sliceStart > 100 + 1)
+		{
+			rvsim_destroy(sim);
+			throw std::runtime_error("Budget wasn't kept.\nExecuted: " + std::to_string(executed) + "\n");
+		}
+		sliceStart = executed;
+	}
+	ExpectStatus(sim, status, RVSIM_EXITED, "rvsim_run");
+
+	uint32_t stored = 0;
+	ExpectStatus(sim, rvsim_read_memory(sim, 0x100, &stored, sizeof(stored)), RVSIM_OK, "rvsim_read_memory");
+	const uint64_t executed = rvsim_instructions_executed(sim);
+	const uint32_t counter = ReadRegister(sim, Regs::t0);
+	rvsim_destroy(sim);
+
+	if (executed != expectedInstructions || counter != 1000 || stored != 1000 || slices < 19 || slices > 20)
+	{
+		throw std::runtime_error("Incorrect result of sliced run.\nExecuted: " + std::to_string(executed) +
+			"\nt0: " + std::to_string(counter) + "\nStored: " + std::to_string(stored) + "\n");
+	}
+
+	Success("test_library_budget");
+}
+
+static void Test_LibraryBreakpoint()
+{
+	const std::vector<uint32_t> program =
+	{
+		Create_addi(Regs::a1, Regs::x0, 1),
+		Create_ebreak(),
+		Create_addi(Regs::a1, Regs::a1, 1),
+		Create_addi(Regs::a0, Regs::x0, 10),
+		Create_ecall()
+	};
+
+	rvsim* const sim = rvsim_create(0);
+	ExpectStatus(sim, rvsim_load(sim, program.data(), program.size()), RVSIM_OK, "rvsim_load");
+	ExpectStatus(sim, rvsim_run(sim, UINT64_MAX), RVSIM_BREAKPOINT, "rvsim_run");
+	const uint32_t atBreakpoint = ReadRegister(sim, Regs::a1);
+	ExpectStatus(sim, rvsim_run(sim, UINT64_MAX), RVSIM_EXITED, "rvsim_run");
+	const uint32_t atExit = ReadRegister(sim, Regs::a1);
+
+	uint32_t cause;
+	uint32_t value;
+	//running off the end of the program is an instruction access fault
+	const uint32_t noExit[] = { Create_addi(Regs::a1, Regs::x0, 1) };
+	ExpectStatus(sim, rvsim_load(sim, noExit, 1), RVSIM_OK, "rvsim_load");
+	ExpectStatus(sim, rvsim_run(sim, UINT64_MAX), RVSIM_TRAP, "rvsim_run");
+	rvsim_read_trap(sim, &cause, &value);
+	if (cause != 1 || value != 4)
+	{
+		rvsim_destroy(sim);
+		throw std::runtime_error("Incorrect trap after the end of the program.\nCause: " + std::to_string(cause) + "\nValue: " + std::to_string(value) + "\n");
+	}
+
+	//and reading a csr that doesn't exist without a trap handler stops with a trap
+	const uint32_t illegal[] = { Create_addi(Regs::a1, Regs::x0, 1), Create_csrrs(Regs::a1, Regs::x0, 0x7ff) };
+	ExpectStatus(sim, rvsim_load(sim, illegal, 2), RVSIM_OK, "rvsim_load");
+	ExpectStatus(sim, rvsim_run(sim, UINT64_MAX), RVSIM_TRAP, "rvsim_run");
+	rvsim_read_trap(sim, &cause, &value);
+	const uint32_t trapPC = rvsim_read_pc(sim);
+	rvsim_destroy(sim);
+	if (cause != 2 || value != 0 || trapPC != 4)
+	{
+		throw std::runtime_error("Incorrect trap.\nCause: " + std::to_string(cause) + "\nValue: " + std::to_string(value) + "\n");
+	}
+
+	if (atBreakpoint != 1 || atExit != 2)
+	{
+		throw std::runtime_error("Incorrect result around ebreak.\na1 at ebreak: " + std::to_string(atBreakpoint) +
+			"\na1 at exit: " + std::to_string(atExit) + "\n");
+	}
+
+	Success("test_library_breakpoint");
+}
+
+//simulators share nothing so they can run on their own threads
+static void Test_LibraryConcurrent()
+{
+	const uint32_t threadCount = 4;
+	std::vector<uint32_t> results(threadCount, 0);
+	std::vector<std::thread> threads;
+	for (uint32_t i = 0; i < threadCount; i++)
+	{
+		threads.emplace_back([i, &results]()
+		{
+			const std::vector<uint32_t> program = CountingProgram(500 * (i + 1));
+			rvsim* const sim = rvsim_create(0);
+			rvsim_load(sim, program.data(), program.size());
+			while (rvsim_run(sim, 777) == RVSIM_BUDGET_EXHAUSTED)
+			{
+			}
+			rvsim_read_memory(sim, 0x100, &results[i], sizeof(uint32_t));
+			rvsim_destroy(sim);
+		});
+	}
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+
+	for (uint32_t i = 0; i < threadCount; i++)
+	{
+		if (results[i] != 500 * (i + 1))
+		{
+			throw std::runtime_error("Incorrect result of concurrent simulator " + std::to_string(i) +
+				".\nStored: " + std::to_string(results[i]) + "\n");
+		}
+	}
+
+	Success("test_library_concurrent");
+}
+
+void TestLibrary()
+{
+	try
+	{
+		Test_LibraryBudget();
+		Test_LibraryBreakpoint();
+		Test_LibraryConcurrent();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all library tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all library tests\n" << std::endl;
+}
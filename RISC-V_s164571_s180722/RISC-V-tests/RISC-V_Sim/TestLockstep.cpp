@@ -0,0 +1,217 @@
+#include "TestLockstep.h"
+#include <cstdint>
+#include <stdexcept>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "Processor.h"
+#include "LockstepEngine.h"
+
+static void Success(const std::string& testName)
+{
+	std::cout << "Test Success: " << testName << std::endl;
+}
+
+//mixes a1 a2 times. Which way the branches go depends on a1 so the
+//lanes split up and join again, and lanes with a smaller a2 exit
+//while the others are still looping
+static std::vector<uint32_t> DivergingProgram()
+{
+	return
+	{
+		/*  0 */ Create_mul(Regs::t0, Regs::a1, Regs::a1),
+		/*  1 */ Create_srli(Regs::t1, Regs::t0, 7),
+		/*  2 */ Create_xor(Regs::a1, Regs::a1, Regs::t1),
+		/*  3 */ Create_addi(Regs::a1, Regs::a1, 0x35),
+		/*  4 */ Create_andi(Regs::t2, Regs::a1, 1),
+		/*  5 */ Create_beq(Regs::t2, Regs::x0, 12),
+		/*  6 */ Create_add(Regs::s0, Regs::s0, Regs::a1),
+		/*  7 */ Create_jal(Regs::x0, 8),
+		/*  8 */ Create_sub(Regs::s0, Regs::s0, Regs::a1),
+		/*  9 */ Create_sw(Regs::x0, Regs::a1, 256),
+		/* 10 */ Create_lw(Regs::t3, Regs::x0, 256),
+		/* 11 */ Create_lb(Regs::t4, Regs::x0, 257),
+		/* 12 */ Create_lhu(Regs::t5, Regs::x0, 258),
+		/* 13 */ Create_add(Regs::s1, Regs::t3, Regs::t4),
+		/* 14 */ Create_add(Regs::s1, Regs::s1, Regs::t5),
+		//t2 is 0 in half of the iterations
+		/* 15 */ Create_div(Regs::s2, Regs::s0, Regs::t2),
+		/* 16 */ Create_rem(Regs::s3, Regs::s0, Regs::t2),
+		/* 17 */ Create_divu(Regs::s4, Regs::s0, Regs::a1),
+		/* 18 */ Create_remu(Regs::s5, Regs::a1, Regs::t1),
+		/* 19 */ Create_mulh(Regs::s6, Regs::s0, Regs::a1),
+		/* 20 */ Create_mulhu(Regs::s7, Regs::s0, Regs::a1),
+		/* 21 */ Create_mulhsu(Regs::s8, Regs::a1, Regs::s0),
+		/* 22 */ Create_sra(Regs::s9, Regs::s0, Regs::a1),
+		/* 23 */ Create_sll(Regs::s10, Regs::a1, Regs::s0),
+		/* 24 */ Create_slt(Regs::s11, Regs::s0, Regs::a1),
+		/* 25 */ Create_sltu(Regs::t6, Regs::s0, Regs::a1),
+		/* 26 */ Create_slti(Regs::a3, Regs::s0, static_cast<uint32_t>(-5)),
+		/* 27 */ Create_sltiu(Regs::a4, Regs::a1, 100),
+		/* 28 */ Create_jal(Regs::ra, 20),
+		/* 29 */ Create_addi(Regs::a2, Regs::a2, static_cast<uint32_t>(-1)),
+		/* 30 */ Create_blt(Regs::x0, Regs::a2, static_cast<uint32_t>(-120)),
+		/* 31 */ Create_addi(Regs::a0, Regs::x0, 10),
+		/* 32 */ Create_ecall(),
+		/* 33 */ Create_xori(Regs::a5, Regs::a1, 0x5a5),
+		/* 34 */ Create_srai(Regs::a6, Regs::s0, 3),
+		/* 35 */ Create_bgeu(Regs::a5, Regs::a6, 8),
+		/* 36 */ Create_or(Regs::a7, Regs::a7, Regs::a5),
+		/* 37 */ Create_and(Regs::a6, Regs::a6, Regs::a5),
+		/* 38 */ Create_slli(Regs::a7, Regs::a7, 1),
+		/* 39 */ Create_auipc(Regs::t0, 1),
+		/* 40 */ Create_lui(Regs::t1, 0x12345),
+		/* 41 */ Create_sh(Regs::x0, Regs::a1, 260),
+		/* 42 */ Create_sb(Regs::x0, Regs::s0, 263),
+		/* 43 */ Create_lbu(Regs::a3, Regs::x0, 263),
+		/* 44 */ Create_lh(Regs::a4, Regs::x0, 260),
+		/* 45 */ Create_add(Regs::s1, Regs::s1, Regs::a3),
+		/* 46 */ Create_jalr(Regs::x0, Regs::ra, 0)
+	};
+}
+
+static uint32_t LaneSeed(const uint32_t lane)
+{
+	return 0x9e37'79b9u * (lane + 1);
+}
+
+static uint32_t LaneIterations(const uint32_t lane)
+{
+	return 1 + (lane * 7) % 20;
+}
+
+//every lane has to end with the registers a processor
+//running the same program on its own ends with
+static void RunAndCompare(const uint32_t laneCount, const bool useAVX2)
+{
+	const std::vector<uint32_t> program = DivergingProgram();
+
+	LockstepEngine engine(laneCount, Processor::DefaultMemoryOptions().ramSize);
+	engine.SetUseAVX2(useAVX2);
+	engine.Load(program.data(), program.size());
+	for (uint32_t lane = 0; lane < laneCount; lane++)
+	{
+		engine.SetRegister(lane, static_cast<uint32_t>(Regs::a1), LaneSeed(lane));
+		engine.SetRegister(lane, static_cast<uint32_t>(Regs::a2), LaneIterations(lane));
+	}
+	engine.Run(1 << 20);
+
+	for (uint32_t lane = 0; lane < laneCount; lane++)
+	{
+		Processor processor;
+		processor.SetUseConsole(false);
+		processor.Load(program.data(), program.size());
+		processor.SetRegister(static_cast<uint32_t>(Regs::a1), LaneSeed(lane));
+		processor.SetRegister(static_cast<uint32_t>(Regs::a2), LaneIterations(lane));
+		if (processor.RunFor(UINT64_MAX) != RunStatus::Exited)
+		{
+			throw std::runtime_error("Reference processor didn't exit in lane " + std::to_string(lane) + "\n");
+		}
+
+		for (uint32_t i = 0; i < 32; i++)
+		{
+			if (engine.GetRegister(lane, i) != processor.GetRegister(i))
+			{
+				throw std::runtime_error("Lockstep register x" + std::to_string(i) + " in lane " + std::to_string(lane) +
+					" was " + std::to_string(engine.GetRegister(lane, i)) + " instead of " + std::to_string(processor.GetRegister(i)) +
+					".\nLanes: " + std::to_string(laneCount) + "\nAVX2: " + std::to_string(engine.IsUsingAVX2()) + "\n");
+			}
+		}
+	}
+
+	//the seeds send the lanes different ways so the lanes can't all be busy
+	const double utilization = engine.GetLaneUtilization();
+	if (laneCount > 1 && (engine.GetStatistics().divergences == 0 || utilization <= 0.0 || utilization >= 1.0))
+	{
+		throw std::runtime_error("Incorrect lockstep statistics.\nDivergences: " + std::to_string(engine.GetStatistics().divergences) +
+			"\nUtilization: " + std::to_string(utilization) + "\n");
+	}
+}
+
+static void Test_LockstepMatchesProcessor()
+{
+	for (const uint32_t laneCount : { 1u, 5u, 8u, 16u })
+	{
+		RunAndCompare(laneCount, false);
+		if (LockstepEngine::IsAVX2Supported())
+		{
+			RunAndCompare(laneCount, true);
+		}
+	}
+
+	Success("test_lockstep_matches_processor");
+}
+
+static void Test_LockstepErrors()
+{
+	bool caught = false;
+	try
+	{
+		LockstepEngine engine(LockstepEngine::MAX_LANES + 1, Processor::DefaultMemoryOptions().ramSize);
+	}
+	catch (std::runtime_error&)
+	{
+		caught = true;
+	}
+	if (!caught)
+	{
+		throw std::runtime_error("Too many lanes were accepted\n");
+	}
+
+	//loads are bounds checked in every lane on its own
+	const uint32_t outOfRange[] = { Create_lw(Regs::t0, Regs::a1, 0), Create_addi(Regs::a0, Regs::x0, 10), Create_ecall() };
+	LockstepEngine engine(4, Processor::DefaultMemoryOptions().ramSize);
+	engine.Load(outOfRange, 3);
+	engine.SetRegister(3, static_cast<uint32_t>(Regs::a1), 0x10'00'00);
+	caught = false;
+	try
+	{
+		engine.Run(1000);
+	}
+	catch (std::runtime_error& e)
+	{
+		caught = std::string(e.what()).find("lane 3") != std::string::npos;
+	}
+	if (!caught)
+	{
+		throw std::runtime_error("Out of range load in lane 3 wasn't caught\n");
+	}
+
+	//a program that never exits runs into the limit
+	const uint32_t endless[] = { Create_jal(Regs::x0, 0) };
+	engine.Load(endless, 1);
+	caught = false;
+	try
+	{
+		engine.Run(1000);
+	}
+	catch (std::runtime_error&)
+	{
+		caught = true;
+	}
+	if (!caught)
+	{
+		throw std::runtime_error("Endless program didn't hit the limit\n");
+	}
+
+	Success("test_lockstep_errors");
+}
+
+void TestLockstep()
+{
+	try
+	{
+		Test_LockstepMatchesProcessor();
+		Test_LockstepErrors();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all lockstep tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all lockstep tests\n" << std::endl;
+}
@@ -3,11 +3,22 @@
 #include <array>
 #include <memory>
 #include <string>
+#include <stdexcept>
+#include <iostream>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <vector>
 #include "InstructionType.h"
 #include "Register.h"
 #include "TSrandom.h"
 #include "InstructionEncode.h"
 #include "RISCV_Program.h"
+#include "CSR.h"
+#include "WorkStealingPool.h"
+
+//the seed of the random tests saved with the instruction tests
+static const uint64_t RANDOM_TESTS_SEED = 236432356;
 
 static const std::array<InstructionType, 29> ArithmeticInstructions = 
 {
@@ -147,17 +158,17 @@ static uint32_t RandomizeInstruction(const InstructionType type, FRandom::TCRand
 		case InstructionType::ebreak:
 			return Create_ebreak();
 		case InstructionType::csrrw:
-			return Create_csrrw();
+			return Create_csrrw(rs1, rs2, static_cast<uint32_t>(CSR::mscratch));
 		case InstructionType::csrrs:
-			return Create_csrrs();
+			return Create_csrrs(rs1, rs2, static_cast<uint32_t>(CSR::mscratch));
 		case InstructionType::csrrc:
-			return Create_csrrc();
+			return Create_csrrc(rs1, rs2, static_cast<uint32_t>(CSR::mscratch));
 		case InstructionType::csrrwi:
-			return Create_csrrwi();
+			return Create_csrrwi(rs1, immediate5Bits, static_cast<uint32_t>(CSR::mscratch));
 		case InstructionType::csrrsi:
-			return Create_csrrsi();
+			return Create_csrrsi(rs1, immediate5Bits, static_cast<uint32_t>(CSR::mscratch));
 		case InstructionType::csrrci:
-			return Create_csrrci();
+			return Create_csrrci(rs1, immediate5Bits, static_cast<uint32_t>(CSR::mscratch));
 		case InstructionType::mul:
 			return Create_mul(rs1, rs2, rs3);
 		case InstructionType::mulh:
@@ -179,11 +190,13 @@ static uint32_t RandomizeInstruction(const InstructionType type, FRandom::TCRand
 	}
 }
 
+//the program only depends on the seed and the test id
 template<uint32_t ArraySize>
-static std::unique_ptr<RISCV_Program> CreateRandomProgram(const std::array<InstructionType, ArraySize>& instructionTypes, size_t size)
+static std::unique_ptr<RISCV_Program> CreateRandomProgram(const std::array<InstructionType, ArraySize>& instructionTypes, size_t size,
+	const uint64_t seed, const uint64_t testId)
 {
 	auto program = std::make_unique<RISCV_Program>("Program size: " + std::to_string(size));
-	FRandom::TCRandom random = FRandom::GetTCRandom();
+	FRandom::TCRandom random = FRandom::SeedTCRandom(seed, testId);
 
 	for (uint32_t i = 0; i < 32; i++)
 	{
@@ -204,26 +217,117 @@ static std::unique_ptr<RISCV_Program> CreateRandomProgram(const std::array<Instr
 }
 
 template<uint32_t ArraySize>
-void CreateAndSaveTest(const std::array<InstructionType, ArraySize>& instructionTypes, const size_t size, const std::string& filepath)
+void CreateAndSaveTest(const std::array<InstructionType, ArraySize>& instructionTypes, const size_t size, const std::string& filepath,
+	const uint64_t seed, const uint64_t testId)
 {
-	auto program = CreateRandomProgram<ArraySize>(instructionTypes, size);
+	auto program = CreateRandomProgram<ArraySize>(instructionTypes, size, seed, testId);
 	program->Run();
 	program->ActualToExpectedRegisters();
 	program->Save(filepath);
 }
 
+void GenerateRandomTests(const std::string& prefix, const uint32_t count, const size_t size, const uint64_t seed, const uint32_t threadCount)
+{
+	std::mutex errorLock;
+	std::string firstError;
+	{
+		WorkStealingPool pool(threadCount);
+		for (uint32_t i = 0; i < count; i++)
+		{
+			pool.Submit([&, i]()
+			{
+				try
+				{
+					CreateAndSaveTest<29>(ArithmeticInstructions, size, prefix + std::to_string(i), seed, i);
+				}
+				catch (const std::runtime_error& e)
+				{
+					std::lock_guard<std::mutex> guard(errorLock);
+					if (firstError.empty())
+					{
+						firstError = "Test " + std::to_string(i) + ": " + e.what();
+					}
+				}
+			});
+		}
+		pool.Wait();
+	}
+	if (!firstError.empty())
+	{
+		throw std::runtime_error(firstError);
+	}
+}
+
+static std::string ReadWholeFile(const std::string& filepath)
+{
+	std::ifstream file(filepath, std::ios::binary);
+	if (!file)
+	{
+		throw std::runtime_error("Failed to open " + filepath);
+	}
+	return std::string(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+//the files have to be the same whether the tests were
+//created on one thread or spread over several
+static void Test_RandomTestsReproducible()
+{
+	const uint32_t count = 6;
+	const std::string onePrefix = "test_random_one_thread";
+	const std::string manyPrefix = "test_random_many_threads";
+	GenerateRandomTests(onePrefix, count, 500, RANDOM_TESTS_SEED, 1);
+	GenerateRandomTests(manyPrefix, count, 500, RANDOM_TESTS_SEED, 3);
+
+	std::string error;
+	for (uint32_t i = 0; i < count; i++)
+	{
+		for (const std::string extension : { ".bin", ".res", ".s" })
+		{
+			const std::string one = onePrefix + std::to_string(i) + extension;
+			const std::string many = manyPrefix + std::to_string(i) + extension;
+			if (error.empty() && ReadWholeFile(one) != ReadWholeFile(many))
+			{
+				error = "Random test " + one + " was different when created on several threads.";
+			}
+			std::remove(one.c_str());
+			std::remove(many.c_str());
+		}
+	}
+	if (error.empty() && ReadWholeFile("InstructionTests/test_random1.bin") == ReadWholeFile("InstructionTests/test_random2.bin"))
+	{
+		error = "Random tests with different ids were the same.";
+	}
+	if (!error.empty())
+	{
+		throw std::runtime_error(error);
+	}
+}
+
 void TestRandomArithmeticInstructions()
 {
-	CreateAndSaveTest<29>(ArithmeticInstructions, 10, "InstructionTests/test_random1");
-	CreateAndSaveTest<29>(ArithmeticInstructions, 10, "InstructionTests/test_random2");
-	CreateAndSaveTest<29>(ArithmeticInstructions, 10, "InstructionTests/test_random3");
-	CreateAndSaveTest<29>(ArithmeticInstructions, 10, "InstructionTests/test_random4");
-	CreateAndSaveTest<29>(ArithmeticInstructions, 10, "InstructionTests/test_random5");
-
-	CreateAndSaveTest<29>(ArithmeticInstructions, 100, "InstructionTests/test_random6");
-	CreateAndSaveTest<29>(ArithmeticInstructions, 100, "InstructionTests/test_random7");
-	CreateAndSaveTest<29>(ArithmeticInstructions, 100, "InstructionTests/test_random8");
-
-	CreateAndSaveTest<29>(ArithmeticInstructions, 10000, "InstructionTests/test_random9");
-	CreateAndSaveTest<29>(ArithmeticInstructions, 10000, "InstructionTests/test_random10");
+	CreateAndSaveTest<29>(ArithmeticInstructions, 10, "InstructionTests/test_random1", RANDOM_TESTS_SEED, 1);
+	CreateAndSaveTest<29>(ArithmeticInstructions, 10, "InstructionTests/test_random2", RANDOM_TESTS_SEED, 2);
+	CreateAndSaveTest<29>(ArithmeticInstructions, 10, "InstructionTests/test_random3", RANDOM_TESTS_SEED, 3);
+	CreateAndSaveTest<29>(ArithmeticInstructions, 10, "InstructionTests/test_random4", RANDOM_TESTS_SEED, 4);
+	CreateAndSaveTest<29>(ArithmeticInstructions, 10, "InstructionTests/test_random5", RANDOM_TESTS_SEED, 5);
+
+	CreateAndSaveTest<29>(ArithmeticInstructions, 100, "InstructionTests/test_random6", RANDOM_TESTS_SEED, 6);
+	CreateAndSaveTest<29>(ArithmeticInstructions, 100, "InstructionTests/test_random7", RANDOM_TESTS_SEED, 7);
+	CreateAndSaveTest<29>(ArithmeticInstructions, 100, "InstructionTests/test_random8", RANDOM_TESTS_SEED, 8);
+
+	CreateAndSaveTest<29>(ArithmeticInstructions, 10000, "InstructionTests/test_random9", RANDOM_TESTS_SEED, 9);
+	CreateAndSaveTest<29>(ArithmeticInstructions, 10000, "InstructionTests/test_random10", RANDOM_TESTS_SEED, 10);
+
+	try
+	{
+		Test_RandomTestsReproducible();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all random instruction tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all random instruction tests\n" << std::endl;
 }
\ No newline at end of file
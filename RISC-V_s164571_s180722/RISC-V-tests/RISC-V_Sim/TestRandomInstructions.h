@@ -1,3 +1,12 @@
 #pragma once
 
-void TestRandomArithmeticInstructions();
\ No newline at end of file
+#include <cstdint>
+#include <string>
+
+void TestRandomArithmeticInstructions();
+
+//creates count random arithmetic programs of size instructions, with
+//their expected registers, as <prefix><n>.bin/.res/.s spread over a
+//pool of threadCount threads, 0 for one per core. Program n only
+//depends on seed and n, so the files are the same for any thread count
+void GenerateRandomTests(const std::string& prefix, const uint32_t count, const size_t size, const uint64_t seed, const uint32_t threadCount);
@@ -0,0 +1,599 @@
+#include "TestSMP.h"
+#include <cstdint>
+#include <stdexcept>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <memory>
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "CSR.h"
+#include "SMPSystem.h"
+#include "CLINT.h"
+#include "Device.h"
+
+static void Success(const std::string& testName)
+{
+	std::cout << "Test Success: " << testName << std::endl;
+}
+
+static const RunLimits TEST_LIMITS = { 1ull << 32, 30.0 };
+static const uint32_t MHARTID = static_cast<uint32_t>(CSR::mhartid);
+
+static uint32_t ReadWord(SMPSystem& system, const uint32_t address)
+{
+	uint8_t bytes[4];
+	system.ReadPhysicalMemory(address, bytes, 4);
+	return bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | (static_cast<uint32_t>(bytes[3]) << 24);
+}
+
+static void ExpectExited(const std::vector<RunStatus>& statuses)
+{
+	for (uint32_t i = 0; i < statuses.size(); i++)
+	{
+		if (statuses[i] != RunStatus::Exited)
+		{
+			throw std::runtime_error("Hart " + std::to_string(i) + " didn't exit.\n");
+		}
+	}
+}
+
+//every hart sums 1 to (mhartid + 1) * 128 and stores
+//the sum at its own word of the shared memory
+static void Test_SMPHartIds()
+{
+	const uint32_t program[] =
+	{
+		Create_csrrs(Regs::t0, Regs::x0, MHARTID),
+		Create_addi(Regs::t1, Regs::t0, 1),
+		Create_slli(Regs::t1, Regs::t1, 7),
+		Create_addi(Regs::t2, Regs::x0, 0),
+		Create_add(Regs::t2, Regs::t2, Regs::t1),
+		Create_addi(Regs::t1, Regs::t1, static_cast<uint32_t>(-1)),
+		Create_bne(Regs::t1, Regs::x0, static_cast<uint32_t>(-8)),
+		Create_slli(Regs::t3, Regs::t0, 2),
+		Create_sw(Regs::t3, Regs::t2, 0x100),
+		Create_addi(Regs::a0, Regs::x0, 10),
+		Create_ecall()
+	};
+
+	const uint32_t hartCount = 4;
+	SMPSystem system(hartCount, Processor::DefaultMemoryOptions());
+	system.Load(program, sizeof(program) / sizeof(uint32_t));
+	ExpectExited(system.Run(TEST_LIMITS));
+
+	const uint32_t stackTop = system.GetHart(0).GetRegister(static_cast<uint32_t>(Regs::sp));
+	for (uint32_t i = 0; i < hartCount; i++)
+	{
+		const uint32_t n = (i + 1) * 128;
+		const uint32_t stored = ReadWord(system, 0x100 + i * 4);
+		Processor& hart = system.GetHart(i);
+		if (stored != n * (n + 1) / 2 || hart.GetRegister(static_cast<uint32_t>(Regs::t0)) != i)
+		{
+			throw std::runtime_error("Incorrect result of hart " + std::to_string(i) + ".\nStored: " + std::to_string(stored) + "\n");
+		}
+		if (hart.GetRegister(static_cast<uint32_t>(Regs::sp)) != stackTop - i * SMPSystem::DEFAULT_STACK_SIZE)
+		{
+			throw std::runtime_error("Hart " + std::to_string(i) + " doesn't have its own stack.\n");
+		}
+	}
+
+	Success("test_smp_hart_ids");
+}
+
+//hart 0 writes the data and then the flag with a fence in between,
+//the others wait for the flag and have to see the data after it
+static void Test_SMPMessagePassing()
+{
+	const uint32_t program[] =
+	{
+		/*  0 */ Create_csrrs(Regs::t0, Regs::x0, MHARTID),
+		/*  1 */ Create_bne(Regs::t0, Regs::x0, 28),
+		/*  2 */ Create_addi(Regs::t1, Regs::x0, 42),
+		/*  3 */ Create_sw(Regs::x0, Regs::t1, 0x200),
+		/*  4 */ Create_fence(),
+		/*  5 */ Create_addi(Regs::t2, Regs::x0, 1),
+		/*  6 */ Create_sw(Regs::x0, Regs::t2, 0x204),
+		/*  7 */ Create_jal(Regs::x0, 20),
+		/*  8 */ Create_lw(Regs::t2, Regs::x0, 0x204),
+		/*  9 */ Create_beq(Regs::t2, Regs::x0, static_cast<uint32_t>(-4)),
+		/* 10 */ Create_fence(),
+		/* 11 */ Create_lw(Regs::a1, Regs::x0, 0x200),
+		/* 12 */ Create_addi(Regs::a0, Regs::x0, 10),
+		/* 13 */ Create_ecall()
+	};
+
+	const uint32_t hartCount = 3;
+	SMPSystem system(hartCount, Processor::DefaultMemoryOptions());
+	system.Load(program, sizeof(program) / sizeof(uint32_t));
+	ExpectExited(system.Run(TEST_LIMITS));
+
+	for (uint32_t i = 1; i < hartCount; i++)
+	{
+		const uint32_t received = system.GetHart(i).GetRegister(static_cast<uint32_t>(Regs::a1));
+		if (received != 42)
+		{
+			throw std::runtime_error("Hart " + std::to_string(i) + " read " + std::to_string(received) + " after the flag.\n");
+		}
+	}
+
+	Success("test_smp_message_passing");
+}
+
+//every hart adds to one counter with amoadd.w and to another
+//with plain loads and stores inside a lock taken with lr.w/sc.w
+static void Test_SMPAtomics()
+{
+	const uint32_t iterations = 2000;
+	const uint32_t program[] =
+	{
+		/*  0 */ Create_addi(Regs::t0, Regs::x0, 0x300),
+		/*  1 */ Create_addi(Regs::t1, Regs::x0, 1),
+		/*  2 */ Create_addi(Regs::a2, Regs::x0, iterations),
+		/*  3 */ Create_amoadd_w(Regs::x0, Regs::t0, Regs::t1, AtomicOrdering::None),
+		/*  4 */ Create_addi(Regs::a2, Regs::a2, static_cast<uint32_t>(-1)),
+		/*  5 */ Create_bne(Regs::a2, Regs::x0, static_cast<uint32_t>(-8)),
+		/*  6 */ Create_addi(Regs::a2, Regs::x0, iterations),
+		/*  7 */ Create_addi(Regs::t2, Regs::x0, 0x304),
+		/*  8 */ Create_lr_w(Regs::t3, Regs::t2, AtomicOrdering::Acquire),
+		/*  9 */ Create_bne(Regs::t3, Regs::x0, static_cast<uint32_t>(-4)),
+		/* 10 */ Create_sc_w(Regs::t4, Regs::t2, Regs::t1, AtomicOrdering::Acquire),
+		/* 11 */ Create_bne(Regs::t4, Regs::x0, static_cast<uint32_t>(-12)),
+		/* 12 */ Create_lw(Regs::t5, Regs::t2, 4),
+		/* 13 */ Create_addi(Regs::t5, Regs::t5, 1),
+		/* 14 */ Create_sw(Regs::t2, Regs::t5, 4),
+		/* 15 */ Create_amoswap_w(Regs::x0, Regs::t2, Regs::x0, AtomicOrdering::Release),
+		/* 16 */ Create_addi(Regs::a2, Regs::a2, static_cast<uint32_t>(-1)),
+		/* 17 */ Create_bne(Regs::a2, Regs::x0, static_cast<uint32_t>(-36)),
+		/* 18 */ Create_addi(Regs::a0, Regs::x0, 10),
+		/* 19 */ Create_ecall()
+	};
+
+	const uint32_t hartCount = 3;
+	SMPSystem system(hartCount, Processor::DefaultMemoryOptions());
+	for (const bool watched : { false, true })
+	{
+		//a watchpoint nothing writes to on the page of the counters,
+		//which must not make the atomics any less atomic
+		if (watched)
+		{
+			system.GetHart(0).AddWatchpoint({ 0x3f0, 4, WatchType::Write });
+		}
+		system.Load(program, sizeof(program) / sizeof(uint32_t));
+		ExpectExited(system.Run(TEST_LIMITS));
+
+		const uint32_t atomicCounter = ReadWord(system, 0x300);
+		const uint32_t lock = ReadWord(system, 0x304);
+		const uint32_t lockedCounter = ReadWord(system, 0x308);
+		if (atomicCounter != hartCount * iterations || lockedCounter != hartCount * iterations || lock != 0)
+		{
+			throw std::runtime_error("Incorrect counters" + std::string(watched ? " with a watchpoint" : "") + ".\namoadd.w: " +
+				std::to_string(atomicCounter) + "\nLocked: " + std::to_string(lockedCounter) + "\nLock: " + std::to_string(lock) + "\n");
+		}
+	}
+
+	//atomics have to be aligned even though other accesses don't
+	const uint32_t misaligned[] = { Create_addi(Regs::t0, Regs::x0, 0x302), Create_amoadd_w(Regs::t1, Regs::t0, Regs::t0, AtomicOrdering::None) };
+	Processor processor;
+	processor.Load(misaligned, 2);
+	const RunStatus status = processor.RunFor(UINT64_MAX);
+	if (status != RunStatus::Trap || processor.GetUnhandledTrap().cause != TrapCause::StoreAddressMisaligned || processor.GetUnhandledTrap().value != 0x302)
+	{
+		throw std::runtime_error("Misaligned amoadd.w didn't trap.\n");
+	}
+
+	Success("test_smp_atomics");
+}
+
+//every hart takes the next slot of a log with amoadd.w and writes its
+//id into it, so the log shows the order in which the harts took turns
+static const uint32_t LOG_ITERATIONS = 50;
+static const uint32_t LOG_ADDRESS = 0x400;
+static const uint32_t LOG_PROGRAM[] =
+{
+	/*  0 */ Create_csrrs(Regs::t0, Regs::x0, MHARTID),
+	/*  1 */ Create_addi(Regs::a2, Regs::x0, LOG_ITERATIONS),
+	/*  2 */ Create_addi(Regs::t1, Regs::x0, 1),
+	/*  3 */ Create_addi(Regs::t2, Regs::x0, LOG_ADDRESS),
+	/*  4 */ Create_amoadd_w(Regs::t3, Regs::t2, Regs::t1, AtomicOrdering::None),
+	/*  5 */ Create_slli(Regs::t3, Regs::t3, 2),
+	/*  6 */ Create_add(Regs::t3, Regs::t3, Regs::t2),
+	/*  7 */ Create_sw(Regs::t3, Regs::t0, 4),
+	/*  8 */ Create_lw(Regs::t4, Regs::x0, LOG_ADDRESS - 4),
+	/*  9 */ Create_add(Regs::t4, Regs::t4, Regs::t3),
+	/* 10 */ Create_sw(Regs::x0, Regs::t4, LOG_ADDRESS - 4),
+	/* 11 */ Create_addi(Regs::a2, Regs::a2, static_cast<uint32_t>(-1)),
+	/* 12 */ Create_bne(Regs::a2, Regs::x0, static_cast<uint32_t>(-32)),
+	/* 13 */ Create_addi(Regs::a0, Regs::x0, 10),
+	/* 14 */ Create_ecall()
+};
+
+//the log followed by the registers and instruction count of every hart
+static std::vector<uint32_t> RunLogProgram(const uint32_t hartCount, const uint64_t quantum)
+{
+	SMPSystem system(hartCount, Processor::DefaultMemoryOptions());
+	system.Load(LOG_PROGRAM, sizeof(LOG_PROGRAM) / sizeof(uint32_t));
+	ExpectExited(system.RunRoundRobin(TEST_LIMITS, quantum));
+
+	std::vector<uint32_t> state;
+	for (uint32_t i = 0; i <= hartCount * LOG_ITERATIONS + 1; i++)
+	{
+		state.push_back(ReadWord(system, LOG_ADDRESS - 4 + i * 4));
+	}
+	for (uint32_t i = 0; i < hartCount; i++)
+	{
+		for (uint32_t reg = 0; reg < 32; reg++)
+		{
+			state.push_back(system.GetHart(i).GetRegister(reg));
+		}
+		state.push_back(static_cast<uint32_t>(system.GetHart(i).GetInstructionsExecuted()));
+	}
+	return state;
+}
+
+static void Test_SMPRoundRobin()
+{
+	const uint32_t hartCount = 3;
+	//a turn ends at the first branch after the quantum, so with a quantum
+	//of 1 every turn is one iteration and the harts alternate
+	const std::vector<uint32_t> alternating = RunLogProgram(hartCount, 1);
+	//and with a large one every hart finishes before the next starts
+	const std::vector<uint32_t> sequential = RunLogProgram(hartCount, 1 << 20);
+	for (uint32_t i = 0; i < hartCount * LOG_ITERATIONS; i++)
+	{
+		if (alternating[i + 2] != i % hartCount || sequential[i + 2] != i / LOG_ITERATIONS)
+		{
+			throw std::runtime_error("Incorrect order of turns at log entry " + std::to_string(i) + ".\nQuantum 1: " +
+				std::to_string(alternating[i + 2]) + "\nLarge quantum: " + std::to_string(sequential[i + 2]) + "\n");
+		}
+	}
+
+	//the same quantum has to give exactly the same memory and harts
+	for (const uint64_t quantum : { 1ull, 7ull, 100ull })
+	{
+		if (RunLogProgram(hartCount, quantum) != RunLogProgram(hartCount, quantum))
+		{
+			throw std::runtime_error("Round robin run with quantum " + std::to_string(quantum) + " wasn't repeatable.\n");
+		}
+	}
+
+	//a hart spinning on a flag only holds up the others until its quantum ends
+	const uint32_t program[] =
+	{
+		/*  0 */ Create_csrrs(Regs::t0, Regs::x0, MHARTID),
+		/*  1 */ Create_beq(Regs::t0, Regs::x0, 12),
+		/*  2 */ Create_lw(Regs::t1, Regs::x0, 0x200),
+		/*  3 */ Create_beq(Regs::t1, Regs::x0, static_cast<uint32_t>(-4)),
+		/*  4 */ Create_addi(Regs::t2, Regs::x0, 1),
+		/*  5 */ Create_sw(Regs::x0, Regs::t2, 0x200),
+		/*  6 */ Create_addi(Regs::a0, Regs::x0, 10),
+		/*  7 */ Create_ecall()
+	};
+	SMPSystem system(4, Processor::DefaultMemoryOptions());
+	system.Load(program, sizeof(program) / sizeof(uint32_t));
+	ExpectExited(system.RunRoundRobin(TEST_LIMITS, 5));
+
+	bool caught = false;
+	try
+	{
+		system.RunRoundRobin(TEST_LIMITS, 0);
+	}
+	catch (const std::runtime_error&)
+	{
+		caught = true;
+	}
+	if (!caught)
+	{
+		throw std::runtime_error("A quantum of 0 was accepted.\n");
+	}
+
+	Success("test_smp_round_robin");
+}
+
+//hart 0 stores the data and then raises a software interrupt in every
+//other hart through the CLINT. The others wait for it in wfi, clear it
+//and read the data
+static std::vector<uint32_t> WakeUpProgram(const uint32_t hartCount)
+{
+	const uint32_t MIE = static_cast<uint32_t>(CSR::mie);
+	return
+	{
+		/*  0 */ Create_csrrs(Regs::t0, Regs::x0, MHARTID),
+		/*  1 */ Create_lui(Regs::t5, CLINT::DEFAULT_BASE >> 12),
+		/*  2 */ Create_slli(Regs::t6, Regs::t0, 2),
+		/*  3 */ Create_add(Regs::t6, Regs::t6, Regs::t5),
+		/*  4 */ Create_bne(Regs::t0, Regs::x0, 44),
+		/*  5 */ Create_addi(Regs::t1, Regs::x0, 1234),
+		/*  6 */ Create_sw(Regs::x0, Regs::t1, 0x200),
+		/*  7 */ Create_addi(Regs::t2, Regs::x0, 1),
+		/*  8 */ Create_addi(Regs::t4, Regs::t5, 4),
+		/*  9 */ Create_addi(Regs::t3, Regs::t5, hartCount * 4),
+		/* 10 */ Create_sw(Regs::t4, Regs::t2, 0),
+		/* 11 */ Create_addi(Regs::t4, Regs::t4, 4),
+		/* 12 */ Create_bne(Regs::t4, Regs::t3, static_cast<uint32_t>(-8)),
+		/* 13 */ Create_addi(Regs::a0, Regs::x0, 10),
+		/* 14 */ Create_ecall(),
+		/* 15 */ Create_addi(Regs::t1, Regs::x0, Interrupt::MSIP),
+		/* 16 */ Create_csrrs(Regs::x0, Regs::t1, MIE),
+		/* 17 */ Create_wfi(),
+		/* 18 */ Create_lw(Regs::t2, Regs::t6, 0),
+		/* 19 */ Create_beq(Regs::t2, Regs::x0, static_cast<uint32_t>(-8)),
+		/* 20 */ Create_sw(Regs::t6, Regs::x0, 0),
+		/* 21 */ Create_lw(Regs::a1, Regs::x0, 0x200),
+		/* 22 */ Create_addi(Regs::a0, Regs::x0, 10),
+		/* 23 */ Create_ecall()
+	};
+}
+
+static const uint32_t WAIT_FOREVER[] =
+{
+	Create_addi(Regs::t1, Regs::x0, Interrupt::MSIP),
+	Create_csrrs(Regs::x0, Regs::t1, static_cast<uint32_t>(CSR::mie)),
+	Create_wfi(),
+	Create_jal(Regs::x0, static_cast<uint32_t>(-4))
+};
+
+static void ExpectWokenUp(SMPSystem& system)
+{
+	for (uint32_t i = 1; i < system.GetHartCount(); i++)
+	{
+		const uint32_t received = system.GetHart(i).GetRegister(static_cast<uint32_t>(Regs::a1));
+		if (received != 1234 || system.GetHart(i).IsInterruptPending())
+		{
+			throw std::runtime_error("Hart " + std::to_string(i) + " read " + std::to_string(received) + " after waking up.\n");
+		}
+	}
+}
+
+static void Test_SMPWaitForInterrupt()
+{
+	//without a pending interrupt wfi stops the run after the wfi
+	const uint32_t single[] = { Create_wfi(), Create_addi(Regs::a0, Regs::x0, 10), Create_ecall() };
+	Processor processor;
+	processor.Load(single, 3);
+	if (processor.RunFor(UINT64_MAX) != RunStatus::WaitingForInterrupt || processor.GetPC() != 4 ||
+		processor.RunFor(UINT64_MAX) != RunStatus::Exited)
+	{
+		throw std::runtime_error("wfi didn't wait for an interrupt.\n");
+	}
+	//and with one it continues, even though interrupts aren't enabled in mstatus
+	const uint32_t enabled[] =
+	{
+		Create_addi(Regs::t1, Regs::x0, Interrupt::MSIP),
+		Create_csrrs(Regs::x0, Regs::t1, static_cast<uint32_t>(CSR::mie)),
+		Create_wfi(),
+		Create_csrrs(Regs::a1, Regs::x0, static_cast<uint32_t>(CSR::mip)),
+		Create_addi(Regs::a0, Regs::x0, 10),
+		Create_ecall()
+	};
+	processor.Load(enabled, 6);
+	processor.SetInterruptPending(Interrupt::MSIP, true);
+	if (processor.RunFor(UINT64_MAX) != RunStatus::Exited || processor.GetRegister(static_cast<uint32_t>(Regs::a1)) != Interrupt::MSIP)
+	{
+		throw std::runtime_error("wfi waited with an interrupt pending.\n");
+	}
+
+	const uint32_t hartCount = 6;
+	const std::vector<uint32_t> program = WakeUpProgram(hartCount);
+	SMPSystem system(hartCount, Processor::DefaultMemoryOptions());
+	system.Load(program.data(), program.size());
+	ExpectExited(system.Run(TEST_LIMITS));
+	ExpectWokenUp(system);
+	system.Load(program.data(), program.size());
+	ExpectExited(system.RunRoundRobin(TEST_LIMITS, 10));
+	ExpectWokenUp(system);
+
+	//nothing is left to wake up harts that all wait
+	system.Load(WAIT_FOREVER, sizeof(WAIT_FOREVER) / sizeof(uint32_t));
+	bool caught = false;
+	try
+	{
+		system.RunRoundRobin(TEST_LIMITS);
+	}
+	catch (const std::runtime_error&)
+	{
+		caught = true;
+	}
+	if (!caught)
+	{
+		throw std::runtime_error("Round robin run didn't stop when every hart was waiting.\n");
+	}
+	system.Load(WAIT_FOREVER, sizeof(WAIT_FOREVER) / sizeof(uint32_t));
+	std::string message;
+	try
+	{
+		system.Run(TEST_LIMITS);
+	}
+	catch (const std::runtime_error& e)
+	{
+		message = e.what();
+	}
+	if (message.find("waiting for an interrupt") == std::string::npos)
+	{
+		throw std::runtime_error("Threaded run didn't stop when every hart was waiting.\nMessage: " + message + "\n");
+	}
+
+	//hart 0 exits and leaves hart 1 waiting with no one to wake it up
+	const uint32_t oneWaits[] =
+	{
+		Create_csrrs(Regs::t0, Regs::x0, MHARTID),
+		Create_addi(Regs::a0, Regs::x0, 10),
+		Create_beq(Regs::t0, Regs::x0, 8),
+		Create_wfi(),
+		Create_ecall()
+	};
+	SMPSystem pair(2, Processor::DefaultMemoryOptions());
+	pair.Load(oneWaits, sizeof(oneWaits) / sizeof(uint32_t));
+	message.clear();
+	try
+	{
+		pair.Run(TEST_LIMITS);
+	}
+	catch (const std::runtime_error& e)
+	{
+		message = e.what();
+	}
+	if (message.find("waiting for an interrupt") == std::string::npos)
+	{
+		throw std::runtime_error("Threaded run didn't stop when the last running hart was waiting.\nMessage: " + message + "\n");
+	}
+
+	Success("test_smp_wait_for_interrupt");
+}
+
+//many more harts than workers, with most of them parked in wfi
+static void Test_SMPWorkers()
+{
+	const uint32_t hartCount = 32;
+	const std::vector<uint32_t> program = WakeUpProgram(hartCount);
+	SMPSystem system(hartCount, Processor::DefaultMemoryOptions(), 0x400);
+	const uint64_t slices[] = { 5, SMPSystem::DEFAULT_SLICE };
+	for (const uint32_t workerCount : { 1u, 3u, 0u })
+	{
+		for (const uint64_t slice : slices)
+		{
+			system.Load(program.data(), program.size());
+			ExpectExited(system.RunOnWorkers(TEST_LIMITS, workerCount, slice));
+			ExpectWokenUp(system);
+		}
+	}
+
+	//the harts have to get the same results as on their own threads
+	system.Load(LOG_PROGRAM, sizeof(LOG_PROGRAM) / sizeof(uint32_t));
+	ExpectExited(system.RunOnWorkers(TEST_LIMITS, 4, 7));
+	std::vector<uint32_t> entries(hartCount, 0);
+	for (uint32_t i = 0; i < hartCount * LOG_ITERATIONS; i++)
+	{
+		const uint32_t hartId = ReadWord(system, LOG_ADDRESS + 4 + i * 4);
+		if (hartId >= hartCount)
+		{
+			throw std::runtime_error("Log entry " + std::to_string(i) + " wasn't written.\n");
+		}
+		entries[hartId]++;
+	}
+	for (uint32_t i = 0; i < hartCount; i++)
+	{
+		if (entries[i] != LOG_ITERATIONS)
+		{
+			throw std::runtime_error("Hart " + std::to_string(i) + " wrote " + std::to_string(entries[i]) + " log entries.\n");
+		}
+	}
+
+	system.Load(WAIT_FOREVER, sizeof(WAIT_FOREVER) / sizeof(uint32_t));
+	bool caught = false;
+	try
+	{
+		system.RunOnWorkers(TEST_LIMITS, 2);
+	}
+	catch (const std::runtime_error&)
+	{
+		caught = true;
+	}
+	if (!caught)
+	{
+		throw std::runtime_error("Workers didn't stop when every hart was waiting.\n");
+	}
+
+	Success("test_smp_workers");
+}
+
+//a device every access of which fails, like a file that can't be written
+class FailingDevice : public Device
+{
+public:
+	uint32_t Read(const uint32_t offset, const uint32_t size) override
+	{
+		throw std::runtime_error("The device failed.");
+	}
+
+	void Write(const uint32_t offset, const uint32_t size, const uint32_t value) override
+	{
+		throw std::runtime_error("The device failed.");
+	}
+};
+
+//an error in one hart stops the ones that would run forever
+static void Test_SMPErrors()
+{
+	const uint32_t program[] =
+	{
+		Create_csrrs(Regs::t0, Regs::x0, MHARTID),
+		Create_bne(Regs::t0, Regs::x0, 8),
+		Create_jal(Regs::x0, 0),
+		Create_lui(Regs::t1, 0x7fff0),
+		Create_lw(Regs::t2, Regs::t1, 0),
+		Create_addi(Regs::a0, Regs::x0, 10),
+		Create_ecall()
+	};
+
+	SMPSystem system(2, Processor::DefaultMemoryOptions());
+	system.GetHart(0).AttachDevice(0x7f'ff'00'00, 0x1000, std::make_shared<FailingDevice>());
+	system.Load(program, sizeof(program) / sizeof(uint32_t));
+	std::string message;
+	try
+	{
+		system.Run(TEST_LIMITS);
+	}
+	catch (const std::runtime_error& e)
+	{
+		message = e.what();
+	}
+	if (message.find("Hart 1: ") != 0)
+	{
+		throw std::runtime_error("Failing hart wasn't reported.\nMessage: " + message + "\n");
+	}
+
+	system.Load(program, sizeof(program) / sizeof(uint32_t));
+	message.clear();
+	try
+	{
+		system.RunRoundRobin(TEST_LIMITS);
+	}
+	catch (const std::runtime_error& e)
+	{
+		message = e.what();
+	}
+	if (message.find("Hart 1: ") != 0)
+	{
+		throw std::runtime_error("Failing hart wasn't reported by the round robin run.\nMessage: " + message + "\n");
+	}
+
+	system.Load(program, sizeof(program) / sizeof(uint32_t));
+	message.clear();
+	try
+	{
+		system.RunOnWorkers(TEST_LIMITS, 2);
+	}
+	catch (const std::runtime_error& e)
+	{
+		message = e.what();
+	}
+	if (message.find("Hart 1: ") != 0)
+	{
+		throw std::runtime_error("Failing hart wasn't reported by the workers.\nMessage: " + message + "\n");
+	}
+
+	Success("test_smp_errors");
+}
+
+void TestSMP()
+{
+	try
+	{
+		Test_SMPHartIds();
+		Test_SMPMessagePassing();
+		Test_SMPAtomics();
+		Test_SMPRoundRobin();
+		Test_SMPWaitForInterrupt();
+		Test_SMPWorkers();
+		Test_SMPErrors();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all smp tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all smp tests\n" << std::endl;
+}
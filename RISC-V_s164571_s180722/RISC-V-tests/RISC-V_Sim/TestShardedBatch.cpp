@@ -0,0 +1,178 @@
+#include "TestShardedBatch.h"
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include "BatchRunner.h"
+#include "ShardedBatch.h"
+#ifndef _WIN32
+#include <dirent.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <utime.h>
+#endif
+
+static const std::string WORK_DIRECTORY = "test_shards.tmp";
+static const RunLimits NO_LIMITS = { UINT64_MAX, 0.0 };
+
+static void Success(const std::string& testName)
+{
+	std::cout << "Test Success: " << testName << std::endl;
+}
+
+#ifndef _WIN32
+
+static std::vector<std::string> ListFiles(const std::string& directory)
+{
+	std::vector<std::string> names;
+	if (DIR* const dir = opendir(directory.c_str()))
+	{
+		while (const dirent* entry = readdir(dir))
+		{
+			if (entry->d_name[0] != '.')
+			{
+				names.push_back(entry->d_name);
+			}
+		}
+		closedir(dir);
+	}
+	return names;
+}
+
+static void RemoveWorkDirectory()
+{
+	for (const char* subdirectory : { "/pending", "/leases", "/results" })
+	{
+		const std::string directory = WORK_DIRECTORY + subdirectory;
+		for (const std::string& name : ListFiles(directory))
+		{
+			std::remove((directory + "/" + name).c_str());
+		}
+		rmdir(directory.c_str());
+	}
+	std::remove((WORK_DIRECTORY + "/programs").c_str());
+	std::remove((WORK_DIRECTORY + "/started").c_str());
+	rmdir(WORK_DIRECTORY.c_str());
+}
+
+static void ExpectAllPassed(const size_t programCount)
+{
+	const BatchSummary summary = MergeShards(WORK_DIRECTORY);
+	if (summary.results.size() != programCount || !BatchPassed(summary))
+	{
+		throw std::runtime_error("Not every sharded program passed.\n");
+	}
+	if (!ListFiles(WORK_DIRECTORY + "/pending").empty() || !ListFiles(WORK_DIRECTORY + "/leases").empty() ||
+		ListFiles(WORK_DIRECTORY + "/results").size() != programCount)
+	{
+		throw std::runtime_error("The work directory wasn't left with only results.\n");
+	}
+}
+
+//worker processes share the programs between them
+//and every program is run exactly once
+static void Test_ShardedWorkers()
+{
+	RemoveWorkDirectory();
+	InitShards("InstructionTests", WORK_DIRECTORY);
+	const size_t programCount = FindBatchPrograms("InstructionTests").size();
+
+	const uint32_t workerCount = 3;
+	std::vector<pid_t> workers;
+	for (uint32_t i = 0; i < workerCount; i++)
+	{
+		std::cout.flush();
+		const pid_t worker = fork();
+		if (worker == 0)
+		{
+			uint32_t ran = 255;
+			try
+			{
+				ran = RunShardWorker(WORK_DIRECTORY, NO_LIMITS, DEFAULT_LEASE_SECONDS);
+			}
+			catch (const std::exception&)
+			{
+			}
+			_exit(static_cast<int>(ran));
+		}
+		workers.push_back(worker);
+	}
+	uint32_t ran = 0;
+	for (const pid_t worker : workers)
+	{
+		int status = 0;
+		waitpid(worker, &status, 0);
+		if (!WIFEXITED(status) || WEXITSTATUS(status) == 255)
+		{
+			throw std::runtime_error("A shard worker failed.\n");
+		}
+		ran += WEXITSTATUS(status);
+	}
+	if (ran != programCount)
+	{
+		throw std::runtime_error("The workers ran " + std::to_string(ran) + " programs instead of " + std::to_string(programCount) + ".\n");
+	}
+	ExpectAllPassed(programCount);
+
+	//a program without a result is an error in the merged summary
+	std::remove((WORK_DIRECTORY + "/results/3").c_str());
+	const BatchSummary summary = MergeShards(WORK_DIRECTORY);
+	if (BatchPassed(summary) || summary.results[3].status != BatchStatus::Error || summary.results[3].message != "No result")
+	{
+		throw std::runtime_error("A missing result wasn't an error.\n");
+	}
+	RemoveWorkDirectory();
+
+	Success("test_sharded_workers");
+}
+
+//a lease held by a worker that died is taken over once it runs out
+static void Test_ShardedReclaim()
+{
+	RemoveWorkDirectory();
+	InitShards("tests/task1", WORK_DIRECTORY);
+	if (std::rename((WORK_DIRECTORY + "/pending/1").c_str(), (WORK_DIRECTORY + "/leases/1.dead-1").c_str()) != 0)
+	{
+		throw std::runtime_error("Failed to make a lease.\n");
+	}
+	utime((WORK_DIRECTORY + "/leases/1.dead-1").c_str(), nullptr);
+
+	const auto start = std::chrono::steady_clock::now();
+	const uint32_t ran = RunShardWorker(WORK_DIRECTORY, NO_LIMITS, 1);
+	const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	if (ran != 4 || seconds < 0.9)
+	{
+		throw std::runtime_error("The dead lease wasn't waited for and taken over.\nRan: " + std::to_string(ran) +
+			"\nSeconds: " + std::to_string(seconds) + "\n");
+	}
+	ExpectAllPassed(4);
+	RemoveWorkDirectory();
+
+	Success("test_sharded_reclaim");
+}
+
+#endif
+
+void TestShardedBatch()
+{
+#ifndef _WIN32
+	try
+	{
+		Test_ShardedWorkers();
+		Test_ShardedReclaim();
+	}
+	catch (std::runtime_error& e)
+	{
+		RemoveWorkDirectory();
+		std::cout << "Failed to finish all sharded batch tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all sharded batch tests\n" << std::endl;
+#endif
+}
@@ -0,0 +1,287 @@
+#include "TestSimulationServer.h"
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <atomic>
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "SimulationServer.h"
+#ifndef _WIN32
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+static const std::string SOCKET_FILE = "test_server.sock";
+static const RunLimits SERVER_LIMITS = { 1 << 16, 10.0 };
+
+static void Success(const std::string& testName)
+{
+	std::cout << "Test Success: " << testName << std::endl;
+}
+
+//sums 1 to a0 into a1
+static std::string SumRequest(const uint32_t n)
+{
+	const uint32_t program[] =
+	{
+		Create_add(Regs::a1, Regs::a1, Regs::a0),
+		Create_addi(Regs::a0, Regs::a0, static_cast<uint32_t>(-1)),
+		Create_bne(Regs::a0, Regs::x0, static_cast<uint32_t>(-8)),
+		Create_addi(Regs::a0, Regs::x0, 10),
+		Create_ecall()
+	};
+	std::ostringstream request;
+	request << "run ";
+	for (uint32_t i = 0; i < 5; i++)
+	{
+		request << (i == 0 ? "0x" : ",0x") << std::hex << program[i];
+	}
+	request << std::dec << " x10=" << n;
+	return request.str();
+}
+
+static void ExpectSum(const std::string& response, const uint32_t n)
+{
+	std::istringstream stream(response);
+	std::string status;
+	uint64_t instructions;
+	stream >> status >> instructions;
+	std::vector<uint32_t> registers;
+	std::string value;
+	while (stream >> value)
+	{
+		registers.push_back(static_cast<uint32_t>(std::stoul(value, nullptr, 16)));
+	}
+	if (status != "ok" || instructions != 3 * n + 2 || registers.size() != 32 ||
+		registers[static_cast<uint32_t>(Regs::a1)] != n * (n + 1) / 2 || registers[static_cast<uint32_t>(Regs::a0)] != 10)
+	{
+		throw std::runtime_error("Incorrect server response for the sum of " + std::to_string(n) + ":\n" + response + "\n");
+	}
+}
+
+static void ExpectError(const std::string& response, const std::string& message)
+{
+	if (response.compare(0, 6, "error ") != 0 || response.find(message) == std::string::npos)
+	{
+		throw std::runtime_error("Expected an error with " + message + " but got:\n" + response + "\n");
+	}
+}
+
+static void Test_LatencyHistogram()
+{
+	LatencyHistogram histogram;
+	if (histogram.Percentile(0.5) != 0.0)
+	{
+		throw std::runtime_error("An empty histogram has no percentiles.\n");
+	}
+	for (uint32_t i = 0; i < 98; i++)
+	{
+		histogram.Add(100.0);
+	}
+	histogram.Add(10'000.0);
+	histogram.Add(10'000.0);
+
+	//a percentile is at most one bucket above the real latency
+	const double p50 = histogram.Percentile(0.50);
+	const double p99 = histogram.Percentile(0.99);
+	if (histogram.GetCount() != 100 || p50 < 100.0 || p50 > 100.0 * 1.1 || p99 < 10'000.0 || p99 > 10'000.0 * 1.1)
+	{
+		throw std::runtime_error("Incorrect percentiles.\np50: " + std::to_string(p50) + "\np99: " + std::to_string(p99) + "\n");
+	}
+
+	Success("test_latency_histogram");
+}
+
+static void Test_ServerRequests()
+{
+	SimulationServer server(2, SERVER_LIMITS);
+	ExpectSum(server.HandleRequest(SumRequest(10)), 10);
+	ExpectSum(server.HandleRequest(SumRequest(100)), 100);
+
+	ExpectError(server.HandleRequest("jump 0x13"), "Unknown request");
+	ExpectError(server.HandleRequest("run"), "at least one instruction");
+	ExpectError(server.HandleRequest("run 0x13,zz"), "Not a 32 bit number");
+	ExpectError(server.HandleRequest("run 0x13 x32=1"), "Not a register");
+	ExpectError(server.HandleRequest("run " + std::to_string(Create_jal(Regs::x0, 0))), "exceeded the limit");
+	//the processor that ran the endless program is reused with nothing left of it
+	ExpectSum(server.HandleRequest(SumRequest(7)), 7);
+
+	const ServerStatistics statistics = server.GetStatistics();
+	if (statistics.requests != 8 || statistics.errors != 5 || statistics.cacheMisses != 2 || statistics.cacheHits != 2 ||
+		statistics.queueDepth != 0 || statistics.maxQueueDepth != 1 || statistics.processors != 1 ||
+		statistics.p50Microseconds <= 0.0 || statistics.p99Microseconds < statistics.p50Microseconds)
+	{
+		throw std::runtime_error("Incorrect server statistics:\n" + server.HandleRequest("stats") + "\n");
+	}
+	if (server.HandleRequest("stats").compare(0, 21, "stats requests=8 erro") != 0)
+	{
+		throw std::runtime_error("Incorrect stats response:\n" + server.HandleRequest("stats") + "\n");
+	}
+
+	Success("test_server_requests");
+}
+
+#ifndef _WIN32
+
+class Client
+{
+private:
+	int connection;
+	std::string buffered;
+
+public:
+	Client(const std::string& socketPath)
+	{
+		sockaddr_un address = { };
+		address.sun_family = AF_UNIX;
+		std::strcpy(address.sun_path, socketPath.c_str());
+		//the server may not be listening yet
+		for (uint32_t attempt = 0; attempt < 200; attempt++)
+		{
+			connection = socket(AF_UNIX, SOCK_STREAM, 0);
+			if (connect(connection, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) == 0)
+			{
+				return;
+			}
+			close(connection);
+			std::this_thread::sleep_for(std::chrono::milliseconds(10));
+		}
+		throw std::runtime_error("Failed to connect to " + socketPath + "\n");
+	}
+
+	~Client()
+	{
+		close(connection);
+	}
+
+	std::string Request(const std::string& request)
+	{
+		const std::string line = request + "\n";
+		if (send(connection, line.data(), line.size(), MSG_NOSIGNAL) != static_cast<ssize_t>(line.size()))
+		{
+			throw std::runtime_error("Failed to send a request\n");
+		}
+		char buffer[1024];
+		while (buffered.find('\n') == std::string::npos)
+		{
+			const ssize_t count = recv(connection, buffer, sizeof(buffer), 0);
+			if (count <= 0)
+			{
+				throw std::runtime_error("The server closed the connection\n");
+			}
+			buffered.append(buffer, static_cast<size_t>(count));
+		}
+		const std::string response = buffered.substr(0, buffered.find('\n'));
+		buffered.erase(0, response.size() + 1);
+		return response;
+	}
+};
+
+//several clients at once, each with its own connection
+static void Test_ServerSocket()
+{
+	SimulationServer server(2, SERVER_LIMITS);
+	std::string serveError;
+	std::thread serving([&]()
+	{
+		try
+		{
+			server.Serve(SOCKET_FILE);
+		}
+		catch (const std::runtime_error& e)
+		{
+			serveError = e.what();
+		}
+	});
+
+	const uint32_t clientCount = 4;
+	const uint32_t requestsPerClient = 25;
+	std::vector<std::string> clientErrors(clientCount);
+	std::vector<std::thread> clients;
+	for (uint32_t i = 0; i < clientCount; i++)
+	{
+		clients.emplace_back([&, i]()
+		{
+			try
+			{
+				Client client(SOCKET_FILE);
+				for (uint32_t request = 0; request < requestsPerClient; request++)
+				{
+					const uint32_t n = 1 + i * requestsPerClient + request;
+					ExpectSum(client.Request(SumRequest(n)), n);
+				}
+			}
+			catch (const std::runtime_error& e)
+			{
+				clientErrors[i] = e.what();
+			}
+		});
+	}
+	for (std::thread& client : clients)
+	{
+		client.join();
+	}
+
+	std::string stats;
+	std::string shutdown;
+	{
+		Client client(SOCKET_FILE);
+		stats = client.Request("stats");
+		shutdown = client.Request("shutdown");
+	}
+	serving.join();
+
+	for (const std::string& error : clientErrors)
+	{
+		if (!error.empty())
+		{
+			throw std::runtime_error(error);
+		}
+	}
+	if (!serveError.empty() || shutdown != "ok")
+	{
+		throw std::runtime_error("The server didn't shut down.\n" + serveError + "\n");
+	}
+	const std::string expected = "stats requests=" + std::to_string(clientCount * requestsPerClient) + " errors=0";
+	if (stats.compare(0, expected.size(), expected) != 0 || server.GetStatistics().processors > 2)
+	{
+		throw std::runtime_error("Incorrect server statistics:\n" + stats + "\n");
+	}
+	if (std::remove(SOCKET_FILE.c_str()) == 0)
+	{
+		throw std::runtime_error("The socket file wasn't removed on shutdown\n");
+	}
+
+	Success("test_server_socket");
+}
+
+#endif
+
+void TestSimulationServer()
+{
+	try
+	{
+		Test_LatencyHistogram();
+		Test_ServerRequests();
+#ifndef _WIN32
+		Test_ServerSocket();
+#endif
+	}
+	catch (std::runtime_error& e)
+	{
+		std::remove(SOCKET_FILE.c_str());
+		std::cout << "Failed to finish all simulation server tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all simulation server tests\n" << std::endl;
+}
@@ -0,0 +1,434 @@
+#include "TestTrace.h"
+#include <cstdint>
+#include <cstdio>
+#include <stdexcept>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <memory>
+#include <algorithm>
+#include <sstream>
+#include <atomic>
+#include <thread>
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "RISCV_Program.h"
+#include "ExecutionTrace.h"
+#include "AsyncTraceWriter.h"
+#include "Processor.h"
+#include "UART.h"
+
+static const std::string TRACE_FILE = "test_trace";
+static const uint32_t STORE_ADDRESS = 0x1000;
+
+static void Success(const std::string& testName)
+{
+	std::cout << "Test Success: " << testName << std::endl;
+}
+
+//keeps every record in memory
+class RecordingSink : public TraceSink
+{
+public:
+	std::vector<TraceRecord> records;
+
+	void Write(const TraceRecord& record) override
+	{
+		records.push_back(record);
+	}
+};
+
+//holds on to the first record until it is released, which
+//keeps the ring of an asynchronous writer full
+class StalledSink : public TraceSink
+{
+public:
+	std::atomic<bool> isReleased{ false };
+	std::vector<TraceRecord> records;
+
+	void Write(const TraceRecord& record) override
+	{
+		while (!isReleased.load())
+		{
+			std::this_thread::yield();
+		}
+		records.push_back(record);
+	}
+};
+
+class FailingSink : public TraceSink
+{
+public:
+	uint32_t written = 0;
+
+	void Write(const TraceRecord&) override
+	{
+		if (++written == 10)
+		{
+			throw std::runtime_error("Trace sink failed.");
+		}
+	}
+};
+
+static TraceRecord NumberedRecord(const uint64_t instruction)
+{
+	return { instruction, static_cast<uint32_t>(instruction * 4), Create_addi(Regs::a0, Regs::a0, 1),
+		static_cast<uint32_t>(instruction), 0, 0, static_cast<uint8_t>(Regs::a0), TRACE_WRITES_RD };
+}
+
+static bool IsSameRecord(const TraceRecord& a, const TraceRecord& b)
+{
+	return a.instruction == b.instruction && a.pc == b.pc && a.rawInstruction == b.rawInstruction && a.flags == b.flags &&
+		a.rd == b.rd && a.rdValue == b.rdValue && a.memoryAddress == b.memoryAddress && a.memoryValue == b.memoryValue;
+}
+
+static std::string DescribeRecords(const TraceRecord& expected, const TraceRecord& actual)
+{
+	return "Expected: " + TraceRecordAsString(expected) + "\nActual:   " + TraceRecordAsString(actual) + "\n";
+}
+
+//stores and loads iterations words counting down, so the
+//trace has every kind of record and repeats itself a lot
+static void AddLoop(RISCV_Program& program, const uint32_t iterations, uint32_t* loopStart)
+{
+	program.SetRegister(Regs::t0, STORE_ADDRESS);
+	program.SetRegister(Regs::t1, iterations);
+	*loopStart = static_cast<uint32_t>(program.GetInstructionCount()) * 4;
+	program.AddInstruction(Create_sw(Regs::t0, Regs::t1, 0));
+	program.AddInstruction(Create_lw(Regs::t2, Regs::t0, 0));
+	program.AddInstruction(Create_addi(Regs::t0, Regs::t0, 4));
+	program.AddInstruction(Create_addi(Regs::t1, Regs::t1, static_cast<uint32_t>(-1)));
+	program.AddInstruction(Create_bne(Regs::t1, Regs::x0, static_cast<uint32_t>(-16)));
+	program.ExpectRegisterValue(Regs::t0, STORE_ADDRESS + 4 * iterations);
+	program.ExpectRegisterValue(Regs::t1, 0);
+	program.ExpectRegisterValue(Regs::t2, 1);
+	program.EndProgram();
+}
+
+static std::vector<TraceRecord> TraceLoop(const uint32_t iterations, uint32_t* loopStart)
+{
+	RISCV_Program program("Test_Trace");
+	AddLoop(program, iterations, loopStart);
+	auto sink = std::make_shared<RecordingSink>();
+	program.SetTrace(sink);
+	program.Test();
+
+	const InstructionView code = program.GetInstructions();
+	for (size_t i = 0; i < sink->records.size(); i++)
+	{
+		const TraceRecord& record = sink->records[i];
+		if (record.instruction != i || record.pc / 4 >= code.size || record.rawInstruction != code[record.pc / 4])
+		{
+			throw std::runtime_error("Trace record " + std::to_string(i) + " has the wrong instruction.\n" + TraceRecordAsString(record) + "\n");
+		}
+	}
+	if (sink->records.size() != program.GetInstructionsExecuted())
+	{
+		throw std::runtime_error("Trace has " + std::to_string(sink->records.size()) + " records but " +
+			std::to_string(program.GetInstructionsExecuted()) + " instructions were executed.\n");
+	}
+	return sink->records;
+}
+
+static void Test_TraceRecords()
+{
+	const uint32_t iterations = 10;
+	uint32_t loopStart;
+	const std::vector<TraceRecord> records = TraceLoop(iterations, &loopStart);
+
+	const size_t first = loopStart / 4;
+	for (uint32_t i = 0; i < iterations; i++)
+	{
+		const uint64_t n = first + 5 * i;
+		const uint32_t address = STORE_ADDRESS + 4 * i;
+		const uint32_t value = iterations - i;
+		const TraceRecord expected[] =
+		{
+			{ n + 0, loopStart +  0, records[n + 0].rawInstruction, 0, address, value, 0, TRACE_STORE },
+			{ n + 1, loopStart +  4, records[n + 1].rawInstruction, value, address, value, static_cast<uint8_t>(Regs::t2), TRACE_WRITES_RD | TRACE_LOAD },
+			{ n + 2, loopStart +  8, records[n + 2].rawInstruction, address + 4, 0, 0, static_cast<uint8_t>(Regs::t0), TRACE_WRITES_RD },
+			{ n + 3, loopStart + 12, records[n + 3].rawInstruction, value - 1, 0, 0, static_cast<uint8_t>(Regs::t1), TRACE_WRITES_RD },
+			{ n + 4, loopStart + 16, records[n + 4].rawInstruction, 0, 0, 0, 0, 0 }
+		};
+		for (uint32_t k = 0; k < 5; k++)
+		{
+			if (!IsSameRecord(expected[k], records[n + k]))
+			{
+				throw std::runtime_error("Wrong trace record in iteration " + std::to_string(i) + ".\n" + DescribeRecords(expected[k], records[n + k]));
+			}
+		}
+	}
+
+	Success("test_trace_records");
+}
+
+static void Test_TraceFile()
+{
+	const uint32_t interval = 64;
+	uint32_t loopStart;
+	const std::vector<TraceRecord> records = TraceLoop(1000, &loopStart);
+	{
+		TraceFileWriter writer(TRACE_FILE, interval);
+		for (const TraceRecord& record : records)
+		{
+			writer.Write(record);
+		}
+	}
+
+	TraceFileReader reader(TRACE_FILE);
+	if (reader.GetRecordCount() != records.size() || reader.GetIndex().size() != (records.size() + interval - 1) / interval)
+	{
+		throw std::runtime_error("Trace file has " + std::to_string(reader.GetRecordCount()) + " records in " +
+			std::to_string(reader.GetIndex().size()) + " blocks instead of " + std::to_string(records.size()) + " records.\n");
+	}
+	const std::vector<TraceRecord> all = reader.Read(0, UINT64_MAX);
+	if (all.size() != records.size())
+	{
+		throw std::runtime_error("Read " + std::to_string(all.size()) + " of " + std::to_string(records.size()) + " trace records.\n");
+	}
+	for (size_t i = 0; i < records.size(); i++)
+	{
+		if (!IsSameRecord(records[i], all[i]))
+		{
+			throw std::runtime_error("Trace record " + std::to_string(i) + " changed in the file.\n" + DescribeRecords(records[i], all[i]));
+		}
+	}
+
+	//the ends of blocks and ranges crossing them
+	const uint64_t seeks[] = { 0, interval - 1, interval, interval + 1, 10 * interval - 2, records.size() - 1 };
+	for (const uint64_t seek : seeks)
+	{
+		const std::vector<TraceRecord> range = reader.Read(seek, 3);
+		const size_t expectedSize = std::min<size_t>(3, records.size() - seek);
+		if (range.size() != expectedSize)
+		{
+			throw std::runtime_error("Read " + std::to_string(range.size()) + " trace records from " + std::to_string(seek) + ".\n");
+		}
+		for (size_t i = 0; i < range.size(); i++)
+		{
+			if (!IsSameRecord(records[seek + i], range[i]))
+			{
+				throw std::runtime_error("Seeking to " + std::to_string(seek) + " read the wrong record.\n" + DescribeRecords(records[seek + i], range[i]));
+			}
+		}
+	}
+	if (!reader.Read(records.size(), 1).empty())
+	{
+		throw std::runtime_error("Read a trace record past the end.\n");
+	}
+
+	//a loop is the same bytes every iteration, so it should take
+	//less room than just the instruction words
+	std::ifstream file(TRACE_FILE, std::ios::binary | std::ios::ate);
+	const uint64_t fileSize = static_cast<uint64_t>(file.tellg());
+	if (fileSize >= records.size() * 4)
+	{
+		throw std::runtime_error("Trace file of " + std::to_string(records.size()) + " records takes " + std::to_string(fileSize) + " bytes.\n");
+	}
+
+	Success("test_trace_file");
+}
+
+static void Test_TraceGaps()
+{
+	{
+		TraceFileWriter writer(TRACE_FILE, 4);
+		for (uint64_t i = 0; i < 25; i++)
+		{
+			if (i < 10 || i >= 20)
+			{
+				writer.Write(NumberedRecord(i));
+			}
+		}
+		bool threw = false;
+		try
+		{
+			writer.Write(NumberedRecord(3));
+		}
+		catch (const std::runtime_error&)
+		{
+			threw = true;
+		}
+		if (!threw)
+		{
+			throw std::runtime_error("Trace writer took a record out of order.\n");
+		}
+	}
+
+	TraceFileReader reader(TRACE_FILE);
+	//0-3, 4-7, 8-9, 20-23 and 24
+	if (reader.GetIndex().size() != 5 || reader.GetRecordCount() != 15)
+	{
+		throw std::runtime_error("Trace with a gap has " + std::to_string(reader.GetIndex().size()) + " blocks.\n");
+	}
+	const std::vector<TraceRecord> range = reader.Read(9, 3);
+	if (range.size() != 3 || range[0].instruction != 9 || range[1].instruction != 20 || range[2].instruction != 21 || range[1].rdValue != 20)
+	{
+		throw std::runtime_error("Read the wrong records across a gap in the trace.\n");
+	}
+	const std::vector<TraceRecord> afterGap = reader.Read(12, 1);
+	if (afterGap.size() != 1 || afterGap[0].instruction != 20 || afterGap[0].pc != 80)
+	{
+		throw std::runtime_error("Seeking into a gap in the trace didn't find the next record.\n");
+	}
+
+	Success("test_trace_gaps");
+}
+
+static void Test_AsyncTrace()
+{
+	uint32_t loopStart;
+	const std::vector<TraceRecord> expected = TraceLoop(1000, &loopStart);
+
+	//a tiny ring so the run has to wait for the background thread
+	RISCV_Program program("Test_AsyncTrace");
+	AddLoop(program, 1000, &loopStart);
+	auto sink = std::make_shared<RecordingSink>();
+	auto writer = std::make_shared<AsyncTraceWriter>(sink, 8, TraceFullPolicy::Block);
+	program.SetTrace(writer);
+	program.Test();
+	writer->Close();
+
+	if (writer->GetDroppedCount() != 0 || sink->records.size() != expected.size())
+	{
+		throw std::runtime_error("Asynchronous trace has " + std::to_string(sink->records.size()) + " of " + std::to_string(expected.size()) +
+			" records and dropped " + std::to_string(writer->GetDroppedCount()) + ".\n");
+	}
+	for (size_t i = 0; i < expected.size(); i++)
+	{
+		if (!IsSameRecord(expected[i], sink->records[i]))
+		{
+			throw std::runtime_error("Asynchronous trace changed record " + std::to_string(i) + ".\n" + DescribeRecords(expected[i], sink->records[i]));
+		}
+	}
+
+	Success("test_async_trace");
+}
+
+static void Test_AsyncTraceDrop()
+{
+	auto sink = std::make_shared<StalledSink>();
+	AsyncTraceWriter writer(sink, 4, TraceFullPolicy::Drop);
+	//the sink doesn't return before it is released, so
+	//only the records that fit in the ring get through
+	for (uint64_t i = 0; i < 100; i++)
+	{
+		writer.Write(NumberedRecord(i));
+	}
+	sink->isReleased.store(true);
+	writer.Close();
+
+	if (writer.GetDroppedCount() != 96 || sink->records.size() != 4)
+	{
+		throw std::runtime_error("Full ring dropped " + std::to_string(writer.GetDroppedCount()) + " records and kept " +
+			std::to_string(sink->records.size()) + " instead of dropping 96.\n");
+	}
+	for (uint64_t i = 0; i < 4; i++)
+	{
+		if (!IsSameRecord(NumberedRecord(i), sink->records[i]))
+		{
+			throw std::runtime_error("Full ring kept the wrong record.\n" + DescribeRecords(NumberedRecord(i), sink->records[i]));
+		}
+	}
+
+	Success("test_async_trace_drop");
+}
+
+static void Test_AsyncTraceFailure()
+{
+	auto sink = std::make_shared<FailingSink>();
+	AsyncTraceWriter writer(sink, 4, TraceFullPolicy::Block);
+	//once the sink has failed the records are thrown away, so this doesn't wait forever
+	for (uint64_t i = 0; i < 100; i++)
+	{
+		writer.Write(NumberedRecord(i));
+	}
+	bool threw = false;
+	try
+	{
+		writer.Close();
+	}
+	catch (const std::runtime_error&)
+	{
+		threw = true;
+	}
+	if (!threw || sink->written != 10)
+	{
+		throw std::runtime_error("Closing an asynchronous trace didn't report that its sink failed.\n");
+	}
+
+	Success("test_async_trace_failure");
+}
+
+//the printed trace is written by a background thread, but it still comes
+//out between the lines the guest prints and before what the caller prints
+static void Test_PrintedTraceOrder()
+{
+	const std::vector<uint32_t> code = {
+		Create_lui(Regs::t0, UART::DEFAULT_BASE >> 12),
+		Create_addi(Regs::t1, Regs::x0, 'A'),
+		Create_sb(Regs::t0, Regs::t1, 0),
+		Create_addi(Regs::t1, Regs::x0, '\n'),
+		//the uart writes the line here
+		Create_sb(Regs::t0, Regs::t1, 0),
+		Create_addi(Regs::a0, Regs::x0, 10),
+		Create_ecall()
+	};
+
+	std::ostringstream output;
+	std::streambuf* const console = std::cout.rdbuf(output.rdbuf());
+	try
+	{
+		Processor processor;
+		processor.AttachDevice(UART::DEFAULT_BASE, UART::SIZE, std::make_shared<UART>(&std::cout));
+		processor.SetPrintExecutedInstruction(true);
+		processor.Load(code.data(), code.size());
+		processor.RunFor(1000);
+		std::cout << "done" << std::endl;
+		processor.SetPrintExecutedInstruction(false);
+	}
+	catch (...)
+	{
+		std::cout.rdbuf(console);
+		throw;
+	}
+	std::cout.rdbuf(console);
+
+	std::vector<std::string> lines;
+	std::istringstream stream(output.str());
+	for (std::string line; std::getline(stream, line);)
+	{
+		lines.push_back(line);
+	}
+	if (lines.size() != code.size() + 2 || lines[4] != "A" || lines.back() != "done")
+	{
+		throw std::runtime_error("Printed trace is out of order with the console output.\n" + output.str());
+	}
+
+	Success("test_printed_trace_order");
+}
+
+void TestTrace()
+{
+	try
+	{
+		Test_TraceRecords();
+		Test_TraceFile();
+		Test_TraceGaps();
+		Test_AsyncTrace();
+		Test_AsyncTraceDrop();
+		Test_AsyncTraceFailure();
+		Test_PrintedTraceOrder();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::remove(TRACE_FILE.c_str());
+		std::cout << "Failed to finish all trace tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+	std::remove(TRACE_FILE.c_str());
+
+	std::cout << "Successfully finished all trace tests\n" << std::endl;
+}
@@ -0,0 +1,309 @@
+#include "TestVirtualMemory.h"
+#include <cstdint>
+#include <stdexcept>
+#include <iostream>
+#include <string>
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "RISCV_Program.h"
+#include "CSR.h"
+#include "Processor.h"
+
+//Physical layout used by the tests:
+//0x0000 code, 0x2000 and 0x3000 data pages,
+//0x4000 root page table, 0x5000 and 0x6000 leaf page tables
+static const uint32_t ROOT_TABLE = 0x4000;
+static const uint32_t CODE_TABLE = 0x5000;
+static const uint32_t DATA_TABLE = 0x6000;
+
+static void Success(const std::string& testName)
+{
+	std::cout << "Test Success: " << testName << std::endl;
+}
+
+static void StoreWord(RISCV_Program& program, const uint32_t address, const uint32_t value)
+{
+	program.SetRegister(Regs::t1, address);
+	program.SetRegister(Regs::t2, value);
+	program.AddInstruction(Create_sw(Regs::t1, Regs::t2, 0));
+}
+
+//Maps virtual page 0 to the code at physical page 0 and
+//virtual 0x4000'2000 to physical 0x3000. Virtual 0x4000'3000
+//maps the leaf page table of the data page so the supervisor
+//can change the mapping itself. The pages are picked so they
+//don't share a slot in the direct mapped TLB.
+static void CreatePageTables(RISCV_Program& program)
+{
+	StoreWord(program, ROOT_TABLE + 0x000 * 4, ((CODE_TABLE >> 12) << 10) | 0b0000'0001);
+	StoreWord(program, ROOT_TABLE + 0x100 * 4, ((DATA_TABLE >> 12) << 10) | 0b0000'0001);
+	StoreWord(program, CODE_TABLE + 0, (0 << 10) | 0b0000'1011);
+	StoreWord(program, DATA_TABLE + 2 * 4, (3 << 10) | 0b0000'0111);
+	StoreWord(program, DATA_TABLE + 3 * 4, (6 << 10) | 0b0000'0111);
+}
+
+//Enables Sv32 and drops to supervisor mode at the
+//instruction following the mret
+static void EnterSupervisorMode(RISCV_Program& program)
+{
+	program.SetRegister(Regs::t2, 0x80'00'00'00 | (ROOT_TABLE >> 12));
+	program.AddInstruction(Create_csrrw(Regs::x0, Regs::t2, static_cast<uint32_t>(CSR::satp)));
+	program.SetRegister(Regs::t2, 1 << 11);
+	program.AddInstruction(Create_csrrs(Regs::x0, Regs::t2, static_cast<uint32_t>(CSR::mstatus)));
+
+	const uint32_t supervisorEntry = static_cast<uint32_t>(program.GetInstructionCount()) * 4 + 16;
+	program.AddInstruction(Create_auipc(Regs::t3, 0));
+	program.AddInstruction(Create_addi(Regs::t3, Regs::t3, 16));
+	program.AddInstruction(Create_csrrw(Regs::x0, Regs::t3, static_cast<uint32_t>(CSR::mepc)));
+	program.AddInstruction(Create_mret());
+	program.ExpectRegisterValue(Regs::t3, supervisorEntry);
+}
+
+static void Test_PageFault()
+{
+	RISCV_Program program("Test_PageFault");
+
+	//jump over the machine mode trap handler at address 4
+	program.AddInstruction(Create_jal(Regs::x0, 28));
+	program.AddInstruction(Create_csrrs(Regs::s0, Regs::x0, static_cast<uint32_t>(CSR::mcause)));
+	program.AddInstruction(Create_csrrs(Regs::s1, Regs::x0, static_cast<uint32_t>(CSR::mtval)));
+	program.AddInstruction(Create_lui(Regs::s3, DATA_TABLE >> 12));
+	program.AddInstruction(Create_lw(Regs::s2, Regs::s3, 2 * 4));
+	program.AddInstruction(Create_addi(Regs::a0, Regs::x0, 10));
+	program.AddInstruction(Create_ecall());
+
+	program.SetRegister(Regs::t0, 4);
+	program.AddInstruction(Create_csrrw(Regs::x0, Regs::t0, static_cast<uint32_t>(CSR::mtvec)));
+	CreatePageTables(program);
+	EnterSupervisorMode(program);
+
+	program.SetRegister(Regs::t4, 0x40'00'20'00);
+	program.SetRegister(Regs::t5, 1234);
+	program.AddInstruction(Create_sw(Regs::t4, Regs::t5, 16));
+	program.AddInstruction(Create_lw(Regs::a1, Regs::t4, 16));
+	program.ExpectRegisterValue(Regs::a1, 1234);
+
+	//nothing is mapped here so this traps to the handler
+	program.SetRegister(Regs::a2, 0x80'00'00'00);
+	program.AddInstruction(Create_lw(Regs::a3, Regs::a2, 0));
+	program.ExpectRegisterValue(Regs::a3, 0);
+	program.EndProgram();
+
+	program.ExpectRegisterValue(Regs::s0, static_cast<uint32_t>(TrapCause::LoadPageFault));
+	program.ExpectRegisterValue(Regs::s1, 0x80'00'00'00);
+	program.ExpectRegisterValue(Regs::s3, DATA_TABLE);
+	//the store has to set both the accessed and dirty bit
+	program.ExpectRegisterValue(Regs::s2, (3 << 10) | 0b1100'0111);
+	program.ExpectRegisterValue(Regs::a0, 10);
+
+	program.Test();
+
+	Success("test_page_fault");
+}
+
+static void Test_TLBFlush()
+{
+	RISCV_Program program("Test_TLBFlush");
+
+	CreatePageTables(program);
+	EnterSupervisorMode(program);
+
+	program.SetRegister(Regs::t4, 0x40'00'20'00);
+	program.SetRegister(Regs::t5, 111);
+	program.AddInstruction(Create_sw(Regs::t4, Regs::t5, 0));
+
+	//point the data page at physical 0x2000 instead
+	program.SetRegister(Regs::s4, 0x40'00'30'00);
+	program.SetRegister(Regs::t6, (2 << 10) | 0b0000'0111);
+	program.AddInstruction(Create_sw(Regs::s4, Regs::t6, 2 * 4));
+
+	//the old translation is still cached until sfence.vma
+	program.AddInstruction(Create_lw(Regs::a1, Regs::t4, 0));
+	program.AddInstruction(Create_sfence_vma(Regs::x0, Regs::x0));
+	program.AddInstruction(Create_lw(Regs::a2, Regs::t4, 0));
+	program.ExpectRegisterValue(Regs::a1, 111);
+	program.ExpectRegisterValue(Regs::a2, 0);
+	program.EndProgram();
+
+	program.Test();
+
+	const MMUStatistics& statistics = program.GetStatistics();
+	//code, data and page table page before the flush
+	//and code and data page after it
+	if (statistics.pageWalks != 5 || statistics.tlbFlushes != 2 || statistics.tlbHits == 0)
+	{
+		throw std::runtime_error("Unexpected TLB statistics.\nPage walks: " + std::to_string(statistics.pageWalks) +
+			"\nFlushes: " + std::to_string(statistics.tlbFlushes) +
+			"\nHits: " + std::to_string(statistics.tlbHits) + "\n");
+	}
+
+	Success("test_tlb_flush");
+}
+
+//sfence.vma with an address has to drop every cached
+//page of the megapage the address is in
+static void Test_MegapageFlush()
+{
+	RISCV_Program program("Test_MegapageFlush");
+	//room for a second megapage at physical 0x40'0000
+	program.SetMemoryOptions({ 0x80'00'00, false, false });
+
+	//virtual 0x8000'0000 is a megapage at physical 0,
+	//which lets the supervisor write the root table
+	CreatePageTables(program);
+	StoreWord(program, ROOT_TABLE + 0x200 * 4, (0 << 10) | 0b0000'0111);
+	EnterSupervisorMode(program);
+
+	program.SetRegister(Regs::s4, 0x80'00'20'00);
+	program.SetRegister(Regs::t5, 111);
+	program.AddInstruction(Create_sw(Regs::s4, Regs::t5, 0));
+	program.SetRegister(Regs::s5, 0x80'00'30'00);
+	program.AddInstruction(Create_sw(Regs::s5, Regs::t5, 0));
+
+	//point the megapage at physical 0x40'0000 and flush only
+	//the first of the two pages that were used
+	program.SetRegister(Regs::s6, 0x80'00'40'00 + 0x200 * 4);
+	program.SetRegister(Regs::t6, (0x400 << 10) | 0b0000'0111);
+	program.AddInstruction(Create_sw(Regs::s6, Regs::t6, 0));
+	program.AddInstruction(Create_sfence_vma(Regs::s4, Regs::x0));
+	program.AddInstruction(Create_lw(Regs::a1, Regs::s4, 0));
+	program.AddInstruction(Create_lw(Regs::a2, Regs::s5, 0));
+	program.ExpectRegisterValue(Regs::a1, 0);
+	program.ExpectRegisterValue(Regs::a2, 0);
+	program.EndProgram();
+
+	program.Test();
+
+	Success("test_megapage_flush");
+}
+
+//A machine mode handler at address 4 which saves mcause,
+//mtval and mepc in s0, s1 and s2 and ends the program
+static void AddTrapHandler(RISCV_Program& program)
+{
+	program.AddInstruction(Create_jal(Regs::x0, 24));
+	program.AddInstruction(Create_csrrs(Regs::s0, Regs::x0, static_cast<uint32_t>(CSR::mcause)));
+	program.AddInstruction(Create_csrrs(Regs::s1, Regs::x0, static_cast<uint32_t>(CSR::mtval)));
+	program.AddInstruction(Create_csrrs(Regs::s2, Regs::x0, static_cast<uint32_t>(CSR::mepc)));
+	program.AddInstruction(Create_addi(Regs::a0, Regs::x0, 10));
+	program.AddInstruction(Create_ecall());
+	program.SetRegister(Regs::t0, 4);
+	program.AddInstruction(Create_csrrw(Regs::x0, Regs::t0, static_cast<uint32_t>(CSR::mtvec)));
+}
+
+//a word the decoder doesn't know and a jump past the end of
+//the program trap to the guest instead of stopping the simulator
+static void Test_GuestTraps()
+{
+	//an op with a funct7 no instruction has
+	const uint32_t unknownWord = 0xfe'00'00'33;
+
+	RISCV_Program illegal("Test_IllegalInstruction");
+	AddTrapHandler(illegal);
+	const uint32_t illegalPC = static_cast<uint32_t>(illegal.GetInstructionCount()) * 4;
+	illegal.AddInstruction(unknownWord);
+	illegal.ExpectRegisterValue(Regs::s0, static_cast<uint32_t>(TrapCause::IllegalInstruction));
+	illegal.ExpectRegisterValue(Regs::s1, unknownWord);
+	illegal.ExpectRegisterValue(Regs::s2, illegalPC);
+	illegal.ExpectRegisterValue(Regs::a0, 10);
+	illegal.Test();
+
+	RISCV_Program outside("Test_InstructionAccessFault");
+	AddTrapHandler(outside);
+	outside.SetRegister(Regs::t1, 0x1000);
+	outside.AddInstruction(Create_jalr(Regs::x0, Regs::t1, 0));
+	outside.ExpectRegisterValue(Regs::s0, static_cast<uint32_t>(TrapCause::InstructionAccessFault));
+	outside.ExpectRegisterValue(Regs::s1, 0x1000);
+	outside.ExpectRegisterValue(Regs::s2, 0x1000);
+	outside.ExpectRegisterValue(Regs::a0, 10);
+	outside.Test();
+
+	//without a handler the run stops at the trap
+	const uint32_t noHandler[] = { Create_jal(Regs::x0, 12), unknownWord, Create_ecall() };
+	Processor processor;
+	processor.Load(noHandler, 3);
+	if (processor.RunFor(UINT64_MAX) != RunStatus::Trap || processor.GetUnhandledTrap().cause != TrapCause::InstructionAccessFault ||
+		processor.GetUnhandledTrap().value != 12)
+	{
+		throw std::runtime_error("Jumping past the program didn't stop with an instruction access fault.\n");
+	}
+	processor.Load(noHandler + 1, 2);
+	if (processor.RunFor(UINT64_MAX) != RunStatus::Trap || processor.GetUnhandledTrap().cause != TrapCause::IllegalInstruction ||
+		processor.GetUnhandledTrap().value != unknownWord)
+	{
+		throw std::runtime_error("An unknown instruction didn't stop with an illegal instruction trap.\n");
+	}
+
+	Success("test_guest_traps");
+}
+
+//loads and stores the memory can't do trap to the guest too
+static void Test_AccessFaults()
+{
+	const uint32_t unmapped = 0x40'00'00'00;
+	RISCV_Program program("Test_LoadAccessFault");
+	AddTrapHandler(program);
+	program.SetRegister(Regs::t1, unmapped);
+	const uint32_t loadPC = static_cast<uint32_t>(program.GetInstructionCount()) * 4;
+	program.AddInstruction(Create_lw(Regs::a1, Regs::t1, 8));
+	program.ExpectRegisterValue(Regs::s0, static_cast<uint32_t>(TrapCause::LoadAccessFault));
+	program.ExpectRegisterValue(Regs::s1, unmapped + 8);
+	program.ExpectRegisterValue(Regs::s2, loadPC);
+	program.ExpectRegisterValue(Regs::a0, 10);
+	program.Test();
+
+	//read only host memory can be loaded from but not stored to
+	uint8_t readOnly[4096] = { 42 };
+	const uint32_t readOnlyBase = 0x10'00'00'00;
+	const uint32_t stores[] =
+	{
+		Create_lui(Regs::t0, readOnlyBase >> 12),
+		Create_lbu(Regs::a1, Regs::t0, 0),
+		Create_sb(Regs::t0, Regs::a1, 1),
+		Create_ecall()
+	};
+	Processor processor;
+	processor.MapHostMemory(readOnlyBase, sizeof(readOnly), readOnly, false);
+	processor.Load(stores, 4);
+	if (processor.RunFor(UINT64_MAX) != RunStatus::Trap || processor.GetUnhandledTrap().cause != TrapCause::StoreAccessFault ||
+		processor.GetUnhandledTrap().value != readOnlyBase + 1 || processor.GetRegister(static_cast<uint32_t>(Regs::a1)) != 42 || readOnly[1] != 0)
+	{
+		throw std::runtime_error("Storing to read only memory didn't stop with a store access fault.\n");
+	}
+
+	//and an atomic on nothing is a store access fault as well
+	const uint32_t atomic[] =
+	{
+		Create_lui(Regs::t0, unmapped >> 12),
+		Create_amoadd_w(Regs::a1, Regs::t0, Regs::t0, AtomicOrdering::None),
+		Create_ecall()
+	};
+	processor.Load(atomic, 3);
+	if (processor.RunFor(UINT64_MAX) != RunStatus::Trap || processor.GetUnhandledTrap().cause != TrapCause::StoreAccessFault ||
+		processor.GetUnhandledTrap().value != unmapped)
+	{
+		throw std::runtime_error("amoadd.w on unmapped memory didn't stop with a store access fault.\n");
+	}
+
+	Success("test_access_faults");
+}
+
+void TestVirtualMemory()
+{
+	try
+	{
+		Test_PageFault();
+		Test_TLBFlush();
+		Test_MegapageFlush();
+		Test_GuestTraps();
+		Test_AccessFaults();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all virtual memory tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all virtual memory tests\n" << std::endl;
+}
@@ -0,0 +1,3 @@
+#pragma once
+
+void TestVirtualMemory();
\ No newline at end of file
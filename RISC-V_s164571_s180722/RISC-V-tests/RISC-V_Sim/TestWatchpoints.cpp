@@ -0,0 +1,132 @@
+#include "TestWatchpoints.h"
+#include <cstdint>
+#include <stdexcept>
+#include <iostream>
+#include <string>
+#include "InstructionEncode.h"
+#include "Register.h"
+#include "RISCV_Program.h"
+#include "Watchpoint.h"
+
+static void Success(const std::string& testName)
+{
+	std::cout << "Test Success: " << testName << std::endl;
+}
+
+static std::string DescribeHit(const WatchpointHit* hit)
+{
+	if (hit == nullptr)
+	{
+		return "No watchpoint was hit.\n";
+	}
+	return "pc: " + std::to_string(hit->pc) +
+		"\nInstruction: " + hit->instruction +
+		"\nAddress: " + std::to_string(hit->address) +
+		"\nOld value: " + std::to_string(hit->oldValue) +
+		"\nNew value: " + std::to_string(hit->newValue) + "\n";
+}
+
+static void Test_WriteWatchpoint()
+{
+	RISCV_Program program("Test_WriteWatchpoint");
+	program.AddWatchpoint({ 0x1010, 4, WatchType::Write });
+
+	program.SetRegister(Regs::t0, 0x1000);
+	program.SetRegister(Regs::t1, 5);
+	program.SetRegister(Regs::t3, 0x2000);
+	//same page as the watchpoint but not the watched bytes
+	program.AddInstruction(Create_sw(Regs::t0, Regs::t1, 0));
+	program.AddInstruction(Create_sw(Regs::t0, Regs::t1, 12));
+	program.AddInstruction(Create_sw(Regs::t3, Regs::t1, 0));
+	//reads doesn't trigger a write watchpoint
+	program.AddInstruction(Create_lw(Regs::a1, Regs::t0, 16));
+	program.SetRegister(Regs::t2, 77);
+
+	const uint32_t hitPC = static_cast<uint32_t>(program.GetInstructionCount()) * 4;
+	program.AddInstruction(Create_sw(Regs::t0, Regs::t2, 16));
+	program.AddInstruction(Create_addi(Regs::a2, Regs::x0, 1));
+	program.EndProgram();
+
+	program.Run();
+
+	const WatchpointHit* hit = program.GetWatchpointHit();
+	if (hit == nullptr || !hit->isWrite || hit->pc != hitPC || hit->instruction != "sw t2 16(t0)" ||
+		hit->address != 0x1010 || hit->oldValue != 0 || hit->newValue != 77)
+	{
+		throw std::runtime_error("Write watchpoint reported the wrong hit.\n" + DescribeHit(hit));
+	}
+	//the run stops before the store so nothing after it has run
+	if (program.GetProgramResult()[static_cast<uint32_t>(Regs::a2)] != 0)
+	{
+		throw std::runtime_error("Program continued after a watchpoint was hit.\n");
+	}
+
+	Success("test_write_watchpoint");
+}
+
+static void Test_ReadWatchpoint()
+{
+	RISCV_Program program("Test_ReadWatchpoint");
+	//range crossing from page 3 into page 4
+	program.AddWatchpoint({ 0x3ffc, 8, WatchType::Read });
+
+	program.SetRegister(Regs::t0, 0x3ffc);
+	program.SetRegister(Regs::t1, 1234);
+	program.SetRegister(Regs::t2, 99);
+	program.AddInstruction(Create_sw(Regs::t0, Regs::t1, 0));
+	program.AddInstruction(Create_sw(Regs::t0, Regs::t2, 4));
+
+	const uint32_t hitPC = static_cast<uint32_t>(program.GetInstructionCount()) * 4;
+	program.AddInstruction(Create_lw(Regs::a1, Regs::t0, 4));
+	program.EndProgram();
+
+	program.Run();
+
+	const WatchpointHit* hit = program.GetWatchpointHit();
+	if (hit == nullptr || hit->isWrite || hit->pc != hitPC || hit->address != 0x4000 || hit->oldValue != 99)
+	{
+		throw std::runtime_error("Read watchpoint reported the wrong hit.\n" + DescribeHit(hit));
+	}
+
+	Success("test_read_watchpoint");
+}
+
+static void Test_NoWatchpointHit()
+{
+	RISCV_Program program("Test_NoWatchpointHit");
+	program.AddWatchpoint({ 0x2000, 16, WatchType::ReadWrite });
+
+	program.SetRegister(Regs::t0, 0x2010);
+	program.SetRegister(Regs::t1, 42);
+	program.AddInstruction(Create_sw(Regs::t0, Regs::t1, 0));
+	program.AddInstruction(Create_lw(Regs::a1, Regs::t0, 0));
+	program.ExpectRegisterValue(Regs::a1, 42);
+	program.EndProgram();
+
+	program.Test();
+
+	if (program.GetWatchpointHit() != nullptr)
+	{
+		throw std::runtime_error("Watchpoint hit by an access outside its range.\n" + DescribeHit(program.GetWatchpointHit()));
+	}
+
+	Success("test_no_watchpoint_hit");
+}
+
+void TestWatchpoints()
+{
+	try
+	{
+		Test_WriteWatchpoint();
+		Test_ReadWatchpoint();
+		Test_NoWatchpointHit();
+	}
+	catch (std::runtime_error& e)
+	{
+		std::cout << "Failed to finish all watchpoint tests" << std::endl;
+		std::cout << e.what() << std::endl;
+		return;
+	}
+
+	std::cout << "Successfully finished all watchpoint tests\n" << std::endl;
+}
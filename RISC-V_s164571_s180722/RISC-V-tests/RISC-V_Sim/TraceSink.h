@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cstdint>
+
+//bits of TraceRecord::flags
+const uint8_t TRACE_WRITES_RD = 1;
+const uint8_t TRACE_LOAD      = 2;
+const uint8_t TRACE_STORE     = 4;
+
+//What a retired instruction did. It has a fixed size and no pointers so
+//it can be copied around as is. An instruction that traps never retires,
+//so it has no record.
+struct TraceRecord
+{
+	//the number of instructions the hart had retired before this one
+	uint64_t instruction;
+	uint32_t pc;
+	uint32_t rawInstruction;
+	//the value written to rd, only set with TRACE_WRITES_RD
+	uint32_t rdValue;
+	//the address rs1 + immediate of a load, store or atomic
+	uint32_t memoryAddress;
+	//the value loaded into rd, or the stored value cut to the size
+	//of the store. Atomics have the value they loaded
+	uint32_t memoryValue;
+	uint8_t rd;
+	uint8_t flags;
+};
+
+//Gets a record for every instruction a processor retires, in the order
+//they were retired. Write is called on the thread running the processor,
+//unless the sink is behind an AsyncTraceWriter.
+class TraceSink
+{
+public:
+	virtual void Write(const TraceRecord& record) = 0;
+	//writes out what the sink has held back so far
+	virtual void Flush() { }
+
+	virtual ~TraceSink() { }
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+
+enum class PrivilegeMode : uint32_t
+{
+	User       = 0,
+	Supervisor = 1,
+	Machine    = 3
+};
+
+enum class TrapCause : uint32_t
+{
+	InstructionAddressMisaligned = 0,
+	InstructionAccessFault		 = 1,
+	IllegalInstruction			 = 2,
+	Breakpoint					 = 3,
+	LoadAddressMisaligned		 = 4,
+	LoadAccessFault				 = 5,
+	StoreAddressMisaligned		 = 6,
+	StoreAccessFault			 = 7,
+	EnvironmentCallFromUMode	 = 8,
+	EnvironmentCallFromSMode	 = 9,
+	EnvironmentCallFromMMode	 = 11,
+	InstructionPageFault		 = 12,
+	LoadPageFault				 = 13,
+	StorePageFault				 = 15
+};
+
+//Thrown when the guest does something that the hardware
+//would report as a synchronous exception. The processor
+//catches it and redirects the guest to its trap handler.
+struct Trap
+{
+	TrapCause cause;
+	uint32_t value;
+};
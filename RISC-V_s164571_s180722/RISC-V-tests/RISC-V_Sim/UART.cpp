@@ -0,0 +1,112 @@
+#include "UART.h"
+#include <cstdint>
+#include <string>
+
+namespace UARTRegister
+{
+	const uint32_t RBR_THR = 0;
+	const uint32_t IER     = 1;
+	const uint32_t IIR_FCR = 2;
+	const uint32_t LCR     = 3;
+	const uint32_t MCR     = 4;
+	const uint32_t LSR     = 5;
+	const uint32_t MSR     = 6;
+	const uint32_t SCR     = 7;
+}
+
+namespace LineStatus
+{
+	const uint8_t DATA_READY        = 1 << 0;
+	const uint8_t TRANSMITTER_EMPTY = 1 << 5;
+	const uint8_t TRANSMITTER_IDLE  = 1 << 6;
+}
+
+UART::UART(std::ostream* output) : output(output)
+{
+	transmitBuffer.reserve(BUFFER_SIZE);
+}
+
+uint32_t UART::Read(const uint32_t offset, const uint32_t size)
+{
+	//registers are a byte wide so only the first byte is used
+	switch (offset)
+	{
+		case UARTRegister::RBR_THR:
+		{
+			if (receiveBuffer.empty())
+			{
+				return 0;
+			}
+			const uint8_t value = receiveBuffer.front();
+			receiveBuffer.pop_front();
+			return value;
+		}
+		case UARTRegister::IER:
+			return interruptEnable;
+		case UARTRegister::IIR_FCR:
+			//no interrupt pending
+			return 1;
+		case UARTRegister::LCR:
+			return lineControl;
+		case UARTRegister::MCR:
+			return modemControl;
+		case UARTRegister::LSR:
+			//transmitting never blocks as output is buffered on the host
+			return LineStatus::TRANSMITTER_EMPTY | LineStatus::TRANSMITTER_IDLE |
+				   (receiveBuffer.empty() ? 0 : LineStatus::DATA_READY);
+		case UARTRegister::SCR:
+			return scratch;
+		default:
+			return 0;
+	}
+}
+
+void UART::Write(const uint32_t offset, const uint32_t size, const uint32_t value)
+{
+	const uint8_t byte = static_cast<uint8_t>(value);
+	switch (offset)
+	{
+		case UARTRegister::RBR_THR:
+			transmitBuffer.push_back(static_cast<char>(byte));
+			if (byte == '\n' || transmitBuffer.size() >= BUFFER_SIZE)
+			{
+				Flush();
+			}
+			break;
+		case UARTRegister::IER:
+			interruptEnable = byte;
+			break;
+		case UARTRegister::LCR:
+			lineControl = byte;
+			break;
+		case UARTRegister::MCR:
+			modemControl = byte;
+			break;
+		case UARTRegister::SCR:
+			scratch = byte;
+			break;
+		default:
+			//fifo control and the status registers ignore writes
+			break;
+	}
+}
+
+void UART::AddInput(const std::string& input)
+{
+	receiveBuffer.insert(receiveBuffer.end(), input.begin(), input.end());
+}
+
+void UART::Flush()
+{
+	if (output != nullptr && !transmitBuffer.empty())
+	{
+		output->write(transmitBuffer.data(), transmitBuffer.size());
+		output->flush();
+	}
+	transmitBuffer.clear();
+}
+
+UART::~UART()
+{
+	Flush();
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <ostream>
+#include <string>
+#include "Device.h"
+
+//Subset of a 16550 UART. Transmitted characters are buffered
+//and written to the output stream a line at a time, so a guest
+//printing a string doesn't cost a stream write per character.
+class UART : public Device
+{
+private:
+	const static size_t BUFFER_SIZE = 256;
+
+	std::ostream* output;
+	std::string transmitBuffer;
+	std::deque<uint8_t> receiveBuffer;
+	uint8_t interruptEnable = 0;
+	uint8_t lineControl = 0;
+	uint8_t modemControl = 0;
+	uint8_t scratch = 0;
+
+public:
+	const static uint32_t DEFAULT_BASE = 0x10'00'00'00;
+	const static uint32_t SIZE = 0x10'00;
+
+	UART(std::ostream* output);
+
+	uint32_t Read(const uint32_t offset, const uint32_t size) override;
+	void Write(const uint32_t offset, const uint32_t size, const uint32_t value) override;
+
+	void AddInput(const std::string& input);
+	void Flush();
+
+	~UART() override;
+};
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+enum class WatchType : uint32_t
+{
+	Read      = 1,
+	Write     = 2,
+	ReadWrite = 3
+};
+
+//Watches size bytes of physical ram starting at address
+struct Watchpoint
+{
+	uint32_t address;
+	uint32_t size;
+	WatchType type;
+};
+
+//Thrown by the memory when a watched byte is accessed. The access
+//itself isn't done so the program stops before the instruction.
+//pc and instruction are filled in by the processor
+struct WatchpointHit
+{
+	Watchpoint watchpoint;
+	uint32_t address;
+	uint32_t size;
+	bool isWrite;
+	uint32_t oldValue;
+	uint32_t newValue;
+	uint32_t pc;
+	std::string instruction;
+};
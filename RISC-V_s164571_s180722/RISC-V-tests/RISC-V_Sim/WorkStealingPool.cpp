@@ -0,0 +1,142 @@
+#include "WorkStealingPool.h"
+#include <cstdint>
+#include <algorithm>
+
+//index of the worker running on this thread, tasks submitted from a
+//worker goes to its own queue so related work stays on one thread
+static thread_local WorkStealingPool* currentPool = nullptr;
+static thread_local uint32_t currentWorker = 0;
+
+WorkStealingPool::WorkStealingPool(const uint32_t threadCount) : nextQueue(0), queuedTasks(0)
+{
+	const uint32_t count = (threadCount != 0) ? threadCount : std::max(1u, std::thread::hardware_concurrency());
+	for (uint32_t i = 0; i < count; i++)
+	{
+		queues.push_back(std::make_unique<WorkerQueue>());
+	}
+	for (uint32_t i = 0; i < count; i++)
+	{
+		threads.emplace_back(&WorkStealingPool::WorkerLoop, this, i);
+	}
+}
+
+void WorkStealingPool::Submit(std::function<void()> task)
+{
+	Push(std::move(task), false);
+}
+
+void WorkStealingPool::SubmitBehind(std::function<void()> task)
+{
+	Push(std::move(task), true);
+}
+
+void WorkStealingPool::Push(std::function<void()> task, const bool behind)
+{
+	const uint32_t queueIndex = (currentPool == this) ? currentWorker : (nextQueue++ % queues.size());
+	{
+		std::lock_guard<std::mutex> guard(stateLock);
+		unfinishedTasks++;
+	}
+	{
+		std::lock_guard<std::mutex> guard(queues[queueIndex]->lock);
+		//workers take their own tasks from the back
+		if (behind)
+		{
+			queues[queueIndex]->tasks.push_front(std::move(task));
+		}
+		else
+		{
+			queues[queueIndex]->tasks.push_back(std::move(task));
+		}
+	}
+	{
+		//taken so a worker can't miss the task between
+		//checking the count and starting to wait
+		std::lock_guard<std::mutex> guard(stateLock);
+		queuedTasks++;
+	}
+	workAvailable.notify_one();
+}
+
+bool WorkStealingPool::TryPop(const uint32_t queueIndex, std::function<void()>* task)
+{
+	WorkerQueue& queue = *queues[queueIndex];
+	std::lock_guard<std::mutex> guard(queue.lock);
+	if (queue.tasks.empty())
+	{
+		return false;
+	}
+	*task = std::move(queue.tasks.back());
+	queue.tasks.pop_back();
+	return true;
+}
+
+bool WorkStealingPool::TrySteal(const uint32_t thiefIndex, std::function<void()>* task)
+{
+	for (uint32_t i = 1; i < queues.size(); i++)
+	{
+		WorkerQueue& queue = *queues[(thiefIndex + i) % queues.size()];
+		std::lock_guard<std::mutex> guard(queue.lock);
+		if (!queue.tasks.empty())
+		{
+			*task = std::move(queue.tasks.front());
+			queue.tasks.pop_front();
+			return true;
+		}
+	}
+	return false;
+}
+
+void WorkStealingPool::WorkerLoop(const uint32_t index)
+{
+	currentPool = this;
+	currentWorker = index;
+
+	while (true)
+	{
+		std::function<void()> task;
+		if (TryPop(index, &task) || TrySteal(index, &task))
+		{
+			queuedTasks--;
+			task();
+
+			std::lock_guard<std::mutex> guard(stateLock);
+			if (--unfinishedTasks == 0)
+			{
+				allDone.notify_all();
+			}
+			continue;
+		}
+
+		std::unique_lock<std::mutex> lock(stateLock);
+		workAvailable.wait(lock, [this]() { return stopping || queuedTasks > 0; });
+		if (stopping && queuedTasks == 0)
+		{
+			return;
+		}
+	}
+}
+
+void WorkStealingPool::Wait()
+{
+	std::unique_lock<std::mutex> lock(stateLock);
+	allDone.wait(lock, [this]() { return unfinishedTasks == 0; });
+}
+
+uint32_t WorkStealingPool::GetThreadCount() const
+{
+	return static_cast<uint32_t>(threads.size());
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+	{
+		std::lock_guard<std::mutex> guard(stateLock);
+		stopping = true;
+	}
+	workAvailable.notify_all();
+	for (std::thread& thread : threads)
+	{
+		thread.join();
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//Thread pool where every worker has its own task queue. A worker
+//takes the newest task from its own queue and, once that is empty,
+//steals the oldest task from another worker, so long and short
+//tasks even out across the threads without a single shared queue.
+class WorkStealingPool
+{
+private:
+	struct WorkerQueue
+	{
+		std::mutex lock;
+		std::deque<std::function<void()>> tasks;
+	};
+
+	std::vector<std::unique_ptr<WorkerQueue>> queues;
+	std::vector<std::thread> threads;
+	std::atomic<uint32_t> nextQueue;
+	std::atomic<uint64_t> queuedTasks;
+	uint64_t unfinishedTasks = 0;
+	bool stopping = false;
+	std::mutex stateLock;
+	std::condition_variable workAvailable;
+	std::condition_variable allDone;
+
+	void Push(std::function<void()> task, const bool behind);
+	bool TryPop(const uint32_t queueIndex, std::function<void()>* task);
+	bool TrySteal(const uint32_t thiefIndex, std::function<void()>* task);
+	void WorkerLoop(const uint32_t index);
+
+public:
+	//0 uses one thread per hardware thread
+	WorkStealingPool(const uint32_t threadCount);
+	WorkStealingPool(const WorkStealingPool&) = delete;
+	WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+	void Submit(std::function<void()> task);
+	//queues the task behind every task already queued on this worker,
+	//so a task that resubmits itself to continue later lets the
+	//others run first. It is also the next task to be stolen
+	void SubmitBehind(std::function<void()> task);
+	void Wait();
+	uint32_t GetThreadCount() const;
+
+	~WorkStealingPool();
+};
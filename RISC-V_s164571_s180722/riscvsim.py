@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+ctypes binding for libriscvsim, build it with make in RISC-V-tests/RISC-V_Sim
+
+usage: python3 riscvsim.py <program.bin> [budget]
+"""
+
+import ctypes
+import os
+import sys
+
+ERROR = -1
+OK = 0
+EXITED = 1
+BUDGET_EXHAUSTED = 2
+BREAKPOINT = 3
+WATCHPOINT_HIT = 4
+TRAP = 5
+WAITING_FOR_INTERRUPT = 6
+
+default_library = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'RISC-V-tests', 'RISC-V_Sim', 'lib', 'libriscvsim.so')
+
+
+class Simulator:
+    def __init__(self, ram_size=0, library=default_library):
+        self.lib = ctypes.CDLL(library)
+        self.lib.rvsim_create.restype = ctypes.c_void_p
+        self.lib.rvsim_create.argtypes = [ctypes.c_uint32]
+        self.lib.rvsim_destroy.argtypes = [ctypes.c_void_p]
+        self.lib.rvsim_load_file.argtypes = [ctypes.c_void_p, ctypes.c_char_p]
+        self.lib.rvsim_run.argtypes = [ctypes.c_void_p, ctypes.c_uint64]
+        self.lib.rvsim_read_registers.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+        self.lib.rvsim_read_pc.restype = ctypes.c_uint32
+        self.lib.rvsim_read_pc.argtypes = [ctypes.c_void_p]
+        self.lib.rvsim_instructions_executed.restype = ctypes.c_uint64
+        self.lib.rvsim_instructions_executed.argtypes = [ctypes.c_void_p]
+        self.lib.rvsim_read_trap.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32)]
+        self.lib.rvsim_read_memory.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.c_void_p, ctypes.c_size_t]
+        self.lib.rvsim_last_error.restype = ctypes.c_char_p
+        self.lib.rvsim_last_error.argtypes = [ctypes.c_void_p]
+
+        self.sim = self.lib.rvsim_create(ram_size)
+        if not self.sim:
+            raise MemoryError("Failed to create simulator")
+
+    def _check(self, status):
+        if status == ERROR:
+            raise RuntimeError(self.lib.rvsim_last_error(self.sim).decode())
+        return status
+
+    def load_file(self, path):
+        self._check(self.lib.rvsim_load_file(self.sim, path.encode()))
+
+    def run(self, budget=2**64 - 1):
+        return self._check(self.lib.rvsim_run(self.sim, budget))
+
+    def registers(self):
+        values = (ctypes.c_uint32 * 32)()
+        self.lib.rvsim_read_registers(self.sim, values)
+        return list(values)
+
+    def pc(self):
+        return self.lib.rvsim_read_pc(self.sim)
+
+    def instructions_executed(self):
+        return self.lib.rvsim_instructions_executed(self.sim)
+
+    def trap(self):
+        cause = ctypes.c_uint32()
+        value = ctypes.c_uint32()
+        self.lib.rvsim_read_trap(self.sim, ctypes.byref(cause), ctypes.byref(value))
+        return cause.value, value.value
+
+    def read_memory(self, address, size):
+        buffer = ctypes.create_string_buffer(size)
+        self._check(self.lib.rvsim_read_memory(self.sim, address, buffer, size))
+        return buffer.raw
+
+    def close(self):
+        if self.sim:
+            self.lib.rvsim_destroy(self.sim)
+            self.sim = None
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *args):
+        self.close()
+
+
+if __name__ == '__main__':
+    budget = int(sys.argv[2]) if len(sys.argv) > 2 else 2**64 - 1
+    with Simulator() as sim:
+        sim.load_file(sys.argv[1])
+        status = sim.run(budget)
+        print("status: ", status, " instructions: ", sim.instructions_executed(), " pc: ", sim.pc())
+        for index, value in enumerate(sim.registers()):
+            print("x" + str(index) + ": ", value)